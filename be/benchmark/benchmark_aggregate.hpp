@@ -0,0 +1,67 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+
+#include "data_generator.h"
+#include "vec/aggregate_functions/aggregate_function_simple_factory.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/columns_number.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris {
+
+// The rows of the nullable column an aggregate function without a group by adds per call.
+static constexpr size_t AGGREGATE_ROWS = 4096;
+
+static const std::string AGGREGATE_FUNCTIONS[] = {"sum", "min", "max", "avg"};
+
+// Arg 0: sum, min, max or avg. Arg 1: the nulls in percent.
+static void BM_Aggregate_NullableSinglePlace(::benchmark::State& state) {
+    auto nested = vectorized::ColumnInt64::create();
+    auto values = DataGenerator().uniform<int64_t>(AGGREGATE_ROWS, -1000000, 1000000);
+    nested->get_data().assign(values.begin(), values.end());
+    auto null_map = vectorized::ColumnUInt8::create();
+    auto nulls = DataGenerator().filter(AGGREGATE_ROWS, state.range(1) / 100.0);
+    null_map->get_data().assign(nulls.begin(), nulls.end());
+    auto column = vectorized::ColumnNullable::create(std::move(nested), std::move(null_map));
+
+    vectorized::DataTypes types = {
+            vectorized::make_nullable(std::make_shared<vectorized::DataTypeInt64>())};
+    auto function = vectorized::AggregateFunctionSimpleFactory::instance().get(
+            AGGREGATE_FUNCTIONS[state.range(0)], types, true);
+    std::unique_ptr<char[]> memory(new char[function->size_of_data()]);
+    vectorized::AggregateDataPtr place = memory.get();
+    function->create(place);
+    const vectorized::IColumn* columns[1] = {column.get()};
+    for (auto _ : state) {
+        function->add_batch_single_place(AGGREGATE_ROWS, place, columns, nullptr);
+        ::benchmark::DoNotOptimize(place);
+    }
+    function->destroy(place);
+    state.SetLabel(AGGREGATE_FUNCTIONS[state.range(0)]);
+    state.SetItemsProcessed(state.iterations() * AGGREGATE_ROWS);
+}
+BENCHMARK(BM_Aggregate_NullableSinglePlace)->ArgsProduct({{0, 1, 2, 3}, {1, 50}});
+
+} // namespace doris
@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "data_generator.h"
+#include "exprs/block_bloom_filter.hpp"
+
+namespace doris {
+
+// A filter of 2^range(0) bytes holding the hashes of the build rows of a join runtime filter,
+// probed by 1M hashes of which about 1/8 are inserted.
+class BlockBloomFilterFixture : public ::benchmark::Fixture {
+public:
+    static constexpr size_t PROBE_ROWS = 1 << 20;
+
+    void SetUp(const ::benchmark::State& state) override {
+        const int log_space_bytes = state.range(0);
+        // 16 bits per inserted hash
+        const size_t num_inserted = (size_t(1) << log_space_bytes) / 2;
+        DataGenerator generator;
+        auto inserted = generator.uniform<uint32_t>(num_inserted, 0, UINT32_MAX);
+        CHECK(_filter.init(log_space_bytes, 0).ok());
+        for (auto hash : inserted) {
+            _filter.insert(hash);
+        }
+        _hashes = generator.uniform<uint32_t>(PROBE_ROWS, 0, UINT32_MAX);
+        auto picks = generator.uniform<size_t>(PROBE_ROWS / 8, 0, num_inserted - 1);
+        for (size_t i = 0; i < picks.size(); ++i) {
+            _hashes[i * 8] = inserted[picks[i]];
+        }
+        _results.resize(PROBE_ROWS);
+    }
+
+    void TearDown(const ::benchmark::State&) override { _filter.close(); }
+
+protected:
+    BlockBloomFilter _filter;
+    std::vector<uint32_t> _hashes;
+    std::vector<uint8_t> _results;
+};
+
+BENCHMARK_DEFINE_F(BlockBloomFilterFixture, Find)(::benchmark::State& state) {
+    for (auto _ : state) {
+        for (size_t i = 0; i < PROBE_ROWS; ++i) {
+            _results[i] = _filter.find(_hashes[i]);
+        }
+        ::benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * PROBE_ROWS);
+}
+BENCHMARK_REGISTER_F(BlockBloomFilterFixture, Find)->Arg(16)->Arg(20)->Arg(26);
+
+BENCHMARK_DEFINE_F(BlockBloomFilterFixture, FindBatch)(::benchmark::State& state) {
+    for (auto _ : state) {
+        _filter.find_batch(_hashes.data(), PROBE_ROWS, _results.data());
+        ::benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * PROBE_ROWS);
+}
+BENCHMARK_REGISTER_F(BlockBloomFilterFixture, FindBatch)->Arg(16)->Arg(20)->Arg(26);
+
+} // namespace doris
@@ -0,0 +1,102 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include "data_generator.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/columns_number.h"
+
+namespace doris {
+
+// The columns ops are measured on the rows of a typical block.
+static constexpr size_t COLUMN_ROWS = 4096;
+
+static vectorized::ColumnPtr make_int64_column() {
+    auto column = vectorized::ColumnInt64::create();
+    auto values = DataGenerator().uniform<int64_t>(COLUMN_ROWS, INT64_MIN, INT64_MAX);
+    column->get_data().assign(values.begin(), values.end());
+    return column;
+}
+
+static vectorized::ColumnPtr make_string_column() {
+    auto column = vectorized::ColumnString::create();
+    for (const auto& s : DataGenerator().strings(COLUMN_ROWS, 4, 32, COLUMN_ROWS)) {
+        column->insert_data(s.data(), s.size());
+    }
+    return column;
+}
+
+static vectorized::ColumnPtr make_column(int64_t type) {
+    return type == 0 ? make_int64_column() : make_string_column();
+}
+
+// Arg 0: 0 for an int64 column, 1 for a string column. Arg 1: the selectivity in percent.
+static void BM_Column_Filter(::benchmark::State& state) {
+    auto column = make_column(state.range(0));
+    auto values = DataGenerator().filter(COLUMN_ROWS, state.range(1) / 100.0);
+    vectorized::IColumn::Filter filter;
+    filter.assign(values.begin(), values.end());
+    for (auto _ : state) {
+        auto res = column->filter(filter, -1);
+        ::benchmark::DoNotOptimize(res);
+    }
+    state.SetItemsProcessed(state.iterations() * COLUMN_ROWS);
+}
+BENCHMARK(BM_Column_Filter)->ArgsProduct({{0, 1}, {1, 50, 99}});
+
+static void BM_Column_Permute(::benchmark::State& state) {
+    auto column = make_column(state.range(0));
+    auto values = DataGenerator().permutation<size_t>(COLUMN_ROWS);
+    vectorized::IColumn::Permutation permutation;
+    permutation.assign(values.begin(), values.end());
+    for (auto _ : state) {
+        auto res = column->permute(permutation, 0);
+        ::benchmark::DoNotOptimize(res);
+    }
+    state.SetItemsProcessed(state.iterations() * COLUMN_ROWS);
+}
+BENCHMARK(BM_Column_Permute)->Arg(0)->Arg(1);
+
+static void BM_Column_InsertRangeFrom(::benchmark::State& state) {
+    auto column = make_column(state.range(0));
+    auto dst = column->clone_empty();
+    for (auto _ : state) {
+        dst->clear();
+        dst->insert_range_from(*column, 0, COLUMN_ROWS);
+        ::benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * COLUMN_ROWS);
+}
+BENCHMARK(BM_Column_InsertRangeFrom)->Arg(0)->Arg(1);
+
+static void BM_Column_InsertIndicesFrom(::benchmark::State& state) {
+    auto column = make_column(state.range(0));
+    auto indices = DataGenerator().uniform<uint32_t>(COLUMN_ROWS, 0, COLUMN_ROWS - 1);
+    auto dst = column->clone_empty();
+    for (auto _ : state) {
+        dst->clear();
+        dst->insert_indices_from(*column, indices.data(), indices.data() + indices.size());
+        ::benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * COLUMN_ROWS);
+}
+BENCHMARK(BM_Column_InsertIndicesFrom)->Arg(0)->Arg(1);
+
+} // namespace doris
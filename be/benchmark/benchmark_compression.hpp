@@ -0,0 +1,87 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <gen_cpp/segment_v2.pb.h>
+
+#include <string>
+#include <vector>
+
+#include "data_generator.h"
+#include "util/block_compression.h"
+#include "util/faststring.h"
+
+namespace doris {
+
+static const std::vector<std::pair<segment_v2::CompressionTypePB, std::string>>&
+benchmark_codecs() {
+    static const std::vector<std::pair<segment_v2::CompressionTypePB, std::string>> codecs = {
+            {segment_v2::CompressionTypePB::LZ4, "LZ4"},
+            {segment_v2::CompressionTypePB::LZ4F, "LZ4F"},
+            {segment_v2::CompressionTypePB::SNAPPY, "SNAPPY"},
+            {segment_v2::CompressionTypePB::ZSTD, "ZSTD"},
+            {segment_v2::CompressionTypePB::ZLIB, "ZLIB"}};
+    return codecs;
+}
+
+// About 1MB of strings from a small dictionary, like a page of a string column.
+static std::string make_compression_input() {
+    std::string input;
+    for (const auto& s : DataGenerator().strings(64 * 1024, 4, 28, 1024)) {
+        input.append(s);
+    }
+    return input;
+}
+
+// Arg 0: the index of the codec in benchmark_codecs().
+static void BM_Compression_Compress(::benchmark::State& state) {
+    const auto& [type, name] = benchmark_codecs()[state.range(0)];
+    state.SetLabel(name);
+    BlockCompressionCodec* codec = nullptr;
+    CHECK(get_block_compression_codec(type, &codec).ok());
+    auto input = make_compression_input();
+    faststring output;
+    for (auto _ : state) {
+        CHECK(codec->compress(Slice(input), &output).ok());
+        ::benchmark::DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+    state.counters["ratio"] = double(input.size()) / output.size();
+}
+BENCHMARK(BM_Compression_Compress)->DenseRange(0, 4);
+
+static void BM_Compression_Decompress(::benchmark::State& state) {
+    const auto& [type, name] = benchmark_codecs()[state.range(0)];
+    state.SetLabel(name);
+    BlockCompressionCodec* codec = nullptr;
+    CHECK(get_block_compression_codec(type, &codec).ok());
+    auto input = make_compression_input();
+    faststring compressed;
+    CHECK(codec->compress(Slice(input), &compressed).ok());
+    std::string output(input.size(), '\0');
+    for (auto _ : state) {
+        Slice output_slice(output.data(), output.size());
+        CHECK(codec->decompress(Slice(compressed.data(), compressed.size()), &output_slice).ok());
+        ::benchmark::DoNotOptimize(output.data());
+    }
+    state.SetBytesProcessed(state.iterations() * input.size());
+}
+BENCHMARK(BM_Compression_Decompress)->DenseRange(0, 4);
+
+} // namespace doris
@@ -0,0 +1,133 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+
+#include "data_generator.h"
+#include "vec/common/hash_table/hash.h"
+#include "vec/common/hash_table/join_hash_table.h"
+#include "vec/common/hash_table/ph_hash_map.h"
+
+namespace doris {
+
+// Aggregates 1M int64 keys of range(0) distinct values into a hash map, like a group by.
+static void BM_HashMap_Aggregate(::benchmark::State& state) {
+    constexpr size_t num_rows = 1 << 20;
+    auto keys = DataGenerator().uniform<uint64_t>(num_rows, 0, state.range(0) - 1);
+    using HashMap = PHHashMap<UInt64, UInt64, HashCRC32<UInt64>>;
+    for (auto _ : state) {
+        HashMap hash_map;
+        for (auto key : keys) {
+            HashMap::LookupResult it;
+            bool inserted;
+            hash_map.emplace(key, it, inserted);
+            if (inserted) {
+                *lookup_result_get_mapped(it) = 0;
+            }
+            ++*lookup_result_get_mapped(it);
+        }
+        ::benchmark::DoNotOptimize(hash_map.size());
+    }
+    state.SetItemsProcessed(state.iterations() * num_rows);
+}
+BENCHMARK(BM_HashMap_Aggregate)->Arg(1 << 10)->Arg(1 << 16)->Arg(1 << 22);
+
+// An inner join of a build side of range(0) rows with unique keys, probed by 1M keys of which
+// half are matched.
+class JoinHashTableFixture : public ::benchmark::Fixture {
+public:
+    using HashTable = JoinHashTable<UInt64, HashCRC32<UInt64>>;
+    static constexpr int BATCH_SIZE = 4096;
+    static constexpr size_t PROBE_ROWS = 1 << 20;
+
+    void SetUp(const ::benchmark::State& state) override {
+        _build_rows = state.range(0) + 1;
+        DataGenerator generator;
+        // row 0 is the mocked row
+        _build_keys = generator.permutation<UInt64>(_build_rows);
+        _probe_keys = generator.uniform<UInt64>(PROBE_ROWS, 0, _build_rows * 2);
+    }
+
+    void build(HashTable* hash_table) {
+        hash_table->prepare_build<TJoinOp::INNER_JOIN>(_build_rows, BATCH_SIZE, false);
+        auto bucket_size = hash_table->get_bucket_size();
+        std::vector<uint32_t> buckets(_build_rows);
+        std::vector<uint8_t> tags(_build_rows);
+        for (size_t i = 0; i < _build_rows; ++i) {
+            auto hash = hash_table->hash(_build_keys[i]);
+            buckets[i] = hash & (bucket_size - 1);
+            tags[i] = HashTable::bucket_tag(hash);
+        }
+        hash_table->build<TJoinOp::INNER_JOIN, false>(
+                _build_keys.data(), buckets.data(), _build_rows,
+                hash_table->use_bucket_tags() ? tags.data() : nullptr);
+    }
+
+protected:
+    size_t _build_rows = 0;
+    std::vector<UInt64> _build_keys;
+    std::vector<UInt64> _probe_keys;
+};
+
+BENCHMARK_DEFINE_F(JoinHashTableFixture, Build)(::benchmark::State& state) {
+    for (auto _ : state) {
+        HashTable hash_table;
+        build(&hash_table);
+        ::benchmark::DoNotOptimize(hash_table.size());
+    }
+    state.SetItemsProcessed(state.iterations() * _build_rows);
+}
+BENCHMARK_REGISTER_F(JoinHashTableFixture, Build)->Arg(1 << 12)->Arg(1 << 18)->Arg(1 << 22);
+
+BENCHMARK_DEFINE_F(JoinHashTableFixture, Probe)(::benchmark::State& state) {
+    HashTable hash_table;
+    build(&hash_table);
+    auto bucket_size = hash_table.get_bucket_size();
+    std::vector<uint32_t> probe_idxs(BATCH_SIZE + 1);
+    std::vector<uint32_t> build_idxs(BATCH_SIZE + 1);
+    std::vector<uint32_t> buckets(BATCH_SIZE);
+    for (auto _ : state) {
+        // probe block by block like the hash join probe operator
+        for (size_t start = 0; start < PROBE_ROWS; start += BATCH_SIZE) {
+            const auto* keys = _probe_keys.data() + start;
+            for (int i = 0; i < BATCH_SIZE; ++i) {
+                buckets[i] = hash_table.hash(keys[i]) & (bucket_size - 1);
+            }
+            hash_table.pre_build_idxs(buckets, nullptr);
+            int probe_idx = 0;
+            uint32_t build_idx = 0;
+            bool probe_visited = false;
+            while (probe_idx < BATCH_SIZE) {
+                auto [new_probe_idx, new_build_idx, matched_cnt] =
+                        hash_table.find_batch<TJoinOp::INNER_JOIN, false, false, false>(
+                                keys, buckets.data(), probe_idx, build_idx, BATCH_SIZE,
+                                probe_idxs.data(), probe_visited, build_idxs.data());
+                probe_idx = new_probe_idx;
+                build_idx = new_build_idx;
+                ::benchmark::DoNotOptimize(matched_cnt);
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * PROBE_ROWS);
+}
+BENCHMARK_REGISTER_F(JoinHashTableFixture, Probe)->Arg(1 << 12)->Arg(1 << 18)->Arg(1 << 22);
+
+} // namespace doris
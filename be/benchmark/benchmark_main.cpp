@@ -0,0 +1,59 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+#include "benchmark_aggregate.hpp"
+#include "benchmark_bloom_filter.hpp"
+#include "benchmark_column.hpp"
+#include "benchmark_compression.hpp"
+#include "benchmark_hash_table.hpp"
+#include "benchmark_operator.hpp"
+#include "benchmark_page_decoder.hpp"
+#include "runtime/exec_env.h"
+#include "runtime/memory/mem_tracker_limiter.h"
+#include "runtime/memory/thread_mem_tracker_mgr.h"
+#include "runtime/runtime_query_statistics_mgr.h"
+#include "runtime/thread_context.h"
+#include "util/cpu_info.h"
+
+// Microbenchmarks of the hot kernels of the backend on synthetic data, see data_generator.h.
+// Run with --benchmark_filter=<regex> to pick some of them, and compare the outputs of
+// --benchmark_out=<file> --benchmark_out_format=json of two builds with the compare.py tool
+// of google benchmark.
+int main(int argc, char** argv) {
+    doris::CpuInfo::init();
+    doris::ThreadLocalHandle::create_thread_local_if_not_exits();
+    doris::ExecEnv::GetInstance()->init_mem_tracker();
+    doris::thread_context()->thread_mem_tracker_mgr->init();
+    std::shared_ptr<doris::MemTrackerLimiter> tracker = doris::MemTrackerLimiter::create_shared(
+            doris::MemTrackerLimiter::Type::GLOBAL, "BE-Benchmark");
+    doris::thread_context()->thread_mem_tracker_mgr->attach_limiter_tracker(tracker);
+    // the query context of the operator benchmarks registers its statistics
+    doris::ExecEnv::GetInstance()->set_runtime_query_statistics_mgr(
+            new doris::RuntimeQueryStatiticsMgr());
+
+    ::benchmark::Initialize(&argc, argv);
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    ::benchmark::RunSpecifiedBenchmarks();
+    ::benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,285 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include "data_generator.h"
+#include "operator_benchmark_harness.h"
+#include "pipeline/exec/hashjoin_build_sink.h"
+#include "pipeline/exec/hashjoin_probe_operator.h"
+#include "pipeline/exec/sort_sink_operator.h"
+#include "pipeline/exec/sort_source_operator.h"
+#include "pipeline/exec/streaming_aggregation_operator.h"
+#include "vec/columns/columns_number.h"
+
+namespace doris {
+
+// The rows of the input of the operators, in blocks of the batch size.
+static constexpr size_t OPERATOR_ROWS = 1 << 20;
+static constexpr int OPERATOR_BATCH_SIZE = 4096;
+
+static vectorized::ColumnPtr make_bigint_column(const std::vector<int64_t>& values) {
+    auto column = vectorized::ColumnInt64::create();
+    column->get_data().assign(values.begin(), values.end());
+    return column;
+}
+
+// Keys of the cardinality with their values.
+static vectorized::Columns make_key_value_columns(size_t num_rows, int64_t cardinality) {
+    DataGenerator generator;
+    return {make_bigint_column(generator.uniform<int64_t>(num_rows, 0, cardinality - 1)),
+            make_bigint_column(generator.uniform<int64_t>(num_rows, INT64_MIN, INT64_MAX))};
+}
+
+// Arg 0: the cardinality of the sort key.
+static void BM_Operator_Sort(::benchmark::State& state) {
+    OperatorBenchmarkHarness harness;
+    auto tuple_id = harness.declare_tuple({TYPE_BIGINT, TYPE_BIGINT});
+    RETURN_IF_BENCHMARK_ERROR(state, harness.prepare(OPERATOR_BATCH_SIZE));
+
+    TPlanNode tnode = harness.plan_node(TPlanNodeType::SORT_NODE, {tuple_id});
+    TSortInfo sort_info;
+    sort_info.__set_ordering_exprs({harness.slot_ref(tuple_id, 0)});
+    sort_info.__set_is_asc_order({true});
+    sort_info.__set_nulls_first({false});
+    TSortNode sort_node;
+    sort_node.__set_sort_info(sort_info);
+    sort_node.__set_merge_by_exchange(false);
+    tnode.__set_sort_node(sort_node);
+
+    auto source = std::make_shared<pipeline::SortSourceOperatorX>(
+            harness.pool(), tnode, harness.next_operator_id(), harness.descs());
+    auto sink = std::make_shared<pipeline::SortSinkOperatorX>(harness.pool(), 1, tnode,
+                                                              harness.descs(), false);
+    sink->set_dests_id({source->operator_id()});
+    RETURN_IF_BENCHMARK_ERROR(state, sink->set_child(harness.child_of(tuple_id)));
+    RETURN_IF_BENCHMARK_ERROR(state, source->set_child(harness.child_of(tuple_id)));
+    RETURN_IF_BENCHMARK_ERROR(state, harness.open_operator(sink.get(), tnode));
+    RETURN_IF_BENCHMARK_ERROR(state, harness.open_operator(source.get(), tnode));
+
+    auto blocks = harness.make_blocks(tuple_id,
+                                      make_key_value_columns(OPERATOR_ROWS, state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto input = OperatorBenchmarkHarness::copy_blocks(blocks);
+        auto sink_state = harness.create_task_state();
+        auto source_state = harness.create_task_state();
+        auto shared_state = sink->create_shared_state();
+        state.ResumeTiming();
+
+        size_t num_rows = 0;
+        RETURN_IF_BENCHMARK_ERROR(
+                state, harness.sink(sink_state.get(), sink.get(), shared_state.get(), &input));
+        RETURN_IF_BENCHMARK_ERROR(state, harness.drain(source_state.get(), source.get(),
+                                                       shared_state.get(), &num_rows));
+        ::benchmark::DoNotOptimize(num_rows);
+
+        state.PauseTiming();
+        harness.collect_counters(sink_state.get(),
+                                 {"PartialSortTime", "MergeBlockTime", "PeakMemoryUsage"});
+        state.ResumeTiming();
+    }
+    harness.report(state, OPERATOR_ROWS);
+}
+BENCHMARK(BM_Operator_Sort)->Arg(1 << 10)->Arg(1 << 20)->Unit(::benchmark::kMillisecond);
+
+// The inner join of OPERATOR_ROWS probe rows with the unique keys of the build rows.
+class HashJoinOperatorFixture : public ::benchmark::Fixture {
+public:
+    void SetUp(::benchmark::State& state) override {
+        harness = std::make_unique<OperatorBenchmarkHarness>();
+        num_build_rows = state.range(0);
+        probe_tuple_id = harness->declare_tuple({TYPE_BIGINT, TYPE_BIGINT});
+        build_tuple_id = harness->declare_tuple({TYPE_BIGINT, TYPE_BIGINT});
+        auto output_tuple_id =
+                harness->declare_tuple({TYPE_BIGINT, TYPE_BIGINT, TYPE_BIGINT, TYPE_BIGINT});
+        RETURN_IF_BENCHMARK_ERROR(state, harness->prepare(OPERATOR_BATCH_SIZE));
+
+        tnode = harness->plan_node(TPlanNodeType::HASH_JOIN_NODE, {probe_tuple_id, build_tuple_id});
+        tnode.__set_num_children(2);
+        THashJoinNode join_node;
+        join_node.__set_join_op(TJoinOp::INNER_JOIN);
+        TEqJoinCondition eq_join_conjunct;
+        eq_join_conjunct.__set_left(harness->slot_ref(probe_tuple_id, 0));
+        eq_join_conjunct.__set_right(harness->slot_ref(build_tuple_id, 0));
+        eq_join_conjunct.__set_opcode(TExprOpcode::EQ);
+        join_node.__set_eq_join_conjuncts({eq_join_conjunct});
+        join_node.__set_vintermediate_tuple_id_list({probe_tuple_id, build_tuple_id});
+        join_node.__set_voutput_tuple_id(output_tuple_id);
+        join_node.__set_srcExprList(
+                {harness->slot_ref(probe_tuple_id, 0), harness->slot_ref(probe_tuple_id, 1),
+                 harness->slot_ref(build_tuple_id, 0), harness->slot_ref(build_tuple_id, 1)});
+        join_node.__set_is_broadcast_join(false);
+        join_node.__set_dist_type(TJoinDistributionType::PARTITIONED);
+        tnode.__set_hash_join_node(join_node);
+
+        probe = std::make_shared<pipeline::HashJoinProbeOperatorX>(
+                harness->pool(), tnode, harness->next_operator_id(), harness->descs());
+        build = std::make_shared<pipeline::HashJoinBuildSinkOperatorX>(harness->pool(), 1, tnode,
+                                                                       harness->descs(), false);
+        build->set_dests_id({probe->operator_id()});
+        RETURN_IF_BENCHMARK_ERROR(state, build->set_child(harness->child_of(build_tuple_id)));
+        RETURN_IF_BENCHMARK_ERROR(state, probe->set_child(harness->child_of(probe_tuple_id)));
+        RETURN_IF_BENCHMARK_ERROR(state, probe->set_child(harness->child_of(build_tuple_id)));
+        RETURN_IF_BENCHMARK_ERROR(state, harness->open_operator(build.get(), tnode));
+        RETURN_IF_BENCHMARK_ERROR(state, harness->open_operator(probe.get(), tnode));
+
+        DataGenerator generator;
+        build_blocks = harness->make_blocks(
+                build_tuple_id,
+                {make_bigint_column(generator.permutation<int64_t>(num_build_rows)),
+                 make_bigint_column(generator.uniform<int64_t>(num_build_rows, 0, INT64_MAX))});
+        probe_blocks = harness->make_blocks(
+                probe_tuple_id, make_key_value_columns(OPERATOR_ROWS, num_build_rows));
+    }
+
+    // Builds the hash table of the copy of the build blocks in the build task.
+    Status build_hash_table(std::vector<vectorized::Block>* input) {
+        return harness->sink(build_state.get(), build.get(), shared_state.get(), input);
+    }
+
+    void new_build_task() {
+        build_state = harness->create_task_state();
+        shared_state = build->create_shared_state();
+    }
+
+    void TearDown(::benchmark::State& state) override {
+        build_state.reset();
+        shared_state.reset();
+        build.reset();
+        probe.reset();
+        harness.reset();
+    }
+
+    std::unique_ptr<OperatorBenchmarkHarness> harness;
+    int64_t num_build_rows = 0;
+    TTupleId probe_tuple_id = 0;
+    TTupleId build_tuple_id = 0;
+    TPlanNode tnode;
+    std::shared_ptr<pipeline::HashJoinProbeOperatorX> probe;
+    std::shared_ptr<pipeline::HashJoinBuildSinkOperatorX> build;
+    std::vector<vectorized::Block> build_blocks;
+    std::vector<vectorized::Block> probe_blocks;
+    std::unique_ptr<RuntimeState> build_state;
+    std::shared_ptr<pipeline::BasicSharedState> shared_state;
+};
+
+// Arg 0: the build rows.
+BENCHMARK_DEFINE_F(HashJoinOperatorFixture, Build)(::benchmark::State& state) {
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto input = OperatorBenchmarkHarness::copy_blocks(build_blocks);
+        new_build_task();
+        state.ResumeTiming();
+
+        RETURN_IF_BENCHMARK_ERROR(state, build_hash_table(&input));
+
+        state.PauseTiming();
+        harness->collect_counters(build_state.get(), {"BuildTableInsertTime",
+                                                      "BuildSideHashComputingTime", "HashTable"});
+        state.ResumeTiming();
+    }
+    harness->report(state, num_build_rows);
+}
+BENCHMARK_REGISTER_F(HashJoinOperatorFixture, Build)
+        ->Arg(1 << 16)
+        ->Arg(1 << 20)
+        ->Unit(::benchmark::kMillisecond);
+
+// Arg 0: the build rows.
+BENCHMARK_DEFINE_F(HashJoinOperatorFixture, Probe)(::benchmark::State& state) {
+    auto build_input = OperatorBenchmarkHarness::copy_blocks(build_blocks);
+    new_build_task();
+    RETURN_IF_BENCHMARK_ERROR(state, build_hash_table(&build_input));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto input = OperatorBenchmarkHarness::copy_blocks(probe_blocks);
+        auto probe_state = harness->create_task_state();
+        state.ResumeTiming();
+
+        size_t num_rows = 0;
+        RETURN_IF_BENCHMARK_ERROR(state, harness->push_pull(probe_state.get(), probe.get(),
+                                                            shared_state.get(), &input, &num_rows));
+        ::benchmark::DoNotOptimize(num_rows);
+
+        state.PauseTiming();
+        harness->collect_counters(probe_state.get(),
+                                  {"ProbeWhenSearchHashTableTime", "ProbeWhenBuildSideOutputTime",
+                                   "ProbeWhenProbeSideOutputTime", "PeakMemoryUsage"});
+        state.ResumeTiming();
+    }
+    harness->report(state, OPERATOR_ROWS);
+}
+BENCHMARK_REGISTER_F(HashJoinOperatorFixture, Probe)
+        ->Arg(1 << 16)
+        ->Arg(1 << 20)
+        ->Unit(::benchmark::kMillisecond);
+
+// sum(value) group by key of the first phase. Arg 0: the number of the groups, the operator
+// passes the rows through when its hash table does not reduce them enough.
+static void BM_Operator_StreamingAgg(::benchmark::State& state) {
+    OperatorBenchmarkHarness harness;
+    auto input_tuple_id = harness.declare_tuple({TYPE_BIGINT, TYPE_BIGINT});
+    auto intermediate_tuple_id = harness.declare_tuple({TYPE_BIGINT, TYPE_BIGINT});
+    auto output_tuple_id = harness.declare_tuple({TYPE_BIGINT, TYPE_BIGINT});
+    RETURN_IF_BENCHMARK_ERROR(state, harness.prepare(OPERATOR_BATCH_SIZE));
+
+    TPlanNode tnode = harness.plan_node(TPlanNodeType::AGGREGATION_NODE, {output_tuple_id});
+    TAggregationNode agg_node;
+    agg_node.__set_grouping_exprs({harness.slot_ref(input_tuple_id, 0)});
+    agg_node.__set_aggregate_functions({harness.agg_fn("sum", TYPE_BIGINT, input_tuple_id, 1)});
+    agg_node.__set_intermediate_tuple_id(intermediate_tuple_id);
+    agg_node.__set_output_tuple_id(output_tuple_id);
+    agg_node.__set_need_finalize(false);
+    agg_node.__set_use_streaming_preaggregation(true);
+    agg_node.__set_is_first_phase(true);
+    tnode.__set_agg_node(agg_node);
+
+    auto op = std::make_shared<pipeline::StreamingAggOperatorX>(
+            harness.pool(), harness.next_operator_id(), tnode, harness.descs());
+    RETURN_IF_BENCHMARK_ERROR(state, op->set_child(harness.child_of(input_tuple_id)));
+    RETURN_IF_BENCHMARK_ERROR(state, harness.open_operator(op.get(), tnode));
+
+    auto blocks = harness.make_blocks(input_tuple_id,
+                                      make_key_value_columns(OPERATOR_ROWS, state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto input = OperatorBenchmarkHarness::copy_blocks(blocks);
+        auto task_state = harness.create_task_state();
+        state.ResumeTiming();
+
+        size_t num_rows = 0;
+        RETURN_IF_BENCHMARK_ERROR(state, harness.push_pull(task_state.get(), op.get(), nullptr,
+                                                           &input, &num_rows));
+        ::benchmark::DoNotOptimize(num_rows);
+
+        state.PauseTiming();
+        harness.collect_counters(task_state.get(), {"HashTableComputeTime", "HashTableEmplaceTime",
+                                                    "StreamingAggTime", "PeakMemoryUsage"});
+        state.ResumeTiming();
+    }
+    harness.report(state, OPERATOR_ROWS);
+}
+BENCHMARK(BM_Operator_StreamingAgg)
+        ->Arg(1 << 10)
+        ->Arg(1 << 16)
+        ->Arg(1 << 20)
+        ->Unit(::benchmark::kMillisecond);
+
+} // namespace doris
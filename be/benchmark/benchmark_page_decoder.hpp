@@ -0,0 +1,148 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "data_generator.h"
+#include "olap/page_cache.h"
+#include "olap/rowset/segment_v2/binary_dict_page.h"
+#include "olap/rowset/segment_v2/binary_plain_page.h"
+#include "olap/rowset/segment_v2/bitshuffle_page.h"
+#include "olap/rowset/segment_v2/bitshuffle_page_pre_decoder.h"
+#include "olap/rowset/segment_v2/frame_of_reference_page.h"
+#include "olap/rowset/segment_v2/options.h"
+#include "olap/rowset/segment_v2/rle_page.h"
+#include "runtime/exec_env.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/columns_number.h"
+
+namespace doris {
+
+// The values of a page, and the rows decoded by a batch like the segment iterator.
+static constexpr size_t PAGE_ROWS = 64 * 1024;
+static constexpr size_t PAGE_DECODE_BATCH_ROWS = 4096;
+
+// An encoded page that is ready to decode, i.e. pre decoded if the encoding needs it.
+struct EncodedPage {
+    OwnedSlice encoded;
+    std::unique_ptr<DataPage> decoded;
+    Slice slice;
+    // the dictionary page of a dict encoded page
+    OwnedSlice dict;
+};
+
+template <typename Builder, typename CppType>
+static EncodedPage encode_page(const std::vector<CppType>& values) {
+    segment_v2::PageBuilderOptions options;
+    options.data_page_size = 16 * 1024 * 1024;
+    options.dict_page_size = 16 * 1024 * 1024;
+    segment_v2::PageBuilder* raw_builder = nullptr;
+    CHECK(Builder::create(&raw_builder, options).ok());
+    std::unique_ptr<segment_v2::PageBuilder> builder(raw_builder);
+    size_t count = values.size();
+    CHECK(builder->add(reinterpret_cast<const uint8_t*>(values.data()), &count).ok());
+    CHECK_EQ(count, values.size());
+    EncodedPage page;
+    page.encoded = builder->finish();
+    page.slice = page.encoded.slice();
+    static_cast<void>(builder->get_dictionary_page(&page.dict));
+    return page;
+}
+
+template <bool USED_IN_DICT_ENCODING>
+static void pre_decode_page(EncodedPage* page) {
+    segment_v2::BitShufflePagePreDecoder<USED_IN_DICT_ENCODING> pre_decoder;
+    CHECK(pre_decoder
+                  .decode(&page->decoded, &page->slice, 0,
+                          ExecEnv::GetInstance()->orphan_mem_tracker())
+                  .ok());
+}
+
+template <typename Decoder>
+static void decode_page(::benchmark::State& state, const EncodedPage& page,
+                        vectorized::MutableColumnPtr column,
+                        segment_v2::PageDecoder* dict_decoder = nullptr,
+                        StringRef* dict_word_info = nullptr) {
+    for (auto _ : state) {
+        Decoder decoder(page.slice, segment_v2::PageDecoderOptions());
+        CHECK(decoder.init().ok());
+        if constexpr (std::is_same_v<Decoder, segment_v2::BinaryDictPageDecoder>) {
+            decoder.set_dict_decoder(dict_decoder, dict_word_info);
+        }
+        for (size_t rows = 0; rows < PAGE_ROWS;) {
+            column->clear();
+            size_t n = PAGE_DECODE_BATCH_ROWS;
+            CHECK(decoder.next_batch(&n, column).ok());
+            rows += n;
+        }
+        ::benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * PAGE_ROWS);
+}
+
+static constexpr auto INT_TYPE = FieldType::OLAP_FIELD_TYPE_INT;
+
+static void BM_PageDecoder_Bitshuffle(::benchmark::State& state) {
+    auto values = DataGenerator().uniform<int32_t>(PAGE_ROWS, 0, 1 << 20);
+    auto page = encode_page<segment_v2::BitshufflePageBuilder<INT_TYPE>>(values);
+    pre_decode_page<false>(&page);
+    decode_page<segment_v2::BitShufflePageDecoder<INT_TYPE>>(state, page,
+                                                              vectorized::ColumnInt32::create());
+}
+BENCHMARK(BM_PageDecoder_Bitshuffle);
+
+static void BM_PageDecoder_Rle(::benchmark::State& state) {
+    auto values = DataGenerator().runs<int32_t>(PAGE_ROWS, 0, 1 << 10, 64);
+    auto page = encode_page<segment_v2::RlePageBuilder<INT_TYPE>>(values);
+    decode_page<segment_v2::RlePageDecoder<INT_TYPE>>(state, page,
+                                                       vectorized::ColumnInt32::create());
+}
+BENCHMARK(BM_PageDecoder_Rle);
+
+static void BM_PageDecoder_FrameOfReference(::benchmark::State& state) {
+    auto values = DataGenerator().ascending<int32_t>(PAGE_ROWS, 0, 16);
+    auto page = encode_page<segment_v2::FrameOfReferencePageBuilder<INT_TYPE>>(values);
+    decode_page<segment_v2::FrameOfReferencePageDecoder<INT_TYPE>>(
+            state, page, vectorized::ColumnInt32::create());
+}
+BENCHMARK(BM_PageDecoder_FrameOfReference);
+
+// Arg 0: the number of distinct strings.
+static void BM_PageDecoder_Dict(::benchmark::State& state) {
+    auto strings = DataGenerator().strings(PAGE_ROWS, 4, 32, state.range(0));
+    std::vector<Slice> values(strings.begin(), strings.end());
+    auto page = encode_page<segment_v2::BinaryDictPageBuilder>(values);
+    pre_decode_page<true>(&page);
+    segment_v2::BinaryPlainPageDecoder<FieldType::OLAP_FIELD_TYPE_VARCHAR> dict_decoder(
+            page.dict.slice(), segment_v2::PageDecoderOptions());
+    CHECK(dict_decoder.init().ok());
+    std::vector<StringRef> dict_word_info(dict_decoder.count());
+    CHECK(dict_decoder.get_dict_word_info(dict_word_info.data()).ok());
+    decode_page<segment_v2::BinaryDictPageDecoder>(state, page,
+                                                    vectorized::ColumnString::create(),
+                                                    &dict_decoder, dict_word_info.data());
+}
+BENCHMARK(BM_PageDecoder_Dict)->Arg(16)->Arg(4096);
+
+} // namespace doris
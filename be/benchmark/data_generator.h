@@ -0,0 +1,124 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace doris {
+
+// Generates the synthetic data of the benchmarks. The data only depends on the seed, so that
+// the results of different builds and machines are compared on the same input.
+class DataGenerator {
+public:
+    static constexpr uint64_t DEFAULT_SEED = 20240601;
+
+    explicit DataGenerator(uint64_t seed = DEFAULT_SEED) : _rng(seed) {}
+
+    // n integers uniformly distributed in [min, max].
+    template <typename T>
+    std::vector<T> uniform(size_t n, T min, T max) {
+        std::uniform_int_distribution<int64_t> dist(min, max);
+        std::vector<T> res(n);
+        for (auto& v : res) {
+            v = static_cast<T>(dist(_rng));
+        }
+        return res;
+    }
+
+    // n integers of runs of the same value, the length of a run is uniformly distributed in
+    // [1, max_run_length].
+    template <typename T>
+    std::vector<T> runs(size_t n, T min, T max, size_t max_run_length) {
+        std::uniform_int_distribution<int64_t> dist(min, max);
+        std::uniform_int_distribution<size_t> run_dist(1, max_run_length);
+        std::vector<T> res;
+        res.reserve(n);
+        while (res.size() < n) {
+            res.insert(res.end(), std::min(run_dist(_rng), n - res.size()),
+                       static_cast<T>(dist(_rng)));
+        }
+        return res;
+    }
+
+    // n ascending integers starting at start, the deltas are uniformly distributed in
+    // [0, max_delta].
+    template <typename T>
+    std::vector<T> ascending(size_t n, T start, T max_delta) {
+        std::uniform_int_distribution<int64_t> dist(0, max_delta);
+        std::vector<T> res(n);
+        T v = start;
+        for (auto& r : res) {
+            r = v;
+            v = static_cast<T>(v + dist(_rng));
+        }
+        return res;
+    }
+
+    // n random alphanumeric strings whose lengths are uniformly distributed in
+    // [min_length, max_length], drawn from `cardinality` distinct strings.
+    std::vector<std::string> strings(size_t n, size_t min_length, size_t max_length,
+                                     size_t cardinality) {
+        static constexpr char CHARS[] =
+                "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+        std::uniform_int_distribution<size_t> length_dist(min_length, max_length);
+        std::uniform_int_distribution<size_t> char_dist(0, sizeof(CHARS) - 2);
+        std::vector<std::string> dict(cardinality);
+        for (auto& s : dict) {
+            s.resize(length_dist(_rng));
+            for (auto& c : s) {
+                c = CHARS[char_dist(_rng)];
+            }
+        }
+        std::uniform_int_distribution<size_t> index_dist(0, cardinality - 1);
+        std::vector<std::string> res(n);
+        for (auto& s : res) {
+            s = dict[index_dist(_rng)];
+        }
+        return res;
+    }
+
+    // n bytes that are 1 with the probability `selectivity`.
+    std::vector<uint8_t> filter(size_t n, double selectivity) {
+        std::bernoulli_distribution dist(selectivity);
+        std::vector<uint8_t> res(n);
+        for (auto& v : res) {
+            v = dist(_rng);
+        }
+        return res;
+    }
+
+    // A random permutation of [0, n).
+    template <typename T>
+    std::vector<T> permutation(size_t n) {
+        std::vector<T> res(n);
+        for (size_t i = 0; i < n; ++i) {
+            res[i] = static_cast<T>(i);
+        }
+        std::shuffle(res.begin(), res.end(), _rng);
+        return res;
+    }
+
+private:
+    std::mt19937_64 _rng;
+};
+
+} // namespace doris
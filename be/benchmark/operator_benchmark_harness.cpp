@@ -0,0 +1,261 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "operator_benchmark_harness.h"
+
+#include <gen_cpp/Types_types.h>
+
+#include <algorithm>
+
+#include "agent/be_exec_version_manager.h"
+#include "pipeline/exec/empty_set_operator.h"
+#include "runtime/exec_env.h"
+#include "runtime/query_context.h"
+#include "runtime/types.h"
+#include "util/runtime_profile.h"
+
+namespace doris {
+
+namespace {
+
+// The operators of all the benchmarks run in one query, which is never destroyed as its
+// destructor releases the query in the backend managers.
+QueryContext* benchmark_query_ctx(const TQueryOptions& query_options) {
+    static QueryContext* query_ctx =
+            QueryContext::create_unique(TUniqueId(), ExecEnv::GetInstance(), query_options,
+                                        TNetworkAddress(), false, true)
+                    .release();
+    return query_ctx;
+}
+
+TypeDescriptor type_of(PrimitiveType type) {
+    return type == TYPE_STRING ? TypeDescriptor::create_string_type() : TypeDescriptor(type);
+}
+
+} // namespace
+
+OperatorBenchmarkHarness::OperatorBenchmarkHarness() = default;
+
+OperatorBenchmarkHarness::~OperatorBenchmarkHarness() = default;
+
+TTupleId OperatorBenchmarkHarness::declare_tuple(const std::vector<PrimitiveType>& types) {
+    DCHECK(_desc_tbl == nullptr);
+    auto tuple_id = static_cast<TTupleId>(_tuple_slots.size());
+    TTupleDescriptor tuple_desc;
+    tuple_desc.__set_id(tuple_id);
+    tuple_desc.__set_byteSize(0);
+    tuple_desc.__set_numNullBytes(0);
+    _tdesc_tbl.tupleDescriptors.push_back(tuple_desc);
+
+    auto& slots = _tuple_slots.emplace_back();
+    for (int i = 0; i < types.size(); ++i) {
+        TSlotDescriptor slot_desc;
+        slot_desc.__set_id(static_cast<TSlotId>(_tdesc_tbl.slotDescriptors.size()));
+        slot_desc.__set_parent(tuple_id);
+        slot_desc.__set_slotType(type_of(types[i]).to_thrift());
+        slot_desc.__set_columnPos(i);
+        slot_desc.__set_byteOffset(0);
+        slot_desc.__set_nullIndicatorByte(0);
+        // not nullable
+        slot_desc.__set_nullIndicatorBit(-1);
+        slot_desc.__set_colName(fmt::format("t{}_c{}", tuple_id, i));
+        slot_desc.__set_slotIdx(i);
+        slot_desc.__set_isMaterialized(true);
+        slot_desc.__set_need_materialize(true);
+        _tdesc_tbl.slotDescriptors.push_back(slot_desc);
+        _tdesc_tbl.__isset.slotDescriptors = true;
+        slots.push_back(slot_desc);
+    }
+    return tuple_id;
+}
+
+Status OperatorBenchmarkHarness::prepare(int batch_size) {
+    RETURN_IF_ERROR(DescriptorTbl::create(&_pool, _tdesc_tbl, &_desc_tbl));
+    _query_options.__set_query_type(TQueryType::EXTERNAL);
+    _query_options.__set_batch_size(batch_size);
+    _query_options.__set_be_exec_version(BeExecVersionManager::get_newest_version());
+    _state = create_task_state();
+    return Status::OK();
+}
+
+std::unique_ptr<RuntimeState> OperatorBenchmarkHarness::create_task_state() const {
+    auto state = std::make_unique<RuntimeState>(TUniqueId(), 0, _query_options, _query_globals,
+                                                ExecEnv::GetInstance(),
+                                                benchmark_query_ctx(_query_options));
+    state->set_desc_tbl(_desc_tbl);
+    state->resize_op_id_to_local_state(_operator_id);
+    return state;
+}
+
+TPlanNode OperatorBenchmarkHarness::plan_node(TPlanNodeType::type type,
+                                              const std::vector<TTupleId>& row_tuples) {
+    TPlanNode tnode;
+    tnode.__set_node_id(_node_id++);
+    tnode.__set_node_type(type);
+    tnode.__set_num_children(1);
+    tnode.__set_limit(-1);
+    tnode.__set_row_tuples(row_tuples);
+    tnode.__set_nullable_tuples(std::vector<bool>(row_tuples.size(), false));
+    return tnode;
+}
+
+TExpr OperatorBenchmarkHarness::slot_ref(TTupleId tuple_id, int slot_idx) const {
+    const auto& slot_desc = _tuple_slots[tuple_id][slot_idx];
+    TExprNode node;
+    node.__set_node_type(TExprNodeType::SLOT_REF);
+    node.__set_type(slot_desc.slotType);
+    node.__set_num_children(0);
+    node.__set_is_nullable(false);
+    TSlotRef slot_ref;
+    slot_ref.__set_slot_id(slot_desc.id);
+    slot_ref.__set_tuple_id(tuple_id);
+    node.__set_slot_ref(slot_ref);
+    node.__set_output_column(slot_idx);
+    node.__set_label(slot_desc.colName);
+    TExpr expr;
+    expr.nodes.push_back(node);
+    return expr;
+}
+
+TExpr OperatorBenchmarkHarness::agg_fn(const std::string& name, PrimitiveType ret_type,
+                                       TTupleId tuple_id, int slot_idx) const {
+    TExpr arg = slot_ref(tuple_id, slot_idx);
+    const auto& arg_type = arg.nodes[0].type;
+
+    TFunction fn;
+    TFunctionName fn_name;
+    fn_name.__set_function_name(name);
+    fn.__set_name(fn_name);
+    fn.__set_binary_type(TFunctionBinaryType::BUILTIN);
+    fn.__set_arg_types({arg_type});
+    fn.__set_ret_type(type_of(ret_type).to_thrift());
+    fn.__set_has_var_args(false);
+
+    TAggregateExpr agg_expr;
+    agg_expr.__set_is_merge_agg(false);
+    agg_expr.__set_param_types({arg_type});
+
+    TExprNode node;
+    node.__set_node_type(TExprNodeType::AGG_EXPR);
+    node.__set_type(fn.ret_type);
+    node.__set_num_children(1);
+    node.__set_is_nullable(false);
+    node.__set_fn(fn);
+    node.__set_agg_expr(agg_expr);
+
+    TExpr expr;
+    expr.nodes.push_back(node);
+    expr.nodes.push_back(arg.nodes[0]);
+    return expr;
+}
+
+pipeline::OperatorXPtr OperatorBenchmarkHarness::child_of(TTupleId tuple_id) {
+    TPlanNode tnode = plan_node(TPlanNodeType::EMPTY_SET_NODE, {tuple_id});
+    tnode.__set_num_children(0);
+    return std::make_shared<pipeline::EmptySetSourceOperatorX>(&_pool, tnode, next_operator_id(),
+                                                               *_desc_tbl);
+}
+
+std::vector<vectorized::Block> OperatorBenchmarkHarness::make_blocks(
+        TTupleId tuple_id, const vectorized::Columns& columns) const {
+    const auto& slots = _desc_tbl->get_tuple_descriptor(tuple_id)->slots();
+    DCHECK_EQ(slots.size(), columns.size());
+    const size_t num_rows = columns.empty() ? 0 : columns[0]->size();
+    const size_t batch_size = _state->batch_size();
+    std::vector<vectorized::Block> blocks;
+    for (size_t offset = 0; offset < num_rows; offset += batch_size) {
+        size_t length = std::min(batch_size, num_rows - offset);
+        auto& block = blocks.emplace_back();
+        for (size_t i = 0; i < slots.size(); ++i) {
+            block.insert({columns[i]->cut(offset, length), slots[i]->get_data_type_ptr(),
+                          slots[i]->col_name()});
+        }
+    }
+    return blocks;
+}
+
+std::vector<vectorized::Block> OperatorBenchmarkHarness::copy_blocks(
+        const std::vector<vectorized::Block>& blocks) {
+    std::vector<vectorized::Block> res(blocks.size());
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        for (const auto& column : blocks[i]) {
+            res[i].insert({column.column->clone_resized(column.column->size()), column.type,
+                           column.name});
+        }
+    }
+    return res;
+}
+
+Status OperatorBenchmarkHarness::_setup_local_state(RuntimeState* task_state,
+                                                    pipeline::OperatorXBase* op,
+                                                    pipeline::BasicSharedState* shared_state) {
+    pipeline::LocalStateInfo info {task_state->runtime_profile(), _scan_ranges, shared_state,
+                                   _le_state_map, 0};
+    RETURN_IF_ERROR(op->setup_local_state(task_state, info));
+    return task_state->get_local_state(op->operator_id())->open(task_state);
+}
+
+Status OperatorBenchmarkHarness::sink(RuntimeState* task_state,
+                                      pipeline::DataSinkOperatorXBase* sink,
+                                      pipeline::BasicSharedState* shared_state,
+                                      std::vector<vectorized::Block>* blocks) {
+    pipeline::LocalSinkStateInfo info {
+            0, task_state->runtime_profile(), 0, shared_state, _le_state_map, _tsink};
+    RETURN_IF_ERROR(sink->setup_local_state(task_state, info));
+    RETURN_IF_ERROR(task_state->get_sink_local_state()->open(task_state));
+    for (size_t i = 0; i < blocks->size(); ++i) {
+        RETURN_IF_ERROR(sink->sink(task_state, &(*blocks)[i], i + 1 == blocks->size()));
+    }
+    return task_state->get_sink_local_state()->close(task_state, Status::OK());
+}
+
+Status OperatorBenchmarkHarness::drain(RuntimeState* task_state, pipeline::OperatorXBase* source,
+                                       pipeline::BasicSharedState* shared_state,
+                                       size_t* num_rows) {
+    RETURN_IF_ERROR(_setup_local_state(task_state, source, shared_state));
+    bool eos = false;
+    while (!eos) {
+        vectorized::Block block;
+        RETURN_IF_ERROR(source->get_block(task_state, &block, &eos));
+        *num_rows += block.rows();
+    }
+    return task_state->get_local_state(source->operator_id())->close(task_state);
+}
+
+void OperatorBenchmarkHarness::collect_counters(RuntimeState* task_state,
+                                                const std::vector<std::string>& names) {
+    std::vector<RuntimeProfile*> profiles;
+    task_state->runtime_profile()->get_all_children(&profiles);
+    for (const auto& name : names) {
+        for (auto* profile : profiles) {
+            if (auto* counter = profile->get_counter(name)) {
+                _counters[name] += counter->value();
+            }
+        }
+    }
+}
+
+void OperatorBenchmarkHarness::report(::benchmark::State& state,
+                                      int64_t rows_per_iteration) const {
+    state.SetItemsProcessed(state.iterations() * rows_per_iteration);
+    for (const auto& [name, value] : _counters) {
+        state.counters[name] = ::benchmark::Counter(static_cast<double>(value),
+                                                    ::benchmark::Counter::kAvgIterations);
+    }
+}
+
+} // namespace doris
@@ -0,0 +1,156 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <gen_cpp/DataSinks_types.h>
+#include <gen_cpp/Descriptors_types.h>
+#include <gen_cpp/Exprs_types.h>
+#include <gen_cpp/PaloInternalService_types.h>
+#include <gen_cpp/PlanNodes_types.h>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/object_pool.h"
+#include "common/status.h"
+#include "pipeline/exec/operator.h"
+#include "runtime/define_primitive_type.h"
+#include "runtime/descriptors.h"
+#include "runtime/runtime_state.h"
+#include "vec/core/block.h"
+
+namespace doris {
+
+// Skips the benchmark on an error of the harness or the operator.
+#define RETURN_IF_BENCHMARK_ERROR(state, stmt)                   \
+    do {                                                         \
+        Status _status_ = (stmt);                                \
+        if (UNLIKELY(!_status_.ok())) {                          \
+            (state).SkipWithError(_status_.to_string().c_str()); \
+            return;                                              \
+        }                                                        \
+    } while (false)
+
+// Runs single pipeline operators on synthetic blocks, without a plan from the FE. The operators
+// are made of hand written plan nodes over the tuples declared in the harness, and their local
+// states are set up and driven by the harness the way a PipelineTask does, one RuntimeState per
+// task. The benchmarks report the rows per second and the profile counters of the operators.
+class OperatorBenchmarkHarness {
+public:
+    OperatorBenchmarkHarness();
+    ~OperatorBenchmarkHarness();
+
+    // Declares a tuple of non nullable slots of the types and returns its id. All the tuples are
+    // declared before prepare().
+    TTupleId declare_tuple(const std::vector<PrimitiveType>& types);
+
+    // Creates the descriptor table and the runtime state the operators are prepared in.
+    Status prepare(int batch_size);
+
+    RuntimeState* state() { return _state.get(); }
+    const DescriptorTbl& descs() const { return *_desc_tbl; }
+    ObjectPool* pool() { return &_pool; }
+    int next_operator_id() { return _operator_id--; }
+
+    // Initializes, prepares and opens the operator or sink of the plan node in state(), after
+    // its children are set.
+    template <typename OperatorType>
+    Status open_operator(OperatorType* op, const TPlanNode& tnode) {
+        RETURN_IF_ERROR(op->init(tnode, _state.get()));
+        RETURN_IF_ERROR(op->prepare(_state.get()));
+        return op->open(_state.get());
+    }
+
+    TPlanNode plan_node(TPlanNodeType::type type, const std::vector<TTupleId>& row_tuples);
+    TExpr slot_ref(TTupleId tuple_id, int slot_idx) const;
+    // The first phase aggregate function `name` over the slot.
+    TExpr agg_fn(const std::string& name, PrimitiveType ret_type, TTupleId tuple_id,
+                 int slot_idx) const;
+
+    // An empty set source over the tuple. The operators only take their row descriptor from
+    // it, their input blocks are fed by the harness.
+    pipeline::OperatorXPtr child_of(TTupleId tuple_id);
+
+    // Cuts the columns of the slots of the tuple into blocks of the batch size.
+    std::vector<vectorized::Block> make_blocks(TTupleId tuple_id,
+                                               const vectorized::Columns& columns) const;
+    // Deep copies of the blocks, for the operators which take over their input.
+    static std::vector<vectorized::Block> copy_blocks(const std::vector<vectorized::Block>& blocks);
+
+    // The state of one pipeline task, created after all the operators.
+    std::unique_ptr<RuntimeState> create_task_state() const;
+
+    // Sinks the blocks into the sink in the task state, the last one with eos.
+    Status sink(RuntimeState* task_state, pipeline::DataSinkOperatorXBase* sink,
+                pipeline::BasicSharedState* shared_state, std::vector<vectorized::Block>* blocks);
+
+    // Gets the blocks of the source in the task state until eos.
+    Status drain(RuntimeState* task_state, pipeline::OperatorXBase* source,
+                 pipeline::BasicSharedState* shared_state, size_t* num_rows);
+
+    // Pushes the blocks into the operator in the task state, the last one with eos, and pulls
+    // its output whenever it does not need more input.
+    template <typename LocalStateType>
+    Status push_pull(RuntimeState* task_state, pipeline::StatefulOperatorX<LocalStateType>* op,
+                     pipeline::BasicSharedState* shared_state,
+                     std::vector<vectorized::Block>* blocks, size_t* num_rows) {
+        RETURN_IF_ERROR(_setup_local_state(task_state, op, shared_state));
+        for (size_t i = 0; i < blocks->size(); ++i) {
+            RETURN_IF_ERROR(op->push(task_state, &(*blocks)[i], i + 1 == blocks->size()));
+            bool eos = false;
+            while (!eos && !op->need_more_input_data(task_state)) {
+                vectorized::Block block;
+                RETURN_IF_ERROR(op->pull(task_state, &block, &eos));
+                *num_rows += block.rows();
+            }
+        }
+        return task_state->get_local_state(op->operator_id())->close(task_state);
+    }
+
+    // Accumulates the counters of the profiles of the task state, to be reported as the
+    // averages of the iterations.
+    void collect_counters(RuntimeState* task_state, const std::vector<std::string>& names);
+    void report(::benchmark::State& state, int64_t rows_per_iteration) const;
+
+private:
+    Status _setup_local_state(RuntimeState* task_state, pipeline::OperatorXBase* op,
+                              pipeline::BasicSharedState* shared_state);
+
+    ObjectPool _pool;
+    TDescriptorTable _tdesc_tbl;
+    std::vector<std::vector<TSlotDescriptor>> _tuple_slots;
+    DescriptorTbl* _desc_tbl = nullptr;
+    TQueryOptions _query_options;
+    TQueryGlobals _query_globals;
+    std::unique_ptr<RuntimeState> _state;
+    int _operator_id = 0;
+    int _node_id = 0;
+
+    const std::vector<TScanRangeParams> _scan_ranges;
+    const std::map<int, std::pair<std::shared_ptr<pipeline::LocalExchangeSharedState>,
+                                  std::shared_ptr<pipeline::Dependency>>>
+            _le_state_map;
+    const TDataSink _tsink;
+
+    std::map<std::string, int64_t> _counters;
+};
+
+} // namespace doris
@@ -501,6 +501,30 @@ bvar::Adder<uint64_t> report_disk_failed("report", "disk_failed");
 bvar::Adder<uint64_t> report_tablet_total("report", "tablet_total");
 bvar::Adder<uint64_t> report_tablet_failed("report", "tablet_failed");
 
+// The schemas are shared through the TabletSchemaCache by the tablets and the rowsets of the same
+// schema, so a property is changed on copies of the schemas of the tablet, which replace them.
+void update_tablet_schema_property(const TabletSharedPtr& tablet,
+                                   const std::function<void(TabletSchema*)>& update) {
+    std::lock_guard wlock(tablet->get_header_lock());
+    std::unordered_map<const TabletSchema*, TabletSchemaSPtr> copies;
+    auto copy_of = [&](const TabletSchemaSPtr& schema) {
+        auto& copy = copies[schema.get()];
+        if (copy == nullptr) {
+            copy = std::make_shared<TabletSchema>();
+            copy->copy_from(*schema);
+            update(copy.get());
+        }
+        return copy;
+    };
+    tablet->tablet_meta()->set_tablet_schema(copy_of(tablet->tablet_meta()->tablet_schema()));
+    for (auto& rowset_meta : tablet->tablet_meta()->all_mutable_rs_metas()) {
+        if (rowset_meta->tablet_schema() != nullptr) {
+            rowset_meta->set_tablet_schema(copy_of(rowset_meta->tablet_schema()));
+        }
+    }
+    tablet->set_tablet_schema_unlocked(copy_of(tablet->tablet_schema_unlocked()));
+}
+
 } // namespace
 
 TaskWorkerPool::TaskWorkerPool(std::string_view name, int worker_count,
@@ -801,13 +825,9 @@ void update_tablet_meta_callback(StorageEngine& engine, const TAgentTaskRequest&
             need_to_save = true;
         }
         if (tablet_meta_info.__isset.is_in_memory) {
-            tablet->tablet_meta()->mutable_tablet_schema()->set_is_in_memory(
-                    tablet_meta_info.is_in_memory);
-            std::shared_lock rlock(tablet->get_header_lock());
-            for (auto& rowset_meta : tablet->tablet_meta()->all_mutable_rs_metas()) {
-                rowset_meta->tablet_schema()->set_is_in_memory(tablet_meta_info.is_in_memory);
-            }
-            tablet->tablet_schema_unlocked()->set_is_in_memory(tablet_meta_info.is_in_memory);
+            update_tablet_schema_property(tablet, [&](TabletSchema* schema) {
+                schema->set_is_in_memory(tablet_meta_info.is_in_memory);
+            });
             need_to_save = true;
         }
         if (tablet_meta_info.__isset.compaction_policy) {
@@ -899,40 +919,23 @@ void update_tablet_meta_callback(StorageEngine& engine, const TAgentTaskRequest&
             need_to_save = true;
         }
         if (tablet_meta_info.__isset.enable_single_replica_compaction) {
-            std::shared_lock rlock(tablet->get_header_lock());
-            tablet->tablet_meta()->mutable_tablet_schema()->set_enable_single_replica_compaction(
-                    tablet_meta_info.enable_single_replica_compaction);
-            for (auto& rowset_meta : tablet->tablet_meta()->all_mutable_rs_metas()) {
-                rowset_meta->tablet_schema()->set_enable_single_replica_compaction(
+            update_tablet_schema_property(tablet, [&](TabletSchema* schema) {
+                schema->set_enable_single_replica_compaction(
                         tablet_meta_info.enable_single_replica_compaction);
-            }
-            tablet->tablet_schema_unlocked()->set_enable_single_replica_compaction(
-                    tablet_meta_info.enable_single_replica_compaction);
+            });
             need_to_save = true;
         }
         if (tablet_meta_info.__isset.disable_auto_compaction) {
-            std::shared_lock rlock(tablet->get_header_lock());
-            tablet->tablet_meta()->mutable_tablet_schema()->set_disable_auto_compaction(
-                    tablet_meta_info.disable_auto_compaction);
-            for (auto& rowset_meta : tablet->tablet_meta()->all_mutable_rs_metas()) {
-                rowset_meta->tablet_schema()->set_disable_auto_compaction(
-                        tablet_meta_info.disable_auto_compaction);
-            }
-            tablet->tablet_schema_unlocked()->set_disable_auto_compaction(
-                    tablet_meta_info.disable_auto_compaction);
+            update_tablet_schema_property(tablet, [&](TabletSchema* schema) {
+                schema->set_disable_auto_compaction(tablet_meta_info.disable_auto_compaction);
+            });
             need_to_save = true;
         }
 
         if (tablet_meta_info.__isset.skip_write_index_on_load) {
-            std::shared_lock rlock(tablet->get_header_lock());
-            tablet->tablet_meta()->mutable_tablet_schema()->set_skip_write_index_on_load(
-                    tablet_meta_info.skip_write_index_on_load);
-            for (auto& rowset_meta : tablet->tablet_meta()->all_mutable_rs_metas()) {
-                rowset_meta->tablet_schema()->set_skip_write_index_on_load(
-                        tablet_meta_info.skip_write_index_on_load);
-            }
-            tablet->tablet_schema_unlocked()->set_skip_write_index_on_load(
-                    tablet_meta_info.skip_write_index_on_load);
+            update_tablet_schema_property(tablet, [&](TabletSchema* schema) {
+                schema->set_skip_write_index_on_load(tablet_meta_info.skip_write_index_on_load);
+            });
             need_to_save = true;
         }
         if (need_to_save) {
@@ -127,6 +127,8 @@ constexpr int kBrpcRetryTimes = 3;
 
 bvar::LatencyRecorder _get_rowset_latency("doris_CloudMetaMgr", "get_rowset");
 bvar::LatencyRecorder g_cloud_commit_txn_resp_redirect_latency("cloud_table_stats_report_latency");
+bvar::Adder<uint64_t> g_synced_delete_bitmap_optimized_bytes(
+        "doris_CloudMetaMgr", "synced_delete_bitmap_optimized_bytes");
 
 class MetaServiceProxy {
 public:
@@ -634,6 +636,7 @@ Status CloudMetaMgr::sync_tablet_delete_bitmap(CloudTablet* tablet, int64_t old_
         delete_bitmap->merge({rst_id, segment_ids[i], vers[i]},
                              roaring::Roaring::read(delete_bitmaps[i].data()));
     }
+    g_synced_delete_bitmap_optimized_bytes << delete_bitmap->optimize();
     return Status::OK();
 }
 
@@ -240,6 +240,12 @@ Status CloudStorageEngine::start_bg_threads() {
             [this]() { this->_sync_tablets_thread_callback(); }, &_bg_threads.emplace_back()));
     LOG(INFO) << "sync tablets thread started";
 
+    RETURN_IF_ERROR(Thread::create(
+            "CloudStorageEngine", "warm_up_hot_tablets_thread",
+            [this]() { this->_warm_up_hot_tablets_thread_callback(); },
+            &_bg_threads.emplace_back()));
+    LOG(INFO) << "warm up hot tablets thread started";
+
     RETURN_IF_ERROR(Thread::create(
             "CloudStorageEngine", "evict_querying_rowset_thread",
             [this]() { this->_evict_quring_rowset_thread_callback(); },
@@ -363,6 +369,42 @@ void CloudStorageEngine::_sync_tablets_thread_callback() {
     }
 }
 
+// Sync the rowsets of the hottest tablets in background, so the rowsets newly loaded or compacted
+// are downloaded into the file cache by the sync before the first query of them, instead of by
+// the sync of that query.
+void CloudStorageEngine::_warm_up_hot_tablets_thread_callback() {
+    constexpr int32_t DISABLED_CHECK_INTERVAL_S = 60;
+    std::vector<int64_t> tablet_ids;
+    while (true) {
+        int32_t interval_s = config::warm_up_hot_tablets_interval_s;
+        if (interval_s <= 0) {
+            interval_s = DISABLED_CHECK_INTERVAL_S;
+        }
+        if (_stop_background_threads_latch.wait_for(std::chrono::seconds(interval_s))) {
+            break;
+        }
+        if (config::warm_up_hot_tablets_interval_s <= 0) {
+            continue;
+        }
+        _tablet_hotspot->get_top_n_hot_tablets(config::warm_up_hot_tablets_num, &tablet_ids);
+        for (int64_t tablet_id : tablet_ids) {
+            if (_stop_background_threads_latch.count() <= 0) {
+                break;
+            }
+            auto res = _tablet_mgr->get_tablet(tablet_id);
+            if (!res.has_value()) {
+                continue;
+            }
+            // the compacted rowsets replacing the overlapped ones and the rowsets written in the
+            // last minutes are downloaded
+            auto st = res.value()->sync_rowsets(-1, true);
+            if (!st) {
+                LOG_WARNING("failed to warm up hot tablet {}", tablet_id).error(st);
+            }
+        }
+    }
+}
+
 void CloudStorageEngine::get_cumu_compaction(
         int64_t tablet_id, std::vector<std::shared_ptr<CloudCumulativeCompaction>>& res) {
     std::lock_guard lock(_compaction_mtx);
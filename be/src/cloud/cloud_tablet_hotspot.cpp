@@ -17,8 +17,11 @@
 
 #include "cloud/cloud_tablet_hotspot.h"
 
+#include <algorithm>
 #include <chrono>
+#include <functional>
 #include <mutex>
+#include <tuple>
 
 #include "cloud/config.h"
 #include "olap/tablet_fwd.h"
@@ -137,6 +140,26 @@ void TabletHotspot::get_top_n_hot_partition(std::vector<THotTableMessage>* hot_t
     get_return_partitions(week_hot_partitions);
 }
 
+void TabletHotspot::get_top_n_hot_tablets(size_t n, std::vector<int64_t>* tablet_ids) {
+    // tuple<qpd, qpw, tablet_id>
+    std::vector<std::tuple<uint64_t, uint64_t, int64_t>> hot_tablets;
+    std::for_each(_tablets_hotspot.begin(), _tablets_hotspot.end(), [&](HotspotMap& map) {
+        std::lock_guard lock(map.mtx);
+        for (auto& [tablet_id, counter] : map.map) {
+            if (uint64_t qpd = counter->qpd(); qpd != 0) {
+                hot_tablets.emplace_back(qpd, counter->qpw(), tablet_id);
+            }
+        }
+    });
+    n = std::min(n, hot_tablets.size());
+    std::partial_sort(hot_tablets.begin(), hot_tablets.begin() + n, hot_tablets.end(),
+                      std::greater<>());
+    tablet_ids->clear();
+    for (size_t i = 0; i < n; ++i) {
+        tablet_ids->push_back(std::get<2>(hot_tablets[i]));
+    }
+}
+
 void HotspotCounter::make_dot_point() {
     uint64_t value = cur_counter.load();
     cur_counter = 0;
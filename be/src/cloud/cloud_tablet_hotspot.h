@@ -57,6 +57,8 @@ public:
     // When query the tablet, count it
     void count(const BaseTablet& tablet);
     void get_top_n_hot_partition(std::vector<THotTableMessage>* hot_tables);
+    // The ids of the at most n tablets queried the most in the last day, the hottest first
+    void get_top_n_hot_tablets(size_t n, std::vector<int64_t>* tablet_ids);
 
 private:
     void make_dot_point();
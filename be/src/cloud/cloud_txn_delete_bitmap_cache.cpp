@@ -17,6 +17,7 @@
 
 #include "cloud/cloud_txn_delete_bitmap_cache.h"
 
+#include <bvar/bvar.h>
 #include <fmt/core.h>
 
 #include <chrono>
@@ -30,6 +31,9 @@
 
 namespace doris {
 
+bvar::Adder<uint64_t> g_txn_delete_bitmap_optimized_bytes("txn_delete_bitmap_cache",
+                                                          "optimized_bytes");
+
 CloudTxnDeleteBitmapCache::CloudTxnDeleteBitmapCache(size_t size_in_bytes)
         : LRUCachePolicy(CachePolicy::CacheType::CLOUD_TXN_DELETE_BITMAP_CACHE, size_in_bytes,
                          LRUCacheType::SIZE, 86400, 4),
@@ -109,6 +113,7 @@ void CloudTxnDeleteBitmapCache::set_tablet_txn_info(
     std::string key_str = fmt::format("{}/{}", transaction_id, tablet_id);
     CacheKey key(key_str);
 
+    g_txn_delete_bitmap_optimized_bytes << delete_bitmap->optimize();
     auto val = new DeleteBitmapCacheValue(delete_bitmap, rowset_ids);
     size_t charge = sizeof(DeleteBitmapCacheValue);
     for (auto& [k, v] : val->delete_bitmap->delete_bitmap) {
@@ -132,6 +137,7 @@ void CloudTxnDeleteBitmapCache::update_tablet_txn_info(TTransactionId transactio
     std::string key_str = fmt::format("{}/{}", transaction_id, tablet_id);
     CacheKey key(key_str);
 
+    g_txn_delete_bitmap_optimized_bytes << delete_bitmap->optimize();
     auto val = new DeleteBitmapCacheValue(delete_bitmap, rowset_ids);
     size_t charge = sizeof(DeleteBitmapCacheValue);
     for (auto& [k, v] : val->delete_bitmap->delete_bitmap) {
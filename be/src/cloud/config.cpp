@@ -33,6 +33,7 @@ DEFINE_mInt32(meta_service_brpc_timeout_ms, "10000");
 DEFINE_Int64(tablet_cache_capacity, "100000");
 DEFINE_Int64(tablet_cache_shards, "16");
 DEFINE_mInt32(tablet_sync_interval_s, "1800");
+DEFINE_mInt32(scan_sync_rowsets_concurrency, "10");
 
 DEFINE_mInt64(min_compaction_failure_interval_ms, "5000");
 DEFINE_mInt64(base_compaction_freeze_interval_s, "86400");
@@ -52,6 +53,8 @@ DEFINE_mBool(prioritize_query_perf_in_compaction, "false");
 DEFINE_mInt32(refresh_s3_info_interval_s, "60");
 DEFINE_mInt32(vacuum_stale_rowsets_interval_s, "300");
 DEFINE_mInt32(schedule_sync_tablets_interval_s, "600");
+DEFINE_mInt32(warm_up_hot_tablets_interval_s, "60");
+DEFINE_mInt32(warm_up_hot_tablets_num, "100");
 
 DEFINE_mInt32(mow_stream_load_commit_retry_times, "10");
 
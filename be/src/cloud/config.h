@@ -62,6 +62,8 @@ DECLARE_mInt32(meta_service_brpc_timeout_ms);
 DECLARE_Int64(tablet_cache_capacity);
 DECLARE_Int64(tablet_cache_shards);
 DECLARE_mInt32(tablet_sync_interval_s);
+// The max number of the tablets got and synced at the same time for the scan of a query
+DECLARE_mInt32(scan_sync_rowsets_concurrency);
 
 // Cloud compaction config
 DECLARE_mInt64(min_compaction_failure_interval_ms);
@@ -84,6 +86,11 @@ DECLARE_mBool(prioritize_query_perf_in_compaction);
 DECLARE_mInt32(refresh_s3_info_interval_s);
 DECLARE_mInt32(vacuum_stale_rowsets_interval_s);
 DECLARE_mInt32(schedule_sync_tablets_interval_s);
+// The interval to sync the rowsets of the hottest tablets and download the new ones into the file
+// cache before they are queried, 0 means disabled
+DECLARE_mInt32(warm_up_hot_tablets_interval_s);
+// The max number of the hottest tablets synced in a round
+DECLARE_mInt32(warm_up_hot_tablets_num);
 
 // Cloud mow
 DECLARE_mInt32(mow_stream_load_commit_retry_times);
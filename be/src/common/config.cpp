@@ -108,6 +108,11 @@ DEFINE_Double(schema_change_mem_limit_frac, "0.6");
 // memory greater than 16 GB.
 DEFINE_mInt64(mmap_threshold, "134217728"); // bytes
 
+// Advise the kernel to back the allocations of at least 2MB like the large hash tables and
+// arrays by transparent huge pages, to reduce the TLB misses of their random accesses.
+// Only takes effect if THP is "madvise" or "always" in /sys/kernel/mm/transparent_hugepage.
+DEFINE_mBool(enable_huge_page_for_large_allocation, "false");
+
 // When hash table capacity is greater than 2^double_grow_degree(default 2G), grow when 75% of the capacity is satisfied.
 // Increase can reduce the number of hash table resize, but may waste more memory.
 DEFINE_mInt32(hash_table_double_grow_degree, "31");
@@ -133,6 +138,11 @@ DEFINE_mString(process_full_gc_size, "20%");
 // If false, cancel query when the memory used exceeds exec_mem_limit, same as before.
 DEFINE_mBool(enable_query_memory_overcommit, "true");
 
+// If true, when the process memory exceeds the soft mem limit, the memory GC asks the queries
+// with the most revocable memory (hash join build, aggregation, sort) to spill before canceling
+// the queries, only works for the queries that enable spill.
+DEFINE_mBool(enable_spill_memory_arbitration, "true");
+
 DEFINE_mBool(disable_memory_gc, "false");
 
 DEFINE_mInt64(large_memory_check_bytes, "2147483648");
@@ -168,6 +178,8 @@ DEFINE_Int32(calc_delete_bitmap_max_thread, "32");
 DEFINE_Int32(calc_delete_bitmap_worker_count, "8");
 // the count of thread to calc tablet delete bitmap task, only used for cloud
 DEFINE_Int32(calc_tablet_delete_bitmap_task_max_thread, "32");
+// the max rows of a task to calc the delete bitmap of a large segment
+DEFINE_mInt32(calc_delete_bitmap_rows_per_task, "262144");
 // the count of thread to clear transaction task
 DEFINE_Int32(clear_transaction_task_worker_count, "1");
 // the count of thread to delete
@@ -186,6 +198,8 @@ DEFINE_Int32(check_consistency_worker_count, "1");
 DEFINE_Int32(upload_worker_count, "1");
 // the count of thread to download
 DEFINE_Int32(download_worker_count, "1");
+// the count of thread to transfer the tablet snapshots of an upload or a download task
+DEFINE_mInt32(snapshot_loader_transfer_concurrency, "4");
 // the count of thread to make snapshot
 DEFINE_Int32(make_snapshot_worker_count, "5");
 // the count of thread to release snapshot
@@ -207,6 +221,8 @@ DEFINE_mInt32(max_download_speed_kbps, "50000");
 DEFINE_mInt32(download_low_speed_limit_kbps, "50");
 // download low speed time(seconds)
 DEFINE_mInt32(download_low_speed_time, "300");
+// the max number of files downloaded concurrently by a clone task
+DEFINE_mInt32(clone_download_file_concurrency, "4");
 
 DEFINE_String(sys_log_dir, "");
 DEFINE_String(user_function_dir, "${DORIS_HOME}/lib/udf");
@@ -247,9 +263,14 @@ DEFINE_Validator(doris_scanner_thread_pool_thread_num, [](const int config) -> b
     return true;
 });
 DEFINE_Int32(remote_split_source_batch_size, "1024");
+// Hand out the splits of a file scan from the largest to the smallest
+DEFINE_mBool(enable_split_source_order_by_size, "true");
 DEFINE_Int32(doris_max_remote_scanner_thread_pool_thread_num, "-1");
 // number of olap scanner thread pool queue size
 DEFINE_Int32(doris_scanner_thread_pool_queue_size, "102400");
+// Park the running scanners of a scan whose consumer can not keep up with them, so that
+// their threads serve other queries until the consumer waits for blocks again
+DEFINE_mBool(enable_scanner_scale_down, "true");
 // default thrift client connect timeout(in seconds)
 DEFINE_mInt32(thrift_connect_timeout_seconds, "3");
 DEFINE_mInt32(fetch_rpc_timeout_seconds, "30");
@@ -276,15 +297,25 @@ DEFINE_mInt32(max_pushdown_conditions_per_column, "1024");
 // (Advanced) Maximum size of per-query receive-side buffer
 DEFINE_mInt32(exchg_node_buffer_size_bytes, "20485760");
 DEFINE_mInt32(exchg_buffer_queue_capacity_factor, "64");
+DEFINE_Int32(exchange_deserialize_thread_num, "0");
+DEFINE_Int32(mysql_result_serialize_thread_num, "0");
+DEFINE_mInt32(mysql_result_serialize_batch_rows, "4096");
 
 DEFINE_mInt64(column_dictionary_key_ratio_threshold, "0");
 DEFINE_mInt64(column_dictionary_key_size_threshold, "0");
 // memory_limitation_per_thread_for_schema_change_bytes unit bytes
 DEFINE_mInt64(memory_limitation_per_thread_for_schema_change_bytes, "2147483648");
+DEFINE_mInt32(schema_change_rowset_parallelism, "1");
 DEFINE_mInt64(memory_limitation_per_thread_for_storage_migration_bytes, "100000000");
 
 DEFINE_mInt32(cache_prune_interval_sec, "10");
 DEFINE_mInt32(cache_periodic_prune_stale_sweep_sec, "300");
+// Whether to move the capacity among the page, segment and inverted index caches by their
+// misses at every periodic prune stale, the total capacity stays the configured one.
+DEFINE_mBool(enable_cache_capacity_rebalance, "false");
+// The capacity of a rebalanced cache stays within these ratios of its configured capacity.
+DEFINE_mDouble(cache_capacity_rebalance_min_ratio, "0.5");
+DEFINE_mDouble(cache_capacity_rebalance_max_ratio, "2");
 // the clean interval of tablet lookup cache
 DEFINE_mInt32(tablet_lookup_cache_stale_sweep_time_sec, "30");
 DEFINE_mInt32(point_query_row_cache_stale_sweep_time_sec, "300");
@@ -337,6 +368,29 @@ DEFINE_mBool(disable_storage_page_cache, "false");
 DEFINE_mBool(disable_storage_row_cache, "true");
 // whether to disable pk page cache feature in storage
 DEFINE_Bool(disable_pk_storage_page_cache, "false");
+// whether to read the pages of local segment files with O_DIRECT when they are cached by the
+// storage page cache, so that they are not cached twice by the os page cache
+DEFINE_mBool(enable_local_direct_io_read, "false");
+// whether the concurrent reads of a page missing in the storage page cache share one load of
+// the page, so that the concurrent scans of the same data read and decompress it once
+DEFINE_mBool(enable_shared_page_load, "true");
+// the aligned buffers of direct io reads no larger than this size are pooled to be reused
+DEFINE_Int64(local_direct_io_buffer_size, "1048576");
+DEFINE_Int32(local_direct_io_max_buffer_num, "256");
+// size to read ahead asynchronously for the sequential direct io reads, 0 means disabled
+DEFINE_mInt64(local_direct_io_readahead_size, "1048576");
+// whether to schedule the IOs of local files by LocalIOScheduler, at most
+// local_io_scheduler_disk_concurrency IOs are issued to each disk, and the others are dispatched
+// by weighted fair queuing among the classes of IO and workload groups. Set a lower concurrency
+// for HDD or SATA SSD
+DEFINE_mBool(enable_local_io_scheduler, "false");
+DEFINE_mInt32(local_io_scheduler_disk_concurrency, "16");
+// weights of the classes of IO for LocalIOScheduler
+DEFINE_mInt32(local_io_scheduler_query_weight, "8");
+DEFINE_mInt32(local_io_scheduler_load_weight, "4");
+DEFINE_mInt32(local_io_scheduler_compaction_weight, "2");
+DEFINE_mInt32(local_io_scheduler_spill_weight, "2");
+DEFINE_mInt32(local_io_scheduler_other_weight, "4");
 DEFINE_Bool(enable_non_pipeline, "false");
 
 // Cache for mow primary key storage page size
@@ -347,9 +401,14 @@ DEFINE_Int32(primary_key_data_page_size, "32768");
 DEFINE_mInt32(data_page_cache_stale_sweep_time_sec, "300");
 DEFINE_mInt32(index_page_cache_stale_sweep_time_sec, "600");
 DEFINE_mInt32(pk_index_page_cache_stale_sweep_time_sec, "600");
+DEFINE_Double(data_page_cache_protected_ratio, "0");
+DEFINE_Bool(enable_lru_cache_clock_lookup, "false");
 
 DEFINE_Bool(enable_low_cardinality_optimize, "true");
 DEFINE_Bool(enable_low_cardinality_cache_code, "true");
+DEFINE_mInt32(segment_iterator_predicate_sample_batches, "8");
+DEFINE_mBool(enable_segment_read_ahead, "true");
+DEFINE_mDouble(segment_read_dense_rows_min_ratio, "0.5");
 
 // be policy
 // whether check compaction checksum
@@ -366,6 +425,14 @@ DEFINE_mInt32(vertical_compaction_num_columns_per_group, "5");
 DEFINE_Int32(vertical_compaction_max_row_source_memory_mb, "1024");
 // In vertical compaction, max dest segment file size
 DEFINE_mInt64(vertical_compaction_max_segment_size, "1073741824");
+// In vertical compaction, the thread num for VerticalCompactionThreadPool which compacts the
+// value column groups in parallel after the key group, 0 to compact them one by one
+DEFINE_Int32(vertical_compaction_value_group_thread_num, "0");
+// In vertical compaction, the max value column groups of one compaction compacted in parallel
+DEFINE_mInt32(vertical_compaction_max_parallel_value_groups, "4");
+// In base and full compaction of duplicate key tablets sorted by z-order, the rows are
+// reordered by the z-order curve over the sort columns in chunks of this many rows
+DEFINE_mInt64(zorder_compaction_sort_rows, "1048576");
 
 // If enabled, segments will be flushed column by column
 DEFINE_mBool(enable_vertical_segment_writer, "true");
@@ -373,6 +440,11 @@ DEFINE_mBool(enable_vertical_segment_writer, "true");
 // In ordered data compaction, min segment size for input rowset
 DEFINE_mInt32(ordered_data_compaction_min_segment_size, "10485760");
 
+// In cumulative compaction of non-overlapping rowsets of duplicate keys without deletes, copy the
+// encoded data pages of the value columns to the output segments instead of decoding and
+// encoding them again, only the key columns are merged as usual
+DEFINE_mBool(enable_page_copy_compaction, "false");
+
 // This config can be set to limit thread number in compaction thread pool.
 DEFINE_mInt32(max_base_compaction_threads, "4");
 DEFINE_mInt32(max_cumu_compaction_threads, "-1");
@@ -413,10 +485,21 @@ DEFINE_mInt64(cumulative_compaction_max_deltas, "1000");
 
 // This config can be set to limit thread number in  multiget thread pool.
 DEFINE_mInt32(multi_get_max_threads, "10");
+// The max number of segments a multiget request reads in parallel with the threads of the
+// multiget thread pool, 1 to read them one by one.
+DEFINE_mInt32(multi_get_max_parallel_segments, "4");
 
 // The upper limit of "permits" held by all compaction tasks. This config can be set to limit memory consumption for compaction.
 DEFINE_mInt64(total_permits_for_compaction_score, "10000");
 
+// Limit the compaction tasks of a data dir by the disk bandwidth measured from the finished ones:
+// the bytes read and written by the running tasks should be served within
+// compaction_io_budget_window_sec. The budget shrinks while the latency of query reads from
+// local disks is above compaction_io_throttle_latency_ratio times its usual value.
+DEFINE_mBool(enable_compaction_io_budget, "false");
+DEFINE_mInt32(compaction_io_budget_window_sec, "30");
+DEFINE_mDouble(compaction_io_throttle_latency_ratio, "2.0");
+
 // sleep interval in ms after generated compaction tasks
 DEFINE_mInt32(generate_compaction_tasks_interval_ms, "10");
 
@@ -447,6 +530,7 @@ DEFINE_mInt32(compaction_keep_invisible_version_max_count, "500");
 DEFINE_mInt32(base_compaction_trace_threshold, "60");
 DEFINE_mInt32(cumulative_compaction_trace_threshold, "10");
 DEFINE_mBool(disable_compaction_trace_log, "true");
+DEFINE_mInt32(compaction_stats_history_num, "16");
 
 // Interval to picking rowset to compact, in seconds
 DEFINE_mInt64(pick_rowset_to_compact_interval_sec, "86400");
@@ -519,6 +603,12 @@ DEFINE_Int32(tablet_writer_open_rpc_timeout_sec, "60");
 // You can ignore brpc error '[E1011]The server is overcrowded' when writing data.
 DEFINE_mBool(tablet_writer_ignore_eovercrowded, "true");
 DEFINE_mBool(exchange_sink_ignore_eovercrowded, "true");
+DEFINE_mBool(enable_exchange_batch_rpc, "false");
+DEFINE_mInt64(exchange_batch_rpc_max_bytes, "1048576");
+DEFINE_mInt64(exchange_batch_rpc_max_latency_us, "2000");
+DEFINE_mBool(enable_exchange_shm_transport, "false");
+DEFINE_mInt64(exchange_shm_ring_bytes, "67108864");
+DEFINE_mInt64(exchange_adaptive_compression_network_mbps, "1200");
 DEFINE_mInt32(slave_replica_writer_rpc_timeout_sec, "60");
 // Whether to enable stream load record function, the default is false.
 // False: disable stream load record
@@ -591,6 +681,9 @@ DEFINE_mInt32(memtable_hard_limit_active_percent, "50");
 
 // percent of (active memtables size / all memtables size) when reach soft limit
 DEFINE_mInt32(memtable_soft_limit_active_percent, "50");
+// a memtable active for this long counts as twice its size when picking memtables to flush
+// at the load memory limit, 0 to pick by size only
+DEFINE_mInt32(memtable_flush_age_weight_sec, "60");
 
 // memtable insert memory tracker will multiply input block size with this ratio
 DEFINE_mDouble(memtable_insert_memory_ratio, "1.4");
@@ -600,6 +693,10 @@ DEFINE_mInt64(write_buffer_size, "209715200");
 DEFINE_mInt64(write_buffer_size_for_agg, "419430400");
 // max parallel flush task per memtable writer
 DEFINE_mInt32(memtable_flush_running_count_limit, "2");
+// rows sorted by each task when a memtable is sorted in parallel at flush, 0 to disable
+DEFINE_mInt32(memtable_parallel_sort_rows_per_task, "1048576");
+// max tasks to sort one memtable at flush
+DEFINE_mInt32(memtable_parallel_sort_max_tasks, "4");
 
 DEFINE_Int32(load_process_max_memory_limit_percent, "50"); // 50%
 
@@ -616,6 +713,8 @@ DEFINE_Int32(load_process_safe_mem_permit_percent, "5");
 
 // result buffer cancelled time (unit: second)
 DEFINE_mInt32(result_buffer_cancelled_interval_time, "300");
+DEFINE_mInt64(result_buffer_max_bytes, "67108864");
+DEFINE_mInt64(result_fetch_max_bytes, "8388608");
 
 // the increased frequency of priority for remaining tasks in BlockingPriorityQueue
 DEFINE_mInt32(priority_queue_remaining_tasks_increased_frequency, "512");
@@ -721,6 +820,8 @@ DEFINE_Int32(txn_shard_size, "1024");
 // Whether to continue to start be when load tablet from header failed.
 DEFINE_Bool(ignore_load_tablet_failure, "false");
 
+DEFINE_Int32(load_tablet_meta_thread_num_per_store, "4");
+
 // Whether to continue to start be when load tablet from header failed.
 DEFINE_mBool(ignore_rowset_stale_unconsistent_delete, "false");
 
@@ -733,6 +834,11 @@ DEFINE_Int32(query_cache_elasticity_size_mb, "128");
 // Maximum number of cache partitions corresponding to a SQL
 DEFINE_Int32(query_cache_max_partition_count, "1024");
 
+DEFINE_String(fragment_cache_limit, "0");
+DEFINE_mInt64(fragment_cache_entry_max_bytes, "5242880");
+DEFINE_mInt64(fragment_cache_entry_max_rows, "500000");
+DEFINE_mInt32(fragment_cache_stale_sweep_time_sec, "300");
+
 // Maximum number of version of a tablet. If the version num of a tablet exceed limit,
 // the load process will reject new incoming load job of this tablet.
 // This is to avoid too many version num.
@@ -764,6 +870,10 @@ DEFINE_mInt32(remote_storage_read_buffer_mb, "16");
 // Decreasing this value will increase the frequency of consume/release.
 // Increasing this value will cause MemTracker statistics to be inaccurate.
 DEFINE_mInt32(mem_tracker_consume_min_size_bytes, "1048576");
+// If greater than mem_tracker_consume_min_size_bytes, a thread accumulates up to this size
+// before consuming the mem trackers while its query and the process are far from their
+// limits, and goes back to mem_tracker_consume_min_size_bytes near the limits.
+DEFINE_mInt32(mem_tracker_consume_max_size_bytes, "0");
 
 // The version information of the tablet will be stored in the memory
 // in an adjacency graph data structure.
@@ -792,6 +902,9 @@ DEFINE_Int32(load_stream_eagain_wait_seconds, "600");
 DEFINE_Int32(load_stream_flush_token_max_tasks, "15");
 // max wait flush token time in load stream
 DEFINE_Int32(load_stream_max_wait_flush_token_time_ms, "600000");
+// max bytes of a tablet waiting to be flushed in load stream, the stream stops taking data of
+// the tablet beyond it, which holds back the brpc stream window of the sender. 0 means no limit
+DEFINE_mInt64(load_stream_max_pending_flush_bytes_per_tablet, "67108864"); // 64MB
 
 // max send batch parallelism for OlapTableSink
 // The value set by the user for send_batch_parallelism is not allowed to exceed max_send_batch_parallelism_per_job,
@@ -893,9 +1006,22 @@ DEFINE_mInt32(parquet_header_max_size_mb, "1");
 DEFINE_mInt32(parquet_rowgroup_max_buffer_mb, "128");
 // Max buffer size for parquet chunk column
 DEFINE_mInt32(parquet_column_max_buffer_mb, "8");
+// Read the dictionary pages of the predicate columns first to prune a row group, before the
+// data pages of the row group are read
+DEFINE_mBool(enable_parquet_dict_filter_row_group, "true");
+// Read the bloom filters of the columns with "=" or "in" predicates to prune row groups
+DEFINE_mBool(enable_parquet_bloom_filter, "true");
+// Encode and compress the columns of a row group in parallel when writing parquet files
+DEFINE_mBool(enable_parquet_writer_parallel_encode, "true");
+// The data size of the blocks buffered in a row group before the parquet writer starts a new one
+DEFINE_mInt64(parquet_writer_row_group_bytes, "134217728");
 DEFINE_mDouble(max_amplified_read_ratio, "0.8");
 DEFINE_mInt32(merged_oss_min_io_size, "1048576");
 DEFINE_mInt32(merged_hdfs_min_io_size, "8192");
+// Merge the gap between two small IOs only if reading it takes less time than the latency of the
+// IO saved, by the latency and bandwidth learned from the reads of each kind of storage,
+// instead of max_amplified_read_ratio
+DEFINE_mBool(enable_merged_io_cost_model, "false");
 
 // OrcReader
 DEFINE_mInt32(orc_natural_read_size_mb, "8");
@@ -905,6 +1031,7 @@ DEFINE_mInt64(small_column_size_buffer, "100");
 // When the rows number reached this limit, will check the filter rate the of bloomfilter
 // if it is lower than a specific threshold, the predicate will be disabled.
 DEFINE_mInt32(rf_predicate_check_row_num, "204800");
+DEFINE_mBool(enable_runtime_filter_build_ndv, "true");
 
 // cooldown task configs
 DEFINE_Int32(cooldown_thread_num, "5");
@@ -922,6 +1049,10 @@ DEFINE_Bool(enable_time_lut, "true");
 DEFINE_mBool(enable_simdjson_reader, "true");
 
 DEFINE_mBool(enable_query_like_bloom_filter, "true");
+DEFINE_mBool(enable_auto_bloom_filter, "false");
+DEFINE_mInt32(auto_bloom_filter_min_scan_count, "100");
+DEFINE_mInt64(auto_bloom_filter_window_sec, "86400");
+DEFINE_mInt32(auto_bloom_filter_max_columns, "3");
 // number of s3 scanner thread pool size
 DEFINE_Int32(doris_remote_scanner_thread_pool_thread_num, "48");
 // number of s3 scanner thread pool queue size
@@ -977,6 +1108,58 @@ DEFINE_Bool(enable_fuzzy_mode, "false");
 DEFINE_Bool(enable_debug_points, "false");
 
 DEFINE_Int32(pipeline_executor_size, "0");
+// If true, pipeline executors are grouped by NUMA node: each executor thread is bound to the
+// cpus of its node, and tasks are stolen from executors of the same node first.
+DEFINE_Bool(enable_pipeline_task_numa_aware, "false");
+// How many successive rounds an executor fails to find a task on its own NUMA node before it
+// is allowed to steal tasks from executors of other nodes.
+DEFINE_mInt32(pipeline_task_numa_remote_steal_threshold, "3");
+// The task queue of pipeline executors:
+// priority: per-core multilevel feedback queues protected by a mutex.
+// work_stealing: per-core lock free work stealing deques with the same multilevel feedback.
+DEFINE_String(pipeline_task_queue_type, "priority");
+DEFINE_Validator(pipeline_task_queue_type, [](const std::string& config) -> bool {
+    return config == "priority" || config == "work_stealing";
+});
+DEFINE_Bool(enable_workload_group_fair_queue, "false");
+// If true, the run slice, queue wait and blocked time of pipeline tasks are recorded into
+// per operator histograms, which are shown by http api/pipeline/latency_stats.
+DEFINE_mBool(enable_pipeline_task_latency_stats, "true");
+// If true, the tasks woken up by one dependency are pushed into the task queue together,
+// which visits the queue of every target core once and spreads the tasks over the cores.
+DEFINE_mBool(enable_pipeline_batch_wake_up, "true");
+DEFINE_mBool(enable_pipeline_task_perf_counters, "false");
+DEFINE_mBool(enable_query_storage_read_log, "false");
+
+// If true, the hash table of an inner hash join with a big build side is radix partitioned:
+// the rows are clustered by the high bits of their bucket numbers into sub-tables of about
+// hash_join_radix_sub_table_bytes, and the rows of every probe block are visited partition by
+// partition, so the probe hits the cache instead of random DRAM accesses.
+DEFINE_mBool(enable_hash_join_radix_partition, "false");
+// The build side needs at least so many rows to be radix partitioned.
+DEFINE_mInt64(hash_join_radix_partition_min_build_rows, "1048576");
+// The expected size of a radix partitioned sub-table, which should fit into the L2 cache.
+DEFINE_mInt64(hash_join_radix_sub_table_bytes, "262144");
+// If true, the probe of a big hash join prefetches the bucket heads and the chains of the
+// following probe rows, to overlap the cache misses of the rows.
+DEFINE_mBool(enable_hash_join_probe_prefetch, "true");
+// If true, a big join hash table keeps a few bits of the hashes of the rows in every bucket,
+// so that most probe rows that match no row are rejected without visiting the bucket chain.
+DEFINE_mBool(enable_hash_join_bucket_tags, "true");
+// If true, the instances waiting for a shared broadcast hash table of at least
+// share_hash_table_cooperative_build_min_rows rows insert its rows together with the builder.
+DEFINE_mBool(enable_share_hash_table_cooperative_build, "true");
+DEFINE_mInt64(share_hash_table_cooperative_build_min_rows, "1048576");
+DEFINE_mInt32(nested_loop_join_band_block_rows, "1024");
+// The max number of keys in the range of the single integer group by keys that are
+// aggregated in an array indexed by the key instead of a hash table, 0 to always hash them.
+DEFINE_mInt64(agg_dense_hash_map_max_range, "65536");
+DEFINE_mBool(enable_merge_sort_normalized_key, "true");
+DEFINE_mInt32(analytic_segment_tree_min_frame_rows, "64");
+DEFINE_mInt64(preagg_ndv_sample_rows, "0");
+DEFINE_mInt64(preagg_ndv_reevaluate_rows, "1048576");
+DEFINE_mDouble(preagg_passthrough_min_ndv_ratio, "0.9");
+DEFINE_mDouble(preagg_full_agg_max_ndv_ratio, "0.1");
 DEFINE_Bool(enable_workload_group_for_scan, "false");
 DEFINE_mInt64(workload_group_scan_task_wait_timeout_ms, "10000");
 
@@ -987,6 +1170,10 @@ DEFINE_Bool(enable_index_apply_preds_except_leafnode_of_andnode, "true");
 DEFINE_mBool(variant_enable_flatten_nested, "false");
 DEFINE_mDouble(variant_ratio_of_defaults_as_sparse_column, "1");
 DEFINE_mInt64(variant_threshold_rows_to_estimate_sparse_column, "1000");
+// Max number of the subcolumns of a variant column materialized in a segment, the subcolumns
+// with the most default values beyond it are stored as sparse columns in the root column.
+// 0 means no limit.
+DEFINE_mInt32(variant_max_subcolumns_count, "2048");
 
 // block file cache
 DEFINE_Bool(enable_file_cache, "false");
@@ -999,12 +1186,33 @@ DEFINE_Bool(clear_file_cache, "false");
 DEFINE_Bool(enable_file_cache_query_limit, "false");
 DEFINE_mInt32(file_cache_enter_disk_resource_limit_mode_percent, "90");
 DEFINE_mInt32(file_cache_exit_disk_resource_limit_mode_percent, "80");
+// number of shards of each file cache path. every shard is an independent cache with its own lock
+// and lru queues over 1/n of the capacity, and the blocks of a file always go to the same shard.
+// changing it drops the blocks cached under the previous value
+DEFINE_Int32(file_cache_shard_num, "1");
+// remove the files of evicted file cache blocks in background. the eviction under the cache lock
+// only renames the file, so that unlinking it does not block the readers of the cache
+DEFINE_mBool(enable_file_cache_async_remove, "false");
+// memory limit of the memory tier of file cache, the downloaded blocks read more than
+// file_block_mem_cache_promote_reads times are kept in it. 0 means disabled
+DEFINE_String(file_block_mem_cache_limit, "0");
+// times a downloaded file cache block is read from disk before it is copied to the memory tier
+DEFINE_mInt32(file_block_mem_cache_promote_reads, "4");
+// stale sweep time of the memory tier of file cache
+DEFINE_mInt32(file_block_mem_cache_stale_sweep_time_sec, "1800");
+// times a file cache block read again after it entered its queue is passed over by the lru
+// eviction of the queue before the blocks read only once. 0 means plain lru
+DEFINE_mInt32(file_cache_max_evict_second_chances, "0");
+// interval of persisting the blocks meta of each file cache. at start, the cache loads the last
+// snapshot at once and verifies it by scanning the blocks in background. 0 means disabled
+DEFINE_mInt64(file_cache_meta_snapshot_interval_sec, "0");
 DEFINE_mBool(enable_read_cache_file_directly, "false");
 DEFINE_mBool(file_cache_enable_evict_from_other_queue_by_size, "false");
 DEFINE_mInt64(file_cache_ttl_valid_check_interval_second, "0"); // zero for not checking
 
 DEFINE_mInt32(index_cache_entry_stay_time_after_lookup_s, "1800");
 DEFINE_mInt32(inverted_index_cache_stale_sweep_time_sec, "600");
+DEFINE_Double(inverted_index_cache_protected_ratio, "0");
 // inverted index searcher cache size
 DEFINE_String(inverted_index_searcher_cache_limit, "10%");
 // set `true` to enable insert searcher into cache when write inverted index data
@@ -1015,6 +1223,10 @@ DEFINE_Int32(inverted_index_query_cache_shards, "256");
 
 // inverted index match bitmap cache size
 DEFINE_String(inverted_index_query_cache_limit, "10%");
+// the min recent misses of an inverted index query before its result is cached
+DEFINE_mInt32(inverted_index_query_cache_admission_min_misses, "2");
+// the max percent of segment rows left by earlier predicates to filter a bkd index query
+DEFINE_mInt32(inverted_index_bkd_row_filter_max_percent, "10");
 
 // inverted index
 DEFINE_mDouble(inverted_index_ram_buffer_size, "512");
@@ -1032,6 +1244,7 @@ DEFINE_mBool(inverted_index_compaction_enable, "false");
 DEFINE_mBool(debug_inverted_index_compaction, "false");
 // index by RAM directory
 DEFINE_mBool(inverted_index_ram_dir_enable, "true");
+DEFINE_mInt32(inverted_index_build_segment_parallelism, "1");
 // use num_broadcast_buffer blocks as buffer to do broadcast
 DEFINE_Int32(num_broadcast_buffer, "32");
 
@@ -1049,6 +1262,11 @@ DEFINE_mInt32(tablet_path_check_batch_size, "1000");
 DEFINE_mInt64(row_column_page_size, "4096");
 // it must be larger than or equal to 5MB
 DEFINE_mInt64(s3_write_buffer_size, "5242880");
+// the part size of s3 file writer doubles every this number of parts, so that big files do not
+// exceed the 10000 parts limit of s3. 0 means the part size is always s3_write_buffer_size
+DEFINE_mInt64(s3_write_part_size_grow_interval, "1000");
+// the max part size the part size of s3 file writer grows to
+DEFINE_mInt64(s3_write_max_part_size, "268435456");
 // Log interval when doing s3 upload task
 DEFINE_mInt32(s3_file_writer_log_interval_second, "60");
 DEFINE_mInt64(file_cache_max_file_reader_cache_size, "1000000");
@@ -1065,6 +1283,7 @@ DEFINE_mInt32(estimated_num_columns_per_segment, "30");
 DEFINE_mInt32(estimated_mem_per_column_reader, "1024");
 // The value is calculate by storage_page_cache_limit * index_page_cache_percentage
 DEFINE_mInt32(segment_cache_memory_percentage, "2");
+DEFINE_Double(segment_cache_protected_ratio, "0");
 
 // enable feature binlog, default false
 DEFINE_Bool(enable_feature_binlog, "false");
@@ -1074,7 +1293,18 @@ DEFINE_Bool(enable_set_in_bitmap_value, "true");
 
 DEFINE_Int64(max_hdfs_file_handle_cache_num, "1000");
 DEFINE_Int32(max_hdfs_file_handle_cache_time_sec, "3600");
+// number of threads for hedged read of each hdfs client, the reader reads another replica if the
+// current one does not return within hdfs_hedged_read_threshold_time_ms. 0 means disabled
+DEFINE_Int32(hdfs_hedged_read_thread_num, "0");
+// 0 means the p95 latency of the hdfs reads of this BE when the hdfs client is created
+DEFINE_Int32(hdfs_hedged_read_threshold_time_ms, "500");
+// domain socket path of the DataNode co-located with BE, which enables short-circuit read.
+// empty means disabled
+DEFINE_String(hdfs_short_circuit_domain_socket_path, "");
 DEFINE_Int64(max_external_file_meta_cache_num, "1000");
+// max memory size of the meta info of external files. If it is > 0, the cache is limited by
+// memory size instead of max_external_file_meta_cache_num, and is used for any number of files
+DEFINE_Int64(max_external_file_meta_cache_bytes, "0");
 DEFINE_mInt32(common_obj_lru_cache_stale_sweep_time_sec, "900");
 // Apply delete pred in cumu compaction
 DEFINE_mBool(enable_delete_when_cumu_compaction, "false");
@@ -1139,6 +1369,19 @@ DEFINE_mInt32(group_commit_queue_mem_limit, "67108864");
 // group_commit_wal_max_disk_limit=1024 or group_commit_wal_max_disk_limit=10% can be automatically identified.
 DEFINE_String(group_commit_wal_max_disk_limit, "10%");
 DEFINE_Bool(group_commit_wait_replay_wal_finish, "false");
+// Make the blocks appended to a wal durable before acknowledging the load. The syncs of the wal
+// files in one wal dir are grouped, a group waits group_commit_wal_sync_window_us for more files.
+DEFINE_mBool(enable_wal_group_sync, "false");
+DEFINE_mInt32(group_commit_wal_sync_window_us, "500");
+// Size the commit interval of a group commit table by its arrival rate, so that a commit holds
+// about group_commit_adaptive_target_bytes (at most the group_commit_data_bytes of the table)
+// within [group_commit_adaptive_min_interval_ms, group_commit_interval_ms of the table]. The full
+// group_commit_interval_ms is used while the version count of a tablet written by the table
+// exceeds group_commit_adaptive_version_ratio of max_tablet_version_num.
+DEFINE_mBool(enable_group_commit_adaptive_interval, "false");
+DEFINE_mInt64(group_commit_adaptive_target_bytes, "16777216");
+DEFINE_mInt32(group_commit_adaptive_min_interval_ms, "100");
+DEFINE_mDouble(group_commit_adaptive_version_ratio, "0.5");
 
 DEFINE_mInt32(scan_thread_nice_value, "0");
 DEFINE_mInt32(tablet_schema_cache_recycle_interval, "3600");
@@ -1172,6 +1415,14 @@ DEFINE_Bool(enable_snapshot_action, "false");
 DEFINE_mInt32(variant_max_merged_tablet_schema_size, "2048");
 
 DEFINE_mBool(enable_column_type_check, "true");
+
+// Whether to execute the identical subtrees of the projections of an operator only once per
+// block, e.g. substr(url, 1, 10) projected alone and inside another expr.
+DEFINE_mBool(enable_projection_common_expr_elimination, "true");
+// Whether to execute the WHENs of CASE on the rows not matched by the previous WHENs, and the
+// THENs and ELSE on the rows selecting them, if some of them are more expensive than selecting
+// their results row by row.
+DEFINE_mBool(enable_case_when_short_circuit, "true");
 // 128 MB
 DEFINE_mInt64(local_exchange_buffer_mem_limit, "134217728");
 
@@ -1182,6 +1433,9 @@ DEFINE_mInt64(enable_debug_log_timeout_secs, "0");
 DEFINE_Int32(ignore_invalid_partition_id_rowset_num, "0");
 
 DEFINE_mInt32(report_query_statistics_interval_ms, "3000");
+// The interval to sample the memory of an operator into the "MemoryTimeline" of its profile,
+// which is doubled when the timeline gets long. Non-positive to disable the timeline.
+DEFINE_mInt32(operator_mem_timeline_interval_ms, "1000");
 // 30s
 DEFINE_mInt32(query_statistics_reserve_timeout_ms, "30000");
 
@@ -1206,6 +1460,17 @@ DEFINE_Validator(spill_io_thread_pool_thread_num, [](const int config) -> bool {
     return true;
 });
 DEFINE_Int32(spill_io_thread_pool_queue_size, "102400");
+// 64M
+DEFINE_mInt64(spill_write_max_in_flight_bytes, "67108864");
+// 1G
+DEFINE_mInt64(spill_hash_join_partition_max_bytes, "1073741824");
+DEFINE_mInt32(spill_hash_join_max_repartition_depth, "3");
+DEFINE_mInt32(spill_hash_join_heavy_hitter_percent, "80");
+// 1G
+DEFINE_mInt64(spill_aggregation_partition_max_bytes, "1073741824");
+DEFINE_mBool(enable_spill_sort_merge_prefetch, "true");
+DEFINE_mInt32(spill_sort_merge_max_fan_in_per_hdd, "32");
+DEFINE_mInt64(multi_cast_data_streamer_max_buffer_bytes, "1073741824");
 
 DEFINE_mBool(check_segment_when_build_rowset_meta, "false");
 
@@ -1233,6 +1498,9 @@ DEFINE_mInt64(table_sink_partition_write_min_partition_data_processed_rebalance_
               "15728640"); // 15MB
 // Maximum processed partition nums of per writer when partition writing
 DEFINE_mInt32(table_sink_partition_write_max_partition_nums_per_writer, "128");
+// Spill the rows of the partitions beyond the maximum open partitions of a writer and write
+// them partition by partition at close, instead of failing the partition writing
+DEFINE_mBool(enable_table_sink_partition_spill, "false");
 
 /** Hive sink configurations **/
 DEFINE_mInt64(hive_sink_max_file_size, "1073741824"); // 1GB
@@ -1265,6 +1533,34 @@ DEFINE_Int64(num_buffered_reader_prefetch_thread_pool_max_thread, "64");
 DEFINE_Int64(num_s3_file_upload_thread_pool_min_thread, "16");
 // The max thread num for S3FileUploadThreadPool
 DEFINE_Int64(num_s3_file_upload_thread_pool_max_thread, "64");
+// The min thread num for S3FileReadThreadPool
+DEFINE_Int64(num_s3_file_read_thread_pool_min_thread, "16");
+// The max thread num for S3FileReadThreadPool
+DEFINE_Int64(num_s3_file_read_thread_pool_max_thread, "64");
+// The reads of s3 file reader not smaller than twice of it are split into ranged GETs of this size
+// sent concurrently. 0 means disabled
+DEFINE_mInt64(s3_parallel_read_part_size, "0");
+// Send a duplicate GET for the reads of s3 file reader not larger than s3_hedged_read_max_bytes,
+// if the first one does not return within the p95 latency of GETs
+DEFINE_mBool(enable_s3_hedged_read, "false");
+DEFINE_mInt64(s3_hedged_read_max_bytes, "4194304");
+// The min delay before the duplicate GET of a hedged read is sent
+DEFINE_mInt32(s3_hedged_read_min_delay_ms, "50");
+DEFINE_mInt64(remote_read_bytes_per_second, "0");
+DEFINE_mInt64(remote_read_requests_per_second, "0");
+// The thread num for SegmentEncodeThreadPool which encodes and compresses the columns of a
+// segment in parallel at flush, 0 to disable it
+DEFINE_Int32(segment_encode_thread_num, "0");
+// The min columns of a segment to encode them in parallel
+DEFINE_mInt32(segment_parallel_encode_min_columns, "64");
+// Whether to choose the encoding of each column of a segment by encoding a sample of its first
+// rows with every encoding the type supports, instead of the fixed default encoding of the type
+DEFINE_mBool(enable_column_encoding_sampling, "false");
+// The max rows sampled from the first rows of a column to choose its encoding
+DEFINE_mInt32(column_encoding_sample_rows, "4096");
+// The encodings whose sampled size is within this percent of the smallest one are thought to be
+// as compact, and the one of them which decodes fastest is chosen
+DEFINE_mInt32(column_encoding_size_tolerance_percent, "10");
 // The max ratio for ttl cache's size
 DEFINE_mInt64(max_ttl_cache_ratio, "90");
 // The maximum jvm heap usage ratio for hdfs write workload
@@ -149,6 +149,11 @@ DECLARE_Double(schema_change_mem_limit_frac);
 // memory greater than 16 GB.
 DECLARE_mInt64(mmap_threshold); // bytes
 
+// Advise the kernel to back the allocations of at least 2MB like the large hash tables and
+// arrays by transparent huge pages, to reduce the TLB misses of their random accesses.
+// Only takes effect if THP is "madvise" or "always" in /sys/kernel/mm/transparent_hugepage.
+DECLARE_mBool(enable_huge_page_for_large_allocation);
+
 // When hash table capacity is greater than 2^double_grow_degree(default 2G), grow when 75% of the capacity is satisfied.
 // Increase can reduce the number of hash table resize, but may waste more memory.
 DECLARE_mInt32(hash_table_double_grow_degree);
@@ -174,6 +179,11 @@ DECLARE_mString(process_full_gc_size);
 // used memory and the exec_mem_limit will be canceled.
 // If false, cancel query when the memory used exceeds exec_mem_limit, same as before.
 DECLARE_mBool(enable_query_memory_overcommit);
+
+// If true, when the process memory exceeds the soft mem limit, the memory GC asks the queries
+// with the most revocable memory (hash join build, aggregation, sort) to spill before canceling
+// the queries, only works for the queries that enable spill.
+DECLARE_mBool(enable_spill_memory_arbitration);
 //waibibabu
 // gc will release cache, cancel task, and task will wait for gc to release memory,
 // default gc strategy is conservative, if you want to exclude the interference of gc, let it be true
@@ -217,6 +227,10 @@ DECLARE_Int32(calc_delete_bitmap_max_thread);
 DECLARE_Int32(calc_delete_bitmap_worker_count);
 // the count of thread to calc tablet delete bitmap task, only used for cloud
 DECLARE_Int32(calc_tablet_delete_bitmap_task_max_thread);
+// the delete bitmap of a segment with more rows than it is calculated by several concurrent
+// tasks, each of at most this many rows. Not used by partial updates and tables with cluster
+// keys, 0 means one task per segment
+DECLARE_mInt32(calc_delete_bitmap_rows_per_task);
 // the count of thread to clear transaction task
 DECLARE_Int32(clear_transaction_task_worker_count);
 // the count of thread to delete
@@ -235,6 +249,8 @@ DECLARE_Int32(check_consistency_worker_count);
 DECLARE_Int32(upload_worker_count);
 // the count of thread to download
 DECLARE_Int32(download_worker_count);
+// the count of thread to transfer the tablet snapshots of an upload or a download task
+DECLARE_mInt32(snapshot_loader_transfer_concurrency);
 // the count of thread to make snapshot
 DECLARE_Int32(make_snapshot_worker_count);
 // the count of thread to release snapshot
@@ -256,6 +272,9 @@ DECLARE_mInt32(max_download_speed_kbps);
 DECLARE_mInt32(download_low_speed_limit_kbps);
 // download low speed time(seconds)
 DECLARE_mInt32(download_low_speed_time);
+// the max number of files downloaded concurrently by a clone task, they share the
+// max_download_speed_kbps of the task
+DECLARE_mInt32(clone_download_file_concurrency);
 
 // deprecated, use env var LOG_DIR in be.conf
 DECLARE_String(sys_log_dir);
@@ -291,11 +310,16 @@ DECLARE_mInt64(doris_blocking_priority_queue_wait_timeout_ms);
 DECLARE_mInt32(doris_scanner_thread_pool_thread_num);
 // number of batch size to fetch the remote split source
 DECLARE_mInt32(remote_split_source_batch_size);
+// Hand out the splits of a file scan from the largest to the smallest
+DECLARE_mBool(enable_split_source_order_by_size);
 // max number of remote scanner thread pool size
 // if equal to -1, value is std::max(512, CpuInfo::num_cores() * 10)
 DECLARE_Int32(doris_max_remote_scanner_thread_pool_thread_num);
 // number of olap scanner thread pool queue size
 DECLARE_Int32(doris_scanner_thread_pool_queue_size);
+// Park the running scanners of a scan whose consumer can not keep up with them, so that
+// their threads serve other queries until the consumer waits for blocks again
+DECLARE_mBool(enable_scanner_scale_down);
 // default thrift client connect timeout(in seconds)
 DECLARE_mInt32(thrift_connect_timeout_seconds);
 DECLARE_mInt32(fetch_rpc_timeout_seconds);
@@ -322,16 +346,33 @@ DECLARE_mInt32(max_pushdown_conditions_per_column);
 // (Advanced) Maximum size of per-query receive-side buffer
 DECLARE_mInt32(exchg_node_buffer_size_bytes);
 DECLARE_mInt32(exchg_buffer_queue_capacity_factor);
+// The number of threads to deserialize the blocks received by exchange, off the brpc threads.
+// 0 means the blocks are deserialized by the brpc threads.
+DECLARE_Int32(exchange_deserialize_thread_num);
+// The number of threads to serialize the big result blocks sent over the mysql protocol in
+// parallel, by ranges of mysql_result_serialize_batch_rows rows. 0 means the blocks are
+// serialized by the thread of the result sink.
+DECLARE_Int32(mysql_result_serialize_thread_num);
+DECLARE_mInt32(mysql_result_serialize_batch_rows);
 
 DECLARE_mInt64(column_dictionary_key_ratio_threshold);
 DECLARE_mInt64(column_dictionary_key_size_threshold);
 // memory_limitation_per_thread_for_schema_change_bytes unit bytes
 DECLARE_mInt64(memory_limitation_per_thread_for_schema_change_bytes);
+// The rowsets of a tablet converted concurrently by a schema change, each by a thread with
+// up to memory_limitation_per_thread_for_schema_change_bytes of memory
+DECLARE_mInt32(schema_change_rowset_parallelism);
 DECLARE_mInt64(memory_limitation_per_thread_for_storage_migration_bytes);
 
 // all cache prune interval, used by GC and periodic thread.
 DECLARE_mInt32(cache_prune_interval_sec);
 DECLARE_mInt32(cache_periodic_prune_stale_sweep_sec);
+// Whether to move the capacity among the page, segment and inverted index caches by their
+// misses at every periodic prune stale, the total capacity stays the configured one.
+DECLARE_mBool(enable_cache_capacity_rebalance);
+// The capacity of a rebalanced cache stays within these ratios of its configured capacity.
+DECLARE_mDouble(cache_capacity_rebalance_min_ratio);
+DECLARE_mDouble(cache_capacity_rebalance_max_ratio);
 // the clean interval of tablet lookup cache
 DECLARE_mInt32(tablet_lookup_cache_stale_sweep_time_sec);
 DECLARE_mInt32(point_query_row_cache_stale_sweep_time_sec);
@@ -386,6 +427,29 @@ DECLARE_Bool(disable_storage_page_cache);
 DECLARE_mBool(disable_storage_row_cache);
 // whether to disable pk page cache feature in storage
 DECLARE_Bool(disable_pk_storage_page_cache);
+// whether to read the pages of local segment files with O_DIRECT when they are cached by the
+// storage page cache, so that they are not cached twice by the os page cache
+DECLARE_mBool(enable_local_direct_io_read);
+// whether the concurrent reads of a page missing in the storage page cache share one load of
+// the page, so that the concurrent scans of the same data read and decompress it once
+DECLARE_mBool(enable_shared_page_load);
+// the aligned buffers of direct io reads no larger than this size are pooled to be reused
+DECLARE_Int64(local_direct_io_buffer_size);
+DECLARE_Int32(local_direct_io_max_buffer_num);
+// size to read ahead asynchronously for the sequential direct io reads, 0 means disabled
+DECLARE_mInt64(local_direct_io_readahead_size);
+// whether to schedule the IOs of local files by LocalIOScheduler, at most
+// local_io_scheduler_disk_concurrency IOs are issued to each disk, and the others are dispatched
+// by weighted fair queuing among the classes of IO and workload groups. Set a lower concurrency
+// for HDD or SATA SSD
+DECLARE_mBool(enable_local_io_scheduler);
+DECLARE_mInt32(local_io_scheduler_disk_concurrency);
+// weights of the classes of IO for LocalIOScheduler
+DECLARE_mInt32(local_io_scheduler_query_weight);
+DECLARE_mInt32(local_io_scheduler_load_weight);
+DECLARE_mInt32(local_io_scheduler_compaction_weight);
+DECLARE_mInt32(local_io_scheduler_spill_weight);
+DECLARE_mInt32(local_io_scheduler_other_weight);
 DECLARE_Bool(enable_non_pipeline);
 
 // Cache for mow primary key storage page size, it's seperated from
@@ -399,9 +463,29 @@ DECLARE_mInt32(data_page_cache_stale_sweep_time_sec);
 DECLARE_mInt32(index_page_cache_stale_sweep_time_sec);
 // great impact on the performance of MOW, so it can be longer.
 DECLARE_mInt32(pk_index_page_cache_stale_sweep_time_sec);
+// The ratio of the capacity of the data page cache held by the pages hit more than once.
+// A page is first cached in a probation segment, so a scan which reads each page once only
+// evicts the probation pages. 0 means a plain LRU.
+DECLARE_Double(data_page_cache_protected_ratio);
+// Whether the lookups of the data page, segment and schema caches take the lock of their shard
+// shared, so that the hits on a hot shard scale with the scanner threads. A hit then marks the
+// entry instead of moving it in the lru list, and the eviction is a CLOCK over the list.
+DECLARE_Bool(enable_lru_cache_clock_lookup);
 
 DECLARE_Bool(enable_low_cardinality_optimize);
 DECLARE_Bool(enable_low_cardinality_cache_code);
+// The number of batches of a segment iterator over which the cost and the selectivity of the
+// short circuit predicates are measured, to evaluate the cheap and selective ones first.
+// 0 means the predicates are evaluated in their original order.
+DECLARE_mInt32(segment_iterator_predicate_sample_batches);
+// Whether a segment iterator on remote storage plans the data pages of all the columns to read
+// for its row ranges, and merges the small page reads into large ones.
+DECLARE_mBool(enable_segment_read_ahead);
+// A batch of scattered rows of a segment iterator, e.g. the rows left by the dense deletes of a
+// merge-on-write segment, reads all the rows from its first to its last row sequentially and
+// filters out the rows not in the batch, if they are at least this ratio of the rows read.
+// A ratio greater than 1 disables it.
+DECLARE_mDouble(segment_read_dense_rows_min_ratio);
 
 // be policy
 // whether check compaction checksum
@@ -418,6 +502,14 @@ DECLARE_mInt32(vertical_compaction_num_columns_per_group);
 DECLARE_Int32(vertical_compaction_max_row_source_memory_mb);
 // In vertical compaction, max dest segment file size
 DECLARE_mInt64(vertical_compaction_max_segment_size);
+// In vertical compaction, the thread num for VerticalCompactionThreadPool which compacts the
+// value column groups in parallel after the key group, 0 to compact them one by one
+DECLARE_Int32(vertical_compaction_value_group_thread_num);
+// In vertical compaction, the max value column groups of one compaction compacted in parallel
+DECLARE_mInt32(vertical_compaction_max_parallel_value_groups);
+// In base and full compaction of duplicate key tablets sorted by z-order, the rows are
+// reordered by the z-order curve over the sort columns in chunks of this many rows
+DECLARE_mInt64(zorder_compaction_sort_rows);
 
 // If enabled, segments will be flushed column by column
 DECLARE_mBool(enable_vertical_segment_writer);
@@ -425,6 +517,11 @@ DECLARE_mBool(enable_vertical_segment_writer);
 // In ordered data compaction, min segment size for input rowset
 DECLARE_mInt32(ordered_data_compaction_min_segment_size);
 
+// In cumulative compaction of non-overlapping rowsets of duplicate keys without deletes, copy the
+// encoded data pages of the value columns to the output segments instead of decoding and
+// encoding them again, only the key columns are merged as usual
+DECLARE_mBool(enable_page_copy_compaction);
+
 // This config can be set to limit thread number in compaction thread pool.
 DECLARE_mInt32(max_base_compaction_threads);
 DECLARE_mInt32(max_cumu_compaction_threads);
@@ -465,10 +562,21 @@ DECLARE_mInt64(cumulative_compaction_max_deltas);
 
 // This config can be set to limit thread number in  multiget thread pool.
 DECLARE_mInt32(multi_get_max_threads);
+// The max number of segments a multiget request reads in parallel with the threads of the
+// multiget thread pool, 1 to read them one by one.
+DECLARE_mInt32(multi_get_max_parallel_segments);
 
 // The upper limit of "permits" held by all compaction tasks. This config can be set to limit memory consumption for compaction.
 DECLARE_mInt64(total_permits_for_compaction_score);
 
+// Limit the compaction tasks of a data dir by the disk bandwidth measured from the finished ones:
+// the bytes read and written by the running tasks should be served within
+// compaction_io_budget_window_sec. The budget shrinks while the latency of query reads from
+// local disks is above compaction_io_throttle_latency_ratio times its usual value.
+DECLARE_mBool(enable_compaction_io_budget);
+DECLARE_mInt32(compaction_io_budget_window_sec);
+DECLARE_mDouble(compaction_io_throttle_latency_ratio);
+
 // sleep interval in ms after generated compaction tasks
 DECLARE_mInt32(generate_compaction_tasks_interval_ms);
 // sleep interval in second after update replica infos
@@ -494,6 +602,8 @@ DECLARE_mInt32(compaction_keep_invisible_version_max_count);
 DECLARE_mInt32(base_compaction_trace_threshold);
 DECLARE_mInt32(cumulative_compaction_trace_threshold);
 DECLARE_mBool(disable_compaction_trace_log);
+// The number of the last compactions of a tablet kept for /api/compaction/stats
+DECLARE_mInt32(compaction_stats_history_num);
 
 // Interval to picking rowset to compact, in seconds
 DECLARE_mInt64(pick_rowset_to_compact_interval_sec);
@@ -570,6 +680,23 @@ DECLARE_Int32(tablet_writer_open_rpc_timeout_sec);
 // You can ignore brpc error '[E1011]The server is overcrowded' when writing data.
 DECLARE_mBool(tablet_writer_ignore_eovercrowded);
 DECLARE_mBool(exchange_sink_ignore_eovercrowded);
+// Whether to pack the small blocks sent to the instances on the same backend into one rpc.
+// All the backends of the cluster must support the batched transmit_block before enabling it.
+DECLARE_mBool(enable_exchange_batch_rpc);
+// Blocks larger than this are always sent alone, and a batch stops growing at this size.
+DECLARE_mInt64(exchange_batch_rpc_max_bytes);
+// A pending block is sent by a new rpc, instead of waiting for the in flight rpc of its
+// backend, if it has waited longer than this.
+DECLARE_mInt64(exchange_batch_rpc_max_latency_us);
+// Whether to pass the batched exchange packets through a shared memory ring, instead of the
+// loopback socket, to another backend process on the same host. It requires
+// enable_exchange_batch_rpc, and the backends must share the same /dev/shm.
+DECLARE_mBool(enable_exchange_shm_transport);
+// The bytes of the shared memory ring of one exchange sink to one backend.
+DECLARE_mInt64(exchange_shm_ring_bytes);
+// The network bandwidth(MB/s) of one exchange channel assumed by the adaptive transmission
+// compression, which trades the cpu time of compression against the time to send the bytes.
+DECLARE_mInt64(exchange_adaptive_compression_network_mbps);
 DECLARE_mInt32(slave_replica_writer_rpc_timeout_sec);
 // Whether to enable stream load record function, the default is false.
 // False: disable stream load record
@@ -644,6 +771,10 @@ DECLARE_mInt32(memtable_hard_limit_active_percent);
 
 // percent of (active memtables size / all memtables size) when reach soft limit
 DECLARE_mInt32(memtable_soft_limit_active_percent);
+// when the load memory limit is reached, active memtables are flushed largest first, and a
+// memtable active for this long counts as twice its size, so that the memtables of slow loads
+// are flushed too. 0 to pick by size only
+DECLARE_mInt32(memtable_flush_age_weight_sec);
 
 // memtable insert memory tracker will multiply input block size with this ratio
 DECLARE_mDouble(memtable_insert_memory_ratio);
@@ -653,6 +784,12 @@ DECLARE_mInt64(write_buffer_size);
 DECLARE_mInt64(write_buffer_size_for_agg);
 // max parallel flush task per memtable writer
 DECLARE_mInt32(memtable_flush_running_count_limit);
+// a memtable with at least 2 times this many new rows is sorted at flush by several tasks on
+// the flush thread pool, each of them sorting this many rows before the chunks are merged.
+// 0 disables it
+DECLARE_mInt32(memtable_parallel_sort_rows_per_task);
+// max tasks to sort one memtable at flush
+DECLARE_mInt32(memtable_parallel_sort_max_tasks);
 
 DECLARE_Int32(load_process_max_memory_limit_percent); // 50%
 
@@ -669,6 +806,11 @@ DECLARE_Int32(load_process_safe_mem_permit_percent);
 
 // result buffer cancelled time (unit: second)
 DECLARE_mInt32(result_buffer_cancelled_interval_time);
+// The bytes of the rows queued in a result buffer for a client before the result sink pauses.
+DECLARE_mInt64(result_buffer_max_bytes);
+// The batches queued in a result buffer are sent in one fetch up to this many bytes, which
+// saves FE round trips for a big result. 0 means one batch per fetch.
+DECLARE_mInt64(result_fetch_max_bytes);
 
 // the increased frequency of priority for remaining tasks in BlockingPriorityQueue
 DECLARE_mInt32(priority_queue_remaining_tasks_increased_frequency);
@@ -777,6 +919,9 @@ DECLARE_Int32(txn_shard_size);
 // Whether to continue to start be when load tablet from header failed.
 DECLARE_Bool(ignore_load_tablet_failure);
 
+// The number of threads loading the tablet metas of a data dir at startup.
+DECLARE_Int32(load_tablet_meta_thread_num_per_store);
+
 // Whether to continue to start be when load tablet from header failed.
 DECLARE_mBool(ignore_rowset_stale_unconsistent_delete);
 
@@ -789,6 +934,17 @@ DECLARE_Int32(query_cache_elasticity_size_mb);
 // Maximum number of cache partitions corresponding to a SQL
 DECLARE_Int32(query_cache_max_partition_count);
 
+// Memory limit of the fragment cache, which keeps the output of the streaming pre-aggregations
+// over the scan of a single tablet, keyed by the plan of the fragment and the version of the
+// tablet, so that the repeated queries only recompute the tablets changed since. The queries
+// with nondeterministic functions must not be run with it. 0 means disabled
+DECLARE_String(fragment_cache_limit);
+// the results of a tablet larger than these are not kept in the fragment cache
+DECLARE_mInt64(fragment_cache_entry_max_bytes);
+DECLARE_mInt64(fragment_cache_entry_max_rows);
+// stale sweep time of the fragment cache
+DECLARE_mInt32(fragment_cache_stale_sweep_time_sec);
+
 // Maximum number of version of a tablet. If the version num of a tablet exceed limit,
 // the load process will reject new incoming load job of this tablet.
 // This is to avoid too many version num.
@@ -819,6 +975,10 @@ DECLARE_mInt32(remote_storage_read_buffer_mb);
 // Decreasing this value will increase the frequency of consume/release.
 // Increasing this value will cause MemTracker statistics to be inaccurate.
 DECLARE_mInt32(mem_tracker_consume_min_size_bytes);
+// If greater than mem_tracker_consume_min_size_bytes, a thread accumulates up to this size
+// before consuming the mem trackers while its query and the process are far from their
+// limits, and goes back to mem_tracker_consume_min_size_bytes near the limits.
+DECLARE_mInt32(mem_tracker_consume_max_size_bytes);
 
 // The version information of the tablet will be stored in the memory
 // in an adjacency graph data structure.
@@ -847,6 +1007,9 @@ DECLARE_Int32(load_stream_eagain_wait_seconds);
 DECLARE_Int32(load_stream_flush_token_max_tasks);
 // max wait flush token time in load stream
 DECLARE_Int32(load_stream_max_wait_flush_token_time_ms);
+// max bytes of a tablet waiting to be flushed in load stream, the stream stops taking data of
+// the tablet beyond it, which holds back the brpc stream window of the sender. 0 means no limit
+DECLARE_mInt64(load_stream_max_pending_flush_bytes_per_tablet);
 
 // max send batch parallelism for OlapTableSink
 // The value set by the user for send_batch_parallelism is not allowed to exceed max_send_batch_parallelism_per_job,
@@ -942,12 +1105,25 @@ DECLARE_mInt32(parquet_header_max_size_mb);
 DECLARE_mInt32(parquet_rowgroup_max_buffer_mb);
 // Max buffer size for parquet chunk column
 DECLARE_mInt32(parquet_column_max_buffer_mb);
+// Read the dictionary pages of the predicate columns first to prune a row group, before the
+// data pages of the row group are read
+DECLARE_mBool(enable_parquet_dict_filter_row_group);
+// Read the bloom filters of the columns with "=" or "in" predicates to prune row groups
+DECLARE_mBool(enable_parquet_bloom_filter);
+// Encode and compress the columns of a row group in parallel when writing parquet files
+DECLARE_mBool(enable_parquet_writer_parallel_encode);
+// The data size of the blocks buffered in a row group before the parquet writer starts a new one
+DECLARE_mInt64(parquet_writer_row_group_bytes);
 // Merge small IO, the max amplified read ratio
 DECLARE_mDouble(max_amplified_read_ratio);
 // Equivalent min size of each IO that can reach the maximum storage speed limit
 // 1MB for oss, 8KB for hdfs
 DECLARE_mInt32(merged_oss_min_io_size);
 DECLARE_mInt32(merged_hdfs_min_io_size);
+// Merge the gap between two small IOs only if reading it takes less time than the latency of the
+// IO saved, by the latency and bandwidth learned from the reads of each kind of storage,
+// instead of max_amplified_read_ratio
+DECLARE_mBool(enable_merged_io_cost_model);
 
 // OrcReader
 DECLARE_mInt32(orc_natural_read_size_mb);
@@ -957,6 +1133,9 @@ DECLARE_mInt64(small_column_size_buffer);
 // When the rows number reached this limit, will check the filter rate the of bloomfilter
 // if it is lower than a specific threshold, the predicate will be disabled.
 DECLARE_mInt32(rf_predicate_check_row_num);
+// Estimate the distinct count of the build keys of a hash join by a HLL sketch, to choose
+// between the in and the bloom filter and to size the bloom filter by it instead of the rows.
+DECLARE_mBool(enable_runtime_filter_build_ndv);
 
 // cooldown task configs
 DECLARE_Int32(cooldown_thread_num);
@@ -972,6 +1151,15 @@ DECLARE_Bool(enable_time_lut);
 DECLARE_mBool(enable_simdjson_reader);
 
 DECLARE_mBool(enable_query_like_bloom_filter);
+// Whether compaction builds page bloom filters for the columns which are not declared as bloom
+// filter columns, but are often in the equality or IN predicates of the recent queries.
+DECLARE_mBool(enable_auto_bloom_filter);
+// The number of scans of a tablet with an equality or IN predicate on a column in the recent
+// auto_bloom_filter_window_sec, for compaction to build bloom filters for the column.
+DECLARE_mInt32(auto_bloom_filter_min_scan_count);
+DECLARE_mInt64(auto_bloom_filter_window_sec);
+// The max number of columns of a tablet with automatic bloom filters, which caps their space.
+DECLARE_mInt32(auto_bloom_filter_max_columns);
 // number of s3 scanner thread pool size
 DECLARE_Int32(doris_remote_scanner_thread_pool_thread_num);
 // number of s3 scanner thread pool queue size
@@ -1027,6 +1215,79 @@ DECLARE_Bool(enable_fuzzy_mode);
 DECLARE_Bool(enable_debug_points);
 
 DECLARE_Int32(pipeline_executor_size);
+// If true, pipeline executors are grouped by NUMA node: each executor thread is bound to the
+// cpus of its node, and tasks are stolen from executors of the same node first.
+DECLARE_Bool(enable_pipeline_task_numa_aware);
+// How many successive rounds an executor fails to find a task on its own NUMA node before it
+// is allowed to steal tasks from executors of other nodes.
+DECLARE_mInt32(pipeline_task_numa_remote_steal_threshold);
+// The task queue of pipeline executors:
+// priority: per-core multilevel feedback queues protected by a mutex.
+// work_stealing: per-core lock free work stealing deques with the same multilevel feedback.
+DECLARE_String(pipeline_task_queue_type);
+// If true, the priority task queue of an executor picks the tasks of the workload groups by
+// their cpu time divided by their cpu share, so the groups sharing a scheduler get cpu in
+// proportion to their shares without cgroup quotas.
+DECLARE_Bool(enable_workload_group_fair_queue);
+// If true, the run slice, queue wait and blocked time of pipeline tasks are recorded into
+// per operator histograms, which are shown by http api/pipeline/latency_stats.
+DECLARE_mBool(enable_pipeline_task_latency_stats);
+// If true, the tasks woken up by one dependency are pushed into the task queue together,
+// which visits the queue of every target core once and spreads the tasks over the cores.
+DECLARE_mBool(enable_pipeline_batch_wake_up);
+// If true, the cpu cycles, instructions, last level cache misses and branch misses of every
+// execution of a pipeline task are read from the perf events of the executor thread, and
+// added to the profile of the task. The events need a PMU and a perf_event_paranoid of at
+// most 2, the tasks go without them otherwise.
+DECLARE_mBool(enable_pipeline_task_perf_counters);
+// If true, the storage reads of every query are logged when the query context is destroyed:
+// the bytes of the pages requested by the segment iterators, and the bytes served by the page
+// cache, the file cache, the local disks and the remote storage, plus the rows pruned by each
+// index, see StorageReadStatistics.
+DECLARE_mBool(enable_query_storage_read_log);
+
+// If true, the hash table of an inner hash join with a big build side is radix partitioned:
+// the rows are clustered by the high bits of their bucket numbers into sub-tables of about
+// hash_join_radix_sub_table_bytes, and the rows of every probe block are visited partition by
+// partition, so the probe hits the cache instead of random DRAM accesses.
+DECLARE_mBool(enable_hash_join_radix_partition);
+// The build side needs at least so many rows to be radix partitioned.
+DECLARE_mInt64(hash_join_radix_partition_min_build_rows);
+// The expected size of a radix partitioned sub-table, which should fit into the L2 cache.
+DECLARE_mInt64(hash_join_radix_sub_table_bytes);
+// If true, the probe of a big hash join prefetches the bucket heads and the chains of the
+// following probe rows, to overlap the cache misses of the rows.
+DECLARE_mBool(enable_hash_join_probe_prefetch);
+// If true, a big join hash table keeps a few bits of the hashes of the rows in every bucket,
+// so that most probe rows that match no row are rejected without visiting the bucket chain.
+DECLARE_mBool(enable_hash_join_bucket_tags);
+// If true, the instances waiting for a shared broadcast hash table of at least
+// share_hash_table_cooperative_build_min_rows rows insert its rows together with the builder.
+DECLARE_mBool(enable_share_hash_table_cooperative_build);
+DECLARE_mInt64(share_hash_table_cooperative_build_min_rows);
+// The rows of a block of the build side of a nested loop join with range join conjuncts, like
+// `a.x < b.y`. The build rows are sorted by such a column and cut into blocks of these rows, so
+// that the blocks none of whose rows can match a probe row are skipped. 0 to keep the blocks.
+DECLARE_mInt32(nested_loop_join_band_block_rows);
+// The max number of keys in the range of the single integer group by keys that are
+// aggregated in an array indexed by the key instead of a hash table, 0 to always hash them.
+DECLARE_mInt64(agg_dense_hash_map_max_range);
+// Whether the merge of sorted blocks compares the rows by their leading sort columns encoded
+// into an integer key once per block, before comparing the columns one by one.
+DECLARE_mBool(enable_merge_sort_normalized_key);
+// The analytic operator aggregates the sliding ROWS frames of min/max/sum/count/avg, which are at
+// least this many rows wide or start from unbounded preceding, by a segment tree of the
+// aggregation states instead of the rows of each frame. 0 to disable.
+DECLARE_mInt32(analytic_segment_tree_min_frame_rows);
+// The streaming pre-aggregations estimate the distinct keys of the first rows of their input,
+// 0 to only use the reduction of their hash tables. They pass the rows through if at least
+// preagg_passthrough_min_ndv_ratio of the sampled keys are distinct, and keep aggregating them
+// even past the reduction thresholds if at most preagg_full_agg_max_ndv_ratio are.
+DECLARE_mInt64(preagg_ndv_sample_rows);
+// The rows after which the keys are sampled again, 0 to decide once.
+DECLARE_mInt64(preagg_ndv_reevaluate_rows);
+DECLARE_mDouble(preagg_passthrough_min_ndv_ratio);
+DECLARE_mDouble(preagg_full_agg_max_ndv_ratio);
 
 // Temp config. True to use optimization for bitmap_index apply predicate except leaf node of the and node.
 // Will remove after fully test.
@@ -1043,6 +1304,26 @@ DECLARE_Bool(clear_file_cache);
 DECLARE_Bool(enable_file_cache_query_limit);
 DECLARE_Int32(file_cache_enter_disk_resource_limit_mode_percent);
 DECLARE_Int32(file_cache_exit_disk_resource_limit_mode_percent);
+// number of shards of each file cache path. every shard is an independent cache with its own lock
+// and lru queues over 1/n of the capacity, and the blocks of a file always go to the same shard.
+// changing it drops the blocks cached under the previous value
+DECLARE_Int32(file_cache_shard_num);
+// remove the files of evicted file cache blocks in background. the eviction under the cache lock
+// only renames the file, so that unlinking it does not block the readers of the cache
+DECLARE_mBool(enable_file_cache_async_remove);
+// memory limit of the memory tier of file cache, the downloaded blocks read more than
+// file_block_mem_cache_promote_reads times are kept in it. 0 means disabled
+DECLARE_String(file_block_mem_cache_limit);
+// times a downloaded file cache block is read from disk before it is copied to the memory tier
+DECLARE_mInt32(file_block_mem_cache_promote_reads);
+// stale sweep time of the memory tier of file cache
+DECLARE_mInt32(file_block_mem_cache_stale_sweep_time_sec);
+// times a file cache block read again after it entered its queue is passed over by the lru
+// eviction of the queue before the blocks read only once. 0 means plain lru
+DECLARE_mInt32(file_cache_max_evict_second_chances);
+// interval of persisting the blocks meta of each file cache. at start, the cache loads the last
+// snapshot at once and verifies it by scanning the blocks in background. 0 means disabled
+DECLARE_mInt64(file_cache_meta_snapshot_interval_sec);
 DECLARE_mBool(enable_read_cache_file_directly);
 DECLARE_Bool(file_cache_enable_evict_from_other_queue_by_size);
 DECLARE_mInt64(file_cache_ttl_valid_check_interval_second);
@@ -1052,6 +1333,8 @@ DECLARE_mInt64(file_cache_ttl_valid_check_interval_second);
 DECLARE_mInt32(index_cache_entry_stay_time_after_lookup_s);
 // cache entry that have not been visited for a certain period of time can be cleaned up by GC thread
 DECLARE_mInt32(inverted_index_cache_stale_sweep_time_sec);
+// see data_page_cache_protected_ratio, for the inverted index searcher and query cache
+DECLARE_Double(inverted_index_cache_protected_ratio);
 // inverted index searcher cache size
 DECLARE_String(inverted_index_searcher_cache_limit);
 // set `true` to enable insert searcher into cache when write inverted index data
@@ -1062,6 +1345,14 @@ DECLARE_Int32(inverted_index_query_cache_shards);
 
 // inverted index match bitmap cache size
 DECLARE_String(inverted_index_query_cache_limit);
+// the result of an inverted index query is cached only after its cache key has missed this
+// many times recently, so that one-off queries don't evict the results of repeated ones.
+// 0 or 1 caches every result
+DECLARE_mInt32(inverted_index_query_cache_admission_min_misses);
+// a bkd index query only collects the rows still kept by the earlier predicates of the segment
+// if they are at most this percent of the segment rows, instead of building the full result.
+// the filtered result is not cached. 0 disables it
+DECLARE_mInt32(inverted_index_bkd_row_filter_max_percent);
 
 // inverted index
 DECLARE_mDouble(inverted_index_ram_buffer_size);
@@ -1077,6 +1368,9 @@ DECLARE_mBool(inverted_index_compaction_enable);
 DECLARE_mBool(debug_inverted_index_compaction);
 // index by RAM directory
 DECLARE_mBool(inverted_index_ram_dir_enable);
+// The segments of a rowset built concurrently by an index build, each by a thread with the
+// index writers of its own
+DECLARE_mInt32(inverted_index_build_segment_parallelism);
 // use num_broadcast_buffer blocks as buffer to do broadcast
 DECLARE_Int32(num_broadcast_buffer);
 
@@ -1094,6 +1388,11 @@ DECLARE_mInt32(tablet_path_check_batch_size);
 DECLARE_mInt64(row_column_page_size);
 // it must be larger than or equal to 5MB
 DECLARE_mInt64(s3_write_buffer_size);
+// the part size of s3 file writer doubles every this number of parts, so that big files do not
+// exceed the 10000 parts limit of s3. 0 means the part size is always s3_write_buffer_size
+DECLARE_mInt64(s3_write_part_size_grow_interval);
+// the max part size the part size of s3 file writer grows to
+DECLARE_mInt64(s3_write_max_part_size);
 // Log interval when doing s3 upload task
 DECLARE_mInt32(s3_file_writer_log_interval_second);
 // the max number of cached file handle for block segemnt
@@ -1110,6 +1409,8 @@ DECLARE_mInt32(segment_cache_capacity);
 DECLARE_mInt32(estimated_num_columns_per_segment);
 DECLARE_mInt32(estimated_mem_per_column_reader);
 DECLARE_Int32(segment_cache_memory_percentage);
+// see data_page_cache_protected_ratio
+DECLARE_Double(segment_cache_protected_ratio);
 
 // enable binlog
 DECLARE_Bool(enable_feature_binlog);
@@ -1120,9 +1421,20 @@ DECLARE_Bool(enable_set_in_bitmap_value);
 // max number of hdfs file handle in cache
 DECLARE_Int64(max_hdfs_file_handle_cache_num);
 DECLARE_Int32(max_hdfs_file_handle_cache_time_sec);
+// number of threads for hedged read of each hdfs client, the reader reads another replica if the
+// current one does not return within hdfs_hedged_read_threshold_time_ms. 0 means disabled
+DECLARE_Int32(hdfs_hedged_read_thread_num);
+// 0 means the p95 latency of the hdfs reads of this BE when the hdfs client is created
+DECLARE_Int32(hdfs_hedged_read_threshold_time_ms);
+// domain socket path of the DataNode co-located with BE, which enables short-circuit read.
+// empty means disabled
+DECLARE_String(hdfs_short_circuit_domain_socket_path);
 
 // max number of meta info of external files, such as parquet footer
 DECLARE_Int64(max_external_file_meta_cache_num);
+// max memory size of the meta info of external files. If it is > 0, the cache is limited by
+// memory size instead of max_external_file_meta_cache_num, and is used for any number of files
+DECLARE_Int64(max_external_file_meta_cache_bytes);
 // Apply delete pred in cumu compaction
 DECLARE_mBool(enable_delete_when_cumu_compaction);
 
@@ -1170,6 +1482,10 @@ DECLARE_mDouble(variant_ratio_of_defaults_as_sparse_column);
 // Threshold to estimate a column is sparsed
 // Notice: TEST ONLY
 DECLARE_mInt64(variant_threshold_rows_to_estimate_sparse_column);
+// Max number of the subcolumns of a variant column materialized in a segment, the subcolumns
+// with the most default values beyond it are stored as sparse columns in the root column.
+// 0 means no limit.
+DECLARE_mInt32(variant_max_subcolumns_count);
 
 DECLARE_mBool(enable_merge_on_write_correctness_check);
 // rowid conversion correctness check when compaction for mow table
@@ -1213,6 +1529,19 @@ DECLARE_mInt32(group_commit_queue_mem_limit);
 // group_commit_wal_max_disk_limit=1024 or group_commit_wal_max_disk_limit=10% can be automatically identified.
 DECLARE_mString(group_commit_wal_max_disk_limit);
 DECLARE_Bool(group_commit_wait_replay_wal_finish);
+// Make the blocks appended to a wal durable before acknowledging the load. The syncs of the wal
+// files in one wal dir are grouped, a group waits group_commit_wal_sync_window_us for more files.
+DECLARE_mBool(enable_wal_group_sync);
+DECLARE_mInt32(group_commit_wal_sync_window_us);
+// Size the commit interval of a group commit table by its arrival rate, so that a commit holds
+// about group_commit_adaptive_target_bytes (at most the group_commit_data_bytes of the table)
+// within [group_commit_adaptive_min_interval_ms, group_commit_interval_ms of the table]. The full
+// group_commit_interval_ms is used while the version count of a tablet written by the table
+// exceeds group_commit_adaptive_version_ratio of max_tablet_version_num.
+DECLARE_mBool(enable_group_commit_adaptive_interval);
+DECLARE_mInt64(group_commit_adaptive_target_bytes);
+DECLARE_mInt32(group_commit_adaptive_min_interval_ms);
+DECLARE_mDouble(group_commit_adaptive_version_ratio);
 
 // The configuration item is used to lower the priority of the scanner thread,
 // typically employed to ensure CPU scheduling for write operations.
@@ -1262,10 +1591,21 @@ DECLARE_mInt64(enable_debug_log_timeout_secs);
 
 DECLARE_mBool(enable_column_type_check);
 
+// Whether to execute the identical subtrees of the projections of an operator only once per
+// block, e.g. substr(url, 1, 10) projected alone and inside another expr.
+DECLARE_mBool(enable_projection_common_expr_elimination);
+// Whether to execute the WHENs of CASE on the rows not matched by the previous WHENs, and the
+// THENs and ELSE on the rows selecting them, if some of them are more expensive than selecting
+// their results row by row.
+DECLARE_mBool(enable_case_when_short_circuit);
+
 // Tolerance for the number of partition id 0 in rowset, default 0
 DECLARE_Int32(ignore_invalid_partition_id_rowset_num);
 
 DECLARE_mInt32(report_query_statistics_interval_ms);
+// The interval to sample the memory of an operator into the "MemoryTimeline" of its profile,
+// which is doubled when the timeline gets long. Non-positive to disable the timeline.
+DECLARE_mInt32(operator_mem_timeline_interval_ms);
 DECLARE_mInt32(query_statistics_reserve_timeout_ms);
 DECLARE_mInt32(report_exec_status_thread_num);
 
@@ -1287,6 +1627,29 @@ DECLARE_mInt32(spill_gc_interval_ms);
 DECLARE_mInt32(spill_gc_work_time_ms);
 DECLARE_Int32(spill_io_thread_pool_thread_num);
 DECLARE_Int32(spill_io_thread_pool_queue_size);
+// The max bytes of the serialized blocks of a spill stream which are appended to its file in the
+// spill io thread pool while the next blocks are serialized. 0 appends them synchronously.
+DECLARE_mInt64(spill_write_max_in_flight_bytes);
+// A spilled hash join partition whose build rows take more bytes than this is split into
+// sub partitions by other bits of the hash values before it is joined.
+DECLARE_mInt64(spill_hash_join_partition_max_bytes);
+// The max times a spilled hash join partition can be split again.
+DECLARE_mInt32(spill_hash_join_max_repartition_depth);
+// A sub partition holding at least this percent of the build rows of the split partition is
+// made of a few heavy keys. It is not split again, but joined in several passes over the
+// probe rows if the join type allows.
+DECLARE_mInt32(spill_hash_join_heavy_hitter_percent);
+// A spilled aggregation partition whose hash table takes more bytes than this while it is
+// merged is spilled again into partitions of the next level.
+DECLARE_mInt64(spill_aggregation_partition_max_bytes);
+// Read the next blocks of the spilled sort runs ahead in the spill io thread pool while
+// they are merged.
+DECLARE_mBool(enable_spill_sort_merge_prefetch);
+// The max spilled sort runs on each hdd merged at a time, if all the runs are on hdds.
+DECLARE_mInt32(spill_sort_merge_max_fan_in_per_hdd);
+// For the queries that enable spill, the blocks of a cte kept in memory for its slower
+// consumers are spilled once they take more than this number of bytes. 0 disables it.
+DECLARE_mInt64(multi_cast_data_streamer_max_buffer_bytes);
 
 DECLARE_mBool(check_segment_when_build_rowset_meta);
 
@@ -1312,6 +1675,9 @@ DECLARE_mInt64(table_sink_partition_write_min_data_processed_rebalance_threshold
 DECLARE_mInt64(table_sink_partition_write_min_partition_data_processed_rebalance_threshold);
 // Maximum processed partition nums of per writer when partition writing
 DECLARE_mInt32(table_sink_partition_write_max_partition_nums_per_writer);
+// Spill the rows of the partitions beyond the maximum open partitions of a writer and write
+// them partition by partition at close, instead of failing the partition writing
+DECLARE_mBool(enable_table_sink_partition_spill);
 
 /** Hive sink configurations **/
 DECLARE_mInt64(hive_sink_max_file_size);
@@ -1342,6 +1708,38 @@ DECLARE_Int64(num_buffered_reader_prefetch_thread_pool_max_thread);
 DECLARE_Int64(num_s3_file_upload_thread_pool_min_thread);
 // The max thread num for S3FileUploadThreadPool
 DECLARE_Int64(num_s3_file_upload_thread_pool_max_thread);
+// The min thread num for S3FileReadThreadPool
+DECLARE_Int64(num_s3_file_read_thread_pool_min_thread);
+// The max thread num for S3FileReadThreadPool
+DECLARE_Int64(num_s3_file_read_thread_pool_max_thread);
+// The reads of s3 file reader not smaller than twice of it are split into ranged GETs of this size
+// sent concurrently. 0 means disabled
+DECLARE_mInt64(s3_parallel_read_part_size);
+// Send a duplicate GET for the reads of s3 file reader not larger than s3_hedged_read_max_bytes,
+// if the first one does not return within the p95 latency of GETs
+DECLARE_mBool(enable_s3_hedged_read);
+DECLARE_mInt64(s3_hedged_read_max_bytes);
+// The min delay before the duplicate GET of a hedged read is sent
+DECLARE_mInt32(s3_hedged_read_min_delay_ms);
+// The bytes and the requests per second the queries read from s3 on a BE, shared by the
+// workload groups in proportion to their cpu shares. A group out of its share borrows the
+// budget the other groups leave idle. 0 means not limited
+DECLARE_mInt64(remote_read_bytes_per_second);
+DECLARE_mInt64(remote_read_requests_per_second);
+// The thread num for SegmentEncodeThreadPool. If it is not 0, the columns of a wide segment
+// written at flush are converted, encoded and compressed in parallel on it, and the pages are
+// still written to the file in column order
+DECLARE_Int32(segment_encode_thread_num);
+// The min columns of a segment to encode them in parallel
+DECLARE_mInt32(segment_parallel_encode_min_columns);
+// Whether to choose the encoding of each column of a segment by encoding a sample of its first
+// rows with every encoding the type supports, instead of the fixed default encoding of the type
+DECLARE_mBool(enable_column_encoding_sampling);
+// The max rows sampled from the first rows of a column to choose its encoding
+DECLARE_mInt32(column_encoding_sample_rows);
+// The encodings whose sampled size is within this percent of the smallest one are thought to be
+// as compact, and the one of them which decodes fastest is chosen
+DECLARE_mInt32(column_encoding_size_tolerance_percent);
 // The max ratio for ttl cache's size
 DECLARE_mInt64(max_ttl_cache_ratio);
 // The maximum jvm heap usage ratio for hdfs write workload
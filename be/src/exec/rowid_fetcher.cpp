@@ -29,10 +29,13 @@
 #include <stdint.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <map>
 #include <memory>
 #include <ostream>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -59,6 +62,7 @@
 #include "runtime/types.h"
 #include "util/brpc_client_cache.h" // BrpcClientCache
 #include "util/defer_op.h"
+#include "util/threadpool.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/column_string.h"
@@ -293,41 +297,75 @@ auto scope_timer_run(Func fn, int64_t* cost) -> decltype(fn()) {
     return res;
 }
 
-struct IteratorKey {
-    int64_t tablet_id;
-    RowsetId rowset_id;
-    uint64_t segment_id;
-    int slot_id;
-
-    // unordered map std::equal_to
-    bool operator==(const IteratorKey& rhs) const {
-        return tablet_id == rhs.tablet_id && rowset_id == rhs.rowset_id &&
-               segment_id == rhs.segment_id && slot_id == rhs.slot_id;
-    }
+// The row locations of a multiget request in one segment, and the rows read for them.
+struct SegmentRowLocs {
+    BaseTabletSPtr tablet;
+    BetaRowsetSharedPtr rowset;
+    segment_v2::SegmentSharedPtr segment;
+    // sorted by the ordinal id, so the rows in the same page are read together
+    std::vector<const PRowLocation*> row_locs;
+    // the rows of the column store
+    vectorized::Block block;
+    // the rows of the row store
+    std::vector<std::string> binary_rows;
+    OlapReaderStatistics stats;
+    int64_t lookup_row_data_ms = 0;
 };
 
-struct HashOfIteratorKey {
-    size_t operator()(const IteratorKey& key) const {
-        size_t seed = 0;
-        seed = HashUtil::hash64(&key.tablet_id, sizeof(key.tablet_id), seed);
-        seed = HashUtil::hash64(&key.rowset_id.hi, sizeof(key.rowset_id.hi), seed);
-        seed = HashUtil::hash64(&key.rowset_id.mi, sizeof(key.rowset_id.mi), seed);
-        seed = HashUtil::hash64(&key.rowset_id.lo, sizeof(key.rowset_id.lo), seed);
-        seed = HashUtil::hash64(&key.segment_id, sizeof(key.segment_id), seed);
-        seed = HashUtil::hash64(&key.slot_id, sizeof(key.slot_id), seed);
-        return seed;
+static Status read_segment_rows(const PMultiGetRequest& request, const TupleDescriptor& desc,
+                                const TabletSchema& full_read_schema, SegmentRowLocs* seg) {
+    const auto& row_locs = seg->row_locs;
+    // fetch by row store, more effcient way
+    if (request.fetch_row_store()) {
+        CHECK(seg->tablet->tablet_schema()->store_row_column());
+        seg->binary_rows.resize(row_locs.size());
+        for (size_t i = 0; i < row_locs.size(); ++i) {
+            RowLocation loc(seg->rowset->rowset_id(), seg->segment->id(),
+                            row_locs[i]->ordinal_id());
+            RETURN_IF_ERROR(scope_timer_run(
+                    [&]() {
+                        return seg->tablet->lookup_row_data({}, loc, seg->rowset, &desc,
+                                                            seg->stats, seg->binary_rows[i]);
+                    },
+                    &seg->lookup_row_data_ms));
+        }
+        return Status::OK();
     }
-};
 
-struct IteratorItem {
-    std::unique_ptr<ColumnIterator> iterator;
-    // for holding the reference of segment to avoid use after release
-    SegmentSharedPtr segment;
-};
+    // fetch by column store, each column reads all the rows in one pass over its pages, the
+    // iterators require distinct row ids
+    std::vector<segment_v2::rowid_t> row_ids;
+    vectorized::IColumn::Permutation permutation;
+    row_ids.reserve(row_locs.size());
+    permutation.reserve(row_locs.size());
+    for (const auto* row_loc : row_locs) {
+        auto row_id = static_cast<segment_v2::rowid_t>(row_loc->ordinal_id());
+        if (row_ids.empty() || row_ids.back() != row_id) {
+            row_ids.push_back(row_id);
+        }
+        permutation.push_back(row_ids.size() - 1);
+    }
+    seg->block = vectorized::Block(desc.slots(), row_ids.size());
+    for (int x = 0; x < desc.slots().size(); ++x) {
+        vectorized::MutableColumnPtr column =
+                seg->block.get_by_position(x).column->assume_mutable();
+        std::unique_ptr<segment_v2::ColumnIterator> iterator;
+        RETURN_IF_ERROR(seg->segment->seek_and_read_by_rowids(full_read_schema, desc.slots()[x],
+                                                              row_ids.data(), row_ids.size(),
+                                                              column, seg->stats, iterator));
+    }
+    // a row requested more than once
+    if (row_ids.size() < row_locs.size()) {
+        for (auto& column : seg->block) {
+            column.column = column.column->permute(permutation, permutation.size());
+        }
+    }
+    return Status::OK();
+}
 
 Status RowIdStorageReader::read_by_rowids(const PMultiGetRequest& request,
                                           PMultiGetResponse* response) {
-    // read from storage engine row id by row id
+    // read from storage engine segment by segment
     OlapReaderStatistics stats;
     vectorized::Block result_block;
     int64_t acquire_tablet_ms = 0;
@@ -350,100 +388,125 @@ Status RowIdStorageReader::read_by_rowids(const PMultiGetRequest& request,
         full_read_schema.append_column(TabletColumn(column_pb));
     }
 
-    std::unordered_map<IteratorKey, IteratorItem, HashOfIteratorKey> iterator_map;
-    // read row by row
+    // group the row locations by segment, the rows of a missing segment are skipped
+    std::map<std::tuple<int64_t, std::string, uint64_t>, SegmentRowLocs> segment_row_locs;
     for (size_t i = 0; i < request.row_locs_size(); ++i) {
         const auto& row_loc = request.row_locs(i);
-        MonotonicStopWatch watch;
-        watch.start();
-        BaseTabletSPtr tablet = scope_timer_run(
+        auto [it, inserted] = segment_row_locs.try_emplace(
+                {row_loc.tablet_id(), row_loc.rowset_id(), row_loc.segment_id()});
+        SegmentRowLocs& seg = it->second;
+        if (!inserted) {
+            if (seg.segment != nullptr) {
+                seg.row_locs.push_back(&row_loc);
+            }
+            continue;
+        }
+        seg.tablet = scope_timer_run(
                 [&]() {
                     auto res = ExecEnv::get_tablet(row_loc.tablet_id());
                     return !res.has_value() ? nullptr
                                             : std::dynamic_pointer_cast<BaseTablet>(res.value());
                 },
                 &acquire_tablet_ms);
-        RowsetId rowset_id;
-        rowset_id.init(row_loc.rowset_id());
-        if (!tablet) {
+        if (!seg.tablet) {
             continue;
         }
+        RowsetId rowset_id;
+        rowset_id.init(row_loc.rowset_id());
         // We ensured it's rowset is not released when init Tablet reader param, rowset->update_delayed_expired_timestamp();
-        BetaRowsetSharedPtr rowset = std::static_pointer_cast<BetaRowset>(scope_timer_run(
+        seg.rowset = std::static_pointer_cast<BetaRowset>(scope_timer_run(
                 [&]() {
                     return ExecEnv::GetInstance()->storage_engine().get_quering_rowset(rowset_id);
                 },
                 &acquire_rowsets_ms));
-        if (!rowset) {
+        if (!seg.rowset) {
             LOG(INFO) << "no such rowset " << rowset_id;
             continue;
         }
-        size_t row_size = 0;
-        Defer _defer([&]() {
-            LOG_EVERY_N(INFO, 100)
-                    << "multiget_data single_row, cost(us):" << watch.elapsed_time() / 1000
-                    << ", row_size:" << row_size;
-            *response->add_row_locs() = row_loc;
-        });
         SegmentCacheHandle segment_cache;
         RETURN_IF_ERROR(scope_timer_run(
                 [&]() {
-                    return SegmentLoader::instance()->load_segments(rowset, &segment_cache, true);
+                    return SegmentLoader::instance()->load_segments(seg.rowset, &segment_cache,
+                                                                    true);
                 },
                 &acquire_segments_ms));
         // find segment
-        auto it = std::find_if(segment_cache.get_segments().cbegin(),
-                               segment_cache.get_segments().cend(),
-                               [&row_loc](const segment_v2::SegmentSharedPtr& seg) {
-                                   return seg->id() == row_loc.segment_id();
-                               });
-        if (it == segment_cache.get_segments().end()) {
+        auto seg_it = std::find_if(segment_cache.get_segments().cbegin(),
+                                   segment_cache.get_segments().cend(),
+                                   [&row_loc](const segment_v2::SegmentSharedPtr& segment) {
+                                       return segment->id() == row_loc.segment_id();
+                                   });
+        if (seg_it == segment_cache.get_segments().end()) {
             continue;
         }
-        segment_v2::SegmentSharedPtr segment = *it;
-        GlobalRowLoacation row_location(row_loc.tablet_id(), rowset->rowset_id(),
-                                        row_loc.segment_id(), row_loc.ordinal_id());
-        // fetch by row store, more effcient way
-        if (request.fetch_row_store()) {
-            CHECK(tablet->tablet_schema()->store_row_column());
-            RowLocation loc(rowset_id, segment->id(), row_loc.ordinal_id());
-            string* value = response->add_binary_row_data();
-            RETURN_IF_ERROR(scope_timer_run(
-                    [&]() {
-                        return tablet->lookup_row_data({}, loc, rowset, &desc, stats, *value);
-                    },
-                    &lookup_row_data_ms));
-            row_size = value->size();
+        // hold the reference of segment to avoid use after release
+        seg.segment = *seg_it;
+        seg.row_locs.push_back(&row_loc);
+    }
+    std::vector<SegmentRowLocs*> segments;
+    for (auto& [_, seg] : segment_row_locs) {
+        if (seg.segment == nullptr) {
             continue;
         }
+        std::stable_sort(seg.row_locs.begin(), seg.row_locs.end(),
+                         [](const PRowLocation* lhs, const PRowLocation* rhs) {
+                             return lhs->ordinal_id() < rhs->ordinal_id();
+                         });
+        segments.push_back(&seg);
+    }
 
-        // fetch by column store
-        if (result_block.is_empty_column()) {
-            result_block = vectorized::Block(desc.slots(), request.row_locs().size());
+    // read the segments in parallel, the caller restores the order of the rows by row_locs
+    ThreadPool* pool = config::is_cloud_mode() ? nullptr
+                                               : ExecEnv::GetInstance()
+                                                         ->storage_engine()
+                                                         .to_local()
+                                                         .get_bg_multiget_threadpool();
+    size_t parallelism = std::min<size_t>(std::max(config::multi_get_max_parallel_segments, 1),
+                                          segments.size());
+    std::atomic<size_t> next_segment = 0;
+    std::atomic<bool> failed = false;
+    std::vector<Status> statuses(segments.size());
+    if (!segments.empty()) {
+        run_tasks_with_caller(pool, parallelism, [&](size_t) {
+            while (!failed) {
+                size_t idx = next_segment++;
+                if (idx >= segments.size()) {
+                    break;
+                }
+                statuses[idx] = read_segment_rows(request, desc, full_read_schema, segments[idx]);
+                if (!statuses[idx].ok()) {
+                    failed = true;
+                }
+            }
+        });
+    }
+    for (auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+
+    for (SegmentRowLocs* seg : segments) {
+        for (const PRowLocation* row_loc : seg->row_locs) {
+            *response->add_row_locs() = *row_loc;
         }
-        VLOG_DEBUG << "Read row location "
-                   << fmt::format("{}, {}, {}, {}", row_location.tablet_id,
-                                  row_location.row_location.rowset_id.to_string(),
-                                  row_location.row_location.segment_id,
-                                  row_location.row_location.row_id);
-        for (int x = 0; x < desc.slots().size(); ++x) {
-            auto row_id = static_cast<segment_v2::rowid_t>(row_loc.ordinal_id());
-            vectorized::MutableColumnPtr column =
-                    result_block.get_by_position(x).column->assume_mutable();
-            IteratorKey iterator_key {.tablet_id = tablet->tablet_id(),
-                                      .rowset_id = rowset_id,
-                                      .segment_id = row_loc.segment_id(),
-                                      .slot_id = desc.slots()[x]->id()};
-            IteratorItem& iterator_item = iterator_map[iterator_key];
-            if (iterator_item.segment == nullptr) {
-                // hold the reference
-                iterator_map[iterator_key].segment = segment;
+        if (request.fetch_row_store()) {
+            for (auto& row : seg->binary_rows) {
+                *response->add_binary_row_data() = std::move(row);
+            }
+        } else if (result_block.is_empty_column()) {
+            result_block.swap(seg->block);
+        } else {
+            for (int i = 0; i < result_block.columns(); ++i) {
+                result_block.get_by_position(i).column->assume_mutable()->insert_range_from(
+                        *seg->block.get_by_position(i).column, 0, seg->block.rows());
             }
-            segment = iterator_item.segment;
-            RETURN_IF_ERROR(segment->seek_and_read_by_rowid(full_read_schema, desc.slots()[x],
-                                                            row_id, column, stats,
-                                                            iterator_item.iterator));
         }
+        stats.cached_pages_num += seg->stats.cached_pages_num;
+        stats.total_pages_num += seg->stats.total_pages_num;
+        stats.compressed_bytes_read += seg->stats.compressed_bytes_read;
+        stats.io_ns += seg->stats.io_ns;
+        stats.uncompressed_bytes_read += seg->stats.uncompressed_bytes_read;
+        stats.bytes_read += seg->stats.bytes_read;
+        lookup_row_data_ms += seg->lookup_row_data_ms;
     }
     // serialize block if not empty
     if (!result_block.is_empty_column()) {
@@ -464,11 +527,11 @@ Status RowIdStorageReader::read_by_rowids(const PMultiGetRequest& request,
                          "uncompressed_bytes_read:{},"
                          "bytes_read:{},"
                          "acquire_tablet_ms:{}, acquire_rowsets_ms:{}, acquire_segments_ms:{}, "
-                         "lookup_row_data_ms:{}",
+                         "lookup_row_data_ms:{}, segments:{}, parallelism:{}",
                          stats.cached_pages_num, stats.total_pages_num, stats.compressed_bytes_read,
                          stats.io_ns, stats.uncompressed_bytes_read, stats.bytes_read,
                          acquire_tablet_ms, acquire_rowsets_ms, acquire_segments_ms,
-                         lookup_row_data_ms);
+                         lookup_row_data_ms, segments.size(), parallelism);
     return Status::OK();
 }
 
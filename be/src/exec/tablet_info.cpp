@@ -420,6 +420,37 @@ bool VOlapTablePartitionParam::_part_contains(VOlapTablePartition* part,
            || !comparator(key, std::tuple {part->start_key.first, part->start_key.second, false});
 }
 
+bool VOlapTablePartitionParam::_part_right_contains(VOlapTablePartition* part,
+                                                    BlockRowWithIndicator key) const {
+    VOlapTablePartKeyComparator comparator(_partition_slot_locs, _transformed_slot_locs);
+    return comparator(key, std::tuple {part->end_key.first, part->end_key.second, false});
+}
+
+void VOlapTablePartitionParam::find_partitions(
+        vectorized::Block* block, int rows, std::vector<VOlapTablePartition*>& partitions) const {
+    if (_is_in_partition) {
+        for (int row = 0; row < rows; ++row) {
+            find_partition(block, row, partitions[row]);
+        }
+        return;
+    }
+    // range partitions are disjoint, a row in [left, right) of the last found partition falls in
+    // the same partition as the map would return for it
+    VOlapTablePartition* last_partition = nullptr;
+    for (int row = 0; row < rows; ++row) {
+        if (last_partition != nullptr) {
+            BlockRowWithIndicator key {block, row, true};
+            if (_part_right_contains(last_partition, key) && _part_contains(last_partition, key)) {
+                partitions[row] = last_partition;
+                continue;
+            }
+        }
+        if (find_partition(block, row, partitions[row])) {
+            last_partition = partitions[row];
+        }
+    }
+}
+
 // insert value into _partition_block's column
 // NOLINTBEGIN(readability-function-size)
 static Status _create_partition_key(const TExprNode& t_expr, BlockRow* part_key, uint16_t pos) {
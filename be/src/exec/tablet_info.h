@@ -196,6 +196,12 @@ public:
         return (partition != nullptr);
     }
 
+    // same as find_partition for rows [0, rows) of the block. rows of a load are usually clustered
+    // by the partition key, so for range partitions the partition of the previous row is checked
+    // before searching the map.
+    void find_partitions(vectorized::Block* block, int rows,
+                         std::vector<VOlapTablePartition*>& partitions) const;
+
     ALWAYS_INLINE void find_tablets(
             vectorized::Block* block, const std::vector<uint32_t>& indexes,
             const std::vector<VOlapTablePartition*>& partitions,
@@ -204,23 +210,20 @@ public:
             std::map<VOlapTablePartition*, int64_t>* partition_tablets_buffer = nullptr) const {
         std::function<uint32_t(vectorized::Block*, uint32_t, const VOlapTablePartition&)>
                 compute_function;
+        std::vector<uint32_t> hash_vals;
         if (!_distributed_slot_locs.empty()) {
-            //TODO: refactor by saving the hash values. then we can calculate in columnwise.
-            compute_function = [this](vectorized::Block* block, uint32_t row,
-                                      const VOlapTablePartition& partition) -> uint32_t {
-                uint32_t hash_val = 0;
-                for (unsigned short _distributed_slot_loc : _distributed_slot_locs) {
-                    auto* slot_desc = _slots[_distributed_slot_loc];
-                    auto& column = block->get_by_position(_distributed_slot_loc).column;
-                    auto val = column->get_data_at(row);
-                    if (val.data != nullptr) {
-                        hash_val = RawValue::zlib_crc32(val.data, val.size, slot_desc->type().type,
-                                                        hash_val);
-                    } else {
-                        hash_val = HashUtil::zlib_crc_hash_null(hash_val);
-                    }
-                }
-                return hash_val % partition.num_buckets;
+            // the bucket hashes are computed column by column for the whole block, which is the
+            // same crc as computing them row by row with RawValue::zlib_crc32
+            hash_vals.resize(block->rows(), 0);
+            for (auto distributed_slot_loc : _distributed_slot_locs) {
+                auto* slot_desc = _slots[distributed_slot_loc];
+                block->get_by_position(distributed_slot_loc)
+                        .column->update_crcs_with_value(hash_vals.data(), slot_desc->type().type,
+                                                        block->rows());
+            }
+            compute_function = [&hash_vals](vectorized::Block* block, uint32_t row,
+                                            const VOlapTablePartition& partition) -> uint32_t {
+                return hash_vals[row] % partition.num_buckets;
             };
         } else { // random distribution
             compute_function = [](vectorized::Block* block, uint32_t row,
@@ -284,6 +287,8 @@ private:
 
     // check if this partition contain this key
     bool _part_contains(VOlapTablePartition* part, BlockRowWithIndicator key) const;
+    // check if key < part.right, so that with _part_contains the key is in the range of part
+    bool _part_right_contains(VOlapTablePartition* part, BlockRowWithIndicator key) const;
 
     // this partition only valid in this schema
     std::shared_ptr<OlapTableSchemaParam> _schema;
@@ -124,6 +124,11 @@ public:
         return false;
     }
 
+    // Finds the n hashes, results[i] is whether hashes[i] is found. The 16 lanes of an AVX-512
+    // register probe two hashes at a time if the cpu supports it.
+    void find_batch(const uint32_t* __restrict hashes, size_t n,
+                    uint8_t* __restrict results) const noexcept;
+
     // Computes the logical OR of this filter with 'other' and stores the result in this
     // filter.
     // Notes:
@@ -221,6 +226,12 @@ private:
     static void or_equal_array_avx2(size_t n, const uint8_t* __restrict__ in,
                                     uint8_t* __restrict__ out) __attribute__((target("avx2")));
 
+    // Finds the hashes two at a time with AVX-512 instructions, returns the number of the
+    // hashes found, which is n rounded down to an even number.
+    size_t find_batch_avx512(const uint32_t* __restrict hashes, size_t n,
+                             uint8_t* __restrict results) const noexcept
+            __attribute__((target("avx512f")));
+
 #endif
     // Size of the internal directory structure in bytes.
     size_t directory_size() const { return 1ULL << log_space_bytes(); }
@@ -60,5 +60,35 @@ void BlockBloomFilter::or_equal_array_avx2(size_t n, const uint8_t* __restrict__
                          _mm256_or_pd(_mm256_loadu_pd(double_out), _mm256_loadu_pd(double_in)));
     }
 }
+
+size_t BlockBloomFilter::find_batch_avx512(const uint32_t* __restrict hashes, size_t n,
+                                           uint8_t* __restrict results) const noexcept {
+    const __m512i ones = _mm512_set1_epi32(1);
+    const __m512i rehash = _mm512_setr_epi32(BLOOM_HASH_CONSTANTS, BLOOM_HASH_CONSTANTS);
+    const auto* directory = reinterpret_cast<const __m256i*>(_directory);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        // the lower 8 lanes probe the first hash and the upper 8 lanes the second one, like
+        // make_mark() and find() with 8 lanes
+        __m512i hash_data = _mm512_inserti64x4(_mm512_set1_epi32(hashes[i]),
+                                               _mm256_set1_epi32(hashes[i + 1]), 1);
+        hash_data = _mm512_srli_epi32(_mm512_mullo_epi32(rehash, hash_data), 27);
+        const __m512i mask = _mm512_sllv_epi32(ones, hash_data);
+        const __m256i bucket0 =
+                _mm256_load_si256(&directory[rehash32to32(hashes[i]) & _directory_mask]);
+        const __m256i bucket1 =
+                _mm256_load_si256(&directory[rehash32to32(hashes[i + 1]) & _directory_mask]);
+        const __m512i buckets =
+                _mm512_inserti64x4(_mm512_castsi256_si512(bucket0), bucket1, 1);
+        // a lane misses if 'mask' has a one where 'bucket' does not
+        const __m512i missing = _mm512_andnot_si512(buckets, mask);
+        const __mmask16 misses = _mm512_test_epi32_mask(missing, missing);
+        results[i] = (misses & 0xFF) == 0;
+        results[i + 1] = (misses >> 8) == 0;
+    }
+    _mm256_zeroupper();
+    return i;
+}
+
 } // namespace doris
 #endif
@@ -33,6 +33,7 @@
 
 #include "common/status.h"
 #include "exprs/block_bloom_filter.hpp"
+#include "util/cpu_info.h"
 // IWYU pragma: no_include <emmintrin.h>
 #include "util/sse_util.hpp"
 
@@ -148,6 +149,23 @@ bool BlockBloomFilter::bucket_find(const uint32_t bucket_idx, const uint32_t has
     return true;
 }
 
+void BlockBloomFilter::find_batch(const uint32_t* __restrict hashes, size_t n,
+                                  uint8_t* __restrict results) const noexcept {
+    if (_always_false) {
+        memset(results, 0, n);
+        return;
+    }
+    size_t i = 0;
+#ifdef __AVX2__
+    if (CpuInfo::is_supported(CpuInfo::AVX512F)) {
+        i = find_batch_avx512(hashes, n, results);
+    }
+#endif
+    for (; i < n; ++i) {
+        results[i] = find(hashes[i]);
+    }
+}
+
 void BlockBloomFilter::insert_no_avx2(const uint32_t hash) noexcept {
     _always_false = false;
     const uint32_t bucket_idx = rehash32to32(hash) & _directory_mask;
@@ -70,6 +70,20 @@ public:
         }
     }
 
+    // Same as test_element for each of the n fixed length elements.
+    template <typename T>
+    void test_elements(const T* __restrict elements, size_t n, uint8_t* __restrict results) const {
+        constexpr size_t BATCH_SIZE = 256;
+        uint32_t hashes[BATCH_SIZE];
+        for (size_t i = 0; i < n; i += BATCH_SIZE) {
+            size_t batch_size = std::min(BATCH_SIZE, n - i);
+            for (size_t j = 0; j < batch_size; ++j) {
+                hashes[j] = HashUtil::fixed_len_to_uint32(elements[i + j]);
+            }
+            _bloom_filter->find_batch(hashes, batch_size, results + i);
+        }
+    }
+
     template <typename T>
     void add_element(T element) {
         if constexpr (std::is_same_v<T, StringRef>) {
@@ -110,6 +124,16 @@ public:
 
     bool get_build_bf_cardinality() const { return _build_bf_exactly; }
 
+    // The expected false positive probability of a filter of `filter_bytes` bytes with `ndv`
+    // distinct values inserted, every value sets one bit in each of the 8 words of a bucket.
+    static double expected_fpp(size_t ndv, size_t filter_bytes) {
+        if (filter_bytes == 0) {
+            return 1;
+        }
+        constexpr double k = 8; // BUCKET_WORDS
+        return std::pow(1 - std::exp(-k * ndv / (filter_bytes * 8.0)), k);
+    }
+
     Status init_with_cardinality(const size_t build_bf_cardinality) {
         if (_build_bf_exactly) {
             // Use the same algorithm as org.apache.doris.planner.RuntimeFilter#calculateFilterSize
@@ -349,18 +373,13 @@ struct CommonFindOp {
         }
 
         const auto size = column->size();
+        bloom_filter.test_elements(data, size, results);
         if (nullmap) {
             for (size_t i = 0; i < size; i++) {
-                if (!nullmap[i]) {
-                    results[i] = bloom_filter.test_element(data[i]);
-                } else {
+                if (nullmap[i]) {
                     results[i] = bloom_filter.contain_null();
                 }
             }
-        } else {
-            for (size_t i = 0; i < size; i++) {
-                results[i] = bloom_filter.test_element(data[i]);
-            }
         }
     }
 
@@ -494,22 +513,35 @@ public:
     }
 
     template <bool is_nullable>
-    uint16_t find_dict_olap_engine(const vectorized::ColumnDictI32* column, const uint8* nullmap,
-                                   uint16_t* offsets, int number) {
+    uint16_t find_dict_olap_engine(const vectorized::ColumnDictI32* column,
+                                   const std::vector<vectorized::UInt8>& dict_flags,
+                                   const uint8* nullmap, uint16_t* offsets, int number) {
+        const auto* codes = column->get_data().data();
         uint16_t new_size = 0;
         for (uint16_t i = 0; i < number; i++) {
             uint16_t idx = offsets[i];
             offsets[new_size] = idx;
             if constexpr (is_nullable) {
                 new_size += nullmap[idx] && _bloom_filter->contain_null();
-                new_size += !nullmap[idx] && _bloom_filter->test(column->get_hash_value(idx));
+                new_size += !nullmap[idx] && dict_flags[codes[idx]];
             } else {
-                new_size += _bloom_filter->test(column->get_hash_value(idx));
+                new_size += dict_flags[codes[idx]];
             }
         }
         return new_size;
     }
 
+    // Probe the bloom filter once per word of the dictionary, the result of a row is
+    // `dict_flags[code]` then, see find_dict_olap_engine.
+    void find_dict_codes(const vectorized::ColumnDictI32* column,
+                         std::vector<vectorized::UInt8>& dict_flags) {
+        column->find_codes_if(
+                [&](int32_t code) {
+                    return _bloom_filter->test(column->get_hash_value_by_code(code));
+                },
+                dict_flags);
+    }
+
     uint16_t find_fixed_len_olap_engine(const char* data, const uint8* nullmap, uint16_t* offsets,
                                         int number, bool is_parse_column) override {
         return dummy.find_batch_olap_engine(*_bloom_filter, data, nullmap, offsets, number,
@@ -17,6 +17,12 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
 #include "common/object_pool.h"
 #include "exprs/runtime_filter.h"
 #include "runtime/decimalv2_value.h"
@@ -146,6 +152,8 @@ private:
 
 /**
  * Dynamic Container uses phmap::flat_hash_set.
+ * The integers of a range not wider than DENSE_MAX_RANGE are also kept in a bitmap, which is
+ * looked up instead of the hash set.
  * @tparam T Element Type
  */
 template <typename T>
@@ -155,14 +163,40 @@ public:
     using Iterator = typename vectorized::flat_hash_set<T>::iterator;
     using ElementType = T;
 
+    static constexpr bool CAN_BE_DENSE =
+            std::is_integral_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= sizeof(int64_t);
+    using DenseT = std::conditional_t<CAN_BE_DENSE, T, uint8_t>;
+    using UnsignedT = std::make_unsigned_t<DenseT>;
+    static constexpr uint64_t DENSE_MAX_RANGE =
+            std::min<uint64_t>(65536, uint64_t(std::numeric_limits<UnsignedT>::max()) + 1);
+
     DynamicContainer() = default;
     ~DynamicContainer() = default;
 
-    void insert(const T& value) { _set.insert(value); }
+    void insert(const T& value) {
+        if (_set.insert(value).second) {
+            if constexpr (CAN_BE_DENSE) {
+                _insert_dense(value);
+            }
+        }
+    }
 
-    void insert(Iterator begin, Iterator end) { _set.insert(begin, end); }
+    void insert(Iterator begin, Iterator end) {
+        for (auto iter = begin; iter != end; ++iter) {
+            insert(*iter);
+        }
+    }
 
-    bool find(const T& value) const { return _set.contains(value); }
+    bool find(const T& value) const {
+        if constexpr (CAN_BE_DENSE) {
+            if (_is_dense) {
+                // the values before the start wrap to the offsets out of the range
+                auto offset = static_cast<UnsignedT>(static_cast<UnsignedT>(value) - _dense_start);
+                return offset < _dense_range && ((_dense_bits[offset >> 6] >> (offset & 63)) & 1);
+            }
+        }
+        return _set.contains(value);
+    }
 
     Iterator begin() { return _set.begin(); }
 
@@ -170,8 +204,65 @@ public:
 
     size_t size() const { return _set.size(); }
 
+    bool is_dense() const { return CAN_BE_DENSE && _is_dense; }
+
 private:
+    // the unsigned values xor it are the keys in the order of the values
+    static constexpr UnsignedT SIGN_BIT =
+            std::is_signed_v<DenseT> ? UnsignedT(UnsignedT(1) << (sizeof(DenseT) * 8 - 1)) : 0;
+
+    void _insert_dense(T value) {
+        if (!_is_dense) {
+            return;
+        }
+        auto offset = static_cast<UnsignedT>(static_cast<UnsignedT>(value) - _dense_start);
+        if (offset < _dense_range) {
+            _dense_bits[offset >> 6] |= uint64_t(1) << (offset & 63);
+            return;
+        }
+
+        UnsignedT min_key = static_cast<UnsignedT>(value) ^ SIGN_BIT;
+        UnsignedT max_key = min_key;
+        if (_set.size() > 1) {
+            min_key = std::min(min_key, _min_key);
+            max_key = std::max(max_key, _max_key);
+        }
+        _min_key = min_key;
+        _max_key = max_key;
+        uint64_t span = uint64_t(max_key - min_key) + 1;
+        if (span > DENSE_MAX_RANGE) {
+            _is_dense = false;
+            _dense_range = 0;
+            std::vector<uint64_t>().swap(_dense_bits);
+            return;
+        }
+
+        // widen the range to at least twice as before, half of the slack on each side, so the
+        // values inserted in order rebuild the bitmap only a few times
+        uint64_t range = std::max<uint64_t>(_dense_range * 2, (span + 63) / 64 * 64);
+        range = std::min(range, DENSE_MAX_RANGE);
+        uint64_t slack = (range - span) / 2;
+        uint64_t start_key = min_key >= slack ? min_key - slack : 0;
+        uint64_t max_start_key = uint64_t(std::numeric_limits<UnsignedT>::max()) - (range - 1);
+        start_key = std::min(start_key, max_start_key);
+
+        _dense_start = static_cast<UnsignedT>(start_key) ^ SIGN_BIT;
+        _dense_range = range;
+        _dense_bits.assign((range + 63) / 64, 0);
+        for (const auto& element : _set) {
+            offset = static_cast<UnsignedT>(static_cast<UnsignedT>(element) - _dense_start);
+            _dense_bits[offset >> 6] |= uint64_t(1) << (offset & 63);
+        }
+    }
+
     vectorized::flat_hash_set<T> _set;
+    bool _is_dense = true;
+    // the bitmap of the values from _dense_start, as the unsigned values, to _dense_range
+    UnsignedT _dense_start = 0;
+    uint64_t _dense_range = 0;
+    std::vector<uint64_t> _dense_bits;
+    UnsignedT _min_key = 0;
+    UnsignedT _max_key = 0;
 };
 
 // TODO Maybe change void* parameter to template parameter better.
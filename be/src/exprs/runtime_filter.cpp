@@ -1787,6 +1787,10 @@ RuntimeFilterType IRuntimeFilter::get_real_type() {
     return _wrapper->get_real_type();
 }
 
+bool IRuntimeFilter::build_bf_exactly() const {
+    return _wrapper->get_build_bf_cardinality();
+}
+
 bool IRuntimeFilter::need_sync_filter_size() {
     return (type() == RuntimeFilterType::IN_OR_BLOOM_FILTER ||
             type() == RuntimeFilterType::BLOOM_FILTER) &&
@@ -305,6 +305,9 @@ public:
 
     bool need_sync_filter_size();
 
+    // whether the bloom filter is sized by the cardinality of the build side
+    bool build_bf_exactly() const;
+
     // async push runtimefilter to remote node
     Status push_to_remote(const TNetworkAddress* addr);
 
@@ -17,11 +17,19 @@
 
 #pragma once
 
+#include <fmt/format.h>
+
+#include <algorithm>
+
+#include "common/config.h"
 #include "common/exception.h"
 #include "common/status.h"
+#include "exprs/bloom_filter_func.h"
 #include "exprs/runtime_filter.h"
+#include "olap/hll.h"
 #include "runtime/runtime_filter_mgr.h"
 #include "runtime/runtime_state.h"
+#include "util/runtime_profile.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/columns_number.h"
 #include "vec/common/assert_cast.h"
@@ -92,11 +100,37 @@ public:
         return Status::OK();
     }
 
+    // Estimate the distinct count of the build keys of the filters choosing their type or size
+    // by the build side, so a few distinct keys of many rows still make an in filter or a small
+    // bloom filter. The first row of the block is a mock row.
+    void estimate_ndv(const vectorized::Block* block) {
+        if (!config::enable_runtime_filter_build_ndv || block->rows() <= 1) {
+            return;
+        }
+        std::vector<uint64_t> hashes;
+        for (const auto& [expr_order, filters] : _runtime_filters_map) {
+            if (std::none_of(filters.begin(), filters.end(), _need_ndv)) {
+                continue;
+            }
+            int result_column_id = _build_expr_context[expr_order]->get_last_result_column_id();
+            auto column = block->get_by_position(result_column_id)
+                                  .column->convert_to_full_column_if_const();
+            hashes.assign(column->size(), 0);
+            column->update_hashes_with_value(hashes.data());
+            HyperLogLog hll;
+            for (size_t i = 1; i < hashes.size(); ++i) {
+                hll.update(hashes[i]);
+            }
+            _build_ndvs[expr_order] = std::max<int64_t>(hll.estimate_cardinality(), 1);
+        }
+    }
+
     Status init_filters(RuntimeState* state, uint64_t local_hash_table_size) {
         // process IN_OR_BLOOM_FILTER's real type
         for (auto* filter : _runtime_filters) {
             if (filter->type() == RuntimeFilterType::IN_OR_BLOOM_FILTER &&
-                get_real_size(filter, local_hash_table_size) > state->runtime_filter_max_in_num()) {
+                _get_build_size(filter, local_hash_table_size) >
+                        state->runtime_filter_max_in_num()) {
                 RETURN_IF_ERROR(filter->change_to_bloom_filter());
             }
 
@@ -105,8 +139,8 @@ public:
                     return Status::InternalError("sync filter size meet error, filter: {}",
                                                  filter->debug_string());
                 }
-                RETURN_IF_ERROR(
-                        filter->init_bloom_filter(get_real_size(filter, local_hash_table_size)));
+                RETURN_IF_ERROR(filter->init_bloom_filter(
+                        _get_build_size(filter, local_hash_table_size)));
             }
         }
         return Status::OK();
@@ -130,6 +164,26 @@ public:
         }
     }
 
+    // Report the estimated distinct count of the build keys with the real type of each filter,
+    // and the expected false positive probability of a bloom filter of that many keys.
+    void update_profile(RuntimeProfile* profile) {
+        for (auto* filter : _runtime_filters) {
+            auto it = _build_ndvs.find(filter->expr_order());
+            if (it == _build_ndvs.end() || filter->get_ignored()) {
+                continue;
+            }
+            auto real_type = filter->get_real_type();
+            std::string info = fmt::format("RealType: {}, BuildNdv: {}",
+                                           IRuntimeFilter::to_string(real_type), it->second);
+            if (real_type == RuntimeFilterType::BLOOM_FILTER) {
+                size_t filter_bytes = filter->get_bloomfilter()->get_size();
+                info += fmt::format(", BloomFilterSize: {}, ExpectedFpp: {:.4f}", filter_bytes,
+                                    BloomFilterFuncBase::expected_fpp(it->second, filter_bytes));
+            }
+            profile->add_info_string(fmt::format("RuntimeFilter{}", filter->filter_id()), info);
+        }
+    }
+
     // publish runtime filter
     Status publish(bool publish_local = false) {
         for (auto& pair : _runtime_filters_map) {
@@ -165,10 +219,33 @@ public:
     bool empty() { return _runtime_filters_map.empty(); }
 
 private:
+    // the synced global size is the sum of the rows of all instances, which is kept because the
+    // bloom filters merged must have the same size
+    static bool _need_ndv(IRuntimeFilter* filter) {
+        if (filter->need_sync_filter_size()) {
+            return false;
+        }
+        return filter->type() == RuntimeFilterType::IN_OR_BLOOM_FILTER ||
+               (filter->type() == RuntimeFilterType::BLOOM_FILTER && filter->build_bf_exactly());
+    }
+
+    uint64_t _get_build_size(IRuntimeFilter* filter, uint64_t hash_table_size) const {
+        if (filter->isset_synced_size()) {
+            return get_real_size(filter, hash_table_size);
+        }
+        auto it = _build_ndvs.find(filter->expr_order());
+        if (it == _build_ndvs.end()) {
+            return hash_table_size;
+        }
+        return std::min<uint64_t>(it->second, hash_table_size);
+    }
+
     const std::vector<std::shared_ptr<vectorized::VExprContext>>& _build_expr_context;
     std::vector<IRuntimeFilter*> _runtime_filters;
     // prob_contition index -> [IRuntimeFilter]
     std::map<int, std::list<IRuntimeFilter*>> _runtime_filters_map;
+    // prob_contition index -> estimated distinct count of the build keys
+    std::map<int, int64_t> _build_ndvs;
 };
 
 } // namespace doris
@@ -21,12 +21,15 @@
 #include <glog/logging.h>
 #include <s2/s1angle.h>
 #include <s2/s2cap.h>
+#include <s2/s2cell_id.h>
+#include <s2/s2cell_union.h>
 #include <s2/s2earth.h>
 #include <s2/s2latlng.h>
 #include <s2/s2loop.h>
 #include <s2/s2point.h>
 #include <s2/s2polygon.h>
 #include <s2/s2polyline.h>
+#include <s2/s2region_coverer.h>
 #include <s2/util/coding/coder.h>
 #include <s2/util/units/length-units.h>
 #include <string.h>
@@ -212,6 +215,27 @@ GeoShape* GeoShape::from_wkb(const char* data, size_t size, GeoParseStatus* stat
     return shape;
 }
 
+GeoShape::~GeoShape() = default;
+
+void GeoShape::build_covering() {
+    const S2Region* shape_region = region();
+    if (shape_region == nullptr) {
+        return;
+    }
+    // More cells fit the shape closer at the cost of a longer binary search per point.
+    S2RegionCoverer::Options options;
+    options.set_max_cells(64);
+    S2RegionCoverer coverer(options);
+    _covering = std::make_unique<S2CellUnion>(coverer.GetCovering(*shape_region));
+}
+
+bool GeoShape::may_contain(const GeoShape* rhs) const {
+    if (_covering == nullptr || rhs->type() != GEO_SHAPE_POINT) {
+        return true;
+    }
+    return _covering->Contains(S2CellId(*static_cast<const GeoPoint*>(rhs)->point()));
+}
+
 std::unique_ptr<GeoShape> GeoShape::from_encoded(const void* ptr, size_t size) {
     if (size < 2 || ((const char*)ptr)[0] != 0X00) {
         return nullptr;
@@ -495,6 +519,10 @@ bool GeoPolygon::contains(const GeoShape* rhs) const {
     }
 }
 
+const S2Region* GeoPolygon::region() const {
+    return _polygon.get();
+}
+
 std::double_t GeoPolygon::getArea() const {
     return _polygon->GetArea();
 }
@@ -532,6 +560,10 @@ bool GeoCircle::contains(const GeoShape* rhs) const {
     }
 }
 
+const S2Region* GeoCircle::region() const {
+    return _cap.get();
+}
+
 void GeoCircle::encode(std::string* buf) {
     Encoder encoder;
     _cap->Encode(&encoder);
@@ -29,7 +29,9 @@
 class S2Polyline;
 class S2Polygon;
 class S2Cap;
+class S2CellUnion;
 class S2Loop;
+class S2Region;
 template <typename T>
 class Vector3;
 
@@ -41,7 +43,7 @@ namespace doris {
 
 class GeoShape {
 public:
-    virtual ~GeoShape() = default;
+    virtual ~GeoShape();
 
     virtual GeoShapeType type() const = 0;
 
@@ -60,6 +62,11 @@ public:
     virtual std::string as_wkt() const = 0;
 
     virtual bool contains(const GeoShape* rhs) const { return false; }
+    // Builds the cells covering the shape, for may_contain() to reject the points outside of them
+    // without the exact check of contains(). Worth it for a shape checked against many points.
+    void build_covering();
+    // Returns false only if the shape does not contain rhs.
+    bool may_contain(const GeoShape* rhs) const;
     virtual std::string to_string() const { return ""; }
     static std::string as_binary(GeoShape* rhs);
 
@@ -68,6 +75,11 @@ public:
 protected:
     virtual void encode(std::string* buf) = 0;
     virtual bool decode(const void* data, size_t size) = 0;
+    // The region to cover, nullptr if the shape has no covering.
+    virtual const S2Region* region() const { return nullptr; }
+
+private:
+    std::unique_ptr<S2CellUnion> _covering;
 };
 
 class GeoPoint : public GeoShape {
@@ -158,6 +170,7 @@ public:
 protected:
     void encode(std::string* buf) override;
     bool decode(const void* data, size_t size) override;
+    const S2Region* region() const override;
 
 private:
     std::unique_ptr<S2Polygon> _polygon;
@@ -182,6 +195,7 @@ public:
 protected:
     void encode(std::string* buf) override;
     bool decode(const void* data, size_t size) override;
+    const S2Region* region() const override;
 
 private:
     std::unique_ptr<S2Cap> _cap;
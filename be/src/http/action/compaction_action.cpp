@@ -17,6 +17,10 @@
 
 #include "http/action/compaction_action.h"
 
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
 // IWYU pragma: no_include <bits/chrono.h>
 #include <chrono> // IWYU pragma: keep
 #include <exception>
@@ -125,6 +129,52 @@ Status CompactionAction::_handle_show_compaction(HttpRequest* req, std::string*
     return Status::OK();
 }
 
+Status CompactionAction::_handle_show_stats(HttpRequest* req, std::string* json_result) {
+    uint64_t tablet_id = 0;
+    uint64_t partition_id = 0;
+    RETURN_NOT_OK_STATUS_WITH_WARN(_check_param(req, &tablet_id, TABLET_ID_KEY),
+                                   "check param failed");
+    RETURN_NOT_OK_STATUS_WITH_WARN(_check_param(req, &partition_id, "partition_id"),
+                                   "check param failed");
+    if ((tablet_id == 0) == (partition_id == 0)) {
+        return Status::InternalError(
+                "check param failed: exactly one of tablet_id and partition_id should be set");
+    }
+
+    rapidjson::Document root;
+    root.SetObject();
+    auto& allocator = root.GetAllocator();
+    if (tablet_id != 0) {
+        TabletSharedPtr tablet = _engine.tablet_manager()->get_tablet(tablet_id);
+        if (tablet == nullptr) {
+            return Status::NotFound("Tablet not found. tablet_id={}", tablet_id);
+        }
+        root.AddMember("tablet_id", tablet_id, allocator);
+        tablet->compaction_stats().to_json(&root, allocator);
+    } else {
+        auto tablets = _engine.tablet_manager()->get_all_tablet(
+                [partition_id](Tablet* tablet) {
+                    return static_cast<uint64_t>(tablet->partition_id()) == partition_id;
+                });
+        if (tablets.empty()) {
+            return Status::NotFound("No tablet of partition {}", partition_id);
+        }
+        TabletCompactionStats::Totals totals;
+        for (const auto& tablet : tablets) {
+            totals.merge(tablet->compaction_stats().totals());
+        }
+        root.AddMember("partition_id", partition_id, allocator);
+        root.AddMember("num_tablets", static_cast<uint64_t>(tablets.size()), allocator);
+        totals.to_json(&root, allocator);
+    }
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+    root.Accept(writer);
+    *json_result = std::string(buffer.GetString());
+    return Status::OK();
+}
+
 Status CompactionAction::_handle_run_compaction(HttpRequest* req, std::string* json_result) {
     // 1. param check
     // check req_tablet_id or req_table_id is not empty and can not be set together.
@@ -361,6 +411,14 @@ void CompactionAction::handle(HttpRequest* req) {
         } else {
             HttpChannel::send_reply(req, HttpStatus::OK, json_result);
         }
+    } else if (_type == CompactionActionType::SHOW_STATS) {
+        std::string json_result;
+        Status st = _handle_show_stats(req, &json_result);
+        if (!st.ok()) {
+            HttpChannel::send_reply(req, HttpStatus::OK, st.to_json());
+        } else {
+            HttpChannel::send_reply(req, HttpStatus::OK, json_result);
+        }
     } else {
         std::string json_result;
         Status st = _handle_run_status_compaction(req, &json_result);
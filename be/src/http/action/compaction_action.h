@@ -34,6 +34,7 @@ enum class CompactionActionType {
     SHOW_INFO = 1,
     RUN_COMPACTION = 2,
     RUN_COMPACTION_STATUS = 3,
+    SHOW_STATS = 4,
 };
 
 const std::string PARAM_COMPACTION_TYPE = "compact_type";
@@ -67,6 +68,9 @@ private:
     /// fetch compaction running status
     Status _handle_run_status_compaction(HttpRequest* req, std::string* json_result);
 
+    /// show the compaction stats of a tablet, or the summed stats of the tablets of a partition
+    Status _handle_show_stats(HttpRequest* req, std::string* json_result);
+
 private:
     StorageEngine& _engine;
     CompactionActionType _type;
@@ -0,0 +1,40 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "http/action/pipeline_latency_stats_action.h"
+
+#include <boost/algorithm/string/predicate.hpp>
+#include <string>
+
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "pipeline/pipeline_tracing.h"
+#include "runtime/exec_env.h"
+
+namespace doris {
+
+void PipelineLatencyStatsAction::handle(HttpRequest* req) {
+    bool reset = boost::iequals(req->param("reset"), "true");
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, "application/json");
+    HttpChannel::send_reply(
+            req, HttpStatus::OK,
+            ExecEnv::GetInstance()->pipeline_tracer_context()->latency_stats_json(reset));
+}
+
+} // namespace doris
@@ -0,0 +1,68 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "http/action/pipeline_slow_query_trace_action.h"
+
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <string>
+
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "pipeline/pipeline_tracing.h"
+#include "runtime/exec_env.h"
+#include "util/uid_util.h"
+
+namespace doris {
+
+void PipelineSlowQueryTraceAction::handle(HttpRequest* req) {
+    auto* tracer = ExecEnv::GetInstance()->pipeline_tracer_context();
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, "application/json");
+
+    // parse_id() writes into the string.
+    std::string query_id_str = req->param("query_id");
+    if (query_id_str.empty()) {
+        rapidjson::StringBuffer buffer;
+        rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+        writer.StartArray();
+        for (const auto& query_id : tracer->slow_queries()) {
+            writer.String(print_id(query_id).c_str());
+        }
+        writer.EndArray();
+        HttpChannel::send_reply(req, HttpStatus::OK, buffer.GetString());
+        return;
+    }
+
+    TUniqueId query_id;
+    if (!parse_id(query_id_str, &query_id)) {
+        HttpChannel::send_reply(
+                req, HttpStatus::BAD_REQUEST,
+                "Invalid query id! Query id should be {hi}-{lo} which is a hexadecimal. \n");
+        return;
+    }
+    std::string trace;
+    if (auto st = tracer->get_slow_query_trace(query_id, &trace); !st.ok()) {
+        HttpChannel::send_reply(req, HttpStatus::NOT_FOUND, st.to_json());
+        return;
+    }
+    HttpChannel::send_reply(req, HttpStatus::OK, trace);
+}
+
+} // namespace doris
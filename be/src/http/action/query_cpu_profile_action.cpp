@@ -0,0 +1,75 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "http/action/query_cpu_profile_action.h"
+
+#include <gen_cpp/Types_types.h>
+
+#include <cstdlib>
+#include <string>
+
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "util/pprof_utils.h"
+#include "util/query_cpu_profiler.h"
+#include "util/uid_util.h"
+
+namespace doris {
+
+static constexpr int DEFAULT_PROFILE_SECONDS = 10;
+static constexpr int DEFAULT_PROFILE_FREQUENCY = 99;
+
+void QueryCpuProfileAction::handle(HttpRequest* req) {
+    // parse_id() writes into the string.
+    std::string query_id_str = req->param("query_id");
+    TUniqueId query_id;
+    if (!parse_id(query_id_str, &query_id)) {
+        HttpChannel::send_reply(
+                req, HttpStatus::BAD_REQUEST,
+                "Invalid query id! Query id should be {hi}-{lo} which is a hexadecimal. \n");
+        return;
+    }
+    const auto& seconds_str = req->param("seconds");
+    const auto& frequency_str = req->param("frequency");
+    int seconds = seconds_str.empty() ? DEFAULT_PROFILE_SECONDS : std::atoi(seconds_str.c_str());
+    int frequency =
+            frequency_str.empty() ? DEFAULT_PROFILE_FREQUENCY : std::atoi(frequency_str.c_str());
+
+    std::string collapsed_stacks;
+    Status st = QueryCpuProfiler::profile(query_id, seconds, frequency, &collapsed_stacks);
+    if (st.ok() && req->param("type") == "flamegraph") {
+        std::string svg_content;
+        st = PprofUtils::generate_flamegraph(
+                collapsed_stacks, std::string(std::getenv("DORIS_HOME")) + "/tools/FlameGraph/",
+                &svg_content);
+        if (st.ok()) {
+            req->add_output_header(HttpHeaders::CONTENT_TYPE, "image/svg+xml");
+            HttpChannel::send_reply(req, HttpStatus::OK, svg_content);
+            return;
+        }
+    }
+    if (!st.ok()) {
+        HttpChannel::send_reply(req, HttpStatus::INTERNAL_SERVER_ERROR, st.to_string());
+        return;
+    }
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, "text/plain");
+    HttpChannel::send_reply(req, HttpStatus::OK, collapsed_stacks);
+}
+
+} // namespace doris
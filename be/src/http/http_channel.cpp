@@ -71,7 +71,7 @@ void HttpChannel::send_reply(HttpRequest* request, HttpStatus status, const std:
 }
 
 void HttpChannel::send_file(HttpRequest* request, int fd, size_t off, size_t size,
-                            bufferevent_rate_limit_group* rate_limit_group) {
+                            bufferevent_rate_limit_group* rate_limit_group, HttpStatus status) {
     auto evb = evbuffer_new();
     evbuffer_add_file(evb, fd, off, size);
     auto* evhttp_request = request->get_evhttp_request();
@@ -80,7 +80,7 @@ void HttpChannel::send_file(HttpRequest* request, int fd, size_t off, size_t siz
         auto* buffer_event = evhttp_connection_get_bufferevent(evhttp_connection);
         bufferevent_add_to_rate_limit_group(buffer_event, rate_limit_group);
     }
-    evhttp_send_reply(evhttp_request, HttpStatus::OK, default_reason(HttpStatus::OK).c_str(), evb);
+    evhttp_send_reply(evhttp_request, status, default_reason(status).c_str(), evb);
     evbuffer_free(evb);
 }
 
@@ -45,7 +45,8 @@ public:
     static void send_reply(HttpRequest* request, HttpStatus status, const std::string& content);
 
     static void send_file(HttpRequest* request, int fd, size_t off, size_t size,
-                          bufferevent_rate_limit_group* rate_limit_group = nullptr);
+                          bufferevent_rate_limit_group* rate_limit_group = nullptr,
+                          HttpStatus status = HttpStatus::OK);
 
     static bool compress_content(const std::string& accept_encoding, const std::string& input,
                                  std::string* output);
@@ -219,24 +219,42 @@ Status HttpClient::get_content_md5(std::string* md5) const {
     return Status::OK();
 }
 
-Status HttpClient::download(const std::string& local_path) {
+Status HttpClient::download(const std::string& local_path, uint64_t offset) {
     // set method to GET
     set_method(GET);
 
     // TODO(zc) Move this download speed limit outside to limit download speed
     // at system level
+    int64_t max_download_speed_kbps = _max_download_speed_kbps >= 0
+                                              ? _max_download_speed_kbps
+                                              : config::max_download_speed_kbps;
     curl_easy_setopt(_curl, CURLOPT_LOW_SPEED_LIMIT, config::download_low_speed_limit_kbps * 1024);
     curl_easy_setopt(_curl, CURLOPT_LOW_SPEED_TIME, config::download_low_speed_time);
-    curl_easy_setopt(_curl, CURLOPT_MAX_RECV_SPEED_LARGE, config::max_download_speed_kbps * 1024);
+    curl_easy_setopt(_curl, CURLOPT_MAX_RECV_SPEED_LARGE,
+                     (curl_off_t)max_download_speed_kbps * 1024);
+    // send "Range: bytes=<offset>-"
+    curl_easy_setopt(_curl, CURLOPT_RESUME_FROM_LARGE, (curl_off_t)offset);
 
     auto fp_closer = [](FILE* fp) { fclose(fp); };
-    std::unique_ptr<FILE, decltype(fp_closer)> fp(fopen(local_path.c_str(), "w"), fp_closer);
+    std::unique_ptr<FILE, decltype(fp_closer)> fp(
+            fopen(local_path.c_str(), offset > 0 ? "a" : "w"), fp_closer);
     if (fp == nullptr) {
         LOG(WARNING) << "open file failed, file=" << local_path;
         return Status::InternalError("open file failed");
     }
     Status status;
-    auto callback = [&status, &fp, &local_path](const void* data, size_t length) {
+    bool checked_range = offset == 0;
+    auto callback = [this, &status, &fp, &local_path, &checked_range](const void* data,
+                                                                       size_t length) {
+        if (!checked_range) {
+            checked_range = true;
+            // the server sends the whole file if it ignores the range
+            if (get_http_status() != 206 && ftruncate(fileno(fp.get()), 0) != 0) {
+                LOG(WARNING) << "fail to truncate file, file=" << local_path;
+                status = Status::InternalError("fail to truncate file when download");
+                return false;
+            }
+        }
         auto res = fwrite(data, length, 1, fp.get());
         if (res != 1) {
             LOG(WARNING) << "fail to write data to file, file=" << local_path
@@ -273,7 +291,8 @@ Status HttpClient::execute_with_retry(int retry_times, int sleep_time,
         status = callback(&client);
         if (status.ok()) {
             auto http_status = client.get_http_status();
-            if (http_status == 200) {
+            // 206 is the response of a resumed download
+            if (http_status == 200 || http_status == 206) {
                 return status;
             } else {
                 auto error_msg = fmt::format("http status code is not 200, code={}", http_status);
@@ -131,8 +131,15 @@ public:
     }
 
     // helper function to download a file, you can call this function to download
-    // a file to local_path
-    Status download(const std::string& local_path);
+    // a file to local_path.
+    // If offset is not 0, the download resumes a partially downloaded local file, only the
+    // bytes from offset are requested and appended to it. The local file is rewritten from
+    // the beginning if the server does not support the range request.
+    Status download(const std::string& local_path, uint64_t offset = 0);
+
+    // Limit the download speed(KB/s) of this client, config::max_download_speed_kbps is used
+    // if not set.
+    void set_max_download_speed_kbps(int64_t speed_kbps) { _max_download_speed_kbps = speed_kbps; }
 
     Status execute_post_request(const std::string& payload, std::string* response);
 
@@ -155,6 +162,7 @@ private:
     const HttpCallback* _callback = nullptr;
     char _error_buf[CURL_ERROR_SIZE];
     curl_slist* _header_list = nullptr;
+    int64_t _max_download_speed_kbps = -1;
 };
 
 } // namespace doris
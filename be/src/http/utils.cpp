@@ -17,12 +17,17 @@
 
 #include "http/utils.h"
 
+#include <event2/buffer.h>
 #include <fcntl.h>
+#include <fmt/format.h>
 #include <stdint.h>
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <charconv>
 #include <ostream>
+#include <string_view>
 #include <vector>
 
 #include "common/config.h"
@@ -154,13 +159,20 @@ void do_file_response(const std::string& file_path, HttpRequest* req,
     int64_t file_size = st.st_size;
 
     // TODO(lingbin): process "IF_MODIFIED_SINCE" header
-    // TODO(lingbin): process "RANGE" header
+    int64_t offset = 0;
+    int64_t length = file_size;
+    HttpStatus status = HttpStatus::OK;
     const std::string& range_header = req->header(HttpHeaders::RANGE);
-    if (!range_header.empty()) {
-        // analyse range header
+    if (!range_header.empty() && parse_range_header(range_header, file_size, &offset, &length)) {
+        status = HttpStatus::PARTIAL_CONTENT;
+        req->add_output_header(HttpHeaders::CONTENT_RANGE,
+                               fmt::format("bytes {}-{}/{}", offset, offset + length - 1,
+                                           file_size)
+                                       .c_str());
     }
 
     req->add_output_header(HttpHeaders::CONTENT_TYPE, get_content_type(file_path).c_str());
+    req->add_output_header(HttpHeaders::ACCEPT_RANGES, "bytes");
 
     if (is_acquire_md5) {
         Md5Digest md5;
@@ -180,7 +192,40 @@ void do_file_response(const std::string& file_path, HttpRequest* req,
         return;
     }
 
-    HttpChannel::send_file(req, fd, 0, file_size, rate_limit_group);
+    HttpChannel::send_file(req, fd, offset, length, rate_limit_group, status);
+}
+
+bool parse_range_header(const std::string& range_header, int64_t file_size, int64_t* offset,
+                        int64_t* length) {
+    static const std::string kBytesUnit = "bytes=";
+    if (!range_header.starts_with(kBytesUnit)) {
+        return false;
+    }
+    std::string_view spec(range_header);
+    spec.remove_prefix(kBytesUnit.size());
+    auto dash = spec.find('-');
+    // suffix ranges "-<length>" and multiple ranges are not supported
+    if (dash == 0 || dash == std::string_view::npos ||
+        spec.find(',') != std::string_view::npos) {
+        return false;
+    }
+    auto parse = [](std::string_view str, int64_t* value) {
+        auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), *value);
+        return ec == std::errc() && ptr == str.data() + str.size() && *value >= 0;
+    };
+    int64_t first = 0;
+    int64_t last = file_size - 1;
+    if (!parse(spec.substr(0, dash), &first) ||
+        (dash + 1 < spec.size() && !parse(spec.substr(dash + 1), &last))) {
+        return false;
+    }
+    if (first >= file_size || last < first) {
+        return false;
+    }
+    last = std::min(last, file_size - 1);
+    *offset = first;
+    *length = last - first + 1;
+    return true;
 }
 
 void do_dir_response(const std::string& dir_path, HttpRequest* req) {
@@ -214,4 +259,24 @@ bool load_size_smaller_than_wal_limit(int64_t content_length) {
     return (content_length < 0.8 * max_available_size);
 }
 
+ByteBufferPtr remove_evbuffer_front(evbuffer* buf, size_t max_copy_size) {
+    // The chains of the evbuffer are filled by the reads of the socket, usually 16KB each.
+    static constexpr size_t MIN_ZERO_COPY_SIZE = 8 * 1024;
+    auto chain_size = evbuffer_get_contiguous_space(buf);
+    if (chain_size >= MIN_ZERO_COPY_SIZE) {
+        std::shared_ptr<evbuffer> chunk(evbuffer_new(), evbuffer_free);
+        // moves the whole chain, only the partial chains are copied
+        int moved = chunk == nullptr ? -1 : evbuffer_remove_buffer(buf, chunk.get(), chain_size);
+        if (moved > 0) {
+            auto* data = reinterpret_cast<char*>(evbuffer_pullup(chunk.get(), -1));
+            return ByteBuffer::wrap(data, moved, std::move(chunk));
+        }
+    }
+    auto bb = ByteBuffer::allocate(max_copy_size);
+    auto remove_bytes = evbuffer_remove(buf, bb->ptr, bb->capacity);
+    bb->pos = remove_bytes < 0 ? 0 : remove_bytes;
+    bb->flip();
+    return bb;
+}
+
 } // namespace doris
@@ -21,8 +21,10 @@
 
 #include "common/utils.h"
 #include "http/http_request.h"
+#include "util/byte_buffer.h"
 
 struct bufferevent_rate_limit_group;
+struct evbuffer;
 
 namespace doris {
 
@@ -40,9 +42,20 @@ void do_file_response(const std::string& dir_path, HttpRequest* req,
                       bufferevent_rate_limit_group* rate_limit_group = nullptr,
                       bool is_acquire_md5 = false);
 
+// Parse a single byte range "bytes=<first>-[<last>]" of a file of file_size bytes into the
+// offset and the length to send. Return false if the range is malformed, is not a single
+// range or can not be satisfied, then the whole file should be sent.
+bool parse_range_header(const std::string& range_header, int64_t file_size, int64_t* offset,
+                        int64_t* length);
+
 void do_dir_response(const std::string& dir_path, HttpRequest* req);
 
 std::string get_content_type(const std::string& file_name);
 
 bool load_size_smaller_than_wal_limit(int64_t content_length);
+
+// Removes the data at the front of the non empty evbuffer of a request body. A large enough
+// first chain of the evbuffer is handed over as a whole without a copy, the small chains are
+// copied together into a buffer of at most `max_copy_size` bytes.
+ByteBufferPtr remove_evbuffer_front(evbuffer* buf, size_t max_copy_size = 128 * 1024);
 } // namespace doris
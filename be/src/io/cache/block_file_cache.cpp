@@ -29,6 +29,7 @@
 #endif
 
 #include <chrono> // IWYU pragma: keep
+#include <limits>
 #include <mutex>
 #include <ranges>
 
@@ -77,6 +78,24 @@ BlockFileCache::BlockFileCache(const std::string& cache_base_path,
             _cache_base_path.c_str(), "file_cache_ttl_cache_evict_size");
     _total_evict_size_metrics = std::make_shared<bvar::Adder<size_t>>(
             _cache_base_path.c_str(), "file_cache_total_evict_size");
+    _queue_hit_metrics[0] = std::make_shared<bvar::Adder<size_t>>(
+            _cache_base_path.c_str(), "file_cache_index_queue_hit");
+    _queue_hit_metrics[1] = std::make_shared<bvar::Adder<size_t>>(
+            _cache_base_path.c_str(), "file_cache_normal_queue_hit");
+    _queue_hit_metrics[2] = std::make_shared<bvar::Adder<size_t>>(
+            _cache_base_path.c_str(), "file_cache_disposable_queue_hit");
+    _queue_hit_metrics[3] = std::make_shared<bvar::Adder<size_t>>(
+            _cache_base_path.c_str(), "file_cache_ttl_cache_hit");
+    _queue_miss_metrics[0] = std::make_shared<bvar::Adder<size_t>>(
+            _cache_base_path.c_str(), "file_cache_index_queue_miss");
+    _queue_miss_metrics[1] = std::make_shared<bvar::Adder<size_t>>(
+            _cache_base_path.c_str(), "file_cache_normal_queue_miss");
+    _queue_miss_metrics[2] = std::make_shared<bvar::Adder<size_t>>(
+            _cache_base_path.c_str(), "file_cache_disposable_queue_miss");
+    _queue_miss_metrics[3] = std::make_shared<bvar::Adder<size_t>>(
+            _cache_base_path.c_str(), "file_cache_ttl_cache_miss");
+    _second_chance_metrics = std::make_shared<bvar::Adder<size_t>>(
+            _cache_base_path.c_str(), "file_cache_evict_second_chance");
 
     _disposable_queue = LRUQueue(cache_settings.disposable_queue_size,
                                  cache_settings.disposable_queue_elements, 60 * 60);
@@ -219,6 +238,9 @@ void BlockFileCache::use_cell(const FileBlockCell& cell, FileBlocks* result, boo
         /// Move to the end of the queue. The iterator remains valid.
         if (move_iter_flag) {
             queue.move_to_end(*cell.queue_iterator, cache_lock);
+            if (cell.hits < std::numeric_limits<uint8_t>::max()) {
+                ++cell.hits;
+            }
         }
     }
     cell.update_atime();
@@ -636,8 +658,12 @@ FileBlocksHolder BlockFileCache::get_or_set(const UInt128Wrapper& hash, size_t o
     DCHECK(!file_blocks.empty());
     _num_read_blocks += file_blocks.size();
     for (auto& block : file_blocks) {
+        auto type = static_cast<int>(block->cache_type());
         if (block->state() == FileBlock::State::DOWNLOADED) {
             _num_hit_blocks++;
+            *_queue_hit_metrics[type] << 1;
+        } else {
+            *_queue_miss_metrics[type] << 1;
         }
     }
     return FileBlocksHolder(std::move(file_blocks));
@@ -1146,10 +1172,17 @@ bool BlockFileCache::try_reserve_for_lru(const UInt128Wrapper& hash,
         size_t cur_cache_size = _cur_cache_size;
 
         std::vector<FileBlockCell*> to_evict;
-        for (const auto& [entry_key, entry_offset, entry_size] : queue) {
+        // A block read again after it entered the queue is moved to the end of the queue instead
+        // of being evicted, at most max_chances times, so the blocks read only once (e.g. by a
+        // big scan) go first. Every element is visited at most max_chances + 1 times.
+        const int max_chances = std::max(config::file_cache_max_evict_second_chances, 0);
+        size_t num_visits = queue.get_elements_num(cache_lock) * (max_chances + 1);
+        for (auto it = queue.begin(); it != queue.end() && num_visits > 0; --num_visits) {
             if (!is_overflow(removed_size, size, cur_cache_size)) {
                 break;
             }
+            auto entry = it++;
+            const auto& [entry_key, entry_offset, entry_size] = *entry;
             auto* cell = get_cell(entry_key, entry_offset, cache_lock);
 
             DCHECK(cell) << "Cache became inconsistent. UInt128Wrapper: " << entry_key.to_string()
@@ -1159,6 +1192,12 @@ bool BlockFileCache::try_reserve_for_lru(const UInt128Wrapper& hash,
             DCHECK(entry_size == cell_size);
 
             if (cell->releasable()) {
+                if (cell->hits > 0 && max_chances > 0) {
+                    cell->hits = std::min<int>(cell->hits, max_chances) - 1;
+                    queue.move_to_end(entry, cache_lock);
+                    *_second_chance_metrics << 1;
+                    continue;
+                }
                 auto& file_block = cell->file_block;
 
                 std::lock_guard block_lock(file_block->_mutex);
@@ -1435,6 +1474,7 @@ void BlockFileCache::check_disk_resource_limit(const std::string& path) {
 
 void BlockFileCache::run_background_operation() {
     int64_t interval_time_seconds = 20;
+    int64_t last_meta_snapshot_time = UnixSeconds();
     while (!_close) {
         TEST_SYNC_POINT_CALLBACK("BlockFileCache::set_sleep_time", &interval_time_seconds);
         check_disk_resource_limit(_cache_base_path);
@@ -1446,8 +1486,16 @@ void BlockFileCache::run_background_operation() {
             }
         }
         recycle_deleted_blocks();
-        // gc
         int64_t cur_time = UnixSeconds();
+        if (config::file_cache_meta_snapshot_interval_sec > 0 &&
+            cur_time - last_meta_snapshot_time >= config::file_cache_meta_snapshot_interval_sec) {
+            if (auto st = _storage->write_meta_snapshot(this); !st.ok()) {
+                LOG_WARNING("failed to write meta snapshot of file cache {}", _cache_base_path)
+                        .error(st);
+            }
+            last_meta_snapshot_time = cur_time;
+        }
+        // gc
         std::lock_guard cache_lock(_mutex);
         while (!_time_to_key.empty()) {
             auto begin = _time_to_key.begin();
@@ -280,6 +280,9 @@ private:
 
         mutable int64_t atime {0};
         mutable bool is_deleted {false};
+        /// Times the block is read again since it was last passed over by the eviction, the
+        /// eviction gives such a block another round in its queue before the blocks read once.
+        mutable uint8_t hits {0};
         void update_atime() const {
             atime = std::chrono::duration_cast<std::chrono::seconds>(
                             std::chrono::steady_clock::now().time_since_epoch())
@@ -297,7 +300,8 @@ private:
         FileBlockCell(FileBlockCell&& other) noexcept
                 : file_block(std::move(other.file_block)),
                   queue_iterator(other.queue_iterator),
-                  atime(other.atime) {}
+                  atime(other.atime),
+                  hits(other.hits) {}
 
         FileBlockCell& operator=(const FileBlockCell&) = delete;
         FileBlockCell(const FileBlockCell&) = delete;
@@ -432,6 +436,9 @@ private:
     std::shared_ptr<bvar::Status<size_t>> _cur_disposable_queue_element_count_metrics;
     std::shared_ptr<bvar::Status<size_t>> _cur_disposable_queue_cache_size_metrics;
     std::array<std::shared_ptr<bvar::Adder<size_t>>, 4> _queue_evict_size_metrics;
+    std::array<std::shared_ptr<bvar::Adder<size_t>>, 4> _queue_hit_metrics;
+    std::array<std::shared_ptr<bvar::Adder<size_t>>, 4> _queue_miss_metrics;
+    std::shared_ptr<bvar::Adder<size_t>> _second_chance_metrics;
     std::shared_ptr<bvar::Adder<size_t>> _total_evict_size_metrics;
 };
 
@@ -20,6 +20,7 @@
 
 #include "io/cache/block_file_cache_factory.h"
 
+#include <fmt/format.h>
 #include <glog/logging.h>
 #if defined(__APPLE__)
 #include <sys/mount.h>
@@ -29,10 +30,12 @@
 
 #include <algorithm>
 #include <ostream>
+#include <unordered_set>
 #include <utility>
 
 #include "common/config.h"
 #include "io/cache/file_cache_common.h"
+#include "io/fs/file_system.h"
 #include "io/fs/local_file_system.h"
 #include "runtime/exec_env.h"
 
@@ -58,7 +61,16 @@ size_t FileCacheFactory::try_release(const std::string& base_path) {
     if (iter != _path_to_cache.end()) {
         return iter->second->try_release();
     }
-    return 0;
+    // the configured path of a sharded cache releases all of its shards
+    size_t elements = 0;
+    size_t shard_num = std::max(1, config::file_cache_shard_num);
+    for (size_t i = 0; shard_num > 1 && i < shard_num; ++i) {
+        iter = _path_to_cache.find(get_shard_path(base_path, i, shard_num));
+        if (iter != _path_to_cache.end()) {
+            elements += iter->second->try_release();
+        }
+    }
+    return elements;
 }
 
 Status FileCacheFactory::create_file_cache(const std::string& cache_base_path,
@@ -90,17 +102,85 @@ Status FileCacheFactory::create_file_cache(const std::string& cache_base_path,
         file_cache_settings =
                 get_file_cache_settings(disk_capacity, file_cache_settings.max_query_cache_size);
     }
-    auto cache = std::make_unique<BlockFileCache>(cache_base_path, file_cache_settings);
-    RETURN_IF_ERROR(cache->initialize());
+    size_t shard_num = std::max(1, config::file_cache_shard_num);
+    RETURN_IF_ERROR(_remove_stale_shards(cache_base_path, shard_num));
+    std::vector<std::unique_ptr<BlockFileCache>> shards;
+    if (shard_num == 1) {
+        shards.push_back(std::make_unique<BlockFileCache>(cache_base_path, file_cache_settings));
+    } else {
+        auto shard_settings = get_shard_settings(file_cache_settings, shard_num);
+        for (size_t i = 0; i < shard_num; ++i) {
+            auto shard_path = get_shard_path(cache_base_path, i, shard_num);
+            RETURN_IF_ERROR(fs->create_directory(shard_path));
+            shards.push_back(std::make_unique<BlockFileCache>(shard_path, shard_settings));
+        }
+    }
+    for (auto& cache : shards) {
+        RETURN_IF_ERROR(cache->initialize());
+    }
     {
         std::lock_guard lock(_mtx);
-        _path_to_cache[cache_base_path] = cache.get();
-        _caches.push_back(std::move(cache));
-        _capacity += file_cache_settings.capacity;
+        for (auto& cache : shards) {
+            _path_to_cache[cache->get_base_path()] = cache.get();
+            _capacity += cache->capacity();
+            _caches.push_back(std::move(cache));
+        }
     }
     LOG(INFO) << "[FileCache] path: " << cache_base_path
               << " total_size: " << file_cache_settings.capacity
-              << " disk_total_size: " << disk_capacity;
+              << " disk_total_size: " << disk_capacity << " shard_num: " << shard_num;
+    return Status::OK();
+}
+
+std::string FileCacheFactory::get_shard_path(const std::string& cache_base_path, size_t shard,
+                                             size_t shard_num) {
+    return (Path(cache_base_path) / fmt::format("shard_{}_of_{}", shard, shard_num)).native();
+}
+
+FileCacheSettings FileCacheFactory::get_shard_settings(const FileCacheSettings& settings,
+                                                       size_t shard_num) {
+    FileCacheSettings shard_settings = settings;
+    shard_settings.capacity = settings.capacity / shard_num;
+    shard_settings.disposable_queue_size = settings.disposable_queue_size / shard_num;
+    shard_settings.index_queue_size = settings.index_queue_size / shard_num;
+    shard_settings.query_queue_size = settings.query_queue_size / shard_num;
+    shard_settings.max_query_cache_size = settings.max_query_cache_size / shard_num;
+    shard_settings.disposable_queue_elements = std::max(
+            settings.disposable_queue_elements / shard_num, REMOTE_FS_OBJECTS_CACHE_DEFAULT_ELEMENTS);
+    shard_settings.index_queue_elements = std::max(settings.index_queue_elements / shard_num,
+                                                   REMOTE_FS_OBJECTS_CACHE_DEFAULT_ELEMENTS);
+    shard_settings.query_queue_elements = std::max(settings.query_queue_elements / shard_num,
+                                                   REMOTE_FS_OBJECTS_CACHE_DEFAULT_ELEMENTS);
+    return shard_settings;
+}
+
+// Keys are spread over all of the cache instances by hash, so the blocks cached with another
+// shard num are in the wrong instance, remove them instead of letting them take the capacity.
+Status FileCacheFactory::_remove_stale_shards(const std::string& cache_base_path,
+                                              size_t shard_num) {
+    const auto& fs = global_local_filesystem();
+    std::vector<FileInfo> files;
+    bool exists = true;
+    RETURN_IF_ERROR(fs->list(cache_base_path, false, &files, &exists));
+    std::unordered_set<std::string> shard_dirs;
+    for (size_t i = 0; shard_num > 1 && i < shard_num; ++i) {
+        shard_dirs.insert(Path(get_shard_path(cache_base_path, i, shard_num)).filename());
+    }
+    for (const auto& file : files) {
+        bool is_stale = false;
+        if (shard_num == 1) {
+            is_stale = !file.is_file && file.file_name.starts_with("shard_");
+        } else {
+            // everything else is left by the layout without shards or by another shard num
+            is_stale = file.is_file || !shard_dirs.contains(file.file_name);
+        }
+        if (!is_stale) {
+            continue;
+        }
+        auto path = Path(cache_base_path) / file.file_name;
+        LOG(INFO) << "[FileCache] remove " << path.native() << " for shard num " << shard_num;
+        RETURN_IF_ERROR(file.is_file ? fs->delete_file(path) : fs->delete_directory(path));
+    }
     return Status::OK();
 }
 
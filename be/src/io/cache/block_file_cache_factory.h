@@ -70,11 +70,20 @@ public:
 
     std::vector<std::string> get_base_paths();
 
+    // the directory under cache_base_path of a shard when the cache has more than one shard
+    static std::string get_shard_path(const std::string& cache_base_path, size_t shard,
+                                      size_t shard_num);
+    // the settings of each shard of a cache with the given settings
+    static FileCacheSettings get_shard_settings(const FileCacheSettings& settings,
+                                                size_t shard_num);
+
     FileCacheFactory() = default;
     FileCacheFactory& operator=(const FileCacheFactory&) = delete;
     FileCacheFactory(const FileCacheFactory&) = delete;
 
 private:
+    Status _remove_stale_shards(const std::string& cache_base_path, size_t shard_num);
+
     std::mutex _mtx;
     std::vector<std::unique_ptr<BlockFileCache>> _caches;
     std::unordered_map<std::string, BlockFileCache*> _path_to_cache;
@@ -37,12 +37,14 @@
 #include "io/fs/local_file_system.h"
 #include "io/io_common.h"
 #include "util/bit_util.h"
+#include "util/bvar_helper.h"
 #include "util/doris_metrics.h"
 #include "util/runtime_profile.h"
 
 namespace doris::io {
 
 bvar::Adder<uint64_t> s3_read_counter("cached_remote_reader_s3_read");
+bvar::LatencyRecorder g_file_cache_read_latency("file_cache", "read");
 
 CachedRemoteFileReader::CachedRemoteFileReader(FileReaderSPtr remote_file_reader,
                                                const FileReaderOptions& opts)
@@ -110,6 +112,7 @@ Status CachedRemoteFileReader::read_at_impl(size_t offset, Slice result, size_t*
                                             const IOContext* io_ctx) {
     DCHECK(!closed());
     DCHECK(io_ctx);
+    SCOPED_BVAR_LATENCY(g_file_cache_read_latency);
     if (offset > size()) {
         return Status::InvalidArgument(
                 fmt::format("offset exceeds file size(offset: {}, file size: {}, path: {})", offset,
@@ -20,12 +20,15 @@
 #include <glog/logging.h>
 // IWYU pragma: no_include <bits/chrono.h>
 #include <chrono> // IWYU pragma: keep
+#include <cstring>
 #include <sstream>
 #include <string>
 #include <thread>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "io/cache/block_file_cache.h"
+#include "io/cache/file_block_mem_cache.h"
 
 namespace doris {
 namespace io {
@@ -157,7 +160,23 @@ Status FileBlock::finalize() {
 }
 
 Status FileBlock::read(Slice buffer, size_t read_offset) {
-    return _mgr->_storage->read(_key, read_offset, buffer);
+    auto* mem_cache = FileBlockMemCache::instance();
+    if (mem_cache == nullptr) {
+        return _mgr->_storage->read(_key, read_offset, buffer);
+    }
+    if (mem_cache->read(_key.hash, _key.offset, read_offset, buffer)) {
+        return Status::OK();
+    }
+    if (_num_disk_reads.fetch_add(1) + 1 < config::file_block_mem_cache_promote_reads) {
+        return _mgr->_storage->read(_key, read_offset, buffer);
+    }
+    // hot block, read all of it once and serve the following reads from memory
+    size_t block_size = _block_range.size();
+    std::unique_ptr<char[]> data(new char[block_size]);
+    RETURN_IF_ERROR(_mgr->_storage->read(_key, 0, Slice(data.get(), block_size)));
+    memcpy(buffer.data, data.get() + read_offset, buffer.size);
+    mem_cache->insert(_key.hash, _key.offset, std::move(data), block_size);
+    return Status::OK();
 }
 
 Status FileBlock::change_cache_type_by_mgr(FileCacheType new_type) {
@@ -153,6 +153,8 @@ private:
     std::condition_variable _cv;
     FileCacheKey _key;
     size_t _downloaded_size {0};
+    // reads of the downloaded block from the cache file, see FileBlockMemCache
+    std::atomic<int32_t> _num_disk_reads {0};
 };
 
 extern std::ostream& operator<<(std::ostream& os, const FileBlock::State& value);
@@ -0,0 +1,77 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/cache/file_block_mem_cache.h"
+
+#include <bvar/bvar.h>
+
+#include <cstring>
+
+#include "common/config.h"
+
+namespace doris::io {
+
+bvar::Adder<uint64_t> g_file_block_mem_cache_hit("file_block_mem_cache_hit");
+bvar::Adder<uint64_t> g_file_block_mem_cache_miss("file_block_mem_cache_miss");
+bvar::Adder<uint64_t> g_file_block_mem_cache_insert("file_block_mem_cache_insert");
+
+FileBlockMemCache::FileBlockMemCache(size_t capacity)
+        : LRUCachePolicy(CachePolicy::CacheType::FILE_BLOCK_MEM_CACHE, capacity,
+                         LRUCacheType::SIZE, config::file_block_mem_cache_stale_sweep_time_sec) {}
+
+FileBlockMemCache* FileBlockMemCache::create_global_cache(size_t capacity) {
+    DCHECK(ExecEnv::GetInstance()->get_file_block_mem_cache() == nullptr);
+    return new FileBlockMemCache(capacity);
+}
+
+std::string FileBlockMemCache::encode_key(const UInt128Wrapper& hash, size_t block_offset) {
+    std::string key;
+    key.resize(sizeof(hash.value_) + sizeof(block_offset));
+    memcpy(key.data(), &hash.value_, sizeof(hash.value_));
+    memcpy(key.data() + sizeof(hash.value_), &block_offset, sizeof(block_offset));
+    return key;
+}
+
+bool FileBlockMemCache::read(const UInt128Wrapper& hash, size_t block_offset, size_t read_offset,
+                             Slice buffer) {
+    auto* handle = lookup(encode_key(hash, block_offset));
+    if (handle == nullptr) {
+        g_file_block_mem_cache_miss << 1;
+        return false;
+    }
+    auto* cache_value = static_cast<CacheValue*>(value(handle));
+    bool hit = read_offset + buffer.size <= cache_value->size;
+    if (hit) {
+        memcpy(buffer.data, cache_value->data.get() + read_offset, buffer.size);
+    }
+    release(handle);
+    (hit ? g_file_block_mem_cache_hit : g_file_block_mem_cache_miss) << 1;
+    return hit;
+}
+
+void FileBlockMemCache::insert(const UInt128Wrapper& hash, size_t block_offset,
+                               std::unique_ptr<char[]> data, size_t size) {
+    auto* cache_value = new CacheValue;
+    cache_value->data = std::move(data);
+    cache_value->size = size;
+    auto* handle = LRUCachePolicy::insert(encode_key(hash, block_offset), cache_value, size, size,
+                                          CachePriority::NORMAL);
+    release(handle);
+    g_file_block_mem_cache_insert << 1;
+}
+
+} // namespace doris::io
@@ -0,0 +1,64 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "io/cache/file_cache_common.h"
+#include "runtime/exec_env.h"
+#include "runtime/memory/lru_cache_policy.h"
+#include "util/slice.h"
+
+namespace doris::io {
+
+// Memory tier above the disk file cache. The downloaded blocks which are read often are copied
+// here, and the later reads of them are served from memory without going to the cache files.
+// A block of a key at an offset always has the same content, so an entry never goes stale, it
+// is only evicted by lru.
+class FileBlockMemCache : public LRUCachePolicy {
+public:
+    FileBlockMemCache(size_t capacity);
+
+    static FileBlockMemCache* create_global_cache(size_t capacity);
+
+    // nullptr if the memory tier is disabled
+    static FileBlockMemCache* instance() {
+        return ExecEnv::GetInstance()->get_file_block_mem_cache();
+    }
+
+    // read [read_offset, read_offset + buffer.size) of the block at block_offset of the key,
+    // return false if the block is not in the cache
+    bool read(const UInt128Wrapper& hash, size_t block_offset, size_t read_offset, Slice buffer);
+
+    void insert(const UInt128Wrapper& hash, size_t block_offset, std::unique_ptr<char[]> data,
+                size_t size);
+
+    static std::string encode_key(const UInt128Wrapper& hash, size_t block_offset);
+
+private:
+    class CacheValue : public LRUCacheValueBase {
+    public:
+        CacheValue() : LRUCacheValueBase(CachePolicy::CacheType::FILE_BLOCK_MEM_CACHE) {}
+
+        std::unique_ptr<char[]> data;
+        size_t size = 0;
+    };
+};
+
+} // namespace doris::io
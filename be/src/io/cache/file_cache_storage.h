@@ -41,6 +41,8 @@ public:
     virtual Status remove(const FileCacheKey& key) = 0;
     // change the block meta
     virtual Status change_key_meta(const FileCacheKey& key, const KeyMeta& new_meta) = 0;
+    // persist the blocks meta, so that the next init does not need to scan all the blocks
+    virtual Status write_meta_snapshot(BlockFileCache* _mgr) { return Status::OK(); }
     // use when lazy load cache
     virtual void load_blocks_directly_unlocked(BlockFileCache* _mgr, const FileCacheKey& key,
                                                std::lock_guard<std::mutex>& cache_lock) {}
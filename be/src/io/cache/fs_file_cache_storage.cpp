@@ -21,6 +21,7 @@
 #include <mutex>
 #include <system_error>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/sync_point.h"
 #include "io/cache/block_file_cache.h"
@@ -31,6 +32,8 @@
 #include "io/fs/local_file_reader.h"
 #include "io/fs/local_file_writer.h"
 #include "runtime/exec_env.h"
+#include "util/coding.h"
+#include "util/crc32c.h"
 #include "vec/common/hex.h"
 
 namespace doris::io {
@@ -102,10 +105,25 @@ Status FSFileCacheStorage::init(BlockFileCache* _mgr) {
     _cache_base_path = _mgr->_cache_base_path;
     RETURN_IF_ERROR(rebuild_data_structure());
     _cache_background_load_thread = std::thread([this, mgr = _mgr]() {
-        load_cache_info_into_memory(mgr);
+        BlockKeySet unverified;
+        if (config::file_cache_meta_snapshot_interval_sec > 0) {
+            auto st = load_meta_snapshot(mgr, &unverified);
+            if (!st.ok()) {
+                LOG_WARNING("FileCache {} failed to load meta snapshot", _cache_base_path)
+                        .error(st);
+            } else if (!unverified.empty()) {
+                // the cache is complete as of the snapshot, the scan below only verifies it
+                mgr->_lazy_open_done = true;
+                LOG_INFO("FileCache {} loaded {} blocks from meta snapshot", _cache_base_path,
+                         unverified.size());
+            }
+        }
+        load_cache_info_into_memory(mgr, &unverified);
+        remove_unverified_blocks(mgr, unverified);
         mgr->_lazy_open_done = true;
         LOG_INFO("FileCache {} lazy load done.", _cache_base_path);
     });
+    _cache_background_remove_thread = std::thread([this]() { remove_deleted_files(); });
     return Status::OK();
 }
 
@@ -125,7 +143,17 @@ Status FSFileCacheStorage::append(const FileCacheKey& key, const Slice& value) {
             std::string tmp_file = get_path_in_local_cache(dir, key.offset, key.meta.type, true);
             FileWriterPtr file_writer;
             FileWriterOptions opts {.sync_file_data = false};
-            RETURN_IF_ERROR(fs->create_file(tmp_file, &file_writer, &opts));
+            st = fs->create_file(tmp_file, &file_writer, &opts);
+            if (st.is<ErrorCode::NOT_FOUND>()) {
+                // the empty dir was just removed in background after the last block of the key
+                // was deleted, create it again
+                st = fs->create_directory(dir, false);
+                if (!st.ok() && !st.is<ErrorCode::ALREADY_EXIST>()) {
+                    return st;
+                }
+                st = fs->create_file(tmp_file, &file_writer, &opts);
+            }
+            RETURN_IF_ERROR(st);
             writer = file_writer.get();
             _key_to_writer.emplace(file_writer_map_key, std::move(file_writer));
         }
@@ -171,6 +199,19 @@ Status FSFileCacheStorage::read(const FileCacheKey& key, size_t value_offset, Sl
 Status FSFileCacheStorage::remove(const FileCacheKey& key) {
     std::string dir = get_path_in_local_cache(key.hash, key.meta.expiration_time);
     std::string file = get_path_in_local_cache(dir, key.offset, key.meta.type);
+    if (config::enable_file_cache_async_remove) {
+        // the block is removed under the cache lock, only rename it away so that its offset can
+        // be downloaded again at once, freeing the extents and the empty dir is left to background
+        std::string deleted_file = get_deleted_path_in_local_cache(dir, key.offset);
+        RETURN_IF_ERROR(fs->rename(file, deleted_file));
+        FDCache::instance()->remove_file_reader(std::make_pair(key.hash, key.offset));
+        {
+            std::lock_guard lock(_remove_mtx);
+            _deleted_files.emplace_back(std::move(dir), std::move(deleted_file));
+        }
+        _remove_cv.notify_one();
+        return Status::OK();
+    }
     RETURN_IF_ERROR(fs->delete_file(file));
     std::vector<FileInfo> files;
     bool exists {false};
@@ -183,6 +224,37 @@ Status FSFileCacheStorage::remove(const FileCacheKey& key) {
     return Status::OK();
 }
 
+void FSFileCacheStorage::remove_deleted_files() {
+    std::deque<std::pair<std::string, std::string>> deleted_files;
+    while (true) {
+        {
+            std::unique_lock lock(_remove_mtx);
+            _remove_cv.wait(lock, [this]() { return _close || !_deleted_files.empty(); });
+            deleted_files.swap(_deleted_files);
+        }
+        for (auto& [dir, file] : deleted_files) {
+            std::error_code ec;
+            std::filesystem::remove(file, ec);
+            // a block evicted twice in a row is queued twice for the same path
+            if (ec && ec != std::errc::no_such_file_or_directory) {
+                LOG(WARNING) << fmt::format("cannot remove {}: {}", file, ec.message());
+            }
+            // only removes the dir if it is empty, the key may have other blocks or a new one
+            std::filesystem::remove(dir, ec);
+        }
+        deleted_files.clear();
+        std::lock_guard lock(_remove_mtx);
+        if (_close && _deleted_files.empty()) {
+            return;
+        }
+    }
+}
+
+std::string FSFileCacheStorage::get_deleted_path_in_local_cache(const std::string& dir,
+                                                                size_t offset) {
+    return Path(dir) / (std::to_string(offset) + "_deleted");
+}
+
 Status FSFileCacheStorage::change_key_meta(const FileCacheKey& key, const KeyMeta& new_meta) {
     // TTL change
     if (key.meta.expiration_time != new_meta.expiration_time) {
@@ -338,7 +410,8 @@ std::string FSFileCacheStorage::get_version_path() const {
     return Path(_cache_base_path) / "version";
 }
 
-void FSFileCacheStorage::load_cache_info_into_memory(BlockFileCache* _mgr) const {
+void FSFileCacheStorage::load_cache_info_into_memory(BlockFileCache* _mgr,
+                                                     BlockKeySet* unverified) const {
     int scan_length = 10000;
     std::vector<BatchLoadArgs> batch_load_buffer;
     batch_load_buffer.reserve(scan_length);
@@ -347,6 +420,25 @@ void FSFileCacheStorage::load_cache_info_into_memory(BlockFileCache* _mgr) const
         auto f = [&](const BatchLoadArgs& args) {
             // in async load mode, a cell may be added twice.
             if (_mgr->_files.contains(args.hash) && _mgr->_files[args.hash].contains(args.offset)) {
+                if (args.is_tmp || unverified->erase({args.hash, args.offset}) == 0) {
+                    return;
+                }
+                // the block is changed after the meta snapshot was written, use the file instead
+                auto& cell = _mgr->_files[args.hash].find(args.offset)->second;
+                auto file_block = cell.file_block;
+                if (cell.size() == args.size && file_block->cache_type() == args.ctx.cache_type &&
+                    file_block->expiration_time() == args.ctx.expiration_time) {
+                    return;
+                }
+                if (!cell.releasable()) {
+                    return;
+                }
+                {
+                    std::lock_guard block_lock(file_block->_mutex);
+                    _mgr->remove(file_block, cache_lock, block_lock);
+                }
+                _mgr->add_cell(args.hash, args.ctx, args.offset, args.size,
+                               FileBlock::State::DOWNLOADED, cache_lock);
                 return;
             }
             // if the file is tmp, it means it is the old file and it should be removed
@@ -399,8 +491,8 @@ void FSFileCacheStorage::load_cache_info_into_memory(BlockFileCache* _mgr) const
                         offset = stoull(offset_with_suffix.substr(0, delim_pos1));
                         std::string suffix = offset_with_suffix.substr(delim_pos1 + 1);
                         // not need persistent anymore
-                        // if suffix is equals to "tmp", it should be removed too.
-                        if (suffix == "tmp") [[unlikely]] {
+                        // if suffix is equals to "tmp" or "deleted", it should be removed too.
+                        if (suffix == "tmp" || suffix == "deleted") [[unlikely]] {
                             is_tmp = true;
                         } else {
                             cache_type = BlockFileCache::string_to_cache_type(suffix);
@@ -487,6 +579,151 @@ void FSFileCacheStorage::load_cache_info_into_memory(BlockFileCache* _mgr) const
     TEST_SYNC_POINT_CALLBACK("BlockFileCache::TmpFile2");
 }
 
+std::string FSFileCacheStorage::get_meta_snapshot_path() const {
+    return Path(_cache_base_path) / "meta_snapshot";
+}
+
+// meta snapshot format:
+//     magic(4) | version(4) | number of blocks(8) | blocks | crc32c of blocks(4)
+// every block is hash(16) | expiration time(8) | offset(8) | size(8) | cache type(1)
+static constexpr uint32_t META_SNAPSHOT_MAGIC = 0x534d4346; // "FCMS"
+static constexpr uint32_t META_SNAPSHOT_VERSION = 1;
+static constexpr size_t META_SNAPSHOT_HEADER_SIZE = 16;
+static constexpr size_t META_SNAPSHOT_BLOCK_SIZE = 41;
+
+Status FSFileCacheStorage::write_meta_snapshot(BlockFileCache* _mgr) {
+    if (!_mgr->_lazy_open_done) {
+        // the blocks in memory are not complete yet
+        return Status::OK();
+    }
+    std::string blocks;
+    uint64_t num_blocks = 0;
+    {
+        std::lock_guard cache_lock(_mgr->_mutex);
+        for (const auto& [hash, offsets] : _mgr->_files) {
+            for (const auto& [offset, cell] : offsets) {
+                const auto& file_block = cell.file_block;
+                if (file_block->state() != FileBlock::State::DOWNLOADED) {
+                    continue;
+                }
+                put_fixed128_le(&blocks, hash.value_);
+                put_fixed64_le(&blocks, file_block->expiration_time());
+                put_fixed64_le(&blocks, offset);
+                put_fixed64_le(&blocks, cell.size());
+                blocks.push_back(static_cast<char>(file_block->cache_type()));
+                ++num_blocks;
+            }
+        }
+    }
+    std::string header;
+    put_fixed32_le(&header, META_SNAPSHOT_MAGIC);
+    put_fixed32_le(&header, META_SNAPSHOT_VERSION);
+    put_fixed64_le(&header, num_blocks);
+    std::string footer;
+    put_fixed32_le(&footer, crc32c::Value(blocks.data(), blocks.size()));
+
+    // write to a tmp file then rename it, so that a crash never leaves a partial snapshot
+    std::string snapshot_path = get_meta_snapshot_path();
+    std::string tmp_path = snapshot_path + "_tmp";
+    FileWriterPtr writer;
+    RETURN_IF_ERROR(fs->create_file(tmp_path, &writer));
+    std::vector<Slice> slices {header, blocks, footer};
+    RETURN_IF_ERROR(writer->appendv(slices.data(), slices.size()));
+    RETURN_IF_ERROR(writer->close());
+    return fs->rename(tmp_path, snapshot_path);
+}
+
+Status FSFileCacheStorage::load_meta_snapshot(BlockFileCache* _mgr, BlockKeySet* loaded) const {
+    std::string snapshot_path = get_meta_snapshot_path();
+    bool exists = false;
+    RETURN_IF_ERROR(fs->exists(snapshot_path, &exists));
+    if (!exists) {
+        return Status::OK();
+    }
+    int64_t file_size = -1;
+    RETURN_IF_ERROR(fs->file_size(snapshot_path, &file_size));
+    std::string buffer;
+    buffer.resize(file_size);
+    FileReaderSPtr reader;
+    RETURN_IF_ERROR(fs->open_file(snapshot_path, &reader));
+    size_t bytes_read = 0;
+    RETURN_IF_ERROR(reader->read_at(0, Slice(buffer.data(), file_size), &bytes_read));
+    RETURN_IF_ERROR(reader->close());
+
+    const auto* data = reinterpret_cast<const uint8_t*>(buffer.data());
+    auto snapshot_size = static_cast<size_t>(file_size);
+    if (snapshot_size < META_SNAPSHOT_HEADER_SIZE + 4 ||
+        decode_fixed32_le(data) != META_SNAPSHOT_MAGIC ||
+        decode_fixed32_le(data + 4) != META_SNAPSHOT_VERSION) {
+        return Status::Corruption("bad header of file cache meta snapshot {}", snapshot_path);
+    }
+    uint64_t num_blocks = decode_fixed64_le(data + 8);
+    size_t blocks_size = num_blocks * META_SNAPSHOT_BLOCK_SIZE;
+    if (snapshot_size != META_SNAPSHOT_HEADER_SIZE + blocks_size + 4) {
+        return Status::Corruption("bad size {} of file cache meta snapshot {}, {} blocks",
+                                  file_size, snapshot_path, num_blocks);
+    }
+    const uint8_t* blocks = data + META_SNAPSHOT_HEADER_SIZE;
+    if (crc32c::Value(reinterpret_cast<const char*>(blocks), blocks_size) !=
+        decode_fixed32_le(blocks + blocks_size)) {
+        return Status::Corruption("bad checksum of file cache meta snapshot {}", snapshot_path);
+    }
+
+    std::lock_guard cache_lock(_mgr->_mutex);
+    for (uint64_t i = 0; i < num_blocks; ++i) {
+        const uint8_t* block = blocks + i * META_SNAPSHOT_BLOCK_SIZE;
+        UInt128Wrapper hash(decode_fixed128_le(block));
+        CacheContext context;
+        context.query_id = TUniqueId();
+        context.expiration_time = decode_fixed64_le(block + 16);
+        uint64_t offset = decode_fixed64_le(block + 24);
+        uint64_t size = decode_fixed64_le(block + 32);
+        context.cache_type = static_cast<FileCacheType>(block[40]);
+        if (_mgr->_files.contains(hash) && _mgr->_files[hash].contains(offset)) {
+            continue;
+        }
+        _mgr->add_cell(hash, context, offset, size, FileBlock::State::DOWNLOADED, cache_lock);
+        loaded->emplace(hash, offset);
+    }
+    return Status::OK();
+}
+
+void FSFileCacheStorage::remove_unverified_blocks(BlockFileCache* _mgr,
+                                                  const BlockKeySet& unverified) const {
+    if (unverified.empty()) {
+        return;
+    }
+    size_t num_removed = 0;
+    std::lock_guard cache_lock(_mgr->_mutex);
+    for (const auto& [hash, offset] : unverified) {
+        auto it = _mgr->_files.find(hash);
+        if (it == _mgr->_files.end() || !it->second.contains(offset)) {
+            continue;
+        }
+        auto& cell = it->second.find(offset)->second;
+        if (!cell.releasable()) {
+            continue;
+        }
+        auto file_block = cell.file_block;
+        // the block may be downloaded again after the scan passed its dir
+        std::string file = get_path_in_local_cache(
+                get_path_in_local_cache(hash, file_block->expiration_time()), offset,
+                file_block->cache_type());
+        std::error_code ec;
+        if (std::filesystem::exists(file, ec) || ec) {
+            continue;
+        }
+        std::lock_guard block_lock(file_block->_mutex);
+        if (file_block->_download_state != FileBlock::State::DOWNLOADED) {
+            continue;
+        }
+        _mgr->remove(file_block, cache_lock, block_lock);
+        ++num_removed;
+    }
+    LOG_INFO("FileCache {} removed {} blocks of meta snapshot not found on disk",
+             _cache_base_path, num_removed);
+}
+
 void FSFileCacheStorage::load_blocks_directly_unlocked(BlockFileCache* mgr, const FileCacheKey& key,
                                                        std::lock_guard<std::mutex>& cache_lock) {
     // async load, can't find key, need to check exist.
@@ -524,7 +761,7 @@ void FSFileCacheStorage::load_blocks_directly_unlocked(BlockFileCache* mgr, cons
             } else {
                 offset = stoull(offset_with_suffix.substr(0, delim_pos1));
                 std::string suffix = offset_with_suffix.substr(delim_pos1 + 1);
-                if (suffix == "tmp") [[unlikely]] {
+                if (suffix == "tmp" || suffix == "deleted") [[unlikely]] {
                     is_tmp = true;
                 } else {
                     cache_type = BlockFileCache::string_to_cache_type(suffix);
@@ -575,6 +812,14 @@ FSFileCacheStorage::~FSFileCacheStorage() {
     if (_cache_background_load_thread.joinable()) {
         _cache_background_load_thread.join();
     }
+    {
+        std::lock_guard lock(_remove_mtx);
+        _close = true;
+    }
+    _remove_cv.notify_all();
+    if (_cache_background_remove_thread.joinable()) {
+        _cache_background_remove_thread.join();
+    }
 }
 
 } // namespace doris::io
@@ -17,9 +17,12 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <deque>
 #include <memory>
 #include <shared_mutex>
 #include <thread>
+#include <unordered_set>
 
 #include "io/cache/file_cache_common.h"
 #include "io/cache/file_cache_storage.h"
@@ -68,6 +71,7 @@ public:
     Status change_key_meta(const FileCacheKey& key, const KeyMeta& new_meta) override;
     void load_blocks_directly_unlocked(BlockFileCache* _mgr, const FileCacheKey& key,
                                        std::lock_guard<std::mutex>& cache_lock) override;
+    Status write_meta_snapshot(BlockFileCache* _mgr) override;
 
     [[nodiscard]] static std::string get_path_in_local_cache(const std::string& dir, size_t offset,
                                                              FileCacheType type,
@@ -76,6 +80,10 @@ public:
     [[nodiscard]] std::string get_path_in_local_cache(const UInt128Wrapper&,
                                                       uint64_t expiration_time) const;
 
+    // the path a removed block is renamed to before it is deleted in background
+    [[nodiscard]] static std::string get_deleted_path_in_local_cache(const std::string& dir,
+                                                                     size_t offset);
+
 private:
     Status rebuild_data_structure() const;
 
@@ -85,7 +93,23 @@ private:
 
     [[nodiscard]] std::string get_version_path() const;
 
-    void load_cache_info_into_memory(BlockFileCache* _mgr) const;
+    [[nodiscard]] std::string get_meta_snapshot_path() const;
+
+    using BlockKeySet = std::unordered_set<AccessKeyAndOffset, KeyAndOffsetHash>;
+
+    // add the blocks in the meta snapshot written by write_meta_snapshot() and put their keys into
+    // `loaded`, they are verified by the scan of load_cache_info_into_memory() later
+    Status load_meta_snapshot(BlockFileCache* _mgr, BlockKeySet* loaded) const;
+
+    // `unverified` is the keys of the blocks loaded from the meta snapshot, the ones found by the
+    // scan are erased from it
+    void load_cache_info_into_memory(BlockFileCache* _mgr, BlockKeySet* unverified) const;
+
+    // remove the blocks loaded from the meta snapshot whose files are gone
+    void remove_unverified_blocks(BlockFileCache* _mgr, const BlockKeySet& unverified) const;
+
+    // delete the files renamed by remove() and their dirs once empty
+    void remove_deleted_files();
 
     using FileWriterMapKey = std::pair<UInt128Wrapper, size_t>;
     struct FileWriterMapKeyHash {
@@ -106,6 +130,13 @@ private:
     // TODO(Lchangliang): use a more efficient data structure
     std::mutex _mtx;
     std::unordered_map<FileWriterMapKey, FileWriterPtr, FileWriterMapKeyHash> _key_to_writer;
+
+    std::thread _cache_background_remove_thread;
+    std::mutex _remove_mtx;
+    std::condition_variable _remove_cv;
+    bool _close = false;
+    // <dir, file> of the removed blocks not deleted yet
+    std::deque<std::pair<std::string, std::string>> _deleted_files;
 };
 
 } // namespace doris::io
@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "io/fs/benchmark/hdfs_benchmark.hpp"
+#include "io/fs/benchmark/io_path_benchmark.hpp"
 #include "io/fs/benchmark/s3_benchmark.hpp"
 
 namespace doris::io {
@@ -37,6 +38,20 @@ Status BenchmarkFactory::getBm(const std::string fs_type, const std::string op_t
                                int64_t threads, int64_t iterations, size_t file_size,
                                const std::map<std::string, std::string>& conf_map,
                                BaseBenchmark** bm) {
+    if (fs_type == "s3" || fs_type == "hdfs") {
+        // the read paths of the scanners, which work on both file systems
+        if (op_type == "cached_read") {
+            *bm = new CachedReadBenchmark(fs_type, threads, iterations, file_size, conf_map);
+            return Status::OK();
+        } else if (op_type == "merge_read") {
+            *bm = new MergeRangeReadBenchmark(fs_type, threads, iterations, file_size, conf_map);
+            return Status::OK();
+        } else if (op_type == "prefetch_buffered_read") {
+            *bm = new PrefetchBufferedReadBenchmark(fs_type, threads, iterations, file_size,
+                                                    conf_map);
+            return Status::OK();
+        }
+    }
     if (fs_type == "s3") {
         if (op_type == "create_write") {
             *bm = new S3CreateWriteBenchmark(threads, iterations, file_size, conf_map);
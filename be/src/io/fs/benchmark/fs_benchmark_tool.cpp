@@ -26,7 +26,8 @@
 
 DEFINE_string(fs_type, "hdfs", "Supported File System: s3, hdfs");
 DEFINE_string(operation, "create_write",
-              "Supported Operations: create_write, open_read, open, rename, delete, exists");
+              "Supported Operations: create_write, open_read, open, rename, delete, exists, "
+              "cached_read, merge_read, prefetch_buffered_read");
 DEFINE_string(threads, "1", "Number of threads");
 DEFINE_string(iterations, "1", "Number of runs of each thread");
 DEFINE_string(repetitions, "1", "Number of iterations");
@@ -48,6 +49,12 @@ std::string get_usage(const std::string& progname) {
     ss << "\nop_type:\n";
     ss << "     read\n";
     ss << "     write\n";
+    ss << "     cached_read: random reads through the file cache, conf: file_path, cache_path,\n"
+          "         cache_capacity, cache_mode(cold, warm, churn), read_size, read_count\n";
+    ss << "     merge_read: parquet like reads through MergeRangeFileReader, conf: file_path,\n"
+          "         row_group_size, num_columns, read_columns, read_size\n";
+    ss << "     prefetch_buffered_read: sequential reads through PrefetchBufferedReader, conf:\n"
+          "         file_path, buffer_size, read_size, read_count\n";
     ss << "\nthreads:\n";
     ss << "     num of threads\n";
     ss << "\niterations:\n";
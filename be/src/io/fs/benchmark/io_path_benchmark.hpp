@@ -0,0 +1,327 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <random>
+
+#include "io/cache/block_file_cache_factory.h"
+#include "io/file_factory.h"
+#include "io/fs/benchmark/base_benchmark.h"
+#include "io/fs/buffered_reader.h"
+#include "io/hdfs_builder.h"
+#include "io/io_common.h"
+#include "runtime/exec_env.h"
+#include "util/slice.h"
+
+namespace doris::io {
+
+// Benchmarks of the read paths of the scanners on top of a remote file, which is "file_path" of
+// the conf on s3 or hdfs. Each of them reads "read_count" ranges of "read_size" bytes in one
+// iteration, and reports the throughput and the p50/p99/p999 latency of the reads.
+class IOPathBenchmark : public BaseBenchmark {
+public:
+    IOPathBenchmark(const std::string& name, const std::string& fs_type, int threads,
+                    int iterations, size_t file_size,
+                    const std::map<std::string, std::string>& conf_map)
+            : BaseBenchmark(name, threads, iterations, file_size, conf_map), _fs_type(fs_type) {
+        _read_size = _conf_map.contains("read_size") ? std::stol(_conf_map["read_size"])
+                                                      : 64 * 1024L;
+        _read_count = _conf_map.contains("read_count") ? std::stol(_conf_map["read_count"])
+                                                        : 1000L;
+    }
+    ~IOPathBenchmark() override = default;
+
+    std::string get_file_path(benchmark::State& state) override { return _conf_map["file_path"]; }
+
+protected:
+    Result<FileReaderSPtr> create_reader(const FileReaderOptions& reader_opts) {
+        FileSystemProperties fs_props;
+        if (_fs_type == "s3") {
+            fs_props.system_type = TFileType::FILE_S3;
+            fs_props.properties = _conf_map;
+        } else {
+            fs_props.system_type = TFileType::FILE_HDFS;
+            fs_props.hdfs_params = parse_properties(_conf_map);
+        }
+        FileDescription fd;
+        fd.path = _conf_map["file_path"];
+        fd.file_size = _file_size > 0 ? _file_size : -1;
+        return FileFactory::create_file_reader(fs_props, fd, reader_opts, nullptr);
+    }
+
+    // _read_count ranges of _read_size bytes at random offsets of [0, file_size)
+    std::vector<PrefetchRange> random_ranges(size_t file_size, uint32_t seed) const {
+        std::vector<PrefetchRange> ranges;
+        if (file_size <= _read_size) {
+            ranges.emplace_back(0, file_size);
+            return ranges;
+        }
+        std::mt19937_64 rng(seed);
+        std::uniform_int_distribution<size_t> dist(0, file_size - _read_size);
+        for (size_t i = 0; i < _read_count; ++i) {
+            size_t offset = dist(rng);
+            ranges.emplace_back(offset, offset + _read_size);
+        }
+        return ranges;
+    }
+
+    Status read_ranges(benchmark::State& state, FileReader* reader,
+                       const std::vector<PrefetchRange>& ranges, const IOContext* io_ctx) {
+        size_t max_size = 0;
+        for (const auto& range : ranges) {
+            max_size = std::max(max_size, range.end_offset - range.start_offset);
+        }
+        std::vector<char> buffer(max_size);
+        std::vector<double> latencies_us;
+        latencies_us.reserve(ranges.size());
+        size_t read_bytes = 0;
+
+        Status status;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (const auto& range : ranges) {
+            size_t bytes_read = 0;
+            auto read_start = std::chrono::high_resolution_clock::now();
+            status = reader->read_at(range.start_offset,
+                                     Slice(buffer.data(), range.end_offset - range.start_offset),
+                                     &bytes_read, io_ctx);
+            auto read_end = std::chrono::high_resolution_clock::now();
+            if (!status.ok()) {
+                bm_log("reader read_at error: {}", status.to_string());
+                break;
+            }
+            latencies_us.push_back(
+                    std::chrono::duration<double, std::micro>(read_end - read_start).count());
+            read_bytes += bytes_read;
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        auto elapsed_seconds =
+                std::chrono::duration_cast<std::chrono::duration<double>>(end - start);
+        state.SetIterationTime(elapsed_seconds.count());
+        state.counters["ReadRate(B/S)"] =
+                benchmark::Counter(read_bytes, benchmark::Counter::kIsRate);
+        state.counters["ReadTotal(B)"] = read_bytes;
+        state.counters["ReadTime(S)"] = elapsed_seconds.count();
+        set_latency_counters(state, &latencies_us);
+        bm_log("finish to read {}, thread: {}, size {}, seconds: {}, status: {}", _name,
+               state.thread_index(), read_bytes, elapsed_seconds.count(), status);
+        return status;
+    }
+
+    // Latencies are averaged over the threads, instead of being summed like the other counters.
+    static void set_latency_counters(benchmark::State& state, std::vector<double>* latencies_us) {
+        if (latencies_us->empty()) {
+            return;
+        }
+        std::sort(latencies_us->begin(), latencies_us->end());
+        auto percentile = [&](double p) {
+            size_t index = std::min(latencies_us->size() - 1,
+                                    static_cast<size_t>(p * latencies_us->size()));
+            return (*latencies_us)[index];
+        };
+        state.counters["P50Latency(us)"] =
+                benchmark::Counter(percentile(0.5), benchmark::Counter::kAvgThreads);
+        state.counters["P99Latency(us)"] =
+                benchmark::Counter(percentile(0.99), benchmark::Counter::kAvgThreads);
+        state.counters["P999Latency(us)"] =
+                benchmark::Counter(percentile(0.999), benchmark::Counter::kAvgThreads);
+    }
+
+    std::string _fs_type;
+    size_t _read_size;
+    size_t _read_count;
+};
+
+// Random reads through CachedRemoteFileReader and the file cache at "cache_path" of the conf,
+// "cache_mode" is one of:
+//   cold:  the cache is cleared before each iteration, so all reads miss the cache
+//   warm:  the ranges are read once before the first iteration, so all reads hit the cache
+//   churn: each iteration reads new random ranges, set "cache_capacity" less than the file
+//          size to benchmark the reads with cache eviction
+class CachedReadBenchmark : public IOPathBenchmark {
+public:
+    CachedReadBenchmark(const std::string& fs_type, int threads, int iterations,
+                        size_t file_size, const std::map<std::string, std::string>& conf_map)
+            : IOPathBenchmark("CachedReadBenchmark", fs_type, threads, iterations, file_size,
+                              conf_map) {
+        _cache_mode = _conf_map.contains("cache_mode") ? _conf_map["cache_mode"] : "warm";
+    }
+    ~CachedReadBenchmark() override = default;
+
+    Status init() override {
+        std::call_once(_init_flag, [this]() { _init_status = _init_cache(); });
+        return _init_status;
+    }
+
+    Status run(benchmark::State& state) override {
+        FileReaderOptions reader_opts;
+        reader_opts.cache_type = FileCachePolicy::FILE_BLOCK_CACHE;
+        auto reader = DORIS_TRY(create_reader(reader_opts));
+        FileCacheStatistics cache_stats;
+        IOContext io_ctx;
+        io_ctx.file_cache_stats = &cache_stats;
+
+        uint32_t seed = state.thread_index();
+        if (_cache_mode == "cold") {
+            FileCacheFactory::instance()->clear_file_caches(true);
+        } else if (_cache_mode == "churn") {
+            seed += _num_runs.fetch_add(1) * _threads;
+        } else if (_cache_mode == "warm") {
+            // not timed, fill the cache with the ranges to read
+            RETURN_IF_ERROR(_read_silently(reader.get(), random_ranges(reader->size(), seed),
+                                           &io_ctx));
+            cache_stats = FileCacheStatistics();
+        }
+        auto ranges = random_ranges(reader->size(), seed);
+        RETURN_IF_ERROR(read_ranges(state, reader.get(), ranges, &io_ctx));
+        int64_t num_io = cache_stats.num_local_io_total + cache_stats.num_remote_io_total;
+        state.counters["CacheHitRatio"] = benchmark::Counter(
+                num_io == 0 ? 0 : (double)cache_stats.num_local_io_total / num_io,
+                benchmark::Counter::kAvgThreads);
+        state.counters["BytesWriteIntoCache(B)"] = cache_stats.bytes_write_into_cache;
+        return reader->close();
+    }
+
+private:
+    Status _init_cache() {
+        if (!_conf_map.contains("cache_path")) {
+            return Status::InvalidArgument("cache_path is required by {}", _name);
+        }
+        size_t capacity = _conf_map.contains("cache_capacity")
+                                  ? std::stol(_conf_map["cache_capacity"])
+                                  : 1024L * 1024 * 1024;
+        return FileCacheFactory::instance()->create_file_cache(
+                _conf_map["cache_path"], get_file_cache_settings(capacity, 0));
+    }
+
+    Status _read_silently(FileReader* reader, const std::vector<PrefetchRange>& ranges,
+                          const IOContext* io_ctx) {
+        std::vector<char> buffer(_read_size);
+        for (const auto& range : ranges) {
+            size_t bytes_read = 0;
+            RETURN_IF_ERROR(reader->read_at(
+                    range.start_offset, Slice(buffer.data(), range.end_offset - range.start_offset),
+                    &bytes_read, io_ctx));
+        }
+        return Status::OK();
+    }
+
+    std::string _cache_mode;
+    std::once_flag _init_flag;
+    Status _init_status;
+    std::atomic<uint32_t> _num_runs {0};
+};
+
+// Reads through MergeRangeFileReader in the pattern of a parquet reader: the file is split into
+// row groups of "row_group_size" bytes with "num_columns" column chunks each, and "read_columns"
+// of them are read interleaved in pieces of read_size bytes, like pages read batch by batch.
+class MergeRangeReadBenchmark : public IOPathBenchmark {
+public:
+    MergeRangeReadBenchmark(const std::string& fs_type, int threads, int iterations,
+                            size_t file_size, const std::map<std::string, std::string>& conf_map)
+            : IOPathBenchmark("MergeRangeReadBenchmark", fs_type, threads, iterations, file_size,
+                              conf_map) {
+        _row_group_size = _conf_map.contains("row_group_size")
+                                  ? std::stol(_conf_map["row_group_size"])
+                                  : 128 * 1024 * 1024L;
+        _num_columns = _conf_map.contains("num_columns") ? std::stol(_conf_map["num_columns"])
+                                                          : 20L;
+        _read_columns = _conf_map.contains("read_columns") ? std::stol(_conf_map["read_columns"])
+                                                            : 5L;
+        _read_columns = std::max<size_t>(1, std::min(_read_columns, _num_columns));
+    }
+    ~MergeRangeReadBenchmark() override = default;
+
+    Status run(benchmark::State& state) override {
+        auto reader = DORIS_TRY(create_reader(FileReaderOptions::DEFAULT));
+        size_t file_size = reader->size();
+        size_t chunk_size = _row_group_size / _num_columns;
+        size_t column_step = _num_columns / _read_columns;
+        if (chunk_size == 0) {
+            return Status::InvalidArgument("row_group_size is less than num_columns");
+        }
+
+        std::vector<PrefetchRange> chunks;
+        std::vector<PrefetchRange> pieces;
+        for (size_t rg_start = 0; rg_start < file_size; rg_start += _row_group_size) {
+            size_t first = chunks.size();
+            for (size_t col = 0; col < _num_columns; col += column_step) {
+                size_t start = rg_start + col * chunk_size;
+                if (start >= file_size || chunks.size() - first == _read_columns) {
+                    break;
+                }
+                chunks.emplace_back(start, std::min(file_size, start + chunk_size));
+            }
+            for (size_t piece = 0; piece < chunk_size; piece += _read_size) {
+                for (size_t i = first; i < chunks.size(); ++i) {
+                    size_t start = chunks[i].start_offset + piece;
+                    if (start < chunks[i].end_offset) {
+                        pieces.emplace_back(start,
+                                            std::min(chunks[i].end_offset, start + _read_size));
+                    }
+                }
+            }
+        }
+        auto merge_reader = std::make_shared<MergeRangeFileReader>(nullptr, reader, chunks);
+        IOContext io_ctx;
+        RETURN_IF_ERROR(read_ranges(state, merge_reader.get(), pieces, &io_ctx));
+        return merge_reader->close();
+    }
+
+private:
+    size_t _row_group_size;
+    size_t _num_columns;
+    size_t _read_columns;
+};
+
+// Sequential reads of read_size bytes through PrefetchBufferedReader, "buffer_size" of the conf
+// is the size of each prefetch buffer.
+class PrefetchBufferedReadBenchmark : public IOPathBenchmark {
+public:
+    PrefetchBufferedReadBenchmark(const std::string& fs_type, int threads, int iterations,
+                                  size_t file_size,
+                                  const std::map<std::string, std::string>& conf_map)
+            : IOPathBenchmark("PrefetchBufferedReadBenchmark", fs_type, threads, iterations,
+                              file_size, conf_map) {}
+    ~PrefetchBufferedReadBenchmark() override = default;
+
+    Status run(benchmark::State& state) override {
+        if (ExecEnv::GetInstance()->buffered_reader_prefetch_thread_pool() == nullptr) {
+            return Status::InternalError("buffered reader prefetch thread pool is not inited");
+        }
+        auto reader = DORIS_TRY(create_reader(FileReaderOptions::DEFAULT));
+        size_t file_size = reader->size();
+        int64_t buffer_size =
+                _conf_map.contains("buffer_size") ? std::stol(_conf_map["buffer_size"]) : -1L;
+        IOContext io_ctx;
+        auto prefetch_reader = std::make_shared<PrefetchBufferedReader>(
+                nullptr, reader, PrefetchRange(0, file_size), &io_ctx, buffer_size);
+
+        std::vector<PrefetchRange> ranges;
+        for (size_t offset = 0; offset < file_size && ranges.size() < _read_count;
+             offset += _read_size) {
+            ranges.emplace_back(offset, std::min(file_size, offset + _read_size));
+        }
+        RETURN_IF_ERROR(read_ranges(state, prefetch_reader.get(), ranges, &io_ctx));
+        return prefetch_reader->close();
+    }
+};
+
+} // namespace doris::io
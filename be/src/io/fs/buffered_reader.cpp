@@ -27,6 +27,8 @@
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "common/config.h"
 #include "common/status.h"
+#include "io/fs/hdfs_file_reader.h"
+#include "io/fs/local_file_reader.h"
 #include "runtime/exec_env.h"
 #include "util/runtime_profile.h"
 #include "util/threadpool.h"
@@ -41,6 +43,66 @@ bvar::PerSecond<bvar::Adder<uint64_t>> g_bytes_downloaded_per_second("buffered_r
                                                                      "bytes_downloaded_per_second",
                                                                      &g_bytes_downloaded, 60);
 
+IOCostEstimator* IOCostEstimator::instance(StorageKind kind) {
+    // initial estimates: 20ms and 100MB/s for object storage, 1ms and 100MB/s for hdfs,
+    // 100us and 1GB/s for local disk
+    static IOCostEstimator estimators[] = {
+            {20000, 100L * 1024 * 1024},
+            {1000, 100L * 1024 * 1024},
+            {100, 1024L * 1024 * 1024},
+            {1000, 100L * 1024 * 1024},
+    };
+    return &estimators[kind];
+}
+
+IOCostEstimator::StorageKind IOCostEstimator::storage_kind(const io::FileReader* reader) {
+    if (typeid_cast<const io::S3FileReader*>(reader) != nullptr) {
+        return OSS;
+    }
+    if (typeid_cast<const io::HdfsFileReader*>(reader) != nullptr) {
+        return HDFS;
+    }
+    if (typeid_cast<const io::LocalFileReader*>(reader) != nullptr) {
+        return LOCAL;
+    }
+    return OTHER;
+}
+
+void IOCostEstimator::update(size_t bytes, int64_t elapsed_ns) {
+    // exponential moving averages, each new sample weighs 1/8
+    int64_t elapsed_us = std::max<int64_t>(elapsed_ns / 1000, 1);
+    if (bytes <= LATENCY_IO_SIZE) {
+        int64_t latency = _latency_us.load(std::memory_order_relaxed);
+        _latency_us.store(std::max<int64_t>(latency + (elapsed_us - latency) / 8, 1),
+                          std::memory_order_relaxed);
+    } else if (bytes >= BANDWIDTH_IO_SIZE) {
+        int64_t transfer_us = elapsed_us - _latency_us.load(std::memory_order_relaxed);
+        if (transfer_us <= 0) {
+            return;
+        }
+        auto bandwidth = static_cast<int64_t>(bytes * 1000000 / transfer_us);
+        int64_t old_bandwidth = _bytes_per_second.load(std::memory_order_relaxed);
+        _bytes_per_second.store(
+                std::max<int64_t>(old_bandwidth + (bandwidth - old_bandwidth) / 8, 1),
+                std::memory_order_relaxed);
+    }
+}
+
+Status MergeRangeFileReader::_read_from_reader(size_t offset, Slice result, size_t* bytes_read,
+                                               const IOContext* io_ctx) {
+    int64_t read_time = 0;
+    Status st;
+    {
+        SCOPED_RAW_TIMER(&read_time);
+        st = _reader->read_at(offset, result, bytes_read, io_ctx);
+    }
+    _statistics.read_time += read_time;
+    if (st.ok()) {
+        _cost_estimator->update(*bytes_read, read_time);
+    }
+    return st;
+}
+
 Status MergeRangeFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
                                           const IOContext* io_ctx) {
     _statistics.request_io++;
@@ -50,8 +112,7 @@ Status MergeRangeFileReader::read_at_impl(size_t offset, Slice result, size_t* b
     }
     const int range_index = _search_read_range(offset, offset + result.size);
     if (range_index < 0) {
-        SCOPED_RAW_TIMER(&_statistics.read_time);
-        Status st = _reader->read_at(offset, result, bytes_read, io_ctx);
+        Status st = _read_from_reader(offset, result, bytes_read, io_ctx);
         _statistics.merged_io++;
         _statistics.request_bytes += *bytes_read;
         _statistics.merged_bytes += *bytes_read;
@@ -84,10 +145,9 @@ Status MergeRangeFileReader::read_at_impl(size_t offset, Slice result, size_t* b
 
     size_t to_read = result.size - has_read;
     if (to_read >= SMALL_IO || to_read >= _remaining) {
-        SCOPED_RAW_TIMER(&_statistics.read_time);
         size_t read_size = 0;
-        RETURN_IF_ERROR(_reader->read_at(offset + has_read, Slice(result.data + has_read, to_read),
-                                         &read_size, io_ctx));
+        RETURN_IF_ERROR(_read_from_reader(offset + has_read, Slice(result.data + has_read, to_read),
+                                          &read_size, io_ctx));
         *bytes_read = has_read + read_size;
         _statistics.merged_io++;
         _statistics.request_bytes += read_size;
@@ -152,6 +212,7 @@ Status MergeRangeFileReader::read_at_impl(size_t offset, Slice result, size_t* b
     content_size = 0;
     hollow_size = 0;
     std::vector<std::pair<double, size_t>> ratio_and_size;
+    std::vector<size_t> hollow_sizes;
     // Calculate the read amplified ratio for each merge operation and the size of the merged data.
     // Find the largest size of the merged data whose amplified ratio is less than config::max_amplified_read_ratio
     for (const std::pair<size_t, bool>& slice : merged_slice) {
@@ -160,29 +221,41 @@ Status MergeRangeFileReader::read_at_impl(size_t offset, Slice result, size_t* b
             if (slice.first > 0) {
                 ratio_and_size.emplace_back((double)hollow_size / content_size,
                                             content_size + hollow_size);
+                hollow_sizes.emplace_back(hollow_size);
             }
         } else {
             hollow_size += slice.first;
         }
     }
     size_t best_merged_size = 0;
+    size_t best_index = 0;
+    // merging i + 1 ranges saves i IOs, it is worth when reading the hollow data takes less time
+    // than the latency of the IOs saved
+    const bool use_cost_model = config::enable_merged_io_cost_model;
+    const size_t break_even_bytes = use_cost_model ? _cost_estimator->break_even_bytes() : 0;
     for (int i = 0; i < ratio_and_size.size(); ++i) {
         const std::pair<double, size_t>& rs = ratio_and_size[i];
         size_t equivalent_size = rs.second / (i + 1);
         if (rs.second > best_merged_size) {
-            if (rs.first <= _max_amplified_ratio ||
-                (_max_amplified_ratio < 1 && equivalent_size <= _equivalent_io_size)) {
+            if (use_cost_model ? hollow_sizes[i] <= i * break_even_bytes
+                               : (rs.first <= _max_amplified_ratio ||
+                                  (_max_amplified_ratio < 1 &&
+                                   equivalent_size <= _equivalent_io_size))) {
                 best_merged_size = rs.second;
+                best_index = i;
             }
         }
     }
+    if (best_merged_size > 0) {
+        _statistics.hollow_bytes += hollow_sizes[best_index];
+        _statistics.merged_gaps += best_index;
+    }
 
     if (best_merged_size == to_read) {
         // read directly to avoid copy operation
-        SCOPED_RAW_TIMER(&_statistics.read_time);
         size_t read_size = 0;
-        RETURN_IF_ERROR(_reader->read_at(offset + has_read, Slice(result.data + has_read, to_read),
-                                         &read_size, io_ctx));
+        RETURN_IF_ERROR(_read_from_reader(offset + has_read, Slice(result.data + has_read, to_read),
+                                          &read_size, io_ctx));
         *bytes_read = has_read + read_size;
         _statistics.merged_io++;
         _statistics.request_bytes += read_size;
@@ -309,13 +382,10 @@ Status MergeRangeFileReader::_fill_box(int range_index, size_t start_offset, siz
         _read_slice = new char[READ_SLICE_SIZE];
     }
     *bytes_read = 0;
-    {
-        SCOPED_RAW_TIMER(&_statistics.read_time);
-        RETURN_IF_ERROR(
-                _reader->read_at(start_offset, Slice(_read_slice, to_read), bytes_read, io_ctx));
-        _statistics.merged_io++;
-        _statistics.merged_bytes += *bytes_read;
-    }
+    RETURN_IF_ERROR(
+            _read_from_reader(start_offset, Slice(_read_slice, to_read), bytes_read, io_ctx));
+    _statistics.merged_io++;
+    _statistics.merged_bytes += *bytes_read;
 
     SCOPED_RAW_TIMER(&_statistics.copy_time);
     size_t copy_start = start_offset;
@@ -20,6 +20,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <atomic>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
@@ -55,6 +56,45 @@ struct PrefetchRange {
     PrefetchRange() : start_offset(0), end_offset(0) {}
 };
 
+/**
+ * Estimates the latency and the bandwidth of one kind of storage from the reads issued by
+ * MergeRangeFileReader, which merges the gap between two ranges only when reading the gap takes
+ * less time than the extra IO it saves. The estimates are shared by all the readers of the same
+ * kind of storage and updated without lock, a lost update does not matter.
+ */
+class IOCostEstimator {
+public:
+    enum StorageKind { OSS = 0, HDFS = 1, LOCAL = 2, OTHER = 3 };
+
+    static IOCostEstimator* instance(StorageKind kind);
+
+    static StorageKind storage_kind(const io::FileReader* reader);
+
+    IOCostEstimator(int64_t latency_us, int64_t bytes_per_second)
+            : _latency_us(latency_us), _bytes_per_second(bytes_per_second) {}
+
+    // the read of `bytes` takes `elapsed_ns`
+    void update(size_t bytes, int64_t elapsed_ns);
+
+    // the number of bytes whose transfer takes as long as the latency of one IO
+    size_t break_even_bytes() const {
+        return _latency_us.load(std::memory_order_relaxed) *
+               _bytes_per_second.load(std::memory_order_relaxed) / 1000000;
+    }
+
+    int64_t latency_us() const { return _latency_us.load(std::memory_order_relaxed); }
+    int64_t bytes_per_second() const { return _bytes_per_second.load(std::memory_order_relaxed); }
+
+private:
+    // the reads not larger than it mostly wait for the latency
+    static constexpr size_t LATENCY_IO_SIZE = 64 * 1024;
+    // the reads not smaller than it mostly wait for the transfer
+    static constexpr size_t BANDWIDTH_IO_SIZE = 1024 * 1024;
+
+    std::atomic<int64_t> _latency_us;
+    std::atomic<int64_t> _bytes_per_second;
+};
+
 /**
  * A FileReader that efficiently supports random access format like parquet and orc.
  * In order to merge small IO in parquet and orc, the random access ranges should be generated
@@ -82,6 +122,9 @@ public:
         int64_t request_bytes = 0;
         int64_t merged_bytes = 0;
         int64_t apply_bytes = 0;
+        // bytes read in the gaps between ranges by merged IOs
+        int64_t hollow_bytes = 0;
+        int64_t merged_gaps = 0;
     };
 
     struct RangeCachedData {
@@ -147,6 +190,7 @@ public:
         // 1MB for oss, 8KB for hdfs
         _equivalent_io_size =
                 _is_oss ? config::merged_oss_min_io_size : config::merged_hdfs_min_io_size;
+        _cost_estimator = IOCostEstimator::instance(IOCostEstimator::storage_kind(_reader.get()));
         for (const PrefetchRange& range : _random_access_ranges) {
             _statistics.apply_bytes += range.end_offset - range.start_offset;
         }
@@ -165,6 +209,10 @@ public:
                                                          random_profile, 1);
             _apply_bytes = ADD_CHILD_COUNTER_WITH_LEVEL(_profile, "ApplyBytes", TUnit::BYTES,
                                                         random_profile, 1);
+            _hollow_bytes = ADD_CHILD_COUNTER_WITH_LEVEL(_profile, "HollowBytes", TUnit::BYTES,
+                                                         random_profile, 1);
+            _merged_gaps = ADD_CHILD_COUNTER_WITH_LEVEL(_profile, "MergedGaps", TUnit::UNIT,
+                                                        random_profile, 1);
         }
     }
 
@@ -213,6 +261,8 @@ protected:
             COUNTER_UPDATE(_request_bytes, _statistics.request_bytes);
             COUNTER_UPDATE(_merged_bytes, _statistics.merged_bytes);
             COUNTER_UPDATE(_apply_bytes, _statistics.apply_bytes);
+            COUNTER_UPDATE(_hollow_bytes, _statistics.hollow_bytes);
+            COUNTER_UPDATE(_merged_gaps, _statistics.merged_gaps);
             if (_reader != nullptr) {
                 _reader->collect_profile_before_close();
             }
@@ -227,7 +277,12 @@ private:
     RuntimeProfile::Counter* _request_bytes = nullptr;
     RuntimeProfile::Counter* _merged_bytes = nullptr;
     RuntimeProfile::Counter* _apply_bytes = nullptr;
+    RuntimeProfile::Counter* _hollow_bytes = nullptr;
+    RuntimeProfile::Counter* _merged_gaps = nullptr;
 
+    // read from the inner reader, and feed the time it takes to the cost estimator
+    Status _read_from_reader(size_t offset, Slice result, size_t* bytes_read,
+                             const IOContext* io_ctx);
     int _search_read_range(size_t start_offset, size_t end_offset);
     void _clean_cached_data(RangeCachedData& cached_data);
     void _read_in_box(RangeCachedData& cached_data, size_t offset, Slice result,
@@ -252,6 +307,7 @@ private:
     bool _is_oss;
     double _max_amplified_ratio;
     size_t _equivalent_io_size;
+    IOCostEstimator* _cost_estimator;
 
     Statistics _statistics;
 };
@@ -18,6 +18,7 @@
 #include "io/fs/file_meta_cache.h"
 
 #include "vec/exec/format/parquet/parquet_thrift_util.h"
+#include "vec/exec/format/parquet/vparquet_bloom_filter.h"
 
 namespace doris {
 
@@ -33,10 +34,42 @@ Status FileMetaCache::get_parquet_footer(io::FileReaderSPtr file_reader, io::IOC
     } else {
         vectorized::FileMetaData* meta = nullptr;
         RETURN_IF_ERROR(vectorized::parse_thrift_footer(file_reader, &meta, meta_size, io_ctx));
-        _cache.insert({cache_key}, meta, handle);
+        // the footer is shared by all the queries reading this file, keep only what they need
+        meta->compact();
+        size_t mem_size = meta->get_mem_size();
+        size_t charge = _cache.lru_cache_type() == LRUCacheType::SIZE ? mem_size : 1;
+        _cache.insert({cache_key}, meta, handle, charge, mem_size);
     }
 
     return Status::OK();
 }
 
+Status FileMetaCache::get_parquet_bloom_filter(
+        io::FileReaderSPtr file_reader, io::IOContext* io_ctx, int64_t mtime, int64_t offset,
+        std::unique_ptr<vectorized::ParquetBloomFilter>* bloom_filter,
+        ObjLRUCache::CacheHandle* handle) {
+    if (_cache.lru_cache_type() != LRUCacheType::SIZE) {
+        // the bloom filters may be large, which are not limited by the number of entries
+        return vectorized::ParquetBloomFilter::read(file_reader, io_ctx, offset, bloom_filter);
+    }
+    ObjLRUCache::CacheHandle cache_handle;
+    std::string cache_key = file_reader->path().native() + std::to_string(mtime) + "_bf_" +
+                            std::to_string(offset);
+    if (_cache.lookup({cache_key}, &cache_handle)) {
+        *handle = std::move(cache_handle);
+        return Status::OK();
+    }
+    std::unique_ptr<vectorized::ParquetBloomFilter> bf;
+    RETURN_IF_ERROR(vectorized::ParquetBloomFilter::read(file_reader, io_ctx, offset, &bf));
+    size_t mem_size = bf->get_mem_size();
+    _cache.insert({cache_key}, bf.get(), &cache_handle, mem_size, mem_size);
+    if (cache_handle.valid()) {
+        bf.release();
+        *handle = std::move(cache_handle);
+    } else {
+        *bloom_filter = std::move(bf);
+    }
+    return Status::OK();
+}
+
 } // namespace doris
@@ -17,17 +17,24 @@
 
 #pragma once
 
+#include <memory>
+
 #include "io/fs/file_reader_writer_fwd.h"
 #include "util/obj_lru_cache.h"
 
 namespace doris {
+namespace vectorized {
+class ParquetBloomFilter;
+} // namespace vectorized
 
 // A file meta cache depends on a LRU cache.
-// Such as parsed parquet footer.
-// The capacity will limit the number of cache entries in cache.
+// Such as parsed parquet footer and bloom filters.
+// The capacity will limit the number of cache entries in cache, or the memory size of the
+// cached footers if the lru_cache_type is LRUCacheType::SIZE.
 class FileMetaCache {
 public:
-    FileMetaCache(int64_t capacity) : _cache(capacity) {}
+    FileMetaCache(int64_t capacity, LRUCacheType lru_cache_type = LRUCacheType::NUMBER)
+            : _cache(capacity, DEFAULT_LRU_CACHE_NUM_SHARDS, lru_cache_type) {}
 
     FileMetaCache(const FileMetaCache&) = delete;
     const FileMetaCache& operator=(const FileMetaCache&) = delete;
@@ -37,6 +44,14 @@ public:
     Status get_parquet_footer(io::FileReaderSPtr file_reader, io::IOContext* io_ctx, int64_t mtime,
                               size_t* meta_size, ObjLRUCache::CacheHandle* handle);
 
+    // Get the parsed bloom filter at `offset` of a parquet file. The bloom filters are cached
+    // only if the capacity limits the memory size, otherwise `*bloom_filter` owns the filter
+    // and `handle` is left invalid.
+    Status get_parquet_bloom_filter(io::FileReaderSPtr file_reader, io::IOContext* io_ctx,
+                                    int64_t mtime, int64_t offset,
+                                    std::unique_ptr<vectorized::ParquetBloomFilter>* bloom_filter,
+                                    ObjLRUCache::CacheHandle* handle);
+
     Status get_orc_footer() {
         // TODO: implement
         return Status::OK();
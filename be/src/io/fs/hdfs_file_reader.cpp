@@ -32,6 +32,7 @@
 #include "io/fs/err_utils.h"
 #include "io/hdfs_util.h"
 #include "service/backend_options.h"
+#include "util/bvar_helper.h"
 #include "util/doris_metrics.h"
 
 namespace doris::io {
@@ -132,6 +133,7 @@ Status HdfsFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_r
         return Status::OK();
     }
 
+    SCOPED_BVAR_LATENCY(hdfs_bvar::hdfs_read_latency);
     size_t has_read = 0;
     while (has_read < bytes_req) {
         tSize loop_read = hdfsPread(_handle->fs(), _handle->file(), offset + has_read,
@@ -196,6 +198,7 @@ Status HdfsFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_r
         return Status::OK();
     }
 
+    SCOPED_BVAR_LATENCY(hdfs_bvar::hdfs_read_latency);
     size_t has_read = 0;
     while (has_read < bytes_req) {
         int64_t loop_read =
@@ -21,27 +21,158 @@
 // IWYU pragma: no_include <bthread/errno.h>
 #include <bvar/bvar.h>
 #include <errno.h> // IWYU pragma: keep
+#include <fcntl.h>
 #include <fmt/format.h>
 #include <glog/logging.h>
+#include <sys/stat.h>
 #include <unistd.h>
 
 #include <algorithm>
 #include <atomic>
+#include <cstdlib>
 #include <cstring>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "common/sync_point.h"
+#include "gutil/macros.h"
 #include "io/fs/err_utils.h"
+#include "io/fs/local_io_scheduler.h"
+#include "io/io_common.h"
+#include "runtime/exec_env.h"
 #include "util/async_io.h"
+#include "util/defer_op.h"
 #include "util/doris_metrics.h"
+#include "util/threadpool.h"
+#include "util/time.h"
 
 namespace doris {
 namespace io {
 
+bvar::LatencyRecorder local_query_read_latency("local_file_reader", "query_read");
+bvar::Adder<int64_t> local_direct_io_read_bytes("local_file_reader", "direct_io_read_bytes");
+bvar::Adder<int64_t> local_direct_io_readahead_hit_bytes("local_file_reader",
+                                                         "direct_io_readahead_hit_bytes");
+
+static constexpr size_t DIRECT_IO_ALIGNMENT = 4096;
+
+static size_t align_down(size_t n) {
+    return n & ~(DIRECT_IO_ALIGNMENT - 1);
+}
+static size_t align_up(size_t n) {
+    return align_down(n + DIRECT_IO_ALIGNMENT - 1);
+}
+
+// Aligned buffers for the direct io reads, the buffers of local_direct_io_buffer_size bytes are
+// kept to be reused, so that reading a page does not allocate and fault in a new buffer.
+class DirectIOBufferPool {
+public:
+    static DirectIOBufferPool* instance() {
+        static DirectIOBufferPool pool;
+        return &pool;
+    }
+
+    ~DirectIOBufferPool() {
+        for (char* buf : _buffers) {
+            free(buf);
+        }
+    }
+
+    // Returns a buffer of at least `size` bytes, or nullptr if failed to allocate.
+    char* acquire(size_t size) {
+        if (size <= _buffer_size) {
+            std::lock_guard lock(_mutex);
+            if (!_buffers.empty()) {
+                char* buf = _buffers.back();
+                _buffers.pop_back();
+                return buf;
+            }
+            size = _buffer_size;
+        }
+        void* buf = nullptr;
+        if (posix_memalign(&buf, DIRECT_IO_ALIGNMENT, size) != 0) {
+            return nullptr;
+        }
+        return static_cast<char*>(buf);
+    }
+
+    // `size` must be the one passed to acquire()
+    void release(char* buf, size_t size) {
+        if (size <= _buffer_size) {
+            std::lock_guard lock(_mutex);
+            if (_buffers.size() < _max_num_buffers) {
+                _buffers.push_back(buf);
+                return;
+            }
+        }
+        free(buf);
+    }
+
+private:
+    DirectIOBufferPool()
+            : _buffer_size(align_up(config::local_direct_io_buffer_size)),
+              _max_num_buffers(config::local_direct_io_max_buffer_num) {}
+
+    const size_t _buffer_size;
+    const size_t _max_num_buffers;
+    std::mutex _mutex;
+    std::vector<char*> _buffers;
+};
+
+// The O_DIRECT fd and the readahead buffer of a LocalFileReader. It is shared with the readahead
+// task, so that the task can outlive the reader.
+struct LocalFileReader::DirectIOState {
+    ~DirectIOState() {
+        if (readahead_buf != nullptr) {
+            DirectIOBufferPool::instance()->release(readahead_buf, readahead_capacity);
+        }
+        if (fd >= 0) {
+            ::close(fd);
+        }
+    }
+
+    // Read the aligned range [offset, offset + size) into buf, returns the bytes read which is
+    // less than size only at the end of file.
+    Status pread_aligned(char* buf, size_t offset, size_t size, size_t* bytes_read) const {
+        *bytes_read = 0;
+        while (*bytes_read < size) {
+            ssize_t res = ::pread(fd, buf + *bytes_read, size - *bytes_read, offset + *bytes_read);
+            if (res == -1) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return localfs_error(errno, "failed to read with O_DIRECT");
+            }
+            if (res == 0) {
+                break;
+            }
+            *bytes_read += res;
+        }
+        local_direct_io_read_bytes << *bytes_read;
+        return Status::OK();
+    }
+
+    int fd = -1;
+    std::mutex mutex;
+    // end offset of the last read, to detect the sequential reads
+    size_t last_read_end = 0;
+    // [readahead_offset, readahead_offset + readahead_size) of the file is in readahead_buf
+    char* readahead_buf = nullptr;
+    size_t readahead_capacity = 0;
+    size_t readahead_offset = 0;
+    size_t readahead_size = 0;
+    bool readahead_running = false;
+};
+
 LocalFileReader::LocalFileReader(Path path, size_t file_size, int fd)
         : _fd(fd), _path(std::move(path)), _file_size(file_size) {
+    struct stat st;
+    if (fstat(_fd, &st) == 0) {
+        _dev = st.st_dev;
+    }
     DorisMetrics::instance()->local_file_open_reading->increment(1);
     DorisMetrics::instance()->local_file_reader_total->increment(1);
 }
@@ -65,7 +196,7 @@ Status LocalFileReader::close() {
 }
 
 Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
-                                     const IOContext* /*io_ctx*/) {
+                                     const IOContext* io_ctx) {
     TEST_SYNC_POINT_RETURN_WITH_VALUE("LocalFileReader::read_at_impl",
                                       Status::IOError("inject io error"));
     if (closed()) [[unlikely]] {
@@ -82,6 +213,37 @@ Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_
     bytes_req = std::min(bytes_req, _file_size - offset);
     *bytes_read = 0;
 
+    bool is_query = io_ctx != nullptr && io_ctx->reader_type == ReaderType::READER_QUERY;
+    int64_t start_us = is_query ? MonotonicMicros() : 0;
+    auto io_slot = LocalIOScheduler::instance()->acquire(_dev, bytes_req);
+    if (io_ctx != nullptr && io_ctx->direct_io && config::enable_local_direct_io_read &&
+        bytes_req != 0) {
+        std::call_once(_direct_io_once, [this]() {
+            int fd = -1;
+            RETRY_ON_EINTR(fd, ::open(_path.c_str(), O_RDONLY | O_DIRECT));
+            if (fd < 0) {
+                // e.g. tmpfs does not support O_DIRECT
+                LOG(INFO) << "failed to open " << _path.native()
+                          << " with O_DIRECT, read it with page cache: " << errno_to_str();
+                return;
+            }
+            _direct_io = std::make_shared<DirectIOState>();
+            _direct_io->fd = fd;
+        });
+        if (_direct_io != nullptr) {
+            Status st = _direct_read_at(offset, Slice(to, bytes_req), bytes_read);
+            if (st.ok()) {
+                if (is_query) {
+                    local_query_read_latency << MonotonicMicros() - start_us;
+                }
+                DorisMetrics::instance()->local_bytes_read_total->increment(*bytes_read);
+                return Status::OK();
+            }
+            LOG_EVERY_N(WARNING, 100) << "direct read of " << _path.native()
+                                      << " failed, read it with page cache: " << st;
+            *bytes_read = 0;
+        }
+    }
     while (bytes_req != 0) {
         auto res = SYNC_POINT_HOOK_RETURN_VALUE(::pread(_fd, to, bytes_req, offset),
                                                 "LocalFileReader::pread", _fd, to);
@@ -98,9 +260,94 @@ Status LocalFileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_
             *bytes_read += res;
         }
     }
+    if (is_query) {
+        local_query_read_latency << MonotonicMicros() - start_us;
+    }
     DorisMetrics::instance()->local_bytes_read_total->increment(*bytes_read);
     return Status::OK();
 }
 
+Status LocalFileReader::_direct_read_at(size_t offset, Slice result, size_t* bytes_read) {
+    std::shared_ptr<DirectIOState> state = _direct_io;
+    size_t end = offset + result.size;
+    bool sequential = false;
+    bool hit_readahead = false;
+    {
+        std::lock_guard lock(state->mutex);
+        if (!state->readahead_running && offset >= state->readahead_offset &&
+            end <= state->readahead_offset + state->readahead_size) {
+            memcpy(result.data, state->readahead_buf + (offset - state->readahead_offset),
+                   result.size);
+            hit_readahead = true;
+        }
+        sequential = offset == state->last_read_end;
+        state->last_read_end = end;
+    }
+
+    if (hit_readahead) {
+        local_direct_io_readahead_hit_bytes << result.size;
+    } else {
+        size_t aligned_offset = align_down(offset);
+        size_t aligned_size = align_up(end) - aligned_offset;
+        char* buf = DirectIOBufferPool::instance()->acquire(aligned_size);
+        if (buf == nullptr) {
+            return Status::MemoryAllocFailed("failed to allocate {} bytes aligned buffer",
+                                             aligned_size);
+        }
+        Defer defer {[&]() { DirectIOBufferPool::instance()->release(buf, aligned_size); }};
+        size_t aligned_read = 0;
+        RETURN_IF_ERROR(state->pread_aligned(buf, aligned_offset, aligned_size, &aligned_read));
+        if (aligned_read < end - aligned_offset) {
+            return Status::InternalError("cannot read from {}: unexpected EOF", _path.native());
+        }
+        memcpy(result.data, buf + (offset - aligned_offset), result.size);
+    }
+    *bytes_read = result.size;
+
+    // the kernel readahead does not work for O_DIRECT, read the following data ahead for the
+    // sequential reads, such as the pages of a column read by a scan
+    size_t readahead_size = align_up(config::local_direct_io_readahead_size);
+    auto* pool = ExecEnv::GetInstance()->buffered_reader_prefetch_thread_pool();
+    if (!sequential || readahead_size == 0 || pool == nullptr || end >= _file_size) {
+        return Status::OK();
+    }
+    {
+        std::lock_guard lock(state->mutex);
+        if (state->readahead_running ||
+            end + readahead_size / 2 <= state->readahead_offset + state->readahead_size) {
+            // still have enough data read ahead
+            return Status::OK();
+        }
+        if (state->readahead_capacity < readahead_size) {
+            if (state->readahead_buf != nullptr) {
+                DirectIOBufferPool::instance()->release(state->readahead_buf,
+                                                        state->readahead_capacity);
+            }
+            state->readahead_buf = DirectIOBufferPool::instance()->acquire(readahead_size);
+            state->readahead_capacity = state->readahead_buf == nullptr ? 0 : readahead_size;
+            if (state->readahead_buf == nullptr) {
+                return Status::OK();
+            }
+        }
+        state->readahead_running = true;
+        state->readahead_size = 0;
+    }
+    size_t readahead_offset = align_down(end);
+    Status st = pool->submit_func([state, readahead_offset]() {
+        size_t size = 0;
+        Status st = state->pread_aligned(state->readahead_buf, readahead_offset,
+                                         state->readahead_capacity, &size);
+        std::lock_guard lock(state->mutex);
+        state->readahead_offset = readahead_offset;
+        state->readahead_size = st.ok() ? size : 0;
+        state->readahead_running = false;
+    });
+    if (!st.ok()) {
+        std::lock_guard lock(state->mutex);
+        state->readahead_running = false;
+    }
+    return Status::OK();
+}
+
 } // namespace io
 } // namespace doris
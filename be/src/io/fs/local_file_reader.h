@@ -17,8 +17,12 @@
 
 #pragma once
 
+#include <bvar/latency_recorder.h>
+#include <sys/types.h>
+
 #include <atomic>
 #include <memory>
+#include <mutex>
 
 #include "common/status.h"
 #include "io/fs/file_reader.h"
@@ -29,6 +33,9 @@
 namespace doris::io {
 struct IOContext;
 
+// latency of the reads of queries from local files, in microseconds
+extern bvar::LatencyRecorder local_query_read_latency;
+
 class LocalFileReader final : public FileReader {
 public:
     LocalFileReader(Path path, size_t file_size, int fd);
@@ -47,11 +54,21 @@ private:
     Status read_at_impl(size_t offset, Slice result, size_t* bytes_read,
                         const IOContext* io_ctx) override;
 
+    // Read with O_DIRECT through aligned buffers, see config::enable_local_direct_io_read.
+    Status _direct_read_at(size_t offset, Slice result, size_t* bytes_read);
+
 private:
+    struct DirectIOState;
+
     int _fd = -1; // owned
+    // device of the file, to schedule the reads by LocalIOScheduler
+    dev_t _dev = 0;
     Path _path;
     size_t _file_size;
     std::atomic<bool> _closed = false;
+    // opened by the first direct read, nullptr if the file can not be opened with O_DIRECT
+    std::once_flag _direct_io_once;
+    std::shared_ptr<DirectIOState> _direct_io;
 };
 
 } // namespace doris::io
@@ -21,6 +21,7 @@
 #include <errno.h> // IWYU pragma: keep
 #include <fcntl.h>
 #include <glog/logging.h>
+#include <sys/stat.h>
 #include <sys/uio.h>
 #include <unistd.h>
 
@@ -38,6 +39,7 @@
 #include "io/fs/err_utils.h"
 #include "io/fs/file_writer.h"
 #include "io/fs/local_file_system.h"
+#include "io/fs/local_io_scheduler.h"
 #include "io/fs/path.h"
 #include "olap/data_dir.h"
 #include "util/debug_points.h"
@@ -70,6 +72,10 @@ Status sync_dir(const io::Path& dirname) {
 
 LocalFileWriter::LocalFileWriter(Path path, int fd, bool sync_data)
         : _path(std::move(path)), _fd(fd), _sync_data(sync_data) {
+    struct stat st;
+    if (fstat(_fd, &st) == 0) {
+        _dev = st.st_dev;
+    }
     DorisMetrics::instance()->local_file_open_writing->increment(1);
     DorisMetrics::instance()->local_file_writer_total->increment(1);
 }
@@ -138,6 +144,7 @@ Status LocalFileWriter::appendv(const Slice* data, size_t data_cnt) {
         iov[i] = {result.data, result.size};
     }
 
+    auto io_slot = LocalIOScheduler::instance()->acquire(_dev, bytes_req);
     size_t completed_iov = 0;
     size_t n_left = bytes_req;
     while (n_left > 0) {
@@ -197,6 +204,41 @@ Status LocalFileWriter::_finalize() {
     return Status::OK();
 }
 
+Status LocalFileWriter::start_sync() {
+    if (_state != State::OPENED) [[unlikely]] {
+        return Status::InternalError("sync closed file: {}", _path.native());
+    }
+#if defined(__linux__)
+    if (_dirty && sync_file_range(_fd, 0, 0, SYNC_FILE_RANGE_WRITE) < 0) {
+        return localfs_error(errno, fmt::format("failed to sync {}", _path.native()));
+    }
+#endif
+    return Status::OK();
+}
+
+Status LocalFileWriter::sync() {
+    if (_state != State::OPENED) [[unlikely]] {
+        return Status::InternalError("sync closed file: {}", _path.native());
+    }
+    if (_dirty) {
+#ifdef __APPLE__
+        if (fcntl(_fd, F_FULLFSYNC) < 0) [[unlikely]] {
+            return localfs_error(errno, fmt::format("failed to sync {}", _path.native()));
+        }
+#else
+        if (0 != ::fdatasync(_fd)) [[unlikely]] {
+            return localfs_error(errno, fmt::format("failed to sync {}", _path.native()));
+        }
+#endif
+        _dirty = false;
+    }
+    if (!_dir_synced) {
+        RETURN_IF_ERROR(sync_dir(_path.parent_path()));
+        _dir_synced = true;
+    }
+    return Status::OK();
+}
+
 Status LocalFileWriter::_close(bool sync) {
     auto fd_reclaim_func = [&](Status st) {
         if (_fd > 0 && 0 != ::close(_fd)) {
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <sys/types.h>
+
 #include <cstddef>
 
 #include "common/status.h"
@@ -40,6 +42,13 @@ public:
 
     Status close(bool non_block = false) override;
 
+    // Start writing back the appended data without waiting for it, so that the syncs of several
+    // files overlap
+    Status start_sync();
+
+    // Wait for the appended data to persist while keeping the file open
+    Status sync();
+
 private:
     Status _finalize();
     void _abort();
@@ -47,7 +56,11 @@ private:
 
     Path _path;
     int _fd; // owned
+    // device of the file, to schedule the writes by LocalIOScheduler
+    dev_t _dev = 0;
     bool _dirty = false;
+    // whether the entry of this file in its parent dir has been persisted by `sync()`
+    bool _dir_synced = false;
     const bool _sync_data = true;
     size_t _bytes_appended = 0;
     State _state {State::OPENED};
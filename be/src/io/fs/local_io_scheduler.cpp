@@ -0,0 +1,122 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/fs/local_io_scheduler.h"
+
+#include <bvar/bvar.h>
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "util/time.h"
+
+namespace doris::io {
+
+bvar::LatencyRecorder local_io_schedule_wait_latency("local_io_scheduler", "wait");
+
+// same as the default cpu share of a workload group
+static constexpr double DEFAULT_WORKLOAD_GROUP_WEIGHT = 1024;
+
+LocalIOScheduler* LocalIOScheduler::instance() {
+    static LocalIOScheduler scheduler;
+    return &scheduler;
+}
+
+double LocalIOScheduler::weight(const IOTag& tag) {
+    int32_t class_weight = 1;
+    switch (tag.io_class) {
+    case IOClass::QUERY:
+        class_weight = config::local_io_scheduler_query_weight;
+        break;
+    case IOClass::LOAD_FLUSH:
+        class_weight = config::local_io_scheduler_load_weight;
+        break;
+    case IOClass::COMPACTION:
+        class_weight = config::local_io_scheduler_compaction_weight;
+        break;
+    case IOClass::SPILL:
+        class_weight = config::local_io_scheduler_spill_weight;
+        break;
+    case IOClass::OTHER:
+        class_weight = config::local_io_scheduler_other_weight;
+        break;
+    }
+    double wg_weight = tag.workload_group_weight == 0
+                               ? DEFAULT_WORKLOAD_GROUP_WEIGHT
+                               : static_cast<double>(tag.workload_group_weight);
+    return std::max(1, class_weight) * wg_weight / DEFAULT_WORKLOAD_GROUP_WEIGHT;
+}
+
+LocalIOScheduler::Disk* LocalIOScheduler::_get_disk(dev_t dev) {
+    std::lock_guard lock(_mutex);
+    auto& disk = _disks[dev];
+    if (disk == nullptr) {
+        disk = std::make_unique<Disk>();
+    }
+    return disk.get();
+}
+
+LocalIOScheduler::Slot LocalIOScheduler::acquire(dev_t dev, size_t bytes) {
+    if (!config::enable_local_io_scheduler) {
+        return {};
+    }
+    const IOTag& tag = current_io_tag;
+    Disk* disk = _get_disk(dev);
+    std::unique_lock lock(disk->mutex);
+    double& flow_finish_tag = disk->flow_finish_tags[{tag.io_class, tag.workload_group_id}];
+    double start_tag = std::max(disk->virtual_time, flow_finish_tag);
+    // count at least one page for each IO, so that small IOs are not free
+    flow_finish_tag = start_tag + std::max<size_t>(bytes, 4096) / weight(tag);
+
+    int concurrency = std::max(1, config::local_io_scheduler_disk_concurrency);
+    if (disk->running < concurrency && disk->waiting.empty()) {
+        disk->running++;
+        disk->virtual_time = start_tag;
+        return {this, dev};
+    }
+
+    int64_t start_us = MonotonicMicros();
+    Request request {.start_tag = start_tag, .seq = disk->next_seq++};
+    disk->waiting.insert(&request);
+    request.cv.wait(lock, [&]() { return request.granted; });
+    local_io_schedule_wait_latency << MonotonicMicros() - start_us;
+    return {this, dev};
+}
+
+void LocalIOScheduler::_release(dev_t dev) {
+    Disk* disk = _get_disk(dev);
+    std::lock_guard lock(disk->mutex);
+    disk->running--;
+    int concurrency = std::max(1, config::local_io_scheduler_disk_concurrency);
+    while (disk->running < concurrency && !disk->waiting.empty()) {
+        Request* request = *disk->waiting.begin();
+        disk->waiting.erase(disk->waiting.begin());
+        disk->running++;
+        disk->virtual_time = request->start_tag;
+        request->granted = true;
+        request->cv.notify_one();
+    }
+}
+
+void LocalIOScheduler::get_queue_size(dev_t dev, int* running, size_t* waiting) {
+    Disk* disk = _get_disk(dev);
+    std::lock_guard lock(disk->mutex);
+    *running = disk->running;
+    *waiting = disk->waiting.size();
+}
+
+} // namespace doris::io
@@ -0,0 +1,144 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stdint.h>
+#include <sys/types.h>
+
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+
+#include "gutil/macros.h"
+
+namespace doris::io {
+
+// The class of a local disk IO, which decides the weight of it in LocalIOScheduler.
+enum class IOClass : uint8_t {
+    QUERY = 0,
+    LOAD_FLUSH = 1,
+    COMPACTION = 2,
+    SPILL = 3,
+    OTHER = 4,
+};
+
+// Who issues the IOs of current thread. The weight of a workload group is its cpu share, the
+// IOs of a workload group of double cpu share get double disk time of its class.
+struct IOTag {
+    IOClass io_class = IOClass::OTHER;
+    uint64_t workload_group_id = 0;
+    uint64_t workload_group_weight = 0; // 0 means the default weight
+};
+
+inline thread_local IOTag current_io_tag;
+
+class ScopedIOTag {
+public:
+    ScopedIOTag(IOClass io_class, uint64_t workload_group_id = 0,
+                uint64_t workload_group_weight = 0)
+            : _saved(current_io_tag) {
+        current_io_tag = {io_class, workload_group_id, workload_group_weight};
+    }
+    ~ScopedIOTag() { current_io_tag = _saved; }
+
+private:
+    IOTag _saved;
+};
+
+#define SCOPED_IO_TAG(...) doris::io::ScopedIOTag VARNAME_LINENUM(scoped_io_tag)(__VA_ARGS__)
+
+// Schedules the IOs of LocalFileReader and LocalFileWriter to each disk.
+//
+// At most config::local_io_scheduler_disk_concurrency IOs are issued to a disk at the same time,
+// the others wait and are dispatched by start-time fair queuing: each flow, that is the IOs of a
+// class of a workload group, is tagged with a virtual start time which advances by bytes / weight
+// of its IOs, and the waiting IO with the smallest start time goes first. So under contention
+// the flows share the disk time in proportion to their weights, and a flow of small interactive
+// reads is not queued behind a compaction issuing large reads back to back.
+class LocalIOScheduler {
+public:
+    static LocalIOScheduler* instance();
+
+    // Released when destructed, so that the next waiting IO of the disk can be issued
+    class Slot {
+    public:
+        Slot() = default;
+        Slot(LocalIOScheduler* scheduler, dev_t dev) : _scheduler(scheduler), _dev(dev) {}
+        ~Slot() {
+            if (_scheduler != nullptr) {
+                _scheduler->_release(_dev);
+            }
+        }
+        Slot(Slot&& other) noexcept : _scheduler(other._scheduler), _dev(other._dev) {
+            other._scheduler = nullptr;
+        }
+        Slot(const Slot&) = delete;
+        Slot& operator=(const Slot&) = delete;
+        Slot& operator=(Slot&&) = delete;
+
+    private:
+        LocalIOScheduler* _scheduler = nullptr;
+        dev_t _dev = 0;
+    };
+
+    // Wait until an IO of `bytes` bytes by current thread can be issued to the disk `dev`.
+    // Returns an empty slot immediately if config::enable_local_io_scheduler is false.
+    Slot acquire(dev_t dev, size_t bytes);
+
+    // number of the IOs of disk `dev` running and waiting, for test
+    void get_queue_size(dev_t dev, int* running, size_t* waiting);
+
+    static double weight(const IOTag& tag);
+
+private:
+    struct Request {
+        double start_tag;
+        uint64_t seq;
+        std::condition_variable cv;
+        bool granted = false;
+    };
+
+    struct RequestLess {
+        bool operator()(const Request* a, const Request* b) const {
+            return a->start_tag < b->start_tag ||
+                   (a->start_tag == b->start_tag && a->seq < b->seq);
+        }
+    };
+
+    struct Disk {
+        std::mutex mutex;
+        int running = 0;
+        uint64_t next_seq = 0;
+        // start tag of the last dispatched IO
+        double virtual_time = 0;
+        // the finish tag of the last IO of each flow, keyed by (class, workload group id)
+        std::map<std::pair<IOClass, uint64_t>, double> flow_finish_tags;
+        std::set<Request*, RequestLess> waiting;
+    };
+
+    Disk* _get_disk(dev_t dev);
+    void _release(dev_t dev);
+
+    std::mutex _mutex;
+    std::unordered_map<dev_t, std::unique_ptr<Disk>> _disks;
+};
+
+} // namespace doris::io
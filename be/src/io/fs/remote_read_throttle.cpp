@@ -0,0 +1,123 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/fs/remote_read_throttle.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "common/config.h"
+#include "util/time.h"
+
+namespace doris::io {
+
+std::mutex RemoteReadThrottle::s_lock;
+TokenBucket RemoteReadThrottle::s_total_bytes;
+TokenBucket RemoteReadThrottle::s_total_requests;
+std::atomic<uint64_t> RemoteReadThrottle::s_total_shares = 0;
+
+void TokenBucket::refill(double rate, int64_t now_ns) {
+    if (last_ns < 0) {
+        tokens = rate;
+    } else if (now_ns > last_ns) {
+        tokens = std::min(rate, tokens + rate * static_cast<double>(now_ns - last_ns) / 1e9);
+    }
+    last_ns = std::max(last_ns, now_ns);
+}
+
+RemoteReadThrottle::RemoteReadThrottle(uint64_t group_id, uint64_t cpu_share)
+        : _cpu_share(std::max<uint64_t>(cpu_share, 1)) {
+    auto bvar_prefix = fmt::format("workload_group_{}", group_id);
+    _read_bytes.expose(bvar_prefix, "remote_read_bytes");
+    _read_requests.expose(bvar_prefix, "remote_read_requests");
+    _borrowed_bytes.expose(bvar_prefix, "remote_read_borrowed_bytes");
+    _throttled_us.expose(bvar_prefix, "remote_read_throttled_us");
+    s_total_shares += _cpu_share;
+}
+
+RemoteReadThrottle::~RemoteReadThrottle() {
+    s_total_shares -= _cpu_share;
+}
+
+void RemoteReadThrottle::set_cpu_share(uint64_t cpu_share) {
+    cpu_share = std::max<uint64_t>(cpu_share, 1);
+    uint64_t old_share = _cpu_share.exchange(cpu_share);
+    s_total_shares += cpu_share;
+    s_total_shares -= old_share;
+}
+
+void RemoteReadThrottle::acquire(size_t bytes) {
+    int64_t wait_ns = reserve(bytes, MonotonicNanos());
+    if (wait_ns > 0) {
+        _throttled_us << wait_ns / 1000;
+        std::this_thread::sleep_for(std::chrono::nanoseconds(wait_ns));
+    }
+}
+
+int64_t RemoteReadThrottle::reserve(size_t bytes, int64_t now_ns) {
+    _read_bytes << bytes;
+    _read_requests << 1;
+    auto bytes_rate = static_cast<double>(config::remote_read_bytes_per_second);
+    auto requests_rate = static_cast<double>(config::remote_read_requests_per_second);
+    if (bytes_rate <= 0 && requests_rate <= 0) {
+        return 0;
+    }
+    int64_t wait_ns = 0;
+    bool borrowed = false;
+    std::lock_guard lock(s_lock);
+    if (bytes_rate > 0) {
+        wait_ns = _take(&_bytes, &s_total_bytes, bytes_rate, static_cast<double>(bytes), now_ns,
+                        &borrowed);
+        if (borrowed) {
+            _borrowed_bytes << bytes;
+        }
+    }
+    if (requests_rate > 0) {
+        wait_ns = std::max(wait_ns, _take(&_requests, &s_total_requests, requests_rate, 1,
+                                          now_ns, &borrowed));
+    }
+    return wait_ns;
+}
+
+int64_t RemoteReadThrottle::_take(TokenBucket* own, TokenBucket* total, double total_rate,
+                                  double amount, int64_t now_ns, bool* borrowed) {
+    double rate = total_rate * static_cast<double>(_cpu_share.load()) /
+                  static_cast<double>(std::max<uint64_t>(s_total_shares.load(), 1));
+    own->refill(rate, now_ns);
+    total->refill(total_rate, now_ns);
+    *borrowed = false;
+    if (own->tokens >= amount) {
+        own->tokens -= amount;
+        total->tokens -= amount;
+        return 0;
+    }
+    if (total->tokens >= amount) {
+        // the other groups leave the budget idle
+        total->tokens -= amount;
+        *borrowed = true;
+        return 0;
+    }
+    own->tokens -= amount;
+    // the debt of the BE is bounded, as the groups within their shares never wait for it
+    total->tokens = std::max(total->tokens - amount, -total_rate);
+    return own->tokens < 0 ? static_cast<int64_t>(-own->tokens / rate * 1e9) : 0;
+}
+
+} // namespace doris::io
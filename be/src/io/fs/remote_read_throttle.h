@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <bvar/bvar.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+namespace doris::io {
+
+// A token bucket holding up to one second of its rate. It goes below zero to make the takers
+// wait for it to refill.
+struct TokenBucket {
+    double tokens = 0;
+    int64_t last_ns = -1;
+
+    void refill(double rate, int64_t now_ns);
+};
+
+// Throttles the reads of a workload group from the remote storage, i.e. the misses of the file
+// cache, by bytes and by requests. The BE wide budgets remote_read_bytes_per_second and
+// remote_read_requests_per_second are shared by the groups in proportion to their cpu shares,
+// and a group out of its share borrows the budget the other groups leave idle.
+class RemoteReadThrottle {
+public:
+    RemoteReadThrottle(uint64_t group_id, uint64_t cpu_share);
+    ~RemoteReadThrottle();
+
+    void set_cpu_share(uint64_t cpu_share);
+
+    // Waits until the group may read `bytes` from the remote storage in one request.
+    void acquire(size_t bytes);
+
+    // Takes the tokens of a read of `bytes` at `now_ns`, returns the nanoseconds to wait
+    // before the read.
+    int64_t reserve(size_t bytes, int64_t now_ns);
+
+private:
+    // Takes `amount` from the bucket of the group, or from the spare of the BE when the group
+    // is out of tokens, otherwise returns the nanoseconds the group waits for its bucket.
+    int64_t _take(TokenBucket* own, TokenBucket* total, double total_rate, double amount,
+                  int64_t now_ns, bool* borrowed);
+
+    std::atomic<uint64_t> _cpu_share;
+    // protected by s_lock
+    TokenBucket _bytes;
+    TokenBucket _requests;
+
+    bvar::Adder<int64_t> _read_bytes;
+    bvar::Adder<int64_t> _read_requests;
+    bvar::Adder<int64_t> _borrowed_bytes;
+    bvar::Adder<int64_t> _throttled_us;
+
+    static std::mutex s_lock;
+    static TokenBucket s_total_bytes;
+    static TokenBucket s_total_requests;
+    // the sum of the cpu shares of all groups
+    static std::atomic<uint64_t> s_total_shares;
+};
+
+} // namespace doris::io
@@ -23,6 +23,9 @@
 #include <aws/s3/S3Errors.h>
 #include <aws/s3/model/GetObjectRequest.h>
 #include <aws/s3/model/GetObjectResult.h>
+#include <bthread/condition_variable.h>
+#include <bthread/countdown_event.h>
+#include <bthread/mutex.h>
 #include <bvar/latency_recorder.h>
 #include <bvar/reducer.h>
 #include <fmt/format.h>
@@ -32,12 +35,16 @@
 #include <utility>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "io/fs/err_utils.h"
 #include "io/fs/obj_storage_client.h"
+#include "io/fs/remote_read_throttle.h"
 #include "io/fs/s3_common.h"
+#include "runtime/exec_env.h"
 #include "util/bvar_helper.h"
 #include "util/doris_metrics.h"
 #include "util/s3_util.h"
+#include "util/threadpool.h"
 
 namespace doris::io {
 
@@ -48,6 +55,43 @@ bvar::Adder<uint64_t> s3_file_being_read("s3_file_reader", "file_being_read");
 bvar::LatencyRecorder s3_bytes_per_read("s3_file_reader", "bytes_per_read"); // also QPS
 bvar::PerSecond<bvar::Adder<uint64_t>> s3_read_througthput("s3_file_reader", "s3_read_throughput",
                                                            &s3_bytes_read_total);
+bvar::Adder<uint64_t> s3_file_reader_parallel_read("s3_file_reader", "parallel_read");
+bvar::Adder<uint64_t> s3_file_reader_hedged_read("s3_file_reader", "hedged_read");
+// hedged reads whose duplicate GET returned first
+bvar::Adder<uint64_t> s3_file_reader_hedged_read_win("s3_file_reader", "hedged_read_win");
+
+namespace {
+
+Status read_range(ObjStorageClient* client, const std::string& bucket, const std::string& key,
+                  const Path& path, char* to, size_t offset, size_t size) {
+    size_t bytes_read = 0;
+    // clang-format off
+    auto resp = client->get_object( { .bucket = bucket, .key = key, },
+            to, offset, size, &bytes_read);
+    // clang-format on
+    if (resp.status.code != ErrorCode::OK) {
+        return std::move(Status(resp.status.code, std::move(resp.status.msg))
+                                 .append(fmt::format("failed to read from {}", path.native())));
+    }
+    if (bytes_read != size) {
+        return Status::InternalError("failed to read from {}(bytes read: {}, bytes req: {})",
+                                     path.native(), bytes_read, size);
+    }
+    return Status::OK();
+}
+
+// shared by a hedged read and its GETs, which may outlive the read
+struct HedgedReadState {
+    bthread::Mutex mutex;
+    bthread::ConditionVariable cv;
+    int num_running = 0;
+    // index of the first GET succeeded, -1 if none yet
+    int winner = -1;
+    Status status;
+    std::unique_ptr<char[]> buffers[2];
+};
+
+} // namespace
 
 Result<FileReaderSPtr> S3FileReader::create(std::shared_ptr<const ObjClientHolder> client,
                                             std::string bucket, std::string key,
@@ -94,7 +138,7 @@ Status S3FileReader::close() {
 }
 
 Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_read,
-                                  const IOContext* /*io_ctx*/) {
+                                  const IOContext* io_ctx) {
     DCHECK(!closed());
     if (offset > _file_size) {
         return Status::InternalError(
@@ -113,18 +157,20 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
     if (!client) {
         return Status::InternalError("init s3 client error");
     }
-    // clang-format off
-    auto resp = client->get_object( { .bucket = _bucket, .key = _key, },
-            to, offset, bytes_req, bytes_read);
-    // clang-format on
-    if (resp.status.code != ErrorCode::OK) {
-        return std::move(Status(resp.status.code, std::move(resp.status.msg))
-                                 .append(fmt::format("failed to read from {}", _path.native())));
+    if (io_ctx != nullptr && io_ctx->remote_read_throttle != nullptr) {
+        io_ctx->remote_read_throttle->acquire(bytes_req);
     }
-    if (*bytes_read != bytes_req) {
-        return Status::InternalError("failed to read from {}(bytes read: {}, bytes req: {})",
-                                     _path.native(), *bytes_read, bytes_req);
+    auto* pool = ExecEnv::GetInstance()->s3_file_read_thread_pool();
+    auto part_size = static_cast<size_t>(std::max<int64_t>(config::s3_parallel_read_part_size, 0));
+    if (pool != nullptr && part_size > 0 && bytes_req >= 2 * part_size) {
+        RETURN_IF_ERROR(_parallel_read(client, pool, to, offset, bytes_req, part_size));
+    } else if (pool != nullptr && config::enable_s3_hedged_read &&
+               static_cast<int64_t>(bytes_req) <= config::s3_hedged_read_max_bytes) {
+        RETURN_IF_ERROR(_hedged_read(client, pool, to, offset, bytes_req));
+    } else {
+        RETURN_IF_ERROR(read_range(client.get(), _bucket, _key, _path, to, offset, bytes_req));
     }
+    *bytes_read = bytes_req;
     s3_bytes_read_total << *bytes_read;
     s3_bytes_per_read << *bytes_read;
     s3_file_reader_read_counter << 1;
@@ -132,4 +178,93 @@ Status S3FileReader::read_at_impl(size_t offset, Slice result, size_t* bytes_rea
     return Status::OK();
 }
 
+Status S3FileReader::_parallel_read(const std::shared_ptr<ObjStorageClient>& client,
+                                    ThreadPool* pool, char* to, size_t offset, size_t size,
+                                    size_t part_size) {
+    size_t num_parts = (size + part_size - 1) / part_size;
+    std::vector<Status> part_status(num_parts);
+    // the first part is read by the caller itself
+    bthread::CountdownEvent countdown(num_parts - 1);
+    for (size_t i = 1; i < num_parts; ++i) {
+        size_t part_offset = i * part_size;
+        size_t part_bytes = std::min(part_size, size - part_offset);
+        auto read_part = [&, i, part_offset, part_bytes]() {
+            part_status[i] = read_range(client.get(), _bucket, _key, _path, to + part_offset,
+                                        offset + part_offset, part_bytes);
+            countdown.signal();
+        };
+        if (!pool->submit_func(read_part).ok()) {
+            read_part();
+        }
+    }
+    part_status[0] = read_range(client.get(), _bucket, _key, _path, to, offset, part_size);
+    countdown.wait();
+    s3_file_reader_parallel_read << 1;
+    for (auto& st : part_status) {
+        RETURN_IF_ERROR(st);
+    }
+    return Status::OK();
+}
+
+Status S3FileReader::_hedged_read(const std::shared_ptr<ObjStorageClient>& client,
+                                  ThreadPool* pool, char* to, size_t offset, size_t size) {
+    // every GET reads into its own buffer, the caller's buffer cannot be written after return
+    auto state = std::make_shared<HedgedReadState>();
+    auto submit_get = [&](int i) {
+        state->buffers[i] = std::make_unique<char[]>(size);
+        {
+            std::lock_guard lock(state->mutex);
+            ++state->num_running;
+        }
+        auto submit_st = pool->submit_func([state, client, bucket = _bucket, key = _key,
+                                            path = _path, i, offset, size]() {
+            auto st = read_range(client.get(), bucket, key, path, state->buffers[i].get(),
+                                 offset, size);
+            std::lock_guard lock(state->mutex);
+            --state->num_running;
+            if (st.ok() && state->winner < 0) {
+                state->winner = i;
+            } else if (!st.ok()) {
+                state->status = std::move(st);
+            }
+            state->cv.notify_all();
+        });
+        if (!submit_st.ok()) {
+            std::lock_guard lock(state->mutex);
+            --state->num_running;
+        }
+        return submit_st;
+    };
+    if (!submit_get(0).ok()) {
+        return read_range(client.get(), _bucket, _key, _path, to, offset, size);
+    }
+
+    int64_t delay_us = std::max<int64_t>(s3_bvar::s3_get_latency.latency_percentile(0.95),
+                                         config::s3_hedged_read_min_delay_ms * 1000L);
+    {
+        std::unique_lock lock(state->mutex);
+        if (state->winner < 0 && state->num_running > 0) {
+            state->cv.wait_for(lock, delay_us);
+        }
+        if (state->winner < 0 && state->num_running > 0) {
+            lock.unlock();
+            if (submit_get(1).ok()) {
+                s3_file_reader_hedged_read << 1;
+            }
+            lock.lock();
+        }
+        while (state->winner < 0 && state->num_running > 0) {
+            state->cv.wait(lock);
+        }
+        if (state->winner < 0) {
+            return state->status;
+        }
+    }
+    if (state->winner == 1) {
+        s3_file_reader_hedged_read_win << 1;
+    }
+    memcpy(to, state->buffers[state->winner].get(), size);
+    return Status::OK();
+}
+
 } // namespace doris::io
@@ -28,8 +28,13 @@
 #include "io/fs/s3_file_system.h"
 #include "util/slice.h"
 
+namespace doris {
+class ThreadPool;
+} // namespace doris
+
 namespace doris::io {
 struct IOContext;
+class ObjStorageClient;
 
 class S3FileReader final : public FileReader {
 public:
@@ -54,6 +59,15 @@ protected:
                         const IOContext* io_ctx) override;
 
 private:
+    // split [offset, offset + size) into ranged GETs of `part_size` bytes read concurrently
+    Status _parallel_read(const std::shared_ptr<ObjStorageClient>& client, ThreadPool* pool,
+                          char* to, size_t offset, size_t size, size_t part_size);
+
+    // send a duplicate GET if the first one does not return within the p95 latency of GETs,
+    // and take whichever returns first
+    Status _hedged_read(const std::shared_ptr<ObjStorageClient>& client, ThreadPool* pool,
+                        char* to, size_t offset, size_t size);
+
     Path _path;
     size_t _file_size;
 
@@ -216,7 +216,6 @@ Status S3FileWriter::appendv(const Slice* data, size_t data_cnt) {
                                      _obj_storage_path_opts.path.native());
     }
 
-    size_t buffer_size = config::s3_write_buffer_size;
     TEST_SYNC_POINT_RETURN_WITH_VALUE("s3_file_writer::appenv", Status());
     for (size_t i = 0; i < data_cnt; i++) {
         size_t data_size = data[i].get_size();
@@ -225,8 +224,10 @@ Status S3FileWriter::appendv(const Slice* data, size_t data_cnt) {
                 return _st;
             }
             if (!_pending_buf) {
+                size_t part_size = _next_part_size();
                 auto builder = FileBufferBuilder();
                 builder.set_type(BufferType::UPLOAD)
+                        .set_capacity(part_size)
                         .set_upload_callback(
                                 [part_num = _cur_part_num, this](UploadFileBuffer& buf) {
                                     _upload_one_part(part_num, buf);
@@ -255,16 +256,16 @@ Status S3FileWriter::appendv(const Slice* data, size_t data_cnt) {
                     // try to do writing into file cache, so we make the lambda capture the variable
                     // we need by value to extend their lifetime
                     builder.set_allocate_file_blocks_holder(
-                            [builder = *_cache_builder,
-                             offset = _bytes_appended]() -> FileBlocksHolderPtr {
-                                return builder.allocate_cache_holder(offset,
-                                                                     config::s3_write_buffer_size);
+                            [builder = *_cache_builder, offset = _bytes_appended,
+                             part_size]() -> FileBlocksHolderPtr {
+                                return builder.allocate_cache_holder(offset, part_size);
                             });
                 }
                 RETURN_IF_ERROR(builder.build(&_pending_buf));
             }
             // we need to make sure all parts except the last one to be 5MB or more
             // and shouldn't be larger than buf
+            size_t buffer_size = _pending_buf->get_capacaticy();
             data_size_to_append = std::min(data_size - pos, _pending_buf->get_file_offset() +
                                                                     buffer_size - _bytes_appended);
 
@@ -294,6 +295,22 @@ Status S3FileWriter::appendv(const Slice* data, size_t data_cnt) {
     return Status::OK();
 }
 
+size_t S3FileWriter::_next_part_size() const {
+    // s3 allows at most 10000 parts, so the part size doubles every
+    // s3_write_part_size_grow_interval parts for big files, up to s3_write_max_part_size.
+    // doubling keeps it a multiple of file_cache_each_block_size
+    size_t part_size = config::s3_write_buffer_size;
+    if (config::s3_write_part_size_grow_interval <= 0) {
+        return part_size;
+    }
+    auto max_part_size = static_cast<size_t>(config::s3_write_max_part_size);
+    for (int64_t n = (_cur_part_num - 1) / config::s3_write_part_size_grow_interval;
+         n > 0 && part_size * 2 <= max_part_size; --n) {
+        part_size *= 2;
+    }
+    return part_size;
+}
+
 void S3FileWriter::_upload_one_part(int64_t part_num, UploadFileBuffer& buf) {
     if (buf.is_cancelled()) {
         return;
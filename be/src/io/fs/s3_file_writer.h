@@ -85,6 +85,8 @@ private:
     Status _create_multi_upload_request();
     Status _set_upload_to_remote_less_than_buffer_size();
     void _put_object(UploadFileBuffer& buf);
+    // size of the buffer of the next part, it grows with the number of parts
+    size_t _next_part_size() const;
     void _upload_one_part(int64_t part_num, UploadFileBuffer& buf);
 
     ObjectStoragePathOptions _obj_storage_path_opts;
@@ -20,6 +20,7 @@
 #include <fmt/format.h>
 #include <gen_cpp/PlanNodes_types.h>
 
+#include <algorithm>
 #include <cstdlib>
 #include <fstream>
 #include <utility>
@@ -29,6 +30,7 @@
 #include "common/config.h"
 #include "common/logging.h"
 #include "io/fs/hdfs.h"
+#include "io/hdfs_util.h"
 #include "util/string_util.h"
 #include "util/uid_util.h"
 
@@ -61,6 +63,30 @@ Status HDFSCommonBuilder::check_krb_params() {
     return Status::OK();
 }
 
+static void set_hdfs_read_conf(hdfsBuilder* hdfs_builder) {
+#ifdef USE_HADOOP_HDFS
+    if (config::hdfs_hedged_read_thread_num > 0) {
+        // read another replica if the current one does not return within the threshold
+        int64_t threshold_ms = config::hdfs_hedged_read_threshold_time_ms;
+        if (threshold_ms <= 0) {
+            // adapt to the p95 latency of the hdfs reads of this BE
+            threshold_ms = std::max<int64_t>(
+                    io::hdfs_bvar::hdfs_read_latency.latency_percentile(0.95) / 1000, 10);
+        }
+        hdfsBuilderConfSetStr(hdfs_builder, "dfs.client.hedged.read.threadpool.size",
+                              std::to_string(config::hdfs_hedged_read_thread_num).c_str());
+        hdfsBuilderConfSetStr(hdfs_builder, "dfs.client.hedged.read.threshold.millis",
+                              std::to_string(threshold_ms).c_str());
+    }
+#endif
+    if (!config::hdfs_short_circuit_domain_socket_path.empty()) {
+        // read the blocks on the co-located DataNode from the local disk directly
+        hdfsBuilderConfSetStr(hdfs_builder, "dfs.client.read.shortcircuit", "true");
+        hdfsBuilderConfSetStr(hdfs_builder, "dfs.domain.socket.path",
+                              config::hdfs_short_circuit_domain_socket_path.c_str());
+    }
+}
+
 THdfsParams parse_properties(const std::map<std::string, std::string>& properties) {
     StringCaseMap<std::string> prop(properties.begin(), properties.end());
     std::vector<THdfsConf> hdfs_configs;
@@ -117,6 +143,8 @@ Status create_hdfs_builder(const THdfsParams& hdfsParams, const std::string& fs_
         hdfsBuilderSetKeyTabFile(builder->get(), nullptr);
 #endif
     }
+    // set the defaults of this BE, they can be overridden by the conf of the catalog or resource
+    set_hdfs_read_conf(builder->get());
     // set other conf
     if (hdfsParams.__isset.hdfs_conf) {
         for (const THdfsConf& conf : hdfsParams.hdfs_conf) {
@@ -35,6 +35,8 @@ enum class ReaderType : uint8_t {
 
 namespace io {
 
+class RemoteReadThrottle;
+
 struct FileCacheStatistics {
     int64_t num_local_io_total = 0;
     int64_t num_remote_io_total = 0;
@@ -53,6 +55,8 @@ struct IOContext {
     bool is_disposable = false;
     bool is_index_data = false;
     bool read_file_cache = true;
+    // bypass the os page cache if the reader supports it, for the data cached by doris itself
+    bool direct_io = false;
     // TODO(lightman): use following member variables to control file cache
     bool is_persistent = false;
     // stop reader when reading, used in some interrupted operations
@@ -60,6 +64,8 @@ struct IOContext {
     int64_t expiration_time = 0;
     const TUniqueId* query_id = nullptr;             // Ref
     FileCacheStatistics* file_cache_stats = nullptr; // Ref
+    // throttles the reads from the remote storage of the workload group of the query
+    RemoteReadThrottle* remote_read_throttle = nullptr; // Ref
 };
 
 } // namespace io
@@ -20,6 +20,9 @@
 #include <fmt/format.h>
 #include <rapidjson/prettywriter.h>
 
+#include <algorithm>
+#include <functional>
+
 #include "common/status.h"
 #include "olap/calc_delete_bitmap_executor.h"
 #include "olap/delete_bitmap_calculator.h"
@@ -27,6 +30,7 @@
 #include "olap/primary_key_index.h"
 #include "olap/rowid_conversion.h"
 #include "olap/rowset/beta_rowset.h"
+#include "olap/rowset/segment_v2/bloom_filter_index_writer.h"
 #include "olap/rowset/rowset.h"
 #include "olap/rowset/rowset_reader.h"
 #include "olap/tablet_fwd.h"
@@ -35,6 +39,7 @@
 #include "util/bvar_helper.h"
 #include "util/debug_points.h"
 #include "util/doris_metrics.h"
+#include "util/time.h"
 #include "vec/common/schema_util.h"
 #include "vec/data_types/data_type_factory.hpp"
 #include "vec/jsonb/serialize.h"
@@ -474,7 +479,8 @@ Status BaseTablet::lookup_row_key(const Slice& encoded_key, bool with_seq_col,
                                   const std::vector<RowsetSharedPtr>& specified_rowsets,
                                   RowLocation* row_location, uint32_t version,
                                   std::vector<std::unique_ptr<SegmentCacheHandle>>& segment_caches,
-                                  RowsetSharedPtr* rowset, bool with_rowid) {
+                                  RowsetSharedPtr* rowset, bool with_rowid,
+                                  PkIndexIterators* index_iterators) {
     SCOPED_BVAR_LATENCY(g_tablet_lookup_rowkey_latency);
     size_t seq_col_length = 0;
     if (_tablet_meta->tablet_schema()->has_sequence_col() && with_seq_col) {
@@ -519,9 +525,17 @@ Status BaseTablet::lookup_row_key(const Slice& encoded_key, bool with_seq_col,
         }
         auto& segments = segment_caches[i]->get_segments();
         DCHECK_EQ(segments.size(), num_segments);
+        std::unique_ptr<segment_v2::IndexedColumnIterator>* rowset_index_iterators = nullptr;
+        if (index_iterators != nullptr) {
+            DCHECK_EQ(index_iterators->size(), specified_rowsets.size());
+            (*index_iterators)[i].resize(num_segments);
+            rowset_index_iterators = (*index_iterators)[i].data();
+        }
 
         for (auto id : picked_segments) {
-            Status s = segments[id]->lookup_row_key(encoded_key, with_seq_col, with_rowid, &loc);
+            Status s = segments[id]->lookup_row_key(
+                    encoded_key, with_seq_col, with_rowid, &loc,
+                    rowset_index_iterators ? &rowset_index_iterators[id] : nullptr);
             if (s.is<KEY_NOT_FOUND>()) {
                 continue;
             }
@@ -592,11 +606,28 @@ Status BaseTablet::calc_delete_bitmap(const BaseTabletSPtr& tablet, RowsetShared
     }
 
     OlapStopWatch watch;
+    // Rows of a segment are independent of each other unless they have to be aligned for
+    // partial update, so a large segment is split into several tasks to use all the threads
+    // of the token.
+    // With cluster keys the row ids are not the ordinals of the primary key index.
+    uint32_t rows_per_task = config::calc_delete_bitmap_rows_per_task;
+    bool split_segments = token != nullptr && rows_per_task > 0 &&
+                          (rowset_writer == nullptr || !rowset_writer->is_partial_update()) &&
+                          rowset->tablet_schema()->cluster_key_idxes().empty();
     for (const auto& segment : segments) {
         const auto& seg = segment;
         if (token != nullptr) {
-            RETURN_IF_ERROR(token->submit(tablet, rowset, seg, specified_rowsets, end_version,
-                                          delete_bitmap, rowset_writer));
+            uint32_t num_rows = seg->num_rows();
+            if (!split_segments || num_rows <= rows_per_task) {
+                RETURN_IF_ERROR(token->submit(tablet, rowset, seg, specified_rowsets, end_version,
+                                              delete_bitmap, rowset_writer));
+                continue;
+            }
+            for (uint32_t start_row = 0; start_row < num_rows; start_row += rows_per_task) {
+                RETURN_IF_ERROR(token->submit(tablet, rowset, seg, specified_rowsets, end_version,
+                                              delete_bitmap, rowset_writer, start_row,
+                                              std::min(num_rows, start_row + rows_per_task)));
+            }
         } else {
             RETURN_IF_ERROR(tablet->calc_segment_delete_bitmap(
                     rowset, segment, specified_rowsets, delete_bitmap, end_version, rowset_writer));
@@ -610,7 +641,8 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
                                               const segment_v2::SegmentSharedPtr& seg,
                                               const std::vector<RowsetSharedPtr>& specified_rowsets,
                                               DeleteBitmapPtr delete_bitmap, int64_t end_version,
-                                              RowsetWriter* rowset_writer) {
+                                              RowsetWriter* rowset_writer, uint32_t start_row,
+                                              uint32_t end_row) {
     OlapStopWatch watch;
     auto rowset_id = rowset->rowset_id();
     Version dummy_version(end_version + 1, end_version + 1);
@@ -639,16 +671,24 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
 
     RETURN_IF_ERROR(seg->load_pk_index_and_bf()); // We need index blocks to iterate
     const auto* pk_idx = seg->get_primary_key_index();
-    int total = pk_idx->num_rows();
-    uint32_t row_id = 0;
-    int32_t remaining = total;
+    int total = static_cast<int>(std::min(end_row, pk_idx->num_rows()));
+    DCHECK(start_row == 0 || start_row < total);
+    uint32_t row_id = start_row;
+    int32_t remaining = total - static_cast<int>(start_row);
     bool exact_match = false;
     std::string last_key;
+    if (start_row > 0) {
+        // the first batch seeks to the key of `start_row`
+        RETURN_IF_ERROR(seg->read_key_by_rowid(start_row, &last_key));
+    }
     int batch_size = 1024;
     // The data for each segment may be lookup multiple times. Creating a SegmentCacheHandle
     // will update the lru cache, and there will be obvious lock competition in multithreading
     // scenarios, so using a segment_caches to cache SegmentCacheHandle.
     std::vector<std::unique_ptr<SegmentCacheHandle>> segment_caches(specified_rowsets.size());
+    // The keys of the segment are read in ascending order, the index iterators of the segments
+    // looked up are kept to walk their primary key indexes forwards.
+    PkIndexIterators index_iterators(specified_rowsets.size());
     while (remaining > 0) {
         std::unique_ptr<segment_v2::IndexedColumnIterator> iter;
         RETURN_IF_ERROR(pk_idx->new_iterator(&iter));
@@ -707,7 +747,7 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
 
             RowsetSharedPtr rowset_find;
             auto st = lookup_row_key(key, true, specified_rowsets, &loc, dummy_version.first - 1,
-                                     segment_caches, &rowset_find);
+                                     segment_caches, &rowset_find, true, &index_iterators);
             bool expected_st = st.ok() || st.is<KEY_NOT_FOUND>() || st.is<KEY_ALREADY_EXISTS>();
             // It's a defensive DCHECK, we need to exclude some common errors to avoid core-dump
             // while stress test
@@ -811,7 +851,8 @@ Status BaseTablet::calc_segment_delete_bitmap(RowsetSharedPtr rowset,
     }
     LOG(INFO) << "calc segment delete bitmap, tablet: " << tablet_id() << " rowset: " << rowset_id
               << " seg_id: " << seg->id() << " dummy_version: " << end_version + 1
-              << " rows: " << seg->num_rows() << " conflict rows: " << conflict_rows
+              << " rows: " << seg->num_rows() << " calculated rows: [" << start_row << ", "
+              << total << ") conflict rows: " << conflict_rows
               << " bitmap num: " << delete_bitmap->delete_bitmap.size()
               << " cost: " << watch.get_elapse_time_us() << "(us)";
     return Status::OK();
@@ -1501,4 +1542,64 @@ void BaseTablet::calc_consecutive_empty_rowsets(
     }
 }
 
+void BaseTablet::EqualPredicateScanCount::roll(int64_t now) {
+    const int64_t window = std::max<int64_t>(config::auto_bloom_filter_window_sec, 1);
+    if (now - window_start < window) {
+        return;
+    }
+    last_window_count = now - window_start < 2 * window ? count : 0;
+    count = 0;
+    window_start = now;
+}
+
+void BaseTablet::record_equal_predicate_columns(const std::set<int32_t>& column_unique_ids) {
+    if (!config::enable_auto_bloom_filter || column_unique_ids.empty()) {
+        return;
+    }
+    const int64_t now = UnixSeconds();
+    std::lock_guard lock(_equal_predicate_columns_lock);
+    for (auto uid : column_unique_ids) {
+        auto& scan_count = _equal_predicate_columns[uid];
+        scan_count.roll(now);
+        ++scan_count.count;
+    }
+}
+
+std::set<int32_t> BaseTablet::auto_bloom_filter_columns(const TabletSchema& schema) {
+    std::set<int32_t> columns;
+    if (!config::enable_auto_bloom_filter || config::auto_bloom_filter_max_columns <= 0) {
+        return columns;
+    }
+    // <scan count, unique id>
+    std::vector<std::pair<int64_t, int32_t>> candidates;
+    {
+        const int64_t now = UnixSeconds();
+        std::lock_guard lock(_equal_predicate_columns_lock);
+        for (auto& [uid, scan_count] : _equal_predicate_columns) {
+            scan_count.roll(now);
+            int64_t count = scan_count.count + scan_count.last_window_count;
+            if (count >= config::auto_bloom_filter_min_scan_count) {
+                candidates.emplace_back(count, uid);
+            }
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(), std::greater<>());
+    for (auto [_, uid] : candidates) {
+        if (columns.size() >= static_cast<size_t>(config::auto_bloom_filter_max_columns)) {
+            break;
+        }
+        int32_t index = schema.field_index(uid);
+        if (index < 0) {
+            continue;
+        }
+        const auto& column = schema.column(index);
+        if (column.is_bf_column() || schema.get_ngram_bf_index(uid) != nullptr ||
+            !segment_v2::BloomFilterIndexWriter::is_supported_type(column.type())) {
+            continue;
+        }
+        columns.insert(uid);
+    }
+    return columns;
+}
+
 } // namespace doris
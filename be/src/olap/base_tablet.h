@@ -18,8 +18,11 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <set>
 #include <shared_mutex>
 #include <string>
+#include <unordered_map>
 
 #include "common/status.h"
 #include "olap/partial_update_info.h"
@@ -37,6 +40,11 @@ class CalcDeleteBitmapToken;
 class SegmentCacheHandle;
 class RowIdConversion;
 
+// The primary key index iterators of the segments of each rowset, indexed by the position of
+// the rowset in the rowsets looked up and then by the segment id.
+using PkIndexIterators =
+        std::vector<std::vector<std::unique_ptr<segment_v2::IndexedColumnIterator>>>;
+
 struct TabletWithVersion {
     BaseTabletSPtr tablet;
     int64_t version;
@@ -139,11 +147,15 @@ public:
     // Lookup the row location of `encoded_key`, the function sets `row_location` on success.
     // NOTE: the method only works in unique key model with primary key index, you will got a
     //       not supported error in other data model.
+    // Callers looking up many keys in ascending order should pass `index_iterators`, holding
+    // the primary key index iterators of the segments of `specified_rowsets` between the
+    // lookups, so that each index is walked forwards once instead of being sought per key.
     Status lookup_row_key(const Slice& encoded_key, bool with_seq_col,
                           const std::vector<RowsetSharedPtr>& specified_rowsets,
                           RowLocation* row_location, uint32_t version,
                           std::vector<std::unique_ptr<SegmentCacheHandle>>& segment_caches,
-                          RowsetSharedPtr* rowset = nullptr, bool with_rowid = true);
+                          RowsetSharedPtr* rowset = nullptr, bool with_rowid = true,
+                          PkIndexIterators* index_iterators = nullptr);
 
     static void prepare_to_read(const RowLocation& row_location, size_t pos,
                                 PartialUpdateReadPlan* read_plan);
@@ -161,11 +173,13 @@ public:
                                      CalcDeleteBitmapToken* token,
                                      RowsetWriter* rowset_writer = nullptr);
 
+    // calc the delete bitmap of the rows [start_row, end_row) of `seg`
     Status calc_segment_delete_bitmap(RowsetSharedPtr rowset,
                                       const segment_v2::SegmentSharedPtr& seg,
                                       const std::vector<RowsetSharedPtr>& specified_rowsets,
                                       DeleteBitmapPtr delete_bitmap, int64_t end_version,
-                                      RowsetWriter* rowset_writer);
+                                      RowsetWriter* rowset_writer, uint32_t start_row = 0,
+                                      uint32_t end_row = UINT32_MAX);
 
     Status calc_delete_bitmap_between_segments(
             RowsetSharedPtr rowset, const std::vector<segment_v2::SegmentSharedPtr>& segments,
@@ -248,6 +262,13 @@ public:
                                         const std::vector<RowsetSharedPtr>& candidate_rowsets,
                                         int limit);
 
+    // Record the columns in the equality or IN predicates of a query scan on this tablet.
+    void record_equal_predicate_columns(const std::set<int32_t>& column_unique_ids);
+
+    // The columns of `schema` which compaction builds page bloom filters for, because they are
+    // often in the equality or IN predicates of the recent queries, see enable_auto_bloom_filter.
+    std::set<int32_t> auto_bloom_filter_columns(const TabletSchema& schema);
+
 protected:
     // Find the missed versions until the spec_version.
     //
@@ -289,6 +310,18 @@ protected:
 protected:
     std::mutex _schema_change_lock;
 
+    // the scans with an equality or IN predicate on a column, counted in two windows of
+    // auto_bloom_filter_window_sec, so the counts of the last full window are kept
+    struct EqualPredicateScanCount {
+        int64_t window_start = 0;
+        int64_t count = 0;
+        int64_t last_window_count = 0;
+
+        void roll(int64_t now);
+    };
+    std::mutex _equal_predicate_columns_lock;
+    std::unordered_map<int32_t, EqualPredicateScanCount> _equal_predicate_columns;
+
 public:
     IntCounter* query_scan_bytes = nullptr;
     IntCounter* query_scan_rows = nullptr;
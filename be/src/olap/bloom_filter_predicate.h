@@ -17,9 +17,14 @@
 
 #pragma once
 
+#include <map>
+#include <utility>
+#include <vector>
+
 #include "exprs/bloom_filter_func.h"
 #include "exprs/runtime_filter.h"
 #include "olap/column_predicate.h"
+#include "olap/olap_common.h"
 #include "runtime/primitive_type.h"
 #include "vec/columns/column_dictionary.h"
 #include "vec/columns/column_nullable.h"
@@ -70,8 +75,13 @@ private:
         uint16_t new_size = 0;
         if (column.is_column_dictionary()) {
             const auto* dict_col = assert_cast<const vectorized::ColumnDictI32*>(&column);
+            auto& dict_flags = _segment_id_to_dict_flags[dict_col->get_rowset_segment_id()];
+            // the dictionary may be empty if the pages read before are all null
+            if (dict_flags.size() != dict_col->dict_size()) {
+                _specific_filter->find_dict_codes(dict_col, dict_flags);
+            }
             new_size = _specific_filter->template find_dict_olap_engine<is_nullable>(
-                    dict_col, null_map, sel, size);
+                    dict_col, dict_flags, null_map, sel, size);
         } else {
             const auto& data =
                     assert_cast<const vectorized::PredicateColumnType<PredicateEvaluateType<T>>*>(
@@ -97,6 +107,9 @@ private:
 
     std::shared_ptr<BloomFilterFuncBase> _filter;
     SpecificFilter* _specific_filter; // owned by _filter
+    // the result of the bloom filter on each word of the dictionary of a segment
+    mutable std::map<std::pair<RowsetId, uint32_t>, std::vector<vectorized::UInt8>>
+            _segment_id_to_dict_flags;
 };
 
 template <PrimitiveType T>
@@ -43,6 +43,7 @@
 #include "io/cache/block_file_cache_factory.h"
 #include "io/fs/file_system.h"
 #include "io/fs/file_writer.h"
+#include "io/fs/local_io_scheduler.h"
 #include "io/fs/remote_file_system.h"
 #include "olap/cumulative_compaction_policy.h"
 #include "olap/cumulative_compaction_time_series_policy.h"
@@ -60,6 +61,7 @@
 #include "olap/rowset/segment_v2/inverted_index_file_reader.h"
 #include "olap/rowset/segment_v2/inverted_index_file_writer.h"
 #include "olap/rowset/segment_v2/inverted_index_fs_directory.h"
+#include "olap/rowset/segment_v2/segment.h"
 #include "olap/storage_engine.h"
 #include "olap/storage_policy.h"
 #include "olap/tablet.h"
@@ -80,6 +82,28 @@ using namespace ErrorCode;
 
 namespace {
 
+// whether the segments of the rowset are non-overlapping and not smaller than pre_max_key,
+// which is set to the max key of the rowset
+bool is_rowset_ordered(std::string& pre_max_key, const RowsetSharedPtr& rhs) {
+    if (rhs->num_segments() == 0) {
+        return true;
+    }
+    if (rhs->is_segments_overlapping()) {
+        return false;
+    }
+    std::string min_key;
+    auto ret = rhs->min_key(&min_key);
+    if (!ret) {
+        return false;
+    }
+    if (min_key < pre_max_key) {
+        return false;
+    }
+    CHECK(rhs->max_key(&pre_max_key));
+
+    return true;
+}
+
 bool is_rowset_tidy(std::string& pre_max_key, const RowsetSharedPtr& rhs) {
     size_t min_tidy_size = config::ordered_data_compaction_min_segment_size;
     if (rhs->num_segments() == 0) {
@@ -98,17 +122,7 @@ bool is_rowset_tidy(std::string& pre_max_key, const RowsetSharedPtr& rhs) {
             return false;
         }
     }
-    std::string min_key;
-    auto ret = rhs->min_key(&min_key);
-    if (!ret) {
-        return false;
-    }
-    if (min_key < pre_max_key) {
-        return false;
-    }
-    CHECK(rhs->max_key(&pre_max_key));
-
-    return true;
+    return is_rowset_ordered(pre_max_key, rhs);
 }
 
 } // namespace
@@ -158,6 +172,15 @@ Status Compaction::merge_input_rowsets() {
         input_rs_readers.push_back(std::move(rs_reader));
     }
 
+    // the rows of a duplicate key tablet sorted by z-order are reordered by the horizontal
+    // merge, see Merger::vmerge_rowsets
+    if (_cur_tablet_schema->sort_type() == SortType::ZORDER &&
+        _cur_tablet_schema->keys_type() == KeysType::DUP_KEYS &&
+        (compaction_type() == ReaderType::READER_BASE_COMPACTION ||
+         compaction_type() == ReaderType::READER_FULL_COMPACTION)) {
+        _is_vertical = false;
+    }
+
     RowsetWriterContext ctx;
     RETURN_IF_ERROR(construct_output_rowset_writer(ctx));
 
@@ -173,7 +196,12 @@ Status Compaction::merge_input_rowsets() {
     Status res;
     {
         SCOPED_TIMER(_merge_rowsets_latency_timer);
-        if (_is_vertical) {
+        std::vector<segment_v2::SegmentSharedPtr> segments;
+        if (_is_vertical && load_segments_for_page_copy(&segments)) {
+            res = Merger::page_copy_merge_rowsets(_tablet, compaction_type(), _cur_tablet_schema,
+                                                  segments, _output_rs_writer.get(),
+                                                  get_avg_segment_rows(), &_stats);
+        } else if (_is_vertical) {
             res = Merger::vertical_merge_rowsets(_tablet, compaction_type(), *_cur_tablet_schema,
                                                  input_rs_readers, _output_rs_writer.get(),
                                                  get_avg_segment_rows(), &_stats);
@@ -227,6 +255,31 @@ Status Compaction::merge_input_rowsets() {
     return check_correctness();
 }
 
+bool Compaction::load_segments_for_page_copy(std::vector<segment_v2::SegmentSharedPtr>* segments) {
+    if (!config::enable_page_copy_compaction ||
+        compaction_type() != ReaderType::READER_CUMULATIVE_COMPACTION ||
+        _tablet->keys_type() != KeysType::DUP_KEYS || _stats.rowid_conversion != nullptr) {
+        return false;
+    }
+    // the rows of the rowsets are in key order when their segments are concatenated
+    std::string pre_max_key;
+    for (auto& rowset : _input_rowsets) {
+        if (rowset->rowset_meta()->has_delete_predicate() ||
+            !is_rowset_ordered(pre_max_key, rowset)) {
+            return false;
+        }
+        std::vector<segment_v2::SegmentSharedPtr> rowset_segments;
+        auto st = std::static_pointer_cast<BetaRowset>(rowset)->load_segments(&rowset_segments);
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to load segments of rowset " << rowset->rowset_id()
+                         << " for page copy compaction: " << st;
+            return false;
+        }
+        segments->insert(segments->end(), rowset_segments.begin(), rowset_segments.end());
+    }
+    return Merger::can_copy_value_pages(*_cur_tablet_schema, _output_rs_writer.get(), *segments);
+}
+
 int64_t Compaction::get_avg_segment_rows() {
     // take care of empty rowset
     // input_rowsets_size is total disk_size of input_rowset, this size is the
@@ -373,6 +426,7 @@ bool CompactionMixin::handle_ordered_data_compaction() {
 }
 
 Status CompactionMixin::execute_compact() {
+    SCOPED_IO_TAG(io::IOClass::COMPACTION);
     uint32_t checksum_before;
     uint32_t checksum_after;
     bool enable_compaction_checksum = config::enable_compaction_checksum;
@@ -869,6 +923,7 @@ Status CompactionMixin::construct_output_rowset_writer(RowsetWriterContext& ctx)
     ctx.rowset_state = VISIBLE;
     ctx.segments_overlap = NONOVERLAPPING;
     ctx.tablet_schema = _cur_tablet_schema;
+    ctx.auto_bloom_filter_columns = _tablet->auto_bloom_filter_columns(*_cur_tablet_schema);
     ctx.newest_write_timestamp = _newest_write_timestamp;
     ctx.write_type = DataWriteType::TYPE_COMPACTION;
     _output_rs_writer = DORIS_TRY(_tablet->create_rowset_writer(ctx, _is_vertical));
@@ -1064,6 +1119,15 @@ int64_t CompactionMixin::get_compaction_permits() {
     return permits;
 }
 
+int64_t CompactionMixin::get_compaction_io_cost() {
+    // the input rowsets are read once and the output rowset is about as large as them
+    int64_t input_size = 0;
+    for (auto&& rowset : _input_rowsets) {
+        input_size += rowset->data_disk_size();
+    }
+    return input_size * 2;
+}
+
 void Compaction::_load_segment_to_cache() {
     // Load new rowset's segments to cache.
     SegmentCacheHandle handle;
@@ -1157,6 +1221,7 @@ Status CloudCompactionMixin::construct_output_rowset_writer(RowsetWriterContext&
     ctx.rowset_state = VISIBLE;
     ctx.segments_overlap = NONOVERLAPPING;
     ctx.tablet_schema = _cur_tablet_schema;
+    ctx.auto_bloom_filter_columns = _tablet->auto_bloom_filter_columns(*_cur_tablet_schema);
     ctx.newest_write_timestamp = _newest_write_timestamp;
     ctx.write_type = DataWriteType::TYPE_COMPACTION;
 
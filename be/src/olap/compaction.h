@@ -37,6 +37,9 @@ namespace doris {
 
 class MemTrackerLimiter;
 class RowsetWriter;
+namespace segment_v2 {
+class Segment;
+} // namespace segment_v2
 struct RowsetWriterContext;
 class StorageEngine;
 class CloudStorageEngine;
@@ -64,6 +67,12 @@ public:
     virtual ReaderType compaction_type() const = 0;
     virtual std::string_view compaction_name() const = 0;
 
+    int64_t input_rowsets_size() const { return _input_rowsets_size; }
+    int64_t input_row_num() const { return _input_row_num; }
+    int64_t merged_rows() const { return _stats.merged_rows; }
+    // nullptr until the compaction succeeds
+    const RowsetSharedPtr& output_rowset() const { return _output_rowset; }
+
 protected:
     Status merge_input_rowsets();
 
@@ -77,6 +86,10 @@ protected:
 
     int64_t get_avg_segment_rows();
 
+    // for page copy compaction, load the segments of the input rowsets in key order if
+    // the data pages of their value columns can be copied to the output rowset
+    bool load_segments_for_page_copy(std::vector<std::shared_ptr<segment_v2::Segment>>* segments);
+
     void init_profile(const std::string& label);
 
     void _load_segment_to_cache();
@@ -134,6 +147,9 @@ public:
 
     int64_t get_compaction_permits();
 
+    // Estimated bytes read and written by this compaction
+    int64_t get_compaction_io_cost();
+
 protected:
     // Convert `_tablet` from `BaseTablet` to `Tablet`
     Tablet* tablet();
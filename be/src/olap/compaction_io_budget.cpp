@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "olap/compaction_io_budget.h"
+
+#include <algorithm>
+
+#include "common/config.h"
+
+namespace doris {
+
+// weight of a new sample in the moving averages of bandwidth and latency
+static constexpr double kBandwidthAlpha = 0.3;
+static constexpr double kLatencyAlpha = 0.1;
+// the baseline still follows a lasting change of the latency while compaction is throttled
+static constexpr double kThrottledLatencyAlpha = 0.01;
+static constexpr double kMinThrottleRatio = 0.1;
+static constexpr double kThrottleRecoverStep = 0.1;
+
+bool CompactionIOBudget::try_acquire(int64_t cost) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    int64_t budget = _budget();
+    if (_running_tasks > 0 && budget > 0 && _used_bytes + cost > budget) {
+        return false;
+    }
+    _used_bytes += cost;
+    ++_running_tasks;
+    return true;
+}
+
+void CompactionIOBudget::release(int64_t cost, int64_t elapsed_us) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (elapsed_us > 0 && cost > 0) {
+        // the task shared the disk with the other running ones, so the dir served about
+        // `_running_tasks` times its throughput
+        double sample = static_cast<double>(cost) * 1000000 / elapsed_us * _running_tasks;
+        _bandwidth = _bandwidth == 0
+                             ? sample
+                             : (1 - kBandwidthAlpha) * _bandwidth + kBandwidthAlpha * sample;
+    }
+    _used_bytes -= cost;
+    --_running_tasks;
+}
+
+bool CompactionIOBudget::exhausted() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    int64_t budget = _budget();
+    return _running_tasks > 0 && budget > 0 && _used_bytes >= budget;
+}
+
+void CompactionIOBudget::update_foreground_latency(int64_t latency_us) {
+    if (latency_us <= 0) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_latency_baseline_us == 0) {
+        _latency_baseline_us = latency_us;
+        return;
+    }
+    if (latency_us > _latency_baseline_us * config::compaction_io_throttle_latency_ratio) {
+        _throttle_ratio = std::max(kMinThrottleRatio, _throttle_ratio / 2);
+        _latency_baseline_us = (1 - kThrottledLatencyAlpha) * _latency_baseline_us +
+                               kThrottledLatencyAlpha * latency_us;
+    } else {
+        _throttle_ratio = std::min(1.0, _throttle_ratio + kThrottleRecoverStep);
+        _latency_baseline_us =
+                (1 - kLatencyAlpha) * _latency_baseline_us + kLatencyAlpha * latency_us;
+    }
+}
+
+int64_t CompactionIOBudget::budget() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _budget();
+}
+
+int64_t CompactionIOBudget::_budget() const {
+    return static_cast<int64_t>(_bandwidth * config::compaction_io_budget_window_sec *
+                                _throttle_ratio);
+}
+
+int64_t CompactionIOBudget::used() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _used_bytes;
+}
+
+int64_t CompactionIOBudget::bandwidth() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return static_cast<int64_t>(_bandwidth);
+}
+
+double CompactionIOBudget::throttle_ratio() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _throttle_ratio;
+}
+
+} // namespace doris
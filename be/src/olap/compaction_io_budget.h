@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include <stdint.h>
+
+#include <mutex>
+
+namespace doris {
+
+// The budget of disk bandwidth for the compaction tasks of one data dir.
+//
+// The bandwidth is measured, not configured: every finished task reports the bytes it read and
+// wrote and how long it ran, and the throughput of the dir is estimated from it while taking the
+// tasks running concurrently into account. A task is admitted while the bytes of all running
+// tasks can be served within config::compaction_io_budget_window_sec at that bandwidth, and one
+// task is always admitted so that compaction makes progress on a slow disk.
+//
+// The budget is scaled by a throttle ratio driven by the latency of foreground reads: it is
+// halved while the latency is above config::compaction_io_throttle_latency_ratio times its usual
+// value and recovers additively once the latency is back to normal.
+class CompactionIOBudget {
+public:
+    // Return true and account `cost` bytes if a task reading and writing `cost` bytes may run.
+    bool try_acquire(int64_t cost);
+
+    // Release a task admitted by `try_acquire`, `elapsed_us` is 0 if the task did not run
+    void release(int64_t cost, int64_t elapsed_us);
+
+    // Return true if no more task would be admitted
+    bool exhausted() const;
+
+    // Feed the recent average latency of foreground reads, 0 if there was no read
+    void update_foreground_latency(int64_t latency_us);
+
+    // the bytes that the running tasks may read and write, 0 before the first measurement
+    int64_t budget() const;
+
+    int64_t used() const;
+
+    // estimated bytes per second the disk serves to compactions
+    int64_t bandwidth() const;
+
+    double throttle_ratio() const;
+
+private:
+    int64_t _budget() const;
+
+    mutable std::mutex _mutex;
+    int64_t _used_bytes = 0;
+    int64_t _running_tasks = 0;
+    double _bandwidth = 0;
+    double _latency_baseline_us = 0;
+    double _throttle_ratio = 1.0;
+};
+
+} // namespace doris
@@ -0,0 +1,114 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/compaction_stats.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "common/config.h"
+#include "util/time.h"
+
+namespace doris {
+
+void TabletCompactionStats::Totals::merge(const Totals& other) {
+    ingested_bytes += other.ingested_bytes;
+    num_compactions += other.num_compactions;
+    num_failures += other.num_failures;
+    input_bytes += other.input_bytes;
+    output_bytes += other.output_bytes;
+    elapsed_us += other.elapsed_us;
+    queue_delay_us += other.queue_delay_us;
+}
+
+void TabletCompactionStats::Totals::to_json(rapidjson::Value* object,
+                                            rapidjson::Document::AllocatorType& allocator) const {
+    object->AddMember("ingested_bytes", ingested_bytes, allocator);
+    object->AddMember("num_compactions", num_compactions, allocator);
+    object->AddMember("num_failures", num_failures, allocator);
+    object->AddMember("input_bytes", input_bytes, allocator);
+    object->AddMember("output_bytes", output_bytes, allocator);
+    // The bytes read by the compactions per byte ingested, and the bytes written by the loads
+    // and the compactions per byte ingested.
+    double merged_per_ingested = 0;
+    double write_amplification = 0;
+    if (ingested_bytes > 0) {
+        merged_per_ingested = static_cast<double>(input_bytes) / ingested_bytes;
+        write_amplification = static_cast<double>(ingested_bytes + output_bytes) / ingested_bytes;
+    }
+    object->AddMember("merged_bytes_per_ingested_byte", merged_per_ingested, allocator);
+    object->AddMember("write_amplification", write_amplification, allocator);
+    object->AddMember("compaction_time_ms", elapsed_us / 1000, allocator);
+    int64_t num_tasks = num_compactions + num_failures;
+    object->AddMember("avg_queue_delay_ms",
+                      num_tasks > 0 ? queue_delay_us / 1000 / num_tasks : int64_t(0), allocator);
+}
+
+void TabletCompactionStats::add_record(Record record) {
+    std::lock_guard lock(_lock);
+    if (record.success) {
+        ++_totals.num_compactions;
+        _totals.input_bytes += record.input_bytes;
+        _totals.output_bytes += record.output_bytes;
+    } else {
+        ++_totals.num_failures;
+    }
+    _totals.elapsed_us += record.elapsed_us;
+    _totals.queue_delay_us += record.queue_delay_us;
+    _records.push_front(std::move(record));
+    auto history_num = static_cast<size_t>(std::max(config::compaction_stats_history_num, 0));
+    while (_records.size() > history_num) {
+        _records.pop_back();
+    }
+}
+
+TabletCompactionStats::Totals TabletCompactionStats::totals() const {
+    std::lock_guard lock(_lock);
+    Totals totals = _totals;
+    totals.ingested_bytes = _ingested_bytes.load(std::memory_order_relaxed);
+    return totals;
+}
+
+void TabletCompactionStats::to_json(rapidjson::Value* object,
+                                    rapidjson::Document::AllocatorType& allocator) const {
+    totals().to_json(object, allocator);
+
+    rapidjson::Value records(rapidjson::kArrayType);
+    std::lock_guard lock(_lock);
+    for (const auto& record : _records) {
+        rapidjson::Value value(rapidjson::kObjectType);
+        value.AddMember("type", rapidjson::Value(record.type.c_str(), allocator), allocator);
+        value.AddMember("success", record.success, allocator);
+        value.AddMember(
+                "finish_time",
+                rapidjson::Value(ToStringFromUnixMillis(record.finish_time_ms).c_str(), allocator),
+                allocator);
+        value.AddMember("input_bytes", record.input_bytes, allocator);
+        value.AddMember("output_bytes", record.output_bytes, allocator);
+        value.AddMember("input_rows", record.input_rows, allocator);
+        value.AddMember("output_rows", record.output_rows, allocator);
+        value.AddMember("merged_rows", record.merged_rows, allocator);
+        value.AddMember("elapsed_ms", record.elapsed_us / 1000, allocator);
+        value.AddMember("queue_delay_ms", record.queue_delay_us / 1000, allocator);
+        value.AddMember("score_before", record.score_before, allocator);
+        value.AddMember("score_after", record.score_after, allocator);
+        records.PushBack(value, allocator);
+    }
+    object->AddMember("last_compactions", records, allocator);
+}
+
+} // namespace doris
@@ -0,0 +1,86 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <rapidjson/document.h>
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+
+namespace doris {
+
+// The compaction telemetry of a tablet since it is loaded: the bytes ingested and compacted,
+// whose ratio is the write amplification of the tablet, the time the compactions ran and
+// waited in their thread pool, and the last compactions with the score before and after them.
+class TabletCompactionStats {
+public:
+    struct Record {
+        std::string type;
+        bool success = false;
+        // Unix time
+        int64_t finish_time_ms = 0;
+        int64_t input_bytes = 0;
+        int64_t output_bytes = 0;
+        int64_t input_rows = 0;
+        int64_t output_rows = 0;
+        int64_t merged_rows = 0;
+        int64_t elapsed_us = 0;
+        int64_t queue_delay_us = 0;
+        // -1 if the compaction has no score, e.g. a full compaction
+        int64_t score_before = -1;
+        int64_t score_after = -1;
+    };
+
+    // The sums over the successful compactions, which add up over the tablets of a partition.
+    struct Totals {
+        int64_t ingested_bytes = 0;
+        int64_t num_compactions = 0;
+        int64_t num_failures = 0;
+        int64_t input_bytes = 0;
+        int64_t output_bytes = 0;
+        int64_t elapsed_us = 0;
+        int64_t queue_delay_us = 0;
+
+        void merge(const Totals& other);
+        void to_json(rapidjson::Value* object,
+                     rapidjson::Document::AllocatorType& allocator) const;
+    };
+
+    void add_ingested_bytes(int64_t bytes) {
+        _ingested_bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    void add_record(Record record);
+
+    Totals totals() const;
+
+    // Sets the totals and the last compactions, the latest first, as members of the object.
+    void to_json(rapidjson::Value* object, rapidjson::Document::AllocatorType& allocator) const;
+
+private:
+    std::atomic<int64_t> _ingested_bytes = 0;
+
+    mutable std::mutex _lock;
+    Totals _totals;
+    std::deque<Record> _records;
+};
+
+} // namespace doris
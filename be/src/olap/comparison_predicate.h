@@ -104,8 +104,9 @@ public:
         std::unique_ptr<InvertedIndexQueryParamFactory> query_param = nullptr;
         RETURN_IF_ERROR(
                 InvertedIndexQueryParamFactory::create_query_value<Type>(&_value, query_param));
+        // only the rows still in bitmap matter, for NE as well as for the other types
         RETURN_IF_ERROR(iterator->read_from_inverted_index(column_name, query_param->get_value(),
-                                                           query_type, num_rows, roaring));
+                                                           query_type, num_rows, *bitmap, roaring));
 
         // mask out null_bitmap, since NULL cmp VALUE will produce NULL
         //  and be treated as false in WHERE
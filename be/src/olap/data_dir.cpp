@@ -30,6 +30,7 @@
 #include <cstddef>
 #include <filesystem>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <roaring/roaring.hh>
 #include <set>
@@ -63,7 +64,9 @@
 #include "olap/utils.h" // for check_dir_existed
 #include "service/backend_options.h"
 #include "util/doris_metrics.h"
+#include "util/stopwatch.hpp"
 #include "util/string_util.h"
+#include "util/threadpool.h"
 #include "util/uid_util.h"
 
 namespace doris {
@@ -353,6 +356,8 @@ Status DataDir::load() {
     // necessarily check incompatible old format. when there are old metas, it may load to data missing
     RETURN_IF_ERROR(_check_incompatible_old_format_tablet());
 
+    MonotonicStopWatch watch;
+    watch.start();
     std::vector<RowsetMetaSharedPtr> dir_rowset_metas;
     LOG(INFO) << "begin loading rowset from meta";
     auto load_rowset_func = [&dir_rowset_metas, this](TabletUid tablet_uid, RowsetId rowset_id,
@@ -410,16 +415,26 @@ Status DataDir::load() {
         LOG(INFO) << "load rowset from meta finished, data dir: " << _path;
     }
 
+    int64_t load_rowset_meta_ns = watch.elapsed_time();
+
     // load tablet
     // create tablet from tablet meta and add it to tablet mgr
     LOG(INFO) << "begin loading tablet from meta";
+    // The tablet metas are deserialized and the tablets are created by a pool of threads
+    std::unique_ptr<ThreadPool> load_tablet_pool;
+    int num_load_tablet_threads = std::max(config::load_tablet_meta_thread_num_per_store, 1);
+    RETURN_IF_ERROR(ThreadPoolBuilder("LoadTabletMetaThreadPool")
+                            .set_min_threads(num_load_tablet_threads)
+                            .set_max_threads(num_load_tablet_threads)
+                            .build(&load_tablet_pool));
+    std::mutex tablet_ids_mutex;
     std::set<int64_t> tablet_ids;
     std::set<int64_t> failed_tablet_ids;
-    auto load_tablet_func = [this, &tablet_ids, &failed_tablet_ids](
-                                    int64_t tablet_id, int32_t schema_hash,
-                                    const std::string& value) -> bool {
+    auto load_tablet = [this, &tablet_ids, &failed_tablet_ids, &tablet_ids_mutex](
+                               int64_t tablet_id, int32_t schema_hash, const std::string& value) {
         Status status = _engine.tablet_manager()->load_tablet_from_meta(
                 this, tablet_id, schema_hash, value, false, false, false, false);
+        std::lock_guard l(tablet_ids_mutex);
         if (!status.ok() && !status.is<TABLE_ALREADY_DELETED_ERROR>() &&
             !status.is<ENGINE_INSERT_OLD_TABLET>()) {
             // load_tablet_from_meta() may return Status::Error<TABLE_ALREADY_DELETED_ERROR>()
@@ -442,9 +457,28 @@ Status DataDir::load() {
         } else {
             tablet_ids.insert(tablet_id);
         }
+    };
+    // Wait for the loading tablets once in a while to bound the memory of the pending metas
+    constexpr size_t max_pending_tablet_metas = 4096;
+    size_t num_tablet_metas = 0;
+    auto load_tablet_func = [&](int64_t tablet_id, int32_t schema_hash,
+                                const std::string& value) -> bool {
+        Status st = load_tablet_pool->submit_func(
+                [&load_tablet, tablet_id, schema_hash, value]() {
+                    load_tablet(tablet_id, schema_hash, value);
+                });
+        if (!st.ok()) {
+            load_tablet(tablet_id, schema_hash, value);
+        }
+        if (++num_tablet_metas % max_pending_tablet_metas == 0) {
+            load_tablet_pool->wait();
+        }
         return true;
     };
     Status load_tablet_status = TabletMetaManager::traverse_headers(_meta, load_tablet_func);
+    load_tablet_pool->wait();
+    load_tablet_pool->shutdown();
+    int64_t load_tablet_meta_ns = watch.elapsed_time() - load_rowset_meta_ns;
     if (!failed_tablet_ids.empty()) {
         LOG(WARNING) << "load tablets from header failed"
                      << ", loaded tablet: " << tablet_ids.size()
@@ -500,6 +534,7 @@ Status DataDir::load() {
         exit(-1);
     }
 
+    int64_t add_rowset_start_ns = watch.elapsed_time();
     // traverse rowset
     // 1. add committed rowset to txn map
     // 2. add visible rowset to tablet
@@ -589,6 +624,8 @@ Status DataDir::load() {
         }
     }
 
+    int64_t add_rowset_ns = watch.elapsed_time() - add_rowset_start_ns;
+
     auto load_delete_bitmap_func = [this](int64_t tablet_id, int64_t version, const string& val) {
         TabletSharedPtr tablet = _engine.tablet_manager()->get_tablet(tablet_id);
         if (!tablet) {
@@ -628,13 +665,19 @@ Status DataDir::load() {
         return true;
     };
     RETURN_IF_ERROR(TabletMetaManager::traverse_delete_bitmap(_meta, load_delete_bitmap_func));
+    int64_t load_delete_bitmap_ns = watch.elapsed_time() - add_rowset_start_ns - add_rowset_ns;
 
     // At startup, we only count these invalid rowset, but do not actually delete it.
     // The actual delete operation is in StorageEngine::_clean_unused_rowset_metas,
     // which is cleaned up uniformly by the background cleanup thread.
     LOG(INFO) << "finish to load tablets from " << _path
               << ", total rowset meta: " << dir_rowset_metas.size()
-              << ", invalid rowset num: " << invalid_rowset_counter;
+              << ", invalid rowset num: " << invalid_rowset_counter
+              << ", load rowset meta cost(ms): " << load_rowset_meta_ns / 1000000
+              << ", load tablet meta cost(ms): " << load_tablet_meta_ns / 1000000
+              << ", add rowset cost(ms): " << add_rowset_ns / 1000000
+              << ", load delete bitmap cost(ms): " << load_delete_bitmap_ns / 1000000
+              << ", total cost(ms): " << watch.elapsed_time() / 1000000;
 
     return Status::OK();
 }
@@ -31,6 +31,7 @@
 #include <vector>
 
 #include "common/status.h"
+#include "olap/compaction_io_budget.h"
 #include "olap/olap_common.h"
 #include "util/metrics.h"
 
@@ -134,6 +135,8 @@ public:
 
     void disks_compaction_num_increment(int64_t delta);
 
+    CompactionIOBudget& compaction_io_budget() { return _compaction_io_budget; }
+
     double get_usage(int64_t incoming_data_size) const {
         return _disk_capacity_bytes == 0
                        ? 0
@@ -192,6 +195,8 @@ private:
 
     OlapMeta* _meta = nullptr;
 
+    CompactionIOBudget _compaction_io_budget;
+
     std::shared_ptr<MetricEntity> _data_dir_metric_entity;
     IntGauge* disks_total_capacity = nullptr;
     IntGauge* disks_avail_capacity = nullptr;
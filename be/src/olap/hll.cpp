@@ -276,6 +276,7 @@ bool HyperLogLog::deserialize(const Slice& slice) {
         // 2: number of explicit values
         // make sure that num_explicit is positive
         uint8_t num_explicits = *ptr++;
+        _hash_set.reserve(num_explicits);
         // 3+: 8 bytes hash value
         for (int i = 0; i < num_explicits; ++i) {
             _hash_set.insert(decode_fixed64_le(ptr));
@@ -334,18 +335,35 @@ int64_t HyperLogLog::estimate_cardinality() const {
         alpha = 0.7213F / (1 + 1.079F / num_streams);
     }
 
-    float harmonic_mean = 0;
-    int num_zero_registers = 0;
-
-    for (int i = 0; i < HLL_REGISTERS_COUNT; ++i) {
-        harmonic_mean += powf(2.0F, -_registers[i]);
+    // The registers are counted by value first, so that 2^-value is computed once per value
+    // instead of once per register. The registers are counted into several histograms, which
+    // keeps the increments of adjacent registers independent of each other.
+    constexpr int NUM_HISTOGRAMS = 4;
+    static_assert(HLL_REGISTERS_COUNT % NUM_HISTOGRAMS == 0);
+    uint32_t histograms[NUM_HISTOGRAMS][256] = {};
+    for (int i = 0; i < HLL_REGISTERS_COUNT; i += NUM_HISTOGRAMS) {
+        for (int j = 0; j < NUM_HISTOGRAMS; ++j) {
+            ++histograms[j][_registers[i + j]];
+        }
+    }
 
-        if (_registers[i] == 0) {
-            ++num_zero_registers;
+    double harmonic_mean = 0;
+    int num_zero_registers = 0;
+    for (int value = 0; value < 256; ++value) {
+        uint32_t count = 0;
+        for (int j = 0; j < NUM_HISTOGRAMS; ++j) {
+            count += histograms[j][value];
+        }
+        if (count == 0) {
+            continue;
+        }
+        if (value == 0) {
+            num_zero_registers = count;
         }
+        harmonic_mean += std::ldexp(static_cast<double>(count), -value);
     }
 
-    harmonic_mean = 1.0F / harmonic_mean;
+    harmonic_mean = 1.0 / harmonic_mean;
     double estimate = alpha * num_streams * num_streams * harmonic_mean;
     // according to HyperLogLog current correction, if E is cardinal
     // E =< num_streams * 2.5 , LC has higher accuracy.
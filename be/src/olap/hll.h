@@ -23,10 +23,7 @@
 #include <string>
 #include <utility>
 
-#ifdef __x86_64__
-#include <immintrin.h>
-#endif
-
+#include "util/sse_util.hpp"
 #include "vec/common/hash_table/phmap_fwd_decl.h"
 
 namespace doris {
@@ -287,6 +284,17 @@ private:
             src += 32;
             dst += 32;
         }
+#elif defined(__SSE2__) || defined(__aarch64__)
+        int loop = HLL_REGISTERS_COUNT / 16; // 16 = 128/8
+        uint8_t* dst = _registers;
+        const uint8_t* src = other_registers;
+        for (int i = 0; i < loop; i++) {
+            __m128i xa = _mm_loadu_si128((const __m128i*)dst);
+            __m128i xb = _mm_loadu_si128((const __m128i*)src);
+            _mm_storeu_si128((__m128i*)dst, _mm_max_epu8(xa, xb));
+            src += 16;
+            dst += 16;
+        }
 #else
         for (int i = 0; i < HLL_REGISTERS_COUNT; ++i) {
             _registers[i] =
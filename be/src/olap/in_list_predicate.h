@@ -199,7 +199,7 @@ public:
             InvertedIndexQueryType query_type = InvertedIndexQueryType::EQUAL_QUERY;
             std::shared_ptr<roaring::Roaring> index = std::make_shared<roaring::Roaring>();
             RETURN_IF_ERROR(iterator->read_from_inverted_index(
-                    column_name, query_param->get_value(), query_type, num_rows, index));
+                    column_name, query_param->get_value(), query_type, num_rows, *result, index));
             indices |= *index;
             iter->next();
         }
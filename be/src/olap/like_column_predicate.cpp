@@ -62,16 +62,12 @@ uint16_t LikeColumnPredicate<T>::_evaluate_inner(const vectorized::IColumn& colu
             auto* nested_col_ptr = vectorized::check_and_get_column<
                     vectorized::ColumnDictionary<vectorized::Int32>>(nested_col);
             auto& data_array = nested_col_ptr->get_data();
+            const auto& dict_flags = _find_dict_flags(*nested_col_ptr);
             if (!nullable_col->has_null()) {
                 for (uint16_t i = 0; i != size; i++) {
                     uint16_t idx = sel[i];
                     sel[new_size] = idx;
-                    StringRef cell_value = nested_col_ptr->get_shrink_value(data_array[idx]);
-                    unsigned char flag = 0;
-                    static_cast<void>((_state->scalar_function)(
-                            const_cast<vectorized::LikeSearchState*>(&_like_state),
-                            StringRef(cell_value.data, cell_value.size), pattern, &flag));
-                    new_size += _opposite ^ flag;
+                    new_size += _opposite ^ dict_flags[data_array[idx]];
                 }
             } else {
                 for (uint16_t i = 0; i != size; i++) {
@@ -81,13 +77,7 @@ uint16_t LikeColumnPredicate<T>::_evaluate_inner(const vectorized::IColumn& colu
                         new_size += _opposite;
                         continue;
                     }
-
-                    StringRef cell_value = nested_col_ptr->get_shrink_value(data_array[idx]);
-                    unsigned char flag = 0;
-                    static_cast<void>((_state->scalar_function)(
-                            const_cast<vectorized::LikeSearchState*>(&_like_state),
-                            StringRef(cell_value.data, cell_value.size), pattern, &flag));
-                    new_size += _opposite ^ flag;
+                    new_size += _opposite ^ dict_flags[data_array[idx]];
                 }
             }
         } else {
@@ -127,15 +117,11 @@ uint16_t LikeColumnPredicate<T>::_evaluate_inner(const vectorized::IColumn& colu
             auto* nested_col_ptr = vectorized::check_and_get_column<
                     vectorized::ColumnDictionary<vectorized::Int32>>(column);
             auto& data_array = nested_col_ptr->get_data();
+            const auto& dict_flags = _find_dict_flags(*nested_col_ptr);
             for (uint16_t i = 0; i != size; i++) {
                 uint16_t idx = sel[i];
                 sel[new_size] = idx;
-                StringRef cell_value = nested_col_ptr->get_shrink_value(data_array[idx]);
-                unsigned char flag = 0;
-                static_cast<void>((_state->scalar_function)(
-                        const_cast<vectorized::LikeSearchState*>(&_like_state),
-                        StringRef(cell_value.data, cell_value.size), pattern, &flag));
-                new_size += _opposite ^ flag;
+                new_size += _opposite ^ dict_flags[data_array[idx]];
             }
         } else {
             const vectorized::PredicateColumnType<T>* str_col =
@@ -156,6 +142,25 @@ uint16_t LikeColumnPredicate<T>::_evaluate_inner(const vectorized::IColumn& colu
     return new_size;
 }
 
+template <PrimitiveType T>
+const std::vector<vectorized::UInt8>& LikeColumnPredicate<T>::_find_dict_flags(
+        const vectorized::ColumnDictionary<vectorized::Int32>& column) const {
+    auto& dict_flags = _segment_id_to_dict_flags[column.get_rowset_segment_id()];
+    // the dictionary may be empty if the pages read before are all null
+    if (dict_flags.size() != column.dict_size()) {
+        column.find_codes_if(
+                [&](int32_t code) {
+                    unsigned char flag = 0;
+                    static_cast<void>((_state->scalar_function)(
+                            const_cast<vectorized::LikeSearchState*>(&_like_state),
+                            column.get_shrink_value(code), pattern, &flag));
+                    return flag;
+                },
+                dict_flags);
+    }
+    return dict_flags;
+}
+
 template class LikeColumnPredicate<TYPE_CHAR>;
 template class LikeColumnPredicate<TYPE_STRING>;
 
@@ -21,13 +21,16 @@
 
 #include <boost/iterator/iterator_facade.hpp>
 #include <functional>
+#include <map>
 #include <memory>
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "common/status.h"
 #include "olap/column_predicate.h"
+#include "olap/olap_common.h"
 #include "olap/rowset/segment_v2/bloom_filter.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_dictionary.h"
@@ -102,6 +105,7 @@ private:
                 auto* nested_col_ptr = vectorized::check_and_get_column<
                         vectorized::ColumnDictionary<vectorized::Int32>>(nested_col);
                 auto& data_array = nested_col_ptr->get_data();
+                const auto& dict_flags = _find_dict_flags(*nested_col_ptr);
                 for (uint16_t i = 0; i < size; i++) {
                     if (null_map_data[i]) {
                         if constexpr (is_and) {
@@ -112,19 +116,10 @@ private:
                         continue;
                     }
 
-                    StringRef cell_value = nested_col_ptr->get_shrink_value(data_array[i]);
                     if constexpr (is_and) {
-                        unsigned char flag = 0;
-                        static_cast<void>((_state->scalar_function)(
-                                const_cast<vectorized::LikeSearchState*>(&_like_state),
-                                StringRef(cell_value.data, cell_value.size), pattern, &flag));
-                        flags[i] &= _opposite ^ flag;
+                        flags[i] &= _opposite ^ dict_flags[data_array[i]];
                     } else {
-                        unsigned char flag = 0;
-                        static_cast<void>((_state->scalar_function)(
-                                const_cast<vectorized::LikeSearchState*>(&_like_state),
-                                StringRef(cell_value.data, cell_value.size), pattern, &flag));
-                        flags[i] = _opposite ^ flag;
+                        flags[i] = _opposite ^ dict_flags[data_array[i]];
                     }
                 }
             } else {
@@ -136,20 +131,12 @@ private:
                 auto* nested_col_ptr = vectorized::check_and_get_column<
                         vectorized::ColumnDictionary<vectorized::Int32>>(column);
                 auto& data_array = nested_col_ptr->get_data();
+                const auto& dict_flags = _find_dict_flags(*nested_col_ptr);
                 for (uint16_t i = 0; i < size; i++) {
-                    StringRef cell_value = nested_col_ptr->get_shrink_value(data_array[i]);
                     if constexpr (is_and) {
-                        unsigned char flag = 0;
-                        static_cast<void>((_state->scalar_function)(
-                                const_cast<vectorized::LikeSearchState*>(&_like_state),
-                                StringRef(cell_value.data, cell_value.size), pattern, &flag));
-                        flags[i] &= _opposite ^ flag;
+                        flags[i] &= _opposite ^ dict_flags[data_array[i]];
                     } else {
-                        unsigned char flag = 0;
-                        static_cast<void>((_state->scalar_function)(
-                                const_cast<vectorized::LikeSearchState*>(&_like_state),
-                                StringRef(cell_value.data, cell_value.size), pattern, &flag));
-                        flags[i] = _opposite ^ flag;
+                        flags[i] = _opposite ^ dict_flags[data_array[i]];
                     }
                 }
             } else {
@@ -159,6 +146,11 @@ private:
         }
     }
 
+    // The result of the pattern on each word of the dictionary of a segment, so the pattern is
+    // matched once per word instead of once per row.
+    const std::vector<vectorized::UInt8>& _find_dict_flags(
+            const vectorized::ColumnDictionary<vectorized::Int32>& column) const;
+
     std::string _debug_string() const override {
         std::string info = "LikeColumnPredicate";
         return info;
@@ -176,6 +168,8 @@ private:
     // LikeColumnPredicate.
     vectorized::LikeSearchState _like_state;
     std::unique_ptr<segment_v2::BloomFilter> _page_ng_bf; // for ngram-bf index
+    mutable std::map<std::pair<RowsetId, uint32_t>, std::vector<vectorized::UInt8>>
+            _segment_id_to_dict_flags;
 };
 
 } // namespace doris
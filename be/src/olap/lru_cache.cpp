@@ -6,8 +6,10 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <mutex>
 #include <new>
+#include <shared_mutex>
 #include <sstream>
 #include <string>
 
@@ -26,6 +28,10 @@ DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(cache_usage_ratio, MetricUnit::NOUNIT);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_lookup_count, MetricUnit::OPERATIONS);
 DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_hit_count, MetricUnit::OPERATIONS);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(cache_hit_ratio, MetricUnit::NOUNIT);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_probation_hit_count, MetricUnit::OPERATIONS);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(cache_protected_hit_count, MetricUnit::OPERATIONS);
+DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(cache_probation_hit_ratio, MetricUnit::NOUNIT);
+DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(cache_protected_hit_ratio, MetricUnit::NOUNIT);
 
 uint32_t CacheKey::hash(const char* data, size_t n, uint32_t seed) const {
     // Similar to murmur hash
@@ -170,6 +176,8 @@ LRUCache::LRUCache(LRUCacheType type) : _type(type) {
     _lru_normal.prev = &_lru_normal;
     _lru_durable.next = &_lru_durable;
     _lru_durable.prev = &_lru_durable;
+    _lru_protected.next = &_lru_protected;
+    _lru_protected.prev = &_lru_protected;
 }
 
 LRUCache::~LRUCache() {
@@ -177,9 +185,15 @@ LRUCache::~LRUCache() {
 }
 
 bool LRUCache::_unref(LRUHandle* e) {
-    DCHECK(e->refs > 0);
-    e->refs--;
-    return e->refs == 0;
+    DCHECK(__atomic_load_n(&e->refs, __ATOMIC_RELAXED) > 0);
+    // the clock lookups and releases change the refs out of the exclusive lock
+    return __atomic_sub_fetch(&e->refs, 1, __ATOMIC_ACQ_REL) == 0;
+}
+
+bool LRUCache::_evictable(const LRUHandle* e) const {
+    // Only the cache holds the entry. It is always the case of the entries in the lru list,
+    // unless the clock lookup is enabled.
+    return __atomic_load_n(&e->refs, __ATOMIC_ACQUIRE) == 1;
 }
 
 void LRUCache::_lru_remove(LRUHandle* e) {
@@ -231,6 +245,9 @@ void LRUCache::_lru_append(LRUHandle* list, LRUHandle* e) {
 }
 
 Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
+    if (_clock_lookup_enabled) {
+        return _clock_lookup(key, hash);
+    }
     std::lock_guard l(_mutex);
     ++_lookup_count;
     LRUHandle* e = _table.lookup(key, hash);
@@ -244,15 +261,63 @@ Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
         e->refs++;
         ++_hit_count;
         e->last_visit_time = UnixMillis();
+        if (_protected_capacity > 0 && e->priority == CachePriority::NORMAL) {
+            if (e->is_protected) {
+                ++_protected_hit_count;
+            } else {
+                ++_probation_hit_count;
+                e->is_protected = true;
+                _protected_usage += e->total_size;
+                _demote_protected_entries();
+            }
+        }
+    }
+    return reinterpret_cast<Cache::Handle*>(e);
+}
+
+Cache::Handle* LRUCache::_clock_lookup(const CacheKey& key, uint32_t hash) {
+    std::shared_lock l(_mutex);
+    _lookup_count.fetch_add(1, std::memory_order_relaxed);
+    LRUHandle* e = _table.lookup(key, hash);
+    if (e != nullptr) {
+        // we get it from _table, so in_cache must be true
+        DCHECK(e->in_cache);
+        // the entry stays where it is in the lru list, only the writers holding the exclusive
+        // lock move it
+        __atomic_add_fetch(&e->refs, 1, __ATOMIC_RELAXED);
+        __atomic_store_n(&e->visited, true, __ATOMIC_RELAXED);
+        __atomic_store_n(&e->last_visit_time, UnixMillis(), __ATOMIC_RELAXED);
+        _hit_count.fetch_add(1, std::memory_order_relaxed);
+        if (_protected_capacity > 0 && e->priority == CachePriority::NORMAL) {
+            auto& hit_count = e->is_protected ? _protected_hit_count : _probation_hit_count;
+            hit_count.fetch_add(1, std::memory_order_relaxed);
+        }
     }
     return reinterpret_cast<Cache::Handle*>(e);
 }
 
+void LRUCache::_clock_release(LRUHandle* e) {
+    // The cache holds a reference of the entries in it, so the last reference is of an entry
+    // already out of the cache and the lru list, and only then is the lock needed.
+    if (!_unref(e)) {
+        return;
+    }
+    {
+        std::lock_guard l(_mutex);
+        _usage -= e->total_size;
+    }
+    e->free();
+}
+
 void LRUCache::release(Cache::Handle* handle) {
     if (handle == nullptr) {
         return;
     }
     LRUHandle* e = reinterpret_cast<LRUHandle*>(handle);
+    if (_clock_lookup_enabled) {
+        _clock_release(e);
+        return;
+    }
     bool last_ref = false;
     {
         std::lock_guard l(_mutex);
@@ -266,13 +331,14 @@ void LRUCache::release(Cache::Handle* handle) {
                 bool removed = _table.remove(e);
                 DCHECK(removed);
                 e->in_cache = false;
+                _remove_from_protected(e);
                 _unref(e);
                 _usage -= e->total_size;
                 last_ref = true;
             } else {
                 // put it to LRU free list
                 if (e->priority == CachePriority::NORMAL) {
-                    _lru_append(&_lru_normal, e);
+                    _lru_append(e->is_protected ? &_lru_protected : &_lru_normal, e);
                 } else if (e->priority == CachePriority::DURABLE) {
                     _lru_append(&_lru_durable, e);
                 }
@@ -313,14 +379,20 @@ void LRUCache::_evict_from_lru_with_time(size_t total_size, LRUHandle** to_remov
 }
 
 void LRUCache::_evict_from_lru(size_t total_size, LRUHandle** to_remove_head) {
-    // 1. evict normal cache entries
-    while ((_usage + total_size > _capacity || _check_element_count_limit()) &&
-           _lru_normal.next != &_lru_normal) {
-        LRUHandle* old = _lru_normal.next;
-        DCHECK(old->priority == CachePriority::NORMAL);
-        _evict_one_entry(old);
-        old->next = *to_remove_head;
-        *to_remove_head = old;
+    if (_clock_lookup_enabled) {
+        _evict_from_clock(total_size, to_remove_head);
+        return;
+    }
+    // 1. evict normal cache entries, the probation segment first
+    for (LRUHandle* list : {&_lru_normal, &_lru_protected}) {
+        while ((_usage + total_size > _capacity || _check_element_count_limit()) &&
+               list->next != list) {
+            LRUHandle* old = list->next;
+            DCHECK(old->priority == CachePriority::NORMAL);
+            _evict_one_entry(old);
+            old->next = *to_remove_head;
+            *to_remove_head = old;
+        }
     }
     // 2. evict durable cache entries if need
     while ((_usage + total_size > _capacity || _check_element_count_limit()) &&
@@ -333,13 +405,48 @@ void LRUCache::_evict_from_lru(size_t total_size, LRUHandle** to_remove_head) {
     }
 }
 
+void LRUCache::_evict_from_clock(size_t total_size, LRUHandle** to_remove_head) {
+    // 1. evict normal cache entries, the probation segment first, 2. the durable entries
+    for (LRUHandle* list : {&_lru_normal, &_lru_protected, &_lru_durable}) {
+        // An entry is passed at most twice, once to clear its visited mark and once more if it
+        // is still in use, which ends the scan when all the entries are in use.
+        size_t num_steps = 2 * static_cast<size_t>(_table.element_count());
+        while ((_usage + total_size > _capacity || _check_element_count_limit()) &&
+               list->next != list && num_steps-- > 0) {
+            LRUHandle* old = list->next;
+            if (old->visited) {
+                // the second chance, a visited probation entry is promoted as by its first hit
+                // in the lru lookup
+                old->visited = false;
+                _lru_remove(old);
+                if (list == &_lru_normal && _protected_capacity > 0) {
+                    old->is_protected = true;
+                    _protected_usage += old->total_size;
+                    _lru_append(&_lru_protected, old);
+                    _demote_protected_entries();
+                } else {
+                    _lru_append(list, old);
+                }
+            } else if (!_evictable(old)) {
+                _lru_remove(old);
+                _lru_append(list, old);
+            } else {
+                _evict_one_entry(old);
+                old->next = *to_remove_head;
+                *to_remove_head = old;
+            }
+        }
+    }
+}
+
 void LRUCache::_evict_one_entry(LRUHandle* e) {
     DCHECK(e->in_cache);
-    DCHECK(e->refs == 1); // LRU list contains elements which may be evicted
+    DCHECK(_evictable(e)); // LRU list contains elements which may be evicted
     _lru_remove(e);
     bool removed = _table.remove(e);
     DCHECK(removed);
     e->in_cache = false;
+    _remove_from_protected(e);
     _unref(e);
     _usage -= e->total_size;
 }
@@ -348,6 +455,65 @@ bool LRUCache::_check_element_count_limit() {
     return _element_count_capacity != 0 && _table.element_count() >= _element_count_capacity;
 }
 
+void LRUCache::_remove_from_protected(LRUHandle* e) {
+    if (e->is_protected) {
+        e->is_protected = false;
+        _protected_usage -= e->total_size;
+    }
+}
+
+void LRUCache::_demote_protected_entries() {
+    // the oldest protected entries go back to the newest end of the probation segment, the
+    // entries in use are not in the lru list and are demoted later
+    while (_protected_usage > _protected_capacity && _lru_protected.next != &_lru_protected) {
+        LRUHandle* old = _lru_protected.next;
+        _lru_remove(old);
+        _remove_from_protected(old);
+        _lru_append(&_lru_normal, old);
+    }
+}
+
+void LRUCache::set_protected_capacity_ratio(double ratio) {
+    if (_cache_value_check_timestamp) {
+        return;
+    }
+    _protected_capacity_ratio = std::clamp(ratio, 0.0, 1.0);
+    _protected_capacity = static_cast<size_t>(_capacity * _protected_capacity_ratio);
+}
+
+void LRUCache::set_clock_lookup(bool clock_lookup) {
+    if (_cache_value_check_timestamp) {
+        return;
+    }
+    DCHECK_EQ(_table.element_count(), 0);
+    _clock_lookup_enabled = clock_lookup;
+}
+
+PrunedInfo LRUCache::adjust_capacity(size_t capacity) {
+    LRUHandle* to_remove_head = nullptr;
+    {
+        std::lock_guard l(_mutex);
+        _capacity = capacity;
+        if (_cache_value_check_timestamp) {
+            _evict_from_lru_with_time(0, &to_remove_head);
+        } else {
+            _protected_capacity = static_cast<size_t>(_capacity * _protected_capacity_ratio);
+            _demote_protected_entries();
+            _evict_from_lru(0, &to_remove_head);
+        }
+    }
+    int64_t pruned_count = 0;
+    int64_t pruned_size = 0;
+    while (to_remove_head != nullptr) {
+        ++pruned_count;
+        pruned_size += to_remove_head->total_size;
+        LRUHandle* next = to_remove_head->next;
+        to_remove_head->free();
+        to_remove_head = next;
+    }
+    return {pruned_count, pruned_size};
+}
+
 Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value, size_t charge,
                                 CachePriority priority) {
     size_t handle_size = sizeof(LRUHandle) - 1 + key.size();
@@ -362,6 +528,8 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
     e->refs = 2; // one for the returned handle, one for LRUCache.
     e->next = e->prev = nullptr;
     e->in_cache = true;
+    e->is_protected = false;
+    e->visited = false;
     e->priority = priority;
     e->type = _type;
     memcpy(e->key_data, key.data(), key.size());
@@ -383,13 +551,21 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
         // space was freed
         auto old = _table.insert(e);
         _usage += e->total_size;
+        if (_clock_lookup_enabled) {
+            // the entries are in the lru list while they are in the cache
+            _lru_append(priority == CachePriority::DURABLE ? &_lru_durable : &_lru_normal, e);
+        }
         if (old != nullptr) {
             old->in_cache = false;
+            _remove_from_protected(old);
+            // old is on LRU if it's in cache and its reference count is 1, or always with the
+            // clock lookup. It is removed before the unref, after which a clock release may
+            // free it.
+            if (_clock_lookup_enabled || old->refs == 1) {
+                _lru_remove(old);
+            }
             if (_unref(old)) {
                 _usage -= old->total_size;
-                // old is on LRU because it's in cache and its reference count
-                // was just 1 (Unref returned 0)
-                _lru_remove(old);
                 old->next = to_remove_head;
                 to_remove_head = old;
             }
@@ -414,15 +590,16 @@ void LRUCache::erase(const CacheKey& key, uint32_t hash) {
         std::lock_guard l(_mutex);
         e = _table.remove(key, hash);
         if (e != nullptr) {
+            _remove_from_protected(e);
+            // locate in free list, or always with the clock lookup, see insert
+            if (_clock_lookup_enabled || e->refs == 1) {
+                _lru_remove(e);
+            }
+            e->in_cache = false;
             last_ref = _unref(e);
             if (last_ref) {
                 _usage -= e->total_size;
-                if (e->in_cache) {
-                    // locate in free list
-                    _lru_remove(e);
-                }
             }
-            e->in_cache = false;
         }
     }
     // free handle out of mutex, when last_ref is true, e must not be nullptr
@@ -435,17 +612,18 @@ PrunedInfo LRUCache::prune() {
     LRUHandle* to_remove_head = nullptr;
     {
         std::lock_guard l(_mutex);
-        while (_lru_normal.next != &_lru_normal) {
-            LRUHandle* old = _lru_normal.next;
-            _evict_one_entry(old);
-            old->next = to_remove_head;
-            to_remove_head = old;
-        }
-        while (_lru_durable.next != &_lru_durable) {
-            LRUHandle* old = _lru_durable.next;
-            _evict_one_entry(old);
-            old->next = to_remove_head;
-            to_remove_head = old;
+        for (LRUHandle* list : {&_lru_normal, &_lru_protected, &_lru_durable}) {
+            LRUHandle* p = list->next;
+            while (p != list) {
+                LRUHandle* next = p->next;
+                // the entries in use are in the lru list with the clock lookup
+                if (_evictable(p)) {
+                    _evict_one_entry(p);
+                    p->next = to_remove_head;
+                    to_remove_head = p;
+                }
+                p = next;
+            }
         }
     }
     int64_t pruned_count = 0;
@@ -464,30 +642,24 @@ PrunedInfo LRUCache::prune_if(CachePrunePredicate pred, bool lazy_mode) {
     LRUHandle* to_remove_head = nullptr;
     {
         std::lock_guard l(_mutex);
-        LRUHandle* p = _lru_normal.next;
-        while (p != &_lru_normal) {
-            LRUHandle* next = p->next;
-            if (pred(p)) {
-                _evict_one_entry(p);
-                p->next = to_remove_head;
-                to_remove_head = p;
-            } else if (lazy_mode) {
-                break;
-            }
-            p = next;
-        }
-
-        p = _lru_durable.next;
-        while (p != &_lru_durable) {
-            LRUHandle* next = p->next;
-            if (pred(p)) {
-                _evict_one_entry(p);
-                p->next = to_remove_head;
-                to_remove_head = p;
-            } else if (lazy_mode) {
-                break;
+        for (LRUHandle* list : {&_lru_normal, &_lru_protected, &_lru_durable}) {
+            LRUHandle* p = list->next;
+            while (p != list) {
+                LRUHandle* next = p->next;
+                if (!_evictable(p)) {
+                    // the entries in use are in the lru list with the clock lookup
+                    p = next;
+                    continue;
+                }
+                if (pred(p)) {
+                    _evict_one_entry(p);
+                    p->next = to_remove_head;
+                    to_remove_head = p;
+                } else if (lazy_mode) {
+                    break;
+                }
+                p = next;
             }
-            p = next;
         }
     }
     int64_t pruned_count = 0;
@@ -546,6 +718,10 @@ ShardedLRUCache::ShardedLRUCache(const std::string& name, size_t total_capacity,
     INT_ATOMIC_COUNTER_METRIC_REGISTER(_entity, cache_lookup_count);
     INT_ATOMIC_COUNTER_METRIC_REGISTER(_entity, cache_hit_count);
     INT_DOUBLE_METRIC_REGISTER(_entity, cache_hit_ratio);
+    INT_ATOMIC_COUNTER_METRIC_REGISTER(_entity, cache_probation_hit_count);
+    INT_ATOMIC_COUNTER_METRIC_REGISTER(_entity, cache_protected_hit_count);
+    INT_DOUBLE_METRIC_REGISTER(_entity, cache_probation_hit_ratio);
+    INT_DOUBLE_METRIC_REGISTER(_entity, cache_protected_hit_ratio);
 
     _hit_count_bvar.reset(new bvar::Adder<uint64_t>("doris_cache", _name));
     _hit_count_per_second.reset(new bvar::PerSecond<bvar::Adder<uint64_t>>(
@@ -627,6 +803,54 @@ PrunedInfo ShardedLRUCache::prune_if(CachePrunePredicate pred, bool lazy_mode) {
     return pruned_info;
 }
 
+void ShardedLRUCache::set_protected_capacity_ratio(double ratio) {
+    for (int s = 0; s < _num_shards; s++) {
+        _shards[s]->set_protected_capacity_ratio(ratio);
+    }
+}
+
+void ShardedLRUCache::set_clock_lookup(bool clock_lookup) {
+    for (int s = 0; s < _num_shards; s++) {
+        _shards[s]->set_clock_lookup(clock_lookup);
+    }
+}
+
+PrunedInfo ShardedLRUCache::adjust_capacity(size_t total_capacity) {
+    _total_capacity = total_capacity;
+    const size_t per_shard = (total_capacity + (_num_shards - 1)) / _num_shards;
+    PrunedInfo pruned_info;
+    for (int s = 0; s < _num_shards; s++) {
+        PrunedInfo info = _shards[s]->adjust_capacity(per_shard);
+        pruned_info.pruned_count += info.pruned_count;
+        pruned_info.pruned_size += info.pruned_size;
+    }
+    return pruned_info;
+}
+
+uint64_t ShardedLRUCache::get_lookup_count() const {
+    uint64_t total_lookup_count = 0;
+    for (int i = 0; i < _num_shards; i++) {
+        total_lookup_count += _shards[i]->get_lookup_count();
+    }
+    return total_lookup_count;
+}
+
+uint64_t ShardedLRUCache::get_hit_count() const {
+    uint64_t total_hit_count = 0;
+    for (int i = 0; i < _num_shards; i++) {
+        total_hit_count += _shards[i]->get_hit_count();
+    }
+    return total_hit_count;
+}
+
+size_t ShardedLRUCache::get_element_count() const {
+    size_t total_element_count = 0;
+    for (int i = 0; i < _num_shards; i++) {
+        total_element_count += _shards[i]->get_element_count();
+    }
+    return total_element_count;
+}
+
 int64_t ShardedLRUCache::get_usage() {
     size_t total_usage = 0;
     for (int i = 0; i < _num_shards; i++) {
@@ -640,11 +864,15 @@ void ShardedLRUCache::update_cache_metrics() const {
     size_t total_usage = 0;
     size_t total_lookup_count = 0;
     size_t total_hit_count = 0;
+    size_t total_probation_hit_count = 0;
+    size_t total_protected_hit_count = 0;
     for (int i = 0; i < _num_shards; i++) {
         total_capacity += _shards[i]->get_capacity();
         total_usage += _shards[i]->get_usage();
         total_lookup_count += _shards[i]->get_lookup_count();
         total_hit_count += _shards[i]->get_hit_count();
+        total_probation_hit_count += _shards[i]->get_probation_hit_count();
+        total_protected_hit_count += _shards[i]->get_protected_hit_count();
     }
 
     cache_capacity->set_value(total_capacity);
@@ -654,6 +882,14 @@ void ShardedLRUCache::update_cache_metrics() const {
     cache_usage_ratio->set_value(total_capacity == 0 ? 0 : ((double)total_usage / total_capacity));
     cache_hit_ratio->set_value(
             total_lookup_count == 0 ? 0 : ((double)total_hit_count / total_lookup_count));
+    cache_probation_hit_count->set_value(total_probation_hit_count);
+    cache_protected_hit_count->set_value(total_protected_hit_count);
+    cache_probation_hit_ratio->set_value(
+            total_lookup_count == 0 ? 0
+                                    : ((double)total_probation_hit_count / total_lookup_count));
+    cache_protected_hit_ratio->set_value(
+            total_lookup_count == 0 ? 0
+                                    : ((double)total_protected_hit_count / total_lookup_count));
 }
 
 Cache::Handle* DummyLRUCache::insert(const CacheKey& key, void* value, size_t charge,
@@ -668,6 +904,7 @@ Cache::Handle* DummyLRUCache::insert(const CacheKey& key, void* value, size_t ch
     e->refs = 1; // only one for the returned handle
     e->next = e->prev = nullptr;
     e->in_cache = false;
+    e->is_protected = false;
     return reinterpret_cast<Cache::Handle*>(e);
 }
 
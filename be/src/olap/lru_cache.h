@@ -17,6 +17,7 @@
 #include <functional>
 #include <memory>
 #include <set>
+#include <shared_mutex>
 #include <string>
 #include <utility>
 
@@ -245,7 +246,9 @@ struct LRUHandle {
     size_t charge;
     size_t key_length;
     size_t total_size; // Entry charge, used to limit cache capacity, LRUCacheType::SIZE including key length.
-    bool in_cache; // Whether entry is in the cache.
+    bool in_cache;     // Whether entry is in the cache.
+    bool is_protected; // Whether entry is in the protected segment of the normal entries.
+    bool visited;      // Whether entry is hit since it is last passed by the clock eviction.
     uint32_t refs;
     uint32_t hash; // Hash of key(); used for fast sharding and comparisons
     CachePriority priority = CachePriority::NORMAL;
@@ -331,6 +334,23 @@ public:
     void set_element_count_capacity(uint32_t element_count_capacity) {
         _element_count_capacity = element_count_capacity;
     }
+    // Split the normal entries into a probation and a protected segment, the protected segment
+    // holds at most `ratio` of the capacity, 0 means a plain LRU.
+    // An entry is inserted into the probation segment and promoted to the protected segment by
+    // its first hit, so a scan which reads each entry once only evicts the probation entries.
+    // It is ignored if the entries are evicted by the timestamp of the cache value.
+    // Must be called after set_capacity.
+    void set_protected_capacity_ratio(double ratio);
+    // Change the capacity of a cache in use, the entries over the new capacity are evicted.
+    PrunedInfo adjust_capacity(size_t capacity);
+    // Look up the entries under a shared lock, so that the hits on a shard run concurrently.
+    // A hit only takes a reference and marks the entry visited instead of moving it in the lru
+    // list, the entries stay in the list while they are in use, and the eviction gives the
+    // visited entries a second chance, as a CLOCK does, and promotes the visited probation
+    // entries to the protected segment.
+    // It is ignored if the entries are evicted by the timestamp of the cache value.
+    // Must be called before the cache is used.
+    void set_clock_lookup(bool clock_lookup);
 
     // Like Cache methods, but with an extra "hash" parameter.
     // Must call release on the returned handle pointer.
@@ -347,8 +367,12 @@ public:
 
     uint64_t get_lookup_count() const { return _lookup_count; }
     uint64_t get_hit_count() const { return _hit_count; }
+    uint64_t get_probation_hit_count() const { return _probation_hit_count; }
+    uint64_t get_protected_hit_count() const { return _protected_hit_count; }
     size_t get_usage() const { return _usage; }
+    size_t get_protected_usage() const { return _protected_usage; }
     size_t get_capacity() const { return _capacity; }
+    size_t get_element_count() const { return _table.element_count(); }
 
 private:
     void _lru_remove(LRUHandle* e);
@@ -358,6 +382,13 @@ private:
     void _evict_from_lru_with_time(size_t total_size, LRUHandle** to_remove_head);
     void _evict_one_entry(LRUHandle* e);
     bool _check_element_count_limit();
+    void _remove_from_protected(LRUHandle* e);
+    void _demote_protected_entries();
+    Cache::Handle* _clock_lookup(const CacheKey& key, uint32_t hash);
+    void _clock_release(LRUHandle* e);
+    void _evict_from_clock(size_t total_size, LRUHandle** to_remove_head);
+    // Whether the entry may be evicted, see set_clock_lookup.
+    bool _evictable(const LRUHandle* e) const;
 
 private:
     LRUCacheType _type;
@@ -365,8 +396,9 @@ private:
     // Initialized before use.
     size_t _capacity = 0;
 
-    // _mutex protects the following state.
-    std::mutex _mutex;
+    // _mutex protects the following state, it is only locked shared by the clock lookups.
+    std::shared_mutex _mutex;
+    bool _clock_lookup_enabled = false;
     size_t _usage = 0;
 
     // Dummy head of LRU list.
@@ -375,11 +407,21 @@ private:
     LRUHandle _lru_normal;
     // _lru_durable.prev is newest entry, _lru_durable.next is oldest entry.
     LRUHandle _lru_durable;
+    // The protected segment of the normal entries, _lru_normal is the probation segment if
+    // _protected_capacity > 0.
+    LRUHandle _lru_protected;
+    double _protected_capacity_ratio = 0;
+    size_t _protected_capacity = 0;
+    size_t _protected_usage = 0;
 
     HandleTable _table;
 
-    uint64_t _lookup_count = 0; // number of cache lookups
-    uint64_t _hit_count = 0;    // number of cache hits
+    // They are atomic for the clock lookups, which update them under the shared lock.
+    std::atomic<uint64_t> _lookup_count = 0; // number of cache lookups
+    std::atomic<uint64_t> _hit_count = 0;    // number of cache hits
+    // number of cache hits of the probation and the protected segment
+    std::atomic<uint64_t> _probation_hit_count = 0;
+    std::atomic<uint64_t> _protected_hit_count = 0;
 
     CacheValueTimeExtractor _cache_value_time_extractor;
     bool _cache_value_check_timestamp = false;
@@ -404,6 +446,17 @@ public:
     int64_t get_usage() override;
     size_t get_total_capacity() override { return _total_capacity; };
 
+    // See LRUCache::set_protected_capacity_ratio.
+    void set_protected_capacity_ratio(double ratio);
+    // See LRUCache::set_clock_lookup.
+    void set_clock_lookup(bool clock_lookup);
+    // See LRUCache::adjust_capacity, the capacity is split evenly among the shards.
+    PrunedInfo adjust_capacity(size_t total_capacity);
+
+    uint64_t get_lookup_count() const;
+    uint64_t get_hit_count() const;
+    size_t get_element_count() const;
+
 private:
     // LRUCache can only be created and managed with LRUCachePolicy.
     friend class LRUCachePolicy;
@@ -428,7 +481,7 @@ private:
     const uint32_t _num_shards;
     LRUCache** _shards = nullptr;
     std::atomic<uint64_t> _last_id;
-    size_t _total_capacity;
+    std::atomic<size_t> _total_capacity;
 
     std::shared_ptr<MetricEntity> _entity;
     IntGauge* cache_capacity = nullptr;
@@ -437,6 +490,10 @@ private:
     IntAtomicCounter* cache_lookup_count = nullptr;
     IntAtomicCounter* cache_hit_count = nullptr;
     DoubleGauge* cache_hit_ratio = nullptr;
+    IntAtomicCounter* cache_probation_hit_count = nullptr;
+    IntAtomicCounter* cache_protected_hit_count = nullptr;
+    DoubleGauge* cache_probation_hit_ratio = nullptr;
+    DoubleGauge* cache_protected_hit_ratio = nullptr;
     // bvars
     std::unique_ptr<bvar::Adder<uint64_t>> _hit_count_bvar;
     std::unique_ptr<bvar::PerSecond<bvar::Adder<uint64_t>>> _hit_count_per_second;
@@ -23,6 +23,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -37,6 +38,7 @@
 #include "tablet_meta.h"
 #include "util/runtime_profile.h"
 #include "util/stopwatch.hpp"
+#include "util/threadpool.h"
 #include "vec/aggregate_functions/aggregate_function_reader.h"
 #include "vec/aggregate_functions/aggregate_function_simple_factory.h"
 #include "vec/columns/column.h"
@@ -260,29 +262,24 @@ Status MemTable::_put_into_output(vectorized::Block& in_block) {
                                           row_pos_vec.data() + in_block.rows());
 }
 
-size_t MemTable::_sort() {
+size_t MemTable::_sort(ThreadPool* sort_pool) {
     SCOPED_RAW_TIMER(&_stat.sort_ns);
     _stat.sort_times++;
     size_t same_keys_num = 0;
     // sort new rows
-    Tie tie = Tie(_last_sorted_pos, _row_in_blocks.size());
-    for (size_t i = 0; i < _tablet_schema->num_key_columns(); i++) {
-        auto cmp = [&](const RowInBlock* lhs, const RowInBlock* rhs) -> int {
-            return _input_mutable_block.compare_one_column(lhs->_row_pos, rhs->_row_pos, i, -1);
-        };
-        _sort_one_column(_row_in_blocks, tie, cmp);
+    size_t num_new_rows = _row_in_blocks.size() - _last_sorted_pos;
+    size_t num_tasks = 1;
+    if (sort_pool != nullptr && config::memtable_parallel_sort_rows_per_task > 0) {
+        num_tasks = std::min<size_t>(
+                num_new_rows / config::memtable_parallel_sort_rows_per_task,
+                std::max(1, config::memtable_parallel_sort_max_tasks));
     }
-    bool is_dup = (_keys_type == KeysType::DUP_KEYS);
-    // sort extra round by _row_pos to make the sort stable
-    auto iter = tie.iter();
-    while (iter.next()) {
-        pdqsort(std::next(_row_in_blocks.begin(), iter.left()),
-                std::next(_row_in_blocks.begin(), iter.right()),
-                [&is_dup](const RowInBlock* lhs, const RowInBlock* rhs) -> bool {
-                    return is_dup ? lhs->_row_pos > rhs->_row_pos : lhs->_row_pos < rhs->_row_pos;
-                });
-        same_keys_num += iter.right() - iter.left();
+    if (num_tasks > 1) {
+        same_keys_num = _parallel_sort_rows(sort_pool, num_tasks);
+    } else {
+        same_keys_num = _sort_rows(_last_sorted_pos, _row_in_blocks.size());
     }
+    bool is_dup = (_keys_type == KeysType::DUP_KEYS);
     // merge new rows and old rows
     _vec_row_comparator->set_block(&_input_mutable_block);
     auto cmp_func = [this, is_dup, &same_keys_num](const RowInBlock* l,
@@ -301,6 +298,74 @@ size_t MemTable::_sort() {
     return same_keys_num;
 }
 
+size_t MemTable::_sort_rows(size_t begin, size_t end) {
+    size_t same_keys_num = 0;
+    Tie tie = Tie(begin, end);
+    for (size_t i = 0; i < _tablet_schema->num_key_columns(); i++) {
+        auto cmp = [&](const RowInBlock* lhs, const RowInBlock* rhs) -> int {
+            return _input_mutable_block.compare_one_column(lhs->_row_pos, rhs->_row_pos, i, -1);
+        };
+        _sort_one_column(_row_in_blocks, tie, cmp);
+    }
+    bool is_dup = (_keys_type == KeysType::DUP_KEYS);
+    // sort extra round by _row_pos to make the sort stable
+    auto iter = tie.iter();
+    while (iter.next()) {
+        pdqsort(std::next(_row_in_blocks.begin(), iter.left()),
+                std::next(_row_in_blocks.begin(), iter.right()),
+                [&is_dup](const RowInBlock* lhs, const RowInBlock* rhs) -> bool {
+                    return is_dup ? lhs->_row_pos > rhs->_row_pos : lhs->_row_pos < rhs->_row_pos;
+                });
+        same_keys_num += iter.right() - iter.left();
+    }
+    return same_keys_num;
+}
+
+size_t MemTable::_parallel_sort_rows(ThreadPool* sort_pool, size_t num_tasks) {
+    // chunk i is [bounds[i], bounds[i + 1])
+    size_t num_new_rows = _row_in_blocks.size() - _last_sorted_pos;
+    std::vector<size_t> bounds(num_tasks + 1);
+    for (size_t i = 0; i <= num_tasks; i++) {
+        bounds[i] = _last_sorted_pos + num_new_rows * i / num_tasks;
+    }
+    std::vector<size_t> same_keys_nums(num_tasks, 0);
+    run_tasks_with_caller(sort_pool, num_tasks, [&](size_t i) {
+        same_keys_nums[i] = _sort_rows(bounds[i], bounds[i + 1]);
+    });
+
+    // Merge neighbouring chunks in rounds with the order of _sort_rows, so the result is the
+    // same as sorting all new rows at once.
+    _vec_row_comparator->set_block(&_input_mutable_block);
+    bool is_dup = (_keys_type == KeysType::DUP_KEYS);
+    for (size_t width = 1; width < num_tasks; width *= 2) {
+        size_t num_merges = (num_tasks + 2 * width - 1) / (2 * width);
+        run_tasks_with_caller(sort_pool, num_merges, [&, width](size_t i) {
+            size_t left = 2 * width * i;
+            size_t mid = left + width;
+            if (mid >= num_tasks) {
+                return;
+            }
+            size_t right = std::min(mid + width, num_tasks);
+            size_t same_keys_num = 0;
+            auto cmp_func = [this, is_dup, &same_keys_num](const RowInBlock* l,
+                                                           const RowInBlock* r) -> bool {
+                auto value = (*(this->_vec_row_comparator))(l, r);
+                if (value == 0) {
+                    same_keys_num++;
+                    return is_dup ? l->_row_pos > r->_row_pos : l->_row_pos < r->_row_pos;
+                } else {
+                    return value < 0;
+                }
+            };
+            std::inplace_merge(std::next(_row_in_blocks.begin(), bounds[left]),
+                               std::next(_row_in_blocks.begin(), bounds[mid]),
+                               std::next(_row_in_blocks.begin(), bounds[right]), cmp_func);
+            same_keys_nums[left] += same_keys_num;
+        });
+    }
+    return std::accumulate(same_keys_nums.begin(), same_keys_nums.end(), size_t(0));
+}
+
 Status MemTable::_sort_by_cluster_keys() {
     SCOPED_RAW_TIMER(&_stat.sort_ns);
     _stat.sort_times++;
@@ -505,8 +570,8 @@ bool MemTable::need_agg() const {
     return false;
 }
 
-Status MemTable::to_block(std::unique_ptr<vectorized::Block>* res) {
-    size_t same_keys_num = _sort();
+Status MemTable::to_block(std::unique_ptr<vectorized::Block>* res, ThreadPool* sort_pool) {
+    size_t same_keys_num = _sort(sort_pool);
     if (_keys_type == KeysType::DUP_KEYS || same_keys_num == 0) {
         if (_keys_type == KeysType::DUP_KEYS && _tablet_schema->num_key_columns() == 0) {
             _output_mutable_block.swap(_input_mutable_block);
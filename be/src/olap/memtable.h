@@ -44,6 +44,7 @@ namespace doris {
 class Schema;
 class SlotDescriptor;
 class TabletSchema;
+class ThreadPool;
 class TupleDescriptor;
 enum KeysType : int;
 
@@ -189,7 +190,9 @@ public:
 
     bool need_agg() const;
 
-    Status to_block(std::unique_ptr<vectorized::Block>* res);
+    // If sort_pool is not null, the rows of a large memtable are sorted by several tasks
+    // on it, see config::memtable_parallel_sort_rows_per_task.
+    Status to_block(std::unique_ptr<vectorized::Block>* res, ThreadPool* sort_pool = nullptr);
 
     bool empty() const { return _input_mutable_block.rows() == 0; }
 
@@ -243,7 +246,11 @@ private:
     size_t _last_sorted_pos = 0;
 
     //return number of same keys
-    size_t _sort();
+    size_t _sort(ThreadPool* sort_pool = nullptr);
+    // sort _row_in_blocks[begin, end) by keys and then by _row_pos, return number of same keys
+    size_t _sort_rows(size_t begin, size_t end);
+    // sort the rows after _last_sorted_pos in chunks on sort_pool, then merge the chunks
+    size_t _parallel_sort_rows(ThreadPool* sort_pool, size_t num_tasks);
     Status _sort_by_cluster_keys();
     void _sort_one_column(std::vector<RowInBlock*>& row_in_blocks, Tie& tie,
                           std::function<int(const RowInBlock*, const RowInBlock*)> cmp);
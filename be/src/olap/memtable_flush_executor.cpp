@@ -26,6 +26,7 @@
 #include "common/config.h"
 #include "common/logging.h"
 #include "common/signal_handler.h"
+#include "io/fs/local_io_scheduler.h"
 #include "olap/memtable.h"
 #include "olap/rowset/rowset_writer.h"
 #include "util/debug_points.h"
@@ -41,6 +42,10 @@ DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(flush_thread_pool_queue_size, MetricUnit::NOU
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(flush_thread_pool_thread_num, MetricUnit::NOUNIT);
 
 bvar::Adder<int64_t> g_flush_task_num("memtable_flush_task_num");
+// distribution of the memory and the disk size of each flushed memtable, the latter is the size
+// of the segment written for it
+bvar::LatencyRecorder g_flush_memtable_mem_size("memtable_flush_mem_size_bytes");
+bvar::LatencyRecorder g_flush_segment_disk_size("memtable_flush_segment_disk_size_bytes");
 
 class MemtableFlushTask final : public Runnable {
 public:
@@ -131,11 +136,12 @@ Status FlushToken::_do_flush_memtable(MemTable* memtable, int32_t segment_id, in
     int64_t duration_ns;
     SCOPED_RAW_TIMER(&duration_ns);
     SCOPED_ATTACH_TASK(memtable->query_thread_context());
+    SCOPED_IO_TAG(io::IOClass::LOAD_FLUSH);
     signal::set_signal_task_id(_rowset_writer->load_id());
     {
         SCOPED_CONSUME_MEM_TRACKER(memtable->flush_mem_tracker());
         std::unique_ptr<vectorized::Block> block;
-        RETURN_IF_ERROR(memtable->to_block(&block));
+        RETURN_IF_ERROR(memtable->to_block(&block, _thread_pool));
         RETURN_IF_ERROR(_rowset_writer->flush_memtable(block.get(), segment_id, flush_size));
     }
     _memtable_stat += memtable->stat();
@@ -198,6 +204,8 @@ void FlushToken::_flush_memtable(std::unique_ptr<MemTable> memtable_ptr, int32_t
     _stats.flush_finish_count++;
     _stats.flush_size_bytes += memtable_ptr->memory_usage();
     _stats.flush_disk_size_bytes += flush_size;
+    g_flush_memtable_mem_size << memory_usage;
+    g_flush_segment_disk_size << flush_size;
 }
 
 void MemTableFlushExecutor::init(int num_disk) {
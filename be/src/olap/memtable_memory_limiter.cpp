@@ -19,6 +19,9 @@
 
 #include <bvar/bvar.h>
 
+#include <algorithm>
+#include <map>
+
 #include "common/config.h"
 #include "olap/memtable_writer.h"
 #include "util/doris_metrics.h"
@@ -38,6 +41,8 @@ bvar::Status<int64_t> g_memtable_flush_memory("mm_limiter_mem_flush", 0);
 bvar::Status<int64_t> g_memtable_load_memory("mm_limiter_mem_load", 0);
 bvar::Status<int64_t> g_load_hard_mem_limit("mm_limiter_limit_hard", 0);
 bvar::Status<int64_t> g_load_soft_mem_limit("mm_limiter_limit_soft", 0);
+bvar::Adder<int64_t> g_memtable_limiter_flush_count("mm_limiter_flush_memtable_count");
+bvar::LatencyRecorder g_memtable_limiter_flush_size("mm_limiter_flush_memtable_size_bytes");
 
 // Calculate the total memory limit of all load tasks on this BE
 static int64_t calc_process_max_load_memory(int64_t process_mem_limit) {
@@ -159,21 +164,90 @@ void MemTableMemoryLimiter::_flush_active_memtables(int64_t need_flush) {
     if (_active_writers.size() == 0) {
         return;
     }
+    std::vector<WriterMemItem> items;
+    items.reserve(_active_writers.size());
+    for (const auto& weak_writer : _active_writers) {
+        if (auto writer = weak_writer.lock()) {
+            items.push_back({weak_writer, writer->active_memtable_mem_consumption(),
+                             writer->active_memtable_age_ms(), UniqueId(writer->load_id())});
+        }
+    }
+    // if the memtable writer just got flushed, don't flush it again
+    int64_t avg_mem = _active_mem_usage / _active_writers.size();
     int64_t mem_flushed = 0;
     int64_t num_flushed = 0;
-    int64_t avg_mem = _active_mem_usage / _active_writers.size();
-    for (auto writer : _active_writers) {
-        int64_t mem = _flush_memtable(writer, avg_mem);
+    for (auto i : select_writers_to_flush(items, need_flush, avg_mem)) {
+        int64_t mem = _flush_memtable(items[i].writer, avg_mem);
         mem_flushed += mem;
         num_flushed += (mem > 0);
-        if (mem_flushed >= need_flush) {
-            break;
+        if (mem > 0) {
+            g_memtable_limiter_flush_count << 1;
+            g_memtable_limiter_flush_size << mem;
         }
     }
     LOG(INFO) << "flushed " << num_flushed << " out of " << _active_writers.size()
               << " active writers, flushed size: " << PrettyPrinter::print_bytes(mem_flushed);
 }
 
+std::vector<size_t> MemTableMemoryLimiter::select_writers_to_flush(
+        const std::vector<WriterMemItem>& items, int64_t need_flush, int64_t min_mem_size) {
+    // an old memtable counts as larger, so a slow load doesn't keep its memtable forever
+    auto score = [&items](size_t i) {
+        double score = items[i].mem_size;
+        if (config::memtable_flush_age_weight_sec > 0) {
+            score *= 1.0 + items[i].age_ms / (1000.0 * config::memtable_flush_age_weight_sec);
+        }
+        return score;
+    };
+    std::vector<size_t> candidates;
+    std::map<UniqueId, int64_t> load_mem;
+    int64_t total_mem = 0;
+    for (size_t i = 0; i < items.size(); ++i) {
+        if (items[i].mem_size > 0 && items[i].mem_size >= min_mem_size) {
+            candidates.push_back(i);
+            load_mem[items[i].load_id] += items[i].mem_size;
+            total_mem += items[i].mem_size;
+        }
+    }
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [&score](size_t l, size_t r) { return score(l) > score(r); });
+
+    std::vector<bool> selected(items.size(), false);
+    int64_t flushed = 0;
+    // first every load flushes its largest memtables up to its share of need_flush
+    std::map<UniqueId, int64_t> load_flushed;
+    for (auto i : candidates) {
+        if (flushed >= need_flush) {
+            break;
+        }
+        const auto& load_id = items[i].load_id;
+        double quota = double(need_flush) * load_mem[load_id] / total_mem;
+        if (load_flushed[load_id] < quota) {
+            selected[i] = true;
+            load_flushed[load_id] += items[i].mem_size;
+            flushed += items[i].mem_size;
+        }
+    }
+    // then the largest remaining ones, whatever load they are in
+    for (auto i : candidates) {
+        if (flushed >= need_flush) {
+            break;
+        }
+        if (!selected[i]) {
+            selected[i] = true;
+            flushed += items[i].mem_size;
+        }
+    }
+
+    std::vector<size_t> victims;
+    for (auto i : candidates) {
+        if (selected[i]) {
+            victims.push_back(i);
+        }
+    }
+    return victims;
+}
+
 int64_t MemTableMemoryLimiter::_flush_memtable(std::weak_ptr<MemTableWriter> writer_to_flush,
                                                int64_t threshold) {
     auto writer = writer_to_flush.lock();
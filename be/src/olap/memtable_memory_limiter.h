@@ -19,16 +19,23 @@
 
 #include <stdint.h>
 
+#include <memory>
+#include <vector>
+
 #include "common/status.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "util/countdown_latch.h"
 #include "util/stopwatch.hpp"
+#include "util/uid_util.h"
 
 namespace doris {
 class MemTableWriter;
 struct WriterMemItem {
     std::weak_ptr<MemTableWriter> writer;
+    // memory and age of the active memtable
     int64_t mem_size;
+    int64_t age_ms = 0;
+    UniqueId load_id;
 };
 class MemTableMemoryLimiter {
 public:
@@ -50,6 +57,13 @@ public:
 
     int64_t mem_usage() const { return _mem_usage; }
 
+    // Pick the writers whose active memtables to flush for need_flush bytes, in flush order.
+    // Memtables smaller than min_mem_size are skipped, so few large segments are written
+    // instead of many small ones. Each load flushes about its share of need_flush, by the size
+    // of its memtables, and within a load the largest and oldest memtables go first.
+    static std::vector<size_t> select_writers_to_flush(const std::vector<WriterMemItem>& items,
+                                                       int64_t need_flush, int64_t min_mem_size);
+
 private:
     static int64_t _avail_mem_lack();
     static int64_t _proc_mem_extra();
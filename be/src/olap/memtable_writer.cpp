@@ -44,6 +44,7 @@
 #include "service/backend_options.h"
 #include "util/mem_info.h"
 #include "util/stopwatch.hpp"
+#include "util/time.h"
 #include "vec/core/block.h"
 
 namespace doris {
@@ -216,6 +217,7 @@ void MemTableWriter::_reset_mem_table() {
         _mem_table.reset(new MemTable(_req.tablet_id, _tablet_schema.get(), _req.slots,
                                       _req.tuple_desc, _unique_key_mow, _partial_update_info.get(),
                                       mem_table_insert_tracker, mem_table_flush_tracker));
+        _mem_table_create_ms = MonotonicMillis();
     }
 
     _segment_num++;
@@ -386,4 +388,9 @@ int64_t MemTableWriter::active_memtable_mem_consumption() {
     return _mem_table != nullptr ? _mem_table->memory_usage() : 0;
 }
 
+int64_t MemTableWriter::active_memtable_age_ms() {
+    std::lock_guard<SpinLock> l(_mem_table_ptr_lock);
+    return _mem_table != nullptr ? MonotonicMillis() - _mem_table_create_ms : 0;
+}
+
 } // namespace doris
@@ -92,6 +92,8 @@ public:
 
     int64_t mem_consumption(MemType mem);
     int64_t active_memtable_mem_consumption();
+    // milliseconds since the active memtable was created, 0 if there is none
+    int64_t active_memtable_age_ms();
 
     // Submit current memtable to flush queue, and return without waiting.
     // This is currently for reducing mem consumption of this memtable writer.
@@ -102,6 +104,8 @@ public:
 
     int64_t tablet_id() const { return _req.tablet_id; }
 
+    const PUniqueId& load_id() const { return _req.load_id; }
+
     int64_t total_received_rows() const { return _total_received_rows; }
 
     const FlushStatistic& get_flush_token_stats();
@@ -133,6 +137,8 @@ private:
     SpinLock _mem_table_tracker_lock;
     SpinLock _mem_table_ptr_lock;
     std::atomic<uint32_t> _mem_table_num = 1;
+    // MonotonicMillis() when _mem_table was created, protected by _mem_table_ptr_lock
+    int64_t _mem_table_create_ms = 0;
     QueryThreadContext _query_thread_context;
 
     std::mutex _lock;
@@ -22,9 +22,11 @@
 #include <stddef.h>
 
 #include <algorithm>
+#include <atomic>
 #include <iterator>
 #include <memory>
 #include <numeric>
+#include <optional>
 #include <ostream>
 #include <shared_mutex>
 #include <string>
@@ -35,17 +37,24 @@
 #include "common/logging.h"
 #include "olap/base_tablet.h"
 #include "olap/olap_common.h"
+#include "olap/iterators.h"
 #include "olap/olap_define.h"
 #include "olap/rowid_conversion.h"
 #include "olap/rowset/rowset.h"
 #include "olap/rowset/rowset_meta.h"
 #include "olap/rowset/rowset_writer.h"
+#include "olap/rowset/segment_v2/column_reader.h"
+#include "olap/rowset/segment_v2/encoding_info.h"
+#include "olap/rowset/segment_v2/segment.h"
 #include "olap/rowset/segment_v2/segment_writer.h"
+#include "olap/schema.h"
 #include "olap/storage_engine.h"
 #include "olap/tablet.h"
 #include "olap/tablet_reader.h"
 #include "olap/utils.h"
+#include "runtime/exec_env.h"
 #include "util/slice.h"
+#include "util/threadpool.h"
 #include "vec/core/block.h"
 #include "vec/olap/block_reader.h"
 #include "vec/olap/vertical_block_reader.h"
@@ -77,6 +86,51 @@ void _generate_key_group_cluster_key_idxes(const TabletSchema& tablet_schema,
 
 } // namespace
 
+void Merger::zorder_sort(vectorized::Block* block, size_t num_columns) {
+    size_t num_rows = block->rows();
+    num_columns = std::min(num_columns, block->columns());
+    if (num_rows <= 1 || num_columns == 0) {
+        return;
+    }
+    // A value is replaced by its rank among the values of its column, scaled to the bits of
+    // each column in the 64 bits z-value, so that the z-order does not depend on the types.
+    const size_t bits = std::min<size_t>(64 / num_columns, 32);
+    std::vector<uint64_t> zvalues(num_rows, 0);
+    std::vector<uint64_t> ranks(num_rows);
+    vectorized::IColumn::Permutation perm(num_rows);
+    for (size_t cid = 0; cid < num_columns; ++cid) {
+        const auto& column = *block->get_by_position(cid).column;
+        std::iota(perm.begin(), perm.end(), 0);
+        std::sort(perm.begin(), perm.end(), [&](size_t lhs, size_t rhs) {
+            return column.compare_at(lhs, rhs, column, 1) < 0;
+        });
+        uint64_t rank = 0;
+        for (size_t i = 0; i < num_rows; ++i) {
+            if (i > 0 && column.compare_at(perm[i - 1], perm[i], column, 1) != 0) {
+                ++rank;
+            }
+            ranks[perm[i]] = rank;
+        }
+        const uint64_t num_ranks = rank + 1;
+        // the bits of the first column are the most significant ones of each group of bits
+        const size_t shift = num_columns - 1 - cid;
+        for (size_t row = 0; row < num_rows; ++row) {
+            auto scaled = static_cast<uint64_t>(
+                    (static_cast<__uint128_t>(ranks[row]) << bits) / num_ranks);
+            for (size_t bit = 0; bit < bits; ++bit) {
+                zvalues[row] |= ((scaled >> bit) & 1) << (bit * num_columns + shift);
+            }
+        }
+    }
+    std::iota(perm.begin(), perm.end(), 0);
+    std::stable_sort(perm.begin(), perm.end(),
+                     [&](size_t lhs, size_t rhs) { return zvalues[lhs] < zvalues[rhs]; });
+    for (size_t cid = 0; cid < block->columns(); ++cid) {
+        auto& column = block->get_by_position(cid).column;
+        column = column->permute(perm, 0);
+    }
+}
+
 Status Merger::vmerge_rowsets(BaseTabletSPtr tablet, ReaderType reader_type,
                               const TabletSchema& cur_tablet_schema,
                               const std::vector<RowsetReaderSharedPtr>& src_rowset_readers,
@@ -128,6 +182,20 @@ Status Merger::vmerge_rowsets(BaseTabletSPtr tablet, ReaderType reader_type,
         }
     }
 
+    // The rows of a duplicate key tablet sorted by z-order are reordered in chunks by base and
+    // full compaction. It is not done when the rows must keep their positions for the row id
+    // conversion.
+    bool zorder = cur_tablet_schema.sort_type() == SortType::ZORDER &&
+                  cur_tablet_schema.keys_type() == KeysType::DUP_KEYS &&
+                  !reader_params.record_rowids &&
+                  (reader_type == ReaderType::READER_BASE_COMPACTION ||
+                   reader_type == ReaderType::READER_FULL_COMPACTION);
+    size_t zorder_columns = cur_tablet_schema.sort_col_num() > 0
+                                    ? cur_tablet_schema.sort_col_num()
+                                    : cur_tablet_schema.num_key_columns();
+    vectorized::MutableBlock zorder_chunk(
+            cur_tablet_schema.create_block(reader_params.return_columns));
+
     vectorized::Block block = cur_tablet_schema.create_block(reader_params.return_columns);
     size_t output_rows = 0;
     bool eof = false;
@@ -142,6 +210,24 @@ Status Merger::vmerge_rowsets(BaseTabletSPtr tablet, ReaderType reader_type,
         RETURN_NOT_OK_STATUS_WITH_WARN(reader.next_block_with_aggregation(&block, &eof),
                                        "failed to read next block when merging rowsets of tablet " +
                                                std::to_string(tablet->tablet_id()));
+        if (zorder) {
+            output_rows += block.rows();
+            RETURN_IF_ERROR(zorder_chunk.merge(block));
+            block.clear_column_data();
+            if (!eof && static_cast<int64_t>(zorder_chunk.rows()) <
+                                config::zorder_compaction_sort_rows) {
+                continue;
+            }
+            auto chunk = zorder_chunk.to_block();
+            zorder_sort(&chunk, zorder_columns);
+            RETURN_NOT_OK_STATUS_WITH_WARN(
+                    dst_rowset_writer->add_block(&chunk),
+                    "failed to write block when merging rowsets of tablet " +
+                            std::to_string(tablet->tablet_id()));
+            zorder_chunk = vectorized::MutableBlock(
+                    cur_tablet_schema.create_block(reader_params.return_columns));
+            continue;
+        }
         RETURN_NOT_OK_STATUS_WITH_WARN(dst_rowset_writer->add_block(&block),
                                        "failed to write block when merging rowsets of tablet " +
                                                std::to_string(tablet->tablet_id()));
@@ -241,7 +327,7 @@ Status Merger::vertical_compact_one_group(
         vectorized::RowSourcesBuffer* row_source_buf,
         const std::vector<RowsetReaderSharedPtr>& src_rowset_readers,
         RowsetWriter* dst_rowset_writer, int64_t max_rows_per_segment, Statistics* stats_output,
-        std::vector<uint32_t> key_group_cluster_key_idxes) {
+        std::vector<uint32_t> key_group_cluster_key_idxes, int64_t value_group_idx) {
     // build tablet reader
     VLOG_NOTICE << "vertical compact one group, max_rows_per_segment=" << max_rows_per_segment;
     vectorized::VerticalBlockReader reader(row_source_buf);
@@ -301,7 +387,11 @@ Status Merger::vertical_compact_one_group(
                                        "failed to read next block when merging rowsets of tablet " +
                                                std::to_string(tablet->tablet_id()));
         RETURN_NOT_OK_STATUS_WITH_WARN(
-                dst_rowset_writer->add_columns(&block, column_group, is_key, max_rows_per_segment),
+                value_group_idx >= 0
+                        ? dst_rowset_writer->add_value_group_columns(value_group_idx, &block,
+                                                                     column_group)
+                        : dst_rowset_writer->add_columns(&block, column_group, is_key,
+                                                         max_rows_per_segment),
                 "failed to write block when merging rowsets of tablet " +
                         std::to_string(tablet->tablet_id()));
 
@@ -324,6 +414,9 @@ Status Merger::vertical_compact_one_group(
         stats_output->merged_rows = reader.merged_rows();
         stats_output->filtered_rows = reader.filtered_rows();
     }
+    if (value_group_idx >= 0) {
+        return dst_rowset_writer->flush_value_group_columns(value_group_idx);
+    }
     RETURN_IF_ERROR(dst_rowset_writer->flush_columns(is_key));
 
     return Status::OK();
@@ -385,6 +478,66 @@ Status Merger::vertical_compact_one_group(int64_t tablet_id, ReaderType reader_t
     return Status::OK();
 }
 
+namespace {
+
+// Compact the value column groups, column_groups[1:], by up to parallelism threads. Each group
+// reads the row sources by its own reader and the source rowsets by their clones, and the
+// groups are written to each segment in order by dst_rowset_writer.
+Status vertical_compact_value_groups_in_parallel(
+        ThreadPool* pool, size_t parallelism, BaseTabletSPtr tablet, ReaderType reader_type,
+        const TabletSchema& tablet_schema, const std::vector<std::vector<uint32_t>>& column_groups,
+        vectorized::RowSourcesBuffer* row_sources_buf,
+        const std::vector<RowsetReaderSharedPtr>& src_rowset_readers,
+        RowsetWriter* dst_rowset_writer, int64_t max_rows_per_segment,
+        Merger::Statistics* stats_output,
+        const std::vector<uint32_t>& key_group_cluster_key_idxes) {
+    size_t num_value_groups = column_groups.size() - 1;
+    std::vector<std::unique_ptr<vectorized::RowSourcesBuffer>> row_sources_readers(
+            num_value_groups);
+    std::vector<std::vector<RowsetReaderSharedPtr>> rowset_readers(num_value_groups);
+    for (size_t i = 0; i < num_value_groups; ++i) {
+        RETURN_IF_ERROR(row_sources_buf->create_reader(&row_sources_readers[i]));
+        for (const auto& rs_reader : src_rowset_readers) {
+            rowset_readers[i].emplace_back(rs_reader->clone());
+        }
+    }
+
+    // the groups are taken in order, so a group only waits for the previous groups, which
+    // are taken by the running threads, to be written to a segment
+    std::atomic<size_t> next_group = 0;
+    std::atomic<bool> failed = false;
+    std::vector<Status> statuses(num_value_groups);
+    run_tasks_with_caller(pool, parallelism, [&](size_t) {
+        while (!failed) {
+            size_t group_idx = next_group++;
+            if (group_idx >= num_value_groups) {
+                break;
+            }
+            statuses[group_idx] = Merger::vertical_compact_one_group(
+                    tablet, reader_type, tablet_schema, false, column_groups[group_idx + 1],
+                    row_sources_readers[group_idx].get(), rowset_readers[group_idx],
+                    dst_rowset_writer, max_rows_per_segment, stats_output,
+                    key_group_cluster_key_idxes, group_idx);
+            if (!statuses[group_idx].ok()) {
+                failed = true;
+                dst_rowset_writer->cancel_value_groups();
+            }
+        }
+    });
+    for (auto& st : statuses) {
+        // the cancelled groups fail for the first failed one
+        if (!st.ok() && !st.is<ErrorCode::CANCELLED>()) {
+            return st;
+        }
+    }
+    for (auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+    return Status::OK();
+}
+
+} // namespace
+
 // steps to do vertical merge:
 // 1. split columns into column groups
 // 2. compact groups one by one, generate a row_source_buf when compact key group
@@ -405,8 +558,28 @@ Status Merger::vertical_merge_rowsets(BaseTabletSPtr tablet, ReaderType reader_t
 
     vectorized::RowSourcesBuffer row_sources_buf(
             tablet->tablet_id(), dst_rowset_writer->context().tablet_path, reader_type);
+    ThreadPool* value_group_pool = ExecEnv::GetInstance()->vertical_compaction_thread_pool();
+    size_t parallelism = std::min<size_t>(
+            std::max(config::vertical_compaction_max_parallel_value_groups, 1),
+            column_groups.empty() ? 0 : column_groups.size() - 1);
+    // the inverted index file of a segment is written by one segment writer
+    bool parallel_value_groups = value_group_pool != nullptr && parallelism > 1 &&
+                                 !tablet_schema.has_inverted_index();
     // compact group one by one
     for (auto i = 0; i < column_groups.size(); ++i) {
+        if (i == 1 && parallel_value_groups) {
+            auto st = dst_rowset_writer->prepare_value_groups(column_groups.size() - 1);
+            if (st.ok()) {
+                RETURN_IF_ERROR(vertical_compact_value_groups_in_parallel(
+                        value_group_pool, parallelism, tablet, reader_type, tablet_schema,
+                        column_groups, &row_sources_buf, src_rowset_readers, dst_rowset_writer,
+                        max_rows_per_segment, stats_output, key_group_cluster_key_idxes));
+                break;
+            }
+            if (!st.is<ErrorCode::NOT_IMPLEMENTED_ERROR>()) {
+                return st;
+            }
+        }
         VLOG_NOTICE << "row source size: " << row_sources_buf.total_size();
         bool is_key = (i == 0);
         RETURN_IF_ERROR(vertical_compact_one_group(
@@ -426,4 +599,149 @@ Status Merger::vertical_merge_rowsets(BaseTabletSPtr tablet, ReaderType reader_t
     return Status::OK();
 }
 
+bool Merger::can_copy_value_pages(const TabletSchema& tablet_schema,
+                                  RowsetWriter* dst_rowset_writer,
+                                  const std::vector<segment_v2::SegmentSharedPtr>& segments) {
+    if (tablet_schema.keys_type() != DUP_KEYS || !tablet_schema.cluster_key_idxes().empty() ||
+        tablet_schema.has_inverted_index()) {
+        return false;
+    }
+    const auto& auto_bloom_filter_columns = dst_rowset_writer->context().auto_bloom_filter_columns;
+    for (uint32_t cid = tablet_schema.num_key_columns(); cid < tablet_schema.num_columns();
+         ++cid) {
+        const auto& column = tablet_schema.column(cid);
+        switch (column.type()) {
+        // columns with sub columns or without zone map
+        case FieldType::OLAP_FIELD_TYPE_STRUCT:
+        case FieldType::OLAP_FIELD_TYPE_ARRAY:
+        case FieldType::OLAP_FIELD_TYPE_MAP:
+        case FieldType::OLAP_FIELD_TYPE_VARIANT:
+        case FieldType::OLAP_FIELD_TYPE_JSONB:
+        case FieldType::OLAP_FIELD_TYPE_AGG_STATE:
+        case FieldType::OLAP_FIELD_TYPE_OBJECT:
+        case FieldType::OLAP_FIELD_TYPE_HLL:
+        case FieldType::OLAP_FIELD_TYPE_QUANTILE_STATE:
+            return false;
+        default:
+            break;
+        }
+        // the indexes are built from the values
+        if (column.is_bf_column() || column.has_bitmap_index() ||
+            auto_bloom_filter_columns.contains(column.unique_id()) ||
+            tablet_schema.has_ngram_bf_index(column.unique_id())) {
+            return false;
+        }
+        std::optional<segment_v2::EncodingTypePB> encoding;
+        for (const auto& segment : segments) {
+            if (segment->num_rows() == 0) {
+                continue;
+            }
+            segment_v2::ColumnReader* reader = nullptr;
+            if (!segment->get_column_reader(column, &reader).ok() || reader == nullptr) {
+                return false;
+            }
+            // the pages of a column are decoded by the encoding in its meta, and dict pages
+            // depend on the dictionary page of their own segment
+            auto page_encoding = reader->encoding_info()->encoding();
+            if (page_encoding == segment_v2::DICT_ENCODING ||
+                (encoding.has_value() && *encoding != page_encoding)) {
+                return false;
+            }
+            encoding = page_encoding;
+            if (reader->get_meta_type() != column.type() || !reader->has_zone_map() ||
+                (reader->is_nullable() && !column.is_nullable())) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+Status Merger::page_copy_merge_rowsets(BaseTabletSPtr tablet, ReaderType reader_type,
+                                       TabletSchemaSPtr tablet_schema,
+                                       const std::vector<segment_v2::SegmentSharedPtr>& segments,
+                                       RowsetWriter* dst_rowset_writer,
+                                       int64_t max_rows_per_segment, Statistics* stats_output) {
+    LOG(INFO) << "Start to do page copy compaction, tablet_id: " << tablet->tablet_id()
+              << ", segments: " << segments.size();
+    std::vector<uint32_t> key_columns;
+    std::vector<uint32_t> value_columns;
+    for (uint32_t cid = 0; cid < tablet_schema->num_columns(); ++cid) {
+        if (cid < tablet_schema->num_key_columns()) {
+            key_columns.push_back(cid);
+        } else {
+            value_columns.push_back(cid);
+        }
+    }
+
+    OlapReaderStatistics stats;
+    StorageReadOptions read_options;
+    read_options.stats = &stats;
+    read_options.use_page_cache = false;
+    read_options.tablet_schema = tablet_schema;
+    read_options.io_ctx.reader_type = reader_type;
+    auto schema = std::make_shared<Schema>(tablet_schema->columns(), key_columns);
+
+    // The key columns of each source segment are written to one output segment, a new one is
+    // started if the source segment does not fit in the current one, so that the pages of the
+    // value columns of the source segment are copied to the same output segment.
+    vectorized::Block block = tablet_schema->create_block(key_columns);
+    int64_t cur_segment_rows = 0;
+    int64_t output_rows = 0;
+    for (const auto& segment : segments) {
+        if (segment->num_rows() == 0) {
+            continue;
+        }
+        bool new_segment = cur_segment_rows > 0 &&
+                           cur_segment_rows + segment->num_rows() > max_rows_per_segment;
+        if (new_segment) {
+            cur_segment_rows = 0;
+        }
+        std::unique_ptr<RowwiseIterator> iter;
+        RETURN_IF_ERROR(segment->new_iterator(schema, read_options, &iter));
+        while (true) {
+            block.clear_column_data();
+            auto st = iter->next_batch(&block);
+            if (st.is<ErrorCode::END_OF_FILE>()) {
+                break;
+            }
+            RETURN_IF_ERROR(st);
+            // add_columns starts a new segment if the current one has more rows than
+            // max_rows_per_segment
+            RETURN_NOT_OK_STATUS_WITH_WARN(
+                    dst_rowset_writer->add_columns(&block, key_columns, true,
+                                                   new_segment ? 0 : INT32_MAX),
+                    "failed to write block when merging rowsets of tablet " +
+                            std::to_string(tablet->tablet_id()));
+            new_segment = false;
+            cur_segment_rows += block.rows();
+            output_rows += block.rows();
+        }
+    }
+    if (output_rows != std::accumulate(segments.begin(), segments.end(), int64_t(0),
+                                       [](int64_t sum, const segment_v2::SegmentSharedPtr& s) {
+                                           return sum + s->num_rows();
+                                       })) {
+        return Status::InternalError("page copy compaction of tablet {} read {} key rows",
+                                     tablet->tablet_id(), output_rows);
+    }
+    RETURN_IF_ERROR(dst_rowset_writer->flush_columns(true));
+
+    if (!value_columns.empty()) {
+        for (const auto& segment : segments) {
+            RETURN_NOT_OK_STATUS_WITH_WARN(
+                    dst_rowset_writer->add_value_column_pages(segment.get(), value_columns),
+                    "failed to copy pages when merging rowsets of tablet " +
+                            std::to_string(tablet->tablet_id()));
+        }
+        RETURN_IF_ERROR(dst_rowset_writer->flush_columns(false));
+    }
+
+    if (stats_output != nullptr) {
+        stats_output->output_rows = output_rows;
+    }
+    RETURN_IF_ERROR(dst_rowset_writer->final_flush());
+    return Status::OK();
+}
+
 } // namespace doris
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include "common/status.h"
@@ -30,6 +31,7 @@ class RowIdConversion;
 class RowsetWriter;
 
 namespace segment_v2 {
+class Segment;
 class SegmentWriter;
 } // namespace segment_v2
 
@@ -62,6 +64,26 @@ public:
             RowsetWriter* dst_rowset_writer, int64_t max_rows_per_segment,
             Statistics* stats_output);
 
+    // for page copy compaction of non-overlapping rowsets of duplicate keys without deletes,
+    // whose segments are `segments' in key order.
+    // Whether the data pages of the value columns of the segments can be copied as they are.
+    static bool can_copy_value_pages(
+            const TabletSchema& tablet_schema, RowsetWriter* dst_rowset_writer,
+            const std::vector<std::shared_ptr<segment_v2::Segment>>& segments);
+    // Concatenate the segments into the segments of `dst_rowset_writer', which must be a
+    // vertical rowset writer. The key columns are decoded and written again to build the
+    // indexes, while the data pages of the value columns are copied without decoding them.
+    static Status page_copy_merge_rowsets(
+            BaseTabletSPtr tablet, ReaderType reader_type, TabletSchemaSPtr tablet_schema,
+            const std::vector<std::shared_ptr<segment_v2::Segment>>& segments,
+            RowsetWriter* dst_rowset_writer, int64_t max_rows_per_segment,
+            Statistics* stats_output);
+
+    // Reorder the rows of `block' by the z-order curve over its first `num_columns' columns.
+    // The rows close in all of the columns end up close in the block, so the pages and the
+    // segments of them have tight min/max on each of the columns.
+    static void zorder_sort(vectorized::Block* block, size_t num_columns);
+
     // for vertical compaction
     static void vertical_split_columns(const TabletSchema& tablet_schema,
                                        std::vector<std::vector<uint32_t>>* column_groups);
@@ -71,7 +93,7 @@ public:
             vectorized::RowSourcesBuffer* row_source_buf,
             const std::vector<RowsetReaderSharedPtr>& src_rowset_readers,
             RowsetWriter* dst_rowset_writer, int64_t max_rows_per_segment, Statistics* stats_output,
-            std::vector<uint32_t> key_group_cluster_key_idxes);
+            std::vector<uint32_t> key_group_cluster_key_idxes, int64_t value_group_idx = -1);
 
     // for segcompaction
     static Status vertical_compact_one_group(int64_t tablet_id, ReaderType reader_type,
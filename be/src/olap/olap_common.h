@@ -320,6 +320,8 @@ struct OlapReaderStatistics {
     int64_t rows_short_circuit_cond_filtered = 0;
     int64_t vec_cond_input_rows = 0;
     int64_t short_circuit_cond_input_rows = 0;
+    // number of segment iterators which changed the order of the short circuit predicates
+    int64_t short_circuit_predicates_reordered = 0;
     int64_t rows_vec_del_cond_filtered = 0;
     int64_t vec_cond_ns = 0;
     int64_t short_cond_ns = 0;
@@ -352,6 +354,9 @@ struct OlapReaderStatistics {
 
     int64_t total_pages_num = 0;
     int64_t cached_pages_num = 0;
+    // The on disk bytes of the pages requested, and of the ones served by the page cache.
+    int64_t requested_page_bytes = 0;
+    int64_t cached_page_bytes = 0;
 
     int64_t rows_bitmap_index_filtered = 0;
     int64_t bitmap_index_filter_timer = 0;
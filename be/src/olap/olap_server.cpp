@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <bvar/latency_recorder.h>
 #include <gen_cpp/Types_types.h>
 #include <gen_cpp/olap_file.pb.h>
 #include <glog/logging.h>
@@ -50,6 +51,7 @@
 #include "gen_cpp/internal_service.pb.h"
 #include "gutil/ref_counted.h"
 #include "io/fs/file_writer.h" // IWYU pragma: keep
+#include "io/fs/local_file_reader.h"
 #include "io/fs/path.h"
 #include "olap/cold_data_compaction.h"
 #include "olap/compaction_permit_limiter.h"
@@ -95,6 +97,9 @@ using io::Path;
 // number of running SCHEMA-CHANGE threads
 volatile uint32_t g_schema_change_active_threads = 0;
 
+// The time the compaction tasks wait in their thread pool, in microseconds
+bvar::LatencyRecorder g_compaction_queue_delay_latency("compaction", "queue_delay");
+
 static const uint64_t DEFAULT_SEED = 104729;
 static const uint64_t MOD_PRIME = 7652413;
 
@@ -288,6 +293,7 @@ void StorageEngine::_cache_clean_callback() {
         }
 
         CacheManager::instance()->for_each_cache_prune_stale();
+        CacheManager::instance()->rebalance_capacity();
 
         // Dynamically modify the config to clear the cache, each time the disable cache will only be cleared once.
         if (config::disable_segment_cache) {
@@ -628,6 +634,12 @@ void StorageEngine::_compaction_tasks_producer_callback() {
         if (!config::disable_auto_compaction &&
             !GlobalMemoryArbitrator::is_exceed_soft_mem_limit(GB_EXCHANGE_BYTE)) {
             _adjust_compaction_thread_num();
+            if (config::enable_compaction_io_budget) {
+                int64_t latency_us = io::local_query_read_latency.latency();
+                for (auto* data_dir : data_dirs) {
+                    data_dir->compaction_io_budget().update_foreground_latency(latency_us);
+                }
+            }
 
             bool check_score = false;
             int64_t cur_time = UnixMillis();
@@ -874,7 +886,8 @@ std::vector<TabletSharedPtr> StorageEngine::_generate_compaction_tasks(
         int count = copied_cumu_map[data_dir].size() + copied_base_map[data_dir].size();
         int thread_per_disk = data_dir->is_ssd_disk() ? config::compaction_task_num_per_fast_disk
                                                       : config::compaction_task_num_per_disk;
-        if (count >= thread_per_disk) {
+        if (count >= thread_per_disk ||
+            (config::enable_compaction_io_budget && data_dir->compaction_io_budget().exhausted())) {
             // Return if no available slot
             need_pick_tablet = false;
             if (!check_score) {
@@ -1019,6 +1032,17 @@ Status StorageEngine::_submit_compaction_task(TabletSharedPtr tablet,
         return !force;
     }();
     if (st.ok() && permits > 0) {
+        // -1 if the task is not accounted in the io budget of its data dir
+        int64_t io_cost = -1;
+        if (!force && config::enable_compaction_io_budget) {
+            io_cost = compaction->get_compaction_io_cost();
+            if (!tablet->data_dir()->compaction_io_budget().try_acquire(io_cost)) {
+                VLOG_DEBUG << "skip compaction task for tablet: " << tablet->tablet_id()
+                           << " out of io budget, cost=" << io_cost;
+                _pop_tablet_from_submitted_compaction(tablet, compaction_type);
+                return Status::OK();
+            }
+        }
         if (!force) {
             _permit_limiter.request(permits);
         }
@@ -1026,15 +1050,20 @@ Status StorageEngine::_submit_compaction_task(TabletSharedPtr tablet,
                 (compaction_type == CompactionType::CUMULATIVE_COMPACTION)
                         ? _cumu_compaction_thread_pool
                         : _base_compaction_thread_pool;
+        int64_t submit_us = MonotonicMicros();
         auto st = thread_pool->submit_func([tablet, compaction = std::move(compaction),
-                                            compaction_type, permits, force, is_low_priority_task,
-                                            this]() {
+                                            compaction_type, permits, io_cost, force,
+                                            is_low_priority_task, submit_us, this]() {
+            int64_t elapsed_us = 0;
             if (is_low_priority_task && !_increase_low_priority_task_nums(tablet->data_dir())) {
                 VLOG_DEBUG << "skip low priority compaction task for tablet: "
                            << tablet->tablet_id();
                 // Todo: push task back
             } else {
-                tablet->execute_compaction(*compaction);
+                int64_t start_us = MonotonicMicros();
+                g_compaction_queue_delay_latency << start_us - submit_us;
+                tablet->execute_compaction(*compaction, start_us - submit_us);
+                elapsed_us = MonotonicMicros() - start_us;
                 if (is_low_priority_task) {
                     _decrease_low_priority_task_nums(tablet->data_dir());
                 }
@@ -1042,12 +1071,18 @@ Status StorageEngine::_submit_compaction_task(TabletSharedPtr tablet,
             if (!force) {
                 _permit_limiter.release(permits);
             }
+            if (io_cost >= 0) {
+                tablet->data_dir()->compaction_io_budget().release(io_cost, elapsed_us);
+            }
             _pop_tablet_from_submitted_compaction(tablet, compaction_type);
         });
         if (!st.ok()) {
             if (!force) {
                 _permit_limiter.release(permits);
             }
+            if (io_cost >= 0) {
+                tablet->data_dir()->compaction_io_budget().release(io_cost, 0);
+            }
             _pop_tablet_from_submitted_compaction(tablet, compaction_type);
             return Status::InternalError(
                     "failed to submit compaction task to thread pool, "
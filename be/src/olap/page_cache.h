@@ -21,9 +21,12 @@
 #include <gen_cpp/segment_v2.pb.h>
 #include <stddef.h>
 #include <stdint.h>
+#include <xxh3.h>
 
 #include <memory>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <utility>
 
 #include "olap/lru_cache.h"
@@ -87,23 +90,28 @@ public:
     // Each cached page corresponds to a specific offset within
     // a file.
     //
-    // TODO(zc): Now we use file name(std::string) as a part of
-    // key, which is not efficient. We should make it better later
+    // The file is identified by a 128-bit hash of its name, so the key is a fixed 32 bytes,
+    // which is used as the LRUCache's key in place without any allocation, however long the
+    // path of a remote file is.
     struct CacheKey {
-        CacheKey(std::string fname_, size_t fsize_, int64_t offset_)
-                : fname(std::move(fname_)), fsize(fsize_), offset(offset_) {}
-        std::string fname;
+        CacheKey(std::string_view fname, size_t fsize_, int64_t offset_)
+                : fsize(fsize_), offset(offset_) {
+            auto hash = XXH3_128bits(fname.data(), fname.size());
+            fname_hash_low = hash.low64;
+            fname_hash_high = hash.high64;
+        }
+        uint64_t fname_hash_low;
+        uint64_t fname_hash_high;
         size_t fsize;
         int64_t offset;
 
-        // Encode to a flat binary which can be used as LRUCache's key
-        std::string encode() const {
-            std::string key_buf(fname);
-            key_buf.append((char*)&fsize, sizeof(fsize));
-            key_buf.append((char*)&offset, sizeof(offset));
-            return key_buf;
+        // The flat binary of the key which can be used as LRUCache's key, valid as long as
+        // this key.
+        doris::CacheKey encode() const {
+            return {reinterpret_cast<const char*>(this), sizeof(CacheKey)};
         }
     };
+    static_assert(sizeof(CacheKey) == 32 && std::has_unique_object_representations_v<CacheKey>);
 
     class DataPageCache : public LRUCachePolicy {
     public:
@@ -112,6 +120,8 @@ public:
                                  LRUCacheType::SIZE, config::data_page_cache_stale_sweep_time_sec,
                                  num_shards) {
             init_mem_tracker_by_allocator(lru_cache_type_string(LRUCacheType::SIZE));
+            set_protected_capacity_ratio(config::data_page_cache_protected_ratio);
+            set_clock_lookup(config::enable_lru_cache_clock_lookup);
         }
     };
 
@@ -17,6 +17,9 @@
 
 #include "parallel_scanner_builder.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "cloud/cloud_storage_engine.h"
 #include "cloud/cloud_tablet_hotspot.h"
 #include "cloud/config.h"
@@ -28,6 +31,19 @@ namespace doris {
 
 using namespace vectorized;
 
+namespace {
+// The cost to scan a row of a segment, measured by the bytes a row takes in the segment file
+// on average, so that a row of a wide or poorly compressed segment costs more.
+double cost_per_row(const segment_v2::SegmentSharedPtr& segment) {
+    if (segment->num_rows() == 0) {
+        return 0;
+    }
+    auto file_reader = segment->file_reader();
+    size_t bytes = file_reader ? file_reader->size() : 0;
+    return std::max(1.0, static_cast<double>(bytes) / segment->num_rows());
+}
+} // namespace
+
 Status ParallelScannerBuilder::build_scanners(std::list<VScannerSPtr>& scanners) {
     RETURN_IF_ERROR(_load());
     if (_is_dup_mow_key) {
@@ -39,8 +55,6 @@ Status ParallelScannerBuilder::build_scanners(std::list<VScannerSPtr>& scanners)
 }
 
 Status ParallelScannerBuilder::_build_scanners_by_rowid(std::list<VScannerSPtr>& scanners) {
-    DCHECK_GE(_rows_per_scanner, _min_rows_per_scanner);
-
     for (auto&& [tablet, version] : _tablets) {
         DCHECK(_all_rowsets.contains(tablet->tablet_id()));
         auto& rowsets = _all_rowsets[tablet->tablet_id()];
@@ -61,6 +75,7 @@ Status ParallelScannerBuilder::_build_scanners_by_rowid(std::list<VScannerSPtr>&
         TabletReader::ReadSource read_source;
 
         int64_t rows_collected = 0;
+        double cost_collected = 0;
         for (auto& rowset : rowsets) {
             auto beta_rowset = std::dynamic_pointer_cast<BetaRowset>(rowset);
             RowsetReaderSharedPtr reader;
@@ -82,12 +97,15 @@ Status ParallelScannerBuilder::_build_scanners_by_rowid(std::list<VScannerSPtr>&
                 const auto& segment = segments[i];
                 RowRanges row_ranges;
                 const size_t rows_of_segment = segment->num_rows();
+                const double cost_of_row = cost_per_row(segment);
                 int64_t offset_in_segment = 0;
 
                 // try to split large segments into RowRanges
                 while (offset_in_segment < rows_of_segment) {
                     const int64_t remaining_rows = rows_of_segment - offset_in_segment;
-                    auto rows_need = _rows_per_scanner - rows_collected;
+                    auto rows_need = std::max<int64_t>(
+                            1, static_cast<int64_t>(std::ceil((_cost_per_scanner - cost_collected) /
+                                                              cost_of_row)));
 
                     // 0.9: try to avoid splitting the segments into excessively small parts.
                     if (rows_need >= remaining_rows * 0.9) {
@@ -99,10 +117,11 @@ Status ParallelScannerBuilder::_build_scanners_by_rowid(std::list<VScannerSPtr>&
                     row_ranges.add({offset_in_segment,
                                     offset_in_segment + static_cast<int64_t>(rows_need)});
                     rows_collected += rows_need;
+                    cost_collected += rows_need * cost_of_row;
                     offset_in_segment += rows_need;
 
-                    // If collected enough rows, build a new scanner
-                    if (rows_collected >= _rows_per_scanner) {
+                    // If collected enough cost, build a new scanner
+                    if (cost_collected >= _cost_per_scanner) {
                         split.segment_offsets.first = segment_start,
                         split.segment_offsets.second = i + 1;
                         split.segment_row_ranges.emplace_back(std::move(row_ranges));
@@ -123,6 +142,7 @@ Status ParallelScannerBuilder::_build_scanners_by_rowid(std::list<VScannerSPtr>&
 
                         segment_start = offset_in_segment < rows_of_segment ? i : i + 1;
                         rows_collected = 0;
+                        cost_collected = 0;
                     }
                 }
 
@@ -134,7 +154,7 @@ Status ParallelScannerBuilder::_build_scanners_by_rowid(std::list<VScannerSPtr>&
                 }
             }
 
-            DCHECK_LE(rows_collected, _rows_per_scanner);
+            DCHECK_LT(cost_collected, _cost_per_scanner);
             if (rows_collected > 0) {
                 split.segment_offsets.first = segment_start;
                 split.segment_offsets.second = segments.size();
@@ -145,7 +165,7 @@ Status ParallelScannerBuilder::_build_scanners_by_rowid(std::list<VScannerSPtr>&
             }
         } // end `for (auto& rowset : rowsets)`
 
-        DCHECK_LE(rows_collected, _rows_per_scanner);
+        DCHECK_LT(cost_collected, _cost_per_scanner);
         if (rows_collected > 0) {
             DCHECK_GT(read_source.rs_splits.size(), 0);
 #ifndef NDEBUG
@@ -187,11 +207,20 @@ Status ParallelScannerBuilder::_load() {
             RETURN_IF_ERROR(SegmentLoader::instance()->load_segments(
                     std::dynamic_pointer_cast<BetaRowset>(rowset), &segment_cache_handle, true));
             _total_rows += rowset->num_rows();
+            for (const auto& segment : segment_cache_handle.get_segments()) {
+                _total_cost += segment->num_rows() * cost_per_row(segment);
+            }
         }
     }
 
-    _rows_per_scanner = _total_rows / _max_scanners_count;
-    _rows_per_scanner = std::max<size_t>(_rows_per_scanner, _min_rows_per_scanner);
+    // Split by the cost instead of the rows, and a scanner costs at least as much as
+    // `_min_rows_per_scanner` rows of the average cost.
+    _cost_per_scanner = _total_cost / _max_scanners_count;
+    if (_total_rows > 0) {
+        _cost_per_scanner = std::max(_cost_per_scanner,
+                                     _min_rows_per_scanner * (_total_cost / _total_rows));
+    }
+    _cost_per_scanner = std::max(_cost_per_scanner, 1.0);
 
     return Status::OK();
 }
@@ -79,7 +79,10 @@ private:
 
     size_t _total_rows {};
 
-    size_t _rows_per_scanner {_min_rows_per_scanner};
+    /// The total cost to scan the rows, see `cost_per_row()`
+    double _total_cost {};
+
+    double _cost_per_scanner {};
 
     std::map<RowsetId, SegmentCacheHandle> _segment_cache_handles;
 
@@ -44,6 +44,8 @@
 #include "olap/schema_cache.h"
 #include "olap/tablet_meta.h"
 #include "olap/tablet_schema.h"
+#include "runtime/query_context.h"
+#include "runtime/runtime_state.h"
 #include "util/runtime_profile.h"
 #include "vec/core/block.h"
 #include "vec/olap/vgeneric_iterators.h"
@@ -238,6 +240,11 @@ Status BetaRowsetReader::get_segment_iterators(RowsetReaderContext* read_context
                 _read_context->runtime_state->query_options().enable_file_cache;
         _read_options.io_ctx.is_disposable =
                 _read_context->runtime_state->query_options().disable_file_cache;
+        auto* query_ctx = _read_context->runtime_state->get_query_ctx();
+        if (query_ctx != nullptr && query_ctx->workload_group() != nullptr) {
+            _read_options.io_ctx.remote_read_throttle =
+                    query_ctx->workload_group()->remote_read_throttle();
+        }
     }
 
     _read_options.io_ctx.expiration_time =
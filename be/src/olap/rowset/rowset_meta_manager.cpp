@@ -88,7 +88,8 @@ Status RowsetMetaManager::get_json_rowset_meta(OlapMeta* meta, TabletUid tablet_
     return Status::OK();
 }
 Status RowsetMetaManager::save(OlapMeta* meta, TabletUid tablet_uid, const RowsetId& rowset_id,
-                               const RowsetMetaPB& rowset_meta_pb, bool enable_binlog) {
+                               const RowsetMetaPB& rowset_meta_pb, bool enable_binlog,
+                               const std::vector<OlapMeta::BatchEntry>& extra_entries) {
     if (rowset_meta_pb.partition_id() <= 0) {
         LOG(WARNING) << "invalid partition id " << rowset_meta_pb.partition_id() << " tablet "
                      << rowset_meta_pb.tablet_id();
@@ -104,14 +105,15 @@ Status RowsetMetaManager::save(OlapMeta* meta, TabletUid tablet_uid, const Rowse
                      << partition_id << " new=" << rowset_meta_pb.DebugString();
     });
     if (enable_binlog) {
-        return _save_with_binlog(meta, tablet_uid, rowset_id, rowset_meta_pb);
+        return _save_with_binlog(meta, tablet_uid, rowset_id, rowset_meta_pb, extra_entries);
     } else {
-        return _save(meta, tablet_uid, rowset_id, rowset_meta_pb);
+        return _save(meta, tablet_uid, rowset_id, rowset_meta_pb, extra_entries);
     }
 }
 
 Status RowsetMetaManager::_save(OlapMeta* meta, TabletUid tablet_uid, const RowsetId& rowset_id,
-                                const RowsetMetaPB& rowset_meta_pb) {
+                                const RowsetMetaPB& rowset_meta_pb,
+                                const std::vector<OlapMeta::BatchEntry>& extra_entries) {
     std::string key =
             fmt::format("{}{}_{}", ROWSET_PREFIX, tablet_uid.to_string(), rowset_id.to_string());
     std::string value;
@@ -120,12 +122,21 @@ Status RowsetMetaManager::_save(OlapMeta* meta, TabletUid tablet_uid, const Rows
                                                        key);
     }
 
-    return meta->put(META_COLUMN_FAMILY_INDEX, key, value);
+    if (extra_entries.empty()) {
+        return meta->put(META_COLUMN_FAMILY_INDEX, key, value);
+    }
+    std::vector<OlapMeta::BatchEntry> entries = {{std::cref(key), std::cref(value)}};
+    for (const auto& entry : extra_entries) {
+        entries.emplace_back(entry.key, entry.value);
+    }
+    return meta->put(META_COLUMN_FAMILY_INDEX, entries);
 }
 
 Status RowsetMetaManager::_save_with_binlog(OlapMeta* meta, TabletUid tablet_uid,
                                             const RowsetId& rowset_id,
-                                            const RowsetMetaPB& rowset_meta_pb) {
+                                            const RowsetMetaPB& rowset_meta_pb,
+                                            const std::vector<OlapMeta::BatchEntry>&
+                                                    extra_entries) {
     // create rowset write data
     std::string rowset_key =
             fmt::format("{}{}_{}", ROWSET_PREFIX, tablet_uid.to_string(), rowset_id.to_string());
@@ -165,6 +176,9 @@ Status RowsetMetaManager::_save_with_binlog(OlapMeta* meta, TabletUid tablet_uid
             {std::cref(rowset_key), std::cref(rowset_value)},
             {std::cref(binlog_meta_key), std::cref(binlog_meta_value)},
             {std::cref(binlog_data_key), std::cref(rowset_value)}};
+    for (const auto& entry : extra_entries) {
+        entries.emplace_back(entry.key, entry.value);
+    }
 
     return meta->put(META_COLUMN_FAMILY_INDEX, entries);
 }
@@ -27,10 +27,10 @@
 
 #include "common/status.h"
 #include "olap/olap_common.h"
+#include "olap/olap_meta.h"
 #include "olap/rowset/rowset_meta.h"
 
 namespace doris {
-class OlapMeta;
 class RowsetMetaPB;
 } // namespace doris
 
@@ -52,8 +52,10 @@ public:
                                        const RowsetId& rowset_id, std::string* json_rowset_meta);
 
     // TODO(Drogon): refactor save && _save_with_binlog to one, adapt to ut temperately
+    // The extra entries are written in the same write batch as the rowset meta.
     static Status save(OlapMeta* meta, TabletUid tablet_uid, const RowsetId& rowset_id,
-                       const RowsetMetaPB& rowset_meta_pb, bool enable_binlog);
+                       const RowsetMetaPB& rowset_meta_pb, bool enable_binlog,
+                       const std::vector<OlapMeta::BatchEntry>& extra_entries = {});
 
     static std::vector<std::string> get_binlog_filenames(OlapMeta* meta, TabletUid tablet_uid,
                                                          std::string_view binlog_version,
@@ -82,9 +84,11 @@ public:
 
 private:
     static Status _save(OlapMeta* meta, TabletUid tablet_uid, const RowsetId& rowset_id,
-                        const RowsetMetaPB& rowset_meta_pb);
+                        const RowsetMetaPB& rowset_meta_pb,
+                        const std::vector<OlapMeta::BatchEntry>& extra_entries);
     static Status _save_with_binlog(OlapMeta* meta, TabletUid tablet_uid, const RowsetId& rowset_id,
-                                    const RowsetMetaPB& rowset_meta_pb);
+                                    const RowsetMetaPB& rowset_meta_pb,
+                                    const std::vector<OlapMeta::BatchEntry>& extra_entries);
     static Status _get_rowset_binlog_metas(OlapMeta* meta, const TabletUid tablet_uid,
                                            const std::vector<int64_t>& binlog_versions,
                                            RowsetBinlogMetasPB* metas_pb);
@@ -35,6 +35,9 @@
 #include "vec/core/block.h"
 
 namespace doris {
+namespace segment_v2 {
+class Segment;
+} // namespace segment_v2
 
 struct SegmentStatistics {
     int64_t row_num;
@@ -105,6 +108,35 @@ public:
                 "RowsetWriter not support final_flush");
     }
 
+    // for vertical compaction of value column groups in parallel, after the key group is
+    // flushed. The columns of value group i are added by add_value_group_columns(i, ...) and
+    // flushed by flush_value_group_columns(i), which may be called concurrently for different
+    // groups, and are written to each segment in the order of the groups.
+    virtual Status prepare_value_groups(size_t num_groups) {
+        return Status::Error<ErrorCode::NOT_IMPLEMENTED_ERROR>(
+                "RowsetWriter not support prepare_value_groups");
+    }
+    virtual Status add_value_group_columns(size_t group_idx, const vectorized::Block* block,
+                                           const std::vector<uint32_t>& col_ids) {
+        return Status::Error<ErrorCode::NOT_IMPLEMENTED_ERROR>(
+                "RowsetWriter not support add_value_group_columns");
+    }
+    virtual Status flush_value_group_columns(size_t group_idx) {
+        return Status::Error<ErrorCode::NOT_IMPLEMENTED_ERROR>(
+                "RowsetWriter not support flush_value_group_columns");
+    }
+    // wake up and fail the value groups waiting for another one which failed
+    virtual void cancel_value_groups() {}
+
+    // for page copy compaction, after the key columns of the whole source segments are added
+    // by add_columns and flushed. Copy the data pages of the value columns col_ids of the next
+    // source segment, in the order the key columns are added, without decoding them.
+    virtual Status add_value_column_pages(segment_v2::Segment* segment,
+                                          const std::vector<uint32_t>& col_ids) {
+        return Status::Error<ErrorCode::NOT_IMPLEMENTED_ERROR>(
+                "RowsetWriter not support add_value_column_pages");
+    }
+
     virtual Status flush_memtable(vectorized::Block* block, int32_t segment_id,
                                   int64_t* flush_size) {
         return Status::Error<ErrorCode::NOT_IMPLEMENTED_ERROR>(
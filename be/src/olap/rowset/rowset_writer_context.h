@@ -80,6 +80,9 @@ struct RowsetWriterContext {
     bool enable_unique_key_merge_on_write = false;
     // store column_unique_id to skip write inverted index
     std::set<int32_t> skip_inverted_index;
+    // column_unique_id of the columns to build page bloom filters for besides the bloom filter
+    // columns of the schema, see BaseTablet::auto_bloom_filter_columns
+    std::set<int32_t> auto_bloom_filter_columns;
     DataWriteType write_type = DataWriteType::TYPE_DEFAULT;
     BaseTabletSPtr tablet = nullptr;
 
@@ -407,19 +407,28 @@ public:
         }
 
         auto total = *n;
-        auto read_count = 0;
-        _buffer.resize(total);
-        for (size_t i = 0; i < total; ++i) {
-            ordinal_t ord = rowids[i] - page_first_ordinal;
-            if (UNLIKELY(ord >= _num_elements)) {
-                break;
-            }
-
-            _buffer[read_count++] = *reinterpret_cast<CppType*>(get_data(ord));
+        size_t read_count = 0;
+        // the rowids are ascending, so the rows of this page are a prefix of them
+        while (read_count < total && rowids[read_count] - page_first_ordinal < _num_elements) {
+            ++read_count;
         }
 
         if (LIKELY(read_count > 0)) {
-            dst->insert_many_fix_len_data((char*)_buffer.data(), read_count);
+            // gather the values straight into the column if it stores them as they are
+            auto* data = dst->insert_many_fix_len_data_in_place(read_count, SIZE_OF_TYPE);
+            if (data != nullptr) {
+                for (size_t i = 0; i < read_count; ++i) {
+                    memcpy(data + i * SIZE_OF_TYPE, get_data(rowids[i] - page_first_ordinal),
+                           SIZE_OF_TYPE);
+                }
+            } else {
+                _buffer.resize(read_count);
+                for (size_t i = 0; i < read_count; ++i) {
+                    _buffer[i] = *reinterpret_cast<CppType*>(
+                            get_data(rowids[i] - page_first_ordinal));
+                }
+                dst->insert_many_fix_len_data((char*)_buffer.data(), read_count);
+            }
         }
 
         *n = read_count;
@@ -298,6 +298,36 @@ uint64_t NGramBloomFilterIndexWriterImpl::size() {
 }
 
 // TODO currently we don't support bloom filter index for tinyint/hll/float/double
+#define APPLY_FOR_BLOOM_FILTER_TYPES(M)       \
+    M(FieldType::OLAP_FIELD_TYPE_SMALLINT)     \
+    M(FieldType::OLAP_FIELD_TYPE_INT)          \
+    M(FieldType::OLAP_FIELD_TYPE_UNSIGNED_INT) \
+    M(FieldType::OLAP_FIELD_TYPE_BIGINT)       \
+    M(FieldType::OLAP_FIELD_TYPE_LARGEINT)     \
+    M(FieldType::OLAP_FIELD_TYPE_CHAR)         \
+    M(FieldType::OLAP_FIELD_TYPE_VARCHAR)      \
+    M(FieldType::OLAP_FIELD_TYPE_STRING)       \
+    M(FieldType::OLAP_FIELD_TYPE_DATE)         \
+    M(FieldType::OLAP_FIELD_TYPE_DATETIME)     \
+    M(FieldType::OLAP_FIELD_TYPE_DECIMAL)      \
+    M(FieldType::OLAP_FIELD_TYPE_DATEV2)       \
+    M(FieldType::OLAP_FIELD_TYPE_DATETIMEV2)   \
+    M(FieldType::OLAP_FIELD_TYPE_DECIMAL32)    \
+    M(FieldType::OLAP_FIELD_TYPE_DECIMAL64)    \
+    M(FieldType::OLAP_FIELD_TYPE_DECIMAL128I)  \
+    M(FieldType::OLAP_FIELD_TYPE_DECIMAL256)
+
+bool BloomFilterIndexWriter::is_supported_type(FieldType type) {
+    switch (type) {
+#define M(TYPE) case TYPE:
+        APPLY_FOR_BLOOM_FILTER_TYPES(M)
+#undef M
+        return true;
+    default:
+        return false;
+    }
+}
+
 Status BloomFilterIndexWriter::create(const BloomFilterOptions& bf_options,
                                       const TypeInfo* type_info,
                                       std::unique_ptr<BloomFilterIndexWriter>* res) {
@@ -307,23 +337,7 @@ Status BloomFilterIndexWriter::create(const BloomFilterOptions& bf_options,
     case TYPE:                                                                   \
         res->reset(new BloomFilterIndexWriterImpl<TYPE>(bf_options, type_info)); \
         break;
-        M(FieldType::OLAP_FIELD_TYPE_SMALLINT)
-        M(FieldType::OLAP_FIELD_TYPE_INT)
-        M(FieldType::OLAP_FIELD_TYPE_UNSIGNED_INT)
-        M(FieldType::OLAP_FIELD_TYPE_BIGINT)
-        M(FieldType::OLAP_FIELD_TYPE_LARGEINT)
-        M(FieldType::OLAP_FIELD_TYPE_CHAR)
-        M(FieldType::OLAP_FIELD_TYPE_VARCHAR)
-        M(FieldType::OLAP_FIELD_TYPE_STRING)
-        M(FieldType::OLAP_FIELD_TYPE_DATE)
-        M(FieldType::OLAP_FIELD_TYPE_DATETIME)
-        M(FieldType::OLAP_FIELD_TYPE_DECIMAL)
-        M(FieldType::OLAP_FIELD_TYPE_DATEV2)
-        M(FieldType::OLAP_FIELD_TYPE_DATETIMEV2)
-        M(FieldType::OLAP_FIELD_TYPE_DECIMAL32)
-        M(FieldType::OLAP_FIELD_TYPE_DECIMAL64)
-        M(FieldType::OLAP_FIELD_TYPE_DECIMAL128I)
-        M(FieldType::OLAP_FIELD_TYPE_DECIMAL256)
+        APPLY_FOR_BLOOM_FILTER_TYPES(M)
 #undef M
     default:
         return Status::NotSupported("unsupported type for bitmap index: {}",
@@ -33,6 +33,7 @@
 namespace doris {
 
 class TypeInfo;
+enum class FieldType;
 
 namespace io {
 class FileWriter;
@@ -47,6 +48,9 @@ public:
     static Status create(const BloomFilterOptions& bf_options, const TypeInfo* typeinfo,
                          std::unique_ptr<BloomFilterIndexWriter>* res);
 
+    // whether `create` supports the type
+    static bool is_supported_type(FieldType type);
+
     BloomFilterIndexWriter() = default;
     virtual ~BloomFilterIndexWriter() = default;
 
@@ -27,6 +27,7 @@
 
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "common/status.h"
+#include "io/fs/buffered_reader.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/file_system.h"
 #include "olap/block_column_predicate.h"
@@ -303,6 +304,39 @@ Status ColumnReader::read_page(const ColumnIteratorOptions& iter_opts, const Pag
     return PageIO::read_and_decompress_page(opts, handle, page_body, footer);
 }
 
+Status ColumnReader::read_raw_data_pages(OlapReaderStatistics* stats,
+                                         const io::IOContext& io_ctx,
+                                         const RawPageConsumer& page_consumer) {
+    RETURN_IF_ERROR(_load_ordinal_index(_use_index_page_cache, _opts.kept_in_memory));
+    RETURN_IF_ERROR(_load_zone_map_index(_use_index_page_cache, _opts.kept_in_memory));
+    const std::vector<ZoneMapPB>* page_zone_maps = nullptr;
+    if (_zone_map_index != nullptr) {
+        page_zone_maps = &_zone_map_index->page_zone_maps();
+        if (page_zone_maps->size() != _ordinal_index->num_data_pages()) {
+            return Status::Corruption("{} page zone maps for {} data pages, file={}",
+                                      page_zone_maps->size(), _ordinal_index->num_data_pages(),
+                                      _file_reader->path().native());
+        }
+    }
+    for (auto iter = _ordinal_index->begin(); iter.valid(); iter.next()) {
+        PageReadOptions opts {
+                .verify_checksum = _opts.verify_checksum,
+                .type = DATA_PAGE,
+                .file_reader = _file_reader.get(),
+                .page_pointer = iter.page(),
+                .stats = stats,
+                .io_ctx = io_ctx,
+        };
+        OwnedSlice body;
+        PageFooterPB footer;
+        RETURN_IF_ERROR(PageIO::read_raw_page(opts, &body, &footer));
+        const ZoneMapPB* zone_map =
+                page_zone_maps != nullptr ? &(*page_zone_maps)[iter.page_index()] : nullptr;
+        RETURN_IF_ERROR(page_consumer(std::move(body), footer, zone_map));
+    }
+    return Status::OK();
+}
+
 Status ColumnReader::get_row_ranges_by_zone_map(
         const AndBlockColumnPredicate* col_predicates,
         const std::vector<const ColumnPredicate*>* delete_predicates, RowRanges* row_ranges) {
@@ -625,6 +659,28 @@ Status ColumnReader::seek_to_first(OrdinalPageIndexIterator* iter) {
     return Status::OK();
 }
 
+Status ColumnReader::get_page_ranges(RowRanges& row_ranges,
+                                     std::vector<io::PrefetchRange>* ranges) {
+    RETURN_IF_ERROR(_load_ordinal_index(_use_index_page_cache, _opts.kept_in_memory));
+    int32_t last_page_index = -1;
+    for (size_t i = 0; i < row_ranges.range_size(); ++i) {
+        ordinal_t idx = row_ranges.get_range_from(i);
+        ordinal_t to = row_ranges.get_range_to(i);
+        auto iter = _ordinal_index->seek_at_or_before(idx);
+        while (idx < to && iter.valid()) {
+            // a page may contain the rows of several ranges
+            if (iter.page_index() != last_page_index) {
+                last_page_index = iter.page_index();
+                const auto& pp = iter.page();
+                ranges->emplace_back(pp.offset, pp.offset + pp.size);
+            }
+            idx = iter.last_ordinal() + 1;
+            iter.next();
+        }
+    }
+    return Status::OK();
+}
+
 Status ColumnReader::seek_at_or_before(ordinal_t ordinal, OrdinalPageIndexIterator* iter) {
     RETURN_IF_ERROR(_load_ordinal_index(_use_index_page_cache, _opts.kept_in_memory));
     *iter = _ordinal_index->seek_at_or_before(ordinal);
@@ -22,7 +22,8 @@
 
 #include <cstddef> // for size_t
 #include <cstdint> // for uint32_t
-#include <memory>  // for unique_ptr
+#include <functional>
+#include <memory> // for unique_ptr
 #include <mutex>
 #include <string>
 #include <utility>
@@ -60,8 +61,10 @@ class StorageReadOptions;
 
 namespace io {
 class FileReader;
+struct PrefetchRange;
 } // namespace io
 struct Slice;
+class OwnedSlice;
 struct StringRef;
 
 namespace segment_v2 {
@@ -133,16 +136,31 @@ public:
     Status seek_to_first(OrdinalPageIndexIterator* iter);
     Status seek_at_or_before(ordinal_t ordinal, OrdinalPageIndexIterator* iter);
 
+    // Append the file ranges of the data pages which contain the rows of `row_ranges`.
+    Status get_page_ranges(RowRanges& row_ranges, std::vector<io::PrefetchRange>* ranges);
+
     // read a page from file into a page handle
     Status read_page(const ColumnIteratorOptions& iter_opts, const PagePointer& pp,
                      PageHandle* handle, Slice* page_body, PageFooterPB* footer,
                      BlockCompressionCodec* codec) const;
 
+    // Consumer of the data pages read by read_raw_data_pages(). `zone_map' is the page zone map
+    // of the page, or null if the column has no zone map.
+    using RawPageConsumer = std::function<Status(OwnedSlice&& body, const PageFooterPB& footer,
+                                                 const ZoneMapPB* zone_map)>;
+
+    // Read every data page of the column as it is stored, i.e. without decompressing and
+    // decoding it, and pass it to `page_consumer' in ordinal order.
+    Status read_raw_data_pages(OlapReaderStatistics* stats, const io::IOContext& io_ctx,
+                               const RawPageConsumer& page_consumer);
+
     bool is_nullable() const { return _meta_is_nullable; }
 
     const EncodingInfo* encoding_info() const { return _encoding_info; }
 
     bool has_zone_map() const { return _zone_map_index != nullptr; }
+    // the segment zone map, or null if the column has no zone map
+    const ZoneMapPB* segment_zone_map() const { return _segment_zone_map.get(); }
     bool has_bitmap_index() const { return _bitmap_index != nullptr; }
     bool has_bloom_filter_index(bool ngram) const;
     // Check if this column could match `cond' using segment zone map.
@@ -365,6 +383,13 @@ public:
 
     bool is_nullable() { return _reader->is_nullable(); }
 
+    Status get_page_ranges(RowRanges& row_ranges, std::vector<io::PrefetchRange>* ranges) {
+        return _reader->get_page_ranges(row_ranges, ranges);
+    }
+
+    // Read the following pages by `file_reader`, e.g. a reader merging the small IOs.
+    void set_file_reader(io::FileReader* file_reader) { _opts.file_reader = file_reader; }
+
     bool is_all_dict_encoding() const override { return _is_all_dict_encoding; }
 
 private:
@@ -22,6 +22,9 @@
 
 #include <algorithm>
 #include <filesystem>
+#include <limits>
+#include <tuple>
+#include <utility>
 
 #include "common/config.h"
 #include "common/logging.h"
@@ -452,6 +455,8 @@ Status ScalarColumnWriter::init() {
 
     PageBuilder* page_builder = nullptr;
 
+    _sample_encoding = config::enable_column_encoding_sampling &&
+                       _opts.meta->encoding() == DEFAULT_ENCODING;
     RETURN_IF_ERROR(
             EncodingInfo::get(get_field()->type_info(), _opts.meta->encoding(), &_encoding_info));
     _opts.meta->set_encoding(_encoding_info->encoding());
@@ -552,6 +557,11 @@ Status ScalarColumnWriter::append_nulls(size_t num_rows) {
 // num_rows must be written before return. And ptr will be modified
 // to next data should be written
 Status ScalarColumnWriter::append_data(const uint8_t** ptr, size_t num_rows) {
+    if (_sample_encoding) {
+        // the first non-null values of the column, nothing is in the page builder yet
+        _sample_encoding = false;
+        RETURN_IF_ERROR(_choose_encoding(*ptr, num_rows));
+    }
     size_t remaining = num_rows;
     while (remaining > 0) {
         size_t num_written = remaining;
@@ -566,6 +576,108 @@ Status ScalarColumnWriter::append_data(const uint8_t** ptr, size_t num_rows) {
     return Status::OK();
 }
 
+// The encodings tried when sampling, each with the rank of its decode cost, the lower
+// the faster. Prefix encoding is left out as it is only chosen for value seek.
+static constexpr std::pair<EncodingTypePB, int> SAMPLED_ENCODINGS[] = {
+        {PLAIN_ENCODING, 0}, {BIT_SHUFFLE, 1}, {FOR_ENCODING, 1}, {RLE, 2}, {DICT_ENCODING, 2}};
+// Too few values to tell one encoding from another
+static constexpr size_t MIN_ENCODING_SAMPLE_ROWS = 64;
+
+Status ScalarColumnWriter::_choose_encoding(const uint8_t* data, size_t num_rows) {
+    size_t sample_rows =
+            std::min(num_rows, static_cast<size_t>(config::column_encoding_sample_rows));
+    if (sample_rows < MIN_ENCODING_SAMPLE_ROWS) {
+        return Status::OK();
+    }
+    std::vector<std::tuple<const EncodingInfo*, uint64_t, int>> candidates;
+    uint64_t min_size = std::numeric_limits<uint64_t>::max();
+    for (auto [encoding, decode_rank] : SAMPLED_ENCODINGS) {
+        if (!EncodingInfo::is_supported(get_field()->type_info(), encoding)) {
+            continue;
+        }
+        const EncodingInfo* encoding_info = nullptr;
+        RETURN_IF_ERROR(EncodingInfo::get(get_field()->type_info(), encoding, &encoding_info));
+        uint64_t size = 0;
+        RETURN_IF_ERROR(_sample_encoded_size(encoding_info, data, sample_rows, &size));
+        candidates.emplace_back(encoding_info, size, decode_rank);
+        min_size = std::min(min_size, size);
+    }
+    // the fastest to decode of the encodings about as compact as the smallest one
+    uint64_t max_size = min_size + min_size * config::column_encoding_size_tolerance_percent / 100;
+    const EncodingInfo* chosen = nullptr;
+    int chosen_rank = std::numeric_limits<int>::max();
+    uint64_t chosen_size = 0;
+    for (auto& [encoding_info, size, decode_rank] : candidates) {
+        if (size <= max_size &&
+            (decode_rank < chosen_rank || (decode_rank == chosen_rank && size < chosen_size))) {
+            chosen = encoding_info;
+            chosen_rank = decode_rank;
+            chosen_size = size;
+        }
+    }
+    if (chosen == nullptr || chosen == _encoding_info) {
+        return Status::OK();
+    }
+
+    PageBuilderOptions opts;
+    opts.data_page_size = _opts.data_page_size;
+    PageBuilder* page_builder = nullptr;
+    RETURN_IF_ERROR(chosen->create_page_builder(opts, &page_builder));
+    if (page_builder == nullptr) {
+        return Status::NotSupported("Failed to create page builder for type {} and encoding {}",
+                                    get_field()->type(), chosen->encoding());
+    }
+    VLOG_DEBUG << "column " << get_field()->name() << " is encoded by " << chosen->encoding()
+               << " instead of " << _encoding_info->encoding() << ", sampled size "
+               << chosen_size << " of " << sample_rows << " rows";
+    _page_builder.reset(page_builder);
+    _encoding_info = chosen;
+    // the encoding of the column is recorded in its meta in the segment footer
+    _opts.meta->set_encoding(chosen->encoding());
+    return Status::OK();
+}
+
+Status ScalarColumnWriter::_sample_encoded_size(const EncodingInfo* encoding_info,
+                                                const uint8_t* data, size_t num_rows,
+                                                uint64_t* size) {
+    PageBuilderOptions opts;
+    opts.data_page_size = _opts.data_page_size;
+    PageBuilder* page_builder = nullptr;
+    RETURN_IF_ERROR(encoding_info->create_page_builder(opts, &page_builder));
+    if (page_builder == nullptr) {
+        return Status::NotSupported("Failed to create page builder for type {} and encoding {}",
+                                    get_field()->type(), encoding_info->encoding());
+    }
+    std::unique_ptr<PageBuilder> builder(page_builder);
+    auto add_page_size = [&](const Slice& body) {
+        OwnedSlice compressed_body;
+        RETURN_IF_ERROR(PageIO::compress_page_body(
+                _compress_codec, _opts.compression_min_space_saving, {body}, &compressed_body));
+        *size += compressed_body.slice().empty() ? body.size : compressed_body.slice().size;
+        return Status::OK();
+    };
+
+    *size = 0;
+    size_t remaining = num_rows;
+    while (remaining > 0) {
+        size_t num_written = remaining;
+        RETURN_IF_ERROR(builder->add(data, &num_written));
+        data += get_field()->size() * num_written;
+        remaining -= num_written;
+        if (remaining == 0 || builder->is_page_full()) {
+            OwnedSlice body = builder->finish();
+            RETURN_IF_ERROR(add_page_size(body.slice()));
+            RETURN_IF_ERROR(builder->reset());
+        }
+    }
+    if (encoding_info->encoding() == DICT_ENCODING) {
+        OwnedSlice dict_body;
+        RETURN_IF_ERROR(builder->get_dictionary_page(&dict_body));
+        RETURN_IF_ERROR(add_page_size(dict_body.slice()));
+    }
+    return Status::OK();
+}
+
 Status ScalarColumnWriter::append_data_in_current_page(const uint8_t* data, size_t* num_written) {
     RETURN_IF_ERROR(_page_builder->add(data, num_written));
     if (_opts.need_zone_map) {
@@ -688,6 +800,86 @@ Status ScalarColumnWriter::write_bloom_filter_index() {
     return Status::OK();
 }
 
+Status ScalarColumnWriter::append_raw_page(EncodingTypePB encoding, CompressionTypePB compression,
+                                           OwnedSlice&& body, const PageFooterPB& footer,
+                                           const ZoneMapPB* page_zone_map) {
+    DCHECK_EQ(_next_rowid, _first_rowid);
+    if (_opts.need_bitmap_index || _opts.need_inverted_index || _opts.need_bloom_filter) {
+        return Status::NotSupported("can not append raw pages to column {} with indexes",
+                                    get_field()->name());
+    }
+    if (_opts.need_zone_map && page_zone_map == nullptr) {
+        return Status::NotSupported("can not append raw pages without zone map to column {}",
+                                    get_field()->name());
+    }
+    if (encoding == DICT_ENCODING) {
+        // the pages depend on the dictionary page of their own segment
+        return Status::NotSupported("can not append raw dict pages to column {}",
+                                    get_field()->name());
+    }
+    if (!is_nullable() && footer.data_page_footer().nullmap_size() > 0) {
+        return Status::NotSupported("can not append raw pages with nulls to column {}",
+                                    get_field()->name());
+    }
+    if (encoding != _encoding_info->encoding()) {
+        if (_next_rowid > 0) {
+            return Status::NotSupported("can not append raw pages of encoding {} to column {}",
+                                        encoding, get_field()->name());
+        }
+        // no value is encoded yet, so the column is encoded as the appended pages
+        RETURN_IF_ERROR(EncodingInfo::get(get_field()->type_info(), encoding, &_encoding_info));
+        _opts.meta->set_encoding(encoding);
+        _sample_encoding = false;
+    }
+
+    std::unique_ptr<Page> page(new Page());
+    page->footer = footer;
+    page->footer.mutable_data_page_footer()->set_first_ordinal(_next_rowid);
+    if (compression != _opts.meta->compression()) {
+        if (body.slice().size != footer.uncompressed_size()) {
+            BlockCompressionCodec* codec = nullptr;
+            RETURN_IF_ERROR(get_block_compression_codec(compression, &codec));
+            if (codec == nullptr) {
+                return Status::Corruption("page of column {} is compressed by NO_COMPRESSION",
+                                          get_field()->name());
+            }
+            faststring buf;
+            buf.resize(footer.uncompressed_size());
+            Slice uncompressed(buf.data(), buf.size());
+            RETURN_IF_ERROR(codec->decompress(body.slice(), &uncompressed));
+            if (uncompressed.size != footer.uncompressed_size()) {
+                return Status::Corruption("page of column {} is decompressed to {} bytes, not {}",
+                                          get_field()->name(), uncompressed.size,
+                                          footer.uncompressed_size());
+            }
+            body = buf.build();
+        }
+        OwnedSlice compressed_body;
+        RETURN_IF_ERROR(PageIO::compress_page_body(
+                _compress_codec, _opts.compression_min_space_saving, {body.slice()},
+                &compressed_body));
+        if (!compressed_body.slice().empty()) {
+            body = std::move(compressed_body);
+        }
+    }
+    page->data.emplace_back(std::move(body));
+
+    if (_opts.need_zone_map) {
+        RETURN_IF_ERROR(_zone_map_index_builder->add_page_zone_map(*page_zone_map));
+    }
+    _next_rowid += footer.data_page_footer().num_values();
+    _first_rowid = _next_rowid;
+    _push_back_page(std::move(page));
+    return Status::OK();
+}
+
+Status ScalarColumnWriter::merge_segment_zone_map(const ZoneMapPB& segment_zone_map) {
+    if (_opts.need_zone_map) {
+        RETURN_IF_ERROR(_zone_map_index_builder->merge_segment_zone_map(segment_zone_map));
+    }
+    return Status::OK();
+}
+
 // write a data page into file and update ordinal index
 Status ScalarColumnWriter::_write_data_page(Page* page) {
     PagePointer pp;
@@ -205,6 +205,18 @@ public:
     }
     Status append_data(const uint8_t** ptr, size_t num_rows) override;
 
+    // Append a data page read as it is stored from the column of another segment, whose values
+    // are encoded with `encoding' and compressed with `compression', as the next page of the
+    // column without decoding it. The page is recompressed if `compression' is not the one of
+    // this column. `page_zone_map' is required if the column has a zone map. Pages can only be
+    // appended before any value, and all of them must have the same encoding.
+    Status append_raw_page(EncodingTypePB encoding, CompressionTypePB compression,
+                           OwnedSlice&& body, const PageFooterPB& footer,
+                           const ZoneMapPB* page_zone_map);
+
+    // Merge the segment zone map of the segment whose pages are appended by append_raw_page().
+    Status merge_segment_zone_map(const ZoneMapPB& segment_zone_map);
+
     // used for append not null data. When page is full, will append data not reach num_rows.
     Status append_data_in_current_page(const uint8_t** ptr, size_t* num_written);
 
@@ -246,6 +258,16 @@ private:
 
     Status _write_data_page(Page* page);
 
+    // Choose the encoding of the column by encoding the first num_rows values with every
+    // encoding its type supports, and replace the page builder if another one is chosen.
+    Status _choose_encoding(const uint8_t* data, size_t num_rows);
+    // The size of the pages, after compression, which encoding_info encodes num_rows values to
+    Status _sample_encoded_size(const EncodingInfo* encoding_info, const uint8_t* data,
+                                size_t num_rows, uint64_t* size);
+
+    // Whether the encoding of the column is not specified and is chosen by sampling
+    bool _sample_encoding = false;
+
 private:
     io::FileWriter* _file_writer = nullptr;
     // total size of data page list
@@ -200,6 +200,11 @@ public:
 
     Status get(FieldType data_type, EncodingTypePB encoding_type, const EncodingInfo** out);
 
+    bool contains(FieldType data_type, EncodingTypePB encoding_type) const {
+        return _encoding_map.find(std::make_pair(data_type, encoding_type)) !=
+               _encoding_map.end();
+    }
+
 private:
     // Not thread-safe
     template <FieldType type, EncodingTypePB encoding_type, bool optimize_value_seek = false>
@@ -385,5 +390,9 @@ EncodingTypePB EncodingInfo::get_default_encoding(const TypeInfo* type_info,
     return s_encoding_info_resolver.get_default_encoding(type_info->type(), optimize_value_seek);
 }
 
+bool EncodingInfo::is_supported(const TypeInfo* type_info, EncodingTypePB encoding_type) {
+    return s_encoding_info_resolver.contains(type_info->type(), encoding_type);
+}
+
 } // namespace segment_v2
 } // namespace doris
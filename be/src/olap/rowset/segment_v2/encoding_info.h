@@ -57,6 +57,9 @@ public:
     // and support fast value seek operation
     static EncodingTypePB get_default_encoding(const TypeInfo* type_info, bool optimize_value_seek);
 
+    // Whether the data type can be encoded by encoding_type
+    static bool is_supported(const TypeInfo* type_info, EncodingTypePB encoding_type);
+
     Status create_page_builder(const PageBuilderOptions& opts, PageBuilder** builder) const {
         return _create_builder_func(opts, builder);
     }
@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <algorithm>
+#include <vector>
+
 #include "olap/rowset/segment_v2/options.h"      // for PageBuilderOptions/PageDecoderOptions
 #include "olap/rowset/segment_v2/page_builder.h" // for PageBuilder
 #include "olap/rowset/segment_v2/page_decoder.h" // for PageDecoder
@@ -149,11 +152,43 @@ public:
     }
 
     Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
-        return Status::NotSupported("frame page not implement vec op now");
+        return next_batch<true>(n, dst);
+    }
+
+    template <bool forward_index>
+    Status next_batch(size_t* n, vectorized::MutableColumnPtr& dst) {
+        DCHECK(_parsed) << "Must call init() firstly";
+        if (PREDICT_FALSE(*n == 0 || _cur_index >= _num_elements)) {
+            *n = 0;
+            return Status::OK();
+        }
+
+        size_t max_fetch = std::min(*n, static_cast<size_t>(_num_elements - _cur_index));
+        // decode the frames straight into the column if it stores the values as they are
+        auto* data = dst->insert_many_fix_len_data_in_place(max_fetch, sizeof(CppType));
+        if (data == nullptr) {
+            _buffer.resize(max_fetch);
+            data = reinterpret_cast<char*>(_buffer.data());
+        }
+        if (!_decoder->get_batch(reinterpret_cast<CppType*>(data), max_fetch)) {
+            return Status::Corruption("failed to decode {} values of the frame of reference page",
+                                      max_fetch);
+        }
+        if (data == reinterpret_cast<char*>(_buffer.data())) {
+            dst->insert_many_fix_len_data(data, max_fetch);
+        }
+
+        *n = max_fetch;
+        if constexpr (forward_index) {
+            _cur_index += max_fetch;
+        } else {
+            _decoder->skip(-static_cast<int32_t>(max_fetch));
+        }
+        return Status::OK();
     }
 
     Status peek_next_batch(size_t* n, vectorized::MutableColumnPtr& dst) override {
-        return Status::NotSupported("frame page not implement vec op now");
+        return next_batch<false>(n, dst);
     }
 
     size_t count() const override { return _num_elements; }
@@ -168,6 +203,8 @@ private:
     uint32_t _num_elements;
     size_t _cur_index;
     std::unique_ptr<ForDecoder<CppType>> _decoder;
+    // used if the values can not be decoded into the column directly
+    std::vector<CppType> _buffer;
 };
 
 } // namespace segment_v2
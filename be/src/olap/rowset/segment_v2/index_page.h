@@ -144,6 +144,15 @@ public:
 
     const Slice& current_key() const { return _reader->get_key(_pos); }
 
+    // Return true when `search_key` is in [current_key, next_key), that is the entry
+    // `seek_at_or_before(search_key)` would point to is the current one.
+    bool current_contains(const Slice& search_key) const {
+        if (search_key.compare(current_key()) < 0) {
+            return false;
+        }
+        return _pos + 1 >= _reader->count() || search_key.compare(_reader->get_key(_pos + 1)) < 0;
+    }
+
     const PagePointer& current_page_pointer() const { return _reader->get_value(_pos); }
 
 private:
@@ -222,16 +222,22 @@ Status IndexedColumnIterator::seek_at_or_after(const void* key, bool* exact_matc
         // seek index to determine the data page to seek
         std::string encoded_key;
         _reader->_value_key_coder->full_encode_ascending(key, &encoded_key);
-        Status st = _value_iter.seek_at_or_before(encoded_key);
-        if (st.is<ENTRY_NOT_FOUND>()) {
-            // all keys in page is greater than `encoded_key`, point to the first page.
-            // otherwise, we may missing some pages.
-            // For example, the predicate is `col1 > 2`, and the index page is [3,5,7].
-            // so the `seek_at_or_before(2)` will return Status::Error<ENTRY_NOT_FOUND>().
-            // But actually, we expect it to point to page `3`.
-            _value_iter.seek_to_first();
-        } else if (!st.ok()) {
-            return st;
+        // Keys looked up in ascending order by the same iterator often fall in the data page
+        // loaded by the previous seek, the value index needn't be searched again for them.
+        if (!_data_page || _current_iter != &_value_iter ||
+            _data_page.page_pointer != _value_iter.current_page_pointer() ||
+            !_value_iter.current_contains(encoded_key)) {
+            Status st = _value_iter.seek_at_or_before(encoded_key);
+            if (st.is<ENTRY_NOT_FOUND>()) {
+                // all keys in page is greater than `encoded_key`, point to the first page.
+                // otherwise, we may missing some pages.
+                // For example, the predicate is `col1 > 2`, and the index page is [3,5,7].
+                // so the `seek_at_or_before(2)` will return Status::Error<ENTRY_NOT_FOUND>().
+                // But actually, we expect it to point to page `3`.
+                _value_iter.seek_to_first();
+            } else if (!st.ok()) {
+                return st;
+            }
         }
         data_page_pp = _value_iter.current_page_pointer();
         _current_iter = &_value_iter;
@@ -90,36 +90,64 @@ void ConjunctionQuery::search(roaring::Roaring& roaring) {
 }
 
 void ConjunctionQuery::search_by_bitmap(roaring::Roaring& roaring) {
-    // can get a term of all docid
-    auto func = [&roaring](const TermIterator& term_docs, bool first) {
-        roaring::Roaring result;
-        DocRange doc_range;
-        while (term_docs.readRange(&doc_range)) {
-            if (doc_range.type_ == DocRangeType::kMany) {
-                result.addMany(doc_range.doc_many_size_, doc_range.doc_many->data());
-            } else {
-                result.addRange(doc_range.doc_range.first, doc_range.doc_range.second);
-            }
-        }
-        if (first) {
-            roaring.swap(result);
+    // fill the bitmap by the rarest term for the first time
+    DocRange doc_range;
+    while (_lead1.readRange(&doc_range)) {
+        if (doc_range.type_ == DocRangeType::kMany) {
+            roaring.addMany(doc_range.doc_many_size_, doc_range.doc_many->data());
         } else {
-            roaring &= result;
+            roaring.addRange(doc_range.doc_range.first, doc_range.doc_range.second);
         }
-    };
-
-    // fill the bitmap for the first time
-    func(_lead1, true);
+    }
 
+    // the terms are sorted by doc freq, the candidates only get fewer, and the remaining terms
+    // needn't be read once there is none left.
     // the second inverted list may be empty
-    if (!_lead2.isEmpty()) {
-        func(_lead2, false);
+    if (!_lead2.isEmpty() && !roaring.isEmpty()) {
+        intersect(_lead2, roaring);
     }
-
     // The inverted index iterators contained in the _others array must not be empty
     for (auto& other : _others) {
-        func(other, false);
+        if (roaring.isEmpty()) {
+            break;
+        }
+        intersect(other, roaring);
+    }
+}
+
+void ConjunctionQuery::intersect(TermIterator& term_docs, roaring::Roaring& roaring) {
+    roaring::Roaring result;
+    if (_index_version == IndexVersion::kV1 &&
+        term_docs.docFreq() / roaring.cardinality() > _conjunction_ratio) {
+        // far fewer candidates than docs of the term, look them up through its skip list
+        int32_t term_doc = -1;
+        for (uint32_t doc : roaring) {
+            if (term_doc < static_cast<int32_t>(doc)) {
+                term_doc = term_docs.advance(doc);
+                if (term_doc == INT32_MAX) {
+                    break;
+                }
+            }
+            if (term_doc == static_cast<int32_t>(doc)) {
+                result.add(doc);
+            }
+        }
+    } else {
+        // intersect range by range, so the docs of a frequent term are never collected into
+        // one bitmap
+        DocRange doc_range;
+        while (term_docs.readRange(&doc_range)) {
+            roaring::Roaring range_docs;
+            if (doc_range.type_ == DocRangeType::kMany) {
+                range_docs.addMany(doc_range.doc_many_size_, doc_range.doc_many->data());
+            } else {
+                range_docs.addRange(doc_range.doc_range.first, doc_range.doc_range.second);
+            }
+            range_docs &= roaring;
+            result |= range_docs;
+        }
     }
+    roaring.swap(result);
 }
 
 void ConjunctionQuery::search_by_skiplist(roaring::Roaring& roaring) {
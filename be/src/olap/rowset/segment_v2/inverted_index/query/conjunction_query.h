@@ -36,6 +36,8 @@ public:
 private:
     void search_by_bitmap(roaring::Roaring& roaring);
     void search_by_skiplist(roaring::Roaring& roaring);
+    // keep the docs of `roaring` which contain the term of `term_docs`
+    void intersect(TermIterator& term_docs, roaring::Roaring& roaring);
 
     int32_t do_next(int32_t doc);
 
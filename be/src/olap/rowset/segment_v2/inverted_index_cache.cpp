@@ -28,6 +28,7 @@
 #include "runtime/exec_env.h"
 #include "runtime/thread_context.h"
 #include "util/defer_op.h"
+#include "util/hash_util.hpp"
 
 namespace doris::segment_v2 {
 
@@ -115,11 +116,15 @@ Cache::Handle* InvertedIndexSearcherCache::_insert(const InvertedIndexSearcherCa
 }
 
 bool InvertedIndexQueryCache::lookup(const CacheKey& key, InvertedIndexQueryCacheHandle* handle) {
-    if (key.encode().empty()) {
+    auto encoded_key = key.encode();
+    if (encoded_key.empty()) {
         return false;
     }
-    auto* lru_handle = LRUCachePolicy::lookup(key.encode());
+    auto* lru_handle = LRUCachePolicy::lookup(encoded_key);
     if (lru_handle == nullptr) {
+        if (config::inverted_index_query_cache_admission_min_misses > 1) {
+            _record_miss(encoded_key);
+        }
         return false;
     }
     *handle = InvertedIndexQueryCacheHandle(this, lru_handle);
@@ -131,11 +136,17 @@ void InvertedIndexQueryCache::insert(const CacheKey& key, std::shared_ptr<roarin
     std::unique_ptr<InvertedIndexQueryCache::CacheValue> cache_value_ptr =
             std::make_unique<InvertedIndexQueryCache::CacheValue>();
     cache_value_ptr->bitmap = bitmap;
-    if (key.encode().empty()) {
+    auto encoded_key = key.encode();
+    if (encoded_key.empty()) {
+        return;
+    }
+    int32_t min_misses = config::inverted_index_query_cache_admission_min_misses;
+    if (min_misses > 1 && key.query_type != InvertedIndexQueryType::UNKNOWN_QUERY &&
+        _estimate_misses(encoded_key) < static_cast<uint32_t>(min_misses)) {
         return;
     }
 
-    auto* lru_handle = LRUCachePolicy::insert(key.encode(), (void*)cache_value_ptr.release(),
+    auto* lru_handle = LRUCachePolicy::insert(encoded_key, (void*)cache_value_ptr.release(),
                                               bitmap->getSizeInBytes(), bitmap->getSizeInBytes(),
                                               CachePriority::NORMAL);
     *handle = InvertedIndexQueryCacheHandle(this, lru_handle);
@@ -145,4 +156,35 @@ int64_t InvertedIndexQueryCache::mem_consumption() {
     return LRUCachePolicy::mem_consumption();
 }
 
+void InvertedIndexQueryCache::_record_miss(const std::string& encoded_key) {
+    uint64_t hash = HashUtil::xxHash64WithSeed(encoded_key.data(), encoded_key.size(), 0);
+    for (size_t i = 0; i < SKETCH_DEPTH; ++i) {
+        auto& counter = _miss_sketch[i * SKETCH_WIDTH + ((hash >> (i * 16)) & (SKETCH_WIDTH - 1))];
+        uint8_t count = counter.load(std::memory_order_relaxed);
+        // concurrent misses may lose an increment, it is only an estimation
+        if (count < UINT8_MAX) {
+            counter.store(count + 1, std::memory_order_relaxed);
+        }
+    }
+    if (_num_misses.fetch_add(1, std::memory_order_relaxed) + 1 == SKETCH_SAMPLE_SIZE) {
+        for (size_t i = 0; i < SKETCH_DEPTH * SKETCH_WIDTH; ++i) {
+            _miss_sketch[i].store(_miss_sketch[i].load(std::memory_order_relaxed) / 2,
+                                  std::memory_order_relaxed);
+        }
+        _num_misses.store(0, std::memory_order_relaxed);
+    }
+}
+
+uint32_t InvertedIndexQueryCache::_estimate_misses(const std::string& encoded_key) const {
+    uint64_t hash = HashUtil::xxHash64WithSeed(encoded_key.data(), encoded_key.size(), 0);
+    uint32_t estimation = UINT8_MAX;
+    for (size_t i = 0; i < SKETCH_DEPTH; ++i) {
+        estimation = std::min<uint32_t>(
+                estimation,
+                _miss_sketch[i * SKETCH_WIDTH + ((hash >> (i * 16)) & (SKETCH_WIDTH - 1))].load(
+                        std::memory_order_relaxed));
+    }
+    return estimation;
+}
+
 } // namespace doris::segment_v2
@@ -107,7 +107,9 @@ private:
                 : LRUCachePolicy(CachePolicy::CacheType::INVERTEDINDEX_SEARCHER_CACHE, capacity,
                                  LRUCacheType::SIZE,
                                  config::inverted_index_cache_stale_sweep_time_sec, num_shards,
-                                 element_count_capacity, true) {}
+                                 element_count_capacity, true) {
+            set_protected_capacity_ratio(config::inverted_index_cache_protected_ratio);
+        }
         InvertedIndexSearcherCachePolicy(size_t capacity, uint32_t num_shards,
                                          uint32_t element_count_capacity,
                                          CacheValueTimeExtractor cache_value_time_extractor,
@@ -230,14 +232,33 @@ public:
     InvertedIndexQueryCache(size_t capacity, uint32_t num_shards)
             : LRUCachePolicy(CachePolicy::CacheType::INVERTEDINDEX_QUERY_CACHE, capacity,
                              LRUCacheType::SIZE, config::inverted_index_cache_stale_sweep_time_sec,
-                             num_shards) {}
+                             num_shards) {
+        set_protected_capacity_ratio(config::inverted_index_cache_protected_ratio);
+    }
 
     bool lookup(const CacheKey& key, InvertedIndexQueryCacheHandle* handle);
 
+    // The result of a query is only inserted if its key has missed the cache at least
+    // config::inverted_index_query_cache_admission_min_misses times recently, `handle` is left
+    // empty otherwise. The null bitmaps of the indexes are always inserted.
     void insert(const CacheKey& key, std::shared_ptr<roaring::Roaring> bitmap,
                 InvertedIndexQueryCacheHandle* handle);
 
     int64_t mem_consumption();
+
+private:
+    // Count the recent misses of the keys in a count-min sketch, whose saturated counters are
+    // halved after every SKETCH_SAMPLE_SIZE misses, so that old misses are forgotten.
+    void _record_miss(const std::string& encoded_key);
+    uint32_t _estimate_misses(const std::string& encoded_key) const;
+
+    static constexpr size_t SKETCH_DEPTH = 4;
+    static constexpr size_t SKETCH_WIDTH = 1 << 16;
+    static constexpr size_t SKETCH_SAMPLE_SIZE = SKETCH_WIDTH * 8;
+
+    std::unique_ptr<std::atomic<uint8_t>[]> _miss_sketch =
+            std::make_unique<std::atomic<uint8_t>[]>(SKETCH_DEPTH * SKETCH_WIDTH);
+    std::atomic<size_t> _num_misses = 0;
 };
 
 class InvertedIndexQueryCacheHandle {
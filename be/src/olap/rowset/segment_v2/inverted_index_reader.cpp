@@ -658,53 +658,45 @@ Status BkdIndexReader::invoke_bkd_try_query(const void* query_value,
     return Status::OK();
 }
 
+template <InvertedIndexQueryType QT>
+Status BkdIndexReader::invoke_bkd_visitor(const void* query_value,
+                                          std::shared_ptr<lucene::util::bkd::bkd_reader> r,
+                                          roaring::Roaring* hits, const roaring::Roaring* filter,
+                                          uint32_t* count) {
+    auto visitor = std::make_unique<InvertedIndexVisitor<QT>>(r.get(), hits, count != nullptr);
+    visitor->set_filter(filter);
+    RETURN_IF_ERROR(construct_bkd_query_value(query_value, r, visitor.get()));
+    r->intersect(visitor.get());
+    if (count != nullptr) {
+        *count = visitor->get_num_hits();
+    }
+    return Status::OK();
+}
+
 Status BkdIndexReader::invoke_bkd_query(const void* query_value, InvertedIndexQueryType query_type,
                                         std::shared_ptr<lucene::util::bkd::bkd_reader> r,
-                                        std::shared_ptr<roaring::Roaring>& bit_map) {
+                                        std::shared_ptr<roaring::Roaring>& bit_map,
+                                        const roaring::Roaring* filter, uint32_t* count) {
+    roaring::Roaring* hits = count == nullptr ? bit_map.get() : nullptr;
     switch (query_type) {
-    case InvertedIndexQueryType::LESS_THAN_QUERY: {
-        auto visitor =
-                std::make_unique<InvertedIndexVisitor<InvertedIndexQueryType::LESS_THAN_QUERY>>(
-                        r.get(), bit_map.get());
-        RETURN_IF_ERROR(construct_bkd_query_value(query_value, r, visitor.get()));
-        r->intersect(visitor.get());
-        break;
-    }
-    case InvertedIndexQueryType::LESS_EQUAL_QUERY: {
-        auto visitor =
-                std::make_unique<InvertedIndexVisitor<InvertedIndexQueryType::LESS_EQUAL_QUERY>>(
-                        r.get(), bit_map.get());
-        RETURN_IF_ERROR(construct_bkd_query_value(query_value, r, visitor.get()));
-        r->intersect(visitor.get());
-        break;
-    }
-    case InvertedIndexQueryType::GREATER_THAN_QUERY: {
-        auto visitor =
-                std::make_unique<InvertedIndexVisitor<InvertedIndexQueryType::GREATER_THAN_QUERY>>(
-                        r.get(), bit_map.get());
-        RETURN_IF_ERROR(construct_bkd_query_value(query_value, r, visitor.get()));
-        r->intersect(visitor.get());
-        break;
-    }
-    case InvertedIndexQueryType::GREATER_EQUAL_QUERY: {
-        auto visitor =
-                std::make_unique<InvertedIndexVisitor<InvertedIndexQueryType::GREATER_EQUAL_QUERY>>(
-                        r.get(), bit_map.get());
-        RETURN_IF_ERROR(construct_bkd_query_value(query_value, r, visitor.get()));
-        r->intersect(visitor.get());
-        break;
-    }
-    case InvertedIndexQueryType::EQUAL_QUERY: {
-        auto visitor = std::make_unique<InvertedIndexVisitor<InvertedIndexQueryType::EQUAL_QUERY>>(
-                r.get(), bit_map.get());
-        RETURN_IF_ERROR(construct_bkd_query_value(query_value, r, visitor.get()));
-        r->intersect(visitor.get());
-        break;
-    }
+    case InvertedIndexQueryType::LESS_THAN_QUERY:
+        return invoke_bkd_visitor<InvertedIndexQueryType::LESS_THAN_QUERY>(query_value, r, hits,
+                                                                           filter, count);
+    case InvertedIndexQueryType::LESS_EQUAL_QUERY:
+        return invoke_bkd_visitor<InvertedIndexQueryType::LESS_EQUAL_QUERY>(query_value, r, hits,
+                                                                            filter, count);
+    case InvertedIndexQueryType::GREATER_THAN_QUERY:
+        return invoke_bkd_visitor<InvertedIndexQueryType::GREATER_THAN_QUERY>(query_value, r, hits,
+                                                                              filter, count);
+    case InvertedIndexQueryType::GREATER_EQUAL_QUERY:
+        return invoke_bkd_visitor<InvertedIndexQueryType::GREATER_EQUAL_QUERY>(
+                query_value, r, hits, filter, count);
+    case InvertedIndexQueryType::EQUAL_QUERY:
+        return invoke_bkd_visitor<InvertedIndexQueryType::EQUAL_QUERY>(query_value, r, hits,
+                                                                       filter, count);
     default:
         return Status::Error<ErrorCode::INVERTED_INDEX_NOT_SUPPORTED>("Invalid query type");
     }
-    return Status::OK();
 }
 
 Status BkdIndexReader::try_query(OlapReaderStatistics* stats, const std::string& column_name,
@@ -788,6 +780,92 @@ Status BkdIndexReader::query(OlapReaderStatistics* stats, RuntimeState* runtime_
     }
 }
 
+Status BkdIndexReader::query_with_filter(OlapReaderStatistics* stats,
+                                         RuntimeState* runtime_state,
+                                         const std::string& column_name, const void* query_value,
+                                         InvertedIndexQueryType query_type,
+                                         const roaring::Roaring& filter,
+                                         std::shared_ptr<roaring::Roaring>& bit_map) {
+    SCOPED_RAW_TIMER(&stats->inverted_index_query_timer);
+
+    try {
+        std::shared_ptr<lucene::util::bkd::bkd_reader> r;
+        auto st = get_bkd_reader(r, stats);
+        if (!st.ok()) {
+            LOG(WARNING) << "get bkd reader for  "
+                         << _inverted_index_file_reader->get_index_file_path(&_index_meta)
+                         << " failed: " << st;
+            return st;
+        }
+        std::string query_str;
+        _value_key_coder->full_encode_ascending(query_value, &query_str);
+
+        // a cached unfiltered result is still the cheapest answer
+        auto index_file_key = _inverted_index_file_reader->get_index_file_key(&_index_meta);
+        InvertedIndexQueryCache::CacheKey cache_key {index_file_key, column_name, query_type,
+                                                     query_str};
+        auto* cache = InvertedIndexQueryCache::instance();
+        InvertedIndexQueryCacheHandle cache_handler;
+        auto cache_status = handle_query_cache(cache, cache_key, &cache_handler, stats, bit_map);
+        if (cache_status.ok()) {
+            return Status::OK();
+        }
+
+        RETURN_IF_ERROR(invoke_bkd_query(query_value, query_type, r, bit_map, &filter));
+
+        VLOG_DEBUG << "BKD index filtered search column: " << column_name
+                   << " filter: " << filter.cardinality() << " result: " << bit_map->cardinality();
+
+        return Status::OK();
+    } catch (const CLuceneError& e) {
+        LOG(ERROR) << "BKD Query CLuceneError Occurred, error msg:  " << e.what() << " file_path:"
+                   << _inverted_index_file_reader->get_index_file_path(&_index_meta);
+        return Status::Error<ErrorCode::INVERTED_INDEX_CLUCENE_ERROR>(
+                "BKD Query CLuceneError Occurred, error msg: {}", e.what());
+    }
+}
+
+Status BkdIndexReader::count(OlapReaderStatistics* stats, const std::string& column_name,
+                             const void* query_value, InvertedIndexQueryType query_type,
+                             const roaring::Roaring* filter, uint32_t* count) {
+    SCOPED_RAW_TIMER(&stats->inverted_index_query_timer);
+
+    try {
+        std::shared_ptr<lucene::util::bkd::bkd_reader> r;
+        auto st = get_bkd_reader(r, stats);
+        if (!st.ok()) {
+            LOG(WARNING) << "get bkd reader for  "
+                         << _inverted_index_file_reader->get_index_file_path(&_index_meta)
+                         << " failed: " << st;
+            return st;
+        }
+        std::string query_str;
+        _value_key_coder->full_encode_ascending(query_value, &query_str);
+
+        auto index_file_key = _inverted_index_file_reader->get_index_file_key(&_index_meta);
+        InvertedIndexQueryCache::CacheKey cache_key {index_file_key, column_name, query_type,
+                                                     query_str};
+        auto* cache = InvertedIndexQueryCache::instance();
+        InvertedIndexQueryCacheHandle cache_handler;
+        std::shared_ptr<roaring::Roaring> bit_map;
+        auto cache_status = handle_query_cache(cache, cache_key, &cache_handler, stats, bit_map);
+        if (cache_status.ok()) {
+            *count = filter == nullptr ? bit_map->cardinality()
+                                       : bit_map->and_cardinality(*filter);
+            return Status::OK();
+        }
+
+        RETURN_IF_ERROR(invoke_bkd_query(query_value, query_type, r, bit_map, filter, count));
+
+        VLOG_DEBUG << "BKD index count column: " << column_name << " result: " << *count;
+
+        return Status::OK();
+    } catch (const CLuceneError& e) {
+        return Status::Error<ErrorCode::INVERTED_INDEX_CLUCENE_ERROR>(
+                "BKD Query CLuceneError Occurred, error msg: {}", e.what());
+    }
+}
+
 Status BkdIndexReader::get_bkd_reader(BKDIndexSearcherPtr& bkd_reader,
                                       OlapReaderStatistics* stats) {
     BKDIndexSearcherPtr* bkd_searcher = nullptr;
@@ -1021,7 +1099,13 @@ void InvertedIndexVisitor<QT>::visit(roaring::Roaring* doc_id, std::vector<uint8
 
 template <InvertedIndexQueryType QT>
 void InvertedIndexVisitor<QT>::visit(roaring::Roaring&& r) {
-    if (_only_count) {
+    if (_filter != nullptr) {
+        if (_only_count) {
+            _num_hits += r.and_cardinality(*_filter);
+        } else {
+            *_hits |= r & *_filter;
+        }
+    } else if (_only_count) {
         _num_hits += r.cardinality();
     } else {
         *_hits |= r;
@@ -1030,7 +1114,13 @@ void InvertedIndexVisitor<QT>::visit(roaring::Roaring&& r) {
 
 template <InvertedIndexQueryType QT>
 void InvertedIndexVisitor<QT>::visit(roaring::Roaring& r) {
-    if (_only_count) {
+    if (_filter != nullptr) {
+        if (_only_count) {
+            _num_hits += r.and_cardinality(*_filter);
+        } else {
+            *_hits |= r & *_filter;
+        }
+    } else if (_only_count) {
         _num_hits += r.cardinality();
     } else {
         *_hits |= r;
@@ -1039,11 +1129,7 @@ void InvertedIndexVisitor<QT>::visit(roaring::Roaring& r) {
 
 template <InvertedIndexQueryType QT>
 void InvertedIndexVisitor<QT>::visit(int row_id) {
-    if (_only_count) {
-        _num_hits++;
-    } else {
-        _hits->add(row_id);
-    }
+    _add(row_id);
 }
 
 template <InvertedIndexQueryType QT>
@@ -1054,11 +1140,7 @@ void InvertedIndexVisitor<QT>::visit(lucene::util::bkd::bkd_docid_set_iterator*
     }
     int32_t doc_id = iter->docid_set->nextDoc();
     while (doc_id != lucene::util::bkd::bkd_docid_set::NO_MORE_DOCS) {
-        if (_only_count) {
-            _num_hits++;
-        } else {
-            _hits->add(doc_id);
-        }
+        _add(doc_id);
         doc_id = iter->docid_set->nextDoc();
     }
 }
@@ -1069,11 +1151,7 @@ int InvertedIndexVisitor<QT>::visit(int row_id, std::vector<uint8_t>& packed_val
     if (result != 0) {
         return result;
     }
-    if (_only_count) {
-        _num_hits++;
-    } else {
-        _hits->add(row_id);
-    }
+    _add(row_id);
     return 0;
 }
 
@@ -1224,6 +1302,41 @@ Status InvertedIndexIterator::read_from_inverted_index(
     return Status::OK();
 }
 
+Status InvertedIndexIterator::read_from_inverted_index(const std::string& column_name,
+                                                       const void* query_value,
+                                                       InvertedIndexQueryType query_type,
+                                                       uint32_t segment_num_rows,
+                                                       const roaring::Roaring& row_filter,
+                                                       std::shared_ptr<roaring::Roaring>& bit_map) {
+    if (UNLIKELY(_reader == nullptr)) {
+        throw CLuceneError(CL_ERR_NullPointer, "bkd index reader is null", false);
+    }
+    // A wide filter keeps most of the matches anyway, so the full result is built and cached
+    // for the queries that come after.
+    if (_reader->type() != InvertedIndexReaderType::BKD ||
+        row_filter.cardinality() * 100 >
+                uint64_t(segment_num_rows) * config::inverted_index_bkd_row_filter_max_percent) {
+        return read_from_inverted_index(column_name, query_value, query_type, segment_num_rows,
+                                        bit_map);
+    }
+    auto* bkd_reader = static_cast<BkdIndexReader*>(_reader.get());
+    return bkd_reader->query_with_filter(_stats, _runtime_state, column_name, query_value,
+                                         query_type, row_filter, bit_map);
+}
+
+Status InvertedIndexIterator::count_from_inverted_index(const std::string& column_name,
+                                                        const void* query_value,
+                                                        InvertedIndexQueryType query_type,
+                                                        uint32_t* count) {
+    if (_reader->type() != InvertedIndexReaderType::BKD) {
+        return Status::Error<ErrorCode::INVERTED_INDEX_NOT_SUPPORTED>(
+                "only bkd index support count, index type: {}",
+                reader_type_to_string(_reader->type()));
+    }
+    auto* bkd_reader = static_cast<BkdIndexReader*>(_reader.get());
+    return bkd_reader->count(_stats, column_name, query_value, query_type, nullptr, count);
+}
+
 Status InvertedIndexIterator::try_read_from_inverted_index(const std::string& column_name,
                                                            const void* query_value,
                                                            InvertedIndexQueryType query_type,
@@ -219,8 +219,21 @@ private:
     roaring::Roaring* _hits = nullptr;
     uint32_t _num_hits;
     bool _only_count;
+    // if set, only the row ids in it are collected or counted
+    const roaring::Roaring* _filter = nullptr;
     lucene::util::bkd::bkd_reader* _reader = nullptr;
 
+    void _add(uint32_t row_id) {
+        if (_filter != nullptr && !_filter->contains(row_id)) {
+            return;
+        }
+        if (_only_count) {
+            _num_hits++;
+        } else {
+            _hits->add(row_id);
+        }
+    }
+
 public:
     std::string query_min;
     std::string query_max;
@@ -232,6 +245,7 @@ public:
 
     void set_reader(lucene::util::bkd::bkd_reader* r) { _reader = r; }
     lucene::util::bkd::bkd_reader* get_reader() { return _reader; }
+    void set_filter(const roaring::Roaring* filter) { _filter = filter; }
 
     void visit(int row_id) override;
     void visit(roaring::Roaring& r) override;
@@ -269,9 +283,28 @@ public:
                      uint32_t* count) override;
     Status invoke_bkd_try_query(const void* query_value, InvertedIndexQueryType query_type,
                                 std::shared_ptr<lucene::util::bkd::bkd_reader> r, uint32_t* count);
+    // Visit the bkd tree for query_value. The matching row ids are added to bit_map, or only
+    // counted into count if it is not null. If filter is not null, rows outside it are skipped.
     Status invoke_bkd_query(const void* query_value, InvertedIndexQueryType query_type,
                             std::shared_ptr<lucene::util::bkd::bkd_reader> r,
-                            std::shared_ptr<roaring::Roaring>& bit_map);
+                            std::shared_ptr<roaring::Roaring>& bit_map,
+                            const roaring::Roaring* filter = nullptr, uint32_t* count = nullptr);
+    // Same as query, but only the rows in filter are collected into bit_map. The result
+    // depends on filter, so it is served from the query cache but never put into it.
+    Status query_with_filter(OlapReaderStatistics* stats, RuntimeState* runtime_state,
+                             const std::string& column_name, const void* query_value,
+                             InvertedIndexQueryType query_type, const roaring::Roaring& filter,
+                             std::shared_ptr<roaring::Roaring>& bit_map);
+    // Exact number of rows matching query_value (and in filter if it is not null), counted
+    // during the tree visit without building a bitmap. try_query only gives an estimate.
+    Status count(OlapReaderStatistics* stats, const std::string& column_name,
+                 const void* query_value, InvertedIndexQueryType query_type,
+                 const roaring::Roaring* filter, uint32_t* count);
+    template <InvertedIndexQueryType QT>
+    Status invoke_bkd_visitor(const void* query_value,
+                              std::shared_ptr<lucene::util::bkd::bkd_reader> r,
+                              roaring::Roaring* hits, const roaring::Roaring* filter,
+                              uint32_t* count);
     template <InvertedIndexQueryType QT>
     Status construct_bkd_query_value(const void* query_value,
                                      std::shared_ptr<lucene::util::bkd::bkd_reader> r,
@@ -372,6 +405,16 @@ public:
                                     bool skip_try = false);
     Status try_read_from_inverted_index(const std::string& column_name, const void* query_value,
                                         InvertedIndexQueryType query_type, uint32_t* count);
+    // Like read_from_inverted_index, but the caller only keeps the rows in row_filter. A bkd
+    // index then skips the other rows while visiting instead of materializing all matches,
+    // if row_filter keeps few enough of the segment rows.
+    Status read_from_inverted_index(const std::string& column_name, const void* query_value,
+                                    InvertedIndexQueryType query_type, uint32_t segment_num_rows,
+                                    const roaring::Roaring& row_filter,
+                                    std::shared_ptr<roaring::Roaring>& bit_map);
+    // Exact number of rows matching query_value, only supported by bkd index.
+    Status count_from_inverted_index(const std::string& column_name, const void* query_value,
+                                     InvertedIndexQueryType query_type, uint32_t* count);
 
     Status read_null_bitmap(InvertedIndexQueryCacheHandle* cache_handle,
                             lucene::store::Directory* dir = nullptr) {
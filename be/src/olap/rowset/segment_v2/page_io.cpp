@@ -20,17 +20,25 @@
 #include <gen_cpp/segment_v2.pb.h>
 #include <stdint.h>
 
+#include <bvar/bvar.h>
+
 #include <algorithm>
+#include <array>
+#include <condition_variable>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <ostream>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "gutil/strings/substitute.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/file_writer.h"
+#include "io/io_common.h"
 #include "olap/olap_common.h"
 #include "olap/page_cache.h"
 #include "olap/rowset/segment_v2/encoding_info.h"
@@ -38,6 +46,7 @@
 #include "util/block_compression.h"
 #include "util/coding.h"
 #include "util/crc32c.h"
+#include "util/defer_op.h"
 #include "util/faststring.h"
 #include "util/runtime_profile.h"
 
@@ -46,6 +55,66 @@ namespace segment_v2 {
 
 using strings::Substitute;
 
+namespace {
+bvar::Adder<int64_t> g_shared_page_loads("doris_segment_v2", "shared_page_loads");
+
+// The loads of the pages missing in the storage page cache. A concurrent read of a page being
+// loaded waits for the load, and then finds the page in the cache instead of reading and
+// decompressing it again. It saves the IO of the concurrent scans of the same data, e.g. the
+// identical queries of a dashboard refresh.
+class SharedPageLoads {
+public:
+    struct Load {
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool done = false;
+
+        void wait() {
+            std::unique_lock lock(mutex);
+            cv.wait(lock, [this] { return done; });
+        }
+    };
+
+    // Return the load of the page, and whether the caller is the loader, which must call
+    // finish() after the page is loaded or fails to load.
+    std::pair<std::shared_ptr<Load>, bool> start(const StoragePageCache::CacheKey& key) {
+        auto& shard = _shards[key.offset % NUM_SHARDS];
+        std::string encoded = key.encode().to_string();
+        std::lock_guard lock(shard.mutex);
+        auto [it, inserted] = shard.loads.try_emplace(std::move(encoded));
+        if (inserted) {
+            it->second = std::make_shared<Load>();
+        }
+        return {it->second, inserted};
+    }
+
+    void finish(const StoragePageCache::CacheKey& key, const std::shared_ptr<Load>& load) {
+        auto& shard = _shards[key.offset % NUM_SHARDS];
+        {
+            std::lock_guard lock(shard.mutex);
+            shard.loads.erase(key.encode().to_string());
+        }
+        {
+            std::lock_guard lock(load->mutex);
+            load->done = true;
+        }
+        load->cv.notify_all();
+    }
+
+private:
+    static constexpr size_t NUM_SHARDS = 64;
+
+    struct Shard {
+        std::mutex mutex;
+        std::unordered_map<std::string, std::shared_ptr<Load>> loads;
+    };
+    std::array<Shard, NUM_SHARDS> _shards;
+};
+
+SharedPageLoads s_shared_page_loads;
+
+} // namespace
+
 Status PageIO::compress_page_body(BlockCompressionCodec* codec, double min_space_saving,
                                   const std::vector<Slice>& body, OwnedSlice* compressed_body) {
     size_t uncompressed_size = Slice::compute_total_size(body);
@@ -115,15 +184,17 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
                                         Slice* body, PageFooterPB* footer) {
     opts.sanity_check();
     opts.stats->total_pages_num++;
+    opts.stats->requested_page_bytes += opts.page_pointer.size;
 
     auto cache = StoragePageCache::instance();
     PageCacheHandle cache_handle;
     StoragePageCache::CacheKey cache_key(opts.file_reader->path().native(),
                                          opts.file_reader->size(), opts.page_pointer.offset);
-    if (opts.use_page_cache && cache && cache->lookup(cache_key, &cache_handle, opts.type)) {
+    auto use_cached_page = [&]() {
         // we find page in cache, use it
         *handle = PageHandle(std::move(cache_handle));
         opts.stats->cached_pages_num++;
+        opts.stats->cached_page_bytes += opts.page_pointer.size;
         // parse body and footer
         Slice page_slice = handle->data();
         uint32_t footer_size = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
@@ -134,7 +205,30 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
         }
         *body = Slice(page_slice.data, page_slice.size - 4 - footer_size);
         return Status::OK();
+    };
+    if (opts.use_page_cache && cache && cache->lookup(cache_key, &cache_handle, opts.type)) {
+        return use_cached_page();
+    }
+
+    std::shared_ptr<SharedPageLoads::Load> shared_load;
+    if (opts.use_page_cache && cache && config::enable_shared_page_load) {
+        auto [load, is_loader] = s_shared_page_loads.start(cache_key);
+        if (is_loader) {
+            shared_load = std::move(load);
+        } else {
+            load->wait();
+            if (cache->lookup(cache_key, &cache_handle, opts.type)) {
+                g_shared_page_loads << 1;
+                return use_cached_page();
+            }
+            // the load failed or the page is evicted already, load it by ourselves
+        }
     }
+    Defer finish_shared_load {[&]() {
+        if (shared_load) {
+            s_shared_page_loads.finish(cache_key, shared_load);
+        }
+    }};
 
     // every page contains 4 bytes footer length and 4 bytes checksum
     const uint32_t page_size = opts.page_pointer.size;
@@ -156,8 +250,11 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
     {
         SCOPED_RAW_TIMER(&opts.stats->io_ns);
         size_t bytes_read = 0;
+        // the page will be cached by the storage page cache, no need to cache it in os page cache
+        io::IOContext io_ctx = opts.io_ctx;
+        io_ctx.direct_io = opts.use_page_cache && cache && config::enable_local_direct_io_read;
         RETURN_IF_ERROR(opts.file_reader->read_at(opts.page_pointer.offset, page_slice, &bytes_read,
-                                                  &opts.io_ctx));
+                                                  &io_ctx));
         DCHECK_EQ(bytes_read, page_size);
         opts.stats->compressed_bytes_read += page_size;
     }
@@ -235,5 +332,52 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
     return Status::OK();
 }
 
+Status PageIO::read_raw_page(const PageReadOptions& opts, OwnedSlice* body,
+                             PageFooterPB* footer) {
+    opts.sanity_check();
+    opts.stats->total_pages_num++;
+    opts.stats->requested_page_bytes += opts.page_pointer.size;
+
+    // every page contains 4 bytes footer length and 4 bytes checksum
+    const uint32_t page_size = opts.page_pointer.size;
+    if (page_size < 8) {
+        return Status::Corruption("Bad page: too small size ({}), file={}", page_size,
+                                  opts.file_reader->path().native());
+    }
+
+    faststring buf;
+    buf.resize(page_size);
+    Slice page_slice(buf.data(), page_size);
+    {
+        SCOPED_RAW_TIMER(&opts.stats->io_ns);
+        size_t bytes_read = 0;
+        RETURN_IF_ERROR(opts.file_reader->read_at(opts.page_pointer.offset, page_slice, &bytes_read,
+                                                  &opts.io_ctx));
+        DCHECK_EQ(bytes_read, page_size);
+        opts.stats->compressed_bytes_read += page_size;
+    }
+
+    if (opts.verify_checksum) {
+        uint32_t expect = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
+        uint32_t actual = crc32c::Value(page_slice.data, page_slice.size - 4);
+        if (expect != actual) {
+            return Status::Corruption(
+                    "Bad page: checksum mismatch (actual={} vs expect={}), file={}", actual, expect,
+                    opts.file_reader->path().native());
+        }
+    }
+
+    uint32_t footer_size = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 8);
+    if (footer_size > page_size - 8 ||
+        !footer->ParseFromArray(page_slice.data + page_size - 8 - footer_size, footer_size)) {
+        return Status::Corruption("Bad page: invalid footer, footer_size={}, file={}", footer_size,
+                                  opts.file_reader->path().native());
+    }
+
+    buf.resize(page_size - 8 - footer_size);
+    *body = buf.build();
+    return Status::OK();
+}
+
 } // namespace segment_v2
 } // namespace doris
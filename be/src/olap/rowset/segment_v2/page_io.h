@@ -125,6 +125,12 @@ public:
     //     `footer' stores the page footer.
     static Status read_and_decompress_page(const PageReadOptions& opts, PageHandle* handle,
                                            Slice* body, PageFooterPB* footer);
+
+    // Read a page according to `opts' as it is stored, without decompressing or decoding it.
+    // On success `body' holds the page body, which is compressed if its size is not equal to
+    // the uncompressed size in `footer'. The page cache is not used.
+    static Status read_raw_page(const PageReadOptions& opts, OwnedSlice* body,
+                                PageFooterPB* footer);
 };
 
 } // namespace segment_v2
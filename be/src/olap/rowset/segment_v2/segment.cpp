@@ -24,6 +24,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <set>
 #include <utility>
 
 #include "common/logging.h"
@@ -75,6 +76,8 @@
 
 namespace doris::segment_v2 {
 static bvar::Adder<size_t> g_total_segment_num("doris_total_segment_num");
+static bvar::Adder<int64_t> g_segment_column_reader_num("doris_segment_column_reader_num");
+static bvar::Adder<int64_t> g_segment_column_meta_bytes("doris_segment_column_meta_bytes");
 class InvertedIndexIterator;
 
 Status Segment::open(io::FileSystemSPtr fs, const std::string& path, uint32_t segment_id,
@@ -101,6 +104,12 @@ Segment::Segment(uint32_t segment_id, RowsetId rowset_id, TabletSchemaSPtr table
 
 Segment::~Segment() {
     g_total_segment_num << -1;
+    g_segment_column_reader_num << -static_cast<int64_t>(_column_readers.size());
+    int64_t column_meta_bytes = 0;
+    for (const auto& [_, meta] : _column_metas) {
+        column_meta_bytes += meta->ByteSizeLong();
+    }
+    g_segment_column_meta_bytes << -column_meta_bytes;
 }
 
 io::UInt128Wrapper Segment::file_cache_key(std::string_view rowset_id, uint32_t seg_id) {
@@ -165,9 +174,7 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
             const auto* node = _sub_column_tree.find_exact(*col.path_info_ptr());
             reader = node != nullptr ? node->data.reader.get() : nullptr;
         } else {
-            reader = _column_readers.contains(col.unique_id())
-                             ? _column_readers[col.unique_id()].get()
-                             : nullptr;
+            RETURN_IF_ERROR(_get_column_reader(col.unique_id(), &reader));
         }
         if (!reader || !reader->has_zone_map()) {
             continue;
@@ -195,10 +202,12 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
             AndBlockColumnPredicate and_predicate;
             and_predicate.add_column_predicate(
                     SingleColumnBlockPredicate::create_unique(runtime_predicate.get()));
-            if (_column_readers.contains(uid) &&
+            ColumnReader* reader = nullptr;
+            RETURN_IF_ERROR(_get_column_reader(uid, &reader));
+            if (reader != nullptr &&
                 can_apply_predicate_safely(runtime_predicate->column_id(), runtime_predicate.get(),
                                            *schema, read_options.io_ctx.reader_type) &&
-                !_column_readers.at(uid)->match_condition(&and_predicate)) {
+                !reader->match_condition(&and_predicate)) {
                 // any condition not satisfied, return.
                 *iter = std::make_unique<EmptySegmentIterator>(*schema);
                 read_options.stats->filtered_segment_number++;
@@ -208,9 +217,14 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
     }
 
     RETURN_IF_ERROR(load_index());
-    if (read_options.delete_condition_predicates->num_of_column_predicate() == 0 &&
-        read_options.push_down_agg_type_opt != TPushAggOp::NONE &&
-        read_options.push_down_agg_type_opt != TPushAggOp::COUNT_ON_INDEX) {
+    bool use_statistics =
+            read_options.delete_condition_predicates->num_of_column_predicate() == 0 &&
+            read_options.push_down_agg_type_opt != TPushAggOp::NONE &&
+            read_options.push_down_agg_type_opt != TPushAggOp::COUNT_ON_INDEX;
+    if (use_statistics) {
+        RETURN_IF_ERROR(_can_answer_by_statistics(*schema, read_options, &use_statistics));
+    }
+    if (use_statistics) {
         iter->reset(vectorized::new_vstatistics_iterator(this->shared_from_this(), *schema));
     } else {
         *iter = std::make_unique<SegmentIterator>(this->shared_from_this(), schema);
@@ -221,10 +235,23 @@ Status Segment::new_iterator(SchemaSPtr schema, const StorageReadOptions& read_o
         !read_options.column_predicates.empty()) {
         auto pruned_predicates = read_options.column_predicates;
         auto pruned = false;
-        for (auto& it : _column_readers) {
-            const auto uid = it.first;
-            const auto column_id = read_options.tablet_schema->field_index(uid);
-            if (it.second->prune_predicates_by_zone_map(pruned_predicates, column_id)) {
+        std::set<int32_t> predicate_column_ids;
+        for (const auto* pred : read_options.column_predicates) {
+            predicate_column_ids.insert(pred->column_id());
+        }
+        for (auto column_id : predicate_column_ids) {
+            // schema change
+            if (read_options.tablet_schema->num_columns() <= column_id) {
+                continue;
+            }
+            const auto& col = read_options.tablet_schema->column(column_id);
+            if (col.is_extracted_column()) {
+                continue;
+            }
+            ColumnReader* reader = nullptr;
+            RETURN_IF_ERROR(_get_column_reader(col.unique_id(), &reader));
+            if (reader != nullptr &&
+                reader->prune_predicates_by_zone_map(pruned_predicates, column_id)) {
                 pruned = true;
             }
         }
@@ -408,11 +435,12 @@ Status Segment::_create_column_readers_once() {
     return _create_column_readers_once_call.call([&] {
         DCHECK(_footer_pb);
         Defer defer([&]() { _footer_pb.reset(); });
-        return _create_column_readers(*_footer_pb);
+        return _create_column_readers(_footer_pb.get());
     });
 }
 
-Status Segment::_create_column_readers(const SegmentFooterPB& footer) {
+Status Segment::_create_column_readers(SegmentFooterPB* footer_pb) {
+    const auto& footer = *footer_pb;
     std::unordered_map<uint32_t, uint32_t> column_id_to_footer_ordinal;
     std::unordered_map<vectorized::PathInData, uint32_t, vectorized::PathInData::Hash>
             column_path_to_footer_ordinal;
@@ -430,23 +458,6 @@ Status Segment::_create_column_readers(const SegmentFooterPB& footer) {
             column_id_to_footer_ordinal.emplace(column_pb.unique_id(), ordinal);
         }
     }
-    // init by unique_id
-    for (uint32_t ordinal = 0; ordinal < _tablet_schema->num_columns(); ++ordinal) {
-        auto& column = _tablet_schema->column(ordinal);
-        auto iter = column_id_to_footer_ordinal.find(column.unique_id());
-        if (iter == column_id_to_footer_ordinal.end()) {
-            continue;
-        }
-
-        ColumnReaderOptions opts {
-                .kept_in_memory = _tablet_schema->is_in_memory(),
-        };
-        std::unique_ptr<ColumnReader> reader;
-        RETURN_IF_ERROR(ColumnReader::create(opts, footer.columns(iter->second), footer.num_rows(),
-                                             _file_reader, &reader));
-        _column_readers.emplace(column.unique_id(), std::move(reader));
-    }
-
     // init by column path
     for (uint32_t ordinal = 0; ordinal < _tablet_schema->num_columns(); ++ordinal) {
         auto& column = _tablet_schema->column(ordinal);
@@ -486,6 +497,113 @@ Status Segment::_create_column_readers(const SegmentFooterPB& footer) {
         }
     }
 
+    // the readers of the columns by unique id are created at their first access, keep their
+    // metas until then
+    int64_t column_meta_bytes = 0;
+    for (uint32_t ordinal = 0; ordinal < _tablet_schema->num_columns(); ++ordinal) {
+        auto& column = _tablet_schema->column(ordinal);
+        auto iter = column_id_to_footer_ordinal.find(column.unique_id());
+        if (iter == column_id_to_footer_ordinal.end() || _column_metas.contains(iter->first)) {
+            continue;
+        }
+        auto meta = std::make_unique<ColumnMetaPB>();
+        // the footer is released after this, so the meta is moved out of it
+        meta->Swap(footer_pb->mutable_columns(iter->second));
+        column_meta_bytes += meta->ByteSizeLong();
+        _column_metas.emplace(iter->first, std::move(meta));
+    }
+    g_segment_column_meta_bytes << column_meta_bytes;
+
+    return Status::OK();
+}
+
+Status Segment::_can_answer_by_statistics(const Schema& schema,
+                                          const StorageReadOptions& read_options, bool* result) {
+    *result = false;
+    if (!read_options.key_ranges.empty() || !read_options.row_ranges.is_empty()) {
+        return Status::OK();
+    }
+    // the deleted rows are only subtracted from the count
+    auto delete_bitmap = read_options.delete_bitmap.find(id());
+    if (delete_bitmap != read_options.delete_bitmap.end() && delete_bitmap->second != nullptr &&
+        !delete_bitmap->second->isEmpty() &&
+        read_options.push_down_agg_type_opt != TPushAggOp::COUNT) {
+        return Status::OK();
+    }
+
+    // the runtime filters are only optimizations, the other predicates have to hold for every
+    // row of the segment by its zone maps
+    std::vector<ColumnPredicate*> predicates;
+    std::set<ColumnId> predicate_column_ids;
+    for (auto* pred : read_options.column_predicates) {
+        if (!pred->predicate_params()->marked_by_runtime_filter) {
+            predicates.push_back(pred);
+            predicate_column_ids.insert(pred->column_id());
+        }
+    }
+    for (auto column_id : predicate_column_ids) {
+        // schema change
+        if (read_options.tablet_schema->num_columns() <= column_id) {
+            return Status::OK();
+        }
+        const auto& col = read_options.tablet_schema->column(column_id);
+        if (col.is_extracted_column()) {
+            return Status::OK();
+        }
+        ColumnReader* reader = nullptr;
+        RETURN_IF_ERROR(_get_column_reader(col.unique_id(), &reader));
+        if (reader == nullptr) {
+            return Status::OK();
+        }
+        for (auto* pred : predicates) {
+            if (pred->column_id() == column_id &&
+                !can_apply_predicate_safely(column_id, pred, schema,
+                                            read_options.io_ctx.reader_type)) {
+                return Status::OK();
+            }
+        }
+        reader->prune_predicates_by_zone_map(predicates, column_id);
+    }
+    *result = predicates.empty();
+    return Status::OK();
+}
+
+Status Segment::_get_column_reader(int32_t unique_id, ColumnReader** reader) {
+    *reader = nullptr;
+    {
+        std::shared_lock lock(_column_readers_lock);
+        auto iter = _column_readers.find(unique_id);
+        if (iter != _column_readers.end()) {
+            *reader = iter->second.get();
+            return Status::OK();
+        }
+        if (!_column_metas.contains(unique_id)) {
+            return Status::OK();
+        }
+    }
+
+    std::lock_guard lock(_column_readers_lock);
+    // the reader may be created by another thread
+    auto iter = _column_readers.find(unique_id);
+    if (iter != _column_readers.end()) {
+        *reader = iter->second.get();
+        return Status::OK();
+    }
+    auto meta_iter = _column_metas.find(unique_id);
+    if (meta_iter == _column_metas.end()) {
+        return Status::OK();
+    }
+    ColumnReaderOptions opts {
+            .kept_in_memory = _tablet_schema->is_in_memory(),
+    };
+    std::unique_ptr<ColumnReader> column_reader;
+    RETURN_IF_ERROR(ColumnReader::create(opts, *meta_iter->second, _num_rows, _file_reader,
+                                         &column_reader));
+    g_segment_column_reader_num << 1;
+    g_segment_column_meta_bytes << -static_cast<int64_t>(meta_iter->second->ByteSizeLong());
+    _column_metas.erase(meta_iter);
+    *reader = column_reader.get();
+    _column_readers.emplace(unique_id, std::move(column_reader));
     return Status::OK();
 }
 
@@ -621,23 +739,23 @@ Status Segment::new_column_iterator(const TabletColumn& tablet_column,
     if (tablet_column.has_path_info() || tablet_column.is_variant_type()) {
         return new_column_iterator_with_path(tablet_column, iter, opt);
     }
+    ColumnReader* reader = nullptr;
+    RETURN_IF_ERROR(_get_column_reader(tablet_column.unique_id(), &reader));
     // init default iterator
-    if (_column_readers.count(tablet_column.unique_id()) < 1) {
+    if (reader == nullptr) {
         RETURN_IF_ERROR(new_default_iterator(tablet_column, iter));
         return Status::OK();
     }
     // init iterator by unique id
     ColumnIterator* it;
-    RETURN_IF_ERROR(_column_readers.at(tablet_column.unique_id())->new_iterator(&it));
+    RETURN_IF_ERROR(reader->new_iterator(&it));
     iter->reset(it);
 
-    if (config::enable_column_type_check &&
-        tablet_column.type() != _column_readers.at(tablet_column.unique_id())->get_meta_type()) {
+    if (config::enable_column_type_check && tablet_column.type() != reader->get_meta_type()) {
         LOG(WARNING) << "different type between schema and column reader,"
                      << " column schema name: " << tablet_column.name()
                      << " column schema type: " << int(tablet_column.type())
-                     << " column reader meta type"
-                     << int(_column_readers.at(tablet_column.unique_id())->get_meta_type());
+                     << " column reader meta type" << int(reader->get_meta_type());
         return Status::InternalError("different type between schema and column reader");
     }
     return Status::OK();
@@ -645,33 +763,38 @@ Status Segment::new_column_iterator(const TabletColumn& tablet_column,
 
 Status Segment::new_column_iterator(int32_t unique_id, std::unique_ptr<ColumnIterator>* iter) {
     RETURN_IF_ERROR(_create_column_readers_once());
+    ColumnReader* reader = nullptr;
+    RETURN_IF_ERROR(_get_column_reader(unique_id, &reader));
+    if (reader == nullptr) {
+        return Status::InternalError("column {} not found in segment {}", unique_id, _segment_id);
+    }
     ColumnIterator* it;
-    RETURN_IF_ERROR(_column_readers.at(unique_id)->new_iterator(&it));
+    RETURN_IF_ERROR(reader->new_iterator(&it));
     iter->reset(it);
     return Status::OK();
 }
 
-ColumnReader* Segment::_get_column_reader(const TabletColumn& col) {
+Status Segment::_get_column_reader(const TabletColumn& col, ColumnReader** reader) {
     // init column iterator by path info
     if (col.has_path_info() || col.is_variant_type()) {
         auto node =
                 col.has_path_info() ? _sub_column_tree.find_exact(*col.path_info_ptr()) : nullptr;
-        if (node != nullptr) {
-            return node->data.reader.get();
-        }
-        return nullptr;
-    }
-    auto col_unique_id = col.unique_id();
-    if (_column_readers.count(col_unique_id) > 0) {
-        return _column_readers[col_unique_id].get();
+        *reader = node != nullptr ? node->data.reader.get() : nullptr;
+        return Status::OK();
     }
-    return nullptr;
+    return _get_column_reader(col.unique_id(), reader);
+}
+
+Status Segment::get_column_reader(const TabletColumn& tablet_column, ColumnReader** reader) {
+    RETURN_IF_ERROR(_create_column_readers_once());
+    return _get_column_reader(tablet_column, reader);
 }
 
 Status Segment::new_bitmap_index_iterator(const TabletColumn& tablet_column,
                                           std::unique_ptr<BitmapIndexIterator>* iter) {
     RETURN_IF_ERROR(_create_column_readers_once());
-    ColumnReader* reader = _get_column_reader(tablet_column);
+    ColumnReader* reader = nullptr;
+    RETURN_IF_ERROR(_get_column_reader(tablet_column, &reader));
     if (reader != nullptr && reader->has_bitmap_index()) {
         BitmapIndexIterator* it;
         RETURN_IF_ERROR(reader->new_bitmap_index_iterator(&it));
@@ -686,7 +809,8 @@ Status Segment::new_inverted_index_iterator(const TabletColumn& tablet_column,
                                             const StorageReadOptions& read_options,
                                             std::unique_ptr<InvertedIndexIterator>* iter) {
     RETURN_IF_ERROR(_create_column_readers_once());
-    ColumnReader* reader = _get_column_reader(tablet_column);
+    ColumnReader* reader = nullptr;
+    RETURN_IF_ERROR(_get_column_reader(tablet_column, &reader));
     if (reader != nullptr && index_meta) {
         if (_inverted_index_file_reader == nullptr) {
             RETURN_IF_ERROR(
@@ -700,7 +824,8 @@ Status Segment::new_inverted_index_iterator(const TabletColumn& tablet_column,
 }
 
 Status Segment::lookup_row_key(const Slice& key, bool with_seq_col, bool with_rowid,
-                               RowLocation* row_location) {
+                               RowLocation* row_location,
+                               std::unique_ptr<segment_v2::IndexedColumnIterator>* index_iterator) {
     RETURN_IF_ERROR(load_pk_index_and_bf());
     bool has_seq_col = _tablet_schema->has_sequence_col();
     bool has_rowid = !_tablet_schema->cluster_key_idxes().empty();
@@ -719,16 +844,21 @@ Status Segment::lookup_row_key(const Slice& key, bool with_seq_col, bool with_ro
         return Status::Error<ErrorCode::KEY_NOT_FOUND>("Can't find key in the segment");
     }
     bool exact_match = false;
-    std::unique_ptr<segment_v2::IndexedColumnIterator> index_iterator;
-    RETURN_IF_ERROR(_pk_index_reader->new_iterator(&index_iterator));
-    auto st = index_iterator->seek_at_or_after(&key_without_seq, &exact_match);
+    std::unique_ptr<segment_v2::IndexedColumnIterator> local_iterator;
+    if (index_iterator == nullptr) {
+        index_iterator = &local_iterator;
+    }
+    if (*index_iterator == nullptr) {
+        RETURN_IF_ERROR(_pk_index_reader->new_iterator(index_iterator));
+    }
+    auto st = (*index_iterator)->seek_at_or_after(&key_without_seq, &exact_match);
     if (!st.ok() && !st.is<ErrorCode::ENTRY_NOT_FOUND>()) {
         return st;
     }
     if (st.is<ErrorCode::ENTRY_NOT_FOUND>() || (!has_seq_col && !has_rowid && !exact_match)) {
         return Status::Error<ErrorCode::KEY_NOT_FOUND>("Can't find key in the segment");
     }
-    row_location->row_id = index_iterator->get_current_ordinal();
+    row_location->row_id = (*index_iterator)->get_current_ordinal();
     row_location->segment_id = _segment_id;
     row_location->rowset_id = _rowset_id;
 
@@ -737,7 +867,7 @@ Status Segment::lookup_row_key(const Slice& key, bool with_seq_col, bool with_ro
             _pk_index_reader->type_info()->type(), 1, 0);
     auto index_column = index_type->create_column();
     size_t num_read = num_to_read;
-    RETURN_IF_ERROR(index_iterator->next_batch(&num_read, index_column));
+    RETURN_IF_ERROR((*index_iterator)->next_batch(&num_read, index_column));
     DCHECK(num_to_read == num_read);
 
     Slice sought_key = Slice(index_column->get_data_at(0).data, index_column->get_data_at(0).size);
@@ -834,6 +964,14 @@ Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescripto
                                        uint32_t row_id, vectorized::MutableColumnPtr& result,
                                        OlapReaderStatistics& stats,
                                        std::unique_ptr<ColumnIterator>& iterator_hint) {
+    return seek_and_read_by_rowids(schema, slot, &row_id, 1, result, stats, iterator_hint);
+}
+
+Status Segment::seek_and_read_by_rowids(const TabletSchema& schema, SlotDescriptor* slot,
+                                        const rowid_t* row_ids, size_t num_rows,
+                                        vectorized::MutableColumnPtr& result,
+                                        OlapReaderStatistics& stats,
+                                        std::unique_ptr<ColumnIterator>& iterator_hint) {
     StorageReadOptions storage_read_opt;
     storage_read_opt.io_ctx.reader_type = ReaderType::READER_QUERY;
     segment_v2::ColumnIteratorOptions opt {
@@ -842,7 +980,6 @@ Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescripto
             .stats = &stats,
             .io_ctx = io::IOContext {.reader_type = ReaderType::READER_QUERY},
     };
-    std::vector<segment_v2::rowid_t> single_row_loc {row_id};
     if (!slot->column_paths().empty()) {
         vectorized::PathInDataPtr path = std::make_shared<vectorized::PathInData>(
                 schema.column_by_uid(slot->col_unique_id()).name_lower_case(),
@@ -857,13 +994,14 @@ Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescripto
             RETURN_IF_ERROR(new_column_iterator(column, &iterator_hint, &storage_read_opt));
             RETURN_IF_ERROR(iterator_hint->init(opt));
         }
-        RETURN_IF_ERROR(
-                iterator_hint->read_by_rowids(single_row_loc.data(), 1, file_storage_column));
+        RETURN_IF_ERROR(iterator_hint->read_by_rowids(row_ids, num_rows, file_storage_column));
         // iterator_hint.reset(nullptr);
         // Get it's inner field, for JSONB case
-        vectorized::Field field = remove_nullable(storage_type)->get_default();
-        file_storage_column->get(0, field);
-        result->insert(field);
+        for (size_t i = 0; i < num_rows; ++i) {
+            vectorized::Field field = remove_nullable(storage_type)->get_default();
+            file_storage_column->get(i, field);
+            result->insert(field);
+        }
     } else {
         int index = (slot->col_unique_id() >= 0) ? schema.field_index(slot->col_unique_id())
                                                  : schema.field_index(slot->col_name());
@@ -879,7 +1017,7 @@ Status Segment::seek_and_read_by_rowid(const TabletSchema& schema, SlotDescripto
                     new_column_iterator(schema.column(index), &iterator_hint, &storage_read_opt));
             RETURN_IF_ERROR(iterator_hint->init(opt));
         }
-        RETURN_IF_ERROR(iterator_hint->read_by_rowids(single_row_loc.data(), 1, result));
+        RETURN_IF_ERROR(iterator_hint->read_by_rowids(row_ids, num_rows, result));
     }
     return Status::OK();
 }
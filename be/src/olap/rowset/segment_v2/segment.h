@@ -25,6 +25,7 @@
 #include <cstdint>
 #include <map>
 #include <memory> // for unique_ptr
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -64,6 +65,7 @@ struct RowLocation;
 namespace segment_v2 {
 
 class BitmapIndexIterator;
+class IndexedColumnIterator;
 class Segment;
 class InvertedIndexIterator;
 class InvertedIndexFileReader;
@@ -110,6 +112,9 @@ public:
 
     Status new_column_iterator(int32_t unique_id, std::unique_ptr<ColumnIterator>* iter);
 
+    // Get the reader of the column, which is null if this segment has no data of the column.
+    Status get_column_reader(const TabletColumn& tablet_column, ColumnReader** reader);
+
     Status new_bitmap_index_iterator(const TabletColumn& tablet_column,
                                      std::unique_ptr<BitmapIndexIterator>* iter);
 
@@ -128,14 +133,26 @@ public:
         return _pk_index_reader.get();
     }
 
+    // If `index_iterator` is given, the primary key index iterator is created by the first
+    // lookup and reused by the following ones. Keys looked up in ascending order then walk the
+    // index forwards, and each data page of the index is read and decoded only once.
     Status lookup_row_key(const Slice& key, bool with_seq_col, bool with_rowid,
-                          RowLocation* row_location);
+                          RowLocation* row_location,
+                          std::unique_ptr<segment_v2::IndexedColumnIterator>* index_iterator =
+                                  nullptr);
 
     Status read_key_by_rowid(uint32_t row_id, std::string* key);
 
     Status seek_and_read_by_rowid(const TabletSchema& schema, SlotDescriptor* slot, uint32_t row_id,
                                   vectorized::MutableColumnPtr& result, OlapReaderStatistics& stats,
                                   std::unique_ptr<ColumnIterator>& iterator_hint);
+    // Same as seek_and_read_by_rowid, but reads the rows of the ascending row_ids in one pass,
+    // so the rows in the same page of the column are decoded from the page once.
+    Status seek_and_read_by_rowids(const TabletSchema& schema, SlotDescriptor* slot,
+                                   const rowid_t* row_ids, size_t num_rows,
+                                   vectorized::MutableColumnPtr& result,
+                                   OlapReaderStatistics& stats,
+                                   std::unique_ptr<ColumnIterator>& iterator_hint);
 
     Status load_index();
 
@@ -199,9 +216,16 @@ private:
     // open segment file and read the minimum amount of necessary information (footer)
     Status _open();
     Status _parse_footer(SegmentFooterPB* footer);
-    Status _create_column_readers(const SegmentFooterPB& footer);
+    Status _create_column_readers(SegmentFooterPB* footer);
     Status _load_pk_bloom_filter();
-    ColumnReader* _get_column_reader(const TabletColumn& col);
+    Status _get_column_reader(const TabletColumn& col, ColumnReader** reader);
+    // Get the reader of a column by its unique id, and create it at the first access.
+    // The reader is nullptr if this segment has no data for the column.
+    Status _get_column_reader(int32_t unique_id, ColumnReader** reader);
+    // Whether the aggregation pushed down can be answered by the statistics of this segment,
+    // that is every predicate holds for all the rows of the segment by its zone maps.
+    Status _can_answer_by_statistics(const Schema& schema, const StorageReadOptions& read_options,
+                                     bool* result);
 
     // Get Iterator which will read variant root column and extract with paths and types info
     Status _new_iterator_with_variant_root(const TabletColumn& tablet_column,
@@ -235,10 +259,16 @@ private:
     PagePointerPB _sk_index_page;
 
     // map column unique id ---> column reader
-    // ColumnReader for each column in TabletSchema. If ColumnReader is nullptr,
-    // This means that this segment has no data for that column, which may be added
-    // after this segment is generated.
+    // ColumnReader for each column in TabletSchema which has been read. If there is no
+    // ColumnReader and no meta of a column, this segment has no data for that column,
+    // which may be added after this segment is generated.
     std::map<int32_t, std::unique_ptr<ColumnReader>> _column_readers;
+    // map column unique id ---> meta of the column whose reader has not been created yet,
+    // the meta is released when the reader is created. So the segments of a wide table only
+    // hold the readers of the columns which are queried.
+    std::unordered_map<int32_t, std::unique_ptr<ColumnMetaPB>> _column_metas;
+    // protect _column_readers and _column_metas
+    std::shared_mutex _column_readers_lock;
 
     // Init from ColumnMetaPB in SegmentFooterPB
     // map column unique id ---> it's inner data type
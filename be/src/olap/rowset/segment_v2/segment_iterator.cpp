@@ -18,6 +18,7 @@
 #include "olap/rowset/segment_v2/segment_iterator.h"
 
 #include <assert.h>
+#include <fmt/format.h>
 #include <gen_cpp/Exprs_types.h>
 #include <gen_cpp/Types_types.h>
 #include <gen_cpp/olap_file.pb.h>
@@ -25,6 +26,7 @@
 #include <algorithm>
 #include <boost/iterator/iterator_facade.hpp>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <set>
@@ -38,6 +40,7 @@
 #include "common/logging.h"
 #include "common/object_pool.h"
 #include "common/status.h"
+#include "io/fs/buffered_reader.h"
 #include "io/fs/file_reader.h"
 #include "io/io_common.h"
 #include "olap/bloom_filter_predicate.h"
@@ -69,6 +72,7 @@
 #include "util/doris_metrics.h"
 #include "util/key_util.h"
 #include "util/simd/bits.h"
+#include "util/time.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_const.h"
 #include "vec/columns/column_nullable.h"
@@ -389,6 +393,47 @@ Status SegmentIterator::_lazy_init() {
     } else {
         _range_iter.reset(new BitmapRangeIterator(_row_bitmap));
     }
+    RETURN_IF_ERROR(_init_read_ahead());
+    return Status::OK();
+}
+
+Status SegmentIterator::_init_read_ahead() {
+    // the merged reads go forward, so they do not help to read the rows backward
+    if (!config::enable_segment_read_ahead || _row_bitmap.isEmpty() ||
+        _opts.read_orderby_key_reverse || _segment->_fs->type() == io::FileSystemType::LOCAL) {
+        return Status::OK();
+    }
+
+    RowRanges row_ranges;
+    BitmapRangeIterator range_iter(_row_bitmap);
+    uint32_t from = 0;
+    uint32_t to = 0;
+    while (range_iter.next_range(std::numeric_limits<uint32_t>::max(), &from, &to)) {
+        row_ranges.add(RowRange(from, to));
+    }
+
+    std::vector<FileColumnIterator*> file_iterators;
+    std::vector<io::PrefetchRange> ranges;
+    for (auto cid : _schema->column_ids()) {
+        // the pages of the complex types are read by their sub iterators in a nested order
+        auto* iter = dynamic_cast<FileColumnIterator*>(_column_iterators[cid].get());
+        if (iter == nullptr) {
+            continue;
+        }
+        RETURN_IF_ERROR(iter->get_page_ranges(row_ranges, &ranges));
+        file_iterators.push_back(iter);
+    }
+    if (ranges.size() <= 1) {
+        return Status::OK();
+    }
+    std::sort(ranges.begin(), ranges.end(),
+              [](const auto& a, const auto& b) { return a.start_offset < b.start_offset; });
+
+    _read_ahead_file_reader =
+            std::make_shared<io::MergeRangeFileReader>(nullptr, _file_reader, ranges);
+    for (auto* iter : file_iterators) {
+        iter->set_file_reader(_read_ahead_file_reader.get());
+    }
     return Status::OK();
 }
 
@@ -1635,6 +1680,13 @@ Status SegmentIterator::_vec_init_lazy_materialization() {
         _vec_pred_column_ids.assign(vec_pred_col_id_set.cbegin(), vec_pred_col_id_set.cend());
         _short_cir_pred_column_ids.assign(short_cir_pred_col_id_set.cbegin(),
                                           short_cir_pred_col_id_set.cend());
+
+        if (_short_cir_eval_predicate.size() > 1 &&
+            config::segment_iterator_predicate_sample_batches > 0) {
+            for (auto* predicate : _short_cir_eval_predicate) {
+                _short_cir_pred_costs.push_back({.predicate = predicate});
+            }
+        }
     }
 
     if (!_vec_pred_column_ids.empty()) {
@@ -1935,6 +1987,17 @@ Status SegmentIterator::_read_columns_by_index(uint32_t nrows_read_limit, uint32
     nrows_read = _range_iter->read_batch_rowids(_block_rowids.data(), nrows_read_limit);
     bool is_continuous = (nrows_read > 1) &&
                          (_block_rowids[nrows_read - 1] - _block_rowids[0] == nrows_read - 1);
+    // The scattered rows, which are dense enough, are cheaper to decode with the rows between
+    // them sequentially and to filter than to seek to each run of rows.
+    size_t dense_rows = nrows_read > 1 ? _block_rowids[nrows_read - 1] - _block_rowids[0] + 1 : 0;
+    bool is_dense = !is_continuous && nrows_read > 1 &&
+                    nrows_read >= dense_rows * config::segment_read_dense_rows_min_ratio;
+    if (is_dense) {
+        _dense_rows_filter.resize_fill(dense_rows, 0);
+        for (uint32_t i = 0; i < nrows_read; ++i) {
+            _dense_rows_filter[_block_rowids[i] - _block_rowids[0]] = 1;
+        }
+    }
 
     for (auto cid : _first_read_column_ids) {
         auto& column = _current_return_columns[cid];
@@ -1945,7 +2008,18 @@ Status SegmentIterator::_read_columns_by_index(uint32_t nrows_read_limit, uint32
             continue;
         }
 
-        if (is_continuous) {
+        // the predicate columns can not be filtered
+        if (is_dense && !_is_pred_column[cid] && column->empty()) {
+            size_t rows_read = dense_rows;
+            _opts.stats->block_first_read_seek_num += 1;
+            RETURN_IF_ERROR(_column_iterators[cid]->seek_to_ordinal(_block_rowids[0]));
+            RETURN_IF_ERROR(_column_iterators[cid]->next_batch(&rows_read, column));
+            if (rows_read != dense_rows) {
+                return Status::Error<ErrorCode::INTERNAL_ERROR>("nrows({}) != rows_read({})",
+                                                                dense_rows, rows_read);
+            }
+            column->filter(_dense_rows_filter);
+        } else if (is_continuous) {
             size_t rows_read = nrows_read;
             _opts.stats->block_first_read_seek_num += 1;
             if (_opts.runtime_state && _opts.runtime_state->enable_profile()) {
@@ -2104,10 +2178,15 @@ uint16_t SegmentIterator::_evaluate_short_circuit_predicate(uint16_t* vec_sel_ro
     }
 
     uint16_t original_size = selected_size;
-    for (auto* predicate : _short_cir_eval_predicate) {
-        auto column_id = predicate->column_id();
-        auto& short_cir_column = _current_return_columns[column_id];
-        selected_size = predicate->evaluate(*short_cir_column, vec_sel_rowid_idx, selected_size);
+    if (!_short_cir_pred_costs.empty() && !_short_cir_pred_order_decided) {
+        selected_size = _sample_short_circuit_predicate(vec_sel_rowid_idx, selected_size);
+    } else {
+        for (auto* predicate : _short_cir_eval_predicate) {
+            auto column_id = predicate->column_id();
+            auto& short_cir_column = _current_return_columns[column_id];
+            selected_size =
+                    predicate->evaluate(*short_cir_column, vec_sel_rowid_idx, selected_size);
+        }
     }
 
     // collect profile
@@ -2125,6 +2204,55 @@ uint16_t SegmentIterator::_evaluate_short_circuit_predicate(uint16_t* vec_sel_ro
     return selected_size;
 }
 
+uint16_t SegmentIterator::_sample_short_circuit_predicate(uint16_t* sel_rowid_idx,
+                                                         uint16_t selected_size) {
+    for (auto& cost : _short_cir_pred_costs) {
+        auto& short_cir_column = _current_return_columns[cost.predicate->column_id()];
+        uint16_t input_size = selected_size;
+        int64_t start = MonotonicNanos();
+        selected_size = cost.predicate->evaluate(*short_cir_column, sel_rowid_idx, selected_size);
+        cost.cost_ns += MonotonicNanos() - start;
+        cost.input_rows += input_size;
+        cost.passed_rows += selected_size;
+    }
+    if (++_short_cir_pred_sampled_batches >= config::segment_iterator_predicate_sample_batches) {
+        _reorder_short_circuit_predicates();
+    }
+    return selected_size;
+}
+
+double SegmentIterator::PredicateCost::rank() const {
+    if (input_rows == 0) {
+        // never evaluated since the predicates before filtered all rows, keep it at the end
+        return std::numeric_limits<double>::max();
+    }
+    // The cost per input row divided by the filtered ratio is the cost to filter a row, the
+    // predicates which filter almost nothing go to the end however cheap they are.
+    double filtered_ratio = 1 - double(passed_rows) / input_rows;
+    return double(cost_ns) / input_rows / std::max(filtered_ratio, 0.001);
+}
+
+std::string SegmentIterator::PredicateCost::debug_string() const {
+    return fmt::format("{}, input_rows={}, passed_rows={}, cost_ns={}", predicate->debug_string(),
+                       input_rows, passed_rows, cost_ns);
+}
+
+void SegmentIterator::_reorder_short_circuit_predicates() {
+    _short_cir_pred_order_decided = true;
+    // The selectivity of a predicate is measured on the rows passed by the predicates before
+    // it, which assumes the predicates are independent.
+    std::stable_sort(_short_cir_pred_costs.begin(), _short_cir_pred_costs.end(),
+                     [](const auto& lhs, const auto& rhs) { return lhs.rank() < rhs.rank(); });
+    bool reordered = false;
+    for (size_t i = 0; i < _short_cir_pred_costs.size(); ++i) {
+        reordered |= _short_cir_eval_predicate[i] != _short_cir_pred_costs[i].predicate;
+        _short_cir_eval_predicate[i] = _short_cir_pred_costs[i].predicate;
+    }
+    if (reordered) {
+        _opts.stats->short_circuit_predicates_reordered++;
+    }
+}
+
 Status SegmentIterator::_read_columns_by_rowids(std::vector<ColumnId>& read_column_ids,
                                                 std::vector<rowid_t>& rowid_vector,
                                                 uint16_t* sel_rowid_idx, size_t select_size,
@@ -130,6 +130,17 @@ public:
         bool updated = false;
         updated |= _update_profile(profile, _short_cir_eval_predicate, "ShortCircuitPredicates");
         updated |= _update_profile(profile, _pre_eval_block_predicate, "PreEvaluatePredicates");
+        if (!_short_cir_pred_costs.empty()) {
+            // keep updating the profile until the order of the predicates is decided
+            if (!_short_cir_pred_order_decided) {
+                return false;
+            }
+            std::string info;
+            for (const auto& cost : _short_cir_pred_costs) {
+                info += "\n" + cost.debug_string();
+            }
+            profile->add_info_string("ShortCircuitPredicatesOrder", info);
+        }
 
         if (_opts.delete_condition_predicates != nullptr) {
             std::set<const ColumnPredicate*> delete_predicate_set;
@@ -158,6 +169,8 @@ private:
     }
 
     [[nodiscard]] Status _lazy_init();
+    // plan the data pages to read for the row ranges and merge the small reads of them
+    [[nodiscard]] Status _init_read_ahead();
     [[nodiscard]] Status _init_impl(const StorageReadOptions& opts);
     [[nodiscard]] Status _init_return_column_iterators();
     [[nodiscard]] Status _init_bitmap_index_iterators();
@@ -223,6 +236,8 @@ private:
                                std::vector<vectorized::MutableColumnPtr>& non_pred_vector);
     uint16_t _evaluate_vectorization_predicate(uint16_t* sel_rowid_idx, uint16_t selected_size);
     uint16_t _evaluate_short_circuit_predicate(uint16_t* sel_rowid_idx, uint16_t selected_size);
+    uint16_t _sample_short_circuit_predicate(uint16_t* sel_rowid_idx, uint16_t selected_size);
+    void _reorder_short_circuit_predicates();
     void _output_non_pred_columns(vectorized::Block* block);
     [[nodiscard]] Status _read_columns_by_rowids(std::vector<ColumnId>& read_column_ids,
                                                  std::vector<rowid_t>& rowid_vector,
@@ -418,6 +433,9 @@ private:
     // remember the rowids we've read for the current row block.
     // could be a local variable of next_batch(), kept here to reuse vector memory
     std::vector<rowid_t> _block_rowids;
+    // the rows of _block_rowids among all the rows from the first to the last one, to filter a
+    // column read sequentially, see _read_columns_by_index
+    vectorized::IColumn::Filter _dense_rows_filter;
     bool _is_need_vec_eval = false;
     bool _is_need_short_eval = false;
     bool _is_need_expr_eval = false;
@@ -433,6 +451,21 @@ private:
     vectorized::MutableColumns _current_return_columns;
     std::vector<ColumnPredicate*> _pre_eval_block_predicate;
     std::vector<ColumnPredicate*> _short_cir_eval_predicate;
+    // The cost of each short circuit predicate measured over the first
+    // segment_iterator_predicate_sample_batches batches, then the predicates are evaluated in
+    // the order of the cost per filtered row, the cheap and selective ones first.
+    struct PredicateCost {
+        ColumnPredicate* predicate = nullptr;
+        uint64_t input_rows = 0;
+        uint64_t passed_rows = 0;
+        int64_t cost_ns = 0;
+
+        double rank() const;
+        std::string debug_string() const;
+    };
+    std::vector<PredicateCost> _short_cir_pred_costs;
+    int _short_cir_pred_sampled_batches = 0;
+    bool _short_cir_pred_order_decided = false;
     std::vector<uint32_t> _delete_range_column_ids;
     std::vector<uint32_t> _delete_bloom_filter_column_ids;
     // when lazy materialization is enabled, segmentIter need to read data at least twice
@@ -473,6 +506,8 @@ private:
     vectorized::MutableColumns _short_key;
 
     io::FileReaderSPtr _file_reader;
+    // wraps _file_reader to merge the reads of the planned data pages on remote storage
+    io::FileReaderSPtr _read_ahead_file_reader;
 
     // char_type or array<char> type columns cid
     std::vector<size_t> _char_type_idx;
@@ -50,6 +50,7 @@
 #include "olap/rowset/segment_v2/inverted_index_writer.h"
 #include "olap/rowset/segment_v2/page_io.h"
 #include "olap/rowset/segment_v2/page_pointer.h"
+#include "olap/rowset/segment_v2/segment.h"
 #include "olap/segment_loader.h"
 #include "olap/short_key_index.h"
 #include "olap/storage_engine.h"
@@ -62,6 +63,7 @@
 #include "util/crc32c.h"
 #include "util/faststring.h"
 #include "util/key_util.h"
+#include "util/threadpool.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/columns_number.h"
 #include "vec/common/schema_util.h"
@@ -202,7 +204,10 @@ Status SegmentWriter::init(const std::vector<uint32_t>& col_ids, bool has_key) {
         // now we create zone map for key columns in AGG_KEYS or all column in UNIQUE_KEYS or DUP_KEYS
         // except for columns whose type don't support zone map.
         opts.need_zone_map = column.is_key() || _tablet_schema->keys_type() != KeysType::AGG_KEYS;
-        opts.need_bloom_filter = column.is_bf_column();
+        opts.need_bloom_filter =
+                column.is_bf_column() ||
+                (_opts.rowset_ctx != nullptr &&
+                 _opts.rowset_ctx->auto_bloom_filter_columns.contains(column.unique_id()));
         auto* tablet_index = _tablet_schema->get_ngram_bf_index(column.unique_id());
         if (tablet_index) {
             opts.need_bloom_filter = true;
@@ -450,6 +455,8 @@ Status SegmentWriter::append_block_with_partial_content(const vectorized::Block*
         }
     }
     std::vector<std::unique_ptr<SegmentCacheHandle>> segment_caches(specified_rowsets.size());
+    // rows of the block are sorted by key, keep the index iterators between the lookups
+    PkIndexIterators index_iterators(specified_rowsets.size());
 
     // locate rows in base data
     int64_t num_rows_updated = 0;
@@ -485,7 +492,8 @@ Status SegmentWriter::append_block_with_partial_content(const vectorized::Block*
         // save rowset shared ptr so this rowset wouldn't delete
         RowsetSharedPtr rowset;
         auto st = tablet->lookup_row_key(key, have_input_seq_column, specified_rowsets, &loc,
-                                         _mow_context->max_version, segment_caches, &rowset);
+                                         _mow_context->max_version, segment_caches, &rowset,
+                                         true, &index_iterators);
         if (st.is<KEY_NOT_FOUND>()) {
             if (_opts.rowset_ctx->partial_update_info->is_strict_mode) {
                 ++num_rows_filtered;
@@ -810,21 +818,45 @@ Status SegmentWriter::append_block(const vectorized::Block* block, size_t row_po
     // convert column data from engine format to storage layer format
     std::vector<vectorized::IOlapColumnDataAccessor*> key_columns;
     vectorized::IOlapColumnDataAccessor* seq_column = nullptr;
-    for (size_t id = 0; id < _column_writers.size(); ++id) {
-        // olap data convertor alway start from id = 0
-        auto converted_result = _olap_data_convertor->convert_column_data(id);
-        if (!converted_result.first.ok()) {
-            return converted_result.first;
+    std::vector<vectorized::IOlapColumnDataAccessor*> columns(_column_writers.size());
+    auto* encode_pool = ExecEnv::GetInstance()->segment_encode_thread_pool();
+    if (encode_pool != nullptr && config::segment_parallel_encode_min_columns > 0 &&
+        _column_writers.size() >= config::segment_parallel_encode_min_columns) {
+        // each column has its own convertor and writer, and the pages of a writer stay in
+        // memory until write_data, so the columns are converted and encoded independently
+        std::vector<Status> statuses(_column_writers.size());
+        run_tasks_with_caller(encode_pool, _column_writers.size(), [&](size_t id) {
+            auto converted_result = _olap_data_convertor->convert_column_data(id);
+            statuses[id] = converted_result.first;
+            if (statuses[id].ok()) {
+                columns[id] = converted_result.second;
+                statuses[id] = _column_writers[id]->append(columns[id]->get_nullmap(),
+                                                           columns[id]->get_data(), num_rows);
+            }
+        });
+        for (const auto& st : statuses) {
+            RETURN_IF_ERROR(st);
         }
+    } else {
+        for (size_t id = 0; id < _column_writers.size(); ++id) {
+            // olap data convertor alway start from id = 0
+            auto converted_result = _olap_data_convertor->convert_column_data(id);
+            if (!converted_result.first.ok()) {
+                return converted_result.first;
+            }
+            columns[id] = converted_result.second;
+            RETURN_IF_ERROR(_column_writers[id]->append(columns[id]->get_nullmap(),
+                                                        columns[id]->get_data(), num_rows));
+        }
+    }
+    for (size_t id = 0; id < _column_writers.size(); ++id) {
         auto cid = _column_ids[id];
         if (_has_key && cid < _tablet_schema->num_key_columns()) {
-            key_columns.push_back(converted_result.second);
+            key_columns.push_back(columns[id]);
         } else if (_has_key && _tablet_schema->has_sequence_col() &&
                    cid == _tablet_schema->sequence_col_idx()) {
-            seq_column = converted_result.second;
+            seq_column = columns[id];
         }
-        RETURN_IF_ERROR(_column_writers[id]->append(converted_result.second->get_nullmap(),
-                                                    converted_result.second->get_data(), num_rows));
     }
     if (_has_key) {
         // for now we don't need to query short key index for CLUSTER BY feature,
@@ -1071,6 +1103,62 @@ Status SegmentWriter::finalize_columns_index(uint64_t* index_size) {
     return Status::OK();
 }
 
+Status SegmentWriter::create_column_group_writer(const std::vector<uint32_t>& col_ids,
+                                                 std::unique_ptr<SegmentWriter>* writer) {
+    // the inverted index file of the segment can not be shared by the group writers
+    DCHECK(!_tablet_schema->has_inverted_index());
+    *writer = std::make_unique<SegmentWriter>(_file_writer, _segment_id, _tablet_schema, _tablet,
+                                              _data_dir, _max_row_per_segment, _opts, nullptr);
+    return (*writer)->init(col_ids, false);
+}
+
+Status SegmentWriter::finalize_column_group(SegmentWriter* group_writer, uint64_t* index_size) {
+    DCHECK(!group_writer->_has_key);
+    DCHECK_EQ(group_writer->_file_writer, _file_writer);
+    group_writer->_row_count = _row_count;
+    RETURN_IF_ERROR(group_writer->finalize_columns_data());
+    RETURN_IF_ERROR(group_writer->finalize_columns_index(index_size));
+    for (auto& meta : *group_writer->_footer.mutable_columns()) {
+        _footer.add_columns()->Swap(&meta);
+    }
+    group_writer->_footer.clear_columns();
+    return Status::OK();
+}
+
+Status SegmentWriter::append_column_pages(Segment* segment) {
+    DCHECK(!_has_key);
+    OlapReaderStatistics stats;
+    io::IOContext io_ctx {.reader_type = ReaderType::READER_CUMULATIVE_COMPACTION};
+    for (size_t i = 0; i < _column_writers.size(); ++i) {
+        const auto& column = _tablet_schema->column(_column_ids[i]);
+        auto* writer = dynamic_cast<ScalarColumnWriter*>(_column_writers[i].get());
+        ColumnReader* reader = nullptr;
+        RETURN_IF_ERROR(segment->get_column_reader(column, &reader));
+        if (writer == nullptr || reader == nullptr) {
+            return Status::NotSupported("can not copy the pages of column {} of segment {}",
+                                        column.name(), segment->id());
+        }
+        EncodingTypePB encoding = reader->encoding_info()->encoding();
+        CompressionTypePB compression = reader->get_compression();
+        RETURN_IF_ERROR(reader->read_raw_data_pages(
+                &stats, io_ctx,
+                [&](OwnedSlice&& body, const PageFooterPB& footer, const ZoneMapPB* zone_map) {
+                    return writer->append_raw_page(encoding, compression, std::move(body),
+                                                   footer, zone_map);
+                }));
+        if (reader->segment_zone_map() != nullptr) {
+            RETURN_IF_ERROR(writer->merge_segment_zone_map(*reader->segment_zone_map()));
+        }
+        if (writer->get_next_rowid() != _num_rows_written + segment->num_rows()) {
+            return Status::Corruption("column {} of segment {} has {} rows, not {}", column.name(),
+                                      segment->id(), writer->get_next_rowid() - _num_rows_written,
+                                      segment->num_rows());
+        }
+    }
+    _num_rows_written += segment->num_rows();
+    return Status::OK();
+}
+
 Status SegmentWriter::finalize_footer(uint64_t* segment_file_size) {
     RETURN_IF_ERROR(_write_footer());
     // finish
@@ -1240,6 +1328,18 @@ void SegmentWriter::set_min_max_key(const Slice& key) {
     }
 }
 
+void SegmentWriter::extend_min_max_key(const Slice& key) {
+    if (UNLIKELY(_is_first_row) || key.compare(_min_key) < 0) {
+        _min_key.clear();
+        _min_key.append(key.get_data(), key.get_size());
+        _is_first_row = false;
+    }
+    if (key.compare(_max_key) > 0) {
+        _max_key.clear();
+        _max_key.append(key.get_data(), key.get_size());
+    }
+}
+
 void SegmentWriter::set_min_key(const Slice& key) {
     if (UNLIKELY(_is_first_row)) {
         _min_key.append(key.get_data(), key.get_size());
@@ -1305,8 +1405,15 @@ Status SegmentWriter::_generate_short_key_index(
         std::vector<vectorized::IOlapColumnDataAccessor*>& key_columns, size_t num_rows,
         const std::vector<size_t>& short_key_pos) {
     // use _key_coders
-    set_min_key(_full_encode_keys(key_columns, 0));
-    set_max_key(_full_encode_keys(key_columns, num_rows - 1));
+    if (_tablet_schema->sort_type() == SortType::ZORDER) {
+        // the rows sorted by z-order are not in the order of the keys
+        for (size_t pos = 0; pos < num_rows; ++pos) {
+            extend_min_max_key(_full_encode_keys(key_columns, pos));
+        }
+    } else {
+        set_min_key(_full_encode_keys(key_columns, 0));
+        set_max_key(_full_encode_keys(key_columns, num_rows - 1));
+    }
 
     key_columns.resize(_num_short_key_columns);
     for (const auto pos : short_key_pos) {
@@ -65,6 +65,7 @@ class FileWriter;
 
 namespace segment_v2 {
 class InvertedIndexFileWriter;
+class Segment;
 
 extern const char* k_segment_magic;
 extern const uint32_t k_segment_magic_length;
@@ -124,6 +125,20 @@ public:
     Status finalize_columns_index(uint64_t* index_size);
     Status finalize_footer(uint64_t* segment_file_size);
 
+    // for vertical compaction of value column groups in parallel.
+    // Create a writer of the value columns col_ids of this segment, which is appended to
+    // independently of this writer and of the writers of other groups.
+    Status create_column_group_writer(const std::vector<uint32_t>& col_ids,
+                                      std::unique_ptr<SegmentWriter>* writer);
+    // Write the data and the indexes of the columns of group_writer to the file after the
+    // key columns are finalized, and add the column metas to the footer. The groups are
+    // finalized one after another.
+    Status finalize_column_group(SegmentWriter* group_writer, uint64_t* index_size);
+
+    // for page copy compaction: append the data pages of the value columns of this writer in
+    // `segment' as they are stored, without decoding them, after the rows already written.
+    Status append_column_pages(Segment* segment);
+
     void init_column_meta(ColumnMetaPB* meta, uint32_t column_id, const TabletColumn& column,
                           TabletSchemaSPtr tablet_schema);
     Slice min_encoded_key();
@@ -171,6 +186,8 @@ private:
                             string* encoded_keys);
     void _encode_rowid(const uint32_t rowid, string* encoded_keys);
     void set_min_max_key(const Slice& key);
+    // update the min and max key by a key of the rows not in key order
+    void extend_min_max_key(const Slice& key);
     void set_min_key(const Slice& key);
     void set_max_key(const Slice& key);
     bool _should_create_writers_with_dynamic_block(size_t num_columns_in_block);
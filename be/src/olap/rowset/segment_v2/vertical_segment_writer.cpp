@@ -59,6 +59,7 @@
 #include "util/crc32c.h"
 #include "util/faststring.h"
 #include "util/key_util.h"
+#include "util/threadpool.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/column_vector.h"
 #include "vec/columns/columns_number.h"
@@ -155,7 +156,10 @@ Status VerticalSegmentWriter::_create_column_writer(uint32_t cid, const TabletCo
     // now we create zone map for key columns in AGG_KEYS or all column in UNIQUE_KEYS or DUP_KEYS
     // except for columns whose type don't support zone map.
     opts.need_zone_map = column.is_key() || _tablet_schema->keys_type() != KeysType::AGG_KEYS;
-    opts.need_bloom_filter = column.is_bf_column();
+    opts.need_bloom_filter =
+            column.is_bf_column() ||
+            (_opts.rowset_ctx != nullptr &&
+             _opts.rowset_ctx->auto_bloom_filter_columns.contains(column.unique_id()));
     auto* tablet_index = _tablet_schema->get_ngram_bf_index(column.unique_id());
     if (tablet_index) {
         opts.need_bloom_filter = true;
@@ -386,6 +390,8 @@ Status VerticalSegmentWriter::_append_block_with_partial_content(RowsInBlock& da
         }
     }
     std::vector<std::unique_ptr<SegmentCacheHandle>> segment_caches(specified_rowsets.size());
+    // rows of the block are sorted by key, keep the index iterators between the lookups
+    PkIndexIterators index_iterators(specified_rowsets.size());
 
     // locate rows in base data
     int64_t num_rows_updated = 0;
@@ -421,7 +427,8 @@ Status VerticalSegmentWriter::_append_block_with_partial_content(RowsInBlock& da
         // save rowset shared ptr so this rowset wouldn't delete
         RowsetSharedPtr rowset;
         auto st = tablet->lookup_row_key(key, have_input_seq_column, specified_rowsets, &loc,
-                                         _mow_context->max_version, segment_caches, &rowset);
+                                         _mow_context->max_version, segment_caches, &rowset,
+                                         true, &index_iterators);
         if (st.is<KEY_NOT_FOUND>()) {
             if (_opts.rowset_ctx->partial_update_info->is_strict_mode) {
                 ++num_rows_filtered;
@@ -751,34 +758,42 @@ Status VerticalSegmentWriter::write_batch() {
 
     std::vector<vectorized::IOlapColumnDataAccessor*> key_columns;
     vectorized::IOlapColumnDataAccessor* seq_column = nullptr;
-    for (uint32_t cid = 0; cid < _tablet_schema->num_columns(); ++cid) {
-        RETURN_IF_ERROR(_create_column_writer(cid, _tablet_schema->column(cid)));
-        for (auto& data : _batched_blocks) {
-            RETURN_IF_ERROR(_olap_data_convertor->set_source_content_with_specifid_columns(
-                    data.block, data.row_pos, data.num_rows, std::vector<uint32_t> {cid}));
-
-            // convert column data from engine format to storage layer format
-            auto [status, column] = _olap_data_convertor->convert_column_data(cid);
-            if (!status.ok()) {
-                return status;
+    auto* encode_pool = ExecEnv::GetInstance()->segment_encode_thread_pool();
+    bool parallel_encode =
+            encode_pool != nullptr && config::segment_parallel_encode_min_columns > 0 &&
+            _tablet_schema->num_columns() >= config::segment_parallel_encode_min_columns;
+    if (parallel_encode) {
+        RETURN_IF_ERROR(_write_columns_in_parallel(encode_pool, &key_columns, &seq_column));
+    } else {
+        for (uint32_t cid = 0; cid < _tablet_schema->num_columns(); ++cid) {
+            RETURN_IF_ERROR(_create_column_writer(cid, _tablet_schema->column(cid)));
+            for (auto& data : _batched_blocks) {
+                RETURN_IF_ERROR(_olap_data_convertor->set_source_content_with_specifid_columns(
+                        data.block, data.row_pos, data.num_rows, std::vector<uint32_t> {cid}));
+
+                // convert column data from engine format to storage layer format
+                auto [status, column] = _olap_data_convertor->convert_column_data(cid);
+                if (!status.ok()) {
+                    return status;
+                }
+                if (cid < _num_key_columns) {
+                    key_columns.push_back(column);
+                } else if (_tablet_schema->has_sequence_col() &&
+                           cid == _tablet_schema->sequence_col_idx()) {
+                    seq_column = column;
+                }
+                RETURN_IF_ERROR(_column_writers[cid]->append(column->get_nullmap(),
+                                                             column->get_data(), data.num_rows));
+                _olap_data_convertor->clear_source_content();
             }
-            if (cid < _num_key_columns) {
-                key_columns.push_back(column);
-            } else if (_tablet_schema->has_sequence_col() &&
-                       cid == _tablet_schema->sequence_col_idx()) {
-                seq_column = column;
+            if (_data_dir != nullptr &&
+                _data_dir->reach_capacity_limit(_column_writers[cid]->estimate_buffer_size())) {
+                return Status::Error<DISK_REACH_CAPACITY_LIMIT>("disk {} exceed capacity limit.",
+                                                                _data_dir->path_hash());
             }
-            RETURN_IF_ERROR(_column_writers[cid]->append(column->get_nullmap(), column->get_data(),
-                                                         data.num_rows));
-            _olap_data_convertor->clear_source_content();
+            RETURN_IF_ERROR(_column_writers[cid]->finish());
+            RETURN_IF_ERROR(_column_writers[cid]->write_data());
         }
-        if (_data_dir != nullptr &&
-            _data_dir->reach_capacity_limit(_column_writers[cid]->estimate_buffer_size())) {
-            return Status::Error<DISK_REACH_CAPACITY_LIMIT>("disk {} exceed capacity limit.",
-                                                            _data_dir->path_hash());
-        }
-        RETURN_IF_ERROR(_column_writers[cid]->finish());
-        RETURN_IF_ERROR(_column_writers[cid]->write_data());
     }
 
     for (auto& data : _batched_blocks) {
@@ -813,8 +828,15 @@ Status VerticalSegmentWriter::write_batch() {
         } else {
             // create short key indexes'
             // for min_max key
-            _set_min_key(_full_encode_keys(key_columns, 0));
-            _set_max_key(_full_encode_keys(key_columns, data.num_rows - 1));
+            if (_tablet_schema->sort_type() == SortType::ZORDER) {
+                // the rows sorted by z-order are not in the order of the keys
+                for (size_t pos = 0; pos < data.num_rows; ++pos) {
+                    _extend_min_max_key(_full_encode_keys(key_columns, pos));
+                }
+            } else {
+                _set_min_key(_full_encode_keys(key_columns, 0));
+                _set_max_key(_full_encode_keys(key_columns, data.num_rows - 1));
+            }
 
             key_columns.resize(_num_short_key_columns);
             for (const auto pos : short_key_pos) {
@@ -829,6 +851,58 @@ Status VerticalSegmentWriter::write_batch() {
     return Status::OK();
 }
 
+Status VerticalSegmentWriter::_write_columns_in_parallel(
+        ThreadPool* pool, std::vector<vectorized::IOlapColumnDataAccessor*>* key_columns,
+        vectorized::IOlapColumnDataAccessor** seq_column) {
+    // column writers and convertors are added in column order
+    uint32_t num_columns = _tablet_schema->num_columns();
+    for (uint32_t cid = 0; cid < num_columns; ++cid) {
+        RETURN_IF_ERROR(_create_column_writer(cid, _tablet_schema->column(cid)));
+    }
+
+    // Each column has its own convertor and writer, and the pages of a writer stay in memory
+    // until write_data, so the columns don't share any state here.
+    std::vector<Status> statuses(num_columns);
+    std::vector<vectorized::IOlapColumnDataAccessor*> columns(num_columns);
+    run_tasks_with_caller(pool, num_columns, [&](size_t cid) {
+        statuses[cid] = [&]() -> Status {
+            for (auto& data : _batched_blocks) {
+                RETURN_IF_ERROR(_olap_data_convertor->set_source_content_with_specifid_columns(
+                        data.block, data.row_pos, data.num_rows,
+                        std::vector<uint32_t> {static_cast<uint32_t>(cid)}));
+                auto [status, column] = _olap_data_convertor->convert_column_data(cid);
+                if (!status.ok()) {
+                    return status;
+                }
+                columns[cid] = column;
+                RETURN_IF_ERROR(_column_writers[cid]->append(
+                        column->get_nullmap(), column->get_data(), data.num_rows));
+                _olap_data_convertor->clear_source_content(cid);
+            }
+            return _column_writers[cid]->finish();
+        }();
+    });
+
+    for (uint32_t cid = 0; cid < num_columns; ++cid) {
+        RETURN_IF_ERROR(statuses[cid]);
+        for (size_t i = 0; i < _batched_blocks.size(); ++i) {
+            if (cid < _num_key_columns) {
+                key_columns->push_back(columns[cid]);
+            } else if (_tablet_schema->has_sequence_col() &&
+                       cid == _tablet_schema->sequence_col_idx()) {
+                *seq_column = columns[cid];
+            }
+        }
+        if (_data_dir != nullptr &&
+            _data_dir->reach_capacity_limit(_column_writers[cid]->estimate_buffer_size())) {
+            return Status::Error<DISK_REACH_CAPACITY_LIMIT>("disk {} exceed capacity limit.",
+                                                            _data_dir->path_hash());
+        }
+        RETURN_IF_ERROR(_column_writers[cid]->write_data());
+    }
+    return Status::OK();
+}
+
 std::string VerticalSegmentWriter::_full_encode_keys(
         const std::vector<vectorized::IOlapColumnDataAccessor*>& key_columns, size_t pos) {
     assert(_key_index_size.size() == _num_key_columns);
@@ -1079,6 +1153,18 @@ void VerticalSegmentWriter::_set_min_max_key(const Slice& key) {
     }
 }
 
+void VerticalSegmentWriter::_extend_min_max_key(const Slice& key) {
+    if (UNLIKELY(_is_first_row) || key.compare(_min_key) < 0) {
+        _min_key.clear();
+        _min_key.append(key.get_data(), key.get_size());
+        _is_first_row = false;
+    }
+    if (key.compare(_max_key) > 0) {
+        _max_key.clear();
+        _max_key.append(key.get_data(), key.get_size());
+    }
+}
+
 void VerticalSegmentWriter::_set_min_key(const Slice& key) {
     if (UNLIKELY(_is_first_row)) {
         _min_key.append(key.get_data(), key.get_size());
@@ -52,6 +52,7 @@ class ShortKeyIndexBuilder;
 class PrimaryKeyIndexBuilder;
 class KeyCoder;
 struct RowsetWriterContext;
+class ThreadPool;
 
 namespace io {
 class FileWriter;
@@ -123,6 +124,11 @@ public:
 private:
     void _init_column_meta(ColumnMetaPB* meta, uint32_t column_id, const TabletColumn& column);
     Status _create_column_writer(uint32_t cid, const TabletColumn& column);
+    // convert, encode and compress all columns of _batched_blocks in parallel on pool, then
+    // write the pages of the columns in column order
+    Status _write_columns_in_parallel(
+            ThreadPool* pool, std::vector<vectorized::IOlapColumnDataAccessor*>* key_columns,
+            vectorized::IOlapColumnDataAccessor** seq_column);
     size_t _calculate_inverted_index_file_size();
     uint64_t _estimated_remaining_size();
     Status _write_ordinal_index();
@@ -144,6 +150,8 @@ private:
     void _encode_seq_column(const vectorized::IOlapColumnDataAccessor* seq_column, size_t pos,
                             string* encoded_keys);
     void _set_min_max_key(const Slice& key);
+    // update the min and max key by a key of the rows not in key order
+    void _extend_min_max_key(const Slice& key);
     void _set_min_key(const Slice& key);
     void _set_max_key(const Slice& key);
     void _serialize_block_to_row_column(vectorized::Block& block);
@@ -28,6 +28,7 @@
 #include "olap/rowset/segment_v2/indexed_column_reader.h"
 #include "olap/rowset/segment_v2/indexed_column_writer.h"
 #include "olap/types.h"
+#include "olap/wrapper_field.h"
 #include "runtime/primitive_type.h"
 #include "util/slice.h"
 #include "vec/columns/column.h"
@@ -115,6 +116,48 @@ Status TypedZoneMapIndexWriter<Type>::flush() {
     return Status::OK();
 }
 
+template <PrimitiveType Type>
+Status TypedZoneMapIndexWriter<Type>::add_page_zone_map(const ZoneMapPB& page_zone_map) {
+    std::string serialized_zone_map;
+    if (!page_zone_map.SerializeToString(&serialized_zone_map)) {
+        return Status::InternalError("serialize zone map failed");
+    }
+    _estimated_size += serialized_zone_map.size() + sizeof(uint32_t);
+    _values.push_back(std::move(serialized_zone_map));
+    return Status::OK();
+}
+
+template <PrimitiveType Type>
+Status TypedZoneMapIndexWriter<Type>::merge_segment_zone_map(const ZoneMapPB& segment_zone_map) {
+    if (segment_zone_map.has_not_null()) {
+        // The max value may have been modified by moidfy_index_before_flush(), which only
+        // makes it larger, so the merged zone map still covers all values.
+        std::unique_ptr<WrapperField> value(
+                WrapperField::create_by_type(_field->type(), MAX_ZONE_MAP_INDEX_SIZE));
+        if (value == nullptr) {
+            return Status::InternalError("failed to create zone map value of type {}",
+                                         int(_field->type()));
+        }
+        RETURN_IF_ERROR(value->from_string(segment_zone_map.min(), _field->get_precision(),
+                                           _field->get_scale()));
+        if (_field->compare(_segment_zone_map.min_value, value->cell_ptr()) > 0) {
+            _field->type_info()->direct_copy_may_cut(_segment_zone_map.min_value,
+                                                     value->cell_ptr());
+        }
+        RETURN_IF_ERROR(value->from_string(segment_zone_map.max(), _field->get_precision(),
+                                           _field->get_scale()));
+        if (_field->compare(_segment_zone_map.max_value, value->cell_ptr()) < 0) {
+            _field->type_info()->direct_copy_may_cut(_segment_zone_map.max_value,
+                                                     value->cell_ptr());
+        }
+        _segment_zone_map.has_not_null = true;
+    }
+    if (segment_zone_map.has_null()) {
+        _segment_zone_map.has_null = true;
+    }
+    return Status::OK();
+}
+
 template <PrimitiveType Type>
 Status TypedZoneMapIndexWriter<Type>::finish(io::FileWriter* file_writer,
                                              ColumnIndexMetaPB* index_meta) {
@@ -87,6 +87,14 @@ public:
     // mark the end of one data page so that we can finalize the corresponding zone map
     virtual Status flush() = 0;
 
+    // add the zone map of a data page copied from another segment as the zone map of the next
+    // data page, instead of adding its values
+    virtual Status add_page_zone_map(const ZoneMapPB& page_zone_map) = 0;
+
+    // merge the segment zone map of another segment, whose data pages are copied, into that of
+    // this segment
+    virtual Status merge_segment_zone_map(const ZoneMapPB& segment_zone_map) = 0;
+
     virtual Status finish(io::FileWriter* file_writer, ColumnIndexMetaPB* index_meta) = 0;
 
     virtual void moidfy_index_before_flush(ZoneMap& zone_map) = 0;
@@ -112,6 +120,10 @@ public:
     // mark the end of one data page so that we can finalize the corresponding zone map
     Status flush() override;
 
+    Status add_page_zone_map(const ZoneMapPB& page_zone_map) override;
+
+    Status merge_segment_zone_map(const ZoneMapPB& segment_zone_map) override;
+
     Status finish(io::FileWriter* file_writer, ColumnIndexMetaPB* index_meta) override;
 
     void moidfy_index_before_flush(ZoneMap& zone_map) override;
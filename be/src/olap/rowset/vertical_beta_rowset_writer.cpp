@@ -36,6 +36,7 @@
 #include "olap/rowset/beta_rowset.h"
 #include "olap/rowset/rowset_meta.h"
 #include "olap/rowset/rowset_writer_context.h"
+#include "olap/rowset/segment_v2/segment.h"
 #include "util/slice.h"
 #include "util/spinlock.h"
 #include "vec/core/block.h"
@@ -222,6 +223,138 @@ Status VerticalBetaRowsetWriter<T>::final_flush() {
     return Status::OK();
 }
 
+template <class T>
+    requires std::is_base_of_v<BaseBetaRowsetWriter, T>
+Status VerticalBetaRowsetWriter<T>::prepare_value_groups(size_t num_groups) {
+    _value_groups.clear();
+    _value_groups.resize(num_groups);
+    _next_value_group.assign(_segment_writers.size(), 0);
+    _value_groups_cancelled = false;
+    return Status::OK();
+}
+
+template <class T>
+    requires std::is_base_of_v<BaseBetaRowsetWriter, T>
+Status VerticalBetaRowsetWriter<T>::add_value_group_columns(size_t group_idx,
+                                                            const vectorized::Block* block,
+                                                            const std::vector<uint32_t>& col_ids) {
+    DCHECK_LT(group_idx, _value_groups.size());
+    auto& group = _value_groups[group_idx];
+    size_t num_rows = block->rows();
+    size_t start_offset = 0;
+    while (num_rows > 0) {
+        if (group.writer == nullptr) {
+            RETURN_IF_ERROR(_segment_writers[group.cur_writer_idx]->create_column_group_writer(
+                    col_ids, &group.writer));
+        }
+        // make rows align between key columns and value columns of each segment
+        uint32_t num_rows_key_group = _segment_writers[group.cur_writer_idx]->row_count();
+        uint32_t num_rows_written = group.writer->num_rows_written();
+        size_t limit = std::min<size_t>(num_rows, num_rows_key_group - num_rows_written);
+        if (limit > 0) {
+            RETURN_IF_ERROR(group.writer->append_block(block, start_offset, limit));
+            start_offset += limit;
+            num_rows -= limit;
+        }
+        if (num_rows_written + limit == num_rows_key_group &&
+            group.cur_writer_idx < _segment_writers.size() - 1) {
+            RETURN_IF_ERROR(_flush_value_group_columns(group_idx));
+            ++group.cur_writer_idx;
+        } else if (num_rows > 0) {
+            return Status::InternalError(
+                    "value column group {} has more rows than key group, rows of key group: {}",
+                    group_idx, _total_key_group_rows);
+        }
+    }
+    return Status::OK();
+}
+
+template <class T>
+    requires std::is_base_of_v<BaseBetaRowsetWriter, T>
+Status VerticalBetaRowsetWriter<T>::flush_value_group_columns(size_t group_idx) {
+    if (_segment_writers.empty()) {
+        return Status::OK();
+    }
+    DCHECK_EQ(_value_groups[group_idx].cur_writer_idx, _segment_writers.size() - 1);
+    return _flush_value_group_columns(group_idx);
+}
+
+template <class T>
+    requires std::is_base_of_v<BaseBetaRowsetWriter, T>
+Status VerticalBetaRowsetWriter<T>::_flush_value_group_columns(size_t group_idx) {
+    auto& group = _value_groups[group_idx];
+    size_t segment_idx = group.cur_writer_idx;
+    if (group.writer == nullptr) {
+        // no rows of the group in the segment, which fails the check of the row count
+        RETURN_IF_ERROR(_segment_writers[segment_idx]->create_column_group_writer({},
+                                                                                 &group.writer));
+    }
+    {
+        std::unique_lock l(_value_group_lock);
+        _value_group_cv.wait(l, [&]() {
+            return _value_groups_cancelled || _next_value_group[segment_idx] == group_idx;
+        });
+        if (_value_groups_cancelled) {
+            return Status::Cancelled("vertical compaction of value column groups is cancelled");
+        }
+    }
+    VLOG_NOTICE << "flush columns of value group " << group_idx << ", segment: " << segment_idx;
+    uint64_t index_size = 0;
+    auto st = _segment_writers[segment_idx]->finalize_column_group(group.writer.get(),
+                                                                    &index_size);
+    group.writer.reset();
+    std::lock_guard l(_value_group_lock);
+    if (st.ok()) {
+        this->_total_index_size += static_cast<int64_t>(index_size);
+        ++_next_value_group[segment_idx];
+    } else {
+        _value_groups_cancelled = true;
+    }
+    _value_group_cv.notify_all();
+    return st;
+}
+
+template <class T>
+    requires std::is_base_of_v<BaseBetaRowsetWriter, T>
+void VerticalBetaRowsetWriter<T>::cancel_value_groups() {
+    std::lock_guard l(_value_group_lock);
+    _value_groups_cancelled = true;
+    _value_group_cv.notify_all();
+}
+
+template <class T>
+    requires std::is_base_of_v<BaseBetaRowsetWriter, T>
+Status VerticalBetaRowsetWriter<T>::add_value_column_pages(segment_v2::Segment* segment,
+                                                           const std::vector<uint32_t>& col_ids) {
+    if (segment->num_rows() == 0) {
+        return Status::OK();
+    }
+    if (_segment_writers.empty()) {
+        return Status::InternalError("value column pages are added before key columns");
+    }
+    auto* segment_writer = _segment_writers[_cur_writer_idx].get();
+    // init if it's first value column write in current segment
+    if (_cur_writer_idx == 0 && segment_writer->num_rows_written() == 0) {
+        RETURN_IF_ERROR(segment_writer->init(col_ids, false));
+    }
+    // the pages of a source segment can not be split between segments
+    if (segment_writer->num_rows_written() + segment->num_rows() > segment_writer->row_count()) {
+        return Status::InternalError(
+                "source segment {} of {} rows does not fit in segment {} of {} rows, {} written",
+                segment->id(), segment->num_rows(), segment_writer->get_segment_id(),
+                segment_writer->row_count(), segment_writer->num_rows_written());
+    }
+    RETURN_IF_ERROR(segment_writer->append_column_pages(segment));
+    if (segment_writer->num_rows_written() == segment_writer->row_count() &&
+        _cur_writer_idx < _segment_writers.size() - 1) {
+        RETURN_IF_ERROR(_flush_columns(segment_writer));
+        ++_cur_writer_idx;
+        // switch to next writer
+        RETURN_IF_ERROR(_segment_writers[_cur_writer_idx]->init(col_ids, false));
+    }
+    return Status::OK();
+}
+
 template <class T>
     requires std::is_base_of_v<BaseBetaRowsetWriter, T>
 Status VerticalBetaRowsetWriter<T>::_close_file_writers() {
@@ -17,7 +17,9 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <vector>
 
@@ -49,6 +51,19 @@ public:
     // flush when all column finished, flush column footer
     Status final_flush() override;
 
+    Status prepare_value_groups(size_t num_groups) override;
+
+    Status add_value_group_columns(size_t group_idx, const vectorized::Block* block,
+                                   const std::vector<uint32_t>& col_ids) override;
+
+    // flush the columns of the group in the last segment
+    Status flush_value_group_columns(size_t group_idx) override;
+
+    void cancel_value_groups() override;
+
+    Status add_value_column_pages(segment_v2::Segment* segment,
+                                  const std::vector<uint32_t>& col_ids) override;
+
     int64_t num_rows() const override { return _total_key_group_rows; }
 
     Status _close_file_writers() override;
@@ -58,9 +73,26 @@ private:
     Status _create_segment_writer(const std::vector<uint32_t>& column_ids, bool is_key,
                                   std::unique_ptr<segment_v2::SegmentWriter>* writer);
 
+    // write the columns of the group in its current segment after those of the previous group
+    Status _flush_value_group_columns(size_t group_idx);
+
     std::vector<std::unique_ptr<segment_v2::SegmentWriter>> _segment_writers;
     size_t _cur_writer_idx = 0;
     size_t _total_key_group_rows = 0;
+
+    // the value column groups compacted in parallel
+    struct ValueGroup {
+        // the segment whose columns of the group are being added
+        size_t cur_writer_idx = 0;
+        // the writer of the columns of the group in the current segment
+        std::unique_ptr<segment_v2::SegmentWriter> writer;
+    };
+    std::vector<ValueGroup> _value_groups;
+    std::mutex _value_group_lock;
+    std::condition_variable _value_group_cv;
+    // the group whose columns are written next to each segment
+    std::vector<size_t> _next_value_group;
+    bool _value_groups_cancelled = false;
 };
 
 } // namespace doris
\ No newline at end of file
@@ -114,7 +114,9 @@ public:
 
     SchemaCache(size_t capacity)
             : LRUCachePolicy(CachePolicy::CacheType::SCHEMA_CACHE, capacity, LRUCacheType::NUMBER,
-                             config::schema_cache_sweep_time_sec) {}
+                             config::schema_cache_sweep_time_sec) {
+        set_clock_lookup(config::enable_lru_cache_clock_lookup);
+    }
 
 private:
     static constexpr char SCHEMA_DELIMITER = '-';
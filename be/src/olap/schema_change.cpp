@@ -18,6 +18,7 @@
 #include "olap/schema_change.h"
 
 #include <algorithm>
+#include <atomic>
 #include <exception>
 #include <map>
 #include <memory>
@@ -70,6 +71,7 @@
 #include "runtime/runtime_state.h"
 #include "util/debug_points.h"
 #include "util/defer_op.h"
+#include "util/threadpool.h"
 #include "util/trace.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/aggregate_functions/aggregate_function_reader.h"
@@ -1097,13 +1099,16 @@ Status SchemaChangeJob::_convert_historical_rowsets(const SchemaChangeParams& sc
     }
 
     // b. Generate historical data converter
-    auto sc_procedure = _get_sc_procedure(
-            changer, sc_sorting, sc_directly,
-            _local_storage_engine.memory_limitation_bytes_per_thread_for_schema_change());
+    int64_t mem_limit =
+            _local_storage_engine.memory_limitation_bytes_per_thread_for_schema_change();
 
     // c.Convert historical data
     bool have_failure_rowset = false;
-    for (const auto& rs_reader : sc_params.ref_rowset_readers) {
+    const auto& rs_readers = sc_params.ref_rowset_readers;
+    // Convert a rowset into a new rowset, which is added to the new tablet by `add_rowset`.
+    auto convert_rowset = [&](const RowsetReaderSharedPtr& rs_reader, SchemaChange* sc_procedure,
+                              RowsetSharedPtr* new_rowset,
+                              PendingRowsetGuard* pending_rs_guard) -> Status {
         // set status for monitor
         // As long as there is a new_table as running, ref table is set as running
         // NOTE If the first sub_table fails first, it will continue to go as normal here
@@ -1124,44 +1129,47 @@ Status SchemaChangeJob::_convert_historical_rowsets(const SchemaChangeParams& sc
         context.write_type = DataWriteType::TYPE_SCHEMA_CHANGE;
         auto result = _new_tablet->create_rowset_writer(context, false);
         if (!result.has_value()) {
-            res = Status::Error<ROWSET_BUILDER_INIT>("create_rowset_writer failed, reason={}",
-                                                     result.error().to_string());
-            return process_alter_exit();
+            return Status::Error<ROWSET_BUILDER_INIT>("create_rowset_writer failed, reason={}",
+                                                      result.error().to_string());
         }
         auto rowset_writer = std::move(result).value();
-        auto pending_rs_guard = _local_storage_engine.add_pending_rowset(context);
+        *pending_rs_guard = _local_storage_engine.add_pending_rowset(context);
 
-        if (res = sc_procedure->process(rs_reader, rowset_writer.get(), _new_tablet, _base_tablet,
-                                        _base_tablet_schema, _new_tablet_schema);
-            !res) {
+        if (auto st = sc_procedure->process(rs_reader, rowset_writer.get(), _new_tablet,
+                                            _base_tablet, _base_tablet_schema, _new_tablet_schema);
+            !st) {
             LOG(WARNING) << "failed to process the version."
                          << " version=" << rs_reader->version().first << "-"
-                         << rs_reader->version().second << ", " << res.to_string();
-            return process_alter_exit();
+                         << rs_reader->version().second << ", " << st.to_string();
+            return st;
         }
-        // Add the new version of the data to the header
         // In order to prevent the occurrence of deadlock, we must first lock the old table, and then lock the new table
         std::lock_guard lock(_new_tablet->get_push_lock());
-        RowsetSharedPtr new_rowset;
-        if (!(res = rowset_writer->build(new_rowset)).ok()) {
+        if (auto st = rowset_writer->build(*new_rowset); !st.ok()) {
             LOG(WARNING) << "failed to build rowset, exit alter process";
-            return process_alter_exit();
+            return st;
         }
-        res = _new_tablet->add_rowset(new_rowset);
-        if (res.is<PUSH_VERSION_ALREADY_EXIST>()) {
+        return Status::OK();
+    };
+    // Add the new version of the data to the header
+    auto add_rowset = [&](const RowsetReaderSharedPtr& rs_reader,
+                          const RowsetSharedPtr& new_rowset) -> Status {
+        std::lock_guard lock(_new_tablet->get_push_lock());
+        auto st = _new_tablet->add_rowset(new_rowset);
+        if (st.is<PUSH_VERSION_ALREADY_EXIST>()) {
             LOG(WARNING) << "version already exist, version revert occurred. "
                          << "tablet=" << _new_tablet->tablet_id() << ", version='"
                          << rs_reader->version().first << "-" << rs_reader->version().second;
             _local_storage_engine.add_unused_rowset(new_rowset);
             have_failure_rowset = true;
-            res = Status::OK();
-        } else if (!res) {
+            st = Status::OK();
+        } else if (!st) {
             LOG(WARNING) << "failed to register new version. "
                          << " tablet=" << _new_tablet->tablet_id()
                          << ", version=" << rs_reader->version().first << "-"
                          << rs_reader->version().second;
             _local_storage_engine.add_unused_rowset(new_rowset);
-            return process_alter_exit();
+            return st;
         } else {
             VLOG_NOTICE << "register new version. tablet=" << _new_tablet->tablet_id()
                         << ", version=" << rs_reader->version().first << "-"
@@ -1174,6 +1182,75 @@ Status SchemaChangeJob::_convert_historical_rowsets(const SchemaChangeParams& sc
         VLOG_TRACE << "succeed to convert a history version."
                    << " version=" << rs_reader->version().first << "-"
                    << rs_reader->version().second;
+        return st;
+    };
+
+    auto parallelism = static_cast<size_t>(std::max(config::schema_change_rowset_parallelism, 1));
+    parallelism = std::min(parallelism, rs_readers.size());
+    if (parallelism <= 1) {
+        auto sc_procedure = _get_sc_procedure(changer, sc_sorting, sc_directly, mem_limit);
+        for (const auto& rs_reader : rs_readers) {
+            RowsetSharedPtr new_rowset;
+            PendingRowsetGuard pending_rs_guard;
+            if (res = convert_rowset(rs_reader, sc_procedure.get(), &new_rowset,
+                                     &pending_rs_guard);
+                !res) {
+                return process_alter_exit();
+            }
+            if (res = add_rowset(rs_reader, new_rowset); !res) {
+                return process_alter_exit();
+            }
+        }
+        return process_alter_exit();
+    }
+
+    // The rowsets are converted by a pool of threads, each with a procedure of its own, and
+    // added to the new tablet in version order as by the serial conversion. After a failure,
+    // the rowsets not yet converted are skipped and those converted after it are dropped.
+    std::unique_ptr<ThreadPool> sc_pool;
+    res = ThreadPoolBuilder("SchemaChangeRowsetThreadPool")
+                  .set_min_threads(parallelism)
+                  .set_max_threads(parallelism)
+                  .build(&sc_pool);
+    if (!res) {
+        return process_alter_exit();
+    }
+    size_t num_rowsets = rs_readers.size();
+    std::vector<Status> statuses(num_rowsets, Status::Cancelled("another rowset failed"));
+    std::vector<RowsetSharedPtr> new_rowsets(num_rowsets);
+    std::vector<PendingRowsetGuard> pending_rs_guards(num_rowsets);
+    std::atomic<bool> failed = false;
+    for (size_t i = 0; i < num_rowsets; ++i) {
+        auto st = sc_pool->submit_func([&, i]() {
+            if (failed) {
+                return;
+            }
+            auto sc_procedure = _get_sc_procedure(changer, sc_sorting, sc_directly, mem_limit);
+            statuses[i] = convert_rowset(rs_readers[i], sc_procedure.get(), &new_rowsets[i],
+                                         &pending_rs_guards[i]);
+            if (!statuses[i]) {
+                failed = true;
+            }
+        });
+        if (!st) {
+            statuses[i] = st;
+            failed = true;
+            break;
+        }
+    }
+    sc_pool->wait();
+    for (size_t i = 0; i < num_rowsets; ++i) {
+        if (res = statuses[i]; res) {
+            res = add_rowset(rs_readers[i], new_rowsets[i]);
+        }
+        if (!res) {
+            for (size_t j = i + 1; j < num_rowsets; ++j) {
+                if (new_rowsets[j] != nullptr) {
+                    _local_storage_engine.add_unused_rowset(new_rowsets[j]);
+                }
+            }
+            return process_alter_exit();
+        }
     }
 
     // XXX:The SchemaChange state should not be canceled at this time, because the new Delta has to be converted to the old and new Schema version
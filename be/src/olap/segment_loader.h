@@ -82,7 +82,10 @@ public:
 
     SegmentCache(size_t capacity)
             : LRUCachePolicy(CachePolicy::CacheType::SEGMENT_CACHE, capacity, LRUCacheType::SIZE,
-                             config::tablet_rowset_stale_sweep_time_sec) {}
+                             config::tablet_rowset_stale_sweep_time_sec) {
+        set_protected_capacity_ratio(config::segment_cache_protected_ratio);
+        set_clock_lookup(config::enable_lru_cache_clock_lookup);
+    }
 
     // Lookup the given segment in the cache.
     // If the segment is found, the cache entry will be written into handle.
@@ -90,17 +90,34 @@ Status ShortKeyIndexDecoder::parse(const Slice& body, const segment_v2::ShortKey
     }
     _parsed = true;
 
+    _eytzinger_prefixes.resize(_footer.num_items() + 1);
+    _eytzinger_ordinals.resize(_footer.num_items() + 1);
+    size_t next_ordinal = 0;
+    _build_eytzinger(&next_ordinal, 1);
+
     g_short_key_index_memory_bytes << sizeof(_footer) + _key_data.size +
-                                              _offsets.size() * sizeof(uint32_t) + sizeof(*this);
+                                              _offsets.size() * sizeof(uint32_t) + sizeof(*this) +
+                                              _eytzinger_memory_bytes();
 
     return Status::OK();
 }
 
+void ShortKeyIndexDecoder::_build_eytzinger(size_t* next_ordinal, size_t k) {
+    // an in-order traversal of the tree visits the keys in ascending order
+    if (k < _eytzinger_prefixes.size()) {
+        _build_eytzinger(next_ordinal, 2 * k);
+        _eytzinger_prefixes[k] = key_prefix(key(*next_ordinal));
+        _eytzinger_ordinals[k] = *next_ordinal;
+        ++*next_ordinal;
+        _build_eytzinger(next_ordinal, 2 * k + 1);
+    }
+}
+
 ShortKeyIndexDecoder::~ShortKeyIndexDecoder() {
     if (_parsed) {
         g_short_key_index_memory_bytes << -sizeof(_footer) - _key_data.size -
                                                   _offsets.size() * sizeof(uint32_t) -
-                                                  sizeof(*this);
+                                                  sizeof(*this) - _eytzinger_memory_bytes();
     }
 }
 
@@ -23,10 +23,12 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <vector>
 
 #include "common/status.h"
+#include "gutil/endian.h"
 #include "util/faststring.h"
 #include "util/slice.h"
 
@@ -182,15 +184,56 @@ public:
         return {_key_data.data + _offsets[ordinal], _offsets[ordinal + 1] - _offsets[ordinal]};
     }
 
+    // The first 8 bytes of `key` as a big endian integer, padded with zeros. Keys compare in
+    // the order of their prefixes, when the prefixes differ.
+    static uint64_t key_prefix(const Slice& key) {
+        uint8_t buf[sizeof(uint64_t)] = {0};
+        memcpy(buf, key.data, std::min(key.size, sizeof(buf)));
+        uint64_t prefix;
+        memcpy(&prefix, buf, sizeof(prefix));
+        return BigEndian::ToHost64(prefix);
+    }
+
 private:
     template <bool lower_bound>
     ShortKeyIndexIterator seek(const Slice& key) const {
         auto comparator = [](const Slice& lhs, const Slice& rhs) { return lhs.compare(rhs) < 0; };
+        // Only the items whose prefix equals the one of `key` need to be compared as keys.
+        uint64_t prefix = key_prefix(key);
+        ShortKeyIndexIterator first(this, _prefix_bound<false>(prefix));
+        ShortKeyIndexIterator last(this, _prefix_bound<true>(prefix));
         if (lower_bound) {
-            return std::lower_bound(begin(), end(), key, comparator);
+            return std::lower_bound(first, last, key, comparator);
         } else {
-            return std::upper_bound(begin(), end(), key, comparator);
+            return std::upper_bound(first, last, key, comparator);
+        }
+    }
+
+    // Return the ordinal of the first item whose prefix is greater than `prefix`, or not less
+    // than it if `upper` is false.
+    // The search walks down the implicit binary tree of `_eytzinger_prefixes` without branches,
+    // and prefetches the nodes of 3 levels below, which are in one cache line.
+    template <bool upper>
+    uint32_t _prefix_bound(uint64_t prefix) const {
+        const uint64_t* nodes = _eytzinger_prefixes.data();
+        size_t n = _eytzinger_prefixes.size() - 1;
+        size_t k = 1;
+        while (k <= n) {
+            __builtin_prefetch(nodes + std::min(k * 8, n));
+            k = 2 * k + (upper ? nodes[k] <= prefix : nodes[k] < prefix);
         }
+        // the last node where the walk went left is the answer
+        k >>= __builtin_ffsll(~k);
+        return k == 0 ? num_items() : _eytzinger_ordinals[k];
+    }
+
+    // Lay out the prefixes of the keys in the order of a breadth first traversal of a complete
+    // binary search tree.
+    void _build_eytzinger(size_t* next_ordinal, size_t k);
+
+    size_t _eytzinger_memory_bytes() const {
+        return _eytzinger_prefixes.size() * sizeof(uint64_t) +
+               _eytzinger_ordinals.size() * sizeof(uint32_t);
     }
 
 private:
@@ -200,6 +243,9 @@ private:
     segment_v2::ShortKeyFooterPB _footer;
     std::vector<uint32_t> _offsets;
     Slice _key_data;
+    // 1-based, the prefix of the keys and their ordinals at each node of the search tree
+    std::vector<uint64_t> _eytzinger_prefixes;
+    std::vector<uint32_t> _eytzinger_ordinals;
 };
 
 inline Slice ShortKeyIndexIterator::operator*() const {
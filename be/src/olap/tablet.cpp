@@ -651,6 +651,7 @@ Status Tablet::add_inc_rowset(const RowsetSharedPtr& rowset) {
     _timestamped_version_tracker.add_version(rowset->version());
 
     ++_newly_created_rowset_num;
+    _compaction_stats.add_ingested_bytes(rowset->data_disk_size());
     return Status::OK();
 }
 
@@ -1753,14 +1754,47 @@ std::vector<Version> Tablet::get_all_local_versions() {
     return local_versions;
 }
 
-void Tablet::execute_compaction(CompactionMixin& compaction) {
+void Tablet::execute_compaction(CompactionMixin& compaction, int64_t queue_delay_us) {
     signal::tablet_id = tablet_id();
 
+    auto score = [this, &compaction]() -> int64_t {
+        if (_cumulative_compaction_policy == nullptr) {
+            return -1;
+        }
+        switch (compaction.compaction_type()) {
+        case ReaderType::READER_CUMULATIVE_COMPACTION:
+            return calc_compaction_score(CompactionType::CUMULATIVE_COMPACTION,
+                                         _cumulative_compaction_policy);
+        case ReaderType::READER_BASE_COMPACTION:
+            return calc_compaction_score(CompactionType::BASE_COMPACTION,
+                                         _cumulative_compaction_policy);
+        default:
+            return -1;
+        }
+    };
+    TabletCompactionStats::Record record;
+    record.type = compaction.compaction_name();
+    record.queue_delay_us = queue_delay_us;
+    record.score_before = score();
+
     MonotonicStopWatch watch;
     watch.start();
 
     Status res = compaction.execute_compact();
 
+    record.elapsed_us = watch.elapsed_time() / 1000;
+    record.success = res.ok();
+    record.finish_time_ms = UnixMillis();
+    record.input_bytes = compaction.input_rowsets_size();
+    record.input_rows = compaction.input_row_num();
+    record.merged_rows = compaction.merged_rows();
+    if (const auto& output_rowset = compaction.output_rowset(); output_rowset != nullptr) {
+        record.output_bytes = output_rowset->data_disk_size();
+        record.output_rows = output_rowset->num_rows();
+    }
+    record.score_after = score();
+    _compaction_stats.add_record(std::move(record));
+
     if (!res.ok()) [[unlikely]] {
         set_last_failure_time(this, compaction, UnixMillis());
         LOG(WARNING) << "failed to do " << compaction.compaction_name()
@@ -38,6 +38,7 @@
 #include "common/status.h"
 #include "olap/base_tablet.h"
 #include "olap/binlog_config.h"
+#include "olap/compaction_stats.h"
 #include "olap/data_dir.h"
 #include "olap/olap_common.h"
 #include "olap/partial_update_info.h"
@@ -304,7 +305,8 @@ public:
             CompactionType compaction_type, const TabletSharedPtr& tablet,
             std::shared_ptr<CompactionMixin>& compaction, int64_t& permits);
 
-    void execute_compaction(CompactionMixin& compaction);
+    // `queue_delay_us` is the time the compaction waited in its thread pool.
+    void execute_compaction(CompactionMixin& compaction, int64_t queue_delay_us = 0);
     void execute_single_replica_compaction(SingleReplicaCompaction& compaction);
 
     void set_cumulative_compaction_policy(
@@ -322,6 +324,8 @@ public:
 
     std::string get_last_base_compaction_status() { return _last_base_compaction_status; }
 
+    TabletCompactionStats& compaction_stats() { return _compaction_stats; }
+
     std::tuple<int64_t, int64_t> get_visible_version_and_time() const;
 
     void set_visible_version(const std::shared_ptr<const VersionWithTime>& visible_version) {
@@ -336,6 +340,10 @@ public:
     }
 
     const TabletSchemaSPtr& tablet_schema_unlocked() const { return _max_version_schema; }
+    // Must be called with the header lock held exclusively.
+    void set_tablet_schema_unlocked(const TabletSchemaSPtr& tablet_schema) {
+        _max_version_schema = tablet_schema;
+    }
 
     Result<std::unique_ptr<RowsetWriter>> create_rowset_writer(RowsetWriterContext& context,
                                                                bool vertical) override;
@@ -571,6 +579,7 @@ private:
     std::atomic<int32_t> _newly_created_rowset_num;
     std::atomic<int64_t> _last_checkpoint_time;
     std::string _last_base_compaction_status;
+    TabletCompactionStats _compaction_stats;
 
     // single replica compaction status
     std::string _last_single_compaction_failure_status;
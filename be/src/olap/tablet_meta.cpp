@@ -39,6 +39,7 @@
 #include "olap/olap_define.h"
 #include "olap/rowset/rowset.h"
 #include "olap/tablet_meta_manager.h"
+#include "olap/tablet_schema_cache.h"
 #include "olap/utils.h"
 #include "util/debug_points.h"
 #include "util/mem_info.h"
@@ -313,6 +314,12 @@ TabletMeta::TabletMeta(int64_t table_id, int64_t partition_id, int64_t tablet_id
     init_from_pb(tablet_meta_pb);
 }
 
+TabletMeta::~TabletMeta() {
+    if (_schema_handle != nullptr) {
+        TabletSchemaCache::instance()->release(_schema_handle);
+    }
+}
+
 TabletMeta::TabletMeta(const TabletMeta& b)
         : _table_id(b._table_id),
           _index_id(b._index_id),
@@ -560,8 +567,13 @@ void TabletMeta::init_from_pb(const TabletMetaPB& tablet_meta_pb) {
                      << ", schema_hash=" << schema_hash();
     }
 
-    // init _schema
-    _schema->init_from_pb(tablet_meta_pb.schema());
+    // init _schema, shared with the tablets and the rowsets of the same schema
+    if (TabletSchemaCache::instance() != nullptr) {
+        _set_tablet_schema_key(
+                TabletSchema::deterministic_string_serialize(tablet_meta_pb.schema()));
+    } else {
+        _schema->init_from_pb(tablet_meta_pb.schema());
+    }
 
     if (tablet_meta_pb.has_enable_unique_key_merge_on_write()) {
         _enable_unique_key_merge_on_write = tablet_meta_pb.enable_unique_key_merge_on_write();
@@ -631,6 +643,23 @@ void TabletMeta::init_from_pb(const TabletMetaPB& tablet_meta_pb) {
             tablet_meta_pb.time_series_compaction_level_threshold();
 }
 
+void TabletMeta::set_tablet_schema(const TabletSchemaSPtr& tablet_schema) {
+    if (TabletSchemaCache::instance() == nullptr) {
+        _schema = tablet_schema;
+        return;
+    }
+    _set_tablet_schema_key(tablet_schema->to_key());
+}
+
+void TabletMeta::_set_tablet_schema_key(const std::string& schema_key) {
+    auto pair = TabletSchemaCache::instance()->insert(schema_key);
+    if (_schema_handle != nullptr) {
+        TabletSchemaCache::instance()->release(_schema_handle);
+    }
+    _schema_handle = pair.first;
+    _schema = pair.second;
+}
+
 void TabletMeta::to_meta_pb(TabletMetaPB* tablet_meta_pb) {
     tablet_meta_pb->set_table_id(table_id());
     tablet_meta_pb->set_index_id(index_id());
@@ -1037,6 +1066,18 @@ uint64_t DeleteBitmap::cardinality() const {
     return res;
 }
 
+uint64_t DeleteBitmap::optimize() {
+    std::lock_guard l(lock);
+    uint64_t saved_bytes = 0;
+    for (auto& [_, bitmap] : delete_bitmap) {
+        size_t size_before = bitmap.getSizeInBytes();
+        bitmap.runOptimize();
+        saved_bytes += size_before - std::min(size_before, bitmap.getSizeInBytes());
+        saved_bytes += bitmap.shrinkToFit();
+    }
+    return saved_bytes;
+}
+
 bool DeleteBitmap::contains_agg_without_cache(const BitmapKey& bmk, uint32_t row_id) const {
     std::shared_lock l(lock);
     DeleteBitmap::BitmapKey start {std::get<0>(bmk), std::get<1>(bmk), 0};
@@ -117,6 +117,8 @@ public:
     // If need add a filed in TableMeta, filed init copy in copy construct function
     TabletMeta(const TabletMeta& tablet_meta);
     TabletMeta(TabletMeta&& tablet_meta) = delete;
+    TabletMeta& operator=(const TabletMeta& tablet_meta) = delete;
+    ~TabletMeta();
 
     // Function create_from_file is used to be compatible with previous tablet_meta.
     // Previous tablet_meta is a physical file in tablet dir, which is not stored in rocksdb.
@@ -176,7 +178,9 @@ public:
 
     const TabletSchemaSPtr& tablet_schema() const;
 
-    TabletSchema* mutable_tablet_schema();
+    // The schema is shared through the TabletSchemaCache with the tablets and the rowsets of the
+    // same schema, so it is replaced by a changed copy instead of changed in place.
+    void set_tablet_schema(const TabletSchemaSPtr& tablet_schema);
 
     const std::vector<RowsetMetaSharedPtr>& all_rs_metas() const;
     std::vector<RowsetMetaSharedPtr>& all_mutable_rs_metas();
@@ -289,6 +293,8 @@ public:
 
 private:
     Status _save_meta(DataDir* data_dir);
+    // Makes _schema the schema of the key in the TabletSchemaCache.
+    void _set_tablet_schema_key(const std::string& schema_key);
 
     // _del_predicates is ignored to compare.
     friend bool operator==(const TabletMeta& a, const TabletMeta& b);
@@ -311,6 +317,9 @@ private:
     // the reference of _schema may use in tablet, so here need keep
     // the lifetime of tablemeta and _schema is same with tablet
     TabletSchemaSPtr _schema;
+    // The handle of _schema in the TabletSchemaCache, which keeps it there while the tablet meta
+    // uses it. A copied tablet meta shares the schema without a handle of its own.
+    Cache::Handle* _schema_handle = nullptr;
 
     std::vector<RowsetMetaSharedPtr> _rs_metas;
     // This variable _stale_rs_metas is used to record these rowsets‘ meta which are be compacted.
@@ -448,6 +457,14 @@ public:
      */
     uint64_t cardinality() const;
 
+    /**
+     * Converts the containers of the bitmaps to the smallest ones, the runs of the rows deleted
+     * by the upserts of continuous keys become run containers, and frees the unused capacity
+     *
+     * @return the bytes saved
+     */
+    uint64_t optimize();
+
     /**
      * Sets the bitmap of specific segment, it's may be insertion or replacement
      *
@@ -667,10 +684,6 @@ inline const TabletSchemaSPtr& TabletMeta::tablet_schema() const {
     return _schema;
 }
 
-inline TabletSchema* TabletMeta::mutable_tablet_schema() {
-    return _schema.get();
-}
-
 inline const std::vector<RowsetMetaSharedPtr>& TabletMeta::all_rs_metas() const {
     return _rs_metas;
 }
@@ -240,8 +240,18 @@ Status TabletMetaManager::save_delete_bitmap(DataDir* store, TTabletId tablet_id
         return Status::OK();
     }
     OlapMeta* meta = store->get_meta();
+    std::string key;
+    std::string val;
+    RETURN_IF_ERROR(serialize_delete_bitmap(tablet_id, *delete_bitmap, version, &key, &val));
+    return meta->put(META_COLUMN_FAMILY_INDEX, key, val);
+}
+
+Status TabletMetaManager::serialize_delete_bitmap(TTabletId tablet_id,
+                                                  const DeleteBitmap& delete_bitmap,
+                                                  int64_t version, std::string* key,
+                                                  std::string* value) {
     DeleteBitmapPB delete_bitmap_pb;
-    for (auto& [id, bitmap] : delete_bitmap->delete_bitmap) {
+    for (auto& [id, bitmap] : delete_bitmap.delete_bitmap) {
         auto& rowset_id = std::get<0>(id);
         int64_t segment_id = std::get<1>(id);
         delete_bitmap_pb.add_rowset_ids(rowset_id.to_string());
@@ -250,16 +260,15 @@ Status TabletMetaManager::save_delete_bitmap(DataDir* store, TTabletId tablet_id
         bitmap.write(bitmap_data.data());
         *(delete_bitmap_pb.add_segment_delete_bitmaps()) = std::move(bitmap_data);
     }
-    std::string key = encode_delete_bitmap_key(tablet_id, version);
-    std::string val;
-    bool ok = delete_bitmap_pb.SerializeToString(&val);
+    *key = encode_delete_bitmap_key(tablet_id, version);
+    bool ok = delete_bitmap_pb.SerializeToString(value);
     if (!ok) {
         auto msg = fmt::format("failed to serialize delete bitmap, tablet_id: {}, version: {}",
                                tablet_id, version);
         LOG(WARNING) << msg;
         return Status::InternalError(msg);
     }
-    return meta->put(META_COLUMN_FAMILY_INDEX, key, val);
+    return Status::OK();
 }
 
 Status TabletMetaManager::traverse_delete_bitmap(
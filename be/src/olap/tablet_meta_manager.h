@@ -75,6 +75,11 @@ public:
     static Status save_delete_bitmap(DataDir* store, TTabletId tablet_id,
                                      DeleteBitmapPtr delete_bitmap, int64_t version);
 
+    // Serialize the delete bitmap of a version to the key and the value saved by
+    // save_delete_bitmap(), so that it can be written with other metas in one write batch.
+    static Status serialize_delete_bitmap(TTabletId tablet_id, const DeleteBitmap& delete_bitmap,
+                                          int64_t version, std::string* key, std::string* value);
+
     static Status traverse_delete_bitmap(
             OlapMeta* meta, std::function<bool(int64_t, int64_t, const std::string&)> const& func);
 
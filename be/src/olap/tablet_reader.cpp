@@ -485,6 +485,8 @@ Status TabletReader::_init_orderby_keys_param(const ReaderParams& read_params) {
 }
 
 Status TabletReader::_init_conditions_param(const ReaderParams& read_params) {
+    // the columns of the equality and IN predicates of the query, not the runtime filters
+    std::set<int32_t> equal_predicate_columns;
     for (auto& condition : read_params.conditions) {
         TCondition tmp_cond = condition;
         RETURN_IF_ERROR(_tablet_schema->have_column(tmp_cond.column_name));
@@ -505,8 +507,16 @@ Status TabletReader::_init_conditions_param(const ReaderParams& read_params) {
             } else {
                 _col_predicates.push_back(predicate);
             }
+            if (!condition.marked_by_runtime_filter && column.unique_id() >= 0 &&
+                (predicate->type() == PredicateType::EQ ||
+                 predicate->type() == PredicateType::IN_LIST)) {
+                equal_predicate_columns.insert(column.unique_id());
+            }
         }
     }
+    if (read_params.reader_type == ReaderType::READER_QUERY && _tablet != nullptr) {
+        _tablet->record_equal_predicate_columns(equal_predicate_columns);
+    }
 
     // Only key column bloom filter will push down to storage engine
     for (const auto& filter : read_params.bloom_filters) {
@@ -24,6 +24,8 @@
 
 bvar::Adder<int64_t> g_tablet_schema_cache_count("tablet_schema_cache_count");
 bvar::Adder<int64_t> g_tablet_schema_cache_columns_count("tablet_schema_cache_columns_count");
+// The memory of the copies of the schemas the tablets and the rowsets would hold without the cache.
+bvar::Adder<int64_t> g_tablet_schema_cache_saved_bytes("tablet_schema_cache_saved_bytes");
 
 namespace doris {
 
@@ -33,6 +35,9 @@ std::pair<Cache::Handle*, TabletSchemaSPtr> TabletSchemaCache::insert(const std:
     if (lru_handle) {
         auto* value = (CacheValue*)LRUCachePolicy::value(lru_handle);
         tablet_schema_ptr = value->tablet_schema;
+        if (value->num_holders.fetch_add(1, std::memory_order_relaxed) > 0) {
+            g_tablet_schema_cache_saved_bytes << tablet_schema_ptr->mem_size();
+        }
     } else {
         auto* value = new CacheValue;
         tablet_schema_ptr = std::make_shared<TabletSchema>();
@@ -40,6 +45,7 @@ std::pair<Cache::Handle*, TabletSchemaSPtr> TabletSchemaCache::insert(const std:
         pb.ParseFromString(key);
         tablet_schema_ptr->init_from_pb(pb);
         value->tablet_schema = tablet_schema_ptr;
+        value->num_holders = 1;
         lru_handle = LRUCachePolicy::insert(key, value, tablet_schema_ptr->num_columns(), 0,
                                             CachePriority::NORMAL);
         g_tablet_schema_cache_count << 1;
@@ -50,6 +56,10 @@ std::pair<Cache::Handle*, TabletSchemaSPtr> TabletSchemaCache::insert(const std:
 }
 
 void TabletSchemaCache::release(Cache::Handle* lru_handle) {
+    auto* value = (CacheValue*)LRUCachePolicy::value(lru_handle);
+    if (value->num_holders.fetch_sub(1, std::memory_order_relaxed) > 1) {
+        g_tablet_schema_cache_saved_bytes << -value->tablet_schema->mem_size();
+    }
     LRUCachePolicy::release(lru_handle);
 }
 
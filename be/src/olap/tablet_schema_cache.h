@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "olap/tablet_fwd.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/lru_cache_policy.h"
@@ -49,6 +51,8 @@ private:
         ~CacheValue() override;
 
         TabletSchemaSPtr tablet_schema;
+        // The handles not released yet of the schema, all but one of which save a copy of it.
+        std::atomic<int64_t> num_holders = 0;
     };
 };
 
@@ -27,6 +27,8 @@
 #include <gen_cpp/Types_constants.h>
 #include <sys/stat.h>
 
+#include <algorithm>
+#include <atomic>
 #include <filesystem>
 #include <memory>
 #include <mutex>
@@ -65,6 +67,7 @@
 #include "util/defer_op.h"
 #include "util/network_util.h"
 #include "util/stopwatch.hpp"
+#include "util/threadpool.h"
 #include "util/thrift_rpc_helper.h"
 #include "util/trace.h"
 
@@ -520,10 +523,12 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
     }
 
     // Get copy from remote
-    uint64_t total_file_size = 0;
+    std::atomic<uint64_t> total_file_size = 0;
     MonotonicStopWatch watch;
     watch.start();
-    for (auto& file_name : file_name_list) {
+    auto download_file = [this, data_dir, &remote_url_prefix, &local_path, &total_file_size](
+                                 const std::string& file_name,
+                                 int64_t max_download_speed_kbps) -> Status {
         auto remote_file_url = remote_url_prefix + file_name;
 
         // get file length
@@ -545,24 +550,36 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
         }
 
         total_file_size += file_size;
-        uint64_t estimate_timeout = file_size / config::download_low_speed_limit_kbps / 1024;
-        if (estimate_timeout < config::download_low_speed_time) {
-            estimate_timeout = config::download_low_speed_time;
-        }
-
         std::string local_file_path = local_path + "/" + file_name;
 
         LOG(INFO) << "clone begin to download file from: " << _mask_token(remote_file_url)
-                  << " to: " << local_file_path << ". size(B): " << file_size
-                  << ", timeout(s): " << estimate_timeout;
+                  << " to: " << local_file_path << ". size(B): " << file_size;
+
+        auto download_cb = [this, &remote_file_url, &local_file_path, file_size,
+                            max_download_speed_kbps](HttpClient* client) {
+            std::error_code ec;
+            // A retry resumes the partial file left by the failed try
+            uint64_t offset = std::filesystem::exists(local_file_path, ec)
+                                      ? std::filesystem::file_size(local_file_path, ec)
+                                      : 0;
+            if (ec || offset >= file_size) {
+                offset = 0;
+            }
+            uint64_t estimate_timeout =
+                    (file_size - offset) / config::download_low_speed_limit_kbps / 1024;
+            if (estimate_timeout < config::download_low_speed_time) {
+                estimate_timeout = config::download_low_speed_time;
+            }
+            if (offset > 0) {
+                LOG(INFO) << "clone resume to download file from: " << _mask_token(remote_file_url)
+                          << ", offset: " << offset << ", timeout(s): " << estimate_timeout;
+            }
 
-        auto download_cb = [this, &remote_file_url, estimate_timeout, &local_file_path,
-                            file_size](HttpClient* client) {
             RETURN_IF_ERROR(client->init(remote_file_url));
             client->set_timeout_ms(estimate_timeout * 1000);
-            RETURN_IF_ERROR(client->download(local_file_path));
+            client->set_max_download_speed_kbps(max_download_speed_kbps);
+            RETURN_IF_ERROR(client->download(local_file_path, offset));
 
-            std::error_code ec;
             // Check file length
             uint64_t local_file_size = std::filesystem::file_size(local_file_path, ec);
             if (ec) {
@@ -580,19 +597,67 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
             return io::global_local_filesystem()->permission(local_file_path,
                                                              io::LocalFileSystem::PERMS_OWNER_RW);
         };
-        RETURN_IF_ERROR(HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb));
-    } // Clone files from remote backend
+        return HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb);
+    };
+
+    size_t num_data_files = file_name_list.size();
+    if (num_data_files > 0 && file_name_list.back().ends_with(".hdr")) {
+        --num_data_files;
+    }
+    // The data files are downloaded concurrently, and they share the max download speed so
+    // that a clone does not take more bandwidth than before.
+    int concurrency = std::max(
+            1, std::min(config::clone_download_file_concurrency, (int32_t)num_data_files));
+    int64_t max_download_speed_kbps =
+            std::max<int64_t>(1, config::max_download_speed_kbps / concurrency);
+    std::unique_ptr<ThreadPool> download_pool;
+    RETURN_IF_ERROR(ThreadPoolBuilder("CloneDownloadThreadPool")
+                            .set_min_threads(concurrency)
+                            .set_max_threads(concurrency)
+                            .build(&download_pool));
+    std::mutex status_mtx;
+    Status status;
+    for (size_t i = 0; i < num_data_files; ++i) {
+        Status st = download_pool->submit_func([&, i]() {
+            {
+                std::lock_guard lock(status_mtx);
+                // give up the rest files once a file fails
+                if (!status.ok()) {
+                    return;
+                }
+            }
+            Status download_st = download_file(file_name_list[i], max_download_speed_kbps);
+            std::lock_guard lock(status_mtx);
+            if (!download_st.ok() && status.ok()) {
+                status = std::move(download_st);
+            }
+        });
+        if (!st.ok()) {
+            std::lock_guard lock(status_mtx);
+            if (status.ok()) {
+                status = std::move(st);
+            }
+            break;
+        }
+    }
+    download_pool->wait();
+    download_pool->shutdown();
+    RETURN_IF_ERROR(status);
+    // The header file is downloaded after all the data files
+    if (num_data_files < file_name_list.size()) {
+        RETURN_IF_ERROR(download_file(file_name_list.back(), config::max_download_speed_kbps));
+    }
 
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
     total_time_ms = total_time_ms > 0 ? total_time_ms : 0;
     double copy_rate = 0.0;
     if (total_time_ms > 0) {
-        copy_rate = total_file_size / ((double)total_time_ms) / 1000;
+        copy_rate = total_file_size.load() / ((double)total_time_ms) / 1000;
     }
-    _copy_size = (int64_t)total_file_size;
+    _copy_size = (int64_t)total_file_size.load();
     _copy_time_ms = (int64_t)total_time_ms;
-    LOG(INFO) << "succeed to copy tablet " << _signature << ", total file size: " << total_file_size
-              << " B"
+    LOG(INFO) << "succeed to copy tablet " << _signature
+              << ", total file size: " << total_file_size.load() << " B"
               << ", cost: " << total_time_ms << " ms"
               << ", rate: " << copy_rate << " MB/s";
     return Status::OK();
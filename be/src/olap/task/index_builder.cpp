@@ -17,6 +17,9 @@
 
 #include "olap/task/index_builder.h"
 
+#include <atomic>
+
+#include "common/config.h"
 #include "common/status.h"
 #include "olap/olap_define.h"
 #include "olap/rowset/beta_rowset.h"
@@ -30,6 +33,7 @@
 #include "olap/storage_engine.h"
 #include "olap/tablet_schema.h"
 #include "util/debug_points.h"
+#include "util/threadpool.h"
 #include "util/trace.h"
 
 namespace doris {
@@ -42,14 +46,9 @@ IndexBuilder::IndexBuilder(StorageEngine& engine, TabletSharedPtr tablet,
           _tablet(std::move(tablet)),
           _columns(columns),
           _alter_inverted_indexes(alter_inverted_indexes),
-          _is_drop_op(is_drop_op) {
-    _olap_data_convertor = std::make_unique<vectorized::OlapBlockDataConvertor>();
-}
+          _is_drop_op(is_drop_op) {}
 
-IndexBuilder::~IndexBuilder() {
-    _olap_data_convertor.reset();
-    _inverted_index_builders.clear();
-}
+IndexBuilder::~IndexBuilder() = default;
 
 Status IndexBuilder::init() {
     for (auto inverted_index : _alter_inverted_indexes) {
@@ -303,142 +302,57 @@ Status IndexBuilder::handle_single_rowset(RowsetMetaSharedPtr output_rowset_meta
         LOG(INFO) << "all row nums. source_rows=" << output_rowset_meta->num_rows();
         return Status::OK();
     } else {
-        // create inverted index writer
-        const auto& fs = io::global_local_filesystem();
-        auto output_rowset_schema = output_rowset_meta->tablet_schema();
-        size_t inverted_index_size = 0;
-        for (auto& seg_ptr : segments) {
-            std::string index_path_prefix {
-                    InvertedIndexDescriptor::get_index_path_prefix(local_segment_path(
-                            _tablet->tablet_path(), output_rowset_meta->rowset_id().to_string(),
-                            seg_ptr->id()))};
-            std::vector<ColumnId> return_columns;
-            std::vector<std::pair<int64_t, int64_t>> inverted_index_writer_signs;
-            _olap_data_convertor->reserve(_alter_inverted_indexes.size());
-
-            std::unique_ptr<InvertedIndexFileWriter> inverted_index_file_writer = nullptr;
-            if (output_rowset_schema->get_inverted_index_storage_format() !=
-                InvertedIndexStorageFormatPB::V1) {
-                auto idx_file_reader_iter = _inverted_index_file_readers.find(
-                        std::make_pair(output_rowset_meta->rowset_id().to_string(), seg_ptr->id()));
-                if (idx_file_reader_iter == _inverted_index_file_readers.end()) {
-                    LOG(ERROR) << "idx_file_reader_iter" << output_rowset_meta->rowset_id() << ":"
-                               << seg_ptr->id() << " cannot be found";
-                    continue;
-                }
-                auto dirs = DORIS_TRY(idx_file_reader_iter->second->get_all_directories());
-                inverted_index_file_writer = std::make_unique<InvertedIndexFileWriter>(
-                        fs, index_path_prefix, output_rowset_meta->rowset_id().to_string(),
-                        seg_ptr->id(), output_rowset_schema->get_inverted_index_storage_format());
-                RETURN_IF_ERROR(inverted_index_file_writer->initialize(dirs));
-            } else {
-                inverted_index_file_writer = std::make_unique<InvertedIndexFileWriter>(
-                        fs, index_path_prefix, output_rowset_meta->rowset_id().to_string(),
-                        seg_ptr->id(), output_rowset_schema->get_inverted_index_storage_format());
-            }
-            // create inverted index writer
-            for (auto inverted_index : _alter_inverted_indexes) {
-                DCHECK_EQ(inverted_index.columns.size(), 1);
-                auto index_id = inverted_index.index_id;
-                auto column_name = inverted_index.columns[0];
-                auto column_idx = output_rowset_schema->field_index(column_name);
-                if (column_idx < 0) {
-                    LOG(WARNING) << "referenced column was missing. "
-                                 << "[column=" << column_name << " referenced_column=" << column_idx
-                                 << "]";
-                    continue;
-                }
-                auto column = output_rowset_schema->column(column_idx);
-                if (!InvertedIndexColumnWriter::check_column_valid(column)) {
-                    continue;
-                }
-                DCHECK(output_rowset_schema->has_inverted_index_with_index_id(index_id, ""));
-                _olap_data_convertor->add_column_data_convertor(column);
-                return_columns.emplace_back(column_idx);
-                std::unique_ptr<Field> field(FieldFactory::create(column));
-                const auto* index_meta = output_rowset_schema->get_inverted_index(column);
-                std::unique_ptr<segment_v2::InvertedIndexColumnWriter> inverted_index_builder;
-                try {
-                    RETURN_IF_ERROR(segment_v2::InvertedIndexColumnWriter::create(
-                            field.get(), &inverted_index_builder, inverted_index_file_writer.get(),
-                            index_meta));
-                } catch (const std::exception& e) {
-                    return Status::Error<ErrorCode::INVERTED_INDEX_CLUCENE_ERROR>(
-                            "CLuceneError occured: {}", e.what());
-                }
-
-                if (inverted_index_builder) {
-                    auto writer_sign = std::make_pair(seg_ptr->id(), index_id);
-                    _inverted_index_builders.insert(
-                            std::make_pair(writer_sign, std::move(inverted_index_builder)));
-                    inverted_index_writer_signs.emplace_back(writer_sign);
-                }
-            }
-
-            if (return_columns.empty()) {
-                // no columns to read
-                break;
+        // The segments are built by a pool of threads, each segment with a convertor and
+        // index writers of its own. After a failure, the segments not yet built are skipped.
+        size_t num_segments = segments.size();
+        std::vector<std::unique_ptr<InvertedIndexFileWriter>> file_writers(num_segments);
+        auto parallelism = static_cast<size_t>(
+                std::max(config::inverted_index_build_segment_parallelism, 1));
+        parallelism = std::min(parallelism, num_segments);
+        if (parallelism <= 1) {
+            for (size_t i = 0; i < num_segments; ++i) {
+                RETURN_IF_ERROR(_handle_single_segment(output_rowset_meta, segments[i],
+                                                       &file_writers[i]));
             }
-
-            _inverted_index_file_writers.emplace(seg_ptr->id(),
-                                                 std::move(inverted_index_file_writer));
-
-            // create iterator for each segment
-            StorageReadOptions read_options;
-            OlapReaderStatistics stats;
-            read_options.stats = &stats;
-            read_options.tablet_schema = output_rowset_schema;
-            std::shared_ptr<Schema> schema =
-                    std::make_shared<Schema>(output_rowset_schema->columns(), return_columns);
-            std::unique_ptr<RowwiseIterator> iter;
-            auto res = seg_ptr->new_iterator(schema, read_options, &iter);
-            if (!res.ok()) {
-                LOG(WARNING) << "failed to create iterator[" << seg_ptr->id()
-                             << "]: " << res.to_string();
-                return Status::Error<ErrorCode::ROWSET_READER_INIT>(res.to_string());
-            }
-
-            auto block = vectorized::Block::create_unique(
-                    output_rowset_schema->create_block(return_columns));
-            while (true) {
-                auto status = iter->next_batch(block.get());
-                DBUG_EXECUTE_IF("IndexBuilder::handle_single_rowset", {
-                    status = Status::Error<ErrorCode::SCHEMA_CHANGE_INFO_INVALID>(
-                            "next_batch fault injection");
-                });
-                if (!status.ok()) {
-                    if (status.is<ErrorCode::END_OF_FILE>()) {
-                        break;
+        } else {
+            std::unique_ptr<ThreadPool> build_pool;
+            RETURN_IF_ERROR(ThreadPoolBuilder("IndexBuildSegmentThreadPool")
+                                    .set_min_threads(parallelism)
+                                    .set_max_threads(parallelism)
+                                    .build(&build_pool));
+            std::vector<Status> statuses(num_segments,
+                                         Status::Cancelled("another segment failed"));
+            std::atomic<bool> failed = false;
+            for (size_t i = 0; i < num_segments; ++i) {
+                auto st = build_pool->submit_func([&, i]() {
+                    if (failed) {
+                        return;
                     }
-                    LOG(WARNING)
-                            << "failed to read next block when schema change for inverted index."
-                            << ", err=" << status.to_string();
-                    return status;
-                }
-
-                // write inverted index data
-                if (_write_inverted_index_data(output_rowset_schema, iter->data_id(),
-                                               block.get()) != Status::OK()) {
-                    return Status::Error<ErrorCode::SCHEMA_CHANGE_INFO_INVALID>(
-                            "failed to write block.");
-                }
-                block->clear_column_data();
-            }
-
-            // finish write inverted index, flush data to compound file
-            for (auto& writer_sign : inverted_index_writer_signs) {
-                try {
-                    if (_inverted_index_builders[writer_sign]) {
-                        RETURN_IF_ERROR(_inverted_index_builders[writer_sign]->finish());
+                    statuses[i] = _handle_single_segment(output_rowset_meta, segments[i],
+                                                         &file_writers[i]);
+                    if (!statuses[i]) {
+                        failed = true;
                     }
-                } catch (const std::exception& e) {
-                    return Status::Error<ErrorCode::INVERTED_INDEX_CLUCENE_ERROR>(
-                            "CLuceneError occured: {}", e.what());
+                });
+                if (!st) {
+                    statuses[i] = st;
+                    failed = true;
+                    break;
                 }
             }
-
-            _olap_data_convertor->reset();
+            build_pool->wait();
+            for (const auto& st : statuses) {
+                RETURN_IF_ERROR(st);
+            }
+        }
+        for (size_t i = 0; i < num_segments; ++i) {
+            if (file_writers[i] != nullptr) {
+                _inverted_index_file_writers.emplace(segments[i]->id(),
+                                                     std::move(file_writers[i]));
+            }
         }
+
+        size_t inverted_index_size = 0;
         for (auto&& [seg_id, inverted_index_file_writer] : _inverted_index_file_writers) {
             LOG(INFO) << "close inverted index file "
                       << inverted_index_file_writer->get_index_file_path();
@@ -449,7 +363,6 @@ Status IndexBuilder::handle_single_rowset(RowsetMetaSharedPtr output_rowset_meta
             }
             inverted_index_size += inverted_index_file_writer->get_index_file_size();
         }
-        _inverted_index_builders.clear();
         _inverted_index_file_writers.clear();
         output_rowset_meta->set_data_disk_size(output_rowset_meta->data_disk_size() +
                                                inverted_index_size);
@@ -463,11 +376,153 @@ Status IndexBuilder::handle_single_rowset(RowsetMetaSharedPtr output_rowset_meta
     return Status::OK();
 }
 
-Status IndexBuilder::_write_inverted_index_data(TabletSchemaSPtr tablet_schema, int32_t segment_idx,
-                                                vectorized::Block* block) {
+Status IndexBuilder::_handle_single_segment(
+        const RowsetMetaSharedPtr& output_rowset_meta, const segment_v2::SegmentSharedPtr& seg_ptr,
+        std::unique_ptr<InvertedIndexFileWriter>* file_writer) {
+    const auto& fs = io::global_local_filesystem();
+    auto output_rowset_schema = output_rowset_meta->tablet_schema();
+    std::string index_path_prefix {
+            InvertedIndexDescriptor::get_index_path_prefix(local_segment_path(
+                    _tablet->tablet_path(), output_rowset_meta->rowset_id().to_string(),
+                    seg_ptr->id()))};
+    std::vector<ColumnId> return_columns;
+    std::vector<std::pair<int64_t, int64_t>> inverted_index_writer_signs;
+    auto olap_data_convertor = std::make_unique<vectorized::OlapBlockDataConvertor>();
+    olap_data_convertor->reserve(_alter_inverted_indexes.size());
+    InvertedIndexBuilders inverted_index_builders;
+
+    std::unique_ptr<InvertedIndexFileWriter> inverted_index_file_writer = nullptr;
+    if (output_rowset_schema->get_inverted_index_storage_format() !=
+        InvertedIndexStorageFormatPB::V1) {
+        auto idx_file_reader_iter = _inverted_index_file_readers.find(
+                std::make_pair(output_rowset_meta->rowset_id().to_string(), seg_ptr->id()));
+        if (idx_file_reader_iter == _inverted_index_file_readers.end()) {
+            LOG(ERROR) << "idx_file_reader_iter" << output_rowset_meta->rowset_id() << ":"
+                       << seg_ptr->id() << " cannot be found";
+            return Status::OK();
+        }
+        auto dirs = DORIS_TRY(idx_file_reader_iter->second->get_all_directories());
+        inverted_index_file_writer = std::make_unique<InvertedIndexFileWriter>(
+                fs, index_path_prefix, output_rowset_meta->rowset_id().to_string(),
+                seg_ptr->id(), output_rowset_schema->get_inverted_index_storage_format());
+        RETURN_IF_ERROR(inverted_index_file_writer->initialize(dirs));
+    } else {
+        inverted_index_file_writer = std::make_unique<InvertedIndexFileWriter>(
+                fs, index_path_prefix, output_rowset_meta->rowset_id().to_string(),
+                seg_ptr->id(), output_rowset_schema->get_inverted_index_storage_format());
+    }
+    // create inverted index writer
+    for (auto inverted_index : _alter_inverted_indexes) {
+        DCHECK_EQ(inverted_index.columns.size(), 1);
+        auto index_id = inverted_index.index_id;
+        auto column_name = inverted_index.columns[0];
+        auto column_idx = output_rowset_schema->field_index(column_name);
+        if (column_idx < 0) {
+            LOG(WARNING) << "referenced column was missing. "
+                         << "[column=" << column_name << " referenced_column=" << column_idx
+                         << "]";
+            continue;
+        }
+        auto column = output_rowset_schema->column(column_idx);
+        if (!InvertedIndexColumnWriter::check_column_valid(column)) {
+            continue;
+        }
+        DCHECK(output_rowset_schema->has_inverted_index_with_index_id(index_id, ""));
+        olap_data_convertor->add_column_data_convertor(column);
+        return_columns.emplace_back(column_idx);
+        std::unique_ptr<Field> field(FieldFactory::create(column));
+        const auto* index_meta = output_rowset_schema->get_inverted_index(column);
+        std::unique_ptr<segment_v2::InvertedIndexColumnWriter> inverted_index_builder;
+        try {
+            RETURN_IF_ERROR(segment_v2::InvertedIndexColumnWriter::create(
+                    field.get(), &inverted_index_builder, inverted_index_file_writer.get(),
+                    index_meta));
+        } catch (const std::exception& e) {
+            return Status::Error<ErrorCode::INVERTED_INDEX_CLUCENE_ERROR>(
+                    "CLuceneError occured: {}", e.what());
+        }
+
+        if (inverted_index_builder) {
+            auto writer_sign = std::make_pair(seg_ptr->id(), index_id);
+            inverted_index_builders.insert(
+                    std::make_pair(writer_sign, std::move(inverted_index_builder)));
+            inverted_index_writer_signs.emplace_back(writer_sign);
+        }
+    }
+
+    if (return_columns.empty()) {
+        // no columns to read
+        return Status::OK();
+    }
+
+    // create iterator for the segment, which reads only the indexed columns and reuses the
+    // pages already in the page cache
+    StorageReadOptions read_options;
+    OlapReaderStatistics stats;
+    read_options.stats = &stats;
+    read_options.tablet_schema = output_rowset_schema;
+    read_options.use_page_cache = !config::disable_storage_page_cache;
+    std::shared_ptr<Schema> schema =
+            std::make_shared<Schema>(output_rowset_schema->columns(), return_columns);
+    std::unique_ptr<RowwiseIterator> iter;
+    auto res = seg_ptr->new_iterator(schema, read_options, &iter);
+    if (!res.ok()) {
+        LOG(WARNING) << "failed to create iterator[" << seg_ptr->id()
+                     << "]: " << res.to_string();
+        return Status::Error<ErrorCode::ROWSET_READER_INIT>(res.to_string());
+    }
+
+    auto block = vectorized::Block::create_unique(
+            output_rowset_schema->create_block(return_columns));
+    while (true) {
+        auto status = iter->next_batch(block.get());
+        DBUG_EXECUTE_IF("IndexBuilder::handle_single_rowset", {
+            status = Status::Error<ErrorCode::SCHEMA_CHANGE_INFO_INVALID>(
+                    "next_batch fault injection");
+        });
+        if (!status.ok()) {
+            if (status.is<ErrorCode::END_OF_FILE>()) {
+                break;
+            }
+            LOG(WARNING) << "failed to read next block when schema change for inverted index."
+                         << ", err=" << status.to_string();
+            return status;
+        }
+
+        // write inverted index data
+        if (_write_inverted_index_data(output_rowset_schema, iter->data_id(), block.get(),
+                                       olap_data_convertor.get(),
+                                       inverted_index_builders) != Status::OK()) {
+            return Status::Error<ErrorCode::SCHEMA_CHANGE_INFO_INVALID>(
+                    "failed to write block.");
+        }
+        block->clear_column_data();
+    }
+
+    // finish write inverted index, flush data to compound file
+    for (auto& writer_sign : inverted_index_writer_signs) {
+        try {
+            if (inverted_index_builders[writer_sign]) {
+                RETURN_IF_ERROR(inverted_index_builders[writer_sign]->finish());
+            }
+        } catch (const std::exception& e) {
+            return Status::Error<ErrorCode::INVERTED_INDEX_CLUCENE_ERROR>(
+                    "CLuceneError occured: {}", e.what());
+        }
+    }
+
+    olap_data_convertor->reset();
+    *file_writer = std::move(inverted_index_file_writer);
+    return Status::OK();
+}
+
+Status IndexBuilder::_write_inverted_index_data(
+        TabletSchemaSPtr tablet_schema, int32_t segment_idx, vectorized::Block* block,
+        vectorized::OlapBlockDataConvertor* olap_data_convertor,
+        InvertedIndexBuilders& inverted_index_builders) {
     VLOG_DEBUG << "begin to write inverted index";
     // converter block data
-    _olap_data_convertor->set_source_content(block, 0, block->rows());
+    olap_data_convertor->set_source_content(block, 0, block->rows());
     for (auto i = 0; i < _alter_inverted_indexes.size(); ++i) {
         auto inverted_index = _alter_inverted_indexes[i];
         auto index_id = inverted_index.index_id;
@@ -479,29 +534,30 @@ Status IndexBuilder::_write_inverted_index_data(TabletSchemaSPtr tablet_schema,
             continue;
         }
         auto column = tablet_schema->column(column_idx);
-        auto writer_sign = std::make_pair(segment_idx, index_id);
+        auto* index_builder = inverted_index_builders[std::make_pair(segment_idx, index_id)].get();
         std::unique_ptr<Field> field(FieldFactory::create(column));
-        auto converted_result = _olap_data_convertor->convert_column_data(i);
+        auto converted_result = olap_data_convertor->convert_column_data(i);
         if (converted_result.first != Status::OK()) {
             LOG(WARNING) << "failed to convert block, errcode: " << converted_result.first;
             return converted_result.first;
         }
         const auto* ptr = (const uint8_t*)converted_result.second->get_data();
         if (converted_result.second->get_nullmap()) {
-            RETURN_IF_ERROR(_add_nullable(column_name, writer_sign, field.get(),
+            RETURN_IF_ERROR(_add_nullable(column_name, index_builder, field.get(),
                                           converted_result.second->get_nullmap(), &ptr,
                                           block->rows()));
         } else {
-            RETURN_IF_ERROR(_add_data(column_name, writer_sign, field.get(), &ptr, block->rows()));
+            RETURN_IF_ERROR(
+                    _add_data(column_name, index_builder, field.get(), &ptr, block->rows()));
         }
     }
-    _olap_data_convertor->clear_source_content();
+    olap_data_convertor->clear_source_content();
 
     return Status::OK();
 }
 
 Status IndexBuilder::_add_nullable(const std::string& column_name,
-                                   const std::pair<int64_t, int64_t>& index_writer_sign,
+                                   segment_v2::InvertedIndexColumnWriter* index_builder,
                                    Field* field, const uint8_t* null_map, const uint8_t** ptr,
                                    size_t num_rows) {
     size_t offset = 0;
@@ -529,7 +585,7 @@ Status IndexBuilder::_add_nullable(const std::string& column_name,
             if (element_cnt > 0) {
                 auto data = *(data_ptr + 2);
                 auto nested_null_map = *(data_ptr + 3);
-                RETURN_IF_ERROR(_inverted_index_builders[index_writer_sign]->add_array_values(
+                RETURN_IF_ERROR(index_builder->add_array_values(
                         field->get_sub_field(0)->size(), reinterpret_cast<const void*>(data),
                         reinterpret_cast<const uint8_t*>(nested_null_map), offsets_ptr, num_rows));
             }
@@ -544,9 +600,9 @@ Status IndexBuilder::_add_nullable(const std::string& column_name,
         do {
             auto step = next_run_step();
             if (null_map[offset]) {
-                RETURN_IF_ERROR(_inverted_index_builders[index_writer_sign]->add_nulls(step));
+                RETURN_IF_ERROR(index_builder->add_nulls(step));
             } else {
-                RETURN_IF_ERROR(_inverted_index_builders[index_writer_sign]->add_values(
+                RETURN_IF_ERROR(index_builder->add_values(
                         column_name, *ptr, step));
             }
             *ptr += field->size() * step;
@@ -561,7 +617,7 @@ Status IndexBuilder::_add_nullable(const std::string& column_name,
 }
 
 Status IndexBuilder::_add_data(const std::string& column_name,
-                               const std::pair<int64_t, int64_t>& index_writer_sign, Field* field,
+                               segment_v2::InvertedIndexColumnWriter* index_builder, Field* field,
                                const uint8_t** ptr, size_t num_rows) {
     try {
         if (field->type() == FieldType::OLAP_FIELD_TYPE_ARRAY) {
@@ -575,12 +631,12 @@ Status IndexBuilder::_add_data(const std::string& column_name,
             if (element_cnt > 0) {
                 auto data = *(data_ptr + 2);
                 auto nested_null_map = *(data_ptr + 3);
-                RETURN_IF_ERROR(_inverted_index_builders[index_writer_sign]->add_array_values(
+                RETURN_IF_ERROR(index_builder->add_array_values(
                         field->get_sub_field(0)->size(), reinterpret_cast<const void*>(data),
                         reinterpret_cast<const uint8_t*>(nested_null_map), offsets_ptr, num_rows));
             }
         } else {
-            RETURN_IF_ERROR(_inverted_index_builders[index_writer_sign]->add_values(
+            RETURN_IF_ERROR(index_builder->add_values(
                     column_name, *ptr, num_rows));
         }
     } catch (const std::exception& e) {
@@ -59,13 +59,25 @@ public:
     void gc_output_rowset();
 
 private:
+    // "<segment_id, index_id>" -> InvertedIndexColumnWriter
+    using InvertedIndexBuilders =
+            std::unordered_map<std::pair<int64_t, int64_t>,
+                               std::unique_ptr<segment_v2::InvertedIndexColumnWriter>>;
+
+    // Builds the added indexes of a segment, with a convertor and index writers of its own,
+    // into a file writer which is left null if the segment has nothing to build.
+    Status _handle_single_segment(const RowsetMetaSharedPtr& output_rowset_meta,
+                                  const segment_v2::SegmentSharedPtr& seg_ptr,
+                                  std::unique_ptr<InvertedIndexFileWriter>* file_writer);
     Status _write_inverted_index_data(TabletSchemaSPtr tablet_schema, int32_t segment_idx,
-                                      vectorized::Block* block);
+                                      vectorized::Block* block,
+                                      vectorized::OlapBlockDataConvertor* olap_data_convertor,
+                                      InvertedIndexBuilders& inverted_index_builders);
     Status _add_data(const std::string& column_name,
-                     const std::pair<int64_t, int64_t>& index_writer_sign, Field* field,
+                     segment_v2::InvertedIndexColumnWriter* index_builder, Field* field,
                      const uint8_t** ptr, size_t num_rows);
     Status _add_nullable(const std::string& column_name,
-                         const std::pair<int64_t, int64_t>& index_writer_sign, Field* field,
+                         segment_v2::InvertedIndexColumnWriter* index_builder, Field* field,
                          const uint8_t* null_map, const uint8_t** ptr, size_t num_rows);
 
 private:
@@ -80,11 +92,6 @@ private:
     std::vector<RowsetSharedPtr> _output_rowsets;
     std::vector<PendingRowsetGuard> _pending_rs_guards;
     std::vector<RowsetReaderSharedPtr> _input_rs_readers;
-    std::unique_ptr<vectorized::OlapBlockDataConvertor> _olap_data_convertor;
-    // "<segment_id, index_id>" -> InvertedIndexColumnWriter
-    std::unordered_map<std::pair<int64_t, int64_t>,
-                       std::unique_ptr<segment_v2::InvertedIndexColumnWriter>>
-            _inverted_index_builders;
     std::unordered_map<int64_t, std::unique_ptr<InvertedIndexFileWriter>>
             _inverted_index_file_writers;
     // <rowset_id, segment_id>
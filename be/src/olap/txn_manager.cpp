@@ -480,15 +480,23 @@ Status TxnManager::publish_txn(OlapMeta* meta, TPartitionId partition_id,
         }
     });
     // update delete_bitmap
+    // The delete bitmap is saved with the rowset meta in one write batch, which saves a meta
+    // write per tablet and never leaves the delete bitmap of an unpublished version behind.
+    std::string delete_bitmap_key;
+    std::string delete_bitmap_value;
+    std::vector<OlapMeta::BatchEntry> delete_bitmap_entries;
     if (tablet_txn_info->unique_key_merge_on_write) {
         int64_t t2 = MonotonicMicros();
         RETURN_IF_ERROR(
                 Tablet::update_delete_bitmap(tablet, tablet_txn_info.get(), transaction_id));
         int64_t t3 = MonotonicMicros();
         stats->calc_delete_bitmap_time_us = t3 - t2;
-        RETURN_IF_ERROR(TabletMetaManager::save_delete_bitmap(
-                tablet->data_dir(), tablet->tablet_id(), tablet_txn_info->delete_bitmap,
-                version.second));
+        if (!tablet_txn_info->delete_bitmap->delete_bitmap.empty()) {
+            RETURN_IF_ERROR(TabletMetaManager::serialize_delete_bitmap(
+                    tablet->tablet_id(), *tablet_txn_info->delete_bitmap, version.second,
+                    &delete_bitmap_key, &delete_bitmap_value));
+            delete_bitmap_entries.emplace_back(delete_bitmap_key, delete_bitmap_value);
+        }
         stats->save_meta_time_us = MonotonicMicros() - t3;
     }
 
@@ -507,7 +515,8 @@ Status TxnManager::publish_txn(OlapMeta* meta, TPartitionId partition_id,
     /// Step 4: save meta
     int64_t t5 = MonotonicMicros();
     auto status = RowsetMetaManager::save(meta, tablet_uid, rowset->rowset_id(),
-                                          rowset->rowset_meta()->get_rowset_pb(), enable_binlog);
+                                          rowset->rowset_meta()->get_rowset_pb(), enable_binlog,
+                                          delete_bitmap_entries);
     stats->save_meta_time_us += MonotonicMicros() - t5;
     if (!status.ok()) {
         status.append(fmt::format(", txn id: {}", transaction_id));
@@ -0,0 +1,90 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "olap/wal/wal_group_syncer.h"
+
+#include <bvar/bvar.h>
+#include <glog/logging.h>
+
+#include <chrono>
+#include <unordered_map>
+
+#include "common/config.h"
+#include "io/fs/local_file_writer.h"
+#include "util/time.h"
+
+namespace doris {
+
+bvar::Adder<int64_t> g_wal_sync_group_num("wal_sync_group_num");
+bvar::Adder<int64_t> g_wal_sync_request_num("wal_sync_request_num");
+bvar::LatencyRecorder g_wal_sync_latency("wal_sync_latency_us");
+
+Status WalGroupSyncer::sync(io::LocalFileWriter* file_writer) {
+    int64_t start_us = MonotonicMicros();
+    SyncRequest request;
+    request.file_writer = file_writer;
+    std::unique_lock l(_mutex);
+    _pending.push_back(&request);
+    g_wal_sync_request_num << 1;
+    while (!request.done) {
+        if (_syncing) {
+            _cv.wait(l);
+            continue;
+        }
+        _syncing = true;
+        if (config::group_commit_wal_sync_window_us > 0) {
+            // let the writers appending at the same time join this group
+            _cv.wait_for(l, std::chrono::microseconds(config::group_commit_wal_sync_window_us));
+        }
+        std::vector<SyncRequest*> group;
+        group.swap(_pending);
+        l.unlock();
+        _sync_group(group);
+        l.lock();
+        for (auto* r : group) {
+            r->done = true;
+        }
+        _syncing = false;
+        _cv.notify_all();
+    }
+    g_wal_sync_latency << MonotonicMicros() - start_us;
+    return request.status;
+}
+
+void WalGroupSyncer::_sync_group(std::vector<SyncRequest*>& group) {
+    g_wal_sync_group_num << 1;
+    std::unordered_map<io::LocalFileWriter*, Status> file_status;
+    for (auto* r : group) {
+        if (file_status.contains(r->file_writer)) {
+            continue;
+        }
+        file_status[r->file_writer] = r->file_writer->start_sync();
+    }
+    for (auto& [file_writer, status] : file_status) {
+        if (status.ok()) {
+            status = file_writer->sync();
+        }
+        if (!status.ok()) {
+            LOG(WARNING) << "failed to sync wal " << file_writer->path().native()
+                         << " in wal dir " << _wal_dir << ", st=" << status;
+        }
+    }
+    for (auto* r : group) {
+        r->status = file_status[r->file_writer];
+    }
+}
+
+} // namespace doris
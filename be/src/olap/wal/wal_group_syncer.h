@@ -0,0 +1,62 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+
+namespace doris {
+namespace io {
+class LocalFileWriter;
+} // namespace io
+
+// Syncs the wal files of one wal dir in groups.
+//
+// A writer calling `sync` either waits for a running group to sync its file or becomes the
+// leader of the next group: it waits config::group_commit_wal_sync_window_us for more writers,
+// starts writing back all files of the group at once so that the disk serves them together, and
+// syncs every file once however many times it was appended to. Every writer returns after its
+// data is durable or with the error of syncing its file.
+class WalGroupSyncer {
+public:
+    explicit WalGroupSyncer(std::string wal_dir) : _wal_dir(std::move(wal_dir)) {}
+
+    Status sync(io::LocalFileWriter* file_writer);
+
+    const std::string& wal_dir() const { return _wal_dir; }
+
+private:
+    struct SyncRequest {
+        io::LocalFileWriter* file_writer = nullptr;
+        bool done = false;
+        Status status;
+    };
+
+    void _sync_group(std::vector<SyncRequest*>& group);
+
+    std::string _wal_dir;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    bool _syncing = false;
+    std::vector<SyncRequest*> _pending;
+};
+
+} // namespace doris
@@ -122,10 +122,16 @@ Status WalManager::_init_wal_dirs() {
         if (!exists) {
             RETURN_IF_ERROR(io::global_local_filesystem()->create_directory(tmp_dir));
         }
+        _wal_group_syncers.emplace(wal_dir, std::make_unique<WalGroupSyncer>(wal_dir));
     }
     return Status::OK();
 }
 
+WalGroupSyncer* WalManager::get_wal_group_syncer(const std::string& wal_path) {
+    auto it = _wal_group_syncers.find(get_base_wal_path(wal_path));
+    return it == _wal_group_syncers.end() ? nullptr : it->second.get();
+}
+
 Status WalManager::_init_wal_dirs_info() {
     for (const std::string& wal_dir : _wal_dirs) {
         size_t available_bytes;
@@ -35,6 +35,7 @@
 #include "gen_cpp/HeartbeatService_types.h"
 #include "gutil/ref_counted.h"
 #include "olap/wal/wal_dirs_info.h"
+#include "olap/wal/wal_group_syncer.h"
 #include "olap/wal/wal_reader.h"
 #include "olap/wal/wal_table.h"
 #include "olap/wal/wal_writer.h"
@@ -70,6 +71,8 @@ public:
     Status get_wal_dir_available_size(const std::string& wal_dir, size_t* available_bytes);
     size_t get_max_available_size();
     std::string get_wal_dirs_info_string();
+    // the syncer of the wal dir of `wal_path`, nullptr if it is not in a wal dir
+    WalGroupSyncer* get_wal_group_syncer(const std::string& wal_path);
 
     // replay wal
     Status create_wal_path(int64_t db_id, int64_t table_id, int64_t wal_id,
@@ -130,6 +133,8 @@ private:
     std::vector<std::string> _wal_dirs;
     scoped_refptr<Thread> _update_wal_dirs_info_thread;
     std::unique_ptr<WalDirsInfo> _wal_dirs_info;
+    // wal dir to its syncer, not changed after init
+    std::unordered_map<std::string, std::unique_ptr<WalGroupSyncer>> _wal_group_syncers;
 
     // replay wal
     scoped_refptr<Thread> _replay_thread;
@@ -20,8 +20,10 @@
 #include "common/config.h"
 #include "io/fs/file_writer.h"
 #include "io/fs/local_file_system.h"
+#include "io/fs/local_file_writer.h"
 #include "io/fs/path.h"
 #include "olap/storage_engine.h"
+#include "olap/wal/wal_group_syncer.h"
 #include "olap/wal/wal_manager.h"
 #include "util/crc32c.h"
 
@@ -87,6 +89,11 @@ Status WalWriter::append_blocks(const PBlockArray& blocks) {
                 "failed to write block to wal expected= " + std::to_string(total_size) +
                 ",actually=" + std::to_string(offset));
     }
+    if (config::enable_wal_group_sync && _group_syncer != nullptr) {
+        // wal files are always created by the local file system
+        RETURN_IF_ERROR(
+                _group_syncer->sync(static_cast<io::LocalFileWriter*>(_file_writer.get())));
+    }
     return Status::OK();
 }
 
@@ -22,6 +22,7 @@
 #include "io/fs/file_reader_writer_fwd.h"
 
 namespace doris {
+class WalGroupSyncer;
 
 using PBlockArray = std::vector<PBlock*>;
 extern const char* k_wal_magic;
@@ -35,11 +36,15 @@ public:
     Status init();
     Status finalize();
 
+    // Return after the blocks are durable if a group syncer is set and
+    // config::enable_wal_group_sync is on
     Status append_blocks(const PBlockArray& blocks);
     Status append_header(std::string col_ids);
 
     std::string file_name() { return _file_name; };
 
+    void set_group_syncer(WalGroupSyncer* group_syncer) { _group_syncer = group_syncer; }
+
 public:
     static const int64_t LENGTH_SIZE = 8;
     static const int64_t CHECKSUM_SIZE = 4;
@@ -48,6 +53,7 @@ public:
 private:
     std::string _file_name;
     io::FileWriterPtr _file_writer;
+    WalGroupSyncer* _group_syncer = nullptr;
 };
 
 } // namespace doris
\ No newline at end of file
@@ -17,6 +17,8 @@
 
 #include "dependency.h"
 
+#include <bvar/latency_recorder.h>
+
 #include <memory>
 #include <mutex>
 
@@ -24,11 +26,16 @@
 #include "pipeline/exec/multi_cast_data_streamer.h"
 #include "pipeline/pipeline_fragment_context.h"
 #include "pipeline/pipeline_task.h"
+#include "pipeline/task_queue.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker.h"
+#include "util/doris_metrics.h"
+#include "util/time.h"
 #include "vec/spill/spill_stream_manager.h"
 
 namespace doris::pipeline {
+// From the registration of runtime filters to their arrival or timeout.
+bvar::LatencyRecorder g_runtime_filter_wait_latency("runtime_filter", "wait");
 
 Dependency* BasicSharedState::create_source_dependency(int operator_id, int node_id,
                                                        std::string name) {
@@ -63,9 +70,33 @@ void Dependency::set_ready() {
         _ready = true;
         local_block_task.swap(_blocked_task);
     }
-    for (auto* task : local_block_task) {
-        task->wake_up();
+    _wake_up(local_block_task);
+}
+
+void Dependency::_wake_up(const std::vector<PipelineTask*>& tasks) {
+    if (tasks.empty()) {
+        return;
+    }
+    DorisMetrics::instance()->pipeline_dependency_wake_up_total->increment(1);
+    DorisMetrics::instance()->pipeline_dependency_woken_tasks_total->increment(tasks.size());
+    if (tasks.size() == 1 || !config::enable_pipeline_batch_wake_up) {
+        for (auto* task : tasks) {
+            task->wake_up();
+        }
+        return;
+    }
+    // The tasks of one dependency belong to one fragment, so they share the task queue.
+    auto* task_queue = tasks.front()->get_task_queue();
+    std::vector<PipelineTask*> batch;
+    batch.reserve(tasks.size());
+    for (auto* task : tasks) {
+        if (task->get_task_queue() == task_queue) {
+            batch.push_back(task);
+        } else {
+            task->wake_up();
+        }
     }
+    static_cast<void>(task_queue->push_back_batch(batch));
 }
 
 Dependency* Dependency::is_blocked_by(PipelineTask* task) {
@@ -112,13 +143,21 @@ Dependency* RuntimeFilterDependency::is_blocked_by(PipelineTask* task) {
 }
 
 void RuntimeFilterTimer::call_timeout() {
+    _record_wait_latency();
     _parent->set_ready();
 }
 
 void RuntimeFilterTimer::call_ready() {
+    _record_wait_latency();
     _parent->set_ready();
 }
 
+void RuntimeFilterTimer::_record_wait_latency() {
+    if (!_parent->ready()) {
+        g_runtime_filter_wait_latency << (MonotonicMillis() - _registration_time) * 1000;
+    }
+}
+
 // should check rf timeout in two case:
 // 1. the rf is ready just remove the wait queue
 // 2. if the rf have local dependency, the rf should start wait when all local dependency is ready
@@ -372,8 +411,8 @@ void SpillSortSharedState::close() {
 }
 
 MultiCastSharedState::MultiCastSharedState(const RowDescriptor& row_desc, ObjectPool* pool,
-                                           int cast_sender_count)
+                                           int cast_sender_count, int node_id)
         : multi_cast_data_streamer(std::make_unique<pipeline::MultiCastDataStreamer>(
-                  row_desc, pool, cast_sender_count, true)) {}
+                  row_desc, pool, cast_sender_count, node_id, true)) {}
 
 } // namespace doris::pipeline
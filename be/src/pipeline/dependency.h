@@ -158,6 +158,8 @@ public:
 
 protected:
     void _add_block_task(PipelineTask* task);
+    // Push the tasks released by `set_ready` into the task queue.
+    void _wake_up(const std::vector<PipelineTask*>& tasks);
 
     const int _id;
     const int _node_id;
@@ -237,6 +239,9 @@ public:
 
 private:
     friend struct RuntimeFilterTimerQueue;
+    // Records the wait of the filter in the bvar, unless it is ready already.
+    void _record_wait_latency();
+
     std::shared_ptr<RuntimeFilterDependency> _parent = nullptr;
     std::vector<std::shared_ptr<RuntimeFilterDependency>> _local_runtime_filter_dependencies;
     std::mutex _lock;
@@ -476,9 +481,13 @@ struct PartitionedAggSharedState : public BasicSharedState,
     std::atomic_bool is_closed = false;
     std::deque<std::shared_ptr<AggSpillPartition>> spill_partitions;
 
-    size_t get_partition_index(size_t hash_value) const {
-        return (hash_value >> (32 - partition_count_bits)) & max_partition_index;
+    /// The partitions of level `i` are chosen by the `partition_count_bits` bits following the
+    /// bits of level `i - 1`, from the high bits of the 32 bits hash value.
+    size_t get_partition_index(size_t hash_value, size_t level = 0) const {
+        return (hash_value >> (32 - partition_count_bits * (level + 1))) & max_partition_index;
     }
+
+    size_t max_partition_level() const { return 32 / partition_count_bits - 1; }
 };
 
 struct AggSpillPartition {
@@ -515,6 +524,8 @@ struct AggSpillPartition {
 
     std::deque<vectorized::SpillStreamSPtr> spill_streams_;
     vectorized::SpillStreamSPtr spilling_stream_;
+    // the partitions spilled again by the source are of the next level
+    size_t level = 0;
 };
 using AggSpillPartitionSPtr = std::shared_ptr<AggSpillPartition>;
 struct SortSharedState : public BasicSharedState {
@@ -569,7 +580,8 @@ class MultiCastDataStreamer;
 
 struct MultiCastSharedState : public BasicSharedState {
 public:
-    MultiCastSharedState(const RowDescriptor& row_desc, ObjectPool* pool, int cast_sender_count);
+    MultiCastSharedState(const RowDescriptor& row_desc, ObjectPool* pool, int cast_sender_count,
+                         int node_id);
     std::unique_ptr<pipeline::MultiCastDataStreamer> multi_cast_data_streamer;
 };
 
@@ -675,6 +687,12 @@ struct NestedLoopJoinSharedState : public JoinSharedState {
     vectorized::MutableColumns build_side_visited_flags;
     // List of build blocks, constructed in prepare()
     vectorized::Blocks build_blocks;
+    // The build blocks are sorted and cut by the first band join conjunct once by the first
+    // probe instance, see NestedLoopJoinProbeOperatorX::_prepare_band_join.
+    std::once_flag band_join_once;
+    // For each build block and each band join conjunct, the rows of the min and the max value
+    // of the build column, or -1 if all its values are null.
+    std::vector<std::vector<std::pair<int, int>>> build_block_min_max;
 };
 
 struct PartitionSortNodeSharedState : public BasicSharedState {
@@ -721,6 +739,11 @@ public:
     vectorized::Block build_block; // build to source
     //record element size in hashtable
     int64_t valid_element_in_hash_tbl = 0;
+    // One bit per row of the build block, that is per hash table entry: whether the entry is
+    // still in the result, and for intersect whether the child being probed has matched it.
+    // The marks of a child are merged by a pass over the bits instead of the hash table.
+    std::vector<uint8_t> alive_rows;
+    std::vector<uint8_t> matched_rows;
     //first: idx mapped to column types
     //second: column_id, could point to origin column or cast column
     std::unordered_map<int, int> build_col_idx;
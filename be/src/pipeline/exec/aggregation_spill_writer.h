@@ -0,0 +1,278 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <deque>
+#include <vector>
+
+#include "common/status.h"
+#include "pipeline/dependency.h"
+#include "util/runtime_profile.h"
+#include "vec/core/block.h"
+#include "vec/spill/spill_stream.h"
+
+namespace doris::pipeline {
+
+/// Write the keys and the serialized aggregation states of a hash table into the spill
+/// partitions chosen by the hash of the keys.
+/// It is used by the partitioned aggregation sink to spill its hash table, and by the source
+/// to spill a partition again into the partitions of the next level, whose hash table is still
+/// too big after the partition is merged.
+class AggSpillWriter {
+public:
+    struct Counters {
+        RuntimeProfile::Counter* serialize_hash_table_timer = nullptr;
+        RuntimeProfile::Counter* serialize_block_timer = nullptr;
+        RuntimeProfile::Counter* block_count = nullptr;
+        RuntimeProfile::Counter* data_size = nullptr;
+        RuntimeProfile::Counter* write_disk_timer = nullptr;
+        RuntimeProfile::Counter* write_wait_io_timer = nullptr;
+    };
+
+    void init(PartitionedAggSharedState* shared_state, int node_id, RuntimeProfile* profile,
+              const Counters& counters) {
+        _shared_state = shared_state;
+        _node_id = node_id;
+        _profile = profile;
+        _counters = counters;
+    }
+
+    template <typename HashTableCtxType, typename HashTableType>
+    Status spill_hash_table(RuntimeState* state, HashTableCtxType& context,
+                            HashTableType& hash_table,
+                            std::deque<AggSpillPartitionSPtr>& partitions, size_t level,
+                            bool eos) {
+        DCHECK_EQ(partitions.size(), _shared_state->partition_count);
+        if (!_tmp_data_inited) {
+            _init_tmp_data();
+        }
+        context.init_iterator();
+
+        auto* in_mem_state = _shared_state->in_mem_shared_state;
+        in_mem_state->aggregate_data_container->init_once();
+
+        static int spill_batch_rows = 4096;
+        int row_count = 0;
+
+        std::vector<TmpSpillInfo<typename HashTableType::key_type>> spill_infos(
+                _shared_state->partition_count);
+        auto& iter = in_mem_state->aggregate_data_container->iterator;
+        while (iter != in_mem_state->aggregate_data_container->end() && !state->is_cancelled()) {
+            const auto& key = iter.template get_key<typename HashTableType::key_type>();
+            auto partition_index = _shared_state->get_partition_index(hash_table.hash(key), level);
+            spill_infos[partition_index].keys_.emplace_back(key);
+            spill_infos[partition_index].values_.emplace_back(iter.get_aggregate_data());
+
+            if (++row_count == spill_batch_rows) {
+                row_count = 0;
+                for (int i = 0; i < _shared_state->partition_count && !state->is_cancelled();
+                     ++i) {
+                    if (spill_infos[i].keys_.size() >= spill_batch_rows) {
+                        RETURN_IF_ERROR(_spill_partition(state, context, partitions[i],
+                                                         spill_infos[i].keys_,
+                                                         spill_infos[i].values_, nullptr, false));
+                    }
+                }
+            }
+
+            ++iter;
+        }
+        auto hash_null_key_data = hash_table.has_null_key_data();
+        for (int i = 0; i < _shared_state->partition_count && !state->is_cancelled(); ++i) {
+            auto spill_null_key_data =
+                    (hash_null_key_data && i == _shared_state->partition_count - 1);
+            if (spill_infos[i].keys_.size() > 0 || spill_null_key_data) {
+                RETURN_IF_ERROR(_spill_partition(
+                        state, context, partitions[i], spill_infos[i].keys_,
+                        spill_infos[i].values_,
+                        spill_null_key_data ? hash_table.template get_null_key_data<
+                                                      vectorized::AggregateDataPtr>()
+                                            : nullptr,
+                        true));
+            }
+        }
+
+        for (auto& partition : partitions) {
+            RETURN_IF_ERROR(partition->finish_current_spilling(eos));
+        }
+        if (eos) {
+            clear_tmp_data();
+        }
+        return Status::OK();
+    }
+
+    void clear_tmp_data() {
+        {
+            vectorized::Block empty_block;
+            block_.swap(empty_block);
+        }
+        {
+            vectorized::Block empty_block;
+            key_block_.swap(empty_block);
+        }
+        {
+            vectorized::Block empty_block;
+            value_block_.swap(empty_block);
+        }
+        {
+            vectorized::MutableColumns cols;
+            key_columns_.swap(cols);
+        }
+        {
+            vectorized::MutableColumns cols;
+            value_columns_.swap(cols);
+        }
+
+        vectorized::DataTypes tmp_value_data_types;
+        value_data_types_.swap(tmp_value_data_types);
+        _tmp_data_inited = false;
+    }
+
+private:
+    template <typename KeyType>
+    struct TmpSpillInfo {
+        std::vector<KeyType> keys_;
+        std::vector<vectorized::AggregateDataPtr> values_;
+    };
+
+    void _init_tmp_data() {
+        auto* in_mem_state = _shared_state->in_mem_shared_state;
+        for (const auto& probe_expr_ctx : in_mem_state->probe_expr_ctxs) {
+            key_columns_.emplace_back(probe_expr_ctx->root()->data_type()->create_column());
+        }
+        for (const auto& aggregate_evaluator : in_mem_state->aggregate_evaluators) {
+            value_data_types_.emplace_back(aggregate_evaluator->function()->get_serialized_type());
+            value_columns_.emplace_back(aggregate_evaluator->function()->create_serialize_column());
+        }
+        _tmp_data_inited = true;
+    }
+
+    template <typename HashTableCtxType, typename KeyType>
+    Status _spill_partition(RuntimeState* state, HashTableCtxType& context,
+                            AggSpillPartitionSPtr& spill_partition, std::vector<KeyType>& keys,
+                            std::vector<vectorized::AggregateDataPtr>& values,
+                            const vectorized::AggregateDataPtr null_key_data, bool is_last) {
+        vectorized::SpillStreamSPtr spill_stream;
+        auto status = spill_partition->get_spill_stream(state, _node_id, _profile, spill_stream);
+        RETURN_IF_ERROR(status);
+        spill_stream->set_write_counters(_counters.serialize_block_timer, _counters.block_count,
+                                         _counters.data_size, _counters.write_disk_timer,
+                                         _counters.write_wait_io_timer);
+
+        status = _to_block(context, keys, values, null_key_data);
+        RETURN_IF_ERROR(status);
+
+        if (is_last) {
+            std::vector<KeyType> tmp_keys;
+            std::vector<vectorized::AggregateDataPtr> tmp_values;
+            keys.swap(tmp_keys);
+            values.swap(tmp_values);
+
+        } else {
+            keys.clear();
+            values.clear();
+        }
+        status = spill_stream->prepare_spill();
+        RETURN_IF_ERROR(status);
+
+        {
+            SCOPED_TIMER(_counters.write_disk_timer);
+            status = spill_stream->spill_block(state, block_, false);
+        }
+        RETURN_IF_ERROR(status);
+        status = spill_partition->flush_if_full();
+        _reset_tmp_data();
+        return status;
+    }
+
+    template <typename HashTableCtxType, typename KeyType>
+    Status _to_block(HashTableCtxType& context, std::vector<KeyType>& keys,
+                     std::vector<vectorized::AggregateDataPtr>& values,
+                     const vectorized::AggregateDataPtr null_key_data) {
+        SCOPED_TIMER(_counters.serialize_hash_table_timer);
+        auto* in_mem_state = _shared_state->in_mem_shared_state;
+        context.insert_keys_into_columns(keys, key_columns_, keys.size());
+
+        if (null_key_data) {
+            // only one key of group by support wrap null key
+            // here need additional processing logic on the null key / value
+            CHECK(key_columns_.size() == 1);
+            CHECK(key_columns_[0]->is_nullable());
+            key_columns_[0]->insert_data(nullptr, 0);
+
+            values.emplace_back(null_key_data);
+        }
+
+        for (size_t i = 0; i < in_mem_state->aggregate_evaluators.size(); ++i) {
+            in_mem_state->aggregate_evaluators[i]->function()->serialize_to_column(
+                    values, in_mem_state->offsets_of_aggregate_states[i], value_columns_[i],
+                    values.size());
+        }
+
+        vectorized::ColumnsWithTypeAndName key_columns_with_schema;
+        for (int i = 0; i < key_columns_.size(); ++i) {
+            key_columns_with_schema.emplace_back(
+                    std::move(key_columns_[i]),
+                    in_mem_state->probe_expr_ctxs[i]->root()->data_type(),
+                    in_mem_state->probe_expr_ctxs[i]->root()->expr_name());
+        }
+        key_block_ = key_columns_with_schema;
+
+        vectorized::ColumnsWithTypeAndName value_columns_with_schema;
+        for (int i = 0; i < value_columns_.size(); ++i) {
+            value_columns_with_schema.emplace_back(
+                    std::move(value_columns_[i]), value_data_types_[i],
+                    in_mem_state->aggregate_evaluators[i]->function()->get_name());
+        }
+        value_block_ = value_columns_with_schema;
+
+        for (const auto& column : key_block_.get_columns_with_type_and_name()) {
+            block_.insert(column);
+        }
+        for (const auto& column : value_block_.get_columns_with_type_and_name()) {
+            block_.insert(column);
+        }
+        return Status::OK();
+    }
+
+    void _reset_tmp_data() {
+        block_.clear();
+        key_columns_.clear();
+        value_columns_.clear();
+        key_block_.clear_column_data();
+        value_block_.clear_column_data();
+        key_columns_ = key_block_.mutate_columns();
+        value_columns_ = value_block_.mutate_columns();
+    }
+
+    PartitionedAggSharedState* _shared_state = nullptr;
+    int _node_id = 0;
+    RuntimeProfile* _profile = nullptr;
+    Counters _counters;
+
+    // temp structures during spilling
+    bool _tmp_data_inited = false;
+    vectorized::MutableColumns key_columns_;
+    vectorized::MutableColumns value_columns_;
+    vectorized::DataTypes value_data_types_;
+    vectorized::Block block_;
+    vectorized::Block key_block_;
+    vectorized::Block value_block_;
+};
+
+} // namespace doris::pipeline
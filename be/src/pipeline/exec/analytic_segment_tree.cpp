@@ -0,0 +1,110 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/exec/analytic_segment_tree.h"
+
+#include <algorithm>
+#include <set>
+#include <string>
+
+namespace doris::pipeline {
+
+bool AnalyticSegmentTree::is_supported(const vectorized::IAggregateFunction* function) {
+    // the window functions, such as first_value and lead, depend on the order of the rows
+    static const std::set<std::string> functions = {"min", "max", "sum", "count", "avg"};
+    return functions.contains(function->get_name());
+}
+
+void AnalyticSegmentTree::add_range(const vectorized::IColumn** columns, int64_t partition_start,
+                                    int64_t partition_end, int64_t frame_start, int64_t frame_end,
+                                    vectorized::AggregateDataPtr place, vectorized::Arena* arena) {
+    if (partition_start != _partition_start) {
+        _reset(partition_start);
+    }
+    int64_t begin = std::max(frame_start, partition_start) - partition_start;
+    int64_t end = std::min(frame_end, partition_end) - partition_start;
+    if (begin >= end) {
+        return;
+    }
+    _extend(columns, end);
+
+    // add the unaligned units at both ends of each level, and go up with the rest
+    int64_t width = 1;
+    for (size_t level = 0; begin < end; ++level) {
+        int64_t next_width = width * FANOUT;
+        int64_t left_end = std::min(end, (begin + next_width - 1) / next_width * next_width);
+        int64_t right_begin = std::max(left_end, end / next_width * next_width);
+        _add_units(columns, level, begin / width, left_end / width, place, arena);
+        _add_units(columns, level, right_begin / width, end / width, place, arena);
+        begin = left_end;
+        end = right_begin;
+        width = next_width;
+    }
+}
+
+void AnalyticSegmentTree::_reset(int64_t partition_start) {
+    _destroy_states();
+    _levels.clear();
+    _arena = std::make_unique<vectorized::Arena>();
+    _partition_start = partition_start;
+}
+
+void AnalyticSegmentTree::_destroy_states() {
+    for (auto& nodes : _levels) {
+        for (auto* node : nodes) {
+            _function->destroy(node);
+        }
+    }
+}
+
+void AnalyticSegmentTree::_extend(const vectorized::IColumn** columns, int64_t rows) {
+    int64_t width = FANOUT;
+    for (size_t level = 0; rows / width > 0; ++level, width *= FANOUT) {
+        if (_levels.size() <= level) {
+            _levels.emplace_back();
+        }
+        auto num_nodes = size_t(rows / width);
+        while (_levels[level].size() < num_nodes) {
+            auto index = int64_t(_levels[level].size());
+            auto* node =
+                    _arena->aligned_alloc(_function->size_of_data(), _function->align_of_data());
+            _function->create(node);
+            _levels[level].push_back(node);
+            _add_units(columns, level, index * FANOUT, (index + 1) * FANOUT, node, _arena.get());
+        }
+    }
+}
+
+void AnalyticSegmentTree::_add_units(const vectorized::IColumn** columns, size_t level,
+                                     int64_t from, int64_t to, vectorized::AggregateDataPtr place,
+                                     vectorized::Arena* arena) {
+    if (from >= to) {
+        return;
+    }
+    if (level == 0) {
+        _function->add_range_single_place(_partition_start + from, _partition_start + to,
+                                          _partition_start + from, _partition_start + to, place,
+                                          columns, arena);
+        return;
+    }
+    const auto& nodes = _levels[level - 1];
+    for (int64_t i = from; i < to; ++i) {
+        _function->merge(place, nodes[i], arena);
+    }
+}
+
+} // namespace doris::pipeline
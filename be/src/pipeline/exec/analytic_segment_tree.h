@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include "vec/aggregate_functions/aggregate_function.h"
+#include "vec/common/arena.h"
+
+namespace doris::pipeline {
+
+/// A segment tree of the aggregation states of the rows of a partition, which aggregates a
+/// sliding frame by merging O(log n) states instead of adding all the rows of the frame.
+/// A node of the first level aggregates FANOUT rows, a node of the next levels merges FANOUT
+/// nodes of the level below. The nodes are built as the frames reach the rows, so the rows of
+/// a partition may still be arriving.
+class AnalyticSegmentTree {
+public:
+    explicit AnalyticSegmentTree(const vectorized::IAggregateFunction* function)
+            : _function(function) {}
+
+    ~AnalyticSegmentTree() { _destroy_states(); }
+
+    /// Whether the states of the function can be merged in any order into the aggregation of
+    /// a frame.
+    static bool is_supported(const vectorized::IAggregateFunction* function);
+
+    /// Add the rows of [frame_start, frame_end) in the partition into `place`, the tree is
+    /// rebuilt if the partition is not the one of the last call.
+    void add_range(const vectorized::IColumn** columns, int64_t partition_start,
+                   int64_t partition_end, int64_t frame_start, int64_t frame_end,
+                   vectorized::AggregateDataPtr place, vectorized::Arena* arena);
+
+private:
+    static constexpr int64_t FANOUT = 16;
+
+    void _reset(int64_t partition_start);
+    void _destroy_states();
+    // build the nodes covering the first `rows` rows of the partition
+    void _extend(const vectorized::IColumn** columns, int64_t rows);
+    // add the units [from, to) of the level into `place`, the level 0 are the rows
+    void _add_units(const vectorized::IColumn** columns, size_t level, int64_t from, int64_t to,
+                    vectorized::AggregateDataPtr place, vectorized::Arena* arena);
+
+    const vectorized::IAggregateFunction* _function = nullptr;
+    std::unique_ptr<vectorized::Arena> _arena;
+    int64_t _partition_start = -1;
+    // the nodes of each level, `_levels[i]` are the units of the level i + 1
+    std::vector<std::vector<vectorized::AggregateDataPtr>> _levels;
+};
+
+} // namespace doris::pipeline
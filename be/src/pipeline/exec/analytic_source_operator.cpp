@@ -19,6 +19,7 @@
 
 #include <string>
 
+#include "common/config.h"
 #include "pipeline/exec/operator.h"
 #include "vec/columns/column_nullable.h"
 
@@ -229,6 +230,7 @@ Status AnalyticLocalState::open(RuntimeState* state) {
 
             _executor.get_next = std::bind<Status>(&AnalyticLocalState::_get_next_for_rows, this,
                                                    std::placeholders::_1);
+            _init_segment_trees();
         }
     }
     _executor.insert_result =
@@ -278,6 +280,28 @@ void AnalyticLocalState::_destroy_agg_status() {
     }
 }
 
+void AnalyticLocalState::_init_segment_trees() {
+    auto& p = _parent->cast<AnalyticSourceOperatorX>();
+    // [unbounded preceding, current row] adds a row to the states of the previous one
+    if (!p._window.__isset.window_start &&
+        p._window.window_end.type == TAnalyticWindowBoundaryType::CURRENT_ROW) {
+        return;
+    }
+    // the frames from unbounded preceding keep growing
+    const int64_t min_frame_rows = config::analytic_segment_tree_min_frame_rows;
+    if (min_frame_rows <= 0 ||
+        (p._has_window_start && _rows_end_offset - _rows_start_offset + 1 < min_frame_rows)) {
+        return;
+    }
+    _segment_trees.resize(_agg_functions_size);
+    for (size_t i = 0; i < _agg_functions_size; ++i) {
+        const auto* function = _agg_functions[i]->function().get();
+        if (AnalyticSegmentTree::is_supported(function)) {
+            _segment_trees[i] = std::make_unique<AnalyticSegmentTree>(function);
+        }
+    }
+}
+
 //now is execute for lead/lag row_number/rank/dense_rank/ntile functions
 //sum min max count avg first_value last_value functions
 void AnalyticLocalState::_execute_for_win_func(int64_t partition_start, int64_t partition_end,
@@ -287,11 +311,16 @@ void AnalyticLocalState::_execute_for_win_func(int64_t partition_start, int64_t
         for (int j = 0; j < _shared_state->agg_input_columns[i].size(); ++j) {
             agg_columns.push_back(_shared_state->agg_input_columns[i][j].get());
         }
-        _agg_functions[i]->function()->add_range_single_place(
-                partition_start, partition_end, frame_start, frame_end,
-                _fn_place_ptr +
-                        _parent->cast<AnalyticSourceOperatorX>()._offsets_of_aggregate_states[i],
-                agg_columns.data(), nullptr);
+        auto* place = _fn_place_ptr +
+                      _parent->cast<AnalyticSourceOperatorX>()._offsets_of_aggregate_states[i];
+        if (!_segment_trees.empty() && _segment_trees[i] != nullptr) {
+            _segment_trees[i]->add_range(agg_columns.data(), partition_start, partition_end,
+                                         frame_start, frame_end, place, _agg_arena_pool.get());
+        } else {
+            _agg_functions[i]->function()->add_range_single_place(
+                    partition_start, partition_end, frame_start, frame_end, place,
+                    agg_columns.data(), nullptr);
+        }
 
         // If the end is not greater than the start, the current window should be empty.
         _current_window_empty =
@@ -554,6 +583,7 @@ Status AnalyticLocalState::close(RuntimeState* state) {
     }
 
     _destroy_agg_status();
+    _segment_trees.clear();
     _agg_arena_pool = nullptr;
 
     std::vector<vectorized::MutableColumnPtr> tmp_result_window_columns;
@@ -21,6 +21,7 @@
 
 #include "common/status.h"
 #include "operator.h"
+#include "pipeline/exec/analytic_segment_tree.h"
 
 namespace doris {
 class RuntimeState;
@@ -74,6 +75,7 @@ private:
     void _reset_agg_status();
     void _create_agg_status();
     void _destroy_agg_status();
+    void _init_segment_trees();
 
     friend class AnalyticSourceOperatorX;
 
@@ -94,6 +96,9 @@ private:
     BlockRowPos _partition_by_start;
     std::unique_ptr<vectorized::Arena> _agg_arena_pool;
     std::vector<vectorized::AggFnEvaluator*> _agg_functions;
+    // the segment trees of the functions which aggregate wide sliding ROWS frames, null for
+    // the other functions, which add the rows of each frame
+    std::vector<std::unique_ptr<AnalyticSegmentTree>> _segment_trees;
 
     RuntimeProfile::Counter* _evaluation_timer = nullptr;
     RuntimeProfile::HighWaterMarkCounter* _blocks_memory_usage = nullptr;
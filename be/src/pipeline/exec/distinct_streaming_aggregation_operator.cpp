@@ -201,6 +201,13 @@ Status DistinctStreamingAggLocalState::_distinct_pre_agg_with_serialized_key(
     _distinct_row.clear();
     _distinct_row.reserve(rows);
 
+    if (_parent->cast<DistinctStreamingAggOperatorX>()._is_streaming_preagg &&
+        _ndv_sampler.add_block(key_columns, rows)) {
+        // the reduction thresholds of the hash table apply again from the new mode
+        _stop_emplace_flag = _ndv_sampler.mode() == PreaggNdvSampler::Mode::PASSTHROUGH;
+        _should_expand_hash_table = true;
+    }
+
     if (!_stop_emplace_flag) {
         RETURN_IF_CATCH_EXCEPTION(
                 _emplace_into_hash_table_to_distinct(_distinct_row, key_columns, rows));
@@ -292,6 +299,7 @@ void DistinctStreamingAggLocalState::_emplace_into_hash_table_to_distinct(
                         using AggState = typename HashMethodType::State;
                         auto& hash_tbl = *agg_method.hash_table;
                         if (_parent->cast<DistinctStreamingAggOperatorX>()._is_streaming_preagg &&
+                            _ndv_sampler.mode() != PreaggNdvSampler::Mode::FULL &&
                             hash_tbl.add_elem_size_overflow(num_rows)) {
                             if (!_should_expand_preagg_hash_tables()) {
                                 _stop_emplace_flag = true;
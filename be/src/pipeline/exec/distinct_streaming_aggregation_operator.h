@@ -24,6 +24,7 @@
 
 #include "common/status.h"
 #include "pipeline/exec/operator.h"
+#include "pipeline/exec/preagg_ndv_sampler.h"
 #include "util/runtime_profile.h"
 #include "vec/core/block.h"
 
@@ -71,6 +72,7 @@ private:
     size_t _input_num_rows = 0;
     bool _should_expand_hash_table = true;
     bool _stop_emplace_flag = false;
+    PreaggNdvSampler _ndv_sampler;
     const int batch_size;
     std::unique_ptr<vectorized::Arena> _agg_arena_pool = nullptr;
     vectorized::AggregatedDataVariantsUPtr _agg_data = nullptr;
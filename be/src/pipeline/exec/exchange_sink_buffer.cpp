@@ -20,16 +20,19 @@
 #include <brpc/controller.h>
 #include <butil/errno.h>
 #include <butil/iobuf_inl.h>
+#include <bvar/latency_recorder.h>
 #include <fmt/format.h>
 #include <gen_cpp/Types_types.h>
 #include <glog/logging.h>
 #include <google/protobuf/stubs/callback.h>
 #include <stddef.h>
+#include <unistd.h>
 
 #include <atomic>
 #include <cstdint>
 #include <exception>
 #include <functional>
+#include <iterator>
 #include <memory>
 #include <ostream>
 #include <utility>
@@ -40,6 +43,7 @@
 #include "runtime/exec_env.h"
 #include "runtime/thread_context.h"
 #include "service/backend_options.h"
+#include "util/defer_op.h"
 #include "util/proto_util.h"
 #include "util/time.h"
 #include "vec/sink/vdata_stream_sender.h"
@@ -85,6 +89,8 @@ void BroadcastPBlockHolderMemLimiter::release(const BroadcastPBlockHolder& holde
 } // namespace vectorized
 
 namespace pipeline {
+// The round trips of the transmit rpcs of the exchanges, measured by the senders.
+bvar::LatencyRecorder g_exchange_rpc_latency("exchange", "rpc");
 
 ExchangeSinkBuffer::ExchangeSinkBuffer(PUniqueId query_id, PlanNodeId dest_node_id, int send_id,
                                        int be_number, RuntimeState* state,
@@ -267,7 +273,9 @@ Status ExchangeSinkBuffer::_send_rpc(InstanceLoId id) {
                 static_cast<void>(_send_rpc(id));
             }
         });
-        {
+        if (_should_batch(*brpc_request)) {
+            RETURN_IF_ERROR(_send_batched(id, *brpc_request, request.channel, send_callback));
+        } else {
             auto send_remote_block_closure =
                     AutoReleaseClosure<PTransmitDataParams,
                                        pipeline::ExchangeSendCallback<PTransmitDataResult>>::
@@ -345,15 +353,19 @@ Status ExchangeSinkBuffer::_send_rpc(InstanceLoId id) {
                 static_cast<void>(_send_rpc(id));
             }
         });
-        {
+        if (_should_batch(*brpc_request)) {
+            RETURN_IF_ERROR(_send_batched(id, *brpc_request, request.channel, send_callback));
+        } else {
             auto send_remote_block_closure =
                     AutoReleaseClosure<PTransmitDataParams,
                                        pipeline::ExchangeSendCallback<PTransmitDataResult>>::
                             create_unique(brpc_request, send_callback);
             if (enable_http_send_block(*brpc_request)) {
-                RETURN_IF_ERROR(transmit_block_httpv2(_context->exec_env(),
-                                                      std::move(send_remote_block_closure),
-                                                      request.channel->_brpc_dest_addr));
+                // the block is shared by the receivers, the attachment refers to its column
+                // values and keeps the holder until the rpc is done
+                RETURN_IF_ERROR(transmit_block_httpv2(
+                        _context->exec_env(), std::move(send_remote_block_closure),
+                        request.channel->_brpc_dest_addr, request.block_holder));
             } else {
                 transmit_blockv2(*request.channel->_brpc_stub,
                                  std::move(send_remote_block_closure));
@@ -370,6 +382,199 @@ Status ExchangeSinkBuffer::_send_rpc(InstanceLoId id) {
     return Status::OK();
 }
 
+namespace {
+// The closure of a batched rpc, it delivers the result to the callback of each packet.
+class BatchRpcClosure : public google::protobuf::Closure {
+public:
+    BatchRpcClosure(std::weak_ptr<TaskExecutionContext> weak_task_ctx, BatchRpcLane* lane, std::vector<BatchedPacket>&& packets,
+                    std::function<void(BatchRpcLane*, const brpc::Controller&,
+                                       const PTransmitDataResult&, std::vector<BatchedPacket>&)>
+                            on_done)
+            : _weak_task_ctx(std::move(weak_task_ctx)),
+              _lane(lane),
+              _packets(std::move(packets)),
+              _on_done(std::move(on_done)) {}
+
+    void Run() override {
+        Defer defer {[&]() { delete this; }};
+        auto task_lock = _weak_task_ctx.lock();
+        if (task_lock == nullptr) {
+            // This means ExchangeSinkBuffer Ojbect already destroyed, not need run callback any more.
+            return;
+        }
+        _on_done(_lane, cntl, response, _packets);
+    }
+
+    brpc::Controller cntl;
+    PTransmitDataParams request;
+    PTransmitDataResult response;
+
+private:
+    std::weak_ptr<TaskExecutionContext> _weak_task_ctx;
+    BatchRpcLane* _lane = nullptr;
+    std::vector<BatchedPacket> _packets;
+    std::function<void(BatchRpcLane*, const brpc::Controller&, const PTransmitDataResult&,
+                       std::vector<BatchedPacket>&)>
+            _on_done;
+};
+} // namespace
+
+bool ExchangeSinkBuffer::_should_batch(const PTransmitDataParams& request) const {
+    return config::enable_exchange_batch_rpc && !enable_http_send_block(request) &&
+           request.ByteSizeLong() < config::exchange_batch_rpc_max_bytes;
+}
+
+BatchRpcLane* ExchangeSinkBuffer::_get_batch_lane(vectorized::PipChannel* channel,
+                                                  const PTransmitDataParams& request) {
+    auto key = fmt::format("{}:{}", channel->_brpc_dest_addr.hostname,
+                           channel->_brpc_dest_addr.port);
+    std::lock_guard<std::mutex> l(_batch_lanes_lock);
+    auto& lane = _batch_lanes[key];
+    if (lane == nullptr) {
+        lane = std::make_unique<BatchRpcLane>();
+        lane->stub = channel->_brpc_stub;
+        lane->timeout_ms = channel->_brpc_timeout_ms;
+        lane->header.CopyFrom(request);
+        lane->header.clear_block();
+        lane->header.clear_exec_status();
+        lane->header.set_eos(false);
+        if (config::enable_exchange_shm_transport &&
+            channel->_brpc_dest_addr.hostname == BackendOptions::get_localhost() &&
+            channel->_brpc_dest_addr.port != config::brpc_port) {
+            static std::atomic<int64_t> s_ring_id = 0;
+            auto name = fmt::format("/doris_exchange_{}_{}", getpid(), s_ring_id++);
+            auto st = ShmRingBuffer::create(name, config::exchange_shm_ring_bytes, &lane->ring);
+            if (!st.ok()) {
+                LOG(WARNING) << "fallback to brpc for exchange to " << key << ": " << st;
+            }
+        }
+    }
+    return lane.get();
+}
+
+Status ExchangeSinkBuffer::_send_batched(
+        InstanceLoId id, const PTransmitDataParams& request, vectorized::PipChannel* channel,
+        const std::shared_ptr<ExchangeSendCallback<PTransmitDataResult>>& callback) {
+    BatchedPacket packet {id, {}, callback};
+    RETURN_IF_ERROR(append_length_prefixed_message(request, &packet.data));
+    auto* lane = _get_batch_lane(channel, request);
+    std::vector<BatchedPacket> packets;
+    {
+        std::lock_guard<std::mutex> l(lane->lock);
+        auto now = GetCurrentTimeNanos();
+        if (lane->pending.empty()) {
+            lane->first_pending_ns = now;
+        }
+        lane->pending_bytes += packet.data.size();
+        lane->pending.emplace_back(std::move(packet));
+        if (lane->inflight == 0 ||
+            (lane->ring == nullptr &&
+             (lane->pending_bytes >= config::exchange_batch_rpc_max_bytes ||
+              now - lane->first_pending_ns >= config::exchange_batch_rpc_max_latency_us * 1000))) {
+            packets = _take_batch(lane);
+        }
+    }
+    if (!packets.empty()) {
+        _send_batch(lane, std::move(packets));
+    }
+    return Status::OK();
+}
+
+std::vector<BatchedPacket> ExchangeSinkBuffer::_take_batch(BatchRpcLane* lane) {
+    std::vector<BatchedPacket> packets;
+    int64_t bytes = 0;
+    size_t num = 0;
+    while (num < lane->pending.size() &&
+           (num == 0 || bytes + lane->pending[num].data.size() <=
+                                config::exchange_batch_rpc_max_bytes)) {
+        bytes += lane->pending[num].data.size();
+        ++num;
+    }
+    packets.reserve(num);
+    std::move(lane->pending.begin(), lane->pending.begin() + num, std::back_inserter(packets));
+    lane->pending.erase(lane->pending.begin(), lane->pending.begin() + num);
+    lane->pending_bytes -= bytes;
+    lane->first_pending_ns = GetCurrentTimeNanos();
+    lane->inflight++;
+    return packets;
+}
+
+void ExchangeSinkBuffer::_send_batch(BatchRpcLane* lane, std::vector<BatchedPacket>&& packets) {
+    _batch_rpc_count++;
+    _batched_packet_count += packets.size();
+    butil::IOBuf attachment;
+    for (auto& packet : packets) {
+        attachment.append(std::move(packet.data));
+    }
+    // The ring is drained by the receiver before the previous rpc returns, it is only full if
+    // the batch is larger than the ring.
+    if (lane->ring != nullptr && lane->ring->try_write(attachment)) {
+        attachment.clear();
+        ShmRingBuffer::append_doorbell(lane->ring->name(), packets.size(), &attachment);
+        _shm_packet_count += packets.size();
+    }
+    auto* closure = new BatchRpcClosure(
+            weak_task_exec_ctx(), lane, std::move(packets),
+            [this](BatchRpcLane* lane, const brpc::Controller& cntl,
+                   const PTransmitDataResult& result, std::vector<BatchedPacket>& packets) {
+                _on_batch_done(lane, cntl, result, packets);
+            });
+    closure->request.CopyFrom(lane->header);
+    closure->cntl.request_attachment().swap(attachment);
+    closure->cntl.set_timeout_ms(lane->timeout_ms);
+    if (config::exchange_sink_ignore_eovercrowded) {
+        closure->cntl.ignore_eovercrowded();
+    }
+    lane->stub->transmit_block(&closure->cntl, &closure->request, &closure->response, closure);
+}
+
+void ExchangeSinkBuffer::_on_batch_done(BatchRpcLane* lane, const brpc::Controller& cntl,
+                                        const PTransmitDataResult& result,
+                                        std::vector<BatchedPacket>& packets) {
+    // attach task for memory tracker and query id when core
+    SCOPED_ATTACH_TASK(_state);
+    std::vector<std::unique_ptr<PStatus>> statuses;
+    Status st;
+    if (!cntl.Failed()) {
+        st = Status::create(result.status());
+        if (st.ok()) {
+            st = parse_length_prefixed_messages(cntl.response_attachment(), &statuses);
+        }
+        if (st.ok() && statuses.size() != packets.size()) {
+            st = Status::InternalError("batched rpc returns {} status for {} packets",
+                                       statuses.size(), packets.size());
+        }
+    }
+    // The callbacks send the next packets of their instances, which are pending in the lane
+    // since this rpc is still counted as in flight, so that they are packed together.
+    for (size_t i = 0; i < packets.size(); ++i) {
+        auto callback = packets[i].callback.lock();
+        if (callback == nullptr) {
+            continue;
+        }
+        if (cntl.Failed()) {
+            callback->cntl_->SetFailed(cntl.ErrorCode(), "%s", cntl.ErrorText().c_str());
+        } else if (!st.ok()) {
+            st.to_protobuf(callback->response_->mutable_status());
+        } else {
+            callback->response_->mutable_status()->Swap(statuses[i].get());
+        }
+        callback->response_->set_receive_time(result.receive_time());
+        callback->call();
+    }
+    std::vector<BatchedPacket> next_packets;
+    {
+        std::lock_guard<std::mutex> l(lane->lock);
+        lane->inflight--;
+        if (!lane->pending.empty() && (lane->ring == nullptr || lane->inflight == 0)) {
+            next_packets = _take_batch(lane);
+        }
+    }
+    if (!next_packets.empty()) {
+        _send_batch(lane, std::move(next_packets));
+    }
+}
+
 void ExchangeSinkBuffer::_construct_request(InstanceLoId id, PUniqueId finst_id) {
     _instance_to_request[id] = std::make_shared<PTransmitDataParams>();
     _instance_to_request[id]->mutable_finst_id()->CopyFrom(finst_id);
@@ -456,6 +661,7 @@ int64_t ExchangeSinkBuffer::get_sum_rpc_time() {
 void ExchangeSinkBuffer::set_rpc_time(InstanceLoId id, int64_t start_rpc_time,
                                       int64_t receive_rpc_time) {
     _rpc_count++;
+    g_exchange_rpc_latency << (GetCurrentTimeNanos() - start_rpc_time) / 1000;
     int64_t rpc_spend_time = receive_rpc_time - start_rpc_time;
     DCHECK(_instance_to_rpc_time.find(id) != _instance_to_rpc_time.end());
     if (rpc_spend_time > 0) {
@@ -479,6 +685,17 @@ void ExchangeSinkBuffer::update_profile(RuntimeProfile* profile) {
     int64_t sum_time = get_sum_rpc_time();
     _sum_rpc_timer->set(sum_time);
     _avg_rpc_timer->set(sum_time / std::max(static_cast<int64_t>(1), _rpc_count.load()));
+
+    if (_batch_rpc_count > 0) {
+        auto* batch_rpc_count = ADD_COUNTER(profile, "BatchRpcCount", TUnit::UNIT);
+        auto* batched_packet_count = ADD_COUNTER(profile, "BatchedPacketCount", TUnit::UNIT);
+        batch_rpc_count->set(_batch_rpc_count.load());
+        batched_packet_count->set(_batched_packet_count.load());
+        if (_shm_packet_count > 0) {
+            auto* shm_packet_count = ADD_COUNTER(profile, "ShmRingPacketCount", TUnit::UNIT);
+            shm_packet_count->set(_shm_packet_count.load());
+        }
+    }
 }
 
 } // namespace pipeline
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <brpc/controller.h>
+#include <butil/iobuf.h>
 #include <gen_cpp/data.pb.h>
 #include <gen_cpp/internal_service.pb.h>
 #include <gen_cpp/types.pb.h>
@@ -31,6 +32,7 @@
 #include <queue>
 #include <stack>
 #include <string>
+#include <vector>
 
 #include "common/global_types.h"
 #include "common/status.h"
@@ -38,6 +40,7 @@
 #include "runtime/runtime_state.h"
 #include "service/backend_options.h"
 #include "util/ref_count_closure.h"
+#include "util/shm_ring_buffer.h"
 
 namespace doris {
 class PTransmitDataParams;
@@ -185,6 +188,34 @@ struct ExchangeRpcContext {
     bool is_cancelled = false;
 };
 
+// A packet to one instance, which waits to be packed into a batched rpc to its backend.
+struct BatchedPacket {
+    InstanceLoId id;
+    // the length prefixed PTransmitDataParams
+    butil::IOBuf data;
+    std::weak_ptr<ExchangeSendCallback<PTransmitDataResult>> callback;
+};
+
+// The packets to the instances on one backend. A packet is sent at once if no rpc of the
+// lane is in flight, otherwise it waits for the in flight rpc and is sent with the other
+// packets arrived meanwhile, bounded by exchange_batch_rpc_max_bytes and
+// exchange_batch_rpc_max_latency_us.
+struct BatchRpcLane {
+    std::mutex lock;
+    std::shared_ptr<PBackendService_Stub> stub;
+    int32_t timeout_ms = 0;
+    // the header of all the batched rpcs, which carries no block
+    PTransmitDataParams header;
+    std::vector<BatchedPacket> pending;
+    int64_t pending_bytes = 0;
+    int64_t first_pending_ns = 0;
+    int inflight = 0;
+    // Set if the backend is another process on this host, the packets are written into the
+    // ring and the rpc only carries a doorbell. Only one rpc of such a lane is in flight, so
+    // that the receiver reads the ring in the order of the doorbells.
+    std::unique_ptr<ShmRingBuffer> ring;
+};
+
 // Each ExchangeSinkOperator have one ExchangeSinkBuffer
 class ExchangeSinkBuffer final : public HasTaskExecutionCtx {
 public:
@@ -262,6 +293,26 @@ private:
     void get_max_min_rpc_time(int64_t* max_time, int64_t* min_time);
     int64_t get_sum_rpc_time();
 
+    bool _should_batch(const PTransmitDataParams& request) const;
+    // must hold the _instance_to_package_queue_mutex[id] mutex
+    Status _send_batched(InstanceLoId id, const PTransmitDataParams& request,
+                         vectorized::PipChannel* channel,
+                         const std::shared_ptr<ExchangeSendCallback<PTransmitDataResult>>& callback);
+    BatchRpcLane* _get_batch_lane(vectorized::PipChannel* channel,
+                                  const PTransmitDataParams& request);
+    // must hold the lock of the lane
+    std::vector<BatchedPacket> _take_batch(BatchRpcLane* lane);
+    void _send_batch(BatchRpcLane* lane, std::vector<BatchedPacket>&& packets);
+    void _on_batch_done(BatchRpcLane* lane, const brpc::Controller& cntl,
+                        const PTransmitDataResult& result, std::vector<BatchedPacket>& packets);
+
+    std::mutex _batch_lanes_lock;
+    // brpc address of the backend -> lane
+    phmap::flat_hash_map<std::string, std::unique_ptr<BatchRpcLane>> _batch_lanes;
+    std::atomic<int64_t> _batch_rpc_count = 0;
+    std::atomic<int64_t> _batched_packet_count = 0;
+    std::atomic<int64_t> _shm_packet_count = 0;
+
     std::atomic<int> _total_queue_size = 0;
     std::shared_ptr<Dependency> _queue_dependency = nullptr;
     std::shared_ptr<Dependency> _finish_dependency = nullptr;
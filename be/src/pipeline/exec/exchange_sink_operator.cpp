@@ -108,6 +108,12 @@ Status ExchangeSinkLocalState::open(RuntimeState* state) {
     auto& p = _parent->cast<ExchangeSinkOperatorX>();
     _part_type = p._part_type;
     SCOPED_CONSUME_MEM_TRACKER(_mem_tracker.get());
+    if (p._adaptive_compression) {
+        _no_compression_blocks_counter =
+                ADD_COUNTER(_profile, "AdaptiveNoCompressionBlocks", TUnit::UNIT);
+        _lz4_blocks_counter = ADD_COUNTER(_profile, "AdaptiveLz4CompressionBlocks", TUnit::UNIT);
+        _zstd_blocks_counter = ADD_COUNTER(_profile, "AdaptiveZstdCompressionBlocks", TUnit::UNIT);
+    }
 
     int local_size = 0;
     for (int i = 0; i < channels.size(); ++i) {
@@ -280,6 +286,10 @@ segment_v2::CompressionTypePB ExchangeSinkLocalState::compression_type() const {
     return _parent->cast<ExchangeSinkOperatorX>()._compression_type;
 }
 
+bool ExchangeSinkLocalState::adaptive_compression() const {
+    return _parent->cast<ExchangeSinkOperatorX>()._adaptive_compression;
+}
+
 ExchangeSinkOperatorX::ExchangeSinkOperatorX(
         RuntimeState* state, const RowDescriptor& row_desc, int operator_id,
         const TDataStreamSink& sink, const std::vector<TPlanFragmentDestination>& destinations)
@@ -325,6 +335,7 @@ Status ExchangeSinkOperatorX::prepare(RuntimeState* state) {
 Status ExchangeSinkOperatorX::open(RuntimeState* state) {
     DCHECK(state != nullptr);
     _compression_type = state->fragement_transmission_compression_type();
+    _adaptive_compression = state->fragment_transmission_compression_adaptive();
     return Status::OK();
 }
 
@@ -105,6 +105,7 @@ public:
 
     std::string name_suffix() override;
     segment_v2::CompressionTypePB compression_type() const;
+    bool adaptive_compression() const;
     std::string debug_string(int indentation_level) const override;
     static Status empty_callback_function(void* sender, TCreatePartitionResult* result) {
         return Status::OK();
@@ -257,6 +258,7 @@ private:
     bool _transfer_large_data_by_brpc = false;
 
     segment_v2::CompressionTypePB _compression_type;
+    bool _adaptive_compression = false;
 
     // for tablet sink shuffle
     const TOlapTableSchemaParam _tablet_sink_schema;
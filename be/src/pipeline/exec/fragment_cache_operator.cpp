@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/exec/fragment_cache_operator.h"
+
+#include <charconv>
+
+#include "common/config.h"
+#include "runtime/cache/fragment_cache.h"
+
+namespace doris::pipeline {
+
+Status FragmentCacheLocalState::init(RuntimeState* state, LocalStateInfo& info) {
+    RETURN_IF_ERROR(Base::init(state, info));
+    SCOPED_TIMER(exec_time_counter());
+    SCOPED_TIMER(_init_timer);
+    _hit_counter = ADD_COUNTER(profile(), "FragmentCacheHit", TUnit::UNIT);
+    _miss_counter = ADD_COUNTER(profile(), "FragmentCacheMiss", TUnit::UNIT);
+    _insert_counter = ADD_COUNTER(profile(), "FragmentCacheInsert", TUnit::UNIT);
+
+    // the output is only a function of the tablet when the task scans a whole single tablet
+    auto* cache = FragmentCache::instance();
+    if (cache == nullptr || info.scan_ranges.size() != 1 ||
+        !info.scan_ranges[0].scan_range.__isset.palo_scan_range) {
+        return Status::OK();
+    }
+    const auto& scan_range = info.scan_ranges[0].scan_range.palo_scan_range;
+    const auto& version = scan_range.version;
+    std::from_chars(version.data(), version.data() + version.size(), _version);
+    auto& p = _parent->cast<FragmentCacheOperatorX>();
+    _key = FragmentCache::encode_key(p._digest, scan_range.tablet_id);
+    _hit = cache->lookup(_key, _version, &_blocks);
+    if (_hit) {
+        COUNTER_UPDATE(_hit_counter, 1);
+    } else {
+        COUNTER_UPDATE(_miss_counter, 1);
+        _need_insert = true;
+    }
+    return Status::OK();
+}
+
+void FragmentCacheLocalState::_collect(const vectorized::Block& block, bool eos) {
+    if (!_need_insert) {
+        return;
+    }
+    if (block.rows() > 0) {
+        _bytes += block.allocated_bytes();
+        _rows += block.rows();
+        if (_bytes > config::fragment_cache_entry_max_bytes ||
+            _rows > config::fragment_cache_entry_max_rows) {
+            // too large to be worth caching
+            _need_insert = false;
+            _blocks.clear();
+            return;
+        }
+        _blocks.push_back(FragmentCache::deep_copy(block));
+    }
+    if (eos) {
+        FragmentCache::instance()->insert(_key, _version, std::move(_blocks));
+        COUNTER_UPDATE(_insert_counter, 1);
+        _need_insert = false;
+        _blocks.clear();
+    }
+}
+
+Status FragmentCacheOperatorX::get_block(RuntimeState* state, vectorized::Block* block,
+                                         bool* eos) {
+    auto& local_state = get_local_state(state);
+    if (local_state._hit) {
+        SCOPED_TIMER(local_state.exec_time_counter());
+        if (local_state._next_block < local_state._blocks.size()) {
+            block->swap(local_state._blocks[local_state._next_block++]);
+        }
+        *eos = local_state._next_block == local_state._blocks.size();
+        local_state.add_num_rows_returned(block->rows());
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_child_x->get_block_after_projects(state, block, eos));
+    SCOPED_TIMER(local_state.exec_time_counter());
+    local_state._collect(*block, *eos);
+    local_state.add_num_rows_returned(block->rows());
+    return Status::OK();
+}
+
+} // namespace doris::pipeline
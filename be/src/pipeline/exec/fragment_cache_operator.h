@@ -0,0 +1,90 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "operator.h"
+
+namespace doris::pipeline {
+
+// Caches the output of its child, a streaming pre-aggregation over the scan of a single tablet,
+// in the FragmentCache. On a hit the scan below reads nothing, see OlapScanLocalState.
+class FragmentCacheLocalState final : public PipelineXLocalState<FakeSharedState> {
+public:
+    ENABLE_FACTORY_CREATOR(FragmentCacheLocalState);
+    using Base = PipelineXLocalState<FakeSharedState>;
+    FragmentCacheLocalState(RuntimeState* state, OperatorXBase* parent) : Base(state, parent) {}
+
+    Status init(RuntimeState* state, LocalStateInfo& info) override;
+
+    bool hit() const { return _hit; }
+
+private:
+    friend class FragmentCacheOperatorX;
+
+    void _collect(const vectorized::Block& block, bool eos);
+
+    std::string _key;
+    int64_t _version = -1;
+    bool _hit = false;
+    // whether the output of the child is collected to be inserted into the cache
+    bool _need_insert = false;
+    // the cached blocks to output on a hit, or the collected blocks on a miss
+    std::vector<vectorized::Block> _blocks;
+    size_t _next_block = 0;
+    int64_t _bytes = 0;
+    int64_t _rows = 0;
+
+    RuntimeProfile::Counter* _hit_counter = nullptr;
+    RuntimeProfile::Counter* _miss_counter = nullptr;
+    RuntimeProfile::Counter* _insert_counter = nullptr;
+};
+
+class FragmentCacheOperatorX final : public OperatorX<FragmentCacheLocalState> {
+public:
+    using Base = OperatorX<FragmentCacheLocalState>;
+    // digest is the digest of the plan of the child and of the scan below it
+    FragmentCacheOperatorX(ObjectPool* pool, int node_id, int operator_id, std::string digest)
+            : Base(pool, node_id, operator_id), _digest(std::move(digest)) {
+        _op_name = "FRAGMENT_CACHE_OPERATOR";
+    }
+
+    const RowDescriptor& intermediate_row_desc() const override {
+        return _child_x->intermediate_row_desc();
+    }
+    RowDescriptor& row_descriptor() override { return _child_x->row_descriptor(); }
+    const RowDescriptor& row_desc() const override { return _child_x->row_desc(); }
+
+    Status get_block(RuntimeState* state, vectorized::Block* block, bool* eos) override;
+
+    [[nodiscard]] bool is_source() const override { return false; }
+
+    // the output is cached per the tablet of the task, so it must not be redistributed
+    DataDistribution required_data_distribution() const override {
+        return {ExchangeType::NOOP};
+    }
+
+private:
+    friend class FragmentCacheLocalState;
+
+    const std::string _digest;
+};
+
+} // namespace doris::pipeline
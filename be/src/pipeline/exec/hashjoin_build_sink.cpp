@@ -87,6 +87,10 @@ Status HashJoinBuildSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo
     _build_side_compute_hash_timer = ADD_TIMER(record_profile, "BuildSideHashComputingTime");
 
     _allocate_resource_timer = ADD_TIMER(profile(), "AllocateResourceTime");
+    _radix_partition_bits = ADD_COUNTER(record_profile, "RadixPartitionBits", TUnit::UNIT);
+    _cooperative_build_parts = ADD_COUNTER(profile(), "CooperativeBuildParts", TUnit::UNIT);
+    _can_radix_partition = p._join_op == TJoinOp::INNER_JOIN && !p._have_other_join_conjunct &&
+                           !p._is_mark_join;
 
     // Hash Table Init
     _hash_table_init(state);
@@ -126,6 +130,9 @@ Status HashJoinBuildSinkLocalState::close(RuntimeState* state, Status exec_statu
     {
         SCOPED_TIMER(_runtime_filter_init_timer);
         if (_should_build_hash_table) {
+            if (hash_table_size > 1) {
+                _runtime_filter_slots->estimate_ndv(block);
+            }
             RETURN_IF_ERROR(_runtime_filter_slots->init_filters(state, hash_table_size));
         }
         RETURN_IF_ERROR(_runtime_filter_slots->ignore_filters(state));
@@ -133,6 +140,7 @@ Status HashJoinBuildSinkLocalState::close(RuntimeState* state, Status exec_statu
     if (_should_build_hash_table && hash_table_size > 1) {
         SCOPED_TIMER(_runtime_filter_compute_timer);
         _runtime_filter_slots->insert(block);
+        _runtime_filter_slots->update_profile(profile());
     }
 
     SCOPED_TIMER(_publish_runtime_filter_timer);
@@ -329,6 +337,27 @@ void HashJoinBuildSinkLocalState::_set_build_ignore_flag(vectorized::Block& bloc
     }
 }
 
+bool HashJoinBuildSinkLocalState::_can_build_cooperatively(size_t rows) const {
+    auto& p = _parent->cast<HashJoinBuildSinkOperatorX>();
+    return _should_build_hash_table && p._shared_hashtable_controller &&
+           config::enable_share_hash_table_cooperative_build &&
+           rows >= config::share_hash_table_cooperative_build_min_rows &&
+           p._shared_hashtable_controller->num_consumers(p.node_id()) > 0;
+}
+
+void HashJoinBuildSinkLocalState::_build_cooperatively(
+        std::function<void(int part, int num_parts)> build_part) {
+    auto& p = _parent->cast<HashJoinBuildSinkOperatorX>();
+    // one part for every instance, the parts of the consumers not scheduled in time are taken
+    // by the others
+    int num_parts = p._shared_hashtable_controller->num_consumers(p.node_id()) + 1;
+    auto task =
+            std::make_shared<vectorized::CooperativeBuildTask>(num_parts, std::move(build_part));
+    p._shared_hashtable_controller->start_cooperative_build(p.node_id(), task);
+    COUNTER_UPDATE(_cooperative_build_parts, task->run_parts());
+    task->wait();
+}
+
 void HashJoinBuildSinkLocalState::_hash_table_init(RuntimeState* state) {
     auto& p = _parent->cast<HashJoinBuildSinkOperatorX>();
     std::visit(
@@ -582,7 +611,14 @@ Status HashJoinBuildSinkOperatorX::sink(RuntimeState* state, vectorized::Block*
     } else if (!local_state._should_build_hash_table) {
         DCHECK(_shared_hashtable_controller != nullptr);
         DCHECK(_shared_hash_table_context != nullptr);
-        CHECK(_shared_hash_table_context->signaled);
+        if (!_shared_hash_table_context->signaled) {
+            // woken up to insert the rows of the hash table together with the builder
+            if (auto task = _shared_hash_table_context->cooperative_build) {
+                COUNTER_UPDATE(local_state._cooperative_build_parts, task->run_parts());
+            }
+            RETURN_IF_ERROR(_shared_hashtable_controller->wait_for_signal(
+                    state, _shared_hash_table_context));
+        }
 
         if (!_shared_hash_table_context->status.ok()) {
             return _shared_hash_table_context->status;
@@ -19,6 +19,8 @@
 
 #include <stdint.h>
 
+#include <functional>
+
 #include "join_build_sink_operator.h"
 #include "operator.h"
 
@@ -58,6 +60,10 @@ public:
 protected:
     void _hash_table_init(RuntimeState* state);
     void _set_build_ignore_flag(vectorized::Block& block, const std::vector<int>& res_col_ids);
+    // Whether the rows of the shared hash table are inserted by the builder together with the
+    // consumers, who are not woken up before.
+    bool _can_build_cooperatively(size_t rows) const;
+    void _build_cooperatively(std::function<void(int part, int num_parts)> build_part);
     Status _do_evaluate(vectorized::Block& block, vectorized::VExprContextSPtrs& exprs,
                         RuntimeProfile::Counter& expr_call_timer, std::vector<int>& res_col_ids);
     std::vector<uint16_t> _convert_block_to_null(vectorized::Block& block);
@@ -92,6 +98,8 @@ protected:
      * so null does not need to be added to the hash table.
      */
     bool _build_side_ignore_null = false;
+    // Only inner join without other conjuncts probes a radix partitioned hash table.
+    bool _can_radix_partition = false;
     std::vector<int> _build_col_ids;
     std::shared_ptr<Dependency> _finish_dependency;
 
@@ -105,6 +113,8 @@ protected:
 
     RuntimeProfile::Counter* _build_blocks_memory_usage = nullptr;
     RuntimeProfile::Counter* _hash_table_memory_usage = nullptr;
+    RuntimeProfile::Counter* _radix_partition_bits = nullptr;
+    RuntimeProfile::Counter* _cooperative_build_parts = nullptr;
     RuntimeProfile::HighWaterMarkCounter* _build_arena_memory_usage = nullptr;
 };
 
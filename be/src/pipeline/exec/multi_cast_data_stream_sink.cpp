@@ -34,7 +34,8 @@ std::string MultiCastDataStreamSinkLocalState::name_suffix() {
 
 std::shared_ptr<BasicSharedState> MultiCastDataStreamSinkOperatorX::create_shared_state() const {
     std::shared_ptr<BasicSharedState> ss =
-            std::make_shared<MultiCastSharedState>(_row_desc, _pool, _cast_sender_count);
+            std::make_shared<MultiCastSharedState>(_row_desc, _pool, _cast_sender_count,
+                                                   node_id());
     ss->id = operator_id();
     for (auto& dest : dests_id()) {
         ss->related_op_ids.insert(dest);
@@ -17,9 +17,15 @@
 
 #include "multi_cast_data_streamer.h"
 
+#include <limits>
+
+#include "common/config.h"
 #include "pipeline/dependency.h"
 #include "pipeline/exec/multi_cast_data_stream_source.h"
+#include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
+#include "util/uid_util.h"
+#include "vec/spill/spill_stream_manager.h"
 
 namespace doris::pipeline {
 
@@ -29,28 +35,49 @@ MultiCastBlock::MultiCastBlock(vectorized::Block* block, int used_count, size_t
     block->clear();
 }
 
-void MultiCastDataStreamer::pull(int sender_idx, doris::vectorized::Block* block, bool* eos) {
-    std::lock_guard l(_mutex);
-    auto& pos_to_pull = _sender_pos_to_read[sender_idx];
-    if (pos_to_pull != _multi_cast_blocks.end()) {
-        if (pos_to_pull->_used_count == 1) {
-            DCHECK(pos_to_pull == _multi_cast_blocks.begin());
-            pos_to_pull->_block->swap(*block);
+MultiCastDataStreamer::~MultiCastDataStreamer() {
+    for (auto& stream : _spill_streams) {
+        if (stream != nullptr) {
+            ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(stream);
+        }
+    }
+}
 
-            _cumulative_mem_size -= pos_to_pull->_mem_size;
-            pos_to_pull++;
-            _multi_cast_blocks.pop_front();
-        } else {
-            pos_to_pull->_used_count--;
-            pos_to_pull->_block->create_same_struct_block(0)->swap(*block);
-            (void)vectorized::MutableBlock(block).merge(*pos_to_pull->_block);
-            pos_to_pull++;
+Status MultiCastDataStreamer::pull(int sender_idx, doris::vectorized::Block* block, bool* eos) {
+    vectorized::SpillStreamSPtr spill_stream;
+    {
+        std::lock_guard l(_mutex);
+        auto& pos_to_pull = _sender_pos_to_read[sender_idx];
+        // the spill stream of the sender is not touched by push any more after the eos
+        bool spilled = _sender_spilling[sender_idx] &&
+                       (!_eos || _spill_streams[sender_idx] != nullptr);
+        if (pos_to_pull != _multi_cast_blocks.end()) {
+            if (pos_to_pull->_used_count == 1) {
+                DCHECK(pos_to_pull == _multi_cast_blocks.begin());
+                pos_to_pull->_block->swap(*block);
+
+                _cumulative_mem_size -= pos_to_pull->_mem_size;
+                pos_to_pull++;
+                _multi_cast_blocks.pop_front();
+            } else {
+                pos_to_pull->_used_count--;
+                pos_to_pull->_block->create_same_struct_block(0)->swap(*block);
+                (void)vectorized::MutableBlock(block).merge(*pos_to_pull->_block);
+                pos_to_pull++;
+            }
+        } else if (spilled && _eos) {
+            spill_stream = _spill_streams[sender_idx];
+        }
+        *eos = _eos and pos_to_pull == _multi_cast_blocks.end() && !spilled;
+        if (pos_to_pull == _multi_cast_blocks.end() && spill_stream == nullptr) {
+            _block_reading(sender_idx);
         }
     }
-    *eos = _eos and pos_to_pull == _multi_cast_blocks.end();
-    if (pos_to_pull == _multi_cast_blocks.end()) {
-        _block_reading(sender_idx);
+
+    if (spill_stream != nullptr) {
+        RETURN_IF_ERROR(spill_stream->read_next_block_sync(block, eos));
     }
+    return Status::OK();
 }
 
 void MultiCastDataStreamer::close_sender(int sender_idx) {
@@ -67,6 +94,7 @@ void MultiCastDataStreamer::close_sender(int sender_idx) {
             pos_to_pull++;
         }
     }
+    _sender_closed[sender_idx] = true;
     _closed_sender_count++;
     _block_reading(sender_idx);
 }
@@ -76,30 +104,119 @@ Status MultiCastDataStreamer::push(RuntimeState* state, doris::vectorized::Block
     COUNTER_UPDATE(_process_rows, rows);
 
     auto block_mem_size = block->allocated_bytes();
+    std::vector<int> spill_senders;
+    {
+        std::lock_guard l(_mutex);
+        int need_process_count = _cast_sender_count - _closed_sender_count;
+        if (need_process_count == 0) {
+            return Status::EndOfFile("All data streamer is EOF");
+        }
+        // the senders behind the memory window start to spill, and keep spilling until eos
+        auto max_buffer_bytes = config::multi_cast_data_streamer_max_buffer_bytes;
+        bool window_full = state->enable_spill() && max_buffer_bytes > 0 &&
+                           _cumulative_mem_size + int64_t(block_mem_size) > max_buffer_bytes;
+        for (int i = 0; i < _cast_sender_count; ++i) {
+            if (_sender_closed[i]) {
+                continue;
+            }
+            if (window_full && _sender_pos_to_read[i] != _multi_cast_blocks.end()) {
+                _sender_spilling[i] = true;
+            }
+            if (_sender_spilling[i]) {
+                spill_senders.push_back(i);
+            }
+        }
+    }
+
+    // only push writes the spill streams, so they are written out of the lock
+    if (rows > 0) {
+        for (int sender_idx : spill_senders) {
+            RETURN_IF_ERROR(_spill_block(state, sender_idx, *block));
+        }
+    }
+    if (eos) {
+        for (int sender_idx : spill_senders) {
+            if (_spill_streams[sender_idx] != nullptr) {
+                RETURN_IF_ERROR(_spill_streams[sender_idx]->spill_eof());
+                _spill_streams[sender_idx]->set_read_counters(
+                        _spill_read_data_time, _spill_deserialize_time, _spill_read_bytes,
+                        _spill_read_wait_io_timer);
+            }
+        }
+    }
+
     std::lock_guard l(_mutex);
-    int need_process_count = _cast_sender_count - _closed_sender_count;
-    if (need_process_count == 0) {
-        return Status::EndOfFile("All data streamer is EOF");
+    int used_count = 0;
+    for (int i = 0; i < _cast_sender_count; ++i) {
+        used_count += !_sender_closed[i] && !_sender_spilling[i];
     }
     // TODO: if the [queue back block rows + block->rows()] < batch_size, better
     // do merge block. but need check the need_process_count and used_count whether
     // equal
-    _multi_cast_blocks.emplace_back(block, need_process_count, block_mem_size);
-    _cumulative_mem_size += block_mem_size;
-    COUNTER_SET(_peak_mem_usage, std::max(_cumulative_mem_size, _peak_mem_usage->value()));
-
-    auto end = _multi_cast_blocks.end();
-    end--;
-    for (int i = 0; i < _sender_pos_to_read.size(); ++i) {
-        if (_sender_pos_to_read[i] == _multi_cast_blocks.end()) {
-            _sender_pos_to_read[i] = end;
-            _set_ready_for_read(i);
+    if (used_count > 0) {
+        _multi_cast_blocks.emplace_back(block, used_count, block_mem_size);
+        _cumulative_mem_size += block_mem_size;
+        COUNTER_SET(_peak_mem_usage, std::max(_cumulative_mem_size, _peak_mem_usage->value()));
+
+        auto end = _multi_cast_blocks.end();
+        end--;
+        for (int i = 0; i < _sender_pos_to_read.size(); ++i) {
+            if (_sender_pos_to_read[i] == _multi_cast_blocks.end() && !_sender_spilling[i]) {
+                _sender_pos_to_read[i] = end;
+                _set_ready_for_read(i);
+            }
         }
+    } else {
+        block->clear();
     }
     _eos = eos;
+    if (eos) {
+        for (int sender_idx : spill_senders) {
+            _set_ready_for_read(sender_idx);
+        }
+    }
     return Status::OK();
 }
 
+Status MultiCastDataStreamer::_spill_block(RuntimeState* state, int sender_idx,
+                                           const vectorized::Block& block) {
+    auto& stream = _spill_streams[sender_idx];
+    if (stream == nullptr) {
+        RETURN_IF_ERROR(ExecEnv::GetInstance()->spill_stream_mgr()->register_spill_stream(
+                state, stream, print_id(state->query_id()), "multi_cast", _node_id,
+                std::numeric_limits<int32_t>::max(), std::numeric_limits<size_t>::max(),
+                _profile));
+        RETURN_IF_ERROR(stream->prepare_spill());
+        stream->set_write_counters(_spill_serialize_block_timer, _spill_block_count,
+                                   _spill_data_size, _spill_write_disk_timer,
+                                   _spill_write_wait_io_timer);
+    }
+    COUNTER_UPDATE(_spill_rows, block.rows());
+    return stream->spill_block(state, block, false);
+}
+
+void MultiCastDataStreamer::_init_spill_counters() {
+    ADD_LABEL_COUNTER_WITH_LEVEL(profile(), "Spill", 1);
+    _spill_rows = ADD_CHILD_COUNTER_WITH_LEVEL(profile(), "SpillRows", TUnit::UNIT, "Spill", 1);
+    _spill_serialize_block_timer =
+            ADD_CHILD_TIMER_WITH_LEVEL(profile(), "SpillSerializeBlockTime", "Spill", 1);
+    _spill_block_count = ADD_CHILD_COUNTER_WITH_LEVEL(profile(), "SpillWriteBlockCount",
+                                                      TUnit::UNIT, "Spill", 1);
+    _spill_data_size =
+            ADD_CHILD_COUNTER_WITH_LEVEL(profile(), "SpillWriteDataSize", TUnit::BYTES, "Spill", 1);
+    _spill_write_disk_timer =
+            ADD_CHILD_TIMER_WITH_LEVEL(profile(), "SpillWriteDiskTime", "Spill", 1);
+    _spill_write_wait_io_timer =
+            ADD_CHILD_TIMER_WITH_LEVEL(profile(), "SpillWriteWaitIOTime", "Spill", 1);
+    _spill_read_data_time = ADD_CHILD_TIMER_WITH_LEVEL(profile(), "SpillReadDataTime", "Spill", 1);
+    _spill_deserialize_time =
+            ADD_CHILD_TIMER_WITH_LEVEL(profile(), "SpillDeserializeTime", "Spill", 1);
+    _spill_read_bytes =
+            ADD_CHILD_COUNTER_WITH_LEVEL(profile(), "SpillReadDataSize", TUnit::BYTES, "Spill", 1);
+    _spill_read_wait_io_timer =
+            ADD_CHILD_TIMER_WITH_LEVEL(profile(), "SpillReadWaitIOTime", "Spill", 1);
+}
+
 void MultiCastDataStreamer::_set_ready_for_read(int sender_idx) {
     if (_dependencies.empty()) {
         return;
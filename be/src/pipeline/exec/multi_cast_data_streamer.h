@@ -18,6 +18,7 @@
 #pragma once
 
 #include "vec/sink/vdata_stream_sender.h"
+#include "vec/spill/spill_stream.h"
 
 namespace doris::pipeline {
 
@@ -32,25 +33,35 @@ struct MultiCastBlock {
 
 // TDOD: MultiCastDataStreamer same as the data queue, maybe rethink union and refactor the
 // code
+//
+// The blocks are kept in memory until all the senders have read them. For the queries that
+// enable spill, once the blocks kept take more than multi_cast_data_streamer_max_buffer_bytes,
+// every sender which has not read all of them gets the following blocks in a spill stream of
+// its own, and reads that stream after the blocks in memory and the eos.
 class MultiCastDataStreamer {
 public:
     MultiCastDataStreamer(const RowDescriptor& row_desc, ObjectPool* pool, int cast_sender_count,
-                          bool with_dependencies = false)
+                          int node_id = 0, bool with_dependencies = false)
             : _row_desc(row_desc),
               _profile(pool->add(new RuntimeProfile("MultiCastDataStreamSink"))),
-              _cast_sender_count(cast_sender_count) {
+              _cast_sender_count(cast_sender_count),
+              _node_id(node_id) {
         _sender_pos_to_read.resize(cast_sender_count, _multi_cast_blocks.end());
+        _sender_closed.resize(cast_sender_count, false);
+        _sender_spilling.resize(cast_sender_count, false);
+        _spill_streams.resize(cast_sender_count);
         if (with_dependencies) {
             _dependencies.resize(cast_sender_count, nullptr);
         }
 
         _peak_mem_usage = ADD_COUNTER(profile(), "PeakMemUsage", TUnit::BYTES);
         _process_rows = ADD_COUNTER(profile(), "ProcessRows", TUnit::UNIT);
+        _init_spill_counters();
     };
 
-    ~MultiCastDataStreamer() = default;
+    ~MultiCastDataStreamer();
 
-    void pull(int sender_idx, vectorized::Block* block, bool* eos);
+    Status pull(int sender_idx, vectorized::Block* block, bool* eos);
 
     void close_sender(int sender_idx);
 
@@ -76,6 +87,9 @@ private:
     void _set_ready_for_read();
     void _block_reading(int sender_idx);
 
+    void _init_spill_counters();
+    Status _spill_block(RuntimeState* state, int sender_idx, const vectorized::Block& block);
+
     const RowDescriptor& _row_desc;
     RuntimeProfile* _profile = nullptr;
     std::list<MultiCastBlock> _multi_cast_blocks;
@@ -85,9 +99,25 @@ private:
     int _cast_sender_count = 0;
     int _closed_sender_count = 0;
     int64_t _cumulative_mem_size = 0;
+    const int _node_id;
+    std::vector<bool> _sender_closed;
+    // the senders whose blocks go to their spill streams, which are only written by push and
+    // only read by the sender itself after the eos
+    std::vector<bool> _sender_spilling;
+    std::vector<vectorized::SpillStreamSPtr> _spill_streams;
 
     RuntimeProfile::Counter* _process_rows = nullptr;
     RuntimeProfile::Counter* _peak_mem_usage = nullptr;
+    RuntimeProfile::Counter* _spill_rows = nullptr;
+    RuntimeProfile::Counter* _spill_serialize_block_timer = nullptr;
+    RuntimeProfile::Counter* _spill_block_count = nullptr;
+    RuntimeProfile::Counter* _spill_data_size = nullptr;
+    RuntimeProfile::Counter* _spill_write_disk_timer = nullptr;
+    RuntimeProfile::Counter* _spill_write_wait_io_timer = nullptr;
+    RuntimeProfile::Counter* _spill_read_data_time = nullptr;
+    RuntimeProfile::Counter* _spill_deserialize_time = nullptr;
+    RuntimeProfile::Counter* _spill_read_bytes = nullptr;
+    RuntimeProfile::Counter* _spill_read_wait_io_timer = nullptr;
 
     std::vector<Dependency*> _dependencies;
 };
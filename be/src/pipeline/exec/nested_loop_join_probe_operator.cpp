@@ -17,12 +17,16 @@
 
 #include "nested_loop_join_probe_operator.h"
 
+#include <algorithm>
 #include <memory>
 
+#include "common/config.h"
 #include "common/exception.h"
 #include "pipeline/exec/operator.h"
 #include "vec/columns/column_filter_helper.h"
+#include "vec/columns/column_nullable.h"
 #include "vec/core/block.h"
+#include "vec/exprs/vslot_ref.h"
 
 namespace doris {
 class RuntimeState;
@@ -30,6 +34,38 @@ class RuntimeState;
 
 namespace doris::pipeline {
 
+namespace {
+
+// The types whose values compare in the columns like in the band join conjuncts.
+bool is_band_join_type(PrimitiveType type) {
+    switch (type) {
+    case TYPE_TINYINT:
+    case TYPE_SMALLINT:
+    case TYPE_INT:
+    case TYPE_BIGINT:
+    case TYPE_LARGEINT:
+    case TYPE_DATEV2:
+    case TYPE_DATETIMEV2:
+    case TYPE_DECIMAL32:
+    case TYPE_DECIMAL64:
+    case TYPE_DECIMAL128I:
+    case TYPE_DECIMAL256:
+    case TYPE_VARCHAR:
+    case TYPE_STRING:
+        return true;
+    default:
+        return false;
+    }
+}
+
+const vectorized::IColumn& nested_column(const vectorized::IColumn& column) {
+    return column.is_nullable()
+                   ? assert_cast<const vectorized::ColumnNullable&>(column).get_nested_column()
+                   : column;
+}
+
+} // namespace
+
 NestedLoopJoinProbeLocalState::NestedLoopJoinProbeLocalState(RuntimeState* state,
                                                              OperatorXBase* parent)
         : JoinProbeLocalState<NestedLoopJoinSharedState, NestedLoopJoinProbeLocalState>(state,
@@ -42,6 +78,7 @@ Status NestedLoopJoinProbeLocalState::init(RuntimeState* state, LocalStateInfo&
     SCOPED_TIMER(exec_time_counter());
     SCOPED_TIMER(_init_timer);
     _loop_join_timer = ADD_TIMER(profile(), "LoopGenerateJoin");
+    _skipped_build_blocks_counter = ADD_COUNTER(profile(), "SkippedBuildBlocks", TUnit::UNIT);
     return Status::OK();
 }
 
@@ -128,6 +165,7 @@ Status NestedLoopJoinProbeLocalState::generate_join_block_data(RuntimeState* sta
     DCHECK(!_need_more_input_data || !_matched_rows_done);
 
     if (!_matched_rows_done && !_need_more_input_data) {
+        int64_t skipped_build_blocks = 0;
         // We should try to join rows if there still are some rows from probe side.
         while (_join_block.rows() < state->batch_size()) {
             while (_current_build_pos == _shared_state->build_blocks.size() ||
@@ -157,12 +195,19 @@ Status NestedLoopJoinProbeLocalState::generate_join_block_data(RuntimeState* sta
                 break;
             }
 
-            const auto& now_process_build_block = _shared_state->build_blocks[_current_build_pos++];
+            const size_t build_block_idx = _current_build_pos++;
+            if (!p._band_conjuncts.empty() && _skip_build_block(build_block_idx)) {
+                skipped_build_blocks++;
+                continue;
+            }
+            const auto& now_process_build_block = _shared_state->build_blocks[build_block_idx];
             if constexpr (set_build_side_flag) {
                 _build_offset_stack.push(_join_block.rows());
+                _build_block_idx_stack.push(build_block_idx);
             }
             _process_left_child_block(_join_block, now_process_build_block);
         }
+        COUNTER_UPDATE(_skipped_build_blocks_counter, skipped_build_blocks);
 
         if constexpr (set_probe_side_flag) {
             RETURN_IF_ERROR_OR_CATCH_EXCEPTION(
@@ -419,6 +464,47 @@ void NestedLoopJoinProbeLocalState::_process_left_child_block(
     block.set_columns(std::move(dst_columns));
 }
 
+bool NestedLoopJoinProbeLocalState::_skip_build_block(size_t build_block_idx) const {
+    auto& p = _parent->cast<NestedLoopJoinProbeOperatorX>();
+    const auto& build_block = _shared_state->build_blocks[build_block_idx];
+    const auto& min_max = _shared_state->build_block_min_max[build_block_idx];
+    for (size_t i = 0; i < p._band_conjuncts.size(); ++i) {
+        const auto& band = p._band_conjuncts[i];
+        const auto [min_row, max_row] = min_max[i];
+        // a null value matches nothing
+        if (min_row < 0 || _band_probe_columns[i]->is_null_at(_left_block_pos)) {
+            return true;
+        }
+        const auto& probe = nested_column(*_band_probe_columns[i]);
+        const auto& build = nested_column(*build_block.get_by_position(band.build_column).column);
+        switch (band.op) {
+        case TExprOpcode::LT:
+            if (probe.compare_at(_left_block_pos, max_row, build, 1) >= 0) {
+                return true;
+            }
+            break;
+        case TExprOpcode::LE:
+            if (probe.compare_at(_left_block_pos, max_row, build, 1) > 0) {
+                return true;
+            }
+            break;
+        case TExprOpcode::GT:
+            if (probe.compare_at(_left_block_pos, min_row, build, 1) <= 0) {
+                return true;
+            }
+            break;
+        case TExprOpcode::GE:
+            if (probe.compare_at(_left_block_pos, min_row, build, 1) < 0) {
+                return true;
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    return false;
+}
+
 NestedLoopJoinProbeOperatorX::NestedLoopJoinProbeOperatorX(ObjectPool* pool, const TPlanNode& tnode,
                                                            int operator_id,
                                                            const DescriptorTbl& descs)
@@ -454,9 +540,129 @@ Status NestedLoopJoinProbeOperatorX::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(vectorized::VExpr::prepare(_output_expr_ctxs, state, *_intermediate_row_desc));
     _num_probe_side_columns = _child_x->row_desc().num_materialized_slots();
     _num_build_side_columns = _build_side_child->row_desc().num_materialized_slots();
+    // The null values of the probe side matter to the null aware joins.
+    if (!_is_output_left_side_only && _join_op != TJoinOp::NULL_AWARE_LEFT_ANTI_JOIN &&
+        _join_op != TJoinOp::NULL_AWARE_LEFT_SEMI_JOIN &&
+        config::nested_loop_join_band_block_rows > 0) {
+        _band_block_rows = config::nested_loop_join_band_block_rows;
+        for (const auto& conjunct : _join_conjuncts) {
+            _find_band_conjuncts(conjunct->root());
+        }
+    }
     return Status::OK();
 }
 
+void NestedLoopJoinProbeOperatorX::_find_band_conjuncts(const vectorized::VExprSPtr& expr) {
+    if (expr->node_type() == TExprNodeType::COMPOUND_PRED &&
+        expr->op() == TExprOpcode::COMPOUND_AND) {
+        for (const auto& child : expr->children()) {
+            _find_band_conjuncts(child);
+        }
+        return;
+    }
+    auto op = expr->op();
+    if (expr->node_type() != TExprNodeType::BINARY_PRED || expr->get_num_children() != 2 ||
+        (op != TExprOpcode::LT && op != TExprOpcode::LE && op != TExprOpcode::GT &&
+         op != TExprOpcode::GE)) {
+        return;
+    }
+    const auto& left = expr->children()[0];
+    const auto& right = expr->children()[1];
+    if (!left->is_slot_ref() || !right->is_slot_ref() || !is_band_join_type(left->type().type) ||
+        !vectorized::remove_nullable(left->data_type())
+                 ->equals(*vectorized::remove_nullable(right->data_type()))) {
+        return;
+    }
+    size_t probe_column = assert_cast<const vectorized::VSlotRef*>(left.get())->column_id();
+    size_t build_column = assert_cast<const vectorized::VSlotRef*>(right.get())->column_id();
+    if ((probe_column < _num_probe_side_columns) == (build_column < _num_probe_side_columns)) {
+        return;
+    }
+    if (build_column < _num_probe_side_columns) {
+        std::swap(probe_column, build_column);
+        op = op == TExprOpcode::LT   ? TExprOpcode::GT
+             : op == TExprOpcode::LE ? TExprOpcode::GE
+             : op == TExprOpcode::GT ? TExprOpcode::LT
+                                     : TExprOpcode::LE;
+    }
+    _band_conjuncts.push_back({probe_column, build_column - _num_probe_side_columns, op});
+}
+
+void NestedLoopJoinProbeOperatorX::_prepare_band_join(
+        NestedLoopJoinSharedState* shared_state) const {
+    auto& build_blocks = shared_state->build_blocks;
+    size_t num_rows = 0;
+    for (const auto& block : build_blocks) {
+        num_rows += block.rows();
+    }
+    if (num_rows > 0) {
+        auto columns_with_names = build_blocks[0].get_columns_with_type_and_name();
+        vectorized::Columns sorted_columns(columns_with_names.size());
+        {
+            vectorized::MutableColumns columns(columns_with_names.size());
+            for (size_t i = 0; i < columns.size(); ++i) {
+                columns[i] = columns_with_names[i]
+                                     .column->convert_to_full_column_if_const()
+                                     ->clone_empty();
+                columns[i]->reserve(num_rows);
+            }
+            for (auto& block : build_blocks) {
+                for (size_t i = 0; i < columns.size(); ++i) {
+                    columns[i]->insert_range_from(
+                            *block.get_by_position(i).column->convert_to_full_column_if_const(),
+                            0, block.rows());
+                }
+                block.clear();
+            }
+            vectorized::IColumn::Permutation permutation;
+            // nulls last
+            columns[_band_conjuncts[0].build_column]->get_permutation(false, 0, 1, permutation);
+            for (size_t i = 0; i < columns.size(); ++i) {
+                sorted_columns[i] = columns[i]->permute(permutation, 0);
+            }
+        }
+
+        const bool has_visited_flags = !shared_state->build_side_visited_flags.empty();
+        build_blocks.clear();
+        shared_state->build_side_visited_flags.clear();
+        for (size_t start = 0; start < num_rows; start += _band_block_rows) {
+            const size_t length = std::min(_band_block_rows, num_rows - start);
+            for (size_t i = 0; i < sorted_columns.size(); ++i) {
+                columns_with_names[i].column = sorted_columns[i]->cut(start, length);
+            }
+            build_blocks.emplace_back(columns_with_names);
+            if (has_visited_flags) {
+                shared_state->build_side_visited_flags.emplace_back(
+                        vectorized::ColumnUInt8::create(length, 0));
+            }
+        }
+    }
+
+    shared_state->build_block_min_max.resize(build_blocks.size());
+    for (size_t i = 0; i < build_blocks.size(); ++i) {
+        auto& min_max = shared_state->build_block_min_max[i];
+        for (const auto& band : _band_conjuncts) {
+            const auto& column = *build_blocks[i].get_by_position(band.build_column).column;
+            const auto& nested = nested_column(column);
+            int min_row = -1;
+            int max_row = -1;
+            for (size_t row = 0; row < column.size(); ++row) {
+                if (column.is_null_at(row)) {
+                    continue;
+                }
+                if (min_row < 0) {
+                    min_row = max_row = static_cast<int>(row);
+                } else if (nested.compare_at(row, min_row, nested, 1) < 0) {
+                    min_row = static_cast<int>(row);
+                } else if (nested.compare_at(row, max_row, nested, 1) > 0) {
+                    max_row = static_cast<int>(row);
+                }
+            }
+            min_max.emplace_back(min_row, max_row);
+        }
+    }
+}
+
 Status NestedLoopJoinProbeOperatorX::open(RuntimeState* state) {
     RETURN_IF_ERROR(JoinProbeOperatorX<NestedLoopJoinProbeLocalState>::open(state));
     return vectorized::VExpr::open(_join_conjuncts, state);
@@ -480,6 +686,17 @@ Status NestedLoopJoinProbeOperatorX::push(doris::RuntimeState* state, vectorized
     local_state._need_more_input_data = false;
     local_state._shared_state->left_side_eos = eos;
 
+    if (!_band_conjuncts.empty()) {
+        auto* shared_state = local_state._shared_state;
+        RETURN_IF_CATCH_EXCEPTION(std::call_once(shared_state->band_join_once,
+                                                 [&]() { _prepare_band_join(shared_state); }));
+        local_state._band_probe_columns.clear();
+        for (const auto& band : _band_conjuncts) {
+            const auto& column = block->get_by_position(band.probe_column).column;
+            local_state._band_probe_columns.push_back(column->convert_to_full_column_if_const());
+        }
+    }
+
     if (!_is_output_left_side_only) {
         auto func = [&](auto&& join_op_variants, auto set_build_side_flag,
                         auto set_probe_side_flag) {
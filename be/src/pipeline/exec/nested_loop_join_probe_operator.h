@@ -59,12 +59,17 @@ private:
     void _append_left_data_with_null(vectorized::Block& block) const;
     void _process_left_child_block(vectorized::Block& block,
                                    const vectorized::Block& now_process_build_block) const;
+    // Whether no row of the build block can satisfy the band join conjuncts with the current
+    // probe row.
+    bool _skip_build_block(size_t build_block_idx) const;
     template <typename Filter, bool SetBuildSideFlag, bool SetProbeSideFlag>
     void _do_filtering_and_update_visited_flags_impl(vectorized::Block* block, int column_to_keep,
-                                                     int build_block_idx, int processed_blocks_num,
-                                                     bool materialize, Filter& filter) {
+                                                     int processed_blocks_num, bool materialize,
+                                                     Filter& filter) {
         if constexpr (SetBuildSideFlag) {
             for (size_t i = 0; i < processed_blocks_num; i++) {
+                const size_t build_block_idx = _build_block_idx_stack.top();
+                _build_block_idx_stack.pop();
                 auto& build_side_flag =
                         assert_cast<vectorized::ColumnUInt8*>(
                                 _shared_state->build_side_visited_flags[build_block_idx].get())
@@ -76,8 +81,6 @@ private:
                 for (size_t j = 0; j < cur_sz; j++) {
                     build_side_flag_data[j] |= filter[offset + j];
                 }
-                build_block_idx = build_block_idx == 0 ? _shared_state->build_blocks.size() - 1
-                                                       : build_block_idx - 1;
             }
         }
         if constexpr (SetProbeSideFlag) {
@@ -113,8 +116,6 @@ private:
         // 1. Execute conjuncts and get a column with bool type to do filtering.
         // 2. Use bool column to update build-side visited flags.
         // 3. Use bool column to do filtering.
-        size_t build_block_idx = _current_build_pos == 0 ? _shared_state->build_blocks.size() - 1
-                                                         : _current_build_pos - 1;
         size_t processed_blocks_num = _build_offset_stack.size();
         if (LIKELY(!_join_conjuncts.empty() && block->rows() > 0)) {
             vectorized::IColumn::Filter filter(block->rows(), 1);
@@ -129,15 +130,19 @@ private:
 
                 std::stack<uint16_t> empty2;
                 _build_offset_stack.swap(empty2);
+
+                std::stack<size_t> empty3;
+                _build_block_idx_stack.swap(empty3);
             } else {
                 _do_filtering_and_update_visited_flags_impl<decltype(filter), SetBuildSideFlag,
                                                             SetProbeSideFlag>(
-                        block, column_to_keep, build_block_idx, processed_blocks_num, materialize,
-                        filter);
+                        block, column_to_keep, processed_blocks_num, materialize, filter);
             }
         } else if (block->rows() > 0) {
             if constexpr (SetBuildSideFlag) {
                 for (size_t i = 0; i < processed_blocks_num; i++) {
+                    const size_t build_block_idx = _build_block_idx_stack.top();
+                    _build_block_idx_stack.pop();
                     auto& build_side_flag =
                             assert_cast<vectorized::ColumnUInt8*>(
                                     _shared_state->build_side_visited_flags[build_block_idx].get())
@@ -146,8 +151,6 @@ private:
                     auto cur_sz = build_side_flag.size();
                     _build_offset_stack.pop();
                     memset(reinterpret_cast<void*>(build_side_flag_data), 1, cur_sz);
-                    build_block_idx = build_block_idx == 0 ? _shared_state->build_blocks.size() - 1
-                                                           : build_block_idx - 1;
                 }
             }
             if constexpr (SetProbeSideFlag) {
@@ -174,11 +177,17 @@ private:
     size_t _current_build_pos = 0;
     vectorized::MutableColumns _dst_columns;
     std::stack<uint16_t> _build_offset_stack;
+    // The indexes of the build blocks joined at the offsets in _build_offset_stack, the blocks
+    // skipped by the band join conjuncts are not in it.
+    std::stack<size_t> _build_block_idx_stack;
     std::stack<uint16_t> _probe_offset_stack;
     uint64_t _output_null_idx_build_side = 0;
     vectorized::VExprContextSPtrs _join_conjuncts;
+    // The probe columns of the band join conjuncts in _child_block, not const.
+    vectorized::Columns _band_probe_columns;
 
     RuntimeProfile::Counter* _loop_join_timer = nullptr;
+    RuntimeProfile::Counter* _skipped_build_blocks_counter = nullptr;
 };
 
 class NestedLoopJoinProbeOperatorX final
@@ -214,10 +223,24 @@ public:
 
 private:
     friend class NestedLoopJoinProbeLocalState;
+    // A join conjunct `probe_column op build_column` with op in <, <=, > and >=.
+    struct BandConjunct {
+        size_t probe_column;
+        size_t build_column;
+        TExprOpcode::type op;
+    };
+    void _find_band_conjuncts(const vectorized::VExprSPtr& expr);
+    // Sorts the build rows by the build column of the first band conjunct, cuts them into blocks
+    // of config::nested_loop_join_band_block_rows rows and finds the min and max values of the
+    // build columns of the band conjuncts in every block.
+    void _prepare_band_join(NestedLoopJoinSharedState* shared_state) const;
+
     bool _is_output_left_side_only;
     vectorized::VExprContextSPtrs _join_conjuncts;
     size_t _num_probe_side_columns = 0;
     size_t _num_build_side_columns = 0;
+    std::vector<BandConjunct> _band_conjuncts;
+    size_t _band_block_rows = 0;
     const bool _old_version_flag;
 };
 
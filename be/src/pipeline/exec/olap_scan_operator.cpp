@@ -27,6 +27,7 @@
 #include "olap/parallel_scanner_builder.h"
 #include "olap/storage_engine.h"
 #include "olap/tablet_manager.h"
+#include "pipeline/exec/fragment_cache_operator.h"
 #include "pipeline/exec/scan_operator.h"
 #include "service/backend_options.h"
 #include "util/to_string.h"
@@ -86,6 +87,8 @@ Status OlapScanLocalState::_init_profile() {
             ADD_COUNTER(_segment_profile, "RowsVectorPredInput", TUnit::UNIT);
     _rows_short_circuit_cond_input_counter =
             ADD_COUNTER(_segment_profile, "RowsShortCircuitPredInput", TUnit::UNIT);
+    _short_circuit_predicates_reordered_counter =
+            ADD_COUNTER(_segment_profile, "ShortCircuitPredicatesReordered", TUnit::UNIT);
     _vec_cond_timer = ADD_TIMER(_segment_profile, "VectorPredEvalTime");
     _short_cond_timer = ADD_TIMER(_segment_profile, "ShortPredEvalTime");
     _expr_filter_timer = ADD_TIMER(_segment_profile, "ExprFilterEvalTime");
@@ -218,6 +221,23 @@ Status OlapScanLocalState::_should_push_down_function_filter(vectorized::Vectori
     return Status::OK();
 }
 
+std::vector<int> OlapScanLocalState::_get_topn_filter_bound_source_node_ids(RuntimeState* state) {
+    std::vector<int> result;
+    for (int id : _parent->cast<OlapScanOperatorX>().topn_filter_source_node_ids) {
+        if (!state->get_query_ctx()->has_runtime_predicate(id)) {
+            continue;
+        }
+        const auto& pred = state->get_query_ctx()->get_runtime_predicate(id);
+        if (!pred.enable() || !pred.target_is_truncated_slot(_parent->node_id())) {
+            continue;
+        }
+        if (_is_key_column(pred.get_col_name(_parent->node_id())) || _storage_no_merge()) {
+            result.push_back(id);
+        }
+    }
+    return result;
+}
+
 bool OlapScanLocalState::_should_push_down_common_expr() {
     return state()->enable_common_expr_pushdown() && _storage_no_merge();
 }
@@ -230,8 +250,16 @@ bool OlapScanLocalState::_storage_no_merge() {
              p._olap_scan_node.enable_unique_key_merge_on_write));
 }
 
+bool OlapScanLocalState::_hit_fragment_cache() {
+    auto& p = _parent->cast<OlapScanOperatorX>();
+    return p._fragment_cache_operator_id >= 0 &&
+           state()->get_local_state(p._fragment_cache_operator_id)
+                   ->cast<FragmentCacheLocalState>()
+                   .hit();
+}
+
 Status OlapScanLocalState::_init_scanners(std::list<vectorized::VScannerSPtr>* scanners) {
-    if (_scan_ranges.empty()) {
+    if (_scan_ranges.empty() || _hit_fragment_cache()) {
         _eos = true;
         _scan_dependency->set_ready();
         return Status::OK();
@@ -269,27 +297,37 @@ Status OlapScanLocalState::_init_scanners(std::list<vectorized::VScannerSPtr>* s
     bool has_cpu_limit = state()->query_options().__isset.resource_limit &&
                          state()->query_options().resource_limit.__isset.cpu_limit;
 
-    std::vector<TabletWithVersion> tablets;
-    tablets.reserve(_scan_ranges.size());
-    for (auto&& scan_range : _scan_ranges) {
-        // TODO(plat1ko): Get cloud tablet in parallel
-        auto tablet = DORIS_TRY(ExecEnv::get_tablet(scan_range->tablet_id));
+    std::vector<TabletWithVersion> tablets(_scan_ranges.size());
+    auto get_tablet = [&](size_t i) -> Status {
+        const auto& scan_range = _scan_ranges[i];
+        auto res = ExecEnv::get_tablet(scan_range->tablet_id);
+        if (!res.has_value()) {
+            return res.error();
+        }
         int64_t version = 0;
         std::from_chars(scan_range->version.data(),
                         scan_range->version.data() + scan_range->version.size(), version);
-        tablets.emplace_back(std::move(tablet), version);
-    }
+        tablets[i] = {std::move(res.value()), version};
+        return Status::OK();
+    };
     int64_t duration_ns = 0;
     if (config::is_cloud_mode()) {
         SCOPED_RAW_TIMER(&duration_ns);
+        // The tablets not cached are got from the meta service, so get and sync them in parallel.
         std::vector<std::function<Status()>> tasks;
         tasks.reserve(_scan_ranges.size());
-        for (auto&& [tablet, version] : tablets) {
-            tasks.emplace_back([tablet, version]() {
-                return std::dynamic_pointer_cast<CloudTablet>(tablet)->sync_rowsets(version);
+        for (size_t i = 0; i < _scan_ranges.size(); ++i) {
+            tasks.emplace_back([&, i]() {
+                RETURN_IF_ERROR(get_tablet(i));
+                return std::dynamic_pointer_cast<CloudTablet>(tablets[i].tablet)
+                        ->sync_rowsets(tablets[i].version);
             });
         }
-        RETURN_IF_ERROR(cloud::bthread_fork_join(tasks, 10));
+        RETURN_IF_ERROR(cloud::bthread_fork_join(tasks, config::scan_sync_rowsets_concurrency));
+    } else {
+        for (size_t i = 0; i < _scan_ranges.size(); ++i) {
+            RETURN_IF_ERROR(get_tablet(i));
+        }
     }
     _sync_rowset_timer->update(duration_ns);
 
@@ -369,6 +407,9 @@ Status OlapScanLocalState::_init_scanners(std::list<vectorized::VScannerSPtr>* s
         int ranges_per_scanner =
                 std::max(1, (int)ranges->size() /
                                     std::min(scanners_per_tablet, size_based_scanners_per_tablet));
+        if (p._read_in_key_order) {
+            ranges_per_scanner = (int)ranges->size();
+        }
         int num_ranges = ranges->size();
         for (int i = 0; i < num_ranges;) {
             std::vector<doris::OlapScanRange*> scanner_ranges;
@@ -383,6 +424,13 @@ Status OlapScanLocalState::_init_scanners(std::list<vectorized::VScannerSPtr>* s
         }
     }
 
+    // the rows of different scanners would be interleaved
+    if (p._read_in_key_order && scanners->size() > 1) {
+        return Status::InternalError(
+                "olap scan node {} reads in key order by a single scanner, but there are {} "
+                "scanners of {} tablets",
+                p.node_id(), scanners->size(), _scan_ranges.size());
+    }
     return Status::OK();
 }
 
@@ -542,6 +590,9 @@ Status OlapScanLocalState::_build_key_ranges_and_filters() {
                                           olap_filters_to_string(_olap_filters));
         _runtime_profile->add_info_string("KeyRanges", _scan_keys.debug_string());
         _runtime_profile->add_info_string("TabletIds", tablets_id_to_string(_scan_ranges));
+        if (p._read_in_key_order) {
+            _runtime_profile->add_info_string("ReadInKeyOrder", "true");
+        }
     }
     VLOG_CRITICAL << _scan_keys.debug_string();
 
@@ -586,6 +637,11 @@ OlapScanOperatorX::OlapScanOperatorX(ObjectPool* pool, const TPlanNode& tnode, i
     if (_olap_scan_node.__isset.sort_info && _olap_scan_node.__isset.sort_limit) {
         _limit_per_scanner = _olap_scan_node.sort_limit;
     }
+    if (_olap_scan_node.__isset.sort_info && !_olap_scan_node.__isset.sort_limit &&
+        !_olap_scan_node.sort_info.is_asc_order.empty()) {
+        _read_in_key_order = true;
+        _should_run_serial = true;
+    }
 }
 
 } // namespace doris::pipeline
@@ -75,6 +75,9 @@ private:
 
     bool _storage_no_merge() override;
 
+    // whether the fragment cache above has the output of this scan, so that it reads nothing
+    bool _hit_fragment_cache();
+
     bool _push_down_topn(const vectorized::RuntimePredicate& predicate) override {
         if (!predicate.target_is_slot(_parent->node_id())) {
             return false;
@@ -82,6 +85,10 @@ private:
         return _is_key_column(predicate.get_col_name(_parent->node_id())) || _storage_no_merge();
     }
 
+    // The topn filters on date_trunc(slot), which are evaluated as conjuncts, but whose bounds
+    // of the slot are also pushed down to the storage to prune the pages by the zone maps.
+    std::vector<int> _get_topn_filter_bound_source_node_ids(RuntimeState* state);
+
     Status _init_scanners(std::list<vectorized::VScannerSPtr>* scanners) override;
 
     void add_filter_info(int id, const PredicateFilterInfo& info);
@@ -119,6 +126,7 @@ private:
     RuntimeProfile::Counter* _rows_short_circuit_cond_filtered_counter = nullptr;
     RuntimeProfile::Counter* _rows_vec_cond_input_counter = nullptr;
     RuntimeProfile::Counter* _rows_short_circuit_cond_input_counter = nullptr;
+    RuntimeProfile::Counter* _short_circuit_predicates_reordered_counter = nullptr;
     RuntimeProfile::Counter* _vec_cond_timer = nullptr;
     RuntimeProfile::Counter* _short_cond_timer = nullptr;
     RuntimeProfile::Counter* _expr_filter_timer = nullptr;
@@ -199,9 +207,16 @@ public:
     OlapScanOperatorX(ObjectPool* pool, const TPlanNode& tnode, int operator_id,
                       const DescriptorTbl& descs, int parallel_tasks);
 
+    void set_fragment_cache_operator_id(int id) { _fragment_cache_operator_id = id; }
+
 private:
     friend class OlapScanLocalState;
     TOlapScanNode _olap_scan_node;
+    // a sort info without a sort limit asks for all the rows in the order of the keys, they are
+    // read by a single scanner which merges the rowsets, so the parent consumes them unsorted
+    bool _read_in_key_order = false;
+    // the FragmentCacheOperatorX caching the pre-aggregation of this scan, or -1
+    int _fragment_cache_operator_id = -1;
 };
 
 } // namespace doris::pipeline
@@ -17,6 +17,7 @@
 
 #include "operator.h"
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/status.h"
 #include "pipeline/dependency.h"
@@ -32,6 +33,7 @@
 #include "pipeline/exec/exchange_sink_operator.h"
 #include "pipeline/exec/exchange_source_operator.h"
 #include "pipeline/exec/file_scan_operator.h"
+#include "pipeline/exec/fragment_cache_operator.h"
 #include "pipeline/exec/group_commit_block_sink_operator.h"
 #include "pipeline/exec/group_commit_scan_operator.h"
 #include "pipeline/exec/hashjoin_build_sink.h"
@@ -74,6 +76,8 @@
 #include "pipeline/local_exchange/local_exchange_sink_operator.h"
 #include "pipeline/local_exchange/local_exchange_source_operator.h"
 #include "util/debug_util.h"
+#include "util/time.h"
+#include "vec/exprs/vcommon_expr.h"
 #include "util/runtime_profile.h"
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vexpr_context.h"
@@ -86,6 +90,29 @@ class RuntimeState;
 
 namespace doris::pipeline {
 
+// Enough to see the phases of an operator, e.g. building, probing and spilling, at any age
+static constexpr size_t MEM_TIMELINE_MAX_SAMPLES = 32;
+
+static std::unique_ptr<MemTimeline> create_mem_timeline(const MemTracker* mem_tracker) {
+    if (config::operator_mem_timeline_interval_ms <= 0) {
+        return nullptr;
+    }
+    auto mem_timeline = std::make_unique<MemTimeline>(
+            mem_tracker, config::operator_mem_timeline_interval_ms, MEM_TIMELINE_MAX_SAMPLES);
+    mem_timeline->sample();
+    return mem_timeline;
+}
+
+static void finish_mem_timeline(MemTimeline* mem_timeline, const MemTracker* mem_tracker,
+                                RuntimeProfile* profile) {
+    // an operator which never tracks its memory has nothing to show
+    if (mem_timeline == nullptr || mem_tracker->peak_consumption() == 0) {
+        return;
+    }
+    mem_timeline->finish(MonotonicMillis());
+    profile->add_info_string("MemoryTimeline", mem_timeline->to_string());
+}
+
 Status OperatorBase::close(RuntimeState* state) {
     if (_is_closed) {
         return Status::OK();
@@ -194,6 +221,12 @@ Status OperatorXBase::init(const TPlanNode& tnode, RuntimeState* /*state*/) {
             _intermediate_projections.push_back(projections);
         }
     }
+    if (config::enable_projection_common_expr_elimination) {
+        for (const auto& projections : _intermediate_projections) {
+            vectorized::VCommonExpr::rewrite(projections, &_num_common_exprs);
+        }
+        vectorized::VCommonExpr::rewrite(_projections, &_num_common_exprs);
+    }
     return Status::OK();
 }
 
@@ -259,8 +292,10 @@ Status OperatorXBase::do_projections(RuntimeState* state, vectorized::Block* ori
     }
     vectorized::Block input_block = *origin_block;
 
+    auto& common_expr_results = local_state->_common_expr_results;
     std::vector<int> result_column_ids;
     for (const auto& projections : _intermediate_projections) {
+        std::fill(common_expr_results.begin(), common_expr_results.end(), -1);
         result_column_ids.resize(projections.size());
         for (int i = 0; i < projections.size(); i++) {
             RETURN_IF_ERROR(projections[i]->execute(&input_block, &result_column_ids[i]));
@@ -292,6 +327,7 @@ Status OperatorXBase::do_projections(RuntimeState* state, vectorized::Block* ori
             vectorized::VectorizedUtils::build_mutable_mem_reuse_block(output_block,
                                                                        *_output_row_descriptor);
     if (rows != 0) {
+        std::fill(common_expr_results.begin(), common_expr_results.end(), -1);
         auto& mutable_columns = mutable_block.mutable_columns();
         DCHECK(mutable_columns.size() == local_state->_projections.size());
         for (int i = 0; i < mutable_columns.size(); ++i) {
@@ -311,6 +347,7 @@ Status OperatorXBase::do_projections(RuntimeState* state, vectorized::Block* ori
 Status OperatorXBase::get_block_after_projects(RuntimeState* state, vectorized::Block* block,
                                                bool* eos) {
     auto local_state = state->get_local_state(operator_id());
+    local_state->sample_mem_timeline();
     if (_output_row_descriptor) {
         local_state->clear_origin_block();
         auto status = get_block(state, &local_state->_origin_block, eos);
@@ -459,6 +496,7 @@ Status PipelineXLocalState<SharedStateArg>::init(RuntimeState* state, LocalState
     _memory_used_counter = ADD_LABEL_COUNTER_WITH_LEVEL(_runtime_profile, "MemoryUsage", 1);
     _peak_memory_usage_counter = _runtime_profile->AddHighWaterMarkCounter(
             "PeakMemoryUsage", TUnit::BYTES, "MemoryUsage", 1);
+    _mem_timeline = create_mem_timeline(_mem_tracker.get());
     return Status::OK();
 }
 
@@ -480,6 +518,17 @@ Status PipelineXLocalState<SharedStateArg>::open(RuntimeState* state) {
                     state, _intermediate_projections[i][j]));
         }
     }
+    if (_parent->_num_common_exprs > 0) {
+        _common_expr_results.resize(_parent->_num_common_exprs, -1);
+        for (auto& projection : _projections) {
+            projection->set_common_expr_results(&_common_expr_results);
+        }
+        for (auto& projections : _intermediate_projections) {
+            for (auto& projection : projections) {
+                projection->set_common_expr_results(&_common_expr_results);
+            }
+        }
+    }
     return Status::OK();
 }
 
@@ -497,6 +546,7 @@ Status PipelineXLocalState<SharedStateArg>::close(RuntimeState* state) {
     if (_peak_memory_usage_counter) {
         _peak_memory_usage_counter->set(_mem_tracker->peak_consumption());
     }
+    finish_mem_timeline(_mem_timeline.get(), _mem_tracker.get(), _runtime_profile.get());
     _closed = true;
     return Status::OK();
 }
@@ -534,6 +584,7 @@ Status PipelineXSinkLocalState<SharedState>::init(RuntimeState* state, LocalSink
     _memory_used_counter = ADD_LABEL_COUNTER_WITH_LEVEL(_profile, "MemoryUsage", 1);
     _peak_memory_usage_counter =
             _profile->AddHighWaterMarkCounter("PeakMemoryUsage", TUnit::BYTES, "MemoryUsage", 1);
+    _mem_timeline = create_mem_timeline(_mem_tracker.get());
     return Status::OK();
 }
 
@@ -548,6 +599,7 @@ Status PipelineXSinkLocalState<SharedState>::close(RuntimeState* state, Status e
     if (_peak_memory_usage_counter) {
         _peak_memory_usage_counter->set(_mem_tracker->peak_consumption());
     }
+    finish_mem_timeline(_mem_timeline.get(), _mem_tracker.get(), _profile);
     _closed = true;
     return Status::OK();
 }
@@ -709,6 +761,7 @@ DECLARE_OPERATOR_X(SchemaScanLocalState)
 DECLARE_OPERATOR_X(MetaScanLocalState)
 DECLARE_OPERATOR_X(LocalExchangeSourceLocalState)
 DECLARE_OPERATOR_X(PartitionedHashJoinProbeLocalState)
+DECLARE_OPERATOR_X(FragmentCacheLocalState)
 
 #undef DECLARE_OPERATOR_X
 
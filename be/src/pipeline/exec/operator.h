@@ -32,6 +32,7 @@
 #include "pipeline/dependency.h"
 #include "pipeline/exec/operator.h"
 #include "pipeline/local_exchange/local_exchanger.h"
+#include "runtime/memory/mem_timeline.h"
 #include "runtime/query_context.h"
 #include "runtime/runtime_state.h"
 #include "util/runtime_profile.h"
@@ -156,6 +157,11 @@ public:
     RuntimeProfile* profile() { return _runtime_profile.get(); }
 
     MemTracker* mem_tracker() { return _mem_tracker.get(); }
+    void sample_mem_timeline() {
+        if (_mem_timeline) {
+            _mem_timeline->sample();
+        }
+    }
     RuntimeProfile::Counter* rows_returned_counter() { return _rows_returned_counter; }
     RuntimeProfile::Counter* blocks_returned_counter() { return _blocks_returned_counter; }
     RuntimeProfile::Counter* exec_time_counter() { return _exec_timer; }
@@ -189,6 +195,8 @@ protected:
     // Record this node memory size. it is expected that artificial guarantees are accurate,
     // which will providea reference for operator memory.
     std::unique_ptr<MemTracker> _mem_tracker;
+    // The consumption of _mem_tracker over time, nullptr if disabled
+    std::unique_ptr<MemTimeline> _mem_timeline;
 
     std::shared_ptr<QueryStatistics> _query_statistics = nullptr;
 
@@ -210,6 +218,8 @@ protected:
     vectorized::VExprContextSPtrs _projections;
     // Used in common subexpression elimination to compute intermediate results.
     std::vector<vectorized::VExprContextSPtrs> _intermediate_projections;
+    // The results of the VCommonExprs of the projections in the block being projected
+    std::vector<int> _common_expr_results;
 
     bool _closed = false;
     vectorized::Block _origin_block;
@@ -335,6 +345,11 @@ public:
     RuntimeState* state() { return _state; }
     RuntimeProfile* profile() { return _profile; }
     MemTracker* mem_tracker() { return _mem_tracker.get(); }
+    void sample_mem_timeline() {
+        if (_mem_timeline) {
+            _mem_timeline->sample();
+        }
+    }
     [[nodiscard]] RuntimeProfile* faker_runtime_profile() const {
         return _faker_runtime_profile.get();
     }
@@ -353,6 +368,8 @@ protected:
     RuntimeState* _state = nullptr;
     RuntimeProfile* _profile = nullptr;
     std::unique_ptr<MemTracker> _mem_tracker;
+    // The consumption of _mem_tracker over time, nullptr if disabled
+    std::unique_ptr<MemTimeline> _mem_timeline;
     // Set to true after close() has been called. subclasses should check and set this in
     // close().
     bool _closed = false;
@@ -764,6 +781,9 @@ protected:
     std::vector<RowDescriptor> _intermediate_output_row_descriptor;
     // Used in common subexpression elimination to compute intermediate results.
     std::vector<vectorized::VExprContextSPtrs> _intermediate_projections;
+    // The number of the VCommonExprs in the projections, which wrap the identical subtrees of
+    // the projections of one level, so that they are executed only once per block.
+    int _num_common_exprs = 0;
 
     /// Resource information sent from the frontend.
     const TBackendResourceProfile _resource_profile;
@@ -29,6 +29,7 @@ Status PartitionBlocks::append_block_by_selector(const vectorized::Block* input_
         _blocks.push_back(vectorized::Block::create_unique(
                 vectorized::VectorizedUtils::create_empty_block(_partition_sort_info->_row_desc)));
     }
+    auto back_bytes = _blocks.back()->bytes();
     auto columns = input_block->get_columns();
     auto mutable_columns = _blocks.back()->mutate_columns();
     DCHECK(columns.size() == mutable_columns.size());
@@ -36,6 +37,8 @@ Status PartitionBlocks::append_block_by_selector(const vectorized::Block* input_
         columns[i]->append_data_by_selector(mutable_columns[i], _selector);
     }
     _blocks.back()->set_columns(std::move(mutable_columns));
+    _blocks_bytes += _blocks.back()->bytes() - back_bytes;
+    _unsorted_bytes += _blocks.back()->bytes() - back_bytes;
     auto selector_rows = _selector.size();
     _init_rows = _init_rows - selector_rows;
     _total_rows = _total_rows + selector_rows;
@@ -43,16 +46,45 @@ Status PartitionBlocks::append_block_by_selector(const vectorized::Block* input_
     _selector.clear();
     // maybe better could change by user PARTITION_SORT_ROWS_THRESHOLD
     if (!eos && _partition_sort_info->_partition_inner_limit != -1 &&
-        _current_input_rows >= PARTITION_SORT_ROWS_THRESHOLD &&
+        _current_input_rows >= compact_rows_threshold() &&
         _partition_sort_info->_topn_phase != TPartTopNPhase::TWO_PHASE_GLOBAL) {
-        create_or_reset_sorter_state();
-        RETURN_IF_ERROR(do_partition_topn_sort());
-        _current_input_rows = 0; // reset record
-        _do_partition_topn_count++;
+        RETURN_IF_ERROR(compact());
     }
     return Status::OK();
 }
 
+Status PartitionBlocks::compact() {
+    create_or_reset_sorter_state();
+    RETURN_IF_ERROR(do_partition_topn_sort());
+    _current_input_rows = 0; // reset record
+    _do_partition_topn_count++;
+    return Status::OK();
+}
+
+size_t PartitionBlocks::filter_selector_by_threshold(
+        const vectorized::ColumnRawPtrs& sort_columns) {
+    const auto& is_asc_order = _partition_sort_info->_is_asc_order;
+    const auto& nulls_first = _partition_sort_info->_nulls_first;
+    size_t num_rows = 0;
+    for (auto row : _selector) {
+        int res = 0;
+        for (size_t i = 0; i < sort_columns.size() && res == 0; ++i) {
+            int direction = is_asc_order[i] ? 1 : -1;
+            int nulls_direction = nulls_first[i] ? -direction : direction;
+            res = direction * sort_columns[i]->compare_at(row, 0, *_threshold_columns[i],
+                                                         nulls_direction);
+        }
+        // the rows equal to the threshold may still have the same rank as it
+        if (res <= 0) {
+            _selector[num_rows++] = row;
+        }
+    }
+    size_t filtered_rows = _selector.size() - num_rows;
+    _selector.resize(num_rows);
+    _topn_filter_rows += filtered_rows;
+    return filtered_rows;
+}
+
 void PartitionBlocks::create_or_reset_sorter_state() {
     if (_partition_topn_sorter == nullptr) {
         _previous_row = std::make_unique<vectorized::SortCursorCmp>();
@@ -72,11 +104,15 @@ void PartitionBlocks::create_or_reset_sorter_state() {
 }
 
 Status PartitionBlocks::do_partition_topn_sort() {
+    size_t input_rows = 0;
     for (const auto& block : _blocks) {
+        input_rows += block->rows();
         RETURN_IF_ERROR(_partition_topn_sorter->append_block(block.get()));
     }
     _blocks.clear();
     RETURN_IF_ERROR(_partition_topn_sorter->prepare_for_read());
+    _blocks_bytes = 0;
+    _unsorted_bytes = 0;
     bool current_eos = false;
     size_t current_output_rows = 0;
     while (!current_eos) {
@@ -88,11 +124,34 @@ Status PartitionBlocks::do_partition_topn_sort() {
         auto rows = output_block->rows();
         if (rows > 0) {
             current_output_rows += rows;
+            _blocks_bytes += output_block->bytes();
             _blocks.emplace_back(std::move(output_block));
         }
     }
 
-    _topn_filter_rows += (_current_input_rows - current_output_rows);
+    _topn_filter_rows += (input_rows - current_output_rows);
+    // some rows are cut, so the rows after the last output row can never be output, which
+    // is true for row_number, rank and dense_rank
+    if (current_output_rows < input_rows && !_blocks.empty() &&
+        !_partition_sort_info->_vsort_exec_exprs->need_materialize_tuple()) {
+        const auto& last_block = *_blocks.back();
+        vectorized::Block threshold_block = last_block.clone_empty();
+        auto columns = threshold_block.mutate_columns();
+        for (size_t i = 0; i < columns.size(); ++i) {
+            columns[i]->insert_from(*last_block.get_by_position(i).column, last_block.rows() - 1);
+        }
+        threshold_block.set_columns(std::move(columns));
+
+        const auto& ordering_expr_ctxs =
+                _partition_sort_info->_vsort_exec_exprs->lhs_ordering_expr_ctxs();
+        vectorized::Columns threshold_columns(ordering_expr_ctxs.size());
+        for (size_t i = 0; i < ordering_expr_ctxs.size(); ++i) {
+            int column_id = -1;
+            RETURN_IF_ERROR(ordering_expr_ctxs[i]->execute(&threshold_block, &column_id));
+            threshold_columns[i] = threshold_block.get_by_position(column_id).column;
+        }
+        _threshold_columns = std::move(threshold_columns);
+    }
     return Status::OK();
 }
 
@@ -115,6 +174,9 @@ Status PartitionSortSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo
     _selector_block_timer = ADD_TIMER(_profile, "SelectorBlockTime");
     _emplace_key_timer = ADD_TIMER(_profile, "EmplaceKeyTime");
     _passthrough_rows_counter = ADD_COUNTER(_profile, "PassThroughRowsCounter", TUnit::UNIT);
+    _threshold_filtered_rows_counter =
+            ADD_COUNTER(_profile, "ThresholdFilteredRowsCounter", TUnit::UNIT);
+    _revoke_memory_counter = ADD_COUNTER(_profile, "RevokeMemoryCount", TUnit::UNIT);
     _partition_sort_info = std::make_shared<PartitionSortInfo>(
             &_vsort_exec_exprs, p._limit, 0, p._pool, p._is_asc_order, p._nulls_first,
             p._child_x->row_desc(), state, _profile, p._has_global_limit, p._partition_inner_limit,
@@ -179,7 +241,11 @@ Status PartitionSortSinkOperatorX::sink(RuntimeState* state, vectorized::Block*
                 local_state._value_places.push_back(_pool->add(new PartitionBlocks(
                         local_state._partition_sort_info, local_state._value_places.empty())));
             }
-            local_state._value_places[0]->append_whole_block(input_block, _child_x->row_desc());
+            auto* place = local_state._value_places[0];
+            auto blocks_bytes = place->_blocks_bytes;
+            place->append_whole_block(input_block, _child_x->row_desc());
+            local_state._update_buffered_bytes(
+                    int64_t(place->_blocks_bytes) - int64_t(blocks_bytes), 0);
         } else {
             //just simply use partition num to check
             //if is TWO_PHASE_GLOBAL, must be sort all data thought partition num threshold have been exceeded.
@@ -203,6 +269,7 @@ Status PartitionSortSinkOperatorX::sink(RuntimeState* state, vectorized::Block*
     }
 
     if (eos) {
+        local_state._update_buffered_bytes(0, -local_state._unsorted_bytes);
         //seems could free for hashtable
         local_state._agg_arena_pool.reset(nullptr);
         local_state._partitioned_data.reset(nullptr);
@@ -280,21 +347,92 @@ Status PartitionSortSinkOperatorX::_emplace_into_hash_table(
                             local_state._num_partition++;
                         };
 
-                        SCOPED_TIMER(local_state._emplace_key_timer);
-                        for (size_t row = 0; row < num_rows; ++row) {
-                            auto& mapped = agg_method.lazy_emplace(state, row, creator,
-                                                                   creator_for_null_key);
-                            mapped->add_row_idx(row);
+                        {
+                            SCOPED_TIMER(local_state._emplace_key_timer);
+                            for (size_t row = 0; row < num_rows; ++row) {
+                                auto& mapped = agg_method.lazy_emplace(state, row, creator,
+                                                                       creator_for_null_key);
+                                mapped->add_row_idx(row);
+                            }
                         }
+                        // the sort columns to cut the rows after the thresholds of partitions
+                        vectorized::Block sort_block;
+                        vectorized::ColumnRawPtrs sort_columns;
+                        if (local_state._has_threshold) {
+                            sort_block = *input_block;
+                            for (const auto& ctx :
+                                 local_state._vsort_exec_exprs.lhs_ordering_expr_ctxs()) {
+                                int column_id = -1;
+                                RETURN_IF_ERROR(ctx->execute(&sort_block, &column_id));
+                                sort_columns.push_back(
+                                        sort_block.get_by_position(column_id).column.get());
+                            }
+                        }
+                        SCOPED_TIMER(local_state._selector_block_timer);
                         for (auto* place : local_state._value_places) {
-                            SCOPED_TIMER(local_state._selector_block_timer);
+                            if (place->_selector.empty()) {
+                                continue;
+                            }
+                            if (place->has_threshold() && !sort_columns.empty()) {
+                                COUNTER_UPDATE(local_state._threshold_filtered_rows_counter,
+                                               place->filter_selector_by_threshold(sort_columns));
+                                if (place->_selector.empty()) {
+                                    continue;
+                                }
+                            }
+                            auto blocks_bytes = place->_blocks_bytes;
+                            auto unsorted_bytes = place->_unsorted_bytes;
                             RETURN_IF_ERROR(place->append_block_by_selector(input_block, eos));
+                            local_state._update_buffered_bytes(
+                                    int64_t(place->_blocks_bytes) - int64_t(blocks_bytes),
+                                    int64_t(place->_unsorted_bytes) - int64_t(unsorted_bytes));
+                            local_state._has_threshold |= place->has_threshold();
                         }
                         return Status::OK();
                     }},
             local_state._partitioned_data->method_variant);
 }
 
+void PartitionSortSinkLocalState::_update_buffered_bytes(int64_t blocks_bytes_delta,
+                                                         int64_t unsorted_bytes_delta) {
+    _buffered_bytes += blocks_bytes_delta;
+    _unsorted_bytes += unsorted_bytes_delta;
+    _mem_tracker->set_consumption(_buffered_bytes);
+}
+
+Status PartitionSortSinkLocalState::_compact_partitions() {
+    COUNTER_UPDATE(_revoke_memory_counter, 1);
+    for (auto* place : _value_places) {
+        if (place->_current_input_rows == 0) {
+            continue;
+        }
+        auto blocks_bytes = place->_blocks_bytes;
+        auto unsorted_bytes = place->_unsorted_bytes;
+        RETURN_IF_ERROR(place->compact());
+        _update_buffered_bytes(int64_t(place->_blocks_bytes) - int64_t(blocks_bytes),
+                               int64_t(place->_unsorted_bytes) - int64_t(unsorted_bytes));
+        _has_threshold |= place->has_threshold();
+    }
+    return Status::OK();
+}
+
+size_t PartitionSortSinkOperatorX::revocable_mem_size(RuntimeState* state) const {
+    if (!_can_compact() || _partition_exprs_num == 0) {
+        return 0;
+    }
+    auto& local_state = get_local_state(state);
+    return local_state._unsorted_bytes;
+}
+
+Status PartitionSortSinkOperatorX::revoke_memory(RuntimeState* state) {
+    if (!_can_compact() || _partition_exprs_num == 0) {
+        return Status::OK();
+    }
+    auto& local_state = get_local_state(state);
+    SCOPED_TIMER(local_state.exec_time_counter());
+    return local_state._compact_partitions();
+}
+
 constexpr auto init_partition_hash_method =
         init_hash_method<PartitionedHashMapVariants, PartitionDataPtr>;
 
@@ -19,6 +19,7 @@
 
 #include <stdint.h>
 
+#include <algorithm>
 #include <cstdint>
 
 #include "operator.h"
@@ -67,6 +68,9 @@ public:
 
 static constexpr size_t INITIAL_BUFFERED_BLOCK_BYTES = 64 << 20;
 static constexpr size_t PARTITION_SORT_ROWS_THRESHOLD = 20000;
+// a partition of a small inner limit is sorted once it buffers this many rows or 4 times of
+// the limit, so it keeps a bounded heap of rows
+static constexpr size_t PARTITION_SORT_MIN_ROWS_THRESHOLD = 1024;
 
 struct PartitionBlocks {
 public:
@@ -80,19 +84,36 @@ public:
 
     Status do_partition_topn_sort();
 
+    // sort the rows buffered since the last sort, and keep the top rows of the partition
+    Status compact();
+
     void create_or_reset_sorter_state();
 
     void append_whole_block(vectorized::Block* input_block, const RowDescriptor& row_desc) {
         auto empty_block = vectorized::Block::create_unique(
                 vectorized::VectorizedUtils::create_empty_block(row_desc));
         empty_block->swap(*input_block);
+        _blocks_bytes += empty_block->bytes();
         _blocks.emplace_back(std::move(empty_block));
     }
 
+    // Whether the top rows of the partition are known, so the rows after the last of them
+    // can never be output.
+    bool has_threshold() const { return !_threshold_columns.empty(); }
+
+    // Remove the rows of the selector after the threshold, return the number of them.
+    size_t filter_selector_by_threshold(const vectorized::ColumnRawPtrs& sort_columns);
+
     bool reach_limit() {
         return _init_rows <= 0 || _blocks.back()->bytes() > INITIAL_BUFFERED_BLOCK_BYTES;
     }
 
+    size_t compact_rows_threshold() const {
+        return std::clamp<size_t>(_partition_sort_info->_partition_inner_limit * 4,
+                                  PARTITION_SORT_MIN_ROWS_THRESHOLD,
+                                  PARTITION_SORT_ROWS_THRESHOLD);
+    }
+
     size_t get_total_rows() const { return _total_rows; }
     size_t get_topn_filter_rows() const { return _topn_filter_rows; }
     size_t get_do_topn_count() const { return _do_partition_topn_count; }
@@ -103,8 +124,13 @@ public:
     size_t _current_input_rows = 0;
     size_t _topn_filter_rows = 0;
     size_t _do_partition_topn_count = 0;
+    // the bytes of `_blocks`, and of the rows appended since the last sort
+    size_t _blocks_bytes = 0;
+    size_t _unsorted_bytes = 0;
     int _init_rows = 4096;
     bool _is_first_sorter = false;
+    // the sort columns of the last top row, if the rows after it have been cut by a sort
+    vectorized::Columns _threshold_columns;
 
     std::unique_ptr<vectorized::SortCursorCmp> _previous_row;
     std::unique_ptr<vectorized::PartitionSorter> _partition_topn_sorter = nullptr;
@@ -221,6 +247,9 @@ public:
 private:
     friend class PartitionSortSinkOperatorX;
 
+    Status _compact_partitions();
+    void _update_buffered_bytes(int64_t blocks_bytes_delta, int64_t unsorted_bytes_delta);
+
     // Expressions and parameters used for build _sort_description
     vectorized::VSortExecExprs _vsort_exec_exprs;
     vectorized::VExprContextSPtrs _partition_expr_ctxs;
@@ -232,12 +261,19 @@ private:
     std::unique_ptr<vectorized::Arena> _agg_arena_pool;
     int _partition_exprs_num = 0;
     std::shared_ptr<PartitionSortInfo> _partition_sort_info = nullptr;
+    // whether any partition has a threshold to cut the input rows
+    bool _has_threshold = false;
+    // the bytes buffered by all the partitions, and of the rows not sorted yet
+    int64_t _buffered_bytes = 0;
+    int64_t _unsorted_bytes = 0;
 
     RuntimeProfile::Counter* _build_timer = nullptr;
     RuntimeProfile::Counter* _emplace_key_timer = nullptr;
     RuntimeProfile::Counter* _selector_block_timer = nullptr;
     RuntimeProfile::Counter* _hash_table_size_counter = nullptr;
     RuntimeProfile::Counter* _passthrough_rows_counter = nullptr;
+    RuntimeProfile::Counter* _threshold_filtered_rows_counter = nullptr;
+    RuntimeProfile::Counter* _revoke_memory_counter = nullptr;
     Status _init_hash_method();
 };
 
@@ -255,6 +291,11 @@ public:
     Status prepare(RuntimeState* state) override;
     Status open(RuntimeState* state) override;
     Status sink(RuntimeState* state, vectorized::Block* in_block, bool eos) override;
+
+    // the rows not sorted yet could be cut to the top rows of their partitions
+    size_t revocable_mem_size(RuntimeState* state) const override;
+    Status revoke_memory(RuntimeState* state) override;
+
     DataDistribution required_data_distribution() const override {
         if (_topn_phase == TPartTopNPhase::TWO_PHASE_GLOBAL) {
             return DataSinkOperatorX<PartitionSortSinkLocalState>::required_data_distribution();
@@ -279,6 +320,11 @@ private:
     std::vector<bool> _is_asc_order;
     std::vector<bool> _nulls_first;
 
+    // whether the rows of a partition may be sorted and cut before all the input is sunk
+    bool _can_compact() const {
+        return _partition_inner_limit != -1 && _topn_phase != TPartTopNPhase::TWO_PHASE_GLOBAL;
+    }
+
     Status _split_block_by_partition(vectorized::Block* input_block,
                                      PartitionSortSinkLocalState& local_state, bool eos);
     Status _emplace_into_hash_table(const vectorized::ColumnRawPtrs& key_columns,
@@ -46,14 +46,10 @@ Status PartitionedAggSinkLocalState::init(doris::RuntimeState* state,
 
     RETURN_IF_ERROR(setup_in_memory_agg_op(state));
 
-    for (const auto& probe_expr_ctx : Base::_shared_state->in_mem_shared_state->probe_expr_ctxs) {
-        key_columns_.emplace_back(probe_expr_ctx->root()->data_type()->create_column());
-    }
-    for (const auto& aggregate_evaluator :
-         Base::_shared_state->in_mem_shared_state->aggregate_evaluators) {
-        value_data_types_.emplace_back(aggregate_evaluator->function()->get_serialized_type());
-        value_columns_.emplace_back(aggregate_evaluator->function()->create_serialize_column());
-    }
+    _spill_writer.init(Base::_shared_state, parent.node_id(), Base::profile(),
+                       {_spill_serialize_hash_table_timer, Base::_spill_serialize_block_timer,
+                        Base::_spill_block_count, Base::_spill_data_size,
+                        Base::_spill_write_disk_timer, Base::_spill_write_wait_io_timer});
 
     _finish_dependency->block();
     return Status::OK();
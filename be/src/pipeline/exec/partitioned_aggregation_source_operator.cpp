@@ -20,6 +20,7 @@
 #include <string>
 
 #include "aggregation_source_operator.h"
+#include "common/config.h"
 #include "common/exception.h"
 #include "common/status.h"
 #include "pipeline/exec/operator.h"
@@ -62,6 +63,19 @@ void PartitionedAggLocalState::_init_counters() {
     _hash_table_compute_timer = ADD_TIMER(profile(), "HashTableComputeTime");
     _hash_table_emplace_timer = ADD_TIMER(profile(), "HashTableEmplaceTime");
     _hash_table_input_counter = ADD_COUNTER(profile(), "HashTableInputCount", TUnit::UNIT);
+
+    _respilled_partitions =
+            ADD_CHILD_COUNTER_WITH_LEVEL(profile(), "RespilledPartitions", TUnit::UNIT, "Spill", 1);
+    _spill_serialize_hash_table_timer =
+            ADD_CHILD_TIMER_WITH_LEVEL(profile(), "SpillSerializeHashTableTime", "Spill", 1);
+    _spill_serialize_block_timer =
+            ADD_CHILD_TIMER_WITH_LEVEL(profile(), "SpillSerializeBlockTime", "Spill", 1);
+    _spill_write_disk_timer =
+            ADD_CHILD_TIMER_WITH_LEVEL(profile(), "SpillWriteDiskTime", "Spill", 1);
+    _spill_data_size =
+            ADD_CHILD_COUNTER_WITH_LEVEL(profile(), "SpillWriteDataSize", TUnit::BYTES, "Spill", 1);
+    _spill_block_count = ADD_CHILD_COUNTER_WITH_LEVEL(profile(), "SpillWriteBlockCount",
+                                                      TUnit::UNIT, "Spill", 1);
 }
 
 #define UPDATE_PROFILE(counter, name)                           \
@@ -187,6 +201,54 @@ Status PartitionedAggLocalState::setup_in_memory_agg_op(RuntimeState* state) {
     return source_local_state->open(state);
 }
 
+size_t PartitionedAggLocalState::_hash_table_memory_usage() const {
+    auto* in_mem_state = Base::_shared_state->in_mem_shared_state;
+    size_t usage = 0;
+    if (in_mem_state->agg_arena_pool) {
+        usage += in_mem_state->agg_arena_pool->size();
+    }
+    if (in_mem_state->aggregate_data_container) {
+        usage += in_mem_state->aggregate_data_container->memory_usage();
+    }
+    std::visit(vectorized::Overload {[&](std::monostate& arg) -> void {},
+                                     [&](auto& agg_method) -> void {
+                                         usage += agg_method.hash_table->get_buffer_size_in_bytes();
+                                     }},
+               in_mem_state->agg_data->method_variant);
+    return usage;
+}
+
+Status PartitionedAggLocalState::_respill_hash_table(
+        RuntimeState* state, size_t level, std::deque<AggSpillPartitionSPtr>& sub_partitions,
+        bool eos) {
+    if (sub_partitions.empty()) {
+        _spill_writer.init(Base::_shared_state, _parent->node_id(), profile(),
+                           {_spill_serialize_hash_table_timer, _spill_serialize_block_timer,
+                            _spill_block_count, _spill_data_size, _spill_write_disk_timer,
+                            Base::_spill_write_wait_io_timer});
+        for (size_t i = 0; i < Base::_shared_state->partition_count; ++i) {
+            auto& partition =
+                    sub_partitions.emplace_back(std::make_shared<AggSpillPartition>());
+            partition->level = level;
+        }
+    }
+
+    auto* in_mem_state = Base::_shared_state->in_mem_shared_state;
+    RETURN_IF_ERROR(std::visit(
+            vectorized::Overload {[&](std::monostate& arg) -> Status {
+                                      return Status::InternalError("Unit hash table");
+                                  },
+                                  [&](auto& agg_method) -> Status {
+                                      auto& hash_table = *agg_method.hash_table;
+                                      RETURN_IF_CATCH_EXCEPTION(
+                                              return _spill_writer.spill_hash_table(
+                                                      state, agg_method, hash_table,
+                                                      sub_partitions, level, eos));
+                                  }},
+            in_mem_state->agg_data->method_variant));
+    return in_mem_state->reset_hash_table();
+}
+
 Status PartitionedAggLocalState::initiate_merge_spill_partition_agg_data(RuntimeState* state) {
     DCHECK(!_is_merging);
     Base::_shared_state->in_mem_shared_state->aggregate_data_container->init_once();
@@ -234,9 +296,22 @@ Status PartitionedAggLocalState::initiate_merge_spill_partition_agg_data(Runtime
         }};
         bool has_agg_data = false;
         auto& parent = Base::_parent->template cast<Parent>();
+        const auto max_bytes = config::spill_aggregation_partition_max_bytes;
         while (!state->is_cancelled() && !has_agg_data &&
                !_shared_state->spill_partitions.empty()) {
-            for (auto& stream : _shared_state->spill_partitions[0]->spill_streams_) {
+            auto partition = _shared_state->spill_partitions[0];
+            // the hash table of a partition which is still too big is spilled again into the
+            // partitions of the next level, which are merged before the other partitions
+            const bool can_respill =
+                    max_bytes > 0 && partition->level < _shared_state->max_partition_level();
+            std::deque<AggSpillPartitionSPtr> sub_partitions;
+            Defer close_sub_partitions {[&]() {
+                // only if the partition fails to be spilled again
+                for (auto& sub_partition : sub_partitions) {
+                    sub_partition->close();
+                }
+            }};
+            for (auto& stream : partition->spill_streams_) {
                 stream->set_read_counters(Base::_spill_read_data_time,
                                           Base::_spill_deserialize_time, Base::_spill_read_bytes,
                                           Base::_spill_read_wait_io_timer);
@@ -256,10 +331,32 @@ Status PartitionedAggLocalState::initiate_merge_spill_partition_agg_data(Runtime
                                                   _runtime_state.get(), &block);
                         RETURN_IF_ERROR(_status);
                     }
+
+                    if (can_respill &&
+                        _hash_table_memory_usage() >= static_cast<size_t>(max_bytes)) {
+                        _status = _respill_hash_table(state, partition->level + 1, sub_partitions,
+                                                      false);
+                        RETURN_IF_ERROR(_status);
+                        has_agg_data = false;
+                    }
                 }
                 (void)ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(stream);
             }
             _shared_state->spill_partitions.pop_front();
+
+            if (!sub_partitions.empty()) {
+                _status = _respill_hash_table(state, partition->level + 1, sub_partitions, true);
+                RETURN_IF_ERROR(_status);
+                has_agg_data = false;
+                COUNTER_UPDATE(_respilled_partitions, 1);
+                VLOG_DEBUG << "query " << print_id(query_id) << " agg node " << _parent->node_id()
+                           << " spill partition of level " << partition->level << " again";
+                while (!sub_partitions.empty()) {
+                    _shared_state->spill_partitions.emplace_front(
+                            std::move(sub_partitions.back()));
+                    sub_partitions.pop_back();
+                }
+            }
         }
         if (_shared_state->spill_partitions.empty()) {
             _shared_state->close();
@@ -20,6 +20,7 @@
 
 #include "common/status.h"
 #include "operator.h"
+#include "pipeline/exec/aggregation_spill_writer.h"
 
 namespace doris {
 class RuntimeState;
@@ -49,6 +50,11 @@ public:
 protected:
     void _init_counters();
 
+    size_t _hash_table_memory_usage() const;
+    /// Spill the merged hash table of a partition into the partitions of the next level.
+    Status _respill_hash_table(RuntimeState* state, size_t level,
+                               std::deque<AggSpillPartitionSPtr>& sub_partitions, bool eos);
+
     friend class PartitionedAggSourceOperatorX;
     std::unique_ptr<RuntimeState> _runtime_state;
 
@@ -72,6 +78,14 @@ protected:
     RuntimeProfile::Counter* _hash_table_compute_timer = nullptr;
     RuntimeProfile::Counter* _hash_table_emplace_timer = nullptr;
     RuntimeProfile::Counter* _hash_table_input_counter = nullptr;
+
+    AggSpillWriter _spill_writer;
+    RuntimeProfile::Counter* _respilled_partitions = nullptr;
+    RuntimeProfile::Counter* _spill_serialize_hash_table_timer = nullptr;
+    RuntimeProfile::Counter* _spill_serialize_block_timer = nullptr;
+    RuntimeProfile::Counter* _spill_write_disk_timer = nullptr;
+    RuntimeProfile::Counter* _spill_data_size = nullptr;
+    RuntimeProfile::Counter* _spill_block_count = nullptr;
 };
 class AggSourceOperatorX;
 class PartitionedAggSourceOperatorX : public OperatorX<PartitionedAggLocalState> {
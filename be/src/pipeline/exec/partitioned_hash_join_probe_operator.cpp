@@ -17,6 +17,7 @@
 
 #include "partitioned_hash_join_probe_operator.h"
 
+#include "common/config.h"
 #include "pipeline/pipeline_task.h"
 #include "util/mem_info.h"
 #include "vec/spill/spill_stream_manager.h"
@@ -39,6 +40,27 @@ Status PartitionedHashJoinProbeLocalState::init(RuntimeState* state, LocalStateI
     RETURN_IF_ERROR(_partitioner->init(p._probe_exprs));
     RETURN_IF_ERROR(_partitioner->prepare(state, p._child_x->row_desc()));
 
+    _partition_levels.resize(p._partition_count, 0);
+    // every level takes other bits of the 32 bits hash values, and the partition count of the
+    // partitioners must be an int
+    const auto max_depth = std::max(config::spill_hash_join_max_repartition_depth, 0);
+    int64_t level_partition_count = p._partition_count;
+    while (p._partition_count > 1 && _max_partition_level < static_cast<uint32_t>(max_depth) &&
+           level_partition_count * p._partition_count <= std::numeric_limits<int32_t>::max()) {
+        _divisors.emplace_back(level_partition_count);
+        level_partition_count *= p._partition_count;
+        ++_max_partition_level;
+
+        auto& build_partitioner = _build_repartitioners.emplace_back(
+                std::make_unique<PartitionerType>(static_cast<int>(level_partition_count)));
+        RETURN_IF_ERROR(build_partitioner->init(p._build_exprs));
+        RETURN_IF_ERROR(build_partitioner->prepare(state, p._build_side_child->row_desc()));
+        auto& probe_partitioner = _probe_repartitioners.emplace_back(
+                std::make_unique<PartitionerType>(static_cast<int>(level_partition_count)));
+        RETURN_IF_ERROR(probe_partitioner->init(p._probe_exprs));
+        RETURN_IF_ERROR(probe_partitioner->prepare(state, p._child_x->row_desc()));
+    }
+
     _spill_and_partition_label = ADD_LABEL_COUNTER(profile(), "Partition");
     _partition_timer = ADD_CHILD_TIMER(profile(), "PartitionTime", "Partition");
     _partition_shuffle_timer = ADD_CHILD_TIMER(profile(), "PartitionShuffleTime", "Partition");
@@ -56,6 +78,13 @@ Status PartitionedHashJoinProbeLocalState::init(RuntimeState* state, LocalStateI
     _recovery_probe_blocks =
             ADD_CHILD_COUNTER(profile(), "RecoveryProbeBlocks", TUnit::UNIT, "Spill");
     _recovery_probe_timer = ADD_CHILD_TIMER_WITH_LEVEL(profile(), "RecoveryProbeTime", "Spill", 1);
+    _repartitioned_partitions =
+            ADD_CHILD_COUNTER(profile(), "RepartitionedPartitions", TUnit::UNIT, "Spill");
+    _repartition_timer = ADD_CHILD_TIMER_WITH_LEVEL(profile(), "RepartitionTime", "Spill", 1);
+    _heavy_hitter_partitions =
+            ADD_CHILD_COUNTER(profile(), "HeavyHitterPartitions", TUnit::UNIT, "Spill");
+    _multi_pass_build_passes =
+            ADD_CHILD_COUNTER(profile(), "MultiPassBuildPasses", TUnit::UNIT, "Spill");
 
     _spill_serialize_block_timer =
             ADD_CHILD_TIMER_WITH_LEVEL(Base::profile(), "SpillSerializeBlockTime", "Spill", 1);
@@ -142,6 +171,10 @@ void PartitionedHashJoinProbeLocalState::update_probe_profile(RuntimeProfile* ch
 
 Status PartitionedHashJoinProbeLocalState::open(RuntimeState* state) {
     RETURN_IF_ERROR(PipelineXSpillLocalState::open(state));
+    for (size_t i = 0; i != _build_repartitioners.size(); ++i) {
+        RETURN_IF_ERROR(_build_repartitioners[i]->open(state));
+        RETURN_IF_ERROR(_probe_repartitioners[i]->open(state));
+    }
     return _partitioner->open(state);
 }
 Status PartitionedHashJoinProbeLocalState::close(RuntimeState* state) {
@@ -184,14 +217,7 @@ Status PartitionedHashJoinProbeLocalState::spill_probe_blocks(RuntimeState* stat
 
             auto& spilling_stream = _probe_spilling_streams[partition_index];
             if (!spilling_stream) {
-                RETURN_IF_ERROR(ExecEnv::GetInstance()->spill_stream_mgr()->register_spill_stream(
-                        state, spilling_stream, print_id(state->query_id()), "hash_probe",
-                        _parent->node_id(), std::numeric_limits<int32_t>::max(),
-                        std::numeric_limits<size_t>::max(), _runtime_profile.get()));
-                RETURN_IF_ERROR(spilling_stream->prepare_spill());
-                spilling_stream->set_write_counters(
-                        _spill_serialize_block_timer, _spill_block_count, _spill_data_size,
-                        _spill_write_disk_timer, _spill_write_wait_io_timer);
+                RETURN_IF_ERROR(_register_spill_stream(state, spilling_stream, "hash_probe"));
             }
 
             COUNTER_UPDATE(_spill_probe_blocks, blocks.size());
@@ -236,6 +262,18 @@ Status PartitionedHashJoinProbeLocalState::spill_probe_blocks(RuntimeState* stat
     return spill_io_pool->submit_func(exception_catch_func);
 }
 
+Status PartitionedHashJoinProbeLocalState::_register_spill_stream(
+        RuntimeState* state, vectorized::SpillStreamSPtr& stream, const std::string& name) {
+    RETURN_IF_ERROR(ExecEnv::GetInstance()->spill_stream_mgr()->register_spill_stream(
+            state, stream, print_id(state->query_id()), name, _parent->node_id(),
+            std::numeric_limits<int32_t>::max(), std::numeric_limits<size_t>::max(),
+            _runtime_profile.get()));
+    RETURN_IF_ERROR(stream->prepare_spill());
+    stream->set_write_counters(_spill_serialize_block_timer, _spill_block_count, _spill_data_size,
+                               _spill_write_disk_timer, _spill_write_wait_io_timer);
+    return Status::OK();
+}
+
 Status PartitionedHashJoinProbeLocalState::finish_spilling(uint32_t partition_index) {
     auto& build_spilling_stream = _shared_state->spilled_streams[partition_index];
     if (build_spilling_stream) {
@@ -296,6 +334,11 @@ Status PartitionedHashJoinProbeLocalState::recovery_build_blocks_from_disk(Runti
         _spill_wait_in_queue_timer->update(submit_timer.elapsed_time());
         SCOPED_TIMER(_recovery_build_timer);
 
+        auto& p = _parent->cast<PartitionedHashJoinProbeOperatorX>();
+        const auto max_bytes = config::spill_hash_join_partition_max_bytes;
+        _build_has_more_rows = false;
+        // the stream is still read by the next pass, or deleted by the repartition
+        bool keep_stream = false;
         bool eos = false;
         while (!eos) {
             vectorized::Block block;
@@ -328,13 +371,38 @@ Status PartitionedHashJoinProbeLocalState::recovery_build_blocks_from_disk(Runti
                     break;
                 }
             }
+
+            if (eos || max_bytes <= 0 ||
+                mutable_block->allocated_bytes() < static_cast<size_t>(max_bytes)) {
+                continue;
+            }
+
+            if (_partition_levels[partition_index] < _max_partition_level) {
+                auto build_block = mutable_block->to_block();
+                // `mutable_block` is invalid after the partitions are appended
+                mutable_block.reset();
+                st = _repartition(state, partition_index, build_block, spilled_stream);
+            } else if (p._can_join_in_passes()) {
+                st = _prepare_next_pass(state, partition_index);
+            } else {
+                // join all the build rows at once, like a partition which is not spilled
+                continue;
+            }
+            if (!st.ok()) {
+                _spill_status_ok = false;
+                _spill_status = std::move(st);
+            }
+            keep_stream = true;
+            break;
         }
 
         VLOG_DEBUG << "query: " << print_id(state->query_id())
                    << ", recovery data done for partition: " << spilled_stream->get_spill_dir()
                    << ", task id: " << state->task_id();
-        ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(spilled_stream);
-        shared_state_sptr->spilled_streams[partition_index].reset();
+        if (!keep_stream) {
+            ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(spilled_stream);
+            shared_state_sptr->spilled_streams[partition_index].reset();
+        }
         _dependency->set_ready();
     };
 
@@ -392,13 +460,17 @@ Status PartitionedHashJoinProbeLocalState::recovery_probe_blocks_from_disk(Runti
     MonotonicStopWatch submit_timer;
     submit_timer.start();
 
-    auto read_func = [this, query_id, &spilled_stream, &blocks, submit_timer] {
+    auto read_func = [this, query_id, state, &spilled_stream, &blocks, submit_timer] {
         _spill_wait_in_queue_timer->update(submit_timer.elapsed_time());
         SCOPED_TIMER(_recovery_probe_timer);
 
         vectorized::Block block;
         bool eos = false;
         auto st = spilled_stream->read_next_block_sync(&block, &eos);
+        if (st.ok() && _next_pass_probe_stream && !block.empty()) {
+            // the probe rows are joined again with the build rows of the next pass
+            st = _next_pass_probe_stream->spill_block(state, block, false);
+        }
         if (!st.ok()) {
             _spill_status_ok = false;
             _spill_status = std::move(st);
@@ -450,6 +522,182 @@ Status PartitionedHashJoinProbeLocalState::recovery_probe_blocks_from_disk(Runti
     return spill_io_pool->submit_func(exception_catch_func);
 }
 
+Status PartitionedHashJoinProbeLocalState::_spill_to_sub_partitions(
+        RuntimeState* state, vectorized::Block& block, bool is_build, uint32_t level,
+        size_t first_partition, std::vector<size_t>& partition_rows) {
+    auto& p = _parent->cast<PartitionedHashJoinProbeOperatorX>();
+    auto& partitioner = is_build ? _build_repartitioners[level] : _probe_repartitioners[level];
+    {
+        SCOPED_TIMER(_partition_timer);
+        RETURN_IF_ERROR(partitioner->do_partitioning(state, &block, _mem_tracker.get()));
+    }
+
+    SCOPED_TIMER(_partition_shuffle_timer);
+    const auto* channel_ids = partitioner->get_channel_ids().get<uint32_t>();
+    const auto divisor = _divisors[level];
+    std::vector<std::vector<uint32_t>> partition_indexes(p._partition_count);
+    for (uint32_t i = 0; i != block.rows(); ++i) {
+        partition_indexes[channel_ids[i] / divisor].emplace_back(i);
+    }
+
+    for (uint32_t i = 0; i != p._partition_count; ++i) {
+        const auto count = partition_indexes[i].size();
+        if (count == 0) {
+            continue;
+        }
+
+        auto sub_block = vectorized::MutableBlock::create_unique(block.clone_empty());
+        RETURN_IF_ERROR(sub_block->add_rows(&block, partition_indexes[i].data(),
+                                            partition_indexes[i].data() + count));
+        auto& spilling_stream = is_build ? _shared_state->spilled_streams[first_partition + i]
+                                         : _probe_spilling_streams[first_partition + i];
+        if (!spilling_stream) {
+            RETURN_IF_ERROR(_register_spill_stream(
+                    state, spilling_stream, is_build ? "hash_build_repartition" : "hash_probe"));
+        }
+        RETURN_IF_ERROR(spilling_stream->spill_block(state, sub_block->to_block(), false));
+        partition_rows[i] += count;
+    }
+    return Status::OK();
+}
+
+Status PartitionedHashJoinProbeLocalState::_repartition(
+        RuntimeState* state, uint32_t partition_index, vectorized::Block& build_block,
+        const vectorized::SpillStreamSPtr& build_stream) {
+    auto& p = _parent->cast<PartitionedHashJoinProbeOperatorX>();
+    SCOPED_TIMER(_repartition_timer);
+    const auto level = _partition_levels[partition_index];
+    const size_t first_partition = _partition_levels.size();
+    const size_t partitions = first_partition + p._partition_count;
+    _partition_levels.resize(partitions, level + 1);
+    _partitioned_blocks.resize(partitions);
+    _probe_spilling_streams.resize(partitions);
+    _shared_state->partitioned_build_blocks.resize(partitions);
+    _shared_state->spilled_streams.resize(partitions);
+
+    auto empty_build_block = build_block.clone_empty();
+    std::vector<size_t> build_rows(p._partition_count, 0);
+    RETURN_IF_ERROR(
+            _spill_to_sub_partitions(state, build_block, true, level, first_partition, build_rows));
+    build_block.clear();
+
+    bool eos = false;
+    while (!eos && !state->is_cancelled()) {
+        vectorized::Block block;
+        RETURN_IF_ERROR(build_stream->read_next_block_sync(&block, &eos));
+        COUNTER_UPDATE(_recovery_build_rows, block.rows());
+        COUNTER_UPDATE(_recovery_build_blocks, 1);
+        if (!block.empty()) {
+            RETURN_IF_ERROR(_spill_to_sub_partitions(state, block, true, level, first_partition,
+                                                     build_rows));
+        }
+    }
+    ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(build_stream);
+    _shared_state->spilled_streams[partition_index].reset();
+
+    std::vector<size_t> probe_rows(p._partition_count, 0);
+    auto& probe_blocks = _probe_blocks[partition_index];
+    auto& partitioned_block = _partitioned_blocks[partition_index];
+    if (partitioned_block && !partitioned_block->empty()) {
+        probe_blocks.emplace_back(partitioned_block->to_block());
+    }
+    partitioned_block.reset();
+    for (auto& block : probe_blocks) {
+        RETURN_IF_ERROR(_spill_to_sub_partitions(state, block, false, level, first_partition,
+                                                 probe_rows));
+    }
+    probe_blocks.clear();
+
+    auto& probe_stream = _probe_spilling_streams[partition_index];
+    if (probe_stream) {
+        eos = false;
+        while (!eos && !state->is_cancelled()) {
+            vectorized::Block block;
+            RETURN_IF_ERROR(probe_stream->read_next_block_sync(&block, &eos));
+            COUNTER_UPDATE(_recovery_probe_rows, block.rows());
+            COUNTER_UPDATE(_recovery_probe_blocks, 1);
+            if (!block.empty()) {
+                RETURN_IF_ERROR(_spill_to_sub_partitions(state, block, false, level,
+                                                         first_partition, probe_rows));
+            }
+        }
+        ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(probe_stream);
+        probe_stream.reset();
+    }
+
+    size_t total_build_rows = 0;
+    size_t max_rows_partition = 0;
+    for (uint32_t i = 0; i != p._partition_count; ++i) {
+        if (build_rows[i] > 0) {
+            _shared_state->partitioned_build_blocks[first_partition + i] =
+                    vectorized::MutableBlock::create_unique(empty_build_block.clone_empty());
+        }
+        total_build_rows += build_rows[i];
+        if (build_rows[i] > build_rows[max_rows_partition]) {
+            max_rows_partition = i;
+        }
+    }
+
+    // The rows of a few heavy keys are never split by the hash values, splitting them again
+    // only costs more io.
+    const auto heavy_hitter_percent = std::max(config::spill_hash_join_heavy_hitter_percent, 0);
+    if (total_build_rows > 0 &&
+        build_rows[max_rows_partition] * 100 >= total_build_rows * heavy_hitter_percent) {
+        _partition_levels[first_partition + max_rows_partition] = _max_partition_level;
+        COUNTER_UPDATE(_heavy_hitter_partitions, 1);
+        LOG(INFO) << "query: " << print_id(state->query_id()) << ", hash probe node: "
+                  << p.node_id() << ", task: " << state->task_id() << ", partition "
+                  << first_partition + max_rows_partition << " holds "
+                  << build_rows[max_rows_partition] << " of " << total_build_rows
+                  << " build rows of repartitioned partition " << partition_index;
+    }
+
+    COUNTER_UPDATE(_repartitioned_partitions, 1);
+    _current_partition_repartitioned = true;
+    VLOG_DEBUG << "query: " << print_id(state->query_id()) << ", hash probe node: " << p.node_id()
+               << ", task: " << state->task_id() << ", partition " << partition_index
+               << " of level " << level << " is repartitioned into " << first_partition << "-"
+               << partitions - 1;
+    return Status::OK();
+}
+
+Status PartitionedHashJoinProbeLocalState::_prepare_next_pass(RuntimeState* state,
+                                                              uint32_t partition_index) {
+    DCHECK(!_next_pass_probe_stream);
+    RETURN_IF_ERROR(_register_spill_stream(state, _next_pass_probe_stream, "hash_probe"));
+
+    // the probe rows in memory are only joined by the first pass
+    auto& probe_blocks = _probe_blocks[partition_index];
+    auto& partitioned_block = _partitioned_blocks[partition_index];
+    if (partitioned_block && !partitioned_block->empty()) {
+        probe_blocks.emplace_back(partitioned_block->to_block());
+    }
+    partitioned_block.reset();
+    for (auto& block : probe_blocks) {
+        RETURN_IF_ERROR(_next_pass_probe_stream->spill_block(state, block, false));
+    }
+
+    _build_has_more_rows = true;
+    COUNTER_UPDATE(_multi_pass_build_passes, 1);
+    return Status::OK();
+}
+
+Status PartitionedHashJoinProbeLocalState::_start_next_pass(uint32_t partition_index) {
+    auto& probe_stream = _probe_spilling_streams[partition_index];
+    DCHECK(!probe_stream);
+    if (_next_pass_probe_stream) {
+        RETURN_IF_ERROR(_next_pass_probe_stream->spill_eof());
+        _next_pass_probe_stream->set_read_counters(_spill_read_data_time, _spill_deserialize_time,
+                                                   _spill_read_bytes, _spill_read_wait_io_timer);
+        probe_stream = std::move(_next_pass_probe_stream);
+    }
+    // read the rest build rows from the stream
+    _shared_state->partitioned_build_blocks[partition_index] =
+            vectorized::MutableBlock::create_unique();
+    _build_has_more_rows = false;
+    return Status::OK();
+}
+
 PartitionedHashJoinProbeOperatorX::PartitionedHashJoinProbeOperatorX(ObjectPool* pool,
                                                                      const TPlanNode& tnode,
                                                                      int operator_id,
@@ -473,6 +721,7 @@ Status PartitionedHashJoinProbeOperatorX::init(const TPlanNode& tnode, RuntimeSt
 
     for (auto& conjunct : tnode.hash_join_node.eq_join_conjuncts) {
         _probe_exprs.emplace_back(conjunct.left);
+        _build_exprs.emplace_back(conjunct.right);
     }
 
     return Status::OK();
@@ -639,6 +888,11 @@ Status PartitionedHashJoinProbeOperatorX::pull(doris::RuntimeState* state,
         if (has_data) {
             return Status::OK();
         }
+        if (local_state._current_partition_repartitioned) {
+            // all the rows are moved to the sub partitions
+            local_state._current_partition_repartitioned = false;
+            return _move_to_next_partition(local_state, eos);
+        }
         RETURN_IF_ERROR(_setup_internal_operators(local_state, state));
         local_state._need_to_setup_internal_operators = false;
         auto& mutable_block = local_state._partitioned_blocks[partition_index];
@@ -681,18 +935,46 @@ Status PartitionedHashJoinProbeOperatorX::pull(doris::RuntimeState* state,
         VLOG_DEBUG << "query: " << print_id(state->query_id()) << ", node: " << node_id()
                    << ", task: " << state->task_id()
                    << ", partition: " << local_state._partition_cursor;
-        local_state._partition_cursor++;
-        if (local_state._partition_cursor == _partition_count) {
-            *eos = true;
-        } else {
-            RETURN_IF_ERROR(local_state.finish_spilling(local_state._partition_cursor));
+        if (local_state._build_has_more_rows) {
+            RETURN_IF_ERROR(local_state._start_next_pass(partition_index));
             local_state._need_to_setup_internal_operators = true;
+            return Status::OK();
         }
+        return _move_to_next_partition(local_state, eos);
     }
 
     return Status::OK();
 }
 
+Status PartitionedHashJoinProbeOperatorX::_move_to_next_partition(
+        PartitionedHashJoinProbeLocalState& local_state, bool* eos) const {
+    local_state._partition_cursor++;
+    // the sub partitions of the repartitioned partitions are appended
+    if (local_state._partition_cursor == local_state._partition_levels.size()) {
+        *eos = true;
+    } else {
+        RETURN_IF_ERROR(local_state.finish_spilling(local_state._partition_cursor));
+        local_state._need_to_setup_internal_operators = true;
+    }
+    return Status::OK();
+}
+
+bool PartitionedHashJoinProbeOperatorX::_can_join_in_passes() const {
+    if (_is_mark_join) {
+        return false;
+    }
+    switch (_join_op) {
+    case TJoinOp::INNER_JOIN:
+    case TJoinOp::CROSS_JOIN:
+    case TJoinOp::RIGHT_OUTER_JOIN:
+    case TJoinOp::RIGHT_SEMI_JOIN:
+    case TJoinOp::RIGHT_ANTI_JOIN:
+        return true;
+    default:
+        return false;
+    }
+}
+
 bool PartitionedHashJoinProbeOperatorX::need_more_input_data(RuntimeState* state) const {
     auto& local_state = get_local_state(state);
     if (local_state._shared_state->need_to_spill) {
@@ -65,6 +65,24 @@ private:
     template <typename LocalStateType>
     friend class StatefulOperatorX;
 
+    Status _register_spill_stream(RuntimeState* state, vectorized::SpillStreamSPtr& stream,
+                                  const std::string& name);
+
+    /// Split the build rows of a too big partition, and then its probe rows, into
+    /// `_partition_count` sub partitions appended to the partitions, by the next bits of the
+    /// hash values. Runs in the spill io thread.
+    Status _repartition(RuntimeState* state, uint32_t partition_index,
+                        vectorized::Block& build_block,
+                        const vectorized::SpillStreamSPtr& build_stream);
+    Status _spill_to_sub_partitions(RuntimeState* state, vectorized::Block& block, bool is_build,
+                                    uint32_t level, size_t first_partition,
+                                    std::vector<size_t>& partition_rows);
+
+    /// The build rows of the partition are too many to be joined at once, the rest of them are
+    /// joined in the next pass, so the probe rows are spilled again for the next pass.
+    Status _prepare_next_pass(RuntimeState* state, uint32_t partition_index);
+    Status _start_next_pass(uint32_t partition_index);
+
     std::shared_ptr<BasicSharedState> _in_mem_shared_state_sptr;
     uint32_t _partition_cursor {0};
 
@@ -83,6 +101,22 @@ private:
     std::vector<vectorized::SpillStreamSPtr> _probe_spilling_streams;
 
     std::unique_ptr<PartitionerType> _partitioner;
+
+    /// The sub partitions of a repartitioned partition are appended to the partitions, whose
+    /// level is one more than the level of their parent. The partitioners of level `i` split a
+    /// partition of level `i` by `hash % (_partition_count ^ (i + 2)) / _divisors[i]`, so
+    /// all the partitions of all levels are partitioned by different bits of the same hash.
+    std::vector<uint32_t> _partition_levels;
+    uint32_t _max_partition_level {0};
+    std::vector<std::unique_ptr<PartitionerType>> _build_repartitioners;
+    std::vector<std::unique_ptr<PartitionerType>> _probe_repartitioners;
+    std::vector<uint32_t> _divisors;
+    bool _current_partition_repartitioned {false};
+
+    /// the build rows of the current partition left for the next pass
+    bool _build_has_more_rows {false};
+    vectorized::SpillStreamSPtr _next_pass_probe_stream;
+
     std::unique_ptr<RuntimeState> _runtime_state;
     std::unique_ptr<RuntimeProfile> _internal_runtime_profile;
 
@@ -103,6 +137,10 @@ private:
     RuntimeProfile::Counter* _recovery_probe_rows = nullptr;
     RuntimeProfile::Counter* _recovery_probe_blocks = nullptr;
     RuntimeProfile::Counter* _recovery_probe_timer = nullptr;
+    RuntimeProfile::Counter* _repartitioned_partitions = nullptr;
+    RuntimeProfile::Counter* _repartition_timer = nullptr;
+    RuntimeProfile::Counter* _heavy_hitter_partitions = nullptr;
+    RuntimeProfile::Counter* _multi_pass_build_passes = nullptr;
 
     RuntimeProfile::Counter* _spill_serialize_block_timer = nullptr;
     RuntimeProfile::Counter* _spill_write_disk_timer = nullptr;
@@ -193,6 +231,13 @@ private:
 
     bool _should_revoke_memory(RuntimeState* state) const;
 
+    /// The join result of a probe row does not depend on the build rows out of the pass,
+    /// so the build rows can be joined in several passes.
+    bool _can_join_in_passes() const;
+
+    Status _move_to_next_partition(PartitionedHashJoinProbeLocalState& local_state,
+                                   bool* eos) const;
+
     void _update_profile_from_internal_states(
             PartitionedHashJoinProbeLocalState& local_state) const;
 
@@ -203,6 +248,8 @@ private:
 
     // probe expr
     std::vector<TExpr> _probe_exprs;
+    // build expr, to repartition the spilled build rows
+    std::vector<TExpr> _build_exprs;
 
     const std::vector<TExpr> _distribution_partition_exprs;
 
@@ -0,0 +1,81 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/exec/preagg_ndv_sampler.h"
+
+#include <algorithm>
+
+#include "common/config.h"
+
+namespace doris::pipeline {
+
+PreaggNdvSampler::PreaggNdvSampler()
+        : _sample_rows(config::preagg_ndv_sample_rows),
+          _reevaluate_rows(config::preagg_ndv_reevaluate_rows),
+          _passthrough_min_ndv_ratio(config::preagg_passthrough_min_ndv_ratio),
+          _full_max_ndv_ratio(config::preagg_full_agg_max_ndv_ratio) {}
+
+bool PreaggNdvSampler::add_block(const vectorized::ColumnRawPtrs& key_columns, size_t rows) {
+    if (!enabled()) {
+        return false;
+    }
+    if (_decided) {
+        if (_reevaluate_rows <= 0 || _window_rows < _sample_rows + _reevaluate_rows) {
+            _window_rows += rows;
+            return false;
+        }
+        // start the next window with this block
+        _window_rows = 0;
+        _decided = false;
+    }
+
+    auto sampled = static_cast<size_t>(std::min<int64_t>(rows, _sample_rows - _window_rows));
+    _hashes.assign(sampled, 0);
+    for (const auto* column : key_columns) {
+        if (sampled == rows) {
+            column->update_hashes_with_value(_hashes.data());
+        } else {
+            column->cut(0, sampled)->update_hashes_with_value(_hashes.data());
+        }
+    }
+    for (auto hash : _hashes) {
+        _hll.update(hash);
+    }
+    _window_rows += rows;
+    if (_window_rows < _sample_rows) {
+        return false;
+    }
+
+    auto old_mode = _mode;
+    _decide();
+    return _mode != old_mode;
+}
+
+void PreaggNdvSampler::_decide() {
+    double ndv_ratio = static_cast<double>(_hll.estimate_cardinality()) / _sample_rows;
+    if (ndv_ratio >= _passthrough_min_ndv_ratio) {
+        _mode = Mode::PASSTHROUGH;
+    } else if (ndv_ratio <= _full_max_ndv_ratio) {
+        _mode = Mode::FULL;
+    } else {
+        _mode = Mode::PARTIAL;
+    }
+    _hll.clear();
+    _decided = true;
+}
+
+} // namespace doris::pipeline
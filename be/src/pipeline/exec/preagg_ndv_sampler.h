@@ -0,0 +1,65 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "olap/hll.h"
+#include "vec/columns/column.h"
+
+namespace doris::pipeline {
+
+/// Estimates the number of distinct keys in the input of a streaming pre-aggregation by a
+/// HyperLogLog over the first rows of a window, to choose how the rows are aggregated:
+/// passed through when almost all the keys are distinct, aggregated into a hash table bounded
+/// by the reduction thresholds of the operator, or always aggregated when the keys repeat a
+/// lot. After preagg_ndv_reevaluate_rows rows, the keys of the next rows are sampled again.
+class PreaggNdvSampler {
+public:
+    enum class Mode { PASSTHROUGH, PARTIAL, FULL };
+
+    PreaggNdvSampler();
+
+    bool enabled() const { return _sample_rows > 0; }
+
+    Mode mode() const { return _mode; }
+
+    /// Sample the keys of the rows of a block if in a sampled part of the window. Returns
+    /// whether the mode changed, in which case the block is the first one of the new mode.
+    bool add_block(const vectorized::ColumnRawPtrs& key_columns, size_t rows);
+
+private:
+    void _decide();
+
+    const int64_t _sample_rows;
+    const int64_t _reevaluate_rows;
+    const double _passthrough_min_ndv_ratio;
+    const double _full_max_ndv_ratio;
+
+    Mode _mode = Mode::PARTIAL;
+    // the rows since the start of the window, of which the first _sample_rows are sampled
+    int64_t _window_rows = 0;
+    bool _decided = false;
+    HyperLogLog _hll;
+    std::vector<uint64_t> _hashes;
+};
+
+} // namespace doris::pipeline
@@ -1243,6 +1243,8 @@ Status ScanLocalState<Derived>::_init_profile() {
     _newly_create_free_blocks_num =
             ADD_COUNTER(_scanner_profile, "NewlyCreateFreeBlocksNum", TUnit::UNIT);
     _scale_up_scanners_counter = ADD_COUNTER(_scanner_profile, "NumScaleUpScanners", TUnit::UNIT);
+    _scale_down_scanners_counter =
+            ADD_COUNTER(_scanner_profile, "NumScaleDownScanners", TUnit::UNIT);
     // time of transfer thread to wait for block from scan thread
     _scanner_wait_batch_timer = ADD_TIMER(_scanner_profile, "ScannerBatchWaitTime");
     _scanner_sched_counter = ADD_COUNTER(_scanner_profile, "ScannerSchedCount", TUnit::UNIT);
@@ -1422,6 +1424,10 @@ Status ScanLocalState<Derived>::close(RuntimeState* state) {
         _scanner_ctx->stop_scanners(state);
     }
     std::list<std::shared_ptr<vectorized::ScannerDelegate>> {}.swap(_scanners);
+    if (_query_statistics && _query_statistics->storage_read().requested_page_bytes > 0) {
+        _runtime_profile->add_info_string("StorageReads",
+                                          _query_statistics->storage_read().to_string());
+    }
     COUNTER_SET(_wait_for_dependency_timer, _scan_dependency->watcher_elapse_time());
     COUNTER_SET(_wait_for_rf_timer, rf_time);
 
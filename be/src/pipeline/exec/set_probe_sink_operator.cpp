@@ -19,9 +19,11 @@
 
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <memory>
 
 #include "pipeline/exec/operator.h"
+#include "util/bitmap.h"
 #include "vec/common/hash_table/hash_table_set_probe.h"
 
 namespace doris {
@@ -171,21 +173,17 @@ template <bool is_intersect>
 void SetProbeSinkOperatorX<is_intersect>::_finalize_probe(
         SetProbeSinkLocalState<is_intersect>& local_state) {
     auto& valid_element_in_hash_tbl = local_state._shared_state->valid_element_in_hash_tbl;
-    auto& hash_table_variants = local_state._shared_state->hash_table_variants;
 
+    if constexpr (is_intersect) {
+        // the entries matched by this child are the ones left for the next child
+        auto& matched_rows = local_state._shared_state->matched_rows;
+        local_state._shared_state->alive_rows.swap(matched_rows);
+        std::fill(matched_rows.begin(), matched_rows.end(), 0);
+    }
     if (_cur_child_id != (local_state._shared_state->child_quantity - 1)) {
         _refresh_hash_table(local_state);
         if constexpr (is_intersect) {
             valid_element_in_hash_tbl = 0;
-        } else {
-            std::visit(
-                    [&](auto&& arg) {
-                        using HashTableCtxType = std::decay_t<decltype(arg)>;
-                        if constexpr (!std::is_same_v<HashTableCtxType, std::monostate>) {
-                            valid_element_in_hash_tbl = arg.hash_table->size();
-                        }
-                    },
-                    *hash_table_variants);
         }
         local_state._probe_columns.resize(
                 local_state._shared_state->child_exprs_lists[_cur_child_id + 1].size());
@@ -201,50 +199,33 @@ void SetProbeSinkOperatorX<is_intersect>::_refresh_hash_table(
         SetProbeSinkLocalState<is_intersect>& local_state) {
     auto& valid_element_in_hash_tbl = local_state._shared_state->valid_element_in_hash_tbl;
     auto& hash_table_variants = local_state._shared_state->hash_table_variants;
+    const auto* alive_rows = local_state._shared_state->alive_rows.data();
     std::visit(
             [&](auto&& arg) {
                 using HashTableCtxType = std::decay_t<decltype(arg)>;
                 if constexpr (!std::is_same_v<HashTableCtxType, std::monostate>) {
+                    // the marks are kept in the bitmaps, so the hash table is only rebuilt
+                    // when most of its entries are out of the result
+                    if (!arg.hash_table->should_be_shrink(valid_element_in_hash_tbl)) {
+                        return;
+                    }
                     auto tmp_hash_table =
                             std::make_shared<typename HashTableCtxType::HashMapType>();
-                    bool is_need_shrink =
-                            arg.hash_table->should_be_shrink(valid_element_in_hash_tbl);
-                    if (is_intersect || is_need_shrink) {
-                        tmp_hash_table->init_buf_size(size_t(
-                                valid_element_in_hash_tbl / arg.hash_table->get_factor() + 1));
-                    }
+                    tmp_hash_table->init_buf_size(
+                            size_t(valid_element_in_hash_tbl / arg.hash_table->get_factor() + 1));
 
                     arg.init_iterator();
                     auto& iter = arg.iterator;
                     auto iter_end = arg.hash_table->end();
-                    std::visit(
-                            [&](auto is_need_shrink_const) {
-                                while (iter != iter_end) {
-                                    auto& mapped = iter->get_second();
-                                    auto it = mapped.begin();
-
-                                    if constexpr (is_intersect) { //intersected
-                                        if (it->visited) {
-                                            it->visited = false;
-                                            tmp_hash_table->insert(iter->get_value());
-                                        }
-                                        ++iter;
-                                    } else { //except
-                                        if constexpr (is_need_shrink_const) {
-                                            if (!it->visited) {
-                                                tmp_hash_table->insert(iter->get_value());
-                                            }
-                                        }
-                                        ++iter;
-                                    }
-                                }
-                            },
-                            vectorized::make_bool_variant(is_need_shrink));
+                    while (iter != iter_end) {
+                        if (BitmapTest(alive_rows, iter->get_second().row_num)) {
+                            tmp_hash_table->insert(iter->get_value());
+                        }
+                        ++iter;
+                    }
 
                     arg.reset();
-                    if (is_intersect || is_need_shrink) {
-                        arg.hash_table = std::move(tmp_hash_table);
-                    }
+                    arg.hash_table = std::move(tmp_hash_table);
                 } else {
                     LOG(FATAL) << "FATAL: uninited hash table";
                     __builtin_unreachable();
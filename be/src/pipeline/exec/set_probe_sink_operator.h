@@ -49,6 +49,8 @@ public:
     Status init(RuntimeState* state, LocalSinkStateInfo& info) override;
     Status open(RuntimeState* state) override;
     int64_t* valid_element_in_hash_tbl() { return &_shared_state->valid_element_in_hash_tbl; }
+    uint8_t* alive_rows() { return _shared_state->alive_rows.data(); }
+    uint8_t* matched_rows() { return _shared_state->matched_rows.data(); }
 
 private:
     friend class SetProbeSinkOperatorX<is_intersect>;
@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "pipeline/exec/operator.h"
+#include "util/bitmap.h"
 #include "vec/common/hash_table/hash_table_set_build.h"
 #include "vec/core/materialize_block.h"
 
@@ -88,6 +89,15 @@ Status SetSinkOperatorX<is_intersect>::_process_build_block(
     vectorized::ColumnRawPtrs raw_ptrs(_child_exprs.size());
     RETURN_IF_ERROR(_extract_build_column(local_state, block, raw_ptrs, rows));
 
+    // all the entries are in the result before the first probe
+    auto& alive_rows = local_state._shared_state->alive_rows;
+    if (alive_rows.size() < BitmapSize(rows)) {
+        alive_rows.resize(BitmapSize(rows), 0xFF);
+        if constexpr (is_intersect) {
+            local_state._shared_state->matched_rows.resize(BitmapSize(rows), 0);
+        }
+    }
+
     std::visit(
             [&](auto&& arg) {
                 using HashTableCtxType = std::decay_t<decltype(arg)>;
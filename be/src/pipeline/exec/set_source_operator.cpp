@@ -21,6 +21,7 @@
 
 #include "common/status.h"
 #include "pipeline/exec/operator.h"
+#include "util/bitmap.h"
 
 namespace doris::pipeline {
 
@@ -113,18 +114,13 @@ Status SetSourceOperatorX<is_intersect>::_get_data_in_hashtable(
     hash_table_ctx.init_iterator();
     auto& iter = hash_table_ctx.iterator;
     auto block_size = 0;
+    const auto* alive_rows = local_state._shared_state->alive_rows.data();
 
     for (; iter != hash_table_ctx.hash_table->end() && block_size < batch_size; ++iter) {
         auto& value = iter->get_second();
-        auto it = value.begin();
-        if constexpr (is_intersect) {
-            if (it->visited) { //intersected: have done probe, so visited values it's the result
-                _add_result_columns(local_state, value, block_size);
-            }
-        } else {
-            if (!it->visited) { //except: haven't visited values it's the needed result
-                _add_result_columns(local_state, value, block_size);
-            }
+        // intersected: matched by every child, except: matched by none of them
+        if (BitmapTest(alive_rows, value.row_num)) {
+            _add_result_columns(local_state, value, block_size);
         }
     }
 
@@ -17,7 +17,11 @@
 
 #include "spill_sort_source_operator.h"
 
+#include <set>
+
+#include "common/config.h"
 #include "common/status.h"
+#include "runtime/query_context.h"
 #include "sort_source_operator.h"
 #include "util/runtime_profile.h"
 #include "vec/spill/spill_stream_manager.h"
@@ -70,9 +74,30 @@ Status SpillSortLocalState::close(RuntimeState* state) {
     RETURN_IF_ERROR(Base::close(state));
     return Status::OK();
 }
-int SpillSortLocalState::_calc_spill_blocks_to_merge() const {
-    int count = _external_sort_bytes_threshold / SpillSortSharedState::SORT_BLOCK_SPILL_BATCH_BYTES;
-    return std::max(2, count);
+int SpillSortLocalState::_calc_spill_blocks_to_merge(RuntimeState* state) const {
+    // each merged run holds a block, and the next one while it is read ahead
+    int64_t run_bytes = SpillSortSharedState::SORT_BLOCK_SPILL_BATCH_BYTES *
+                        (config::enable_spill_sort_merge_prefetch ? 2 : 1);
+    int64_t budget = _external_sort_bytes_threshold;
+    const auto& mem_tracker = state->get_query_ctx()->query_mem_tracker;
+    if (mem_tracker->has_limit()) {
+        // leave half of the free memory of the query to the other operators
+        budget = std::min(budget, (mem_tracker->limit() - mem_tracker->consumption()) / 2);
+    }
+    int64_t count = budget / run_bytes;
+
+    // the runs on the same hdd are read by seeking between each other
+    std::set<vectorized::SpillDataDir*> data_dirs;
+    bool all_hdd = true;
+    for (const auto& stream : _shared_state->sorted_streams) {
+        data_dirs.insert(stream->get_data_dir());
+        all_hdd &= stream->get_data_dir()->storage_medium() == TStorageMedium::HDD;
+    }
+    if (all_hdd && !data_dirs.empty()) {
+        count = std::min<int64_t>(
+                count, int64_t(config::spill_sort_merge_max_fan_in_per_hdd) * data_dirs.size());
+    }
+    return int(std::max<int64_t>(2, count));
 }
 Status SpillSortLocalState::initiate_merge_sort_spill_streams(RuntimeState* state) {
     auto& parent = Base::_parent->template cast<Parent>();
@@ -121,15 +146,23 @@ Status SpillSortLocalState::initiate_merge_sort_spill_streams(RuntimeState* stat
         vectorized::Block merge_sorted_block;
         vectorized::SpillStreamSPtr tmp_stream;
         while (!state->is_cancelled()) {
-            int max_stream_count = _calc_spill_blocks_to_merge();
+            int max_stream_count = _calc_spill_blocks_to_merge(state);
+            int stream_count = int(_shared_state->sorted_streams.size());
+            if (stream_count > max_stream_count) {
+                // the first pass merges just enough runs for the following passes to be full,
+                // and the last one to merge exactly the max runs, which reads the least data
+                int rest = (stream_count - max_stream_count) % (max_stream_count - 1);
+                stream_count = rest == 0 ? max_stream_count : rest + 1;
+            }
             VLOG_DEBUG << "query " << print_id(query_id) << " sort node " << _parent->node_id()
                        << " merge spill streams, streams count: "
                        << _shared_state->sorted_streams.size()
-                       << ", curren merge max stream count: " << max_stream_count;
+                       << ", curren merge max stream count: " << max_stream_count
+                       << ", merge stream count: " << stream_count;
             {
                 SCOPED_TIMER(Base::_spill_recover_time);
                 _status = _create_intermediate_merger(
-                        max_stream_count,
+                        stream_count,
                         parent._sort_source_operator->get_sort_description(_runtime_state.get()));
             }
             RETURN_IF_ERROR(_status);
@@ -197,16 +230,25 @@ Status SpillSortLocalState::initiate_merge_sort_spill_streams(RuntimeState* stat
 Status SpillSortLocalState::_create_intermediate_merger(
         int num_blocks, const vectorized::SortDescription& sort_description) {
     std::vector<vectorized::BlockSupplier> child_block_suppliers;
+    int64_t limit = Base::_shared_state->in_mem_shared_state->sorter->limit();
+    int64_t offset = Base::_shared_state->in_mem_shared_state->sorter->offset();
+    if (size_t(num_blocks) < _shared_state->sorted_streams.size()) {
+        // the rows skipped by the offset are only known by the last merge
+        limit = limit == -1 ? -1 : limit + offset;
+        offset = 0;
+    }
     _merger = std::make_unique<vectorized::VSortedRunMerger>(
-            sort_description, _shared_state->spill_block_batch_row_count,
-            Base::_shared_state->in_mem_shared_state->sorter->limit(),
-            Base::_shared_state->in_mem_shared_state->sorter->offset(), profile());
+            sort_description, _shared_state->spill_block_batch_row_count, limit, offset,
+            profile());
 
     _current_merging_streams.clear();
     for (int i = 0; i < num_blocks && !_shared_state->sorted_streams.empty(); ++i) {
         auto stream = _shared_state->sorted_streams.front();
         stream->set_read_counters(Base::_spill_read_data_time, Base::_spill_deserialize_time,
                                   Base::_spill_read_bytes, Base::_spill_read_wait_io_timer);
+        if (config::enable_spill_sort_merge_prefetch) {
+            RETURN_IF_ERROR(stream->enable_prefetch());
+        }
         _current_merging_streams.emplace_back(stream);
         child_block_suppliers.emplace_back(
                 std::bind(std::mem_fn(&vectorized::SpillStream::read_next_block_sync), stream.get(),
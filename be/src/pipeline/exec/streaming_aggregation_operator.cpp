@@ -631,6 +631,12 @@ Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::B
     int rows = in_block->rows();
     _places.resize(rows);
 
+    if (_ndv_sampler.add_block(key_columns, rows)) {
+        // the reduction thresholds of the hash table apply again from the new mode
+        _should_expand_hash_table = true;
+    }
+    const auto ndv_mode = _ndv_sampler.mode();
+
     // Stop expanding hash tables if we're not reducing the input sufficiently. As our
     // hash tables expand out of each level of cache hierarchy, every hash table lookup
     // will take longer. We also may not be able to expand hash tables because of memory
@@ -652,8 +658,11 @@ Status StreamingAggLocalState::_pre_agg_with_serialized_key(doris::vectorized::B
                         /// If too much memory is used during the pre-aggregation stage,
                         /// it is better to output the data directly without performing further aggregation.
                         // do not try to do agg, just init and serialize directly return the out_block
-                        if (used_too_much_memory || (hash_tbl.add_elem_size_overflow(rows) &&
-                                                     !_should_expand_preagg_hash_tables())) {
+                        if (used_too_much_memory ||
+                            ndv_mode == PreaggNdvSampler::Mode::PASSTHROUGH ||
+                            (ndv_mode != PreaggNdvSampler::Mode::FULL &&
+                             hash_tbl.add_elem_size_overflow(rows) &&
+                             !_should_expand_preagg_hash_tables())) {
                             SCOPED_TIMER(_streaming_agg_timer);
                             ret_flag = true;
 
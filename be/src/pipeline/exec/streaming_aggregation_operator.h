@@ -23,6 +23,7 @@
 
 #include "common/status.h"
 #include "pipeline/exec/operator.h"
+#include "pipeline/exec/preagg_ndv_sampler.h"
 #include "util/runtime_profile.h"
 #include "vec/core/block.h"
 
@@ -106,6 +107,7 @@ private:
     RuntimeProfile::Counter* _insert_keys_to_column_timer = nullptr;
 
     bool _should_expand_hash_table = true;
+    PreaggNdvSampler _ndv_sampler;
     int64_t _cur_num_rows_returned = 0;
     std::unique_ptr<vectorized::Arena> _agg_arena_pool = nullptr;
     vectorized::AggregatedDataVariantsUPtr _agg_data = nullptr;
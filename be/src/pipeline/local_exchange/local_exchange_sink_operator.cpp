@@ -80,6 +80,8 @@ Status LocalExchangeSinkLocalState::init(RuntimeState* state, LocalSinkStateInfo
     SCOPED_TIMER(_init_timer);
     _compute_hash_value_timer = ADD_TIMER(profile(), "ComputeHashValueTime");
     _distribute_timer = ADD_TIMER(profile(), "DistributeDataTime");
+    _free_block_hit_counter = ADD_COUNTER(profile(), "FreeBlockPoolHitCount", TUnit::UNIT);
+    _free_block_miss_counter = ADD_COUNTER(profile(), "FreeBlockPoolMissCount", TUnit::UNIT);
     return Status::OK();
 }
 
@@ -95,6 +97,12 @@ Status LocalExchangeSinkLocalState::open(RuntimeState* state) {
         auto& p = _parent->cast<LocalExchangeSinkOperatorX>();
         RETURN_IF_ERROR(p._partitioner->clone(state, _partitioner));
     }
+    if (_exchanger->get_type() == ExchangeType::ADAPTIVE_PASSTHROUGH) {
+        _adaptive_to_passthrough_counter =
+                ADD_COUNTER(profile(), "AdaptiveSwitchToPassthroughTimes", TUnit::UNIT);
+        _adaptive_to_shuffle_counter =
+                ADD_COUNTER(profile(), "AdaptiveSwitchToShuffleTimes", TUnit::UNIT);
+    }
 
     return Status::OK();
 }
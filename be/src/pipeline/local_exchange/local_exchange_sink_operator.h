@@ -53,6 +53,7 @@ private:
     friend class BroadcastExchanger;
     friend class PassToOneExchanger;
     friend class AdaptivePassthroughExchanger;
+    friend class Exchanger;
 
     Exchanger* _exchanger = nullptr;
 
@@ -62,6 +63,14 @@ private:
     std::unique_ptr<vectorized::PartitionerBase> _partitioner = nullptr;
     std::vector<uint32_t> _partition_rows_histogram;
 
+    // Free blocks reused from / newly created out of the exchanger's block pool
+    RuntimeProfile::Counter* _free_block_hit_counter = nullptr;
+    RuntimeProfile::Counter* _free_block_miss_counter = nullptr;
+
+    // Used by adaptive passthrough exchanger, the times of mode switch decided by this sink
+    RuntimeProfile::Counter* _adaptive_to_passthrough_counter = nullptr;
+    RuntimeProfile::Counter* _adaptive_to_shuffle_counter = nullptr;
+
     // Used by random passthrough exchanger
     int _channel_id = 0;
     bool _release_count = false;
@@ -23,6 +23,16 @@
 
 namespace doris::pipeline {
 
+bool Exchanger::_get_free_block(vectorized::Block* block,
+                                LocalExchangeSinkLocalState& local_state) {
+    if (_free_blocks.try_get(block)) {
+        COUNTER_UPDATE(local_state._free_block_hit_counter, 1);
+        return true;
+    }
+    COUNTER_UPDATE(local_state._free_block_miss_counter, 1);
+    return false;
+}
+
 Status ShuffleExchanger::sink(RuntimeState* state, vectorized::Block* in_block, bool eos,
                               LocalExchangeSinkLocalState& local_state) {
     {
@@ -114,7 +124,7 @@ Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __rest
 
     vectorized::Block data_block;
     std::shared_ptr<ShuffleBlockWrapper> new_block_wrapper;
-    if (_free_blocks.try_dequeue(data_block)) {
+    if (_get_free_block(&data_block, local_state)) {
         new_block_wrapper = ShuffleBlockWrapper::create_shared(std::move(data_block));
     } else {
         new_block_wrapper = ShuffleBlockWrapper::create_shared(block->clone_empty());
@@ -181,7 +191,7 @@ Status ShuffleExchanger::_split_rows(RuntimeState* state, const uint32_t* __rest
 Status PassthroughExchanger::sink(RuntimeState* state, vectorized::Block* in_block, bool eos,
                                   LocalExchangeSinkLocalState& local_state) {
     vectorized::Block new_block;
-    if (!_free_blocks.try_dequeue(new_block)) {
+    if (!_get_free_block(&new_block, local_state)) {
         new_block = {in_block->clone_empty()};
     }
     new_block.swap(*in_block);
@@ -209,19 +219,13 @@ Status PassthroughExchanger::get_block(RuntimeState* state, vectorized::Block* b
             block->swap(next_block);
             local_state._shared_state->sub_mem_usage(local_state._channel_id,
                                                      block->allocated_bytes());
-            if (_free_block_limit == 0 ||
-                _free_blocks.size_approx() < _free_block_limit * _num_sources) {
-                _free_blocks.enqueue(std::move(next_block));
-            }
+            _free_blocks.give_back(std::move(next_block));
         } else {
             *eos = true;
         }
     } else if (_data_queue[local_state._channel_id].try_dequeue(next_block)) {
         block->swap(next_block);
-        if (_free_block_limit == 0 ||
-            _free_blocks.size_approx() < _free_block_limit * _num_sources) {
-            _free_blocks.enqueue(std::move(next_block));
-        }
+        _free_blocks.give_back(std::move(next_block));
         local_state._shared_state->sub_mem_usage(local_state._channel_id, block->allocated_bytes());
     } else {
         COUNTER_UPDATE(local_state._get_block_failed_counter, 1);
@@ -303,11 +307,12 @@ Status AdaptivePassthroughExchanger::_passthrough_sink(RuntimeState* state,
                                                        vectorized::Block* in_block, bool eos,
                                                        LocalExchangeSinkLocalState& local_state) {
     vectorized::Block new_block;
-    if (!_free_blocks.try_dequeue(new_block)) {
+    if (!_get_free_block(&new_block, local_state)) {
         new_block = {in_block->clone_empty()};
     }
     new_block.swap(*in_block);
     auto channel_id = (local_state._channel_id++) % _num_partitions;
+    _channel_rows[channel_id] += new_block.rows();
     local_state._shared_state->add_mem_usage(channel_id, new_block.allocated_bytes());
     _data_queue[channel_id].enqueue(std::move(new_block));
     local_state._shared_state->set_ready_to_read(channel_id);
@@ -375,13 +380,48 @@ Status AdaptivePassthroughExchanger::_split_rows(RuntimeState* state,
 
 Status AdaptivePassthroughExchanger::sink(RuntimeState* state, vectorized::Block* in_block,
                                           bool eos, LocalExchangeSinkLocalState& local_state) {
+    const int64_t rows = in_block->rows();
+    _window_rows += rows;
+    auto max_rows = _window_max_block_rows.load();
+    while (rows > max_rows && !_window_max_block_rows.compare_exchange_weak(max_rows, rows)) {
+    }
+    _window_blocks++;
+
     if (_is_pass_through) {
-        return _passthrough_sink(state, in_block, eos, local_state);
+        RETURN_IF_ERROR(_passthrough_sink(state, in_block, eos, local_state));
     } else {
-        if (_total_block++ > _num_partitions) {
+        RETURN_IF_ERROR(_shuffle_sink(state, in_block, eos, local_state));
+    }
+
+    // Only the sink which reaches the end of the window adjusts the mode.
+    if (_total_block++ == _next_check_block.load() + _num_partitions) {
+        _adjust_mode(local_state);
+    }
+    return Status::OK();
+}
+
+void AdaptivePassthroughExchanger::_adjust_mode(LocalExchangeSinkLocalState& local_state) {
+    const auto blocks = _window_blocks.exchange(0);
+    const auto rows = _window_rows.exchange(0);
+    const auto max_block_rows = _window_max_block_rows.exchange(0);
+    _next_check_block = _total_block.load() + _num_partitions * (RECHECK_WINDOW_FACTOR - 1);
+    int64_t max_channel_rows = 0;
+    for (int i = 0; i < _num_partitions; i++) {
+        max_channel_rows = std::max(max_channel_rows, _channel_rows[i].exchange(0));
+    }
+    if (blocks == 0 || rows == 0) {
+        return;
+    }
+
+    if (!_is_pass_through) {
+        // Blocks of similar size are balanced by passthrough without copying rows.
+        if (max_block_rows <= SKEW_RATIO * rows / blocks) {
             _is_pass_through = true;
+            COUNTER_UPDATE(local_state._adaptive_to_passthrough_counter, 1);
         }
-        return _shuffle_sink(state, in_block, eos, local_state);
+    } else if (max_channel_rows > SKEW_RATIO * rows / _num_partitions) {
+        _is_pass_through = false;
+        COUNTER_UPDATE(local_state._adaptive_to_shuffle_counter, 1);
     }
 }
 
@@ -392,10 +432,7 @@ Status AdaptivePassthroughExchanger::get_block(RuntimeState* state, vectorized::
     if (_running_sink_operators == 0) {
         if (_data_queue[local_state._channel_id].try_dequeue(next_block)) {
             block->swap(next_block);
-            if (_free_block_limit == 0 ||
-                _free_blocks.size_approx() < _free_block_limit * _num_sources) {
-                _free_blocks.enqueue(std::move(next_block));
-            }
+            _free_blocks.give_back(std::move(next_block));
             local_state._shared_state->sub_mem_usage(local_state._channel_id,
                                                      block->allocated_bytes());
         } else {
@@ -403,10 +440,7 @@ Status AdaptivePassthroughExchanger::get_block(RuntimeState* state, vectorized::
         }
     } else if (_data_queue[local_state._channel_id].try_dequeue(next_block)) {
         block->swap(next_block);
-        if (_free_block_limit == 0 ||
-            _free_blocks.size_approx() < _free_block_limit * _num_sources) {
-            _free_blocks.enqueue(std::move(next_block));
-        }
+        _free_blocks.give_back(std::move(next_block));
         local_state._shared_state->sub_mem_usage(local_state._channel_id, block->allocated_bytes());
     } else {
         COUNTER_UPDATE(local_state._get_block_failed_counter, 1);
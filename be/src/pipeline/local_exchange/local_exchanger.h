@@ -19,6 +19,7 @@
 
 #include "pipeline/dependency.h"
 #include "pipeline/exec/operator.h"
+#include "vec/core/block_pool.h"
 
 namespace doris::pipeline {
 
@@ -34,14 +35,16 @@ public:
               _num_partitions(num_partitions),
               _num_senders(running_sink_operators),
               _num_sources(num_partitions),
-              _free_block_limit(free_block_limit) {}
+              _free_block_limit(free_block_limit),
+              _free_blocks(free_block_limit * _num_sources) {}
     Exchanger(int running_sink_operators, int num_sources, int num_partitions, int free_block_limit)
             : _running_sink_operators(running_sink_operators),
               _running_source_operators(num_partitions),
               _num_partitions(num_partitions),
               _num_senders(running_sink_operators),
               _num_sources(num_sources),
-              _free_block_limit(free_block_limit) {}
+              _free_block_limit(free_block_limit),
+              _free_blocks(free_block_limit * _num_sources) {}
     virtual ~Exchanger() = default;
     virtual Status get_block(RuntimeState* state, vectorized::Block* block, bool* eos,
                              LocalExchangeSourceLocalState& local_state) = 0;
@@ -56,13 +59,18 @@ protected:
     friend class LocalExchangeSourceLocalState;
     friend class LocalExchangeSinkOperatorX;
     friend class LocalExchangeSinkLocalState;
+
+    // Take a free block from the pool and record the hit or miss in the sink's profile.
+    bool _get_free_block(vectorized::Block* block, LocalExchangeSinkLocalState& local_state);
+
     std::atomic<int> _running_sink_operators = 0;
     std::atomic<int> _running_source_operators = 0;
     const int _num_partitions;
     const int _num_senders;
     const int _num_sources;
     const int _free_block_limit = 0;
-    moodycamel::ConcurrentQueue<vectorized::Block> _free_blocks;
+    // 0 limit means unbounded, otherwise each source keeps at most `_free_block_limit` blocks.
+    vectorized::BlockPool _free_blocks;
 };
 
 class LocalExchangeSourceLocalState;
@@ -75,13 +83,7 @@ struct ShuffleBlockWrapper {
     void unref(LocalExchangeSharedState* shared_state) {
         if (ref_count.fetch_sub(1) == 1) {
             shared_state->sub_total_mem_usage(data_block.allocated_bytes());
-            if (shared_state->exchanger->_free_block_limit == 0 ||
-                shared_state->exchanger->_free_blocks.size_approx() <
-                        shared_state->exchanger->_free_block_limit *
-                                shared_state->exchanger->_num_sources) {
-                data_block.clear_column_data();
-                shared_state->exchanger->_free_blocks.enqueue(std::move(data_block));
-            }
+            shared_state->exchanger->_free_blocks.give_back(std::move(data_block));
         }
     }
     std::atomic<int> ref_count = 0;
@@ -199,13 +201,25 @@ private:
 
 //The code in AdaptivePassthroughExchanger is essentially
 // a copy of ShuffleExchanger and PassthroughExchanger.
+// It starts with round-robin row shuffle, and decides the mode by the rows observed in each
+// window of blocks:
+// 1. In shuffle mode, if the input blocks are of similar size, passthrough whole blocks is
+//    balanced enough, so switch to passthrough mode to save the copies.
+// 2. In passthrough mode, if the rows received by one channel are skewed, switch back to
+//    round-robin row shuffle.
+// Hash distribution is never required by the users of this exchanger, so changing the mode
+// does not affect the correctness.
 class AdaptivePassthroughExchanger : public Exchanger {
 public:
     ENABLE_FACTORY_CREATOR(AdaptivePassthroughExchanger);
     AdaptivePassthroughExchanger(int running_sink_operators, int num_partitions,
                                  int free_block_limit)
-            : Exchanger(running_sink_operators, num_partitions, free_block_limit) {
+            : Exchanger(running_sink_operators, num_partitions, free_block_limit),
+              _channel_rows(new std::atomic_int64_t[num_partitions]) {
         _data_queue.resize(num_partitions);
+        for (int i = 0; i < num_partitions; i++) {
+            _channel_rows[i] = 0;
+        }
     }
     Status sink(RuntimeState* state, vectorized::Block* in_block, bool eos,
                 LocalExchangeSinkLocalState& local_state) override;
@@ -222,10 +236,25 @@ private:
     Status _split_rows(RuntimeState* state, const uint32_t* __restrict channel_ids,
                        vectorized::Block* block, bool eos,
                        LocalExchangeSinkLocalState& local_state);
+    // Called by the sink which finishes a window, decide the mode of next window.
+    void _adjust_mode(LocalExchangeSinkLocalState& local_state);
+
     std::vector<moodycamel::ConcurrentQueue<vectorized::Block>> _data_queue;
 
+    // A row count is skewed if it is larger than SKEW_RATIO times of the average.
+    static constexpr double SKEW_RATIO = 2.0;
+    // The first window is `_num_partitions` blocks, the following ones are
+    // `RECHECK_WINDOW_FACTOR` times larger.
+    static constexpr int RECHECK_WINDOW_FACTOR = 4;
+
     std::atomic_bool _is_pass_through = false;
     std::atomic_int32_t _total_block = 0;
+    std::atomic_int32_t _next_check_block = 0;
+    // statistics of current window
+    std::atomic_int32_t _window_blocks = 0;
+    std::atomic_int64_t _window_rows = 0;
+    std::atomic_int64_t _window_max_block_rows = 0;
+    std::unique_ptr<std::atomic_int64_t[]> _channel_rows;
 };
 
 } // namespace doris::pipeline
@@ -49,6 +49,7 @@
 #include "pipeline/exec/exchange_sink_operator.h"
 #include "pipeline/exec/exchange_source_operator.h"
 #include "pipeline/exec/file_scan_operator.h"
+#include "pipeline/exec/fragment_cache_operator.h"
 #include "pipeline/exec/group_commit_block_sink_operator.h"
 #include "pipeline/exec/group_commit_scan_operator.h"
 #include "pipeline/exec/hashjoin_build_sink.h"
@@ -92,6 +93,7 @@
 #include "pipeline/local_exchange/local_exchange_source_operator.h"
 #include "pipeline/task_scheduler.h"
 #include "pipeline_task.h"
+#include "runtime/cache/fragment_cache.h"
 #include "runtime/exec_env.h"
 #include "runtime/fragment_mgr.h"
 #include "runtime/runtime_filter_mgr.h"
@@ -102,7 +104,9 @@
 #include "service/backend_options.h"
 #include "util/container_util.hpp"
 #include "util/debug_util.h"
+#include "util/thrift_util.h"
 #include "util/uid_util.h"
+#include "vec/common/sip_hash.h"
 #include "vec/runtime/vdata_stream_mgr.h"
 
 namespace doris::pipeline {
@@ -642,13 +646,18 @@ Status PipelineFragmentContext::_create_tree_helper(ObjectPool* pool,
     OperatorXPtr op = nullptr;
     RETURN_IF_ERROR(_create_operator(pool, tnodes[*node_idx], request, descs, op, cur_pipe,
                                      parent == nullptr ? -1 : parent->node_id(), child_idx));
+    // the fragment cache operator takes the place of the pre-aggregation it caches in the tree
+    OperatorXPtr cache_op = nullptr;
+    RETURN_IF_ERROR(_create_fragment_cache_operator(pool, tnodes, *node_idx, request, op, cur_pipe,
+                                                    &cache_op));
+    auto tree_op = cache_op ? cache_op : op;
 
     // assert(parent != nullptr || (node_idx == 0 && root_expr != nullptr));
     if (parent != nullptr) {
         // add to parent's child(s)
-        RETURN_IF_ERROR(parent->set_child(op));
+        RETURN_IF_ERROR(parent->set_child(tree_op));
     } else {
-        *root = op;
+        *root = tree_op;
     }
 
     // rely on that tnodes is preorder of the plan
@@ -667,11 +676,63 @@ Status PipelineFragmentContext::_create_tree_helper(ObjectPool* pool,
         }
     }
 
+    if (cache_op) {
+        // the scan skips reading when the cache has the output of its tablet
+        static_cast<OlapScanOperatorX*>(op->get_child().get())
+                ->set_fragment_cache_operator_id(cache_op->operator_id());
+    }
+
     RETURN_IF_ERROR(op->init(tnode, _runtime_state.get()));
 
     return Status::OK();
 }
 
+Status PipelineFragmentContext::_create_fragment_cache_operator(
+        ObjectPool* pool, const std::vector<TPlanNode>& tnodes, int node_idx,
+        const doris::TPipelineFragmentParams& request, const OperatorXPtr& op,
+        PipelinePtr& cur_pipe, OperatorXPtr* cache_op) {
+    const TPlanNode& tnode = tnodes[node_idx];
+    // Only a streaming pre-aggregation right over an olap scan is cached, when each task scans
+    // its own tablets and nothing besides the plan, like a runtime filter or a limit, changes
+    // the output.
+    if (FragmentCache::instance() == nullptr || request.__isset.parallel_instances ||
+        dynamic_cast<StreamingAggOperatorX*>(op.get()) == nullptr || tnode.limit >= 0 ||
+        tnode.num_children != 1 || node_idx + 1 >= tnodes.size()) {
+        return Status::OK();
+    }
+    const TPlanNode& scan_tnode = tnodes[node_idx + 1];
+    if (scan_tnode.node_type != TPlanNodeType::OLAP_SCAN_NODE || scan_tnode.num_children != 0 ||
+        scan_tnode.limit >= 0 || !scan_tnode.runtime_filters.empty()) {
+        return Status::OK();
+    }
+
+    // The plan of the aggregation and the scan, with the predicates, identifies the output on
+    // a tablet. The time zone changes the results of the time functions.
+    ThriftSerializer serializer(false, 4096);
+    std::string plan;
+    for (auto plan_node : {tnode, scan_tnode}) {
+        uint8_t* buf = nullptr;
+        uint32_t len = 0;
+        RETURN_IF_ERROR(serializer.serialize(&plan_node, &len, &buf));
+        plan.append(reinterpret_cast<const char*>(buf), len);
+    }
+    plan.append(_runtime_state->timezone());
+    std::string digest(16, '\0');
+    SipHash hash;
+    hash.update(plan.data(), plan.size());
+    hash.get128(digest.data());
+
+    cache_op->reset(new FragmentCacheOperatorX(pool, tnode.node_id, next_operator_id(),
+                                               std::move(digest)));
+    (*cache_op)->set_parallel_tasks(cur_pipe->num_tasks());
+    // the operators of a pipeline are in the order from the root until the source is added, op
+    // is the last one
+    auto& operators = cur_pipe->operator_xs();
+    DCHECK(operators.back() == op);
+    operators.insert(operators.end() - 1, *cache_op);
+    return (*cache_op)->set_child(op);
+}
+
 void PipelineFragmentContext::_inherit_pipeline_properties(
         const DataDistribution& data_distribution, PipelinePtr pipe_with_source,
         PipelinePtr pipe_with_sink) {
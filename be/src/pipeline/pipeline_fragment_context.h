@@ -151,6 +151,13 @@ private:
                             const doris::TPipelineFragmentParams& request,
                             const DescriptorTbl& descs, OperatorXPtr& op, PipelinePtr& cur_pipe,
                             int parent_idx, int child_idx);
+    // create the FragmentCacheOperatorX above op in cur_pipe if op is a streaming
+    // pre-aggregation whose output can be cached per tablet, cache_op is nullptr otherwise
+    Status _create_fragment_cache_operator(ObjectPool* pool, const std::vector<TPlanNode>& tnodes,
+                                           int node_idx,
+                                           const doris::TPipelineFragmentParams& request,
+                                           const OperatorXPtr& op, PipelinePtr& cur_pipe,
+                                           OperatorXPtr* cache_op);
     template <bool is_intersect>
     Status _build_operators_for_set_operation_node(ObjectPool* pool, const TPlanNode& tnode,
                                                    const DescriptorTbl& descs, OperatorXPtr& op,
@@ -22,6 +22,7 @@
 #include <glog/logging.h>
 #include <stddef.h>
 
+#include <algorithm>
 #include <ostream>
 #include <vector>
 
@@ -30,8 +31,10 @@
 #include "pipeline/exec/scan_operator.h"
 #include "pipeline/pipeline.h"
 #include "pipeline/pipeline_fragment_context.h"
+#include "pipeline/pipeline_tracing.h"
 #include "pipeline/task_queue.h"
 #include "runtime/descriptors.h"
+#include "runtime/exec_env.h"
 #include "runtime/query_context.h"
 #include "runtime/thread_context.h"
 #include "util/container_util.hpp"
@@ -111,6 +114,15 @@ Status PipelineTask::prepare(const TPipelineInstanceParams& local_params, const
         query_ctx->register_query_statistics(
                 _state->get_local_state(op->operator_id())->get_query_statistics_ptr());
     }
+    _operator_latency_stats.resize(_operators.size(), nullptr);
+    // the timers are added by `_init_profile` if the stats are enabled
+    if (!_blocked_timers.empty()) {
+        auto* tracer = ExecEnv::GetInstance()->pipeline_tracer_context();
+        for (size_t i = 0; i < _operators.size(); ++i) {
+            _operator_latency_stats[i] = tracer->latency_stats(_operators[i]->get_name());
+        }
+        _sink_latency_stats = tracer->latency_stats(_sink->get_name());
+    }
     {
         std::vector<Dependency*> filter_dependencies;
         const auto& deps = _state->get_local_state(_source->operator_id())->filter_dependencies();
@@ -186,6 +198,24 @@ void PipelineTask::_init_profile() {
     _schedule_counts = ADD_COUNTER(_task_profile, "NumScheduleTimes", TUnit::UNIT);
     _yield_counts = ADD_COUNTER(_task_profile, "NumYieldTimes", TUnit::UNIT);
     _core_change_times = ADD_COUNTER(_task_profile, "CoreChangeTimes", TUnit::UNIT);
+    _numa_local_steal_times = ADD_COUNTER(_task_profile, "NumaLocalStealTimes", TUnit::UNIT);
+    _numa_remote_steal_times = ADD_COUNTER(_task_profile, "NumaRemoteStealTimes", TUnit::UNIT);
+
+    if (config::enable_pipeline_task_latency_stats) {
+        static const char* blocked_timer_names[OperatorLatencyStats::NUM_BLOCKED_KINDS] = {
+                "BlockedByScanTime", "BlockedByExchangeTime", "BlockedByRuntimeFilterTime",
+                "BlockedBySpillTime", "BlockedByOtherTime"};
+        for (const auto* name : blocked_timer_names) {
+            _blocked_timers.push_back(ADD_TIMER(_task_profile, name));
+        }
+    }
+    if (config::enable_pipeline_task_perf_counters) {
+        static const char* perf_counter_names[ThreadPerfCounters::NUM_COUNTERS] = {
+                "CpuCycles", "Instructions", "LLCMisses", "BranchMisses"};
+        for (int i = 0; i < ThreadPerfCounters::NUM_COUNTERS; ++i) {
+            _perf_counters[i] = ADD_COUNTER(_task_profile, perf_counter_names[i], TUnit::UNIT);
+        }
+    }
 }
 
 void PipelineTask::_fresh_profile_counter() {
@@ -226,14 +256,15 @@ bool PipelineTask::_wait_to_start() {
     // 2. Runtime filter dependencies are ready
     _blocked_dep = _execution_dep->is_blocked_by(this);
     if (_blocked_dep != nullptr) {
-        static_cast<Dependency*>(_blocked_dep)->start_watcher();
+        _start_blocked(_sink_latency_stats);
         return true;
     }
 
     for (auto* op_dep : _filter_dependencies) {
         _blocked_dep = op_dep->is_blocked_by(this);
         if (_blocked_dep != nullptr) {
-            _blocked_dep->start_watcher();
+            // runtime filters are waited by the source operator
+            _start_blocked(_operator_latency_stats.front());
             return true;
         }
     }
@@ -248,7 +279,7 @@ bool PipelineTask::_is_blocked() {
             for (auto* dep : _read_dependencies[i]) {
                 _blocked_dep = dep->is_blocked_by(this);
                 if (_blocked_dep != nullptr) {
-                    _blocked_dep->start_watcher();
+                    _start_blocked(_operator_latency_stats[i]);
                     return true;
                 }
             }
@@ -262,13 +293,40 @@ bool PipelineTask::_is_blocked() {
     for (auto* op_dep : _write_dependencies) {
         _blocked_dep = op_dep->is_blocked_by(this);
         if (_blocked_dep != nullptr) {
-            _blocked_dep->start_watcher();
+            _start_blocked(_sink_latency_stats);
             return true;
         }
     }
     return false;
 }
 
+void PipelineTask::_start_blocked(OperatorLatencyStats* stats) {
+    _blocked_dep->start_watcher();
+    if (stats != nullptr) {
+        _blocked_latency_stats = stats;
+        _blocked_kind = OperatorLatencyStats::blocked_kind(_blocked_dep->name());
+        _blocked_begin_ns = MonotonicNanos();
+    }
+}
+
+void PipelineTask::pop_out_runnable_queue() {
+    _wait_worker_watcher.stop();
+    if (_sink_latency_stats == nullptr) {
+        return;
+    }
+    // The dependency may wake the task up before the last execution returns, so the time
+    // points are not always in order.
+    int64_t now = MonotonicNanos();
+    int64_t runnable_begin = _runnable_begin_ns.load(std::memory_order_relaxed);
+    _sink_latency_stats->queue_wait.add(std::max<int64_t>(0, now - runnable_begin) / 1000);
+    if (_blocked_latency_stats != nullptr) {
+        int64_t blocked_ns = std::max<int64_t>(0, runnable_begin - _blocked_begin_ns);
+        _blocked_latency_stats->blocked[_blocked_kind].add(blocked_ns / 1000);
+        COUNTER_UPDATE(_blocked_timers[_blocked_kind], blocked_ns);
+        _blocked_latency_stats = nullptr;
+    }
+}
+
 Status PipelineTask::execute(bool* eos) {
     SCOPED_TIMER(_task_profile->total_time_counter());
     SCOPED_TIMER(_exec_timer);
@@ -286,7 +344,21 @@ Status PipelineTask::execute(bool* eos) {
     });
     ThreadCpuStopWatch cpu_time_stop_watch;
     cpu_time_stop_watch.start();
+    int64_t slice_begin_ns = _sink_latency_stats != nullptr ? MonotonicNanos() : 0;
+    // the counters of the executor thread are read at the begin and the end of the execution
+    auto* perf_counters = _perf_counters[0] != nullptr ? ThreadPerfCounters::current() : nullptr;
+    ThreadPerfCounters::Values perf_begin;
+    bool perf_started = perf_counters != nullptr && perf_counters->read(&perf_begin);
     Defer defer {[&]() {
+        if (_sink_latency_stats != nullptr) {
+            _sink_latency_stats->run_slice.add((MonotonicNanos() - slice_begin_ns) / 1000);
+        }
+        ThreadPerfCounters::Values perf_end;
+        if (perf_started && perf_counters->read(&perf_end)) {
+            for (int i = 0; i < ThreadPerfCounters::NUM_COUNTERS; ++i) {
+                COUNTER_UPDATE(_perf_counters[i], perf_end[i] - perf_begin[i]);
+            }
+        }
         if (_task_queue) {
             _task_queue->update_statistics(this, time_spent);
         }
@@ -324,7 +396,10 @@ Status PipelineTask::execute(bool* eos) {
         _block->clear_column_data(_root->row_desc().num_materialized_slots());
         auto* block = _block.get();
 
-        auto sink_revocable_mem_size = _sink->revocable_mem_size(_state);
+        int64_t sink_revocable_mem_size = _sink->revocable_mem_size(_state);
+        _state->get_query_ctx()->update_revocable_mem_size(sink_revocable_mem_size -
+                                                           _reported_revocable_mem_size);
+        _reported_revocable_mem_size = sink_revocable_mem_size;
         if (should_revoke_memory(_state, sink_revocable_mem_size)) {
             RETURN_IF_ERROR(_sink->revoke_memory(_state));
             continue;
@@ -357,6 +432,7 @@ Status PipelineTask::execute(bool* eos) {
                 return internal_st;
             };
             status = sink_function();
+            _state->get_sink_local_state()->sample_mem_timeline();
             if (!status.is<ErrorCode::END_OF_FILE>()) {
                 RETURN_IF_ERROR(status);
             }
@@ -374,12 +450,18 @@ Status PipelineTask::execute(bool* eos) {
 
 bool PipelineTask::should_revoke_memory(RuntimeState* state, int64_t revocable_mem_bytes) {
     auto* query_ctx = state->get_query_ctx();
+    const auto min_revocable_mem_bytes = state->min_revocable_mem();
+    if (query_ctx->is_spill_requested() && revocable_mem_bytes >= min_revocable_mem_bytes) {
+        VLOG_DEBUG << "query " << print_id(state->query_id())
+                   << " revoke memory, requested by memory gc";
+        return true;
+    }
+
     auto wg = query_ctx->workload_group();
     if (!wg) {
         LOG_ONCE(INFO) << "no workload group for query " << print_id(state->query_id());
         return false;
     }
-    const auto min_revocable_mem_bytes = state->min_revocable_mem();
 
     if (UNLIKELY(state->enable_force_spill())) {
         if (revocable_mem_bytes >= min_revocable_mem_bytes) {
@@ -446,6 +528,8 @@ Status PipelineTask::close(Status exec_status) {
     {
         SCOPED_RAW_TIMER(&close_ns);
         s = _sink->close(_state, exec_status);
+        _state->get_query_ctx()->update_revocable_mem_size(-_reported_revocable_mem_size);
+        _reported_revocable_mem_size = 0;
         for (auto& op : _operators) {
             auto tem = op->close(_state);
             if (!tem.ok() && s.ok()) {
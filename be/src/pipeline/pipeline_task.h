@@ -19,6 +19,7 @@
 
 #include <stdint.h>
 
+#include <array>
 #include <memory>
 #include <string>
 #include <vector>
@@ -27,8 +28,10 @@
 #include "pipeline/dependency.h"
 #include "pipeline/exec/operator.h"
 #include "pipeline/pipeline.h"
+#include "util/perf_counters.h"
 #include "util/runtime_profile.h"
 #include "util/stopwatch.hpp"
+#include "util/time.h"
 #include "vec/core/block.h"
 
 namespace doris {
@@ -44,6 +47,7 @@ namespace doris::pipeline {
 class TaskQueue;
 class PriorityTaskQueue;
 class Dependency;
+struct OperatorLatencyStats;
 
 class PipelineTask {
 public:
@@ -182,9 +186,15 @@ public:
     void put_in_runnable_queue() {
         _schedule_time++;
         _wait_worker_watcher.start();
+        _runnable_begin_ns.store(MonotonicNanos(), std::memory_order_relaxed);
     }
 
-    void pop_out_runnable_queue() { _wait_worker_watcher.stop(); }
+    void pop_out_runnable_queue();
+
+    // Called by the task queue when the task is stolen by an executor other than its owner.
+    void on_stolen(bool cross_numa_node) {
+        COUNTER_UPDATE(cross_numa_node ? _numa_remote_steal_times : _numa_local_steal_times, 1);
+    }
 
     bool is_running() { return _running.load(); }
     void set_running(bool running) { _running = running; }
@@ -228,6 +238,8 @@ public:
 private:
     friend class RuntimeFilterDependency;
     bool _is_blocked();
+    // Called after `_blocked_dep` blocks the operator whose latency stats is `stats`.
+    void _start_blocked(OperatorLatencyStats* stats);
     bool _wait_to_start();
 
     Status _extract_dependencies();
@@ -250,6 +262,8 @@ private:
     // it may be visited by different thread but there is no race condition
     // so no need to add lock
     uint64_t _runtime = 0;
+    // the revocable memory of the sink added to the query context
+    int64_t _reported_revocable_mem_size = 0;
     // it's visited in one thread, so no need to thread synchronization
     // 1 get task, (set _queue_level/_core_id)
     // 2 exe task
@@ -273,6 +287,10 @@ private:
     // TODO we should calculate the time between when really runnable and runnable
     RuntimeProfile::Counter* _yield_counts = nullptr;
     RuntimeProfile::Counter* _core_change_times = nullptr;
+    RuntimeProfile::Counter* _numa_local_steal_times = nullptr;
+    RuntimeProfile::Counter* _numa_remote_steal_times = nullptr;
+    // the hardware counters of the executions, see enable_pipeline_task_perf_counters
+    std::array<RuntimeProfile::Counter*, ThreadPerfCounters::NUM_COUNTERS> _perf_counters {};
 
     MonotonicStopWatch _pipeline_task_watcher;
 
@@ -298,6 +316,19 @@ private:
 
     Dependency* _blocked_dep = nullptr;
 
+    // Latency stats of `_operators` in the same order and of `_sink`, all nullptr if
+    // enable_pipeline_task_latency_stats is false when the task is prepared.
+    std::vector<OperatorLatencyStats*> _operator_latency_stats;
+    OperatorLatencyStats* _sink_latency_stats = nullptr;
+    // The operator blocked by `_blocked_dep`, reset after the blocked time is recorded.
+    OperatorLatencyStats* _blocked_latency_stats = nullptr;
+    int _blocked_kind = 0;
+    int64_t _blocked_begin_ns = 0;
+    // Written by the thread which puts the task into the task queue.
+    std::atomic<int64_t> _runnable_begin_ns {0};
+    // indexed by OperatorLatencyStats::BlockedKind
+    std::vector<RuntimeProfile::Counter*> _blocked_timers;
+
     Dependency* _execution_dep = nullptr;
 
     std::atomic<bool> _finalized {false};
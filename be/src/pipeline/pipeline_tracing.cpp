@@ -19,22 +19,124 @@
 
 #include <absl/time/clock.h>
 #include <fcntl.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
 #include <sys/stat.h>
 
+#include <algorithm>
 #include <boost/algorithm/string/predicate.hpp>
 #include <chrono>
 #include <cstdint>
+#include <fstream>
 #include <mutex>
+#include <sstream>
 #include <string>
 
 #include "common/config.h"
 #include "common/exception.h"
+#include "common/logging.h"
 #include "common/status.h"
 #include "io/fs/local_file_writer.h"
 #include "util/time.h"
 
 namespace doris::pipeline {
 
+OperatorLatencyStats::BlockedKind OperatorLatencyStats::blocked_kind(
+        const std::string& dependency_name) {
+    // e.g. OLAP_SCAN_OPERATOR_FILTER_DEPENDENCY is a runtime filter dependency of a scan
+    if (boost::icontains(dependency_name, "SPILL")) {
+        return SPILL;
+    }
+    if (boost::icontains(dependency_name, "FILTER")) {
+        return RUNTIME_FILTER;
+    }
+    if (boost::icontains(dependency_name, "SCAN")) {
+        return SCAN;
+    }
+    if (boost::icontains(dependency_name, "EXCHANGE") ||
+        boost::icontains(dependency_name, "SHUFFLE") ||
+        boost::icontains(dependency_name, "BROADCAST")) {
+        return EXCHANGE;
+    }
+    return OTHER;
+}
+
+const char* OperatorLatencyStats::blocked_kind_name(int kind) {
+    switch (kind) {
+    case SCAN:
+        return "blocked_by_scan";
+    case EXCHANGE:
+        return "blocked_by_exchange";
+    case RUNTIME_FILTER:
+        return "blocked_by_runtime_filter";
+    case SPILL:
+        return "blocked_by_spill";
+    default:
+        return "blocked_by_other";
+    }
+}
+
+void OperatorLatencyStats::clear() {
+    run_slice.clear();
+    queue_wait.clear();
+    for (auto& stat : blocked) {
+        stat.clear();
+    }
+}
+
+OperatorLatencyStats* PipelineTracerContext::latency_stats(const std::string& operator_name) {
+    std::lock_guard<std::mutex> l(_latency_stats_lock);
+    auto& stats = _latency_stats[operator_name];
+    if (stats == nullptr) {
+        stats = std::make_unique<OperatorLatencyStats>();
+    }
+    return stats.get();
+}
+
+std::string PipelineTracerContext::latency_stats_json(bool reset) {
+    rapidjson::StringBuffer buffer;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+    auto write_stat = [&](const char* name, HistogramStat& stat) {
+        if (stat.is_empty()) {
+            return;
+        }
+        writer.Key(name);
+        writer.StartObject();
+        writer.Key("count");
+        writer.Uint64(stat.num());
+        writer.Key("avg_us");
+        writer.Double(stat.average());
+        writer.Key("p50_us");
+        writer.Double(stat.median());
+        writer.Key("p90_us");
+        writer.Double(stat.percentile(90));
+        writer.Key("p99_us");
+        writer.Double(stat.percentile(99));
+        writer.Key("max_us");
+        writer.Uint64(stat.max());
+        writer.EndObject();
+        if (reset) {
+            stat.clear();
+        }
+    };
+
+    std::lock_guard<std::mutex> l(_latency_stats_lock);
+    writer.StartObject();
+    for (auto& [name, stats] : _latency_stats) {
+        writer.Key(name.c_str());
+        writer.StartObject();
+        write_stat("run_slice", stats->run_slice);
+        write_stat("queue_wait", stats->queue_wait);
+        for (int i = 0; i < OperatorLatencyStats::NUM_BLOCKED_KINDS; ++i) {
+            write_stat(OperatorLatencyStats::blocked_kind_name(i), stats->blocked[i]);
+        }
+        writer.EndObject();
+    }
+    writer.EndObject();
+    return buffer.GetString();
+}
+
 void PipelineTracerContext::record(ScheduleRecord record) {
     if (_dump_type == RecordType::None) [[unlikely]] {
         return;
@@ -67,13 +169,16 @@ void PipelineTracerContext::_update(std::function<void(QueryTracesMap&)>&& handl
     }
 }
 
-void PipelineTracerContext::end_query(TUniqueId query_id, uint64_t workload_group) {
+void PipelineTracerContext::end_query(TUniqueId query_id, uint64_t workload_group,
+                                      int64_t query_time_ms) {
     {
         std::unique_lock<std::mutex> l(_tg_lock);
         _id_to_workload_group[query_id] = workload_group;
     }
     if (_dump_type == RecordType::PerQuery) {
         _dump_query(query_id);
+    } else if (_dump_type == RecordType::SlowQuery) {
+        _dump_slow_query(query_id, query_time_ms);
     } else if (_dump_type == RecordType::Periodic) {
         auto now = MonotonicSeconds();
         auto interval = now - _last_dump_time;
@@ -98,9 +203,17 @@ Status PipelineTracerContext::change_record_params(
             _dump_type = RecordType::Periodic;
             _last_dump_time = MonotonicSeconds();
             effective = true;
+        } else if (boost::iequals(it->second, "slow_query")) {
+            _dump_type = RecordType::SlowQuery;
+            effective = true;
         }
     }
 
+    if (auto it = params.find("slow_query_threshold_ms"); it != params.end()) {
+        _slow_query_threshold_ms = std::stoll(it->second);
+        effective = true;
+    }
+
     if (auto it = params.find("dump_interval"); it != params.end()) {
         _dump_interval_s = std::stoll(it->second); // s as unit
         effective = true;
@@ -180,4 +293,150 @@ void PipelineTracerContext::_dump_timeslice() {
 
     _id_to_workload_group.clear();
 }
+
+std::filesystem::path PipelineTracerContext::_slow_query_trace_path(
+        const TUniqueId& query_id) const {
+    return _log_dir / fmt::format("slow_query{}.json", to_string(query_id));
+}
+
+void PipelineTracerContext::_dump_slow_query(TUniqueId query_id, int64_t query_time_ms) {
+    std::vector<ScheduleRecord> records;
+    {
+        auto map_ptr = std::atomic_load_explicit(&_data, std::memory_order_relaxed);
+        if (auto it = map_ptr->find({query_id}); it != map_ptr->end()) {
+            ScheduleRecord record;
+            while (it->second->try_dequeue(record)) {
+                records.push_back(std::move(record));
+            }
+        }
+        _update([&](QueryTracesMap& new_map) { new_map.erase(QueryID {query_id}); });
+        std::unique_lock<std::mutex> l(_tg_lock);
+        _id_to_workload_group.erase(query_id);
+    }
+    // the records of the fast queries are only dropped
+    if (query_time_ms < _slow_query_threshold_ms || records.empty()) {
+        return;
+    }
+    std::sort(records.begin(), records.end());
+
+    // The runs are shown per core, and per task with the spans between two runs of the task,
+    // during which it is blocked by a dependency or waits in the task queue.
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    auto write_span = [&](const std::string& name, const char* category, uint64_t start,
+                          uint64_t end, int pid, uint64_t tid) {
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(name.c_str());
+        writer.Key("cat");
+        writer.String(category);
+        writer.Key("ph");
+        writer.String("X");
+        writer.Key("ts");
+        writer.Uint64(start);
+        writer.Key("dur");
+        writer.Uint64(end > start ? end - start : 0);
+        writer.Key("pid");
+        writer.Int(pid);
+        writer.Key("tid");
+        writer.Uint64(tid);
+        writer.EndObject();
+    };
+    auto write_name = [&](const char* kind, int pid, uint64_t tid, const std::string& name) {
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(kind);
+        writer.Key("ph");
+        writer.String("M");
+        writer.Key("pid");
+        writer.Int(pid);
+        writer.Key("tid");
+        writer.Uint64(tid);
+        writer.Key("args");
+        writer.StartObject();
+        writer.Key("name");
+        writer.String(name.c_str());
+        writer.EndObject();
+        writer.EndObject();
+    };
+    constexpr int CORES_PID = 0;
+    constexpr int TASKS_PID = 1;
+
+    writer.StartObject();
+    writer.Key("otherData");
+    writer.StartObject();
+    writer.Key("query_id");
+    writer.String(to_string(query_id).c_str());
+    writer.Key("query_time_ms");
+    writer.Int64(query_time_ms);
+    writer.EndObject();
+    writer.Key("traceEvents");
+    writer.StartArray();
+    write_name("process_name", CORES_PID, 0, "cores");
+    write_name("process_name", TASKS_PID, 0, "tasks");
+    // the index and the end of the last run of each task
+    std::map<std::string, std::pair<uint64_t, uint64_t>> tasks;
+    for (const auto& record : records) {
+        write_span(record.task_id, "run", record.start_time, record.end_time, CORES_PID,
+                   record.core_id);
+        auto [it, inserted] = tasks.try_emplace(record.task_id, tasks.size(), 0);
+        auto& [task_index, last_end_time] = it->second;
+        if (inserted) {
+            write_name("thread_name", TASKS_PID, task_index, record.task_id);
+        } else {
+            write_span("wait", "wait", last_end_time, record.start_time, TASKS_PID, task_index);
+        }
+        write_span("run", "run", record.start_time, record.end_time, TASKS_PID, task_index);
+        last_end_time = record.end_time;
+    }
+    writer.EndArray();
+    writer.EndObject();
+
+    std::error_code ec;
+    std::filesystem::create_directories(_log_dir, ec);
+    auto path = _slow_query_trace_path(query_id);
+    int fd = ::open(path.c_str(), O_CREAT | O_WRONLY | O_TRUNC, S_IWUSR | S_IRUSR | S_IRGRP);
+    if (fd < 0) [[unlikely]] {
+        throw Exception(Status::Error<ErrorCode::CREATE_FILE_ERROR>(
+                "create tracing log file {} failed", path.c_str()));
+    }
+    auto file_writer = io::LocalFileWriter {path, fd};
+    Slice text {buffer.GetString(), buffer.GetSize()};
+    THROW_IF_ERROR(file_writer.appendv(&text, 1));
+    THROW_IF_ERROR(file_writer.close());
+    LOG(INFO) << "dump the timeline of slow query " << to_string(query_id) << " of "
+              << query_time_ms << "ms to " << path.native();
+
+    std::lock_guard<std::mutex> l(_slow_query_lock);
+    _slow_queries.push_back(query_id);
+    while (_slow_queries.size() > MAX_SLOW_QUERY_TRACES) {
+        std::filesystem::remove(_slow_query_trace_path(_slow_queries.front()), ec);
+        _slow_queries.pop_front();
+    }
+}
+
+Status PipelineTracerContext::get_slow_query_trace(const TUniqueId& query_id,
+                                                   std::string* trace) {
+    {
+        std::lock_guard<std::mutex> l(_slow_query_lock);
+        if (std::find(_slow_queries.begin(), _slow_queries.end(), query_id) ==
+            _slow_queries.end()) {
+            return Status::NotFound("No timeline of slow query {}", to_string(query_id));
+        }
+    }
+    std::ifstream file(_slow_query_trace_path(query_id));
+    if (!file) {
+        return Status::NotFound("No timeline of slow query {}", to_string(query_id));
+    }
+    std::stringstream ss;
+    ss << file.rdbuf();
+    *trace = ss.str();
+    return Status::OK();
+}
+
+std::vector<TUniqueId> PipelineTracerContext::slow_queries() {
+    std::lock_guard<std::mutex> l(_slow_query_lock);
+    return {_slow_queries.begin(), _slow_queries.end()};
+}
+
 } // namespace doris::pipeline
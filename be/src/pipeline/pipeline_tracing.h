@@ -23,10 +23,16 @@
 #include <parallel_hashmap/phmap.h>
 
 #include <cstdint>
+#include <deque>
 #include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "common/config.h"
 #include "util/hash_util.hpp" // IWYU pragma: keep
+#include "util/histogram.h"
 #include "util/thrift_util.h"
 #include "util/time.h"
 
@@ -61,6 +67,25 @@ using OneQueryTraces = moodycamel::ConcurrentQueue<ScheduleRecord>;
 using OneQueryTracesSPtr = std::shared_ptr<moodycamel::ConcurrentQueue<ScheduleRecord>>;
 using QueryTracesMap = std::map<QueryID, OneQueryTracesSPtr>;
 
+// Latency distributions of the pipeline tasks of one operator, over all queries since the BE
+// starts. The values are in microseconds.
+struct OperatorLatencyStats {
+    // what a blocked task waits for, which is told by the name of the dependency
+    enum BlockedKind { SCAN = 0, EXCHANGE, RUNTIME_FILTER, SPILL, OTHER, NUM_BLOCKED_KINDS };
+
+    static BlockedKind blocked_kind(const std::string& dependency_name);
+    static const char* blocked_kind_name(int kind);
+
+    void clear();
+
+    // one execution of the task by an executor
+    HistogramStat run_slice;
+    // from the task is put into the task queue to an executor takes it
+    HistogramStat queue_wait;
+    // from the task is blocked by a dependency to the task is put into the task queue again
+    HistogramStat blocked[NUM_BLOCKED_KINDS];
+};
+
 // belongs to exec_env, for all query, if enabled
 class PipelineTracerContext {
 public:
@@ -68,19 +93,32 @@ public:
     enum class RecordType {
         None,     // disable
         PerQuery, // record per query. one query one file.
-        Periodic  // record per times. one timeslice one file.
+        Periodic, // record per times. one timeslice one file.
+        SlowQuery // record per query, only the queries slower than a threshold are dumped.
     };
     void record(ScheduleRecord record); // record one schedule record
-    void end_query(TUniqueId query_id,
-                   uint64_t workload_group); // tell context this query is end. may leads to dump.
+    // tell context this query is end. may leads to dump.
+    void end_query(TUniqueId query_id, uint64_t workload_group, int64_t query_time_ms);
     Status change_record_params(const std::map<std::string, std::string>& params);
 
+    // The timeline of a slow query dumped in SlowQuery mode, in the Chrome trace event format.
+    Status get_slow_query_trace(const TUniqueId& query_id, std::string* trace);
+    // The ids of the slow queries whose timelines are kept, the latest last.
+    std::vector<TUniqueId> slow_queries();
+
     bool enabled() const { return !(_dump_type == RecordType::None); }
 
+    // The stats are never released, so pipeline tasks keep the pointer for their whole life.
+    OperatorLatencyStats* latency_stats(const std::string& operator_name);
+    // Json of the percentiles of all operators, and clear the stats if `reset`.
+    std::string latency_stats_json(bool reset);
+
 private:
     // dump data to disk. one query or all.
     void _dump_query(TUniqueId query_id);
     void _dump_timeslice();
+    void _dump_slow_query(TUniqueId query_id, int64_t query_time_ms);
+    std::filesystem::path _slow_query_trace_path(const TUniqueId& query_id) const;
     void _update(std::function<void(QueryTracesMap&)>&& handler);
 
     std::filesystem::path _log_dir = fmt::format("{}/pipe_tracing", getenv("LOG_DIR"));
@@ -94,5 +132,14 @@ private:
     decltype(MonotonicSeconds()) _last_dump_time;
     decltype(MonotonicSeconds()) _dump_interval_s =
             60; // effective iff Periodic mode. 1 minute default.
+    int64_t _slow_query_threshold_ms = 10000; // effective iff SlowQuery mode.
+
+    // the dumped slow queries, the oldest is deleted beyond MAX_SLOW_QUERY_TRACES
+    static constexpr size_t MAX_SLOW_QUERY_TRACES = 100;
+    std::mutex _slow_query_lock;
+    std::deque<TUniqueId> _slow_queries;
+
+    std::mutex _latency_stats_lock;
+    std::map<std::string, std::unique_ptr<OperatorLatencyStats>> _latency_stats;
 };
 } // namespace doris::pipeline
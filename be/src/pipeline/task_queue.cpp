@@ -18,19 +18,88 @@
 #include "task_queue.h"
 
 // IWYU pragma: no_include <bits/chrono.h>
+#include <algorithm>
 #include <chrono> // IWYU pragma: keep
 #include <memory>
 #include <string>
 
 #include "common/logging.h"
 #include "pipeline/pipeline_task.h"
+#include "pipeline/work_stealing_task_queue.h"
+#include "runtime/query_context.h"
 #include "runtime/workload_group/workload_group.h"
+#include "util/cpu_info.h"
 
 namespace doris::pipeline {
 
 TaskQueue::~TaskQueue() = default;
 
+Status TaskQueue::push_back_batch(const std::vector<PipelineTask*>& tasks) {
+    for (auto* task : tasks) {
+        RETURN_IF_ERROR(push_back(task));
+    }
+    return Status::OK();
+}
+
+void TaskQueue::_group_by_core(const std::vector<PipelineTask*>& tasks,
+                               std::atomic<size_t>& next_core,
+                               std::vector<std::pair<size_t, PipelineTask*>>* tasks_of_cores) const {
+    size_t fair_share = (tasks.size() + _core_size - 1) / _core_size;
+    std::vector<size_t> num_tasks(_core_size, 0);
+    tasks_of_cores->reserve(tasks.size());
+    for (auto* task : tasks) {
+        int core_id = task->get_previous_core_id();
+        if (core_id < 0 || num_tasks[core_id] >= fair_share) {
+            // there is always a core with less than `fair_share` tasks
+            size_t start = next_core.fetch_add(1);
+            for (size_t i = 0; i < _core_size; ++i) {
+                core_id = (start + i) % _core_size;
+                if (num_tasks[core_id] < fair_share) {
+                    break;
+                }
+            }
+        }
+        ++num_tasks[core_id];
+        tasks_of_cores->emplace_back(core_id, task);
+    }
+    std::stable_sort(tasks_of_cores->begin(), tasks_of_cores->end(),
+                     [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+}
+
+std::shared_ptr<TaskQueue> create_task_queue(size_t core_size) {
+    if (config::pipeline_task_queue_type == "work_stealing") {
+        return std::make_shared<WorkStealingTaskQueue>(core_size);
+    }
+    return std::make_shared<MultiCoreTaskQueue>(core_size);
+}
+
+// The workload group id and cpu share of the task, 0 and 1 if it has no workload group.
+static std::pair<uint64_t, uint64_t> workload_group_of(PipelineTask* task) {
+    auto* query_ctx = task->query_context();
+    if (query_ctx != nullptr) {
+        if (auto wg = query_ctx->workload_group()) {
+            return {wg->id(), std::max<uint64_t>(wg->cpu_share(), 1)};
+        }
+    }
+    return {0, 1};
+}
+
+void SubTaskQueue::push_back(PipelineTask* task, uint64_t group_id, uint64_t cpu_share) {
+    auto& group = _group_queues[group_id];
+    if (group.tasks.empty()) {
+        // A group back from idle does not get the cpu time it left unused, or it would starve
+        // the busy groups until it caught up with them.
+        group.vruntime = std::max(group.vruntime, _group_min_vruntime);
+    }
+    group.cpu_share = cpu_share;
+    group.tasks.emplace(task);
+    ++_num_group_tasks;
+}
+
 PipelineTask* SubTaskQueue::try_take(bool is_steal) {
+    if (_fair_share) {
+        return _try_take_fair();
+    }
     if (_queue.empty()) {
         return nullptr;
     }
@@ -39,11 +108,37 @@ PipelineTask* SubTaskQueue::try_take(bool is_steal) {
     return task;
 }
 
+PipelineTask* SubTaskQueue::_try_take_fair() {
+    GroupQueue* next = nullptr;
+    for (auto& [_, group] : _group_queues) {
+        if (!group.tasks.empty() && (next == nullptr || group.vruntime < next->vruntime)) {
+            next = &group;
+        }
+    }
+    if (next == nullptr) {
+        return nullptr;
+    }
+    auto task = next->tasks.front();
+    next->tasks.pop();
+    --_num_group_tasks;
+    _group_min_vruntime = next->vruntime;
+    return task;
+}
+
+void SubTaskQueue::inc_group_runtime(uint64_t group_id, uint64_t delta_time) {
+    auto it = _group_queues.find(group_id);
+    if (it != _group_queues.end()) {
+        it->second.vruntime += static_cast<double>(delta_time) / it->second.cpu_share;
+    }
+}
+
 ////////////////////  PriorityTaskQueue ////////////////////
 
-PriorityTaskQueue::PriorityTaskQueue() : _closed(false) {
+PriorityTaskQueue::PriorityTaskQueue()
+        : _closed(false), _fair_share(config::enable_workload_group_fair_queue) {
     double factor = 1;
     for (int i = SUB_QUEUE_LEVEL - 1; i >= 0; i--) {
+        _sub_queues[i].set_fair_share(_fair_share);
         _sub_queues[i].set_level_factor(factor);
         factor *= LEVEL_QUEUE_TIME_FACTOR;
     }
@@ -117,18 +212,58 @@ Status PriorityTaskQueue::push(PipelineTask* task) {
         return Status::InternalError("WorkTaskQueue closed");
     }
     auto level = _compute_level(task->get_runtime_ns());
+    auto [group_id, cpu_share] = _fair_share ? workload_group_of(task)
+                                          : std::pair<uint64_t, uint64_t>(0, 1);
+    std::unique_lock<std::mutex> lock(_work_size_mutex);
+    _push_unprotected(task, level, group_id, cpu_share);
+    _wait_task.notify_one();
+    return Status::OK();
+}
+
+Status PriorityTaskQueue::push(const std::vector<PipelineTask*>& tasks) {
+    if (_closed) {
+        return Status::InternalError("WorkTaskQueue closed");
+    }
+    std::vector<int> levels(tasks.size());
+    std::vector<std::pair<uint64_t, uint64_t>> groups(tasks.size(), {0, 1});
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        levels[i] = _compute_level(tasks[i]->get_runtime_ns());
+        if (_fair_share) {
+            groups[i] = workload_group_of(tasks[i]);
+        }
+    }
     std::unique_lock<std::mutex> lock(_work_size_mutex);
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        _push_unprotected(tasks[i], levels[i], groups[i].first, groups[i].second);
+    }
+    // only the executor of this queue waits on it
+    _wait_task.notify_one();
+    return Status::OK();
+}
 
+void PriorityTaskQueue::_push_unprotected(PipelineTask* task, int level, uint64_t group_id,
+                                          uint64_t cpu_share) {
     // update empty queue's  runtime, to avoid too high priority
     if (_sub_queues[level].empty() &&
         _queue_level_min_vruntime > _sub_queues[level].get_vruntime()) {
         _sub_queues[level].adjust_runtime(_queue_level_min_vruntime);
     }
 
-    _sub_queues[level].push_back(task);
+    if (_fair_share) {
+        _sub_queues[level].push_back(task, group_id, cpu_share);
+    } else {
+        _sub_queues[level].push_back(task);
+    }
     _total_task_size++;
-    _wait_task.notify_one();
-    return Status::OK();
+}
+
+void PriorityTaskQueue::inc_group_runtime(PipelineTask* task, uint64_t runtime) {
+    if (!_fair_share) {
+        return;
+    }
+    uint64_t group_id = workload_group_of(task).first;
+    std::unique_lock<std::mutex> lock(_work_size_mutex);
+    _sub_queues[task->get_queue_level()].inc_group_runtime(group_id, runtime);
 }
 
 int PriorityTaskQueue::task_size() {
@@ -138,8 +273,33 @@ int PriorityTaskQueue::task_size() {
 
 MultiCoreTaskQueue::~MultiCoreTaskQueue() = default;
 
-MultiCoreTaskQueue::MultiCoreTaskQueue(size_t core_size) : TaskQueue(core_size), _closed(false) {
+MultiCoreTaskQueue::MultiCoreTaskQueue(size_t core_size, bool numa_aware)
+        : TaskQueue(core_size), _closed(false), _numa_aware(numa_aware) {
     _prio_task_queue_list = std::make_unique<PriorityTaskQueue[]>(core_size);
+    if (_numa_aware) {
+        _init_numa_topology();
+    }
+}
+
+void MultiCoreTaskQueue::_init_numa_topology() {
+    int max_num_cores = CpuInfo::get_max_num_cores();
+    int num_numa_nodes = CpuInfo::get_max_num_numa_nodes();
+    if (max_num_cores <= 0 || num_numa_nodes <= 1) {
+        // Single node machine, stealing across nodes is meaningless.
+        _numa_aware = false;
+        return;
+    }
+    _core_to_numa_node.resize(_core_size);
+    _numa_node_to_cores.resize(num_numa_nodes);
+    for (size_t i = 0; i < _core_size; ++i) {
+        int node = CpuInfo::get_numa_node_of_core(i % max_num_cores);
+        _core_to_numa_node[i] = node;
+        _numa_node_to_cores[node].push_back(i);
+    }
+    _local_steal_misses = std::make_unique<int[]>(_core_size);
+    for (size_t i = 0; i < _core_size; ++i) {
+        _local_steal_misses[i] = 0;
+    }
 }
 
 void MultiCoreTaskQueue::close() {
@@ -175,6 +335,9 @@ PipelineTask* MultiCoreTaskQueue::take(size_t core_id) {
 
 PipelineTask* MultiCoreTaskQueue::_steal_take(size_t core_id) {
     DCHECK(core_id < _core_size);
+    if (_numa_aware) {
+        return _steal_take_numa_aware(core_id);
+    }
     size_t next_id = core_id;
     for (size_t i = 1; i < _core_size; ++i) {
         ++next_id;
@@ -191,6 +354,42 @@ PipelineTask* MultiCoreTaskQueue::_steal_take(size_t core_id) {
     return nullptr;
 }
 
+PipelineTask* MultiCoreTaskQueue::_steal_take_numa_aware(size_t core_id) {
+    int local_node = _core_to_numa_node[core_id];
+    const auto& local_cores = _numa_node_to_cores[local_node];
+    // Scan the executors of the same node, starting from the one after `core_id`.
+    auto pos = std::find(local_cores.begin(), local_cores.end(), core_id) - local_cores.begin();
+    for (size_t i = 1; i < local_cores.size(); ++i) {
+        size_t next_id = local_cores[(pos + i) % local_cores.size()];
+        auto task = _prio_task_queue_list[next_id].try_take(true);
+        if (task) {
+            _local_steal_misses[core_id] = 0;
+            task->set_core_id(next_id);
+            task->on_stolen(false);
+            return task;
+        }
+    }
+
+    if (++_local_steal_misses[core_id] < config::pipeline_task_numa_remote_steal_threshold) {
+        return nullptr;
+    }
+
+    size_t num_nodes = _numa_node_to_cores.size();
+    for (size_t n = 1; n < num_nodes; ++n) {
+        const auto& remote_cores = _numa_node_to_cores[(local_node + n) % num_nodes];
+        for (size_t next_id : remote_cores) {
+            auto task = _prio_task_queue_list[next_id].try_take(true);
+            if (task) {
+                _local_steal_misses[core_id] = 0;
+                task->set_core_id(next_id);
+                task->on_stolen(true);
+                return task;
+            }
+        }
+    }
+    return nullptr;
+}
+
 Status MultiCoreTaskQueue::push_back(PipelineTask* task) {
     int core_id = task->get_previous_core_id();
     if (core_id < 0) {
@@ -205,10 +404,27 @@ Status MultiCoreTaskQueue::push_back(PipelineTask* task, size_t core_id) {
     return _prio_task_queue_list[core_id].push(task);
 }
 
+Status MultiCoreTaskQueue::push_back_batch(const std::vector<PipelineTask*>& tasks) {
+    std::vector<std::pair<size_t, PipelineTask*>> tasks_of_cores;
+    _group_by_core(tasks, _next_core, &tasks_of_cores);
+    std::vector<PipelineTask*> core_tasks;
+    for (size_t i = 0; i < tasks_of_cores.size();) {
+        size_t core_id = tasks_of_cores[i].first;
+        core_tasks.clear();
+        for (; i < tasks_of_cores.size() && tasks_of_cores[i].first == core_id; ++i) {
+            tasks_of_cores[i].second->put_in_runnable_queue();
+            core_tasks.push_back(tasks_of_cores[i].second);
+        }
+        RETURN_IF_ERROR(_prio_task_queue_list[core_id].push(core_tasks));
+    }
+    return Status::OK();
+}
+
 void MultiCoreTaskQueue::update_statistics(PipelineTask* task, int64_t time_spent) {
     task->inc_runtime_ns(time_spent);
     _prio_task_queue_list[task->get_core_id()].inc_sub_queue_runtime(task->get_queue_level(),
                                                                      time_spent);
+    _prio_task_queue_list[task->get_core_id()].inc_group_runtime(task, time_spent);
 }
 
 } // namespace doris::pipeline
\ No newline at end of file
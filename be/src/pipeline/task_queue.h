@@ -27,7 +27,11 @@
 #include <ostream>
 #include <queue>
 #include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "pipeline_task.h"
 
@@ -48,23 +52,47 @@ public:
     // push from worker
     virtual Status push_back(PipelineTask* task, size_t core_id) = 0;
 
+    // Push the tasks woken up together, e.g. by one dependency, so that the queue of every
+    // target core is visited once.
+    virtual Status push_back_batch(const std::vector<PipelineTask*>& tasks);
+
     virtual void update_statistics(PipelineTask* task, int64_t time_spent) {}
 
     int cores() const { return _core_size; }
 
+    // The NUMA node the executor `core_id` belongs to, 0 if the queue is not NUMA aware.
+    virtual int numa_node_of_core(size_t core_id) const { return 0; }
+
 protected:
+    // Sort the tasks by target core. A task goes back to its previous core, unless the task
+    // has never run or the core already gets its fair share of the batch, then it goes to the
+    // next core from `next_core` round-robin, so a wake-up storm is spread over all cores.
+    void _group_by_core(const std::vector<PipelineTask*>& tasks, std::atomic<size_t>& next_core,
+                        std::vector<std::pair<size_t, PipelineTask*>>* tasks_of_cores) const;
+
     size_t _core_size;
     static constexpr auto WAIT_CORE_TASK_TIMEOUT_MS = 100;
 };
 
+// Create the task queue of pipeline executors according to `pipeline_task_queue_type`.
+std::shared_ptr<TaskQueue> create_task_queue(size_t core_size);
+
 class SubTaskQueue {
     friend class PriorityTaskQueue;
 
 public:
     void push_back(PipelineTask* task) { _queue.emplace(task); }
 
+    // Push the task to the queue of its workload group, in the fair share mode.
+    void push_back(PipelineTask* task, uint64_t group_id, uint64_t cpu_share);
+
     PipelineTask* try_take(bool is_steal);
 
+    void set_fair_share(bool fair_share) { _fair_share = fair_share; }
+
+    // Charge the time a task of the workload group ran to the virtual time of the group.
+    void inc_group_runtime(uint64_t group_id, uint64_t delta_time);
+
     void set_level_factor(double level_factor) { _level_factor = level_factor; }
 
     // note:
@@ -76,10 +104,27 @@ public:
 
     void adjust_runtime(uint64_t vruntime) { this->_runtime = uint64_t(vruntime * _level_factor); }
 
-    bool empty() { return _queue.empty(); }
+    bool empty() { return _fair_share ? _num_group_tasks == 0 : _queue.empty(); }
 
 private:
+    // The tasks of a workload group in the fair share mode.
+    struct GroupQueue {
+        std::queue<PipelineTask*> tasks;
+        // the time the tasks of the group ran divided by the cpu share of the group
+        double vruntime = 0;
+        uint64_t cpu_share = 1;
+    };
+
+    PipelineTask* _try_take_fair();
+
     std::queue<PipelineTask*> _queue;
+
+    bool _fair_share = false;
+    // workload group id -> tasks, the groups are kept when empty to keep their virtual time
+    std::unordered_map<uint64_t, GroupQueue> _group_queues;
+    size_t _num_group_tasks = 0;
+    // the virtual time of the group taken from last, from which an idle group restarts
+    double _group_min_vruntime = 0;
     // depends on LEVEL_QUEUE_TIME_FACTOR
     double _level_factor = 1;
 
@@ -99,14 +144,22 @@ public:
 
     Status push(PipelineTask* task);
 
+    // Push the tasks under one lock.
+    Status push(const std::vector<PipelineTask*>& tasks);
+
     void inc_sub_queue_runtime(int level, uint64_t runtime) {
         _sub_queues[level].inc_runtime(runtime);
     }
 
+    // Charge the time the task ran to its workload group, in the fair share mode.
+    void inc_group_runtime(PipelineTask* task, uint64_t runtime);
+
     int task_size();
 
 private:
     PipelineTask* _try_take_unprotected(bool is_steal);
+    void _push_unprotected(PipelineTask* task, int level, uint64_t group_id,
+                           uint64_t cpu_share);
     static constexpr auto LEVEL_QUEUE_TIME_FACTOR = 2;
     static constexpr size_t SUB_QUEUE_LEVEL = 6;
     SubTaskQueue _sub_queues[SUB_QUEUE_LEVEL];
@@ -117,6 +170,7 @@ private:
     std::condition_variable _wait_task;
     std::atomic<size_t> _total_task_size = 0;
     bool _closed;
+    const bool _fair_share;
 
     // used to adjust vruntime of a queue when it's not empty
     // protected by lock _work_size_mutex
@@ -125,10 +179,14 @@ private:
     int _compute_level(uint64_t real_runtime);
 };
 
-// Need consider NUMA architecture
+// When NUMA aware, executors are grouped by the NUMA node of the cpu they map to. A task
+// without previous core is placed round-robin, otherwise it goes back to its previous
+// executor. An idle executor steals from executors of its own node first, and only steals
+// across nodes after `pipeline_task_numa_remote_steal_threshold` successive local misses.
 class MultiCoreTaskQueue : public TaskQueue {
 public:
-    explicit MultiCoreTaskQueue(size_t core_size);
+    explicit MultiCoreTaskQueue(size_t core_size,
+                                bool numa_aware = config::enable_pipeline_task_numa_aware);
 
     ~MultiCoreTaskQueue() override;
 
@@ -142,14 +200,32 @@ public:
 
     Status push_back(PipelineTask* task, size_t core_id) override;
 
+    Status push_back_batch(const std::vector<PipelineTask*>& tasks) override;
+
     void update_statistics(PipelineTask* task, int64_t time_spent) override;
 
+    int numa_node_of_core(size_t core_id) const override {
+        return _numa_aware ? _core_to_numa_node[core_id] : 0;
+    }
+
 private:
     PipelineTask* _steal_take(size_t core_id);
 
+    PipelineTask* _steal_take_numa_aware(size_t core_id);
+
+    void _init_numa_topology();
+
     std::unique_ptr<PriorityTaskQueue[]> _prio_task_queue_list;
     std::atomic<size_t> _next_core = 0;
     std::atomic<bool> _closed;
+
+    bool _numa_aware;
+    // executor index -> numa node
+    std::vector<int> _core_to_numa_node;
+    // numa node -> executor indexes of the node
+    std::vector<std::vector<size_t>> _numa_node_to_cores;
+    // successive local steal misses of each executor, only visited by the executor itself
+    std::unique_ptr<int[]> _local_steal_misses;
 };
 
 } // namespace doris::pipeline
@@ -37,6 +37,7 @@
 #include "pipeline_fragment_context.h"
 #include "runtime/exec_env.h"
 #include "runtime/query_context.h"
+#include "util/cpu_info.h"
 #include "util/thread.h"
 #include "util/threadpool.h"
 #include "util/time.h"
@@ -94,7 +95,28 @@ void _close_task(PipelineTask* task, Status exec_status) {
     task->fragment_context()->close_a_pipeline();
 }
 
+void TaskScheduler::_bind_to_numa_node(size_t index) {
+#ifndef __APPLE__
+    if (!config::enable_pipeline_task_numa_aware || CpuInfo::get_max_num_numa_nodes() <= 1) {
+        return;
+    }
+    // Keep the executor on the cpus of its node, so memory first touched by the task (arena,
+    // hash table) is allocated on the node where the following steps of the task run.
+    int node = _task_queue->numa_node_of_core(index);
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int cpu : CpuInfo::get_cores_of_numa_node(node)) {
+        CPU_SET(cpu, &cpu_set);
+    }
+    if (sched_setaffinity(0, sizeof(cpu_set), &cpu_set) != 0) {
+        LOG(WARNING) << "failed to bind pipeline executor " << index << " to numa node " << node
+                     << ", errno: " << errno;
+    }
+#endif
+}
+
 void TaskScheduler::_do_work(size_t index) {
+    _bind_to_numa_node(index);
     while (_markers[index]) {
         auto* task = _task_queue->take(index);
         if (!task) {
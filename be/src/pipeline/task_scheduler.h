@@ -72,5 +72,7 @@ private:
     CgroupCpuCtl* _cgroup_cpu_ctl = nullptr;
 
     void _do_work(size_t index);
+
+    void _bind_to_numa_node(size_t index);
 };
 } // namespace doris::pipeline
\ No newline at end of file
@@ -0,0 +1,256 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/work_stealing_task_queue.h"
+
+#ifndef __APPLE__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// IWYU pragma: no_include <bits/chrono.h>
+#include <chrono> // IWYU pragma: keep
+#include <thread>
+
+#include "common/logging.h"
+#include "pipeline/pipeline_task.h"
+
+namespace doris::pipeline {
+
+namespace {
+// The queue and the executor index the current thread works for, so that a push from an
+// executor to itself can go to the deque it owns.
+thread_local const void* tls_owner_queue = nullptr;
+thread_local size_t tls_owner_core = 0;
+} // namespace
+
+WorkStealingTaskQueue::WorkStealingTaskQueue(size_t core_size)
+        : TaskQueue(core_size), _closed(false) {
+    _executors = std::make_unique<Executor[]>(core_size);
+    for (size_t i = 0; i < core_size; ++i) {
+        double factor = 1;
+        for (int level = SUB_QUEUE_LEVEL - 1; level >= 0; level--) {
+            _executors[i].levels[level].level_factor = factor;
+            factor *= LEVEL_QUEUE_TIME_FACTOR;
+        }
+    }
+}
+
+WorkStealingTaskQueue::~WorkStealingTaskQueue() = default;
+
+void WorkStealingTaskQueue::close() {
+    _closed = true;
+    for (size_t i = 0; i < _core_size; ++i) {
+        _unpark(_executors[i]);
+    }
+}
+
+int WorkStealingTaskQueue::_compute_level(uint64_t runtime) {
+    for (int i = 0; i < SUB_QUEUE_LEVEL - 1; ++i) {
+        if (runtime <= QUEUE_LEVEL_LIMIT[i]) {
+            return i;
+        }
+    }
+    return SUB_QUEUE_LEVEL - 1;
+}
+
+void WorkStealingTaskQueue::_push_local(Executor& executor, PipelineTask* task) {
+    auto level = _compute_level(task->get_runtime_ns());
+    auto& level_queue = executor.levels[level];
+    // update empty queue's runtime, to avoid too high priority
+    auto min_vruntime = executor.queue_level_min_vruntime.load(std::memory_order_relaxed);
+    if (level_queue.deque.empty() && min_vruntime > level_queue.get_vruntime()) {
+        level_queue.runtime = uint64_t(min_vruntime * level_queue.level_factor);
+    }
+    level_queue.deque.push(task);
+}
+
+void WorkStealingTaskQueue::_drain_inbox(Executor& executor) {
+    PipelineTask* task = nullptr;
+    while (executor.inbox.try_dequeue(task)) {
+        _push_local(executor, task);
+    }
+}
+
+PipelineTask* WorkStealingTaskQueue::_take_from(Executor& executor, bool is_steal) {
+    // Visit the levels from the smallest vruntime, a level may be emptied by thieves
+    // concurrently, so fall back to the next one instead of retrying.
+    bool visited[SUB_QUEUE_LEVEL] = {false};
+    for (size_t round = 0; round < SUB_QUEUE_LEVEL; ++round) {
+        int level = -1;
+        double min_vruntime = 0;
+        for (int i = 0; i < SUB_QUEUE_LEVEL; ++i) {
+            if (visited[i] || executor.levels[i].deque.empty()) {
+                continue;
+            }
+            double cur_queue_vruntime = executor.levels[i].get_vruntime();
+            if (level == -1 || cur_queue_vruntime < min_vruntime) {
+                level = i;
+                min_vruntime = cur_queue_vruntime;
+            }
+        }
+        if (level == -1) {
+            break;
+        }
+        visited[level] = true;
+        PipelineTask* task = nullptr;
+        if (executor.levels[level].deque.steal(&task)) {
+            if (!is_steal) {
+                executor.queue_level_min_vruntime.store(uint64_t(min_vruntime),
+                                                        std::memory_order_relaxed);
+            }
+            task->update_queue_level(level);
+            return task;
+        }
+    }
+    if (is_steal) {
+        // The tasks pushed by other threads are not drained into the deques yet.
+        PipelineTask* task = nullptr;
+        if (executor.inbox.try_dequeue(task)) {
+            task->update_queue_level(_compute_level(task->get_runtime_ns()));
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+PipelineTask* WorkStealingTaskQueue::_steal_take(size_t core_id) {
+    DCHECK(core_id < _core_size);
+    size_t next_id = core_id;
+    for (size_t i = 1; i < _core_size; ++i) {
+        ++next_id;
+        if (next_id == _core_size) {
+            next_id = 0;
+        }
+        auto* task = _take_from(_executors[next_id], true);
+        if (task) {
+            task->set_core_id(next_id);
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+void WorkStealingTaskQueue::_park(Executor& executor, int32_t expected) {
+    executor.parked.store(true, std::memory_order_seq_cst);
+#ifndef __APPLE__
+    timespec timeout {.tv_sec = 0, .tv_nsec = WAIT_CORE_TASK_TIMEOUT_MS * 1000L * 1000L};
+    // Returns immediately if a push happened after `expected` is loaded.
+    syscall(SYS_futex, reinterpret_cast<int32_t*>(&executor.futex_word), FUTEX_WAIT_PRIVATE,
+            expected, &timeout, nullptr, 0);
+#else
+    if (executor.futex_word.load(std::memory_order_acquire) == expected) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+#endif
+    executor.parked.store(false, std::memory_order_relaxed);
+}
+
+void WorkStealingTaskQueue::_unpark(Executor& executor) {
+    executor.futex_word.fetch_add(1, std::memory_order_release);
+#ifndef __APPLE__
+    if (executor.parked.load(std::memory_order_seq_cst)) {
+        syscall(SYS_futex, reinterpret_cast<int32_t*>(&executor.futex_word), FUTEX_WAKE_PRIVATE,
+                1, nullptr, nullptr, 0);
+    }
+#endif
+}
+
+PipelineTask* WorkStealingTaskQueue::take(size_t core_id) {
+    DCHECK(core_id < _core_size);
+    tls_owner_queue = this;
+    tls_owner_core = core_id;
+    auto& executor = _executors[core_id];
+    PipelineTask* task = nullptr;
+    while (!_closed) {
+        int32_t expected = executor.futex_word.load(std::memory_order_acquire);
+        _drain_inbox(executor);
+        task = _take_from(executor, false);
+        if (task) {
+            task->set_core_id(core_id);
+            break;
+        }
+        task = _steal_take(core_id);
+        if (task) {
+            break;
+        }
+        _park(executor, expected);
+    }
+    if (task) {
+        task->pop_out_runnable_queue();
+    }
+    return task;
+}
+
+Status WorkStealingTaskQueue::push_back(PipelineTask* task) {
+    int core_id = task->get_previous_core_id();
+    if (core_id < 0) {
+        core_id = _next_core.fetch_add(1) % _core_size;
+    }
+    return push_back(task, core_id);
+}
+
+Status WorkStealingTaskQueue::push_back(PipelineTask* task, size_t core_id) {
+    DCHECK(core_id < _core_size);
+    if (_closed) {
+        return Status::InternalError("WorkTaskQueue closed");
+    }
+    task->put_in_runnable_queue();
+    auto& executor = _executors[core_id];
+    if (tls_owner_queue == this && tls_owner_core == core_id) {
+        _push_local(executor, task);
+    } else {
+        executor.inbox.enqueue(task);
+        _unpark(executor);
+    }
+    return Status::OK();
+}
+
+Status WorkStealingTaskQueue::push_back_batch(const std::vector<PipelineTask*>& tasks) {
+    if (_closed) {
+        return Status::InternalError("WorkTaskQueue closed");
+    }
+    std::vector<std::pair<size_t, PipelineTask*>> tasks_of_cores;
+    _group_by_core(tasks, _next_core, &tasks_of_cores);
+    std::vector<PipelineTask*> core_tasks;
+    for (size_t i = 0; i < tasks_of_cores.size();) {
+        size_t core_id = tasks_of_cores[i].first;
+        core_tasks.clear();
+        for (; i < tasks_of_cores.size() && tasks_of_cores[i].first == core_id; ++i) {
+            tasks_of_cores[i].second->put_in_runnable_queue();
+            core_tasks.push_back(tasks_of_cores[i].second);
+        }
+        auto& executor = _executors[core_id];
+        if (tls_owner_queue == this && tls_owner_core == core_id) {
+            for (auto* task : core_tasks) {
+                _push_local(executor, task);
+            }
+        } else {
+            executor.inbox.enqueue_bulk(core_tasks.begin(), core_tasks.size());
+            _unpark(executor);
+        }
+    }
+    return Status::OK();
+}
+
+void WorkStealingTaskQueue::update_statistics(PipelineTask* task, int64_t time_spent) {
+    task->inc_runtime_ns(time_spent);
+    _executors[task->get_core_id()].levels[task->get_queue_level()].runtime += time_spent;
+}
+
+} // namespace doris::pipeline
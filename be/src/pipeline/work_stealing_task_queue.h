@@ -0,0 +1,177 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <concurrentqueue.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "common/status.h"
+#include "pipeline/task_queue.h"
+
+namespace doris::pipeline {
+
+// A Chase-Lev work stealing deque.
+// Only the owner may call `push`, any thread may call `steal`. The owner takes tasks by
+// `steal` too, which keeps FIFO order among runnable tasks of one executor, so that a task
+// rescheduled after its time slice does not starve the tasks queued before it.
+template <typename T>
+class WorkStealingDeque {
+public:
+    explicit WorkStealingDeque(int64_t capacity = 64)
+            : _array(new Array(capacity)), _top(0), _bottom(0) {}
+
+    ~WorkStealingDeque() { delete _array.load(std::memory_order_relaxed); }
+
+    WorkStealingDeque(const WorkStealingDeque&) = delete;
+    WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+    void push(T item) {
+        int64_t b = _bottom.load(std::memory_order_relaxed);
+        int64_t t = _top.load(std::memory_order_acquire);
+        Array* a = _array.load(std::memory_order_relaxed);
+        if (b - t > a->capacity - 1) {
+            a = _grow(a, b, t);
+        }
+        a->put(b, item);
+        std::atomic_thread_fence(std::memory_order_release);
+        _bottom.store(b + 1, std::memory_order_relaxed);
+    }
+
+    bool steal(T* item) {
+        int64_t t = _top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t b = _bottom.load(std::memory_order_acquire);
+        if (t >= b) {
+            return false;
+        }
+        Array* a = _array.load(std::memory_order_acquire);
+        T x = a->get(t);
+        if (!_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                          std::memory_order_relaxed)) {
+            return false;
+        }
+        *item = x;
+        return true;
+    }
+
+    bool empty() const {
+        return _bottom.load(std::memory_order_relaxed) <= _top.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Array {
+        explicit Array(int64_t cap) : capacity(cap), buffer(new std::atomic<T>[cap]) {}
+        T get(int64_t i) const { return buffer[i & (capacity - 1)].load(std::memory_order_relaxed); }
+        void put(int64_t i, T x) { buffer[i & (capacity - 1)].store(x, std::memory_order_relaxed); }
+
+        int64_t capacity;
+        std::unique_ptr<std::atomic<T>[]> buffer;
+    };
+
+    Array* _grow(Array* a, int64_t b, int64_t t) {
+        auto* bigger = new Array(a->capacity * 2);
+        for (int64_t i = t; i < b; ++i) {
+            bigger->put(i, a->get(i));
+        }
+        // Thieves may still read the old array, it is released with the deque.
+        _retired.emplace_back(a);
+        _array.store(bigger, std::memory_order_release);
+        return bigger;
+    }
+
+    std::atomic<Array*> _array;
+    std::atomic<int64_t> _top;
+    std::atomic<int64_t> _bottom;
+    // only visited by the owner
+    std::vector<std::unique_ptr<Array>> _retired;
+};
+
+// A TaskQueue backed by per-executor work stealing deques, it has the same multilevel
+// feedback scheduling as `PriorityTaskQueue`, but never takes a lock:
+// 1. An executor pushes to its own deques directly, other threads push to the lock free
+//    inbox of the target executor, which is drained by the executor before taking.
+// 2. Idle executors steal from the deques and inboxes of other executors.
+// 3. An executor without tasks parks on a futex instead of a condition variable.
+class WorkStealingTaskQueue : public TaskQueue {
+public:
+    explicit WorkStealingTaskQueue(size_t core_size);
+
+    ~WorkStealingTaskQueue() override;
+
+    void close() override;
+
+    PipelineTask* take(size_t core_id) override;
+
+    Status push_back(PipelineTask* task) override;
+
+    Status push_back(PipelineTask* task, size_t core_id) override;
+
+    Status push_back_batch(const std::vector<PipelineTask*>& tasks) override;
+
+    void update_statistics(PipelineTask* task, int64_t time_spent) override;
+
+private:
+    static constexpr auto LEVEL_QUEUE_TIME_FACTOR = 2;
+    static constexpr size_t SUB_QUEUE_LEVEL = 6;
+    // 1s, 3s, 10s, 60s, 300s
+    static constexpr uint64_t QUEUE_LEVEL_LIMIT[SUB_QUEUE_LEVEL - 1] = {
+            1000000000, 3000000000, 10000000000, 60000000000, 300000000000};
+
+    struct LevelQueue {
+        WorkStealingDeque<PipelineTask*> deque;
+        // vruntime = runtime / level_factor, see SubTaskQueue
+        double level_factor = 1;
+        std::atomic<uint64_t> runtime = 0;
+
+        double get_vruntime() const { return runtime / level_factor; }
+    };
+
+    struct alignas(64) Executor {
+        LevelQueue levels[SUB_QUEUE_LEVEL];
+        moodycamel::ConcurrentQueue<PipelineTask*> inbox;
+        std::atomic<uint64_t> queue_level_min_vruntime = 0;
+        // bumped on every push, the executor parks on it
+        std::atomic<int32_t> futex_word = 0;
+        std::atomic<bool> parked = false;
+    };
+
+    static int _compute_level(uint64_t runtime);
+
+    void _push_local(Executor& executor, PipelineTask* task);
+
+    void _drain_inbox(Executor& executor);
+
+    PipelineTask* _take_from(Executor& executor, bool is_steal);
+
+    PipelineTask* _steal_take(size_t core_id);
+
+    void _park(Executor& executor, int32_t expected);
+
+    void _unpark(Executor& executor);
+
+    std::unique_ptr<Executor[]> _executors;
+    std::atomic<size_t> _next_core = 0;
+    std::atomic<bool> _closed;
+};
+
+} // namespace doris::pipeline
@@ -31,6 +31,7 @@
 
 #include "arrow/record_batch.h"
 #include "arrow/type_fwd.h"
+#include "common/config.h"
 #include "pipeline/exec/result_sink_operator.h"
 #include "runtime/exec_env.h"
 #include "runtime/thread_context.h"
@@ -38,6 +39,14 @@
 
 namespace doris {
 
+static int64_t rows_bytes(const TFetchDataResult& result) {
+    int64_t bytes = 0;
+    for (const auto& row : result.result_batch.rows) {
+        bytes += row.size();
+    }
+    return bytes;
+}
+
 void GetResultBatchCtx::on_failure(const Status& status) {
     DCHECK(!status.ok()) << "status is ok, errmsg=" << status;
     status.to_protobuf(result->mutable_status());
@@ -90,6 +99,7 @@ BufferControlBlock::BufferControlBlock(const TUniqueId& id, int buffer_size)
           _is_close(false),
           _is_cancelled(false),
           _buffer_rows(0),
+          _buffer_bytes(0),
           _buffer_limit(buffer_size),
           _packet_num(0) {
     _query_statistics = std::make_unique<QueryStatistics>();
@@ -113,7 +123,9 @@ Status BufferControlBlock::add_batch(std::unique_ptr<TFetchDataResult>& result)
 
         int num_rows = result->result_batch.rows.size();
 
-        while ((!_fe_result_batch_queue.empty() && _buffer_rows > _buffer_limit) &&
+        while (!_fe_result_batch_queue.empty() &&
+               (_buffer_rows > _buffer_limit ||
+                _buffer_bytes > config::result_buffer_max_bytes) &&
                !_is_cancelled) {
             _data_removal.wait_for(l, std::chrono::seconds(1));
         }
@@ -123,6 +135,7 @@ Status BufferControlBlock::add_batch(std::unique_ptr<TFetchDataResult>& result)
         }
 
         if (_waiting_rpc.empty()) {
+            _buffer_bytes += rows_bytes(*result);
             // Merge result into batch to reduce rpc times
             if (!_fe_result_batch_queue.empty() &&
                 ((_fe_result_batch_queue.back()->result_batch.rows.size() + num_rows) <
@@ -143,8 +156,8 @@ Status BufferControlBlock::add_batch(std::unique_ptr<TFetchDataResult>& result)
             ctx->on_data(result, _packet_num);
             _packet_num++;
         }
+        _update_dependency();
     }
-    _update_dependency();
     return Status::OK();
 }
 
@@ -172,8 +185,8 @@ Status BufferControlBlock::add_arrow_batch(std::shared_ptr<arrow::RecordBatch>&
         _arrow_flight_batch_queue.push_back(std::move(result));
         _buffer_rows += num_rows;
         _data_arrival.notify_one();
+        _update_dependency();
     }
-    _update_dependency();
     return Status::OK();
 }
 
@@ -194,7 +207,26 @@ void BufferControlBlock::get_batch(GetResultBatchCtx* ctx) {
             // get result
             std::unique_ptr<TFetchDataResult> result = std::move(_fe_result_batch_queue.front());
             _fe_result_batch_queue.pop_front();
+            int64_t bytes = rows_bytes(*result);
+            // Send the next batches in the same fetch up to the byte budget, the eos batch apart
+            // as in add_batch.
+            const int64_t max_fetch_bytes = config::result_fetch_max_bytes;
+            while (!_fe_result_batch_queue.empty() && !result->eos &&
+                   !_fe_result_batch_queue.front()->eos) {
+                auto& next = _fe_result_batch_queue.front();
+                int64_t next_bytes = rows_bytes(*next);
+                if (bytes + next_bytes > max_fetch_bytes) {
+                    break;
+                }
+                std::vector<std::string>& rows = result->result_batch.rows;
+                std::vector<std::string>& next_rows = next->result_batch.rows;
+                rows.insert(rows.end(), std::make_move_iterator(next_rows.begin()),
+                            std::make_move_iterator(next_rows.end()));
+                bytes += next_bytes;
+                _fe_result_batch_queue.pop_front();
+            }
             _buffer_rows -= result->result_batch.rows.size();
+            _buffer_bytes -= bytes;
             _data_removal.notify_one();
 
             ctx->on_data(result, _packet_num);
@@ -290,11 +322,15 @@ void BufferControlBlock::set_dependency(
 }
 
 void BufferControlBlock::_update_dependency() {
-    if (_result_sink_dependency &&
-        (_batch_queue_empty || _buffer_rows < _buffer_limit || _is_cancelled)) {
+    if (!_result_sink_dependency) {
+        return;
+    }
+    // The result sink is paused while the rows or the bytes queued for the client are over
+    // their limits, instead of blocking its thread in add_batch.
+    if (_is_cancelled || (_buffer_rows < _buffer_limit &&
+                          _buffer_bytes < config::result_buffer_max_bytes)) {
         _result_sink_dependency->set_ready();
-    } else if (_result_sink_dependency &&
-               (!_batch_queue_empty && _buffer_rows < _buffer_limit && !_is_cancelled)) {
+    } else {
         _result_sink_dependency->block();
     }
 }
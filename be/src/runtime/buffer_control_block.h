@@ -112,6 +112,8 @@ protected:
     std::atomic_bool _is_cancelled;
     Status _status;
     std::atomic_int _buffer_rows;
+    // the bytes of the rows in _fe_result_batch_queue
+    std::atomic_int64_t _buffer_bytes;
     const int _buffer_limit;
     int64_t _packet_num;
 
@@ -130,7 +132,6 @@ protected:
 
     // only used for FE using return rows to check limit
     std::unique_ptr<QueryStatistics> _query_statistics;
-    std::atomic_bool _batch_queue_empty = false;
     std::shared_ptr<pipeline::Dependency> _result_sink_dependency;
 };
 
@@ -0,0 +1,97 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/cache/fragment_cache.h"
+
+#include <bvar/bvar.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/config.h"
+
+namespace doris {
+
+bvar::Adder<uint64_t> g_fragment_cache_hit("fragment_cache_hit");
+bvar::Adder<uint64_t> g_fragment_cache_miss("fragment_cache_miss");
+bvar::Adder<uint64_t> g_fragment_cache_insert("fragment_cache_insert");
+
+FragmentCache::FragmentCache(size_t capacity)
+        : LRUCachePolicy(CachePolicy::CacheType::FRAGMENT_CACHE, capacity, LRUCacheType::SIZE,
+                         config::fragment_cache_stale_sweep_time_sec) {}
+
+FragmentCache* FragmentCache::create_global_cache(size_t capacity) {
+    DCHECK(ExecEnv::GetInstance()->get_fragment_cache() == nullptr);
+    return new FragmentCache(capacity);
+}
+
+std::string FragmentCache::encode_key(const std::string& digest, int64_t tablet_id) {
+    std::string key;
+    key.resize(digest.size() + sizeof(tablet_id));
+    memcpy(key.data(), digest.data(), digest.size());
+    memcpy(key.data() + digest.size(), &tablet_id, sizeof(tablet_id));
+    return key;
+}
+
+bool FragmentCache::lookup(const std::string& key, int64_t version,
+                           std::vector<vectorized::Block>* blocks) {
+    auto* handle = LRUCachePolicy::lookup(key);
+    if (handle == nullptr) {
+        g_fragment_cache_miss << 1;
+        return false;
+    }
+    auto* cache_value = static_cast<CacheValue*>(value(handle));
+    bool hit = cache_value->version == version;
+    if (hit) {
+        blocks->clear();
+        blocks->reserve(cache_value->blocks.size());
+        for (const auto& block : cache_value->blocks) {
+            blocks->push_back(deep_copy(block));
+        }
+    }
+    release(handle);
+    (hit ? g_fragment_cache_hit : g_fragment_cache_miss) << 1;
+    return hit;
+}
+
+void FragmentCache::insert(const std::string& key, int64_t version,
+                           std::vector<vectorized::Block> blocks) {
+    auto* cache_value = new CacheValue;
+    cache_value->version = version;
+    cache_value->blocks = std::move(blocks);
+    size_t bytes = 0;
+    for (const auto& block : cache_value->blocks) {
+        bytes += block.allocated_bytes();
+    }
+    // an empty result still takes a slot
+    bytes = std::max<size_t>(bytes, 1);
+    auto* handle = LRUCachePolicy::insert(key, cache_value, bytes, bytes, CachePriority::NORMAL);
+    release(handle);
+    g_fragment_cache_insert << 1;
+}
+
+vectorized::Block FragmentCache::deep_copy(const vectorized::Block& block) {
+    vectorized::MutableColumns columns;
+    columns.reserve(block.columns());
+    for (size_t i = 0; i < block.columns(); ++i) {
+        const auto& column = block.get_by_position(i).column;
+        columns.push_back(column->clone_resized(column->size()));
+    }
+    return block.clone_with_columns(std::move(columns));
+}
+
+} // namespace doris
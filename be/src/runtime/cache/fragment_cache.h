@@ -0,0 +1,64 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "runtime/exec_env.h"
+#include "runtime/memory/lru_cache_policy.h"
+#include "vec/core/block.h"
+
+namespace doris {
+
+// The output of a fragment on a tablet, e.g. the streaming pre-aggregation of the scan of the
+// tablet. The output is keyed by the digest of the plan of the fragment and the tablet, and it is
+// tagged with the version of the tablet it is computed at, so a query reading a newer version
+// misses it and replaces it, while the queries reading the unchanged tablets reuse it.
+class FragmentCache : public LRUCachePolicy {
+public:
+    FragmentCache(size_t capacity);
+
+    static FragmentCache* create_global_cache(size_t capacity);
+
+    // nullptr if the fragment cache is disabled
+    static FragmentCache* instance() { return ExecEnv::GetInstance()->get_fragment_cache(); }
+
+    static std::string encode_key(const std::string& digest, int64_t tablet_id);
+
+    // copy the blocks of the key computed at the version into blocks, return false if they are
+    // not in the cache
+    bool lookup(const std::string& key, int64_t version, std::vector<vectorized::Block>* blocks);
+
+    void insert(const std::string& key, int64_t version, std::vector<vectorized::Block> blocks);
+
+    // a copy of the block which shares no column with it
+    static vectorized::Block deep_copy(const vectorized::Block& block);
+
+private:
+    class CacheValue : public LRUCacheValueBase {
+    public:
+        CacheValue() : LRUCacheValueBase(CachePolicy::CacheType::FRAGMENT_CACHE) {}
+
+        int64_t version = -1;
+        std::vector<vectorized::Block> blocks;
+    };
+};
+
+} // namespace doris
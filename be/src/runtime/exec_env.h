@@ -51,6 +51,7 @@ class WorkloadGroupMgr;
 struct WriteCooldownMetaExecutors;
 namespace io {
 class FileCacheFactory;
+class FileBlockMemCache;
 } // namespace io
 namespace segment_v2 {
 class InvertedIndexSearcherCache;
@@ -66,6 +67,7 @@ class BrpcClientCache;
 class ExternalScanContextMgr;
 class FragmentMgr;
 class ResultCache;
+class FragmentCache;
 class LoadPathMgr;
 class NewLoadStreamMgr;
 class MemTrackerLimiter;
@@ -194,10 +196,21 @@ public:
     }
     ThreadPool* send_table_stats_thread_pool() { return _send_table_stats_thread_pool.get(); }
     ThreadPool* s3_file_upload_thread_pool() { return _s3_file_upload_thread_pool.get(); }
+    ThreadPool* s3_file_read_thread_pool() { return _s3_file_read_thread_pool.get(); }
+    // null if config::segment_encode_thread_num is 0
+    ThreadPool* segment_encode_thread_pool() { return _segment_encode_thread_pool.get(); }
+    // null if config::vertical_compaction_value_group_thread_num is 0
+    ThreadPool* vertical_compaction_thread_pool() { return _vertical_compaction_thread_pool.get(); }
     ThreadPool* send_report_thread_pool() { return _send_report_thread_pool.get(); }
     ThreadPool* join_node_thread_pool() { return _join_node_thread_pool.get(); }
     ThreadPool* lazy_release_obj_pool() { return _lazy_release_obj_pool.get(); }
+    ThreadPool* exchange_deserialize_thread_pool() {
+        return _exchange_deserialize_thread_pool.get();
+    }
     ThreadPool* non_block_close_thread_pool();
+    ThreadPool* mysql_result_serialize_thread_pool() {
+        return _mysql_result_serialize_thread_pool.get();
+    }
 
     Status init_pipeline_task_scheduler();
     void init_file_cache_factory();
@@ -269,6 +282,13 @@ public:
     static void set_tracking_memory(bool tracking_memory) {
         _s_tracking_memory.store(tracking_memory, std::memory_order_release);
     }
+#endif
+#if defined(BE_TEST) || defined(BE_BENCHMARK)
+    // A QueryContext registers its statistics here, the operator benchmarks create query
+    // contexts without an initialized env.
+    void set_runtime_query_statistics_mgr(RuntimeQueryStatiticsMgr* mgr) {
+        this->_runtime_query_statistics_mgr = mgr;
+    }
 #endif
     LoadStreamMapPool* load_stream_map_pool() { return _load_stream_map_pool.get(); }
 
@@ -286,6 +306,8 @@ public:
     SegmentLoader* segment_loader() { return _segment_loader; }
     LookupConnectionCache* get_lookup_connection_cache() { return _lookup_connection_cache; }
     RowCache* get_row_cache() { return _row_cache; }
+    io::FileBlockMemCache* get_file_block_mem_cache() { return _file_block_mem_cache; }
+    FragmentCache* get_fragment_cache() { return _fragment_cache; }
     CacheManager* get_cache_manager() { return _cache_manager; }
     segment_v2::InvertedIndexSearcherCache* get_inverted_index_searcher_cache() {
         return _inverted_index_searcher_cache;
@@ -365,13 +387,20 @@ private:
     std::unique_ptr<ThreadPool> _send_table_stats_thread_pool;
     // Threadpool used to upload local file to s3
     std::unique_ptr<ThreadPool> _s3_file_upload_thread_pool;
+    // Pool used by S3FileReader to send the ranged GETs of a read concurrently
+    std::unique_ptr<ThreadPool> _s3_file_read_thread_pool;
+    std::unique_ptr<ThreadPool> _segment_encode_thread_pool;
+    std::unique_ptr<ThreadPool> _vertical_compaction_thread_pool;
     // Pool used by fragment manager to send profile or status to FE coordinator
     std::unique_ptr<ThreadPool> _send_report_thread_pool;
     // Pool used by join node to build hash table
     std::unique_ptr<ThreadPool> _join_node_thread_pool;
     // Pool to use a new thread to release object
     std::unique_ptr<ThreadPool> _lazy_release_obj_pool;
+    // nullptr if exchange_deserialize_thread_num is 0
+    std::unique_ptr<ThreadPool> _exchange_deserialize_thread_pool;
     std::unique_ptr<ThreadPool> _non_block_close_thread_pool;
+    std::unique_ptr<ThreadPool> _mysql_result_serialize_thread_pool;
 
     FragmentMgr* _fragment_mgr = nullptr;
     pipeline::TaskScheduler* _without_group_task_scheduler = nullptr;
@@ -421,6 +450,8 @@ private:
     SegmentLoader* _segment_loader = nullptr;
     LookupConnectionCache* _lookup_connection_cache = nullptr;
     RowCache* _row_cache = nullptr;
+    io::FileBlockMemCache* _file_block_mem_cache = nullptr;
+    FragmentCache* _fragment_cache = nullptr;
     CacheManager* _cache_manager = nullptr;
     segment_v2::InvertedIndexSearcherCache* _inverted_index_searcher_cache = nullptr;
     segment_v2::InvertedIndexQueryCache* _inverted_index_query_cache = nullptr;
@@ -42,6 +42,7 @@
 #include "io/cache/block_file_cache.h"
 #include "io/cache/block_file_cache_downloader.h"
 #include "io/cache/block_file_cache_factory.h"
+#include "io/cache/file_block_mem_cache.h"
 #include "io/cache/fs_file_cache_storage.h"
 #include "io/fs/file_meta_cache.h"
 #include "olap/memtable_memory_limiter.h"
@@ -59,6 +60,7 @@
 #include "pipeline/task_scheduler.h"
 #include "runtime/block_spill_manager.h"
 #include "runtime/broker_mgr.h"
+#include "runtime/cache/fragment_cache.h"
 #include "runtime/cache/result_cache.h"
 #include "runtime/client_cache.h"
 #include "runtime/exec_env.h"
@@ -241,6 +243,28 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths,
                               .set_max_threads(s3_file_upload_max_threads)
                               .build(&_s3_file_upload_thread_pool));
 
+    auto [s3_file_read_min_threads, s3_file_read_max_threads] =
+            get_num_threads(config::num_s3_file_read_thread_pool_min_thread,
+                            config::num_s3_file_read_thread_pool_max_thread);
+    static_cast<void>(ThreadPoolBuilder("S3FileReadThreadPool")
+                              .set_min_threads(s3_file_read_min_threads)
+                              .set_max_threads(s3_file_read_max_threads)
+                              .build(&_s3_file_read_thread_pool));
+
+    if (config::segment_encode_thread_num > 0) {
+        static_cast<void>(ThreadPoolBuilder("SegmentEncodeThreadPool")
+                                  .set_min_threads(config::segment_encode_thread_num)
+                                  .set_max_threads(config::segment_encode_thread_num)
+                                  .build(&_segment_encode_thread_pool));
+    }
+    if (config::vertical_compaction_value_group_thread_num > 0) {
+        static_cast<void>(
+                ThreadPoolBuilder("VerticalCompactionThreadPool")
+                        .set_min_threads(config::vertical_compaction_value_group_thread_num)
+                        .set_max_threads(config::vertical_compaction_value_group_thread_num)
+                        .build(&_vertical_compaction_thread_pool));
+    }
+
     // min num equal to fragment pool's min num
     // max num is useless because it will start as many as requested in the past
     // queue size is useless because the max thread num is very large
@@ -260,6 +284,18 @@ Status ExecEnv::_init(const std::vector<StorePath>& store_paths,
                               .set_max_threads(1)
                               .set_max_queue_size(1000000)
                               .build(&_lazy_release_obj_pool));
+    if (config::exchange_deserialize_thread_num > 0) {
+        static_cast<void>(ThreadPoolBuilder("ExchangeDeserializeThreadPool")
+                                  .set_min_threads(config::exchange_deserialize_thread_num)
+                                  .set_max_threads(config::exchange_deserialize_thread_num)
+                                  .build(&_exchange_deserialize_thread_pool));
+    }
+    if (config::mysql_result_serialize_thread_num > 0) {
+        static_cast<void>(ThreadPoolBuilder("MysqlResultSerializeThreadPool")
+                                  .set_min_threads(config::mysql_result_serialize_thread_num)
+                                  .set_max_threads(config::mysql_result_serialize_thread_num)
+                                  .build(&_mysql_result_serialize_thread_pool));
+    }
     static_cast<void>(ThreadPoolBuilder("NonBlockCloseThreadPool")
                               .set_min_threads(config::min_nonblock_close_thread_num)
                               .set_max_threads(config::max_nonblock_close_thread_num)
@@ -372,7 +408,7 @@ Status ExecEnv::init_pipeline_task_scheduler() {
 
     LOG_INFO("pipeline executors_size set ").tag("size", executors_size);
     // TODO pipeline workload group combie two blocked schedulers.
-    auto t_queue = std::make_shared<pipeline::MultiCoreTaskQueue>(executors_size);
+    auto t_queue = pipeline::create_task_queue(executors_size);
     _without_group_task_scheduler =
             new pipeline::TaskScheduler(this, t_queue, "PipeNoGSchePool", nullptr);
     RETURN_IF_ERROR(_without_group_task_scheduler->start());
@@ -500,6 +536,30 @@ Status ExecEnv::_init_mem_env() {
               << PrettyPrinter::print(row_cache_mem_limit, TUnit::BYTES)
               << ", origin config value: " << config::row_cache_mem_limit;
 
+    int64_t fragment_cache_limit =
+            ParseUtil::parse_mem_spec(config::fragment_cache_limit, MemInfo::mem_limit(),
+                                      MemInfo::physical_mem(), &is_percent);
+    if (fragment_cache_limit > 0) {
+        _fragment_cache = FragmentCache::create_global_cache(fragment_cache_limit);
+        LOG(INFO) << "Fragment cache memory limit: "
+                  << PrettyPrinter::print(fragment_cache_limit, TUnit::BYTES)
+                  << ", origin config value: " << config::fragment_cache_limit;
+    }
+
+    // Init memory tier of file cache
+    if (config::enable_file_cache) {
+        int64_t file_block_mem_cache_limit =
+                ParseUtil::parse_mem_spec(config::file_block_mem_cache_limit, MemInfo::mem_limit(),
+                                          MemInfo::physical_mem(), &is_percent);
+        if (file_block_mem_cache_limit > 0) {
+            _file_block_mem_cache =
+                    io::FileBlockMemCache::create_global_cache(file_block_mem_cache_limit);
+            LOG(INFO) << "File block memory cache limit: "
+                      << PrettyPrinter::print(file_block_mem_cache_limit, TUnit::BYTES)
+                      << ", origin config value: " << config::file_block_mem_cache_limit;
+        }
+    }
+
     uint64_t fd_number = config::min_file_descriptor_number;
     struct rlimit l;
     int ret = getrlimit(RLIMIT_NOFILE, &l);
@@ -538,7 +598,12 @@ Status ExecEnv::_init_mem_env() {
               << config::file_cache_max_file_reader_cache_size;
     config::file_cache_max_file_reader_cache_size = block_file_cache_fd_cache_size;
 
-    _file_meta_cache = new FileMetaCache(config::max_external_file_meta_cache_num);
+    if (config::max_external_file_meta_cache_bytes > 0) {
+        _file_meta_cache = new FileMetaCache(config::max_external_file_meta_cache_bytes,
+                                             LRUCacheType::SIZE);
+    } else {
+        _file_meta_cache = new FileMetaCache(config::max_external_file_meta_cache_num);
+    }
 
     _lookup_connection_cache =
             LookupConnectionCache::create_global_instance(config::lookup_connection_cache_capacity);
@@ -666,8 +731,13 @@ void ExecEnv::destroy() {
     }
     SAFE_SHUTDOWN(_buffered_reader_prefetch_thread_pool);
     SAFE_SHUTDOWN(_s3_file_upload_thread_pool);
+    SAFE_SHUTDOWN(_s3_file_read_thread_pool);
+    SAFE_SHUTDOWN(_segment_encode_thread_pool);
+    SAFE_SHUTDOWN(_vertical_compaction_thread_pool);
     SAFE_SHUTDOWN(_join_node_thread_pool);
     SAFE_SHUTDOWN(_lazy_release_obj_pool);
+    SAFE_SHUTDOWN(_exchange_deserialize_thread_pool);
+    SAFE_SHUTDOWN(_mysql_result_serialize_thread_pool);
     SAFE_SHUTDOWN(_non_block_close_thread_pool);
     SAFE_SHUTDOWN(_send_report_thread_pool);
     SAFE_SHUTDOWN(_send_batch_thread_pool);
@@ -683,6 +753,8 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_schema_cache);
     SAFE_DELETE(_segment_loader);
     SAFE_DELETE(_row_cache);
+    SAFE_DELETE(_file_block_mem_cache);
+    SAFE_DELETE(_fragment_cache);
 
     // Free resource after threads are stopped.
     // Some threads are still running, like threads created by _new_load_stream_mgr ...
@@ -714,11 +786,16 @@ void ExecEnv::destroy() {
     // TODO(zhiqiang): Maybe we should call shutdown before release thread pool?
     _join_node_thread_pool.reset(nullptr);
     _lazy_release_obj_pool.reset(nullptr);
+    _exchange_deserialize_thread_pool.reset(nullptr);
+    _mysql_result_serialize_thread_pool.reset(nullptr);
     _non_block_close_thread_pool.reset(nullptr);
     _send_report_thread_pool.reset(nullptr);
     _send_table_stats_thread_pool.reset(nullptr);
     _buffered_reader_prefetch_thread_pool.reset(nullptr);
     _s3_file_upload_thread_pool.reset(nullptr);
+    _s3_file_read_thread_pool.reset(nullptr);
+    _segment_encode_thread_pool.reset(nullptr);
+    _vertical_compaction_thread_pool.reset(nullptr);
     _send_batch_thread_pool.reset(nullptr);
     _file_cache_open_fd_cache.reset(nullptr);
     _write_cooldown_meta_executors.reset(nullptr);
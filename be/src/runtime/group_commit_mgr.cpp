@@ -20,12 +20,15 @@
 #include <gen_cpp/Types_types.h>
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <chrono>
 
 #include "client_cache.h"
 #include "common/compiler_util.h"
 #include "common/config.h"
 #include "common/status.h"
+#include "olap/base_tablet.h"
+#include "olap/tablet_meta.h"
 #include "runtime/exec_env.h"
 #include "runtime/fragment_mgr.h"
 #include "util/debug_points.h"
@@ -96,7 +99,7 @@ Status LoadBlockQueue::add_block(RuntimeState* runtime_state,
         if (_data_bytes >= _group_commit_data_bytes) {
             VLOG_DEBUG << "group commit meets commit condition for data size, label=" << label
                        << ", instance_id=" << load_instance_id << ", data_bytes=" << _data_bytes;
-            _need_commit = true;
+            _set_need_commit();
             data_size_condition = true;
         }
         if (std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
@@ -104,7 +107,7 @@ Status LoadBlockQueue::add_block(RuntimeState* runtime_state,
                     .count() >= _group_commit_interval_ms) {
             VLOG_DEBUG << "group commit meets commit condition for time interval, label=" << label
                        << ", instance_id=" << load_instance_id << ", data_bytes=" << _data_bytes;
-            _need_commit = true;
+            _set_need_commit();
         }
     }
     _get_cond.notify_all();
@@ -120,7 +123,7 @@ Status LoadBlockQueue::get_block(RuntimeState* runtime_state, vectorized::Block*
         if (std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() -
                                                                   _start_time)
                     .count() >= _group_commit_interval_ms) {
-            _need_commit = true;
+            _set_need_commit();
         }
     }
     while (!runtime_state->is_cancelled() && status.ok() && _block_queue.empty() &&
@@ -132,7 +135,7 @@ Status LoadBlockQueue::get_block(RuntimeState* runtime_state, vectorized::Block*
         if (!_need_commit) {
             left_milliseconds = _group_commit_interval_ms - duration;
             if (left_milliseconds <= 0) {
-                _need_commit = true;
+                _set_need_commit();
                 break;
             }
         } else {
@@ -190,6 +193,19 @@ Status LoadBlockQueue::get_block(RuntimeState* runtime_state, vectorized::Block*
     return Status::OK();
 }
 
+void LoadBlockQueue::_set_need_commit() {
+    if (!_need_commit) {
+        _need_commit = true;
+        _need_commit_time = std::chrono::steady_clock::now();
+    }
+}
+
+int64_t LoadBlockQueue::commit_window_ms() {
+    std::unique_lock l(mutex);
+    auto end = _need_commit ? _need_commit_time : std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(end - _start_time).count();
+}
+
 void LoadBlockQueue::remove_load_id(const UniqueId& load_id) {
     std::unique_lock l(mutex);
     if (_load_ids.find(load_id) != _load_ids.end()) {
@@ -356,9 +372,14 @@ Status GroupCommitTable::_create_group_commit_load(int be_exe_version,
                    << ", txn_id=" << txn_id << ", instance_id=" << print_id(instance_id)
                    << ", is_pipeline=" << is_pipeline;
         {
+            int64_t interval_ms = result.group_commit_interval_ms;
+            if (config::enable_group_commit_adaptive_interval) {
+                interval_ms = _interval_policy.interval_ms(result.group_commit_interval_ms,
+                                                           result.group_commit_data_bytes);
+            }
             auto load_block_queue = std::make_shared<LoadBlockQueue>(
                     instance_id, label, txn_id, schema_version, _all_block_queues_bytes,
-                    result.wait_internal_group_commit_finish, result.group_commit_interval_ms,
+                    result.wait_internal_group_commit_finish, interval_ms,
                     result.group_commit_data_bytes);
             std::unique_lock l(_lock);
             //create wal
@@ -463,6 +484,9 @@ Status GroupCommitTable::_finish_group_commit_load(int64_t db_id, int64_t table_
         }
         _load_block_queues.erase(instance_id);
     }
+    if (load_block_queue != nullptr && status.ok()) {
+        _update_interval_policy(load_block_queue, state);
+    }
     // status: exec_plan_fragment result
     // st: commit txn rpc status
     // result_status: commit txn result
@@ -509,6 +533,55 @@ Status GroupCommitTable::_finish_group_commit_load(int64_t db_id, int64_t table_
     return st;
 }
 
+void GroupCommitTable::_update_interval_policy(
+        const std::shared_ptr<LoadBlockQueue>& load_block_queue, RuntimeState* state) {
+    int64_t data_bytes = load_block_queue->data_bytes();
+    int64_t window_ms = load_block_queue->commit_window_ms();
+    _commit_bytes << data_bytes;
+    _commit_window_ms << window_ms;
+    if (!config::enable_group_commit_adaptive_interval) {
+        return;
+    }
+    // the version count of the tablets written by this commit tells whether compaction keeps up
+    // with the rowsets of the table
+    size_t max_version_count = 0;
+    if (state) {
+        for (const auto& commit_info : state->tablet_commit_infos()) {
+            auto tablet = ExecEnv::get_tablet(commit_info.tabletId);
+            if (tablet.has_value()) {
+                max_version_count =
+                        std::max(max_version_count, tablet.value()->tablet_meta()->version_count());
+            }
+        }
+    }
+    double version_ratio = static_cast<double>(max_version_count) /
+                           std::max<int32_t>(1, config::max_tablet_version_num);
+    _interval_policy.update(data_bytes, window_ms, version_ratio);
+}
+
+int64_t GroupCommitIntervalPolicy::interval_ms(int64_t max_interval_ms, int64_t max_data_bytes) {
+    std::lock_guard l(_lock);
+    if (_bytes_per_ms <= 0 || _version_ratio >= config::group_commit_adaptive_version_ratio) {
+        return max_interval_ms;
+    }
+    int64_t target_bytes = std::min(max_data_bytes, config::group_commit_adaptive_target_bytes);
+    auto min_interval_ms = std::min<int64_t>(max_interval_ms,
+                                             config::group_commit_adaptive_min_interval_ms);
+    double interval_ms = std::min<double>(target_bytes / _bytes_per_ms, max_interval_ms);
+    return std::max(static_cast<int64_t>(interval_ms), min_interval_ms);
+}
+
+void GroupCommitIntervalPolicy::update(int64_t data_bytes, int64_t window_ms,
+                                       double version_ratio) {
+    std::lock_guard l(_lock);
+    // weight of the latest commit in the moving average of the arrival rate
+    static constexpr double alpha = 0.3;
+    double bytes_per_ms = static_cast<double>(data_bytes) / std::max<int64_t>(1, window_ms);
+    _bytes_per_ms =
+            _bytes_per_ms <= 0 ? bytes_per_ms : (1 - alpha) * _bytes_per_ms + alpha * bytes_per_ms;
+    _version_ratio = version_ratio;
+}
+
 Status GroupCommitTable::_exec_plan_fragment(int64_t db_id, int64_t table_id,
                                              const std::string& label, int64_t txn_id,
                                              bool is_pipeline,
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <bvar/latency_recorder.h>
 #include <gen_cpp/PaloInternalService_types.h>
 
 #include <atomic>
@@ -73,6 +74,12 @@ public:
     void remove_load_id(const UniqueId& load_id);
     void cancel(const Status& st);
     bool need_commit() { return _need_commit; }
+    int64_t data_bytes() {
+        std::unique_lock l(mutex);
+        return _data_bytes;
+    }
+    // the time from the creation of this queue until it met a commit condition
+    int64_t commit_window_ms();
 
     Status create_wal(int64_t db_id, int64_t tb_id, int64_t wal_id, const std::string& import_label,
                       WalManager* wal_manager, std::vector<TSlotDescriptor>& slot_desc,
@@ -98,6 +105,7 @@ public:
 
 private:
     void _cancel_without_lock(const Status& st);
+    void _set_need_commit();
 
     // the set of load ids of all blocks in this queue
     std::set<UniqueId> _load_ids;
@@ -112,6 +120,7 @@ private:
     // commit by time interval, can be changed by 'ALTER TABLE my_table SET ("group_commit_interval_ms"="1000");'
     int64_t _group_commit_interval_ms;
     std::chrono::steady_clock::time_point _start_time;
+    std::chrono::steady_clock::time_point _need_commit_time;
     // commit by data size
     int64_t _group_commit_data_bytes;
     int64_t _data_bytes = 0;
@@ -124,6 +133,25 @@ private:
     static constexpr size_t MEM_BACK_PRESSURE_WAIT_TIMEOUT = 120000; // 120s
 };
 
+// Sizes the commit interval of the load block queues of one table by the rate the data arrives
+// at, so that a commit holds about a target size of data without waiting longer than the
+// interval of the table.
+class GroupCommitIntervalPolicy {
+public:
+    // `max_interval_ms` and `max_data_bytes` are the group commit properties of the table
+    int64_t interval_ms(int64_t max_interval_ms, int64_t max_data_bytes);
+
+    // Feed a finished commit of `data_bytes` that arrived in `window_ms`, `version_ratio` is the
+    // max version count of the tablets it wrote relative to config::max_tablet_version_num
+    void update(int64_t data_bytes, int64_t window_ms, double version_ratio);
+
+private:
+    std::mutex _lock;
+    // moving average of the arrival rate, 0 before the first commit
+    double _bytes_per_ms = 0;
+    double _version_ratio = 0;
+};
+
 class GroupCommitTable {
 public:
     GroupCommitTable(ExecEnv* exec_env, doris::ThreadPool* thread_pool, int64_t db_id,
@@ -132,7 +160,10 @@ public:
               _thread_pool(thread_pool),
               _all_block_queues_bytes(all_block_queue_bytes),
               _db_id(db_id),
-              _table_id(table_id) {};
+              _table_id(table_id),
+              _commit_bytes("group_commit_table_" + std::to_string(table_id), "commit_bytes"),
+              _commit_window_ms("group_commit_table_" + std::to_string(table_id),
+                                "commit_window_ms") {};
     Status get_first_block_load_queue(int64_t table_id, int64_t base_schema_version,
                                       const UniqueId& load_id,
                                       std::shared_ptr<LoadBlockQueue>& load_block_queue,
@@ -151,6 +182,8 @@ private:
     Status _finish_group_commit_load(int64_t db_id, int64_t table_id, const std::string& label,
                                      int64_t txn_id, const TUniqueId& instance_id, Status& status,
                                      RuntimeState* state);
+    void _update_interval_policy(const std::shared_ptr<LoadBlockQueue>& load_block_queue,
+                                 RuntimeState* state);
 
     ExecEnv* _exec_env = nullptr;
     ThreadPool* _thread_pool = nullptr;
@@ -165,6 +198,11 @@ private:
     // fragment_instance_id to load_block_queue
     std::unordered_map<UniqueId, std::shared_ptr<LoadBlockQueue>> _load_block_queues;
     bool _is_creating_plan_fragment = false;
+
+    GroupCommitIntervalPolicy _interval_policy;
+    // distribution of the data size and the window of the commits of this table
+    bvar::LatencyRecorder _commit_bytes;
+    bvar::LatencyRecorder _commit_window_ms;
 };
 
 class GroupCommitMgr {
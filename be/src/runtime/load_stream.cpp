@@ -50,6 +50,7 @@ namespace doris {
 
 bvar::LatencyRecorder g_load_stream_flush_wait_ms("load_stream_flush_wait_ms");
 bvar::Adder<int> g_load_stream_flush_running_threads("load_stream_flush_wait_threads");
+bvar::Adder<int64_t> g_load_stream_pending_flush_bytes("load_stream_pending_flush_bytes");
 
 TabletStream::TabletStream(PUniqueId load_id, int64_t id, int64_t txn_id,
                            LoadStreamMgr* load_stream_mgr, RuntimeProfile* profile)
@@ -137,7 +138,8 @@ Status TabletStream::append_data(const PStreamHeader& header, butil::IOBuf* data
     uint32_t new_segid = mapping->at(segid);
     DCHECK(new_segid != std::numeric_limits<uint32_t>::max());
     butil::IOBuf buf = data->movable();
-    auto flush_func = [this, new_segid, eos, buf, header]() {
+    int64_t buf_size = buf.size();
+    auto flush_func = [this, new_segid, eos, buf, buf_size, header]() {
         signal::set_signal_task_id(_load_id);
         g_load_stream_flush_running_threads << -1;
         auto st = _load_stream_writer->append_data(new_segid, header.offset(), buf);
@@ -148,8 +150,24 @@ Status TabletStream::append_data(const PStreamHeader& header, butil::IOBuf* data
             _failed_st = std::make_shared<Status>(st);
             LOG(INFO) << "write data failed " << *this;
         }
+        _release_flush_credit(buf_size);
     };
     auto& flush_token = _flush_tokens[new_segid % _flush_tokens.size()];
+    RETURN_IF_ERROR(_acquire_flush_credit(flush_token.get(), buf_size));
+    g_load_stream_flush_running_threads << 1;
+    auto st = flush_token->submit_func(flush_func);
+    if (!st.ok()) {
+        _release_flush_credit(buf_size);
+    }
+    return st;
+}
+
+// The data of a tablet is only taken from the stream when its flush token has a free task slot
+// and the bytes waiting to be flushed are under the credit of the tablet. Until then the stream
+// handler is blocked and brpc does not return the consumed window to the sender, so the sender
+// waits in StreamWait instead of retrying on EAGAIN, and the memory held by the receiver is
+// bounded by the credit.
+Status TabletStream::_acquire_flush_credit(ThreadPoolToken* flush_token, int64_t bytes) {
     auto load_stream_flush_token_max_tasks = config::load_stream_flush_token_max_tasks;
     auto load_stream_max_wait_flush_token_time_ms =
             config::load_stream_max_wait_flush_token_time_ms;
@@ -159,20 +177,42 @@ Status TabletStream::append_data(const PStreamHeader& header, butil::IOBuf* data
     });
     MonotonicStopWatch timer;
     timer.start();
-    while (flush_token->num_tasks() >= load_stream_flush_token_max_tasks) {
-        if (timer.elapsed_time() / 1000 / 1000 >= load_stream_max_wait_flush_token_time_ms) {
-            return Status::Error<true>(
-                    "wait flush token back pressure time is more than "
-                    "load_stream_max_wait_flush_token_time {}",
-                    load_stream_max_wait_flush_token_time_ms);
+    {
+        std::unique_lock<bthread::Mutex> lock(_flush_credit_lock);
+        auto has_credit = [&]() {
+            int64_t max_pending_bytes = config::load_stream_max_pending_flush_bytes_per_tablet;
+            // one flush is always allowed so that a buffer larger than the credit makes progress
+            bool has_bytes = max_pending_bytes <= 0 || _pending_flush_bytes == 0 ||
+                             _pending_flush_bytes + bytes <= max_pending_bytes;
+            return has_bytes && flush_token->num_tasks() < load_stream_flush_token_max_tasks;
+        };
+        while (!has_credit()) {
+            if (timer.elapsed_time() / 1000 / 1000 >= load_stream_max_wait_flush_token_time_ms) {
+                return Status::Error<true>(
+                        "wait flush token back pressure time is more than "
+                        "load_stream_max_wait_flush_token_time {}",
+                        load_stream_max_wait_flush_token_time_ms);
+            }
+            // a finished flush notifies before its token counts it as done, so wake up
+            // periodically to check the token again
+            _flush_credit_cv.wait_for(lock, 10 * 1000); // 10ms
         }
-        bthread_usleep(2 * 1000); // 2ms
+        _pending_flush_bytes += bytes;
     }
+    g_load_stream_pending_flush_bytes << bytes;
     timer.stop();
     int64_t time_ms = timer.elapsed_time() / 1000 / 1000;
     g_load_stream_flush_wait_ms << time_ms;
-    g_load_stream_flush_running_threads << 1;
-    return flush_token->submit_func(flush_func);
+    return Status::OK();
+}
+
+void TabletStream::_release_flush_credit(int64_t bytes) {
+    {
+        std::lock_guard<bthread::Mutex> lock(_flush_credit_lock);
+        _pending_flush_bytes -= bytes;
+    }
+    g_load_stream_pending_flush_bytes << -bytes;
+    _flush_credit_cv.notify_all();
 }
 
 Status TabletStream::add_segment(const PStreamHeader& header, butil::IOBuf* data) {
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <bthread/condition_variable.h>
 #include <bthread/mutex.h>
 #include <gen_cpp/internal_service.pb.h>
 
@@ -58,12 +59,20 @@ public:
     friend std::ostream& operator<<(std::ostream& ostr, const TabletStream& tablet_stream);
 
 private:
+    // wait until the tablet has credit to queue `bytes` more data for flush
+    Status _acquire_flush_credit(ThreadPoolToken* flush_token, int64_t bytes);
+    void _release_flush_credit(int64_t bytes);
+
     int64_t _id;
     LoadStreamWriterSharedPtr _load_stream_writer;
     std::vector<std::unique_ptr<ThreadPoolToken>> _flush_tokens;
     std::unordered_map<int64_t, std::unique_ptr<SegIdMapping>> _segids_mapping;
     std::atomic<uint32_t> _next_segid;
     bthread::Mutex _lock;
+    // bytes of the data queued in the flush tokens and not yet written
+    bthread::Mutex _flush_credit_lock;
+    bthread::ConditionVariable _flush_credit_cv;
+    int64_t _pending_flush_bytes = 0;
     std::shared_ptr<Status> _failed_st;
     PUniqueId _load_id;
     int64_t _txn_id;
@@ -17,7 +17,14 @@
 
 #include "runtime/memory/cache_manager.h"
 
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "common/config.h"
 #include "runtime/memory/cache_policy.h"
+#include "runtime/memory/lru_cache_policy.h"
 #include "util/runtime_profile.h"
 
 namespace doris {
@@ -61,4 +68,113 @@ void CacheManager::clear_once(CachePolicy::CacheType type) {
     _caches[type]->prune_all(true); // will print log
 }
 
+// A cache whose usage is below this ratio of its capacity is not short of capacity.
+static constexpr double CACHE_FULL_USAGE_RATIO = 0.9;
+
+// The caches of the data loaded from the segments, their capacity is a budget of the same
+// kind of memory.
+static bool is_capacity_rebalanced(CachePolicy::CacheType type) {
+    switch (type) {
+    case CachePolicy::CacheType::DATA_PAGE_CACHE:
+    case CachePolicy::CacheType::INDEXPAGE_CACHE:
+    case CachePolicy::CacheType::PK_INDEX_PAGE_CACHE:
+    case CachePolicy::CacheType::SEGMENT_CACHE:
+    case CachePolicy::CacheType::INVERTEDINDEX_SEARCHER_CACHE:
+    case CachePolicy::CacheType::INVERTEDINDEX_QUERY_CACHE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void CacheManager::rebalance_capacity() {
+    if (!config::enable_cache_capacity_rebalance) {
+        return;
+    }
+    struct Candidate {
+        LRUCachePolicy* cache;
+        size_t initial_capacity;
+        size_t capacity;
+        double benefit;
+    };
+    std::lock_guard<std::mutex> l(_caches_lock);
+    std::vector<Candidate> candidates;
+    size_t budget = 0;
+    double total_benefit = 0;
+    for (const auto& pair : _caches) {
+        if (!is_capacity_rebalanced(pair.first)) {
+            continue;
+        }
+        auto* cache = dynamic_cast<LRUCachePolicy*>(pair.second);
+        if (cache == nullptr || !cache->can_adjust_capacity()) {
+            continue;
+        }
+        auto& state = _capacity_rebalance_states[pair.first];
+        size_t capacity = cache->get_total_capacity();
+        if (state.initial_capacity == 0) {
+            state.initial_capacity = capacity;
+        }
+        uint64_t lookup_count = cache->get_lookup_count();
+        uint64_t hit_count = cache->get_hit_count();
+        uint64_t miss_count = (lookup_count - state.last_lookup_count) -
+                              (hit_count - state.last_hit_count);
+        state.last_lookup_count = lookup_count;
+        state.last_hit_count = hit_count;
+
+        // the extra bytes only save the misses of a cache which is full
+        double benefit = 0;
+        if (capacity > 0 && cache->get_usage() >= capacity * CACHE_FULL_USAGE_RATIO) {
+            benefit = static_cast<double>(miss_count) * cache->miss_cost_bytes() / capacity;
+        }
+        budget += state.initial_capacity;
+        total_benefit += benefit;
+        candidates.push_back({cache, state.initial_capacity, capacity, benefit});
+    }
+    if (candidates.size() < 2 || total_benefit <= 0) {
+        return;
+    }
+
+    // Every cache moves half way to its share of the budget by the benefit, within its bounds.
+    std::vector<size_t> new_capacities;
+    size_t total_new_capacity = 0;
+    for (const auto& candidate : candidates) {
+        auto target = static_cast<size_t>(budget * (candidate.benefit / total_benefit));
+        auto min_capacity = static_cast<size_t>(candidate.initial_capacity *
+                                                config::cache_capacity_rebalance_min_ratio);
+        auto max_capacity = static_cast<size_t>(candidate.initial_capacity *
+                                                config::cache_capacity_rebalance_max_ratio);
+        max_capacity = std::max(min_capacity, max_capacity);
+        new_capacities.push_back(
+                std::clamp((candidate.capacity + target) / 2, min_capacity, max_capacity));
+        total_new_capacity += new_capacities.back();
+    }
+    if (total_new_capacity > budget) {
+        double ratio = static_cast<double>(budget) / total_new_capacity;
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            auto min_capacity = static_cast<size_t>(candidates[i].initial_capacity *
+                                                    config::cache_capacity_rebalance_min_ratio);
+            new_capacities[i] =
+                    std::max(min_capacity, static_cast<size_t>(new_capacities[i] * ratio));
+        }
+    }
+
+    // shrink before grow, not to exceed the budget during the rebalance
+    for (bool shrink : {true, false}) {
+        for (size_t i = 0; i < candidates.size(); ++i) {
+            const auto& candidate = candidates[i];
+            if (new_capacities[i] == candidate.capacity ||
+                (new_capacities[i] < candidate.capacity) != shrink) {
+                continue;
+            }
+            PrunedInfo pruned_info = candidate.cache->adjust_capacity(new_capacities[i]);
+            LOG(INFO) << fmt::format(
+                    "[MemoryGC] {} capacity rebalance from {} to {}, benefit {:.3f}, pruned {} "
+                    "entries, {} bytes",
+                    CachePolicy::type_string(candidate.cache->type()), candidate.capacity,
+                    new_capacities[i], candidate.benefit, pruned_info.pruned_count,
+                    pruned_info.pruned_size);
+        }
+    }
+}
+
 } // namespace doris
@@ -68,6 +68,11 @@ public:
 
     void clear_once(CachePolicy::CacheType type);
 
+    // Move the capacity among the caches of segment data, to the caches whose extra bytes save
+    // the most bytes to load again by their misses since the last call. The total capacity
+    // stays the sum of the initial capacities, see config::enable_cache_capacity_rebalance.
+    void rebalance_capacity();
+
     bool need_prune(int64_t* last_timestamp, const std::string& type) {
         int64_t now = UnixSeconds();
         std::lock_guard<std::mutex> l(_caches_lock);
@@ -83,8 +88,15 @@ public:
     }
 
 private:
+    struct CapacityRebalanceState {
+        size_t initial_capacity = 0;
+        uint64_t last_lookup_count = 0;
+        uint64_t last_hit_count = 0;
+    };
+
     std::mutex _caches_lock;
     std::unordered_map<CachePolicy::CacheType, CachePolicy*> _caches;
+    std::unordered_map<CachePolicy::CacheType, CapacityRebalanceState> _capacity_rebalance_states;
     int64_t _last_prune_stale_timestamp = 0;
     int64_t _last_prune_all_timestamp = 0;
 };
@@ -48,6 +48,8 @@ public:
         CREATE_TABLET_RR_IDX_CACHE = 15,
         CLOUD_TABLET_CACHE = 16,
         CLOUD_TXN_DELETE_BITMAP_CACHE = 17,
+        FILE_BLOCK_MEM_CACHE = 18,
+        FRAGMENT_CACHE = 19,
     };
 
     static std::string type_string(CacheType type) {
@@ -88,6 +90,10 @@ public:
             return "CloudTabletCache";
         case CacheType::CLOUD_TXN_DELETE_BITMAP_CACHE:
             return "CloudTxnDeleteBitmapCache";
+        case CacheType::FILE_BLOCK_MEM_CACHE:
+            return "FileBlockMemCache";
+        case CacheType::FRAGMENT_CACHE:
+            return "FragmentCache";
         default:
             LOG(FATAL) << "not match type of cache policy :" << static_cast<int>(type);
         }
@@ -19,6 +19,21 @@
 
 #include <bvar/bvar.h>
 
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "common/config.h"
+#include "runtime/exec_env.h"
+#include "runtime/fragment_mgr.h"
+#include "runtime/query_context.h"
+#include "runtime/workload_management/workload_query_info.h"
+#include "util/pretty_printer.h"
+#include "util/runtime_profile.h"
+#include "util/time.h"
+#include "util/uid_util.h"
+
 namespace doris {
 
 bvar::PassiveStatus<int64_t> g_vm_rss_sub_allocator_cache(
@@ -31,4 +46,51 @@ bvar::PassiveStatus<int64_t> g_process_memory_usage(
 std::atomic<int64_t> GlobalMemoryArbitrator::_s_vm_rss_sub_allocator_cache = -1;
 std::atomic<int64_t> GlobalMemoryArbitrator::_s_process_reserved_memory = 0;
 
+int64_t GlobalMemoryArbitrator::request_spill_top_revocable_query(int64_t need_free_mem,
+                                                                  RuntimeProfile* profile) {
+    RuntimeProfile::Counter* revocable_memory_counter =
+            ADD_COUNTER(profile, "RevocableMemory", TUnit::BYTES);
+    RuntimeProfile::Counter* spill_queries_counter =
+            ADD_COUNTER(profile, "SpillRequestedQueries", TUnit::UNIT);
+
+    std::vector<WorkloadQueryInfo> query_infos;
+    ExecEnv::GetInstance()->fragment_mgr()->get_runtime_query_info(&query_infos);
+    std::vector<std::pair<int64_t, std::shared_ptr<QueryContext>>> revocable_queries;
+    for (const auto& query_info : query_infos) {
+        std::shared_ptr<QueryContext> query_ctx;
+        if (!ExecEnv::GetInstance()
+                     ->fragment_mgr()
+                     ->get_query_context(query_info.tquery_id, &query_ctx)
+                     .ok() ||
+            query_ctx->is_cancelled()) {
+            continue;
+        }
+        int64_t revocable_mem_size = query_ctx->revocable_mem_size();
+        if (revocable_mem_size > 0) {
+            revocable_queries.emplace_back(revocable_mem_size, std::move(query_ctx));
+        }
+    }
+    std::sort(revocable_queries.begin(), revocable_queries.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+
+    // valid until the next memory GC, which renews it if the memory is still short
+    int64_t expire_time_ms = MonotonicMillis() + 2 * config::memory_gc_sleep_time_ms;
+    int64_t requested_mem = 0;
+    for (auto& [revocable_mem_size, query_ctx] : revocable_queries) {
+        if (requested_mem >= need_free_mem) {
+            break;
+        }
+        query_ctx->request_spill(expire_time_ms);
+        requested_mem += revocable_mem_size;
+        COUNTER_UPDATE(spill_queries_counter, 1);
+        LOG(INFO) << fmt::format(
+                "[MemoryGC] request query {} to spill revocable memory {}, process memory {}",
+                print_id(query_ctx->query_id()),
+                PrettyPrinter::print(revocable_mem_size, TUnit::BYTES),
+                PrettyPrinter::print(process_memory_usage(), TUnit::BYTES));
+    }
+    COUNTER_UPDATE(revocable_memory_counter, requested_mem);
+    return requested_mem;
+}
+
 } // namespace doris
@@ -21,6 +21,8 @@
 
 namespace doris {
 
+class RuntimeProfile;
+
 class GlobalMemoryArbitrator {
 public:
     /** jemalloc pdirty is number of pages within unused extents that are potentially
@@ -96,6 +98,12 @@ public:
                MemInfo::sys_mem_available() - bytes < MemInfo::sys_mem_available_low_water_mark();
     }
 
+    // Ask the queries with the most revocable memory to spill, until they could release
+    // `need_free_mem` together. Returns the revocable memory of the requested queries,
+    // which is released asynchronously by the spilling sinks.
+    static int64_t request_spill_top_revocable_query(int64_t need_free_mem,
+                                                     RuntimeProfile* profile);
+
     static std::string process_mem_log_str() {
         return fmt::format(
                 "os physical memory {}. process memory used {}, limit {}, soft limit {}. sys "
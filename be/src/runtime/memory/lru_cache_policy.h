@@ -123,6 +123,51 @@ public:
 
     uint64_t new_id() { return _cache->new_id(); };
 
+    // See LRUCache::set_protected_capacity_ratio, the dummy cache is left as it is.
+    void set_protected_capacity_ratio(double ratio) {
+        if (auto* cache = dynamic_cast<ShardedLRUCache*>(_cache.get())) {
+            cache->set_protected_capacity_ratio(ratio);
+        }
+    }
+
+    // See LRUCache::set_clock_lookup, the dummy cache is left as it is.
+    void set_clock_lookup(bool clock_lookup) {
+        if (auto* cache = dynamic_cast<ShardedLRUCache*>(_cache.get())) {
+            cache->set_clock_lookup(clock_lookup);
+        }
+    }
+
+    // Only the size of a LRUCacheType::SIZE cache can be adjusted, the dummy cache is not.
+    bool can_adjust_capacity() {
+        return _lru_cache_type == LRUCacheType::SIZE &&
+               dynamic_cast<ShardedLRUCache*>(_cache.get()) != nullptr;
+    }
+
+    // See ShardedLRUCache::adjust_capacity, must check can_adjust_capacity first.
+    PrunedInfo adjust_capacity(size_t capacity) {
+        auto* cache = dynamic_cast<ShardedLRUCache*>(_cache.get());
+        DCHECK(cache != nullptr);
+        return cache->adjust_capacity(capacity);
+    }
+
+    uint64_t get_lookup_count() {
+        auto* cache = dynamic_cast<ShardedLRUCache*>(_cache.get());
+        return cache == nullptr ? 0 : cache->get_lookup_count();
+    }
+
+    uint64_t get_hit_count() {
+        auto* cache = dynamic_cast<ShardedLRUCache*>(_cache.get());
+        return cache == nullptr ? 0 : cache->get_hit_count();
+    }
+
+    // The estimated bytes to load again for a miss, the average charge of the entries.
+    // Subclass can override this method if a miss costs more than loading the entry.
+    virtual int64_t miss_cost_bytes() {
+        auto* cache = dynamic_cast<ShardedLRUCache*>(_cache.get());
+        size_t element_count = cache == nullptr ? 0 : cache->get_element_count();
+        return element_count == 0 ? 0 : get_usage() / element_count;
+    }
+
     // Subclass can override this method to determine whether to do the minor or full gc
     virtual bool exceed_prune_limit() {
         return _lru_cache_type == LRUCacheType::SIZE ? mem_consumption() > CACHE_MIN_FREE_SIZE
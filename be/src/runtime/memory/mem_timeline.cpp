@@ -0,0 +1,84 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+// This file is copied from
+
+#include "runtime/memory/mem_timeline.h"
+
+#include <fmt/format.h>
+#include <glog/logging.h>
+
+#include <algorithm>
+
+#include "runtime/memory/mem_tracker.h"
+#include "util/pretty_printer.h"
+#include "util/time.h"
+
+namespace doris {
+
+MemTimeline::MemTimeline(const MemTracker* tracker, int64_t interval_ms, size_t max_samples)
+        : _tracker(tracker),
+          _max_samples(std::max<size_t>(max_samples, 2)),
+          _interval_ms(std::max<int64_t>(interval_ms, 1)) {
+    DCHECK(_tracker != nullptr);
+}
+
+void MemTimeline::sample() {
+    sample(MonotonicMillis());
+}
+
+void MemTimeline::sample(int64_t now_ms) {
+    if (now_ms < _next_sample_ms) {
+        return;
+    }
+    _add_sample(now_ms);
+}
+
+void MemTimeline::finish(int64_t now_ms) {
+    if (_start_ms >= 0 && _samples.back().first == now_ms - _start_ms) {
+        _samples.back().second = _tracker->consumption();
+        return;
+    }
+    _add_sample(now_ms);
+}
+
+void MemTimeline::_add_sample(int64_t now_ms) {
+    if (_start_ms < 0) {
+        _start_ms = now_ms;
+    }
+    if (_samples.size() == _max_samples) {
+        // keep the first sample and every other one after it
+        size_t num_kept = 1;
+        for (size_t i = 2; i < _samples.size(); i += 2) {
+            _samples[num_kept++] = _samples[i];
+        }
+        _samples.resize(num_kept);
+        _interval_ms *= 2;
+    }
+    _samples.emplace_back(now_ms - _start_ms, _tracker->consumption());
+    _next_sample_ms = _start_ms + (now_ms - _start_ms) / _interval_ms * _interval_ms + _interval_ms;
+}
+
+std::string MemTimeline::to_string() const {
+    fmt::memory_buffer buf;
+    for (size_t i = 0; i < _samples.size(); ++i) {
+        fmt::format_to(buf, "{}{}ms: {}", i == 0 ? "" : ", ", _samples[i].first,
+                       PrettyPrinter::print_bytes(_samples[i].second));
+    }
+    return fmt::to_string(buf);
+}
+
+} // namespace doris
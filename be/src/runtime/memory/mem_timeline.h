@@ -0,0 +1,65 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+// This file is copied from
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace doris {
+
+class MemTracker;
+
+// A coarse timeline of the consumption of a MemTracker, e.g. the one of an operator, to show
+// in the profile which operator grew when. The consumption is sampled at most once per
+// interval, and when the number of samples reaches the max, every other sample is dropped and
+// the interval is doubled, so the timeline of a long query keeps a bounded size.
+// Not thread-safe, it is sampled by the task which owns the operator.
+class MemTimeline {
+public:
+    MemTimeline(const MemTracker* tracker, int64_t interval_ms, size_t max_samples);
+
+    // Cheap if the interval has not elapsed since the last sample.
+    void sample();
+    void sample(int64_t now_ms);
+
+    // The last sample is always taken, the timeline ends with the consumption at `now_ms`.
+    void finish(int64_t now_ms);
+
+    // e.g. "0ms: 1.00 KB, 1000ms: 64.00 MB, 2000ms: 0"
+    std::string to_string() const;
+
+    const std::vector<std::pair<int64_t, int64_t>>& samples() const { return _samples; }
+
+private:
+    void _add_sample(int64_t now_ms);
+
+    const MemTracker* _tracker = nullptr;
+    const size_t _max_samples;
+    int64_t _interval_ms;
+    int64_t _start_ms = -1;
+    int64_t _next_sample_ms = 0;
+    // pairs of the elapsed ms since the first sample and the consumption
+    std::vector<std::pair<int64_t, int64_t>> _samples;
+};
+
+} // namespace doris
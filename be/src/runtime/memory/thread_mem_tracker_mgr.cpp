@@ -56,6 +56,7 @@ void ThreadMemTrackerMgr::attach_limiter_tracker(
     }
     _limiter_tracker = mem_tracker;
     _limiter_tracker_raw = mem_tracker.get();
+    _consume_threshold = 0;
 }
 
 void ThreadMemTrackerMgr::detach_limiter_tracker(
@@ -68,6 +69,7 @@ void ThreadMemTrackerMgr::detach_limiter_tracker(
     _reserved_mem_stack.pop_back();
     _limiter_tracker = old_mem_tracker;
     _limiter_tracker_raw = old_mem_tracker.get();
+    _consume_threshold = 0;
 }
 
 void ThreadMemTrackerMgr::cancel_query(const std::string& exceed_msg) {
@@ -39,6 +39,8 @@
 namespace doris {
 
 constexpr size_t SYNC_PROC_RESERVED_INTERVAL_BYTES = (1ULL << 20); // 1M
+// The adaptive consume threshold of a thread is at most 1/1024 of the memory headroom.
+constexpr int64_t CONSUME_THRESHOLD_HEADROOM_SHARES = 1024;
 
 // Memory Hook is counted in the memory tracker of the current thread.
 class ThreadMemTrackerMgr {
@@ -134,6 +136,10 @@ private:
     // Cache untracked mem.
     int64_t _untracked_mem = 0;
     int64_t _old_untracked_mem = 0;
+    // Flush the untracked mem when it reaches this size, adapted to the distance of
+    // the limiter tracker and process memory to their limits at every flush.
+    // 0 means config::mem_tracker_consume_min_size_bytes.
+    int64_t _consume_threshold = 0;
 
     int64_t _reserved_mem = 0;
     // SCOPED_ATTACH_TASK cannot be nested, but SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER can continue to be used,
@@ -156,6 +162,8 @@ private:
     bool _stop_consume = false;
     TUniqueId _query_id = TUniqueId();
     bool _is_query_cancelled = false;
+
+    void _update_consume_threshold();
 };
 
 inline bool ThreadMemTrackerMgr::init() {
@@ -232,7 +240,9 @@ inline void ThreadMemTrackerMgr::consume(int64_t size, int skip_large_memory_che
     // and some threads `_untracked_mem <= -config::mem_tracker_consume_min_size_bytes` trigger consumption(),
     // it will cause tracker->consumption to be temporarily less than 0.
     // After the jemalloc hook is loaded, before ExecEnv init, _limiter_tracker=nullptr.
-    if (std::abs(_untracked_mem) >= config::mem_tracker_consume_min_size_bytes && !_stop_consume) {
+    if (std::abs(_untracked_mem) >=
+                std::max<int64_t>(_consume_threshold, config::mem_tracker_consume_min_size_bytes) &&
+        !_stop_consume) {
         flush_untracked_mem();
     }
 
@@ -274,9 +284,29 @@ inline void ThreadMemTrackerMgr::flush_untracked_mem() {
         tracker->consume(_old_untracked_mem);
     }
     _untracked_mem -= _old_untracked_mem;
+    _update_consume_threshold();
     _stop_consume = false;
 }
 
+inline void ThreadMemTrackerMgr::_update_consume_threshold() {
+    const int64_t min_size = config::mem_tracker_consume_min_size_bytes;
+    const int64_t max_size = config::mem_tracker_consume_max_size_bytes;
+    if (max_size <= min_size) {
+        _consume_threshold = 0;
+        return;
+    }
+    int64_t headroom =
+            MemInfo::soft_mem_limit() - GlobalMemoryArbitrator::process_memory_usage();
+    if (_limiter_tracker_raw->has_limit()) {
+        headroom = std::min(headroom,
+                            _limiter_tracker_raw->limit() - _limiter_tracker_raw->consumption());
+    }
+    // Every thread may hide up to the threshold from the trackers, so leave only a small
+    // share of the headroom untracked, and shrink back to min_size near the limits.
+    _consume_threshold = std::clamp(headroom / CONSUME_THRESHOLD_HEADROOM_SHARES, min_size,
+                                    max_size);
+}
+
 inline bool ThreadMemTrackerMgr::try_reserve(int64_t size) {
     DCHECK(_limiter_tracker_raw);
     DCHECK(size >= 0);
@@ -29,6 +29,7 @@
 #include <sstream>
 #include <utility>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "olap/olap_common.h"
 #include "pipeline/dependency.h"
@@ -141,6 +142,13 @@ QueryContext::~QueryContext() {
         _workload_group->remove_query(_query_id);
     }
 
+    if (config::enable_query_storage_read_log) {
+        auto query_statistics = get_query_statistics();
+        if (query_statistics && query_statistics->storage_read().requested_page_bytes > 0) {
+            LOG(INFO) << "Query " << print_id(_query_id) << " storage reads: "
+                      << query_statistics->storage_read().to_string();
+        }
+    }
     _exec_env->runtime_query_statistics_mgr()->set_query_finished(print_id(_query_id));
 
     if (enable_profile()) {
@@ -163,7 +171,8 @@ QueryContext::~QueryContext() {
     //TODO: check if pipeline and tracing both enabled
     if (_is_pipeline && ExecEnv::GetInstance()->pipeline_tracer_context()->enabled()) [[unlikely]] {
         try {
-            ExecEnv::GetInstance()->pipeline_tracer_context()->end_query(_query_id, group_id);
+            ExecEnv::GetInstance()->pipeline_tracer_context()->end_query(
+                    _query_id, group_id, _query_watcher.elapsed_time() / NANOS_PER_MILLIS);
         } catch (std::exception& e) {
             LOG(WARNING) << "Dump trace log failed bacause " << e.what();
         }
@@ -37,6 +37,7 @@
 #include "runtime/runtime_predicate.h"
 #include "util/hash_util.hpp"
 #include "util/threadpool.h"
+#include "util/time.h"
 #include "vec/exec/scan/scanner_scheduler.h"
 #include "vec/runtime/shared_hash_table_controller.h"
 #include "vec/runtime/shared_scanner_controller.h"
@@ -237,6 +238,23 @@ public:
         return _running_big_mem_op_num.load(std::memory_order_relaxed);
     }
 
+    // The memory that the sinks of the running tasks could release by spilling
+    void update_revocable_mem_size(int64_t delta) {
+        _revocable_mem_size.fetch_add(delta, std::memory_order_relaxed);
+    }
+    int64_t revocable_mem_size() const {
+        return _revocable_mem_size.load(std::memory_order_relaxed);
+    }
+
+    // Asked by the memory GC to spill the revocable memory under process memory pressure,
+    // the request expires if it is not renewed by the next memory GC.
+    void request_spill(int64_t expire_time_ms) {
+        _spill_request_expire_time_ms.store(expire_time_ms, std::memory_order_relaxed);
+    }
+    bool is_spill_requested() const {
+        return MonotonicMillis() < _spill_request_expire_time_ms.load(std::memory_order_relaxed);
+    }
+
     void set_weighted_mem(int64_t weighted_limit, int64_t weighted_consumption) {
         std::lock_guard<std::mutex> l(_weighted_mem_lock);
         _weighted_consumption = weighted_consumption;
@@ -274,6 +292,8 @@ private:
     bool _is_pipeline = false;
     bool _is_nereids = false;
     std::atomic<int> _running_big_mem_op_num = 0;
+    std::atomic<int64_t> _revocable_mem_size = 0;
+    std::atomic<int64_t> _spill_request_expire_time_ms = 0;
 
     // A token used to submit olap scanner to the "_limited_scan_thread_pool",
     // This thread pool token is created from "_limited_scan_thread_pool" from exec env.
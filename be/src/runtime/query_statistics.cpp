@@ -17,15 +17,58 @@
 
 #include "runtime/query_statistics.h"
 
+#include <fmt/format.h>
 #include <gen_cpp/data.pb.h>
 #include <glog/logging.h>
 
 #include <memory>
 
+#include "util/pretty_printer.h"
 #include "util/time.h"
 
 namespace doris {
 
+void StorageReadStatistics::merge(const StorageReadStatistics& other) {
+    requested_page_bytes += other.requested_page_bytes.load(std::memory_order_relaxed);
+    page_cache_bytes += other.page_cache_bytes.load(std::memory_order_relaxed);
+    file_cache_bytes += other.file_cache_bytes.load(std::memory_order_relaxed);
+    local_disk_bytes += other.local_disk_bytes.load(std::memory_order_relaxed);
+    remote_bytes += other.remote_bytes.load(std::memory_order_relaxed);
+    decompressed_bytes += other.decompressed_bytes.load(std::memory_order_relaxed);
+    rows_zone_map_filtered += other.rows_zone_map_filtered.load(std::memory_order_relaxed);
+    rows_bloom_filter_filtered += other.rows_bloom_filter_filtered.load(std::memory_order_relaxed);
+    rows_inverted_index_filtered +=
+            other.rows_inverted_index_filtered.load(std::memory_order_relaxed);
+    rows_predicate_filtered += other.rows_predicate_filtered.load(std::memory_order_relaxed);
+}
+
+void StorageReadStatistics::clear() {
+    requested_page_bytes = 0;
+    page_cache_bytes = 0;
+    file_cache_bytes = 0;
+    local_disk_bytes = 0;
+    remote_bytes = 0;
+    decompressed_bytes = 0;
+    rows_zone_map_filtered = 0;
+    rows_bloom_filter_filtered = 0;
+    rows_inverted_index_filtered = 0;
+    rows_predicate_filtered = 0;
+}
+
+std::string StorageReadStatistics::to_string() const {
+    return fmt::format(
+            "RequestedPageBytes={}, PageCacheBytes={}, FileCacheBytes={}, LocalDiskBytes={}, "
+            "RemoteBytes={}, DecompressedBytes={}, RowsZoneMapFiltered={}, "
+            "RowsBloomFilterFiltered={}, RowsInvertedIndexFiltered={}, RowsPredicateFiltered={}",
+            PrettyPrinter::print_bytes(requested_page_bytes),
+            PrettyPrinter::print_bytes(page_cache_bytes),
+            PrettyPrinter::print_bytes(file_cache_bytes),
+            PrettyPrinter::print_bytes(local_disk_bytes), PrettyPrinter::print_bytes(remote_bytes),
+            PrettyPrinter::print_bytes(decompressed_bytes), rows_zone_map_filtered.load(),
+            rows_bloom_filter_filtered.load(), rows_inverted_index_filtered.load(),
+            rows_predicate_filtered.load());
+}
+
 void QueryStatistics::merge(const QueryStatistics& other) {
     scan_rows += other.scan_rows.load(std::memory_order_relaxed);
     scan_bytes += other.scan_bytes.load(std::memory_order_relaxed);
@@ -36,6 +79,7 @@ void QueryStatistics::merge(const QueryStatistics& other) {
             other._scan_bytes_from_local_storage.load(std::memory_order_relaxed);
     _scan_bytes_from_remote_storage +=
             other._scan_bytes_from_remote_storage.load(std::memory_order_relaxed);
+    _storage_read.merge(other._storage_read);
 
     int64_t other_peak_mem = other.max_peak_memory_bytes.load(std::memory_order_relaxed);
     if (other_peak_mem > this->max_peak_memory_bytes) {
@@ -21,9 +21,11 @@
 #include <gen_cpp/PaloInternalService_types.h>
 #include <stdint.h>
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <unordered_map>
 #include <utility>
 
@@ -35,6 +37,27 @@ class QueryStatisticsRecvr;
 class PNodeStatistics;
 class PQueryStatistics;
 
+// Where the bytes read by the storage layer of a query come from, and the rows pruned at each
+// stage, which tell its read amplification. They are kept in the backend, summarized in the
+// profiles of the scan operators and in the log of enable_query_storage_read_log.
+struct StorageReadStatistics {
+    // The on disk bytes of the pages requested by the segment iterators.
+    std::atomic<int64_t> requested_page_bytes = 0;
+    std::atomic<int64_t> page_cache_bytes = 0;
+    std::atomic<int64_t> file_cache_bytes = 0;
+    std::atomic<int64_t> local_disk_bytes = 0;
+    std::atomic<int64_t> remote_bytes = 0;
+    std::atomic<int64_t> decompressed_bytes = 0;
+    std::atomic<int64_t> rows_zone_map_filtered = 0;
+    std::atomic<int64_t> rows_bloom_filter_filtered = 0;
+    std::atomic<int64_t> rows_inverted_index_filtered = 0;
+    std::atomic<int64_t> rows_predicate_filtered = 0;
+
+    void merge(const StorageReadStatistics& other);
+    void clear();
+    std::string to_string() const;
+};
+
 // This is responsible for collecting query statistics, usually it consists of
 // two parts, one is current fragment or plan's statistics, the other is sub fragment
 // or plan's statistics and QueryStatisticsRecvr is responsible for collecting it.
@@ -105,6 +128,7 @@ public:
         shuffle_send_rows.store(0, std::memory_order_relaxed);
         _scan_bytes_from_local_storage.store(0);
         _scan_bytes_from_remote_storage.store(0);
+        _storage_read.clear();
 
         returned_rows = 0;
         max_peak_memory_bytes.store(0, std::memory_order_relaxed);
@@ -124,6 +148,7 @@ public:
     int64_t get_current_used_memory_bytes() {
         return current_used_memory_bytes.load(std::memory_order_relaxed);
     }
+    StorageReadStatistics& storage_read() { return _storage_read; }
 
 private:
     friend class QueryStatisticsRecvr;
@@ -143,6 +168,8 @@ private:
 
     std::atomic<int64_t> shuffle_send_bytes;
     std::atomic<int64_t> shuffle_send_rows;
+
+    StorageReadStatistics _storage_read;
 };
 using QueryStatisticsPtr = std::shared_ptr<QueryStatistics>;
 // It is used for collecting sub plan query statistics in DataStreamRecvr.
@@ -23,6 +23,7 @@
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "common/logging.h"
 #include "librdkafka/rdkafkacpp.h"
@@ -32,6 +33,9 @@
 
 namespace doris {
 
+// The messages taken from the queue of the consumers at a time.
+static constexpr size_t MAX_MSGS_PER_GET = 64;
+
 Status KafkaDataConsumerGroup::assign_topic_partitions(std::shared_ptr<StreamLoadContext> ctx) {
     DCHECK(ctx->kafka_info);
     DCHECK(_consumers.size() >= 1);
@@ -155,31 +159,42 @@ Status KafkaDataConsumerGroup::start_all(std::shared_ptr<StreamLoadContext> ctx,
             return Status::OK();
         }
 
-        RdKafka::Message* msg;
-        bool res = _queue.blocking_get(&msg);
+        // Drain the messages of all consumers in one lock, which otherwise serializes the
+        // consumers on the queue when the messages are small.
+        std::vector<RdKafka::Message*> msgs;
+        bool res = _queue.blocking_get_batch(&msgs, MAX_MSGS_PER_GET);
         if (res) {
-            // conf has to be deleted finally
-            Defer delete_msg {[msg]() { delete msg; }};
-            VLOG_NOTICE << "get kafka message"
-                        << ", partition: " << msg->partition() << ", offset: " << msg->offset()
-                        << ", len: " << msg->len();
-
-            Status st = (kafka_pipe.get()->*append_data)(static_cast<const char*>(msg->payload()),
-                                                         static_cast<size_t>(msg->len()));
-            if (st.ok()) {
-                left_rows--;
-                left_bytes -= msg->len();
-                cmt_offset[msg->partition()] = msg->offset();
-                VLOG_NOTICE << "consume partition[" << msg->partition() << " - " << msg->offset()
-                            << "]";
-            } else {
-                // failed to append this msg, we must stop
-                LOG(WARNING) << "failed to append msg to pipe. grp: " << _grp_id;
-                eos = true;
-                {
-                    std::unique_lock<std::mutex> lock(_mutex);
-                    if (result_st.ok()) {
-                        result_st = st;
+            // conf has to be deleted finally, including the msgs left after the batch is done
+            Defer delete_msgs {[&msgs]() {
+                for (auto* msg : msgs) {
+                    delete msg;
+                }
+            }};
+            for (auto* msg : msgs) {
+                if (eos || left_rows <= 0 || left_bytes <= 0) {
+                    break;
+                }
+                VLOG_NOTICE << "get kafka message"
+                            << ", partition: " << msg->partition() << ", offset: " << msg->offset()
+                            << ", len: " << msg->len();
+
+                Status st = (kafka_pipe.get()->*append_data)(
+                        static_cast<const char*>(msg->payload()), static_cast<size_t>(msg->len()));
+                if (st.ok()) {
+                    left_rows--;
+                    left_bytes -= msg->len();
+                    cmt_offset[msg->partition()] = msg->offset();
+                    VLOG_NOTICE << "consume partition[" << msg->partition() << " - "
+                                << msg->offset() << "]";
+                } else {
+                    // failed to append this msg, we must stop
+                    LOG(WARNING) << "failed to append msg to pipe. grp: " << _grp_id;
+                    eos = true;
+                    {
+                        std::unique_lock<std::mutex> lock(_mutex);
+                        if (result_st.ok()) {
+                            result_st = st;
+                        }
                     }
                 }
             }
@@ -376,6 +376,7 @@ Status RuntimeFilterMergeControllerEntity::merge(const PMergeFilterRequest* requ
     std::shared_ptr<RuntimeFilterCntlVal> cnt_val;
     int merged_size = 0;
     int64_t merge_time = 0;
+    bool publish = false;
     int64_t start_merge = MonotonicMillis();
     auto filter_id = request->filter_id();
     std::map<int, CntlValwithLock>::iterator iter;
@@ -389,17 +390,29 @@ Status RuntimeFilterMergeControllerEntity::merge(const PMergeFilterRequest* requ
         }
     }
     cnt_val = iter->second.cnt_val;
+    auto skip_merge = [&]() {
+        // Skip the other broadcast join runtime filter, and the filters arriving after an
+        // ignored filter is published
+        return (cnt_val->arrive_id.size() == 1 && cnt_val->runtime_filter_desc.is_broadcast_join) ||
+               cnt_val->published;
+    };
     {
         std::lock_guard<std::mutex> l(*iter->second.mutex);
-        // Skip the other broadcast join runtime filter
-        if (cnt_val->arrive_id.size() == 1 && cnt_val->runtime_filter_desc.is_broadcast_join) {
+        if (skip_merge()) {
+            return Status::OK();
+        }
+    }
+    // Deserialize the filter out of the lock, so the big filters of many producers arriving
+    // at the same time only wait for each other while they are OR-merged.
+    MergeRuntimeFilterParams params(request, attach_data);
+    RuntimeFilterWrapperHolder holder;
+    RETURN_IF_ERROR(
+            IRuntimeFilter::create_wrapper(&params, cnt_val->pool.get(), holder.getHandle()));
+    {
+        std::lock_guard<std::mutex> l(*iter->second.mutex);
+        if (skip_merge()) {
             return Status::OK();
         }
-        MergeRuntimeFilterParams params(request, attach_data);
-        ObjectPool* pool = cnt_val->pool.get();
-        RuntimeFilterWrapperHolder holder;
-        RETURN_IF_ERROR(IRuntimeFilter::create_wrapper(&params, pool, holder.getHandle()));
-
         auto st = cnt_val->filter->merge_from(holder.getHandle()->get());
         if (!st) {
             // prevent error ignored
@@ -414,9 +427,14 @@ Status RuntimeFilterMergeControllerEntity::merge(const PMergeFilterRequest* requ
         DCHECK_LE(merged_size, cnt_val->producer_size);
         cnt_val->merge_time += (MonotonicMillis() - start_merge);
         merge_time = cnt_val->merge_time;
+        // An ignored filter passes all rows whatever the other producers send, so it is
+        // published at once rather than after the slowest producer.
+        cnt_val->published =
+                merged_size == cnt_val->producer_size || cnt_val->filter->get_ignored();
+        publish = cnt_val->published;
     }
 
-    if (merged_size == cnt_val->producer_size) {
+    if (publish) {
         DCHECK_GT(cnt_val->targetv2_info.size(), 0);
 
         butil::IOBuf request_attachment;
@@ -176,6 +176,8 @@ public:
         std::unordered_set<UniqueId> arrive_id;
         std::vector<PNetworkAddress> source_addrs;
         std::shared_ptr<ObjectPool> pool;
+        // the merged filter has been sent to the targets
+        bool published = false;
     };
 
 private:
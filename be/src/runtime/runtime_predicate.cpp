@@ -17,6 +17,8 @@
 
 #include "runtime/runtime_predicate.h"
 
+#include <algorithm>
+#include <cstring>
 #include <memory>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
@@ -35,15 +37,15 @@ RuntimePredicate::RuntimePredicate(const TTopnFilterDesc& desc)
         _contexts[p.first].expr = p.second;
     }
 
-    PrimitiveType type = thrift_to_type(desc.target_node_id_to_target_expr.begin()
-                                                ->second.nodes[0]
-                                                .type.types[0]
-                                                .scalar_type.type);
-    if (!_init(type)) {
+    _type = thrift_to_type(desc.target_node_id_to_target_expr.begin()
+                                   ->second.nodes[0]
+                                   .type.types[0]
+                                   .scalar_type.type);
+    if (!_init(_type)) {
         std::stringstream ss;
         desc.target_node_id_to_target_expr.begin()->second.nodes[0].printTo(ss);
-        throw Exception(ErrorCode::INTERNAL_ERROR, "meet invalid type, type={}, expr={}", int(type),
-                        ss.str());
+        throw Exception(ErrorCode::INTERNAL_ERROR, "meet invalid type, type={}, expr={}",
+                        int(_type), ss.str());
     }
 
     // For ASC  sort, create runtime predicate col_name <= max_top_value
@@ -62,10 +64,58 @@ void RuntimePredicate::init_target(
         _contexts[target_node_id].col_name =
                 slot_id_to_slot_desc[get_texpr(target_node_id).nodes[0].slot_ref.slot_id]
                         ->col_name();
+    } else {
+        _init_truncated_slot(_contexts[target_node_id], slot_id_to_slot_desc);
     }
     _detected_target = true;
 }
 
+static std::optional<TimeUnit> parse_trunc_unit(std::string unit) {
+    // the same prefixes as date_trunc
+    std::transform(unit.begin(), unit.end(), unit.begin(),
+                   [](unsigned char c) { return std::tolower(c); });
+    static const std::vector<std::pair<std::string, TimeUnit>> units = {
+            {"year", TimeUnit::YEAR},     {"quarter", TimeUnit::QUARTER},
+            {"month", TimeUnit::MONTH},   {"week", TimeUnit::WEEK},
+            {"day", TimeUnit::DAY},       {"hour", TimeUnit::HOUR},
+            {"minute", TimeUnit::MINUTE}, {"second", TimeUnit::SECOND}};
+    for (const auto& [name, time_unit] : units) {
+        if (std::strncmp(name.data(), unit.data(), name.size()) == 0) {
+            return time_unit;
+        }
+    }
+    return std::nullopt;
+}
+
+void RuntimePredicate::_init_truncated_slot(
+        TargetContext& ctx, phmap::flat_hash_map<int, SlotDescriptor*>& slot_id_to_slot_desc) {
+    // date_trunc(slot, 'unit') is flattened as [date_trunc, slot, 'unit']
+    const auto& nodes = ctx.expr.nodes;
+    if (_type != TYPE_DATEV2 && _type != TYPE_DATETIMEV2) {
+        return;
+    }
+    if (nodes.size() != 3 || nodes[0].node_type != TExprNodeType::FUNCTION_CALL ||
+        nodes[0].fn.name.function_name != "date_trunc" ||
+        nodes[1].node_type != TExprNodeType::SLOT_REF ||
+        nodes[2].node_type != TExprNodeType::STRING_LITERAL) {
+        return;
+    }
+    auto* slot_desc = slot_id_to_slot_desc[nodes[1].slot_ref.slot_id];
+    if (slot_desc == nullptr) {
+        return;
+    }
+    auto unit = parse_trunc_unit(nodes[2].string_literal.value);
+    if (!unit.has_value()) {
+        return;
+    }
+    // date_trunc(date, 'hour') is the date itself
+    if (_type == TYPE_DATEV2 && unit.value() < TimeUnit::DAY) {
+        unit = TimeUnit::DAY;
+    }
+    ctx.col_name = slot_desc->col_name();
+    ctx.trunc_unit = unit;
+}
+
 template <PrimitiveType type>
 std::string get_normal_value(const Field& field) {
     using ValueType = typename PrimitiveTypeTraits<type>::CppType;
@@ -109,6 +159,46 @@ std::string get_decimal_value(const Field& field) {
     return cast_to_string<type, ValueType>(v.get_value(), v.get_scale());
 }
 
+template <PrimitiveType type>
+bool get_trunc_upper_bound(const Field& field, TimeUnit unit, std::string* bound) {
+    using ValueType = typename PrimitiveTypeTraits<type>::CppType;
+    ValueType value = field.get<ValueType>();
+    bool ok = false;
+    switch (unit) {
+    case TimeUnit::YEAR:
+        ok = value.template date_add_interval<TimeUnit::YEAR>(TimeInterval(unit, 1, false));
+        break;
+    case TimeUnit::QUARTER:
+        ok = value.template date_add_interval<TimeUnit::MONTH>(
+                TimeInterval(TimeUnit::MONTH, 3, false));
+        break;
+    case TimeUnit::MONTH:
+        ok = value.template date_add_interval<TimeUnit::MONTH>(TimeInterval(unit, 1, false));
+        break;
+    case TimeUnit::WEEK:
+        ok = value.template date_add_interval<TimeUnit::WEEK>(TimeInterval(unit, 1, false));
+        break;
+    case TimeUnit::DAY:
+        ok = value.template date_add_interval<TimeUnit::DAY>(TimeInterval(unit, 1, false));
+        break;
+    case TimeUnit::HOUR:
+        ok = value.template date_add_interval<TimeUnit::HOUR>(TimeInterval(unit, 1, false));
+        break;
+    case TimeUnit::MINUTE:
+        ok = value.template date_add_interval<TimeUnit::MINUTE>(TimeInterval(unit, 1, false));
+        break;
+    case TimeUnit::SECOND:
+        ok = value.template date_add_interval<TimeUnit::SECOND>(TimeInterval(unit, 1, false));
+        break;
+    default:
+        break;
+    }
+    if (ok) {
+        *bound = cast_to_string<type, ValueType>(value, 0);
+    }
+    return ok;
+}
+
 bool RuntimePredicate::_init(PrimitiveType type) {
     // set get value function
     switch (type) {
@@ -223,9 +313,10 @@ Status RuntimePredicate::update(const Field& value) {
         if (!ctx.tablet_schema) {
             continue;
         }
-        std::unique_ptr<ColumnPredicate> pred {_pred_constructor(
-                ctx.tablet_schema->column(ctx.col_name), ctx.predicate->column_id(),
-                _get_value_fn(_orderby_extrem), false, &_predicate_arena)};
+        std::unique_ptr<ColumnPredicate> pred {_create_predicate(ctx)};
+        if (pred == nullptr) {
+            continue;
+        }
 
         // For NULLS FIRST, wrap a AcceptNullPredicate to return true for NULL
         // since ORDER BY ASC/DESC should get NULL first but pred returns NULL
@@ -239,4 +330,26 @@ Status RuntimePredicate::update(const Field& value) {
     return Status::OK();
 }
 
+ColumnPredicate* RuntimePredicate::_create_predicate(const TargetContext& ctx) {
+    const auto& column = ctx.tablet_schema->column(ctx.col_name);
+    auto column_id = ctx.predicate->column_id();
+    // date_trunc(col) <= col, so date_trunc(col) >= value means col >= value
+    if (!ctx.trunc_unit.has_value() || !_is_asc) {
+        return _pred_constructor(column, column_id, _get_value_fn(_orderby_extrem), false,
+                                 &_predicate_arena);
+    }
+    // the value is truncated, so date_trunc(col) <= value means col < value + 1 unit
+    std::string bound;
+    bool ok = _type == TYPE_DATEV2
+                      ? get_trunc_upper_bound<TYPE_DATEV2>(_orderby_extrem,
+                                                           ctx.trunc_unit.value(), &bound)
+                      : get_trunc_upper_bound<TYPE_DATETIMEV2>(_orderby_extrem,
+                                                               ctx.trunc_unit.value(), &bound);
+    if (!ok) {
+        return nullptr;
+    }
+    return create_comparison_predicate<PredicateType::LT>(column, column_id, bound, false,
+                                                          &_predicate_arena);
+}
+
 } // namespace doris::vectorized
@@ -20,6 +20,7 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <shared_mutex>
 #include <string>
 
@@ -103,6 +104,13 @@ public:
         return _contexts.find(target_node_id)->second.target_is_slot();
     }
 
+    // The target is date_trunc(slot, unit), the storage can prune the slot by a bound derived
+    // from the value of the target, while the target itself is still filtered by the conjunct.
+    bool target_is_truncated_slot(int32_t target_node_id) const {
+        check_target_node_id(target_node_id);
+        return _contexts.find(target_node_id)->second.trunc_unit.has_value();
+    }
+
     const TExpr& get_texpr(int32_t target_node_id) const {
         check_target_node_id(target_node_id);
         return _contexts.find(target_node_id)->second.expr;
@@ -130,6 +138,8 @@ private:
         std::string col_name;
         TabletSchemaSPtr tablet_schema;
         std::shared_ptr<ColumnPredicate> predicate;
+        // the unit of date_trunc if the target is date_trunc(col_name, unit)
+        std::optional<TimeUnit> trunc_unit;
 
         int32_t get_field_index() {
             return tablet_schema->field_index(tablet_schema->column(col_name).unique_id());
@@ -140,10 +150,16 @@ private:
 
     bool _init(PrimitiveType type);
 
+    void _init_truncated_slot(TargetContext& ctx,
+                              phmap::flat_hash_map<int, SlotDescriptor*>& slot_id_to_slot_desc);
+
+    ColumnPredicate* _create_predicate(const TargetContext& ctx);
+
     mutable std::shared_mutex _rwlock;
 
     bool _nulls_first;
     bool _is_asc;
+    PrimitiveType _type;
     std::map<int32_t, TargetContext> _contexts;
 
     Field _orderby_extrem {Field::Types::Null};
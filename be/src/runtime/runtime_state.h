@@ -383,6 +383,8 @@ public:
                 return segment_v2::CompressionTypePB::LZ4;
             } else if (_query_options.fragment_transmission_compression_codec == "snappy") {
                 return segment_v2::CompressionTypePB::SNAPPY;
+            } else if (_query_options.fragment_transmission_compression_codec == "zstd") {
+                return segment_v2::CompressionTypePB::ZSTD;
             } else {
                 return segment_v2::CompressionTypePB::NO_COMPRESSION;
             }
@@ -390,6 +392,12 @@ public:
         return segment_v2::CompressionTypePB::NO_COMPRESSION;
     }
 
+    // Each exchange channel chooses the codec of every block by itself, see AdaptiveCompression.
+    bool fragment_transmission_compression_adaptive() const {
+        return _query_options.__isset.fragment_transmission_compression_codec &&
+               _query_options.fragment_transmission_compression_codec == "adaptive";
+    }
+
     bool skip_storage_engine_merge() const {
         return _query_options.__isset.skip_storage_engine_merge &&
                _query_options.skip_storage_engine_merge;
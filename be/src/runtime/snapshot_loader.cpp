@@ -28,12 +28,15 @@
 #include <gen_cpp/Types_types.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <filesystem>
 #include <istream>
+#include <mutex>
 #include <unordered_map>
 #include <utility>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "gutil/strings/split.h"
 #include "http/http_client.h"
@@ -54,6 +57,7 @@
 #include "runtime/exec_env.h"
 #include "util/s3_uri.h"
 #include "util/s3_util.h"
+#include "util/threadpool.h"
 #include "util/thrift_rpc_helper.h"
 
 namespace doris {
@@ -139,74 +143,35 @@ Status SnapshotLoader::upload(const std::map<std::string, std::string>& src_to_d
     // 2. for each src path, upload it to remote storage
     // we report to frontend for every 10 files, and we will cancel the job if
     // the job has already been cancelled in frontend.
-    int report_counter = 0;
-    int total_num = src_to_dest_path.size();
-    int finished_num = 0;
-    for (const auto& iter : src_to_dest_path) {
-        const std::string& src_path = iter.first;
-        const std::string& dest_path = iter.second;
-
-        int64_t tablet_id = 0;
+    std::vector<std::pair<std::string, std::string>> paths(src_to_dest_path.begin(),
+                                                           src_to_dest_path.end());
+    std::vector<int64_t> tablet_ids(paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
         int32_t schema_hash = 0;
-        RETURN_IF_ERROR(
-                _get_tablet_id_and_schema_hash_from_file_path(src_path, &tablet_id, &schema_hash));
-
-        // 2.1 get existing files from remote path
-        std::map<std::string, FileStat> remote_files;
-        RETURN_IF_ERROR(_list_with_checksum(dest_path, &remote_files));
-
-        for (auto& tmp : remote_files) {
-            VLOG_CRITICAL << "get remote file: " << tmp.first << ", checksum: " << tmp.second.md5;
-        }
-
-        // 2.2 list local files
-        std::vector<std::string> local_files;
-        std::vector<std::string> local_files_with_checksum;
-        RETURN_IF_ERROR(_get_existing_files_from_local(src_path, &local_files));
-
-        // 2.3 iterate local files
-        for (auto& local_file : local_files) {
-            RETURN_IF_ERROR(_report_every(10, &report_counter, finished_num, total_num,
-                                          TTaskType::type::UPLOAD));
-
-            // calc md5sum of localfile
-            std::string md5sum;
-            RETURN_IF_ERROR(
-                    io::global_local_filesystem()->md5sum(src_path + "/" + local_file, &md5sum));
-            VLOG_CRITICAL << "get file checksum: " << local_file << ": " << md5sum;
-            local_files_with_checksum.push_back(local_file + "." + md5sum);
-
-            // check if this local file need upload
-            bool need_upload = false;
-            auto find = remote_files.find(local_file);
-            if (find != remote_files.end()) {
-                if (md5sum != find->second.md5) {
-                    // remote storage file exist, but with different checksum
-                    LOG(WARNING) << "remote file checksum is invalid. remote: " << find->first
-                                 << ", local: " << md5sum;
-                    // TODO(cmy): save these files and delete them later
-                    need_upload = true;
-                }
-            } else {
-                need_upload = true;
-            }
-
-            if (!need_upload) {
-                VLOG_CRITICAL << "file exist in remote path, no need to upload: " << local_file;
-                continue;
-            }
-
-            // upload
-            std::string remote_path = dest_path + '/' + local_file;
-            std::string local_path = src_path + '/' + local_file;
-            RETURN_IF_ERROR(upload_with_checksum(*_remote_fs, local_path, remote_path, md5sum));
-        } // end for each tablet's local files
-
-        tablet_files->emplace(tablet_id, local_files_with_checksum);
+        RETURN_IF_ERROR(_get_tablet_id_and_schema_hash_from_file_path(
+                paths[i].first, &tablet_ids[i], &schema_hash));
+    }
+    std::vector<std::vector<std::string>> files(paths.size());
+    std::mutex report_lock;
+    int report_counter = 0;
+    int total_num = paths.size();
+    std::atomic<int> finished_num = 0;
+    auto report = [&]() {
+        std::lock_guard lock(report_lock);
+        return _report_every(10, &report_counter, finished_num, total_num,
+                             TTaskType::type::UPLOAD);
+    };
+    RETURN_IF_ERROR(_run_concurrently(paths.size(), [&](size_t i) {
+        const auto& [src_path, dest_path] = paths[i];
+        RETURN_IF_ERROR(_upload_tablet(src_path, dest_path, report, &files[i]));
         finished_num++;
         LOG(INFO) << "finished to write tablet to remote. local path: " << src_path
                   << ", remote path: " << dest_path;
-    } // end for each tablet path
+        return Status::OK();
+    }));
+    for (size_t i = 0; i < paths.size(); ++i) {
+        tablet_files->emplace(tablet_ids[i], std::move(files[i]));
+    }
 
     LOG(INFO) << "finished to upload snapshots. job: " << _job_id << ", task id: " << _task_id;
     return status;
@@ -235,160 +200,30 @@ Status SnapshotLoader::download(const std::map<std::string, std::string>& src_to
     RETURN_IF_ERROR(_check_local_snapshot_paths(src_to_dest_path, false));
 
     // 2. for each src path, download it to local storage
-    int report_counter = 0;
-    int total_num = src_to_dest_path.size();
-    int finished_num = 0;
-    for (const auto& iter : src_to_dest_path) {
-        const std::string& remote_path = iter.first;
-        const std::string& local_path = iter.second;
-
+    std::vector<std::pair<std::string, std::string>> paths(src_to_dest_path.begin(),
+                                                           src_to_dest_path.end());
+    for (const auto& [remote_path, local_path] : paths) {
         int64_t local_tablet_id = 0;
         int32_t schema_hash = 0;
         RETURN_IF_ERROR(_get_tablet_id_and_schema_hash_from_file_path(local_path, &local_tablet_id,
                                                                       &schema_hash));
         downloaded_tablet_ids->push_back(local_tablet_id);
-
-        int64_t remote_tablet_id;
-        RETURN_IF_ERROR(_get_tablet_id_from_remote_path(remote_path, &remote_tablet_id));
-        VLOG_CRITICAL << "get local tablet id: " << local_tablet_id
-                      << ", schema hash: " << schema_hash
-                      << ", remote tablet id: " << remote_tablet_id;
-
-        // 2.1. get local files
-        std::vector<std::string> local_files;
-        RETURN_IF_ERROR(_get_existing_files_from_local(local_path, &local_files));
-
-        // 2.2. get remote files
-        std::map<std::string, FileStat> remote_files;
-        RETURN_IF_ERROR(_list_with_checksum(remote_path, &remote_files));
-        if (remote_files.empty()) {
-            std::stringstream ss;
-            ss << "get nothing from remote path: " << remote_path;
-            LOG(WARNING) << ss.str();
-            return Status::InternalError(ss.str());
-        }
-
-        TabletSharedPtr tablet = _engine.tablet_manager()->get_tablet(local_tablet_id);
-        if (tablet == nullptr) {
-            std::stringstream ss;
-            ss << "failed to get local tablet: " << local_tablet_id;
-            LOG(WARNING) << ss.str();
-            return Status::InternalError(ss.str());
-        }
-        DataDir* data_dir = tablet->data_dir();
-
-        for (auto& iter : remote_files) {
-            RETURN_IF_ERROR(_report_every(10, &report_counter, finished_num, total_num,
-                                          TTaskType::type::DOWNLOAD));
-
-            bool need_download = false;
-            const std::string& remote_file = iter.first;
-            const FileStat& file_stat = iter.second;
-            auto find = std::find(local_files.begin(), local_files.end(), remote_file);
-            if (find == local_files.end()) {
-                // remote file does not exist in local, download it
-                need_download = true;
-            } else {
-                if (_end_with(remote_file, ".hdr")) {
-                    // this is a header file, download it.
-                    need_download = true;
-                } else {
-                    // check checksum
-                    std::string local_md5sum;
-                    Status st = io::global_local_filesystem()->md5sum(
-                            local_path + "/" + remote_file, &local_md5sum);
-                    if (!st.ok()) {
-                        LOG(WARNING) << "failed to get md5sum of local file: " << remote_file
-                                     << ". msg: " << st << ". download it";
-                        need_download = true;
-                    } else {
-                        VLOG_CRITICAL << "get local file checksum: " << remote_file << ": "
-                                      << local_md5sum;
-                        if (file_stat.md5 != local_md5sum) {
-                            // file's checksum does not equal, download it.
-                            need_download = true;
-                        }
-                    }
-                }
-            }
-
-            if (!need_download) {
-                LOG(INFO) << "remote file already exist in local, no need to download."
-                          << ", file: " << remote_file;
-                continue;
-            }
-
-            // begin to download
-            std::string full_remote_file = remote_path + "/" + remote_file + "." + file_stat.md5;
-            std::string local_file_name;
-            // we need to replace the tablet_id in remote file name with local tablet id
-            RETURN_IF_ERROR(_replace_tablet_id(remote_file, local_tablet_id, &local_file_name));
-            std::string full_local_file = local_path + "/" + local_file_name;
-            LOG(INFO) << "begin to download from " << full_remote_file << " to " << full_local_file;
-            size_t file_len = file_stat.size;
-
-            // check disk capacity
-            if (data_dir->reach_capacity_limit(file_len)) {
-                return Status::Error<ErrorCode::EXCEEDED_LIMIT>(
-                        "reach the capacity limit of path {}, file_size={}", data_dir->path(),
-                        file_len);
-            }
-            // remove file which will be downloaded now.
-            // this file will be added to local_files if it be downloaded successfully.
-            if (find != local_files.end()) {
-                local_files.erase(find);
-            }
-            RETURN_IF_ERROR(_remote_fs->download(full_remote_file, full_local_file));
-
-            // 3. check md5 of the downloaded file
-            std::string downloaded_md5sum;
-            RETURN_IF_ERROR(
-                    io::global_local_filesystem()->md5sum(full_local_file, &downloaded_md5sum));
-            VLOG_CRITICAL << "get downloaded file checksum: " << full_local_file << ": "
-                          << downloaded_md5sum;
-            if (downloaded_md5sum != file_stat.md5) {
-                std::stringstream ss;
-                ss << "invalid md5 of downloaded file: " << full_local_file
-                   << ", expected: " << file_stat.md5 << ", get: " << downloaded_md5sum;
-                LOG(WARNING) << ss.str();
-                return Status::InternalError(ss.str());
-            }
-
-            // local_files always keep the updated local files
-            local_files.push_back(local_file_name);
-            LOG(INFO) << "finished to download file via broker. file: " << full_local_file
-                      << ", length: " << file_len;
-        } // end for all remote files
-
-        // finally, delete local files which are not in remote
-        for (const auto& local_file : local_files) {
-            // replace the tablet id in local file name with the remote tablet id,
-            // in order to compare the file name.
-            std::string new_name;
-            Status st = _replace_tablet_id(local_file, remote_tablet_id, &new_name);
-            if (!st.ok()) {
-                LOG(WARNING) << "failed to replace tablet id. unknown local file: " << st
-                             << ". ignore it";
-                continue;
-            }
-            VLOG_CRITICAL << "new file name after replace tablet id: " << new_name;
-            const auto& find = remote_files.find(new_name);
-            if (find != remote_files.end()) {
-                continue;
-            }
-
-            // delete
-            std::string full_local_file = local_path + "/" + local_file;
-            VLOG_CRITICAL << "begin to delete local snapshot file: " << full_local_file
-                          << ", it does not exist in remote";
-            if (remove(full_local_file.c_str()) != 0) {
-                LOG(WARNING) << "failed to delete unknown local file: " << full_local_file
-                             << ", ignore it";
-            }
-        }
-
+    }
+    std::mutex report_lock;
+    int report_counter = 0;
+    int total_num = paths.size();
+    std::atomic<int> finished_num = 0;
+    auto report = [&]() {
+        std::lock_guard lock(report_lock);
+        return _report_every(10, &report_counter, finished_num, total_num,
+                             TTaskType::type::DOWNLOAD);
+    };
+    RETURN_IF_ERROR(_run_concurrently(paths.size(), [&](size_t i) {
+        RETURN_IF_ERROR(_download_tablet(paths[i].first, paths[i].second,
+                                         (*downloaded_tablet_ids)[i], report));
         finished_num++;
-    } // end for src_to_dest_path
+        return Status::OK();
+    }));
 
     LOG(INFO) << "finished to download snapshots. job: " << _job_id << ", task id: " << _task_id;
     return status;
@@ -893,6 +728,243 @@ Status SnapshotLoader::_get_tablet_id_from_remote_path(const std::string& remote
     return Status::OK();
 }
 
+Status SnapshotLoader::_upload_tablet(const std::string& src_path, const std::string& dest_path,
+                                      const std::function<Status()>& report,
+                                      std::vector<std::string>* local_files_with_checksum) {
+    // 2.1 get existing files from remote path
+    std::map<std::string, FileStat> remote_files;
+    RETURN_IF_ERROR(_list_with_checksum(dest_path, &remote_files));
+
+    for (auto& tmp : remote_files) {
+        VLOG_CRITICAL << "get remote file: " << tmp.first << ", checksum: " << tmp.second.md5;
+    }
+
+    // 2.2 list local files
+    std::vector<std::string> local_files;
+    RETURN_IF_ERROR(_get_existing_files_from_local(src_path, &local_files));
+
+    // 2.3 iterate local files
+    for (auto& local_file : local_files) {
+        RETURN_IF_ERROR(report());
+
+        // calc md5sum of localfile
+        std::string md5sum;
+        RETURN_IF_ERROR(
+                io::global_local_filesystem()->md5sum(src_path + "/" + local_file, &md5sum));
+        VLOG_CRITICAL << "get file checksum: " << local_file << ": " << md5sum;
+        local_files_with_checksum->push_back(local_file + "." + md5sum);
+
+        // check if this local file need upload
+        bool need_upload = false;
+        auto find = remote_files.find(local_file);
+        if (find != remote_files.end()) {
+            if (md5sum != find->second.md5) {
+                // remote storage file exist, but with different checksum
+                LOG(WARNING) << "remote file checksum is invalid. remote: " << find->first
+                             << ", local: " << md5sum;
+                // TODO(cmy): save these files and delete them later
+                need_upload = true;
+            }
+        } else {
+            need_upload = true;
+        }
+
+        if (!need_upload) {
+            VLOG_CRITICAL << "file exist in remote path, no need to upload: " << local_file;
+            continue;
+        }
+
+        // upload
+        std::string remote_path = dest_path + '/' + local_file;
+        std::string local_path = src_path + '/' + local_file;
+        RETURN_IF_ERROR(upload_with_checksum(*_remote_fs, local_path, remote_path, md5sum));
+    } // end for each tablet's local files
+    return Status::OK();
+}
+
+Status SnapshotLoader::_download_tablet(const std::string& remote_path,
+                                        const std::string& local_path, int64_t local_tablet_id,
+                                        const std::function<Status()>& report) {
+    int64_t remote_tablet_id;
+    RETURN_IF_ERROR(_get_tablet_id_from_remote_path(remote_path, &remote_tablet_id));
+    VLOG_CRITICAL << "get local tablet id: " << local_tablet_id
+                  << ", remote tablet id: " << remote_tablet_id;
+
+    // 2.1. get local files
+    std::vector<std::string> local_files;
+    RETURN_IF_ERROR(_get_existing_files_from_local(local_path, &local_files));
+
+    // 2.2. get remote files
+    std::map<std::string, FileStat> remote_files;
+    RETURN_IF_ERROR(_list_with_checksum(remote_path, &remote_files));
+    if (remote_files.empty()) {
+        std::stringstream ss;
+        ss << "get nothing from remote path: " << remote_path;
+        LOG(WARNING) << ss.str();
+        return Status::InternalError(ss.str());
+    }
+
+    TabletSharedPtr tablet = _engine.tablet_manager()->get_tablet(local_tablet_id);
+    if (tablet == nullptr) {
+        std::stringstream ss;
+        ss << "failed to get local tablet: " << local_tablet_id;
+        LOG(WARNING) << ss.str();
+        return Status::InternalError(ss.str());
+    }
+    DataDir* data_dir = tablet->data_dir();
+
+    for (auto& iter : remote_files) {
+        RETURN_IF_ERROR(report());
+
+        bool need_download = false;
+        const std::string& remote_file = iter.first;
+        const FileStat& file_stat = iter.second;
+        auto find = std::find(local_files.begin(), local_files.end(), remote_file);
+        if (find == local_files.end()) {
+            // remote file does not exist in local, download it
+            need_download = true;
+        } else {
+            if (_end_with(remote_file, ".hdr")) {
+                // this is a header file, download it.
+                need_download = true;
+            } else {
+                // check checksum
+                std::string local_md5sum;
+                Status st = io::global_local_filesystem()->md5sum(
+                        local_path + "/" + remote_file, &local_md5sum);
+                if (!st.ok()) {
+                    LOG(WARNING) << "failed to get md5sum of local file: " << remote_file
+                                 << ". msg: " << st << ". download it";
+                    need_download = true;
+                } else {
+                    VLOG_CRITICAL << "get local file checksum: " << remote_file << ": "
+                                  << local_md5sum;
+                    if (file_stat.md5 != local_md5sum) {
+                        // file's checksum does not equal, download it.
+                        need_download = true;
+                    }
+                }
+            }
+        }
+
+        if (!need_download) {
+            LOG(INFO) << "remote file already exist in local, no need to download."
+                      << ", file: " << remote_file;
+            continue;
+        }
+
+        // begin to download
+        std::string full_remote_file = remote_path + "/" + remote_file + "." + file_stat.md5;
+        std::string local_file_name;
+        // we need to replace the tablet_id in remote file name with local tablet id
+        RETURN_IF_ERROR(_replace_tablet_id(remote_file, local_tablet_id, &local_file_name));
+        std::string full_local_file = local_path + "/" + local_file_name;
+        LOG(INFO) << "begin to download from " << full_remote_file << " to " << full_local_file;
+        size_t file_len = file_stat.size;
+
+        // check disk capacity
+        if (data_dir->reach_capacity_limit(file_len)) {
+            return Status::Error<ErrorCode::EXCEEDED_LIMIT>(
+                    "reach the capacity limit of path {}, file_size={}", data_dir->path(),
+                    file_len);
+        }
+        // remove file which will be downloaded now.
+        // this file will be added to local_files if it be downloaded successfully.
+        if (find != local_files.end()) {
+            local_files.erase(find);
+        }
+        RETURN_IF_ERROR(_remote_fs->download(full_remote_file, full_local_file));
+
+        // 3. check md5 of the downloaded file
+        std::string downloaded_md5sum;
+        RETURN_IF_ERROR(
+                io::global_local_filesystem()->md5sum(full_local_file, &downloaded_md5sum));
+        VLOG_CRITICAL << "get downloaded file checksum: " << full_local_file << ": "
+                      << downloaded_md5sum;
+        if (downloaded_md5sum != file_stat.md5) {
+            std::stringstream ss;
+            ss << "invalid md5 of downloaded file: " << full_local_file
+               << ", expected: " << file_stat.md5 << ", get: " << downloaded_md5sum;
+            LOG(WARNING) << ss.str();
+            return Status::InternalError(ss.str());
+        }
+
+        // local_files always keep the updated local files
+        local_files.push_back(local_file_name);
+        LOG(INFO) << "finished to download file via broker. file: " << full_local_file
+                  << ", length: " << file_len;
+    } // end for all remote files
+
+    // finally, delete local files which are not in remote
+    for (const auto& local_file : local_files) {
+        // replace the tablet id in local file name with the remote tablet id,
+        // in order to compare the file name.
+        std::string new_name;
+        Status st = _replace_tablet_id(local_file, remote_tablet_id, &new_name);
+        if (!st.ok()) {
+            LOG(WARNING) << "failed to replace tablet id. unknown local file: " << st
+                         << ". ignore it";
+            continue;
+        }
+        VLOG_CRITICAL << "new file name after replace tablet id: " << new_name;
+        const auto& find = remote_files.find(new_name);
+        if (find != remote_files.end()) {
+            continue;
+        }
+
+        // delete
+        std::string full_local_file = local_path + "/" + local_file;
+        VLOG_CRITICAL << "begin to delete local snapshot file: " << full_local_file
+                      << ", it does not exist in remote";
+        if (remove(full_local_file.c_str()) != 0) {
+            LOG(WARNING) << "failed to delete unknown local file: " << full_local_file
+                         << ", ignore it";
+        }
+    }
+
+    return Status::OK();
+}
+
+Status SnapshotLoader::_run_concurrently(size_t num_tasks,
+                                         const std::function<Status(size_t)>& task) {
+    int concurrency = std::max(1, std::min(config::snapshot_loader_transfer_concurrency,
+                                           (int32_t)num_tasks));
+    std::unique_ptr<ThreadPool> pool;
+    RETURN_IF_ERROR(ThreadPoolBuilder("SnapshotLoaderThreadPool")
+                            .set_min_threads(concurrency)
+                            .set_max_threads(concurrency)
+                            .build(&pool));
+    std::mutex status_lock;
+    Status status;
+    auto set_status = [&status_lock, &status](Status st) {
+        std::lock_guard lock(status_lock);
+        if (status.ok()) {
+            status = std::move(st);
+        }
+    };
+    for (size_t i = 0; i < num_tasks; ++i) {
+        Status st = pool->submit_func([&, i]() {
+            {
+                std::lock_guard lock(status_lock);
+                // the job fails or is cancelled, skip the rest tasks
+                if (!status.ok()) {
+                    return;
+                }
+            }
+            if (Status task_st = task(i); !task_st.ok()) {
+                set_status(std::move(task_st));
+            }
+        });
+        if (!st.ok()) {
+            set_status(std::move(st));
+            break;
+        }
+    }
+    pool->wait();
+    pool->shutdown();
+    return status;
+}
+
 // only return CANCELLED if FE return that job is cancelled.
 // otherwise, return OK
 Status SnapshotLoader::_report_every(int report_threshold, int* counter, int32_t finished_num,
@@ -19,6 +19,7 @@
 
 #include <gen_cpp/Types_types.h>
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -56,6 +57,9 @@ class ExecEnv;
  * to local snapshot dir via broker.
  * It will also only download files which does not exist in local dir.
  *
+ * The tablets of an upload() or a download() are transferred concurrently by
+ * config::snapshot_loader_transfer_concurrency threads.
+ *
  * Move:
  * move() is the final step of restore process. it will replace the
  * old tablet data dir with the newly downloaded snapshot dir.
@@ -103,6 +107,19 @@ private:
 
     Status _list_with_checksum(const std::string& dir, std::map<std::string, FileStat>* md5_files);
 
+    // Upload the files of a tablet snapshot which are not in remote storage, report() is
+    // called before each file to report the progress and check if the job is cancelled.
+    Status _upload_tablet(const std::string& src_path, const std::string& dest_path,
+                          const std::function<Status()>& report,
+                          std::vector<std::string>* local_files_with_checksum);
+
+    Status _download_tablet(const std::string& remote_path, const std::string& local_path,
+                            int64_t local_tablet_id, const std::function<Status()>& report);
+
+    // Run task(0) ... task(num_tasks - 1) concurrently, the tasks not started yet are skipped
+    // once a task fails, and the first failure is returned.
+    Status _run_concurrently(size_t num_tasks, const std::function<Status(size_t)>& task);
+
 private:
     StorageEngine& _engine;
     ExecEnv* _env = nullptr;
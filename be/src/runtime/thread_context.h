@@ -34,6 +34,7 @@
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/memory/thread_mem_tracker_mgr.h"
 #include "util/defer_op.h" // IWYU pragma: keep
+#include "util/query_cpu_profiler.h"
 
 // Used to tracking query/load/compaction/e.g. execution thread memory usage.
 // This series of methods saves some information to the thread local context of the current worker thread,
@@ -170,9 +171,11 @@ public:
         thread_mem_tracker_mgr->set_query_id(_task_id);
         thread_mem_tracker_mgr->enable_wait_gc();
         thread_mem_tracker_mgr->reset_query_cancelled_flag(false);
+        QueryCpuProfiler::on_attach_task(_task_id);
     }
 
     void detach_task() {
+        QueryCpuProfiler::on_detach_task();
         _task_id = TUniqueId();
         thread_mem_tracker_mgr->detach_limiter_tracker();
         thread_mem_tracker_mgr->set_query_id(TUniqueId());
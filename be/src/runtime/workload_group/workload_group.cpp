@@ -27,6 +27,7 @@
 #include <utility>
 
 #include "common/logging.h"
+#include "io/fs/remote_read_throttle.h"
 #include "pipeline/task_queue.h"
 #include "pipeline/task_scheduler.h"
 #include "runtime/exec_env.h"
@@ -61,7 +62,14 @@ WorkloadGroup::WorkloadGroup(const WorkloadGroupInfo& tg_info)
           _max_remote_scan_thread_num(tg_info.max_remote_scan_thread_num),
           _min_remote_scan_thread_num(tg_info.min_remote_scan_thread_num),
           _spill_low_watermark(tg_info.spill_low_watermark),
-          _spill_high_watermark(tg_info.spill_high_watermark) {}
+          _spill_high_watermark(tg_info.spill_high_watermark) {
+    auto bvar_prefix = fmt::format("workload_group_{}", _id);
+    _inverted_index_query_cache_hit = std::make_unique<bvar::Adder<int64_t>>(
+            bvar_prefix, "inverted_index_query_cache_hit");
+    _inverted_index_query_cache_lookup = std::make_unique<bvar::Adder<int64_t>>(
+            bvar_prefix, "inverted_index_query_cache_lookup");
+    _remote_read_throttle = std::make_unique<io::RemoteReadThrottle>(_id, tg_info.cpu_share);
+}
 
 std::string WorkloadGroup::debug_string() const {
     std::shared_lock<std::shared_mutex> rl {_mutex};
@@ -94,6 +102,7 @@ void WorkloadGroup::check_and_update(const WorkloadGroupInfo& tg_info) {
             _memory_limit = tg_info.memory_limit;
             _enable_memory_overcommit = tg_info.enable_memory_overcommit;
             _cpu_share = tg_info.cpu_share;
+            _remote_read_throttle->set_cpu_share(tg_info.cpu_share);
             _cpu_hard_limit = tg_info.cpu_hard_limit;
             _scan_thread_num = tg_info.scan_thread_num;
             _max_remote_scan_thread_num = tg_info.max_remote_scan_thread_num;
@@ -378,7 +387,7 @@ void WorkloadGroup::upsert_task_scheduler(WorkloadGroupInfo* tg_info, ExecEnv* e
         if (executors_size <= 0) {
             executors_size = CpuInfo::num_cores();
         }
-        auto task_queue = std::make_shared<pipeline::MultiCoreTaskQueue>(executors_size);
+        auto task_queue = pipeline::create_task_queue(executors_size);
         std::unique_ptr<pipeline::TaskScheduler> pipeline_task_scheduler =
                 std::make_unique<pipeline::TaskScheduler>(exec_env, std::move(task_queue),
                                                           "Pipe_" + tg_name, cg_cpu_ctl_ptr);
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <bvar/bvar.h>
 #include <gen_cpp/BackendService_types.h>
 #include <stddef.h>
 #include <stdint.h>
@@ -41,6 +42,10 @@ class ExecEnv;
 class CgroupCpuCtl;
 class QueryContext;
 
+namespace io {
+class RemoteReadThrottle;
+} // namespace io
+
 namespace vectorized {
 class SimplifiedScanScheduler;
 }
@@ -161,6 +166,14 @@ public:
         return _query_ctxs;
     }
 
+    // the hit rate of the inverted index query cache for the scans of the group is hit / lookup
+    void update_inverted_index_query_cache_stats(int64_t hit, int64_t miss) {
+        *_inverted_index_query_cache_hit << hit;
+        *_inverted_index_query_cache_lookup << hit + miss;
+    }
+
+    io::RemoteReadThrottle* remote_read_throttle() { return _remote_read_throttle.get(); }
+
 private:
     mutable std::shared_mutex _mutex; // lock _name, _version, _cpu_share, _memory_limit
     const uint64_t _id;
@@ -190,6 +203,10 @@ private:
     std::unique_ptr<vectorized::SimplifiedScanScheduler> _scan_task_sched {nullptr};
     std::unique_ptr<vectorized::SimplifiedScanScheduler> _remote_scan_task_sched {nullptr};
     std::unique_ptr<ThreadPool> _non_pipe_thread_pool = nullptr;
+
+    std::unique_ptr<bvar::Adder<int64_t>> _inverted_index_query_cache_hit;
+    std::unique_ptr<bvar::Adder<int64_t>> _inverted_index_query_cache_lookup;
+    std::unique_ptr<io::RemoteReadThrottle> _remote_read_throttle;
 };
 
 using WorkloadGroupPtr = std::shared_ptr<WorkloadGroup>;
@@ -21,6 +21,7 @@
 #include <mutex>
 #include <unordered_map>
 
+#include "io/fs/remote_read_throttle.h"
 #include "pipeline/task_scheduler.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/workload_group/workload_group.h"
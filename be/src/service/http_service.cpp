@@ -47,8 +47,11 @@
 #include "http/action/meta_action.h"
 #include "http/action/metrics_action.h"
 #include "http/action/pad_rowset_action.h"
+#include "http/action/pipeline_latency_stats_action.h"
+#include "http/action/pipeline_slow_query_trace_action.h"
 #include "http/action/pipeline_task_action.h"
 #include "http/action/pprof_actions.h"
+#include "http/action/query_cpu_profile_action.h"
 #include "http/action/reload_tablet_action.h"
 #include "http/action/report_action.h"
 #include "http/action/reset_rpc_channel_action.h"
@@ -143,6 +146,18 @@ Status HttpService::start() {
     _ev_http_server->register_handler(HttpMethod::POST, "api/pipeline/tracing",
                                       adjust_tracing_dump);
 
+    auto* pipeline_latency_stats_action = _pool.add(new PipelineLatencyStatsAction());
+    _ev_http_server->register_handler(HttpMethod::GET, "api/pipeline/latency_stats",
+                                      pipeline_latency_stats_action);
+
+    auto* pipeline_slow_query_trace_action = _pool.add(new PipelineSlowQueryTraceAction());
+    _ev_http_server->register_handler(HttpMethod::GET, "api/pipeline/slow_query_trace",
+                                      pipeline_slow_query_trace_action);
+
+    auto* query_cpu_profile_action = _pool.add(new QueryCpuProfileAction());
+    _ev_http_server->register_handler(HttpMethod::GET, "api/query_profile/cpu",
+                                      query_cpu_profile_action);
+
     // Register BE version action
     VersionAction* version_action =
             _pool.add(new VersionAction(_env, TPrivilegeHier::GLOBAL, TPrivilegeType::NONE));
@@ -335,6 +350,11 @@ void HttpService::register_local_handler(StorageEngine& engine) {
 
     _ev_http_server->register_handler(HttpMethod::GET, "/api/compaction/run_status",
                                       run_status_compaction_action);
+    CompactionAction* show_compaction_stats_action =
+            _pool.add(new CompactionAction(CompactionActionType::SHOW_STATS, _env, engine,
+                                           TPrivilegeHier::GLOBAL, TPrivilegeType::ADMIN));
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/compaction/stats",
+                                      show_compaction_stats_action);
     CheckTabletSegmentAction* check_tablet_segment_action = _pool.add(new CheckTabletSegmentAction(
             _env, engine, TPrivilegeHier::GLOBAL, TPrivilegeType::ADMIN));
     _ev_http_server->register_handler(HttpMethod::POST, "/api/check_tablet_segment_lost",
@@ -1493,15 +1493,23 @@ void PInternalService::transmit_block(google::protobuf::RpcController* controlle
                                       const PTransmitDataParams* request,
                                       PTransmitDataResult* response,
                                       google::protobuf::Closure* done) {
+    // ExchangeSinkBuffer packs the packets to several instances into the attachment, the
+    // request itself carries no block then.
+    bool is_batch = !static_cast<brpc::Controller*>(controller)->request_attachment().empty();
     if (config::enable_bthread_transmit_block) {
         int64_t receive_time = GetCurrentTimeNanos();
         response->set_receive_time(receive_time);
         // under high concurrency, thread pool will have a lot of lock contention.
         // May offer failed to the thread pool, so that we should avoid using thread
         // pool here.
-        _transmit_block(controller, request, response, done, Status::OK());
+        if (is_batch) {
+            _transmit_block_batch(controller, response, done);
+        } else {
+            _transmit_block(controller, request, response, done, Status::OK());
+        }
     } else {
-        bool ret = _light_work_pool.try_offer([this, controller, request, response, done]() {
+        bool ret = _light_work_pool.try_offer([this, controller, request, response, done,
+                                               is_batch]() {
             int64_t receive_time = GetCurrentTimeNanos();
             response->set_receive_time(receive_time);
             // Sometimes transmit block function is the last owner of PlanFragmentExecutor
@@ -1509,7 +1517,11 @@ void PInternalService::transmit_block(google::protobuf::RpcController* controlle
             // JNIContext will hold some TLS object. It could not work correctly under bthread
             // Context. So that put the logic into pthread.
             // But this is rarely happens, so this config is disabled by default.
-            _transmit_block(controller, request, response, done, Status::OK());
+            if (is_batch) {
+                _transmit_block_batch(controller, response, done);
+            } else {
+                _transmit_block(controller, request, response, done, Status::OK());
+            }
         });
         if (!ret) {
             offer_failed(response, done, _light_work_pool);
@@ -1568,6 +1580,20 @@ void PInternalService::_transmit_block(google::protobuf::RpcController* controll
     }
 }
 
+void PInternalService::_transmit_block_batch(google::protobuf::RpcController* controller,
+                                             PTransmitDataResult* response,
+                                             google::protobuf::Closure* done) {
+    Status st = _exec_env->vstream_mgr()->transmit_block_batch(
+            static_cast<brpc::Controller*>(controller), response, &done);
+    if (!st.ok()) {
+        LOG(WARNING) << "transmit_block_batch failed, message=" << st;
+    }
+    if (done != nullptr) {
+        st.to_protobuf(response->mutable_status());
+        done->Run();
+    }
+}
+
 void PInternalService::check_rpc_channel(google::protobuf::RpcController* controller,
                                          const PCheckRPCChannelRequest* request,
                                          PCheckRPCChannelResponse* response,
@@ -254,6 +254,11 @@ private:
                          ::doris::PTransmitDataResult* response, ::google::protobuf::Closure* done,
                          const Status& extract_st);
 
+    // The packets of a batched transmit_block are carried by the request attachment.
+    void _transmit_block_batch(::google::protobuf::RpcController* controller,
+                               ::doris::PTransmitDataResult* response,
+                               ::google::protobuf::Closure* done);
+
     Status _tablet_fetch_data(const PTabletKeyLookupRequest* request,
                               PTabletKeyLookupResponse* response);
 
@@ -44,6 +44,7 @@
 #include "util/key_util.h"
 #include "util/runtime_profile.h"
 #include "util/thrift_util.h"
+#include "vec/common/sip_hash.h"
 #include "vec/data_types/serde/data_type_serde.h"
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vexpr_context.h"
@@ -168,6 +169,19 @@ PointQueryExecutor::~PointQueryExecutor() {
     _row_read_ctxs.clear();
 }
 
+__int128_t PointQueryExecutor::_plan_digest(const PTabletKeyLookupRequest& request) {
+    SipHash hash;
+    for (const std::string* plan :
+         {&request.desc_tbl(), &request.output_expr(), &request.query_options()}) {
+        hash.update(plan->size());
+        hash.update(plan->data(), plan->size());
+    }
+    uint64_t lo = 0;
+    uint64_t hi = 0;
+    hash.get128(lo, hi);
+    return static_cast<__int128_t>(hi) << 64 | lo;
+}
+
 Status PointQueryExecutor::init(const PTabletKeyLookupRequest* request,
                                 PTabletKeyLookupResponse* response) {
     SCOPED_TIMER(&_profile_metrics.init_ns);
@@ -175,6 +189,9 @@ Status PointQueryExecutor::init(const PTabletKeyLookupRequest* request,
     // using cache
     __int128_t uuid =
             static_cast<__int128_t>(request->uuid().uuid_high()) << 64 | request->uuid().uuid_low();
+    if (uuid == 0) {
+        uuid = _plan_digest(*request);
+    }
     SCOPED_ATTACH_TASK(ExecEnv::GetInstance()->point_query_executor_mem_tracker());
     auto cache_handle = LookupConnectionCache::instance()->get(uuid);
     _binary_row_format = request->is_binary_row();
@@ -295,6 +312,8 @@ Status PointQueryExecutor::_lookup_row_key() {
         specified_rowsets = _tablet->get_rowset_by_ids(nullptr);
     }
     std::vector<std::unique_ptr<SegmentCacheHandle>> segment_caches(specified_rowsets.size());
+    // the keys of a multi-key lookup share the primary key index iterators of the segments
+    PkIndexIterators index_iterators(specified_rowsets.size());
     for (size_t i = 0; i < _row_read_ctxs.size(); ++i) {
         RowLocation location;
         if (!config::disable_storage_row_cache) {
@@ -311,7 +330,7 @@ Status PointQueryExecutor::_lookup_row_key() {
         auto rowset_ptr = std::make_unique<RowsetSharedPtr>();
         st = (_tablet->lookup_row_key(_row_read_ctxs[i]._primary_key, false, specified_rowsets,
                                       &location, INT32_MAX /*rethink?*/, segment_caches,
-                                      rowset_ptr.get(), false));
+                                      rowset_ptr.get(), false, &index_iterators));
         if (st.is<ErrorCode::KEY_NOT_FOUND>()) {
             continue;
         }
@@ -280,6 +280,10 @@ public:
     std::string print_profile();
 
 private:
+    // The cache id of the reusable of a request without the uuid of a prepared statement, so
+    // the requests of the same statement share the prepared descriptors and output exprs.
+    static __int128_t _plan_digest(const PTabletKeyLookupRequest& request);
+
     Status _init_keys(const PTabletKeyLookupRequest* request);
 
     Status _lookup_row_key();
@@ -22,6 +22,7 @@
 #include <arrow/array/builder_decimal.h>
 #include <arrow/array/builder_nested.h>
 #include <arrow/array/builder_primitive.h>
+#include <arrow/buffer.h>
 #include <arrow/record_batch.h>
 #include <arrow/status.h>
 #include <arrow/type.h>
@@ -31,9 +32,11 @@
 #include <cctz/time_zone.h>
 #include <glog/logging.h>
 #include <stdint.h>
+#include <string.h>
 
 #include <algorithm>
 #include <ctime>
+#include <limits>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -46,11 +49,14 @@
 #include "util/arrow/row_batch.h"
 #include "util/arrow/utils.h"
 #include "util/jsonb_utils.h"
+#include "util/simd/bits.h"
 #include "util/types.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_array.h"
 #include "vec/columns/column_decimal.h"
 #include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
 #include "vec/common/assert_cast.h"
 #include "vec/common/string_ref.h"
 #include "vec/core/column_with_type_and_name.h"
@@ -66,6 +72,18 @@ class Array;
 
 namespace doris {
 
+// An arrow buffer over the memory of a column, which keeps the column alive until the arrays
+// sharing the buffer are released.
+class ColumnBuffer : public arrow::Buffer {
+public:
+    ColumnBuffer(const void* data, int64_t size, vectorized::ColumnPtr column)
+            : arrow::Buffer(reinterpret_cast<const uint8_t*>(data), size),
+              _column(std::move(column)) {}
+
+private:
+    vectorized::ColumnPtr _column;
+};
+
 // Convert Block to an Arrow::Array
 // We should keep this function to keep compatible with arrow's type visitor
 // Now we inherit TypeVisitor to use default Visit implementation
@@ -326,6 +344,17 @@ public:
     Status convert(std::shared_ptr<arrow::RecordBatch>* out);
 
 private:
+    // Share the memory of the numeric, decimal128 and string columns with the arrow array
+    // instead of copying the values through the builder, only the null map is converted.
+    // `out` is not set if the column can not be shared.
+    Status _share_column(const vectorized::ColumnPtr& column, const vectorized::DataTypePtr& type,
+                         const std::shared_ptr<arrow::DataType>& arrow_type,
+                         std::shared_ptr<arrow::Array>* out);
+
+    // Pack the null map to the validity bitmap of arrow, 32 rows at a time
+    Status _null_map_to_bitmap(const vectorized::NullMap& null_map,
+                               std::shared_ptr<arrow::Buffer>* bitmap, int64_t* null_count);
+
     template <typename T>
     arrow::Status _visit(const T& type) {
         auto& builder = assert_cast<arrow::NumericBuilder<T>&>(*_cur_builder);
@@ -365,6 +394,117 @@ private:
     std::vector<std::shared_ptr<arrow::Array>> _arrays;
 };
 
+Status FromBlockConverter::_null_map_to_bitmap(const vectorized::NullMap& null_map,
+                                               std::shared_ptr<arrow::Buffer>* bitmap,
+                                               int64_t* null_count) {
+    size_t num_rows = null_map.size();
+    *null_count = num_rows - simd::count_zero_num(
+                                     reinterpret_cast<const int8_t*>(null_map.data()), num_rows);
+    if (*null_count == 0) {
+        return Status::OK();
+    }
+    auto buffer_result = arrow::AllocateBuffer((num_rows + 7) / 8, _pool);
+    if (!buffer_result.ok()) {
+        return to_doris_status(buffer_result.status());
+    }
+    std::shared_ptr<arrow::Buffer> buffer = std::move(buffer_result).ValueOrDie();
+    uint8_t* bits = buffer->mutable_data();
+    size_t i = 0;
+    for (; i + 32 <= num_rows; i += 32) {
+        uint32_t valid = ~simd::bytes32_mask_to_bits32_mask(null_map.data() + i);
+        memcpy(bits + i / 8, &valid, sizeof(valid));
+    }
+    if (i < num_rows) {
+        memset(bits + i / 8, 0, (num_rows - i + 7) / 8);
+        for (; i < num_rows; ++i) {
+            bits[i / 8] |= static_cast<uint8_t>(!null_map[i]) << (i % 8);
+        }
+    }
+    *bitmap = std::move(buffer);
+    return Status::OK();
+}
+
+Status FromBlockConverter::_share_column(const vectorized::ColumnPtr& column,
+                                         const vectorized::DataTypePtr& type,
+                                         const std::shared_ptr<arrow::DataType>& arrow_type,
+                                         std::shared_ptr<arrow::Array>* out) {
+    const vectorized::IColumn* data_column = column.get();
+    const vectorized::NullMap* null_map = nullptr;
+    if (const auto* nullable_column =
+                vectorized::check_and_get_column<vectorized::ColumnNullable>(column.get())) {
+        data_column = &nullable_column->get_nested_column();
+        null_map = &nullable_column->get_null_map_data();
+    }
+    size_t num_rows = data_column->size();
+
+    std::vector<std::shared_ptr<arrow::Buffer>> buffers;
+    auto arrow_type_id = arrow_type->id();
+    auto share_fixed_width = [&](arrow::Type::type expected_type_id) {
+        if (arrow_type_id != expected_type_id) {
+            return false;
+        }
+        StringRef data = data_column->get_raw_data();
+        buffers = {nullptr, std::make_shared<ColumnBuffer>(data.data, data.size, column)};
+        return true;
+    };
+    bool shared = false;
+    switch (vectorized::remove_nullable(type)->get_type_id()) {
+    case vectorized::TypeIndex::Int8:
+        shared = share_fixed_width(arrow::Type::INT8);
+        break;
+    case vectorized::TypeIndex::Int16:
+        shared = share_fixed_width(arrow::Type::INT16);
+        break;
+    case vectorized::TypeIndex::Int32:
+        shared = share_fixed_width(arrow::Type::INT32);
+        break;
+    case vectorized::TypeIndex::Int64:
+        shared = share_fixed_width(arrow::Type::INT64);
+        break;
+    case vectorized::TypeIndex::Float32:
+        shared = share_fixed_width(arrow::Type::FLOAT);
+        break;
+    case vectorized::TypeIndex::Float64:
+        shared = share_fixed_width(arrow::Type::DOUBLE);
+        break;
+    // the decimal128 of doris and arrow are both the little endian int128
+    case vectorized::TypeIndex::Decimal128V2:
+    case vectorized::TypeIndex::Decimal128V3:
+        shared = share_fixed_width(arrow::Type::DECIMAL128);
+        break;
+    case vectorized::TypeIndex::String: {
+        const auto* string_column =
+                vectorized::check_and_get_column<vectorized::ColumnString>(data_column);
+        if (string_column == nullptr || arrow_type_id != arrow::Type::STRING ||
+            string_column->get_chars().size() > std::numeric_limits<int32_t>::max()) {
+            break;
+        }
+        // the offset before the first row is always 0 in the padding of offsets
+        const auto& offsets = string_column->get_offsets();
+        const auto& chars = string_column->get_chars();
+        buffers = {nullptr,
+                   std::make_shared<ColumnBuffer>(offsets.data() - 1,
+                                                  (num_rows + 1) * sizeof(int32_t), column),
+                   std::make_shared<ColumnBuffer>(chars.data(), chars.size(), column)};
+        shared = true;
+        break;
+    }
+    default:
+        break;
+    }
+    if (!shared) {
+        return Status::OK();
+    }
+
+    int64_t null_count = 0;
+    if (null_map != nullptr) {
+        RETURN_IF_ERROR(_null_map_to_bitmap(*null_map, &buffers[0], &null_count));
+    }
+    *out = arrow::MakeArray(
+            arrow::ArrayData::Make(arrow_type, num_rows, std::move(buffers), null_count));
+    return Status::OK();
+}
+
 Status FromBlockConverter::convert(std::shared_ptr<arrow::RecordBatch>* out) {
     size_t num_fields = _schema->num_fields();
     if (_block.columns() != num_fields) {
@@ -379,13 +519,18 @@ Status FromBlockConverter::convert(std::shared_ptr<arrow::RecordBatch>* out) {
         _cur_rows = _block.rows();
         _cur_col = _block.get_by_position(idx).column;
         _cur_type = _block.get_by_position(idx).type;
+        auto column = _cur_col->convert_to_full_column_if_const();
+        RETURN_IF_ERROR(_share_column(column, _cur_type, _schema->field(idx)->type(),
+                                      &_arrays[_cur_field_idx]));
+        if (_arrays[_cur_field_idx] != nullptr) {
+            continue;
+        }
         std::unique_ptr<arrow::ArrayBuilder> builder;
         auto arrow_st = arrow::MakeBuilder(_pool, _schema->field(idx)->type(), &builder);
         if (!arrow_st.ok()) {
             return to_doris_status(arrow_st);
         }
         _cur_builder = builder.get();
-        auto column = _cur_col->convert_to_full_column_if_const();
         try {
             _cur_type->get_serde()->write_column_to_arrow(*column, nullptr, _cur_builder,
                                                           _cur_start, _cur_start + _cur_rows,
@@ -34,6 +34,7 @@
 #include <stdint.h>
 #include <zconf.h>
 #include <zlib.h>
+#include <zdict.h>
 #include <zstd.h>
 #include <zstd_errors.h>
 
@@ -42,6 +43,7 @@
 #include <mutex>
 #include <new>
 #include <ostream>
+#include <string>
 
 #include "common/config.h"
 #include "common/factory_creator.h"
@@ -854,6 +856,28 @@ public:
                 ExecEnv::GetInstance()->block_compression_mem_tracker());
         _ctx_c_pool.clear();
         _ctx_d_pool.clear();
+        if (_cdict) {
+            ZSTD_freeCDict(_cdict);
+        }
+        if (_ddict) {
+            ZSTD_freeDDict(_ddict);
+        }
+    }
+
+    // Compress and decompress with the dictionary, which is copied. The contexts of the
+    // codec are not shared with the codec without dictionary, they keep referencing it.
+    Status init_dict(const Slice& dict) {
+        SCOPED_SWITCH_THREAD_MEM_TRACKER_LIMITER(
+                ExecEnv::GetInstance()->block_compression_mem_tracker());
+        _cdict = ZSTD_createCDict(dict.data, dict.size, ZSTD_CLEVEL_DEFAULT);
+        if (_cdict == nullptr) {
+            return Status::InvalidArgument("Fail to create ZSTD compression dictionary");
+        }
+        _ddict = ZSTD_createDDict(dict.data, dict.size);
+        if (_ddict == nullptr) {
+            return Status::InvalidArgument("Fail to create ZSTD decompression dictionary");
+        }
+        return Status::OK();
     }
 
     size_t max_compressed_len(size_t len) override { return ZSTD_compressBound(len); }
@@ -909,6 +933,14 @@ public:
                                                ZSTD_getErrorString(ZSTD_getErrorCode(ret)));
             }
 
+            if (_cdict) {
+                ret = ZSTD_CCtx_refCDict(context->ctx, _cdict);
+                if (ZSTD_isError(ret)) {
+                    return Status::InvalidArgument("ZSTD_CCtx_refCDict error: {}",
+                                                   ZSTD_getErrorString(ZSTD_getErrorCode(ret)));
+                }
+            }
+
             ZSTD_outBuffer out_buf = {compressed_buf.data, compressed_buf.size, 0};
 
             for (size_t i = 0; i < inputs.size(); i++) {
@@ -962,8 +994,12 @@ public:
             }
         }};
 
-        size_t ret = ZSTD_decompressDCtx(context->ctx, output->data, output->size, input.data,
-                                         input.size);
+        // a frame compressed with a dictionary fails to decompress without it, or with
+        // another one, as the frame header records the dictionary id
+        size_t ret = _ddict ? ZSTD_decompress_usingDDict(context->ctx, output->data, output->size,
+                                                         input.data, input.size, _ddict)
+                            : ZSTD_decompressDCtx(context->ctx, output->data, output->size,
+                                                  input.data, input.size);
         if (ZSTD_isError(ret)) {
             decompress_failed = true;
             return Status::InvalidArgument("ZSTD_decompressDCtx error: {}",
@@ -1037,6 +1073,9 @@ private:
 
     mutable std::mutex _ctx_d_mutex;
     mutable std::vector<std::unique_ptr<DContext>> _ctx_d_pool;
+
+    ZSTD_CDict* _cdict = nullptr;
+    ZSTD_DDict* _ddict = nullptr;
 };
 
 class GzipBlockCompression : public ZlibBlockCompression {
@@ -1263,6 +1302,34 @@ Status get_block_compression_codec(segment_v2::CompressionTypePB type,
     return Status::OK();
 }
 
+Status train_zstd_dictionary(const std::vector<Slice>& samples, size_t max_dict_size,
+                             std::string* dict) {
+    std::string samples_buffer;
+    std::vector<size_t> sample_sizes;
+    sample_sizes.reserve(samples.size());
+    for (const auto& sample : samples) {
+        samples_buffer.append(sample.data, sample.size);
+        sample_sizes.push_back(sample.size);
+    }
+    dict->resize(max_dict_size);
+    size_t ret = ZDICT_trainFromBuffer(dict->data(), dict->size(), samples_buffer.data(),
+                                       sample_sizes.data(), sample_sizes.size());
+    if (ZDICT_isError(ret)) {
+        dict->clear();
+        return Status::InvalidArgument("ZDICT_trainFromBuffer error: {}", ZDICT_getErrorName(ret));
+    }
+    dict->resize(ret);
+    return Status::OK();
+}
+
+Status create_zstd_dict_compression_codec(const Slice& dict,
+                                          std::unique_ptr<BlockCompressionCodec>* codec) {
+    auto zstd_codec = std::make_unique<ZstdBlockCompression>();
+    RETURN_IF_ERROR(zstd_codec->init_dict(dict));
+    *codec = std::move(zstd_codec);
+    return Status::OK();
+}
+
 Status get_block_compression_codec(tparquet::CompressionCodec::type parquet_codec,
                                    BlockCompressionCodec** codec) {
     switch (parquet_codec) {
@@ -20,6 +20,8 @@
 #include <gen_cpp/parquet_types.h>
 
 #include <cstddef>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "common/status.h"
@@ -86,4 +88,17 @@ Status get_block_compression_codec(segment_v2::CompressionTypePB type,
 Status get_block_compression_codec(tparquet::CompressionCodec::type parquet_codec,
                                    BlockCompressionCodec** codec);
 
+// Train a ZSTD dictionary of at most max_dict_size bytes from the samples, such as the
+// uncompressed pages of a column. Small pages of similar strings, like urls or json, compress
+// much better with it, as each page no longer starts with an empty window.
+// Return not OK if there are too few samples to train it.
+Status train_zstd_dictionary(const std::vector<Slice>& samples, size_t max_dict_size,
+                             std::string* dict);
+
+// Create a ZSTD codec which compresses and decompresses with the dictionary. Unlike the
+// codecs above, it is owned by the caller, and its data can only be decompressed by a
+// codec created with the same dictionary.
+Status create_zstd_dict_compression_codec(const Slice& dict,
+                                          std::unique_ptr<BlockCompressionCodec>* codec);
+
 } // namespace doris
@@ -22,10 +22,12 @@
 
 #include <unistd.h>
 
+#include <algorithm>
 #include <atomic>
 #include <condition_variable>
 #include <list>
 #include <mutex>
+#include <vector>
 
 #include "common/logging.h"
 #include "util/stopwatch.hpp"
@@ -73,6 +75,38 @@ public:
         }
     }
 
+    // Get up to 'max_elements' elements from the queue at once, appended to 'out', waiting
+    // indefinitely for at least one to become available. Returns false if we were shut down
+    // prior to getting the elements, and there are no more elements available.
+    bool blocking_get_batch(std::vector<T>* out, size_t max_elements) {
+        MonotonicStopWatch timer;
+        timer.start();
+        std::unique_lock<std::mutex> unique_lock(_lock);
+        while (!(_shutdown || !_list.empty())) {
+            ++_get_waiting;
+            _get_cv.wait(unique_lock);
+        }
+        _total_get_wait_time += timer.elapsed_time();
+
+        if (_list.empty()) {
+            assert(_shutdown);
+            return false;
+        }
+        size_t num = 0;
+        while (!_list.empty() && num < max_elements) {
+            out->push_back(_list.front());
+            _list.pop_front();
+            ++num;
+        }
+        size_t num_wakeups = std::min(num, _put_waiting);
+        _put_waiting -= num_wakeups;
+        unique_lock.unlock();
+        for (size_t i = 0; i < num_wakeups; ++i) {
+            _put_cv.notify_one();
+        }
+        return true;
+    }
+
     // Puts an element into the queue, waiting indefinitely until there is space.
     // If the queue is shut down, returns false.
     bool blocking_put(const T& val) {
@@ -21,6 +21,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <utility>
 
 #include "common/logging.h"
 
@@ -35,7 +36,18 @@ struct ByteBuffer {
         return ptr;
     }
 
-    ~ByteBuffer() { delete[] ptr; }
+    // Wraps the `size` bytes of `data`, which are owned by `owner` and released with the buffer,
+    // without a copy. The buffer is ready to be read.
+    static ByteBufferPtr wrap(char* data, size_t size, std::shared_ptr<void> owner) {
+        ByteBufferPtr ptr(new ByteBuffer(data, size, std::move(owner)));
+        return ptr;
+    }
+
+    ~ByteBuffer() {
+        if (_owner == nullptr) {
+            delete[] ptr;
+        }
+    }
 
     void put_bytes(const char* data, size_t size) {
         memcpy(ptr + pos, data, size);
@@ -64,6 +76,11 @@ struct ByteBuffer {
 private:
     ByteBuffer(size_t capacity_)
             : ptr(new char[capacity_]), pos(0), limit(capacity_), capacity(capacity_) {}
+
+    ByteBuffer(char* data, size_t size, std::shared_ptr<void> owner)
+            : ptr(data), pos(0), limit(size), capacity(size), _owner(std::move(owner)) {}
+
+    std::shared_ptr<void> _owner;
 };
 
 } // namespace doris
@@ -41,6 +41,7 @@ public:
     static const int64_t POPCNT = (1 << 4);
     static const int64_t AVX = (1 << 5);
     static const int64_t AVX2 = (1 << 6);
+    static const int64_t AVX512F = (1 << 7);
 
     /// Cache enums for L1 (data), L2 and L3
     enum CacheLevel {
@@ -51,6 +51,9 @@ public:
     IntCounter* fragment_request_duration_us = nullptr;
     IntCounter* query_scan_bytes = nullptr;
     IntCounter* query_scan_rows = nullptr;
+    // set_ready of pipeline dependencies which wake up blocked tasks, and the woken tasks
+    IntCounter* pipeline_dependency_wake_up_total = nullptr;
+    IntCounter* pipeline_dependency_woken_tasks_total = nullptr;
 
     IntCounter* push_requests_success_total = nullptr;
     IntCounter* push_requests_fail_total = nullptr;
@@ -24,6 +24,9 @@
 #include <xxh3.h>
 #include <zlib.h>
 
+#include <array>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
@@ -35,6 +38,25 @@
 
 namespace doris {
 
+// The tables of the crc32 of zlib sliced by 4 bytes, the first one is the table of zlib.
+inline constexpr auto ZLIB_CRC_TABLES = [] {
+    std::array<std::array<uint32_t, 256>, 4> tables {};
+    for (uint32_t n = 0; n < 256; ++n) {
+        uint32_t crc = n;
+        for (int k = 0; k < 8; ++k) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0xEDB88320U : crc >> 1;
+        }
+        tables[0][n] = crc;
+    }
+    for (uint32_t n = 0; n < 256; ++n) {
+        for (int k = 1; k < 4; ++k) {
+            uint32_t crc = tables[k - 1][n];
+            tables[k][n] = (crc >> 8) ^ tables[0][crc & 0xFF];
+        }
+    }
+    return tables;
+}();
+
 // Utility class to compute hash values.
 class HashUtil {
 public:
@@ -50,6 +72,27 @@ public:
         return crc32(hash, (const unsigned char*)data, bytes);
     }
 
+    // Same as zlib_crc_hash of the bytes of a fixed width value, but inlined, the call of crc32
+    // costs more than the few bytes of a row.
+    template <typename T>
+    static uint32_t zlib_crc_hash_fixed(const T& value, uint32_t hash) {
+        const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+        const auto& tables = ZLIB_CRC_TABLES;
+        uint32_t crc = ~hash;
+        size_t i = 0;
+        for (; i + sizeof(uint32_t) <= sizeof(T); i += sizeof(uint32_t)) {
+            uint32_t word;
+            memcpy(&word, bytes + i, sizeof(word));
+            crc ^= word;
+            crc = tables[3][crc & 0xFF] ^ tables[2][(crc >> 8) & 0xFF] ^
+                  tables[1][(crc >> 16) & 0xFF] ^ tables[0][crc >> 24];
+        }
+        for (; i < sizeof(T); ++i) {
+            crc = tables[0][(crc ^ bytes[i]) & 0xFF] ^ (crc >> 8);
+        }
+        return ~crc;
+    }
+
     static uint32_t zlib_crc_hash_null(uint32_t hash) {
         // null is treat as 0 when hash
         static const int INT_VALUE = 0;
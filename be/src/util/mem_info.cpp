@@ -41,6 +41,7 @@
 #include "gutil/strings/split.h"
 #include "runtime/exec_env.h"
 #include "runtime/memory/cache_manager.h"
+#include "runtime/memory/global_memory_arbitrator.h"
 #include "runtime/memory/mem_tracker_limiter.h"
 #include "runtime/workload_group/workload_group.h"
 #include "runtime/workload_group/workload_group_manager.h"
@@ -150,6 +151,16 @@ bool MemInfo::process_minor_gc() {
         return true;
     }
 
+    if (config::enable_spill_memory_arbitration) {
+        RuntimeProfile* srq_profile =
+                profile->create_child("SpillTopRevocableMemoryQuery", true, true);
+        freed_mem += GlobalMemoryArbitrator::request_spill_top_revocable_query(
+                MemInfo::process_minor_gc_size() - freed_mem, srq_profile);
+        if (freed_mem > MemInfo::process_minor_gc_size()) {
+            return true;
+        }
+    }
+
     if (config::enable_workload_group_memory_gc) {
         RuntimeProfile* tg_profile = profile->create_child("WorkloadGroup", true, true);
         freed_mem += tg_enable_overcommit_group_gc(MemInfo::process_minor_gc_size() - freed_mem,
@@ -204,6 +215,15 @@ bool MemInfo::process_full_gc() {
         return true;
     }
 
+    if (config::enable_spill_memory_arbitration) {
+        // the memory is released later by spilling, but the process memory has already exceeded
+        // the limit, so still cancel the queries as needed.
+        RuntimeProfile* srq_profile =
+                profile->create_child("SpillTopRevocableMemoryQuery", true, true);
+        static_cast<void>(GlobalMemoryArbitrator::request_spill_top_revocable_query(
+                MemInfo::process_full_gc_size() - freed_mem, srq_profile));
+    }
+
     if (config::enable_workload_group_memory_gc) {
         RuntimeProfile* tg_profile = profile->create_child("WorkloadGroup", true, true);
         freed_mem += tg_enable_overcommit_group_gc(MemInfo::process_full_gc_size() - freed_mem,
@@ -19,10 +19,10 @@
 
 namespace doris {
 
-ObjLRUCache::ObjLRUCache(int64_t capacity, uint32_t num_shards)
-        : LRUCachePolicy(CachePolicy::CacheType::COMMON_OBJ_LRU_CACHE, capacity,
-                         LRUCacheType::NUMBER, config::common_obj_lru_cache_stale_sweep_time_sec,
-                         num_shards) {
+ObjLRUCache::ObjLRUCache(int64_t capacity, uint32_t num_shards, LRUCacheType lru_cache_type)
+        : LRUCachePolicy(CachePolicy::CacheType::COMMON_OBJ_LRU_CACHE, capacity, lru_cache_type,
+                         config::common_obj_lru_cache_stale_sweep_time_sec, num_shards),
+          _lru_cache_type(lru_cache_type) {
     _enabled = (capacity > 0);
 }
 
@@ -46,6 +46,9 @@ void ObjLRUCache::erase(const ObjKey& key) {
 }
 
 bool ObjLRUCache::exceed_prune_limit() {
+    if (_lru_cache_type == LRUCacheType::SIZE) {
+        return LRUCachePolicy::exceed_prune_limit();
+    }
     // just return true to prune all cached obj.
     // Because ObjLRUCache is counted with number, not memory.
     // Simple prune all
@@ -84,16 +84,25 @@ public:
         DISALLOW_COPY_AND_ASSIGN(CacheHandle);
     };
 
-    ObjLRUCache(int64_t capacity, uint32_t num_shards = DEFAULT_LRU_CACHE_NUM_SHARDS);
+    // If lru_cache_type is LRUCacheType::SIZE, the capacity is the memory size of the cached
+    // objects, and each object should be inserted with its memory size as charge.
+    ObjLRUCache(int64_t capacity, uint32_t num_shards = DEFAULT_LRU_CACHE_NUM_SHARDS,
+                LRUCacheType lru_cache_type = LRUCacheType::NUMBER);
 
     bool lookup(const ObjKey& key, CacheHandle* handle);
 
     template <typename T>
     void insert(const ObjKey& key, const T* value, CacheHandle* cache_handle) {
+        insert(key, value, cache_handle, 1, sizeof(T));
+    }
+
+    template <typename T>
+    void insert(const ObjKey& key, const T* value, CacheHandle* cache_handle, size_t charge,
+                size_t tracking_bytes) {
         if (_enabled) {
             const std::string& encoded_key = key.key;
             auto* obj_value = new ObjValue<T>(value);
-            auto* handle = LRUCachePolicy::insert(encoded_key, obj_value, 1, sizeof(T),
+            auto* handle = LRUCachePolicy::insert(encoded_key, obj_value, charge, tracking_bytes,
                                                   CachePriority::NORMAL);
             *cache_handle = CacheHandle {this, handle};
         } else {
@@ -103,10 +112,13 @@ public:
 
     void erase(const ObjKey& key);
 
+    LRUCacheType lru_cache_type() const { return _lru_cache_type; }
+
     bool exceed_prune_limit() override;
 
 private:
     bool _enabled;
+    LRUCacheType _lru_cache_type;
 };
 
 } // namespace doris
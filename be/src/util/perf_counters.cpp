@@ -600,4 +600,59 @@ void PerfCounters::get_proc_status(ProcStatus* out) {
     out->vm_hwm = parse_bytes("status/VmHWM");
 }
 
+ThreadPerfCounters::ThreadPerfCounters() {
+    _fds.fill(-1);
+    static constexpr PerfCounters::Counter COUNTERS[NUM_COUNTERS] = {
+            PerfCounters::PERF_COUNTER_HW_CPU_CYCLES, PerfCounters::PERF_COUNTER_HW_INSTRUCTIONS,
+            PerfCounters::PERF_COUNTER_HW_CACHE_MISSES,
+            PerfCounters::PERF_COUNTER_HW_BRANCH_MISSES};
+    for (int i = 0; i < NUM_COUNTERS; ++i) {
+        perf_event_attr attr;
+        init_event_attr(&attr, COUNTERS[i]);
+        attr.read_format = PERF_FORMAT_GROUP;
+        // the user space only, which needs a perf_event_paranoid of at most 2
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        _fds[i] = sys_perf_event_open(&attr, 0, -1, i == 0 ? -1 : _fds[0], 0);
+        if (_fds[i] < 0) {
+            // a part of the group would be read as another layout, go without all of them
+            for (int j = 0; j < i; ++j) {
+                close(_fds[j]);
+            }
+            _fds.fill(-1);
+            return;
+        }
+    }
+    _group_fd = _fds[0];
+}
+
+ThreadPerfCounters::~ThreadPerfCounters() {
+    for (int fd : _fds) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+}
+
+ThreadPerfCounters* ThreadPerfCounters::current() {
+    static thread_local ThreadPerfCounters counters;
+    return &counters;
+}
+
+bool ThreadPerfCounters::read(Values* values) const {
+    if (!valid()) {
+        return false;
+    }
+    // the layout of PERF_FORMAT_GROUP: the number of the events followed by their values
+    uint64_t buffer[1 + NUM_COUNTERS];
+    if (::read(_group_fd, buffer, sizeof(buffer)) != static_cast<ssize_t>(sizeof(buffer)) ||
+        buffer[0] != NUM_COUNTERS) {
+        return false;
+    }
+    for (int i = 0; i < NUM_COUNTERS; ++i) {
+        (*values)[i] = static_cast<int64_t>(buffer[1 + i]);
+    }
+    return true;
+}
+
 } // namespace doris
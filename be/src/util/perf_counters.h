@@ -23,6 +23,7 @@
 #include <gen_cpp/Metrics_types.h>
 #include <stdint.h>
 
+#include <array>
 #include <iostream>
 #include <string>
 #include <vector>
@@ -173,4 +174,36 @@ private:
     static int64_t _vm_peak;
 };
 
+// The hardware counters of the calling thread, opened once per thread as one perf event group,
+// so that they are counted over the same time and read together by one syscall. The group is
+// invalid where the events are not available, e.g. in a VM without a PMU.
+class ThreadPerfCounters {
+public:
+    enum Index {
+        CPU_CYCLES,
+        INSTRUCTIONS,
+        LLC_MISSES,
+        BRANCH_MISSES,
+        NUM_COUNTERS,
+    };
+    using Values = std::array<int64_t, NUM_COUNTERS>;
+
+    ~ThreadPerfCounters();
+
+    // The counters of the calling thread, opened by the first call of the thread.
+    static ThreadPerfCounters* current();
+
+    bool valid() const { return _group_fd >= 0; }
+
+    // Reads the values counted since the group was opened. Returns false if the group is
+    // invalid or the read fails.
+    bool read(Values* values) const;
+
+private:
+    ThreadPerfCounters();
+
+    int _group_fd = -1;
+    std::array<int, NUM_COUNTERS> _fds;
+};
+
 } // namespace doris
@@ -195,4 +195,37 @@ Status PprofUtils::generate_flamegraph(int32_t sample_seconds,
     return Status::OK();
 }
 
+Status PprofUtils::generate_flamegraph(const std::string& collapsed_stacks,
+                                       const std::string& flame_graph_tool_dir,
+                                       std::string* svg_content) {
+    std::string flamegraph_pl = flame_graph_tool_dir + "/flamegraph.pl";
+    bool exists = false;
+    RETURN_IF_ERROR(io::global_local_filesystem()->exists(flamegraph_pl, &exists));
+    if (!exists) {
+        return Status::InternalError("Missing flamegraph.pl in FlameGraph");
+    }
+
+    std::stringstream tmp_file;
+    tmp_file << config::pprof_profile_dir << "/collapsed_stacks." << getpid() << "." << rand();
+    {
+        std::ofstream out(tmp_file.str());
+        out << collapsed_stacks;
+        if (!out.good()) {
+            return Status::InternalError("Failed to write collapsed stacks to {}", tmp_file.str());
+        }
+    }
+
+    std::stringstream gen_cmd;
+    gen_cmd << flamegraph_pl << " " << tmp_file.str();
+    AgentUtils util;
+    std::string res_content;
+    bool rc = util.exec_cmd(gen_cmd.str(), &res_content, false);
+    static_cast<void>(io::global_local_filesystem()->delete_file(tmp_file.str()));
+    if (!rc) {
+        return Status::InternalError("Failed to execute flamegraph.pl: {}", res_content);
+    }
+    *svg_content = res_content;
+    return Status::OK();
+}
+
 } // namespace doris
@@ -50,6 +50,12 @@ public:
     static Status generate_flamegraph(int32_t sample_seconds,
                                       const std::string& flame_graph_tool_dir, bool return_file,
                                       std::string* svg_file_or_content);
+
+    /// generate flame graph of the collapsed stacks, one "frame;...;frame count" line per stack.
+    /// the svg content is returned via "svg_content".
+    static Status generate_flamegraph(const std::string& collapsed_stacks,
+                                      const std::string& flame_graph_tool_dir,
+                                      std::string* svg_content);
 };
 
 } // namespace doris
@@ -18,8 +18,14 @@
 #pragma once
 
 #include <brpc/http_method.h>
+#include <butil/iobuf.h>
 #include <gen_cpp/internal_service.pb.h>
 
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "common/config.h"
 #include "common/status.h"
 #include "network_util.h"
@@ -36,13 +42,96 @@ namespace doris {
 // 2G: In the default "baidu_std" brpcd, upper limit of the request and attachment length is 2G.
 constexpr size_t MIN_HTTP_BRPC_SIZE = (1ULL << 31);
 
+// Append the brpc request serialization string to the attachment, with its size before it.
+template <typename Params>
+Status serialize_request_to_attachment(Params* brpc_request, butil::IOBuf* attachment) {
+    std::string req_str;
+    if (!brpc_request->SerializeToString(&req_str)) {
+        return Status::InternalError("failed to serialize the request");
+    }
+    int64_t req_str_size = req_str.size();
+    attachment->append(&req_str_size, sizeof(req_str_size));
+    attachment->append(req_str);
+    return Status::OK();
+}
+
+// Hand `size` bytes at `data` to the attachment without a copy, with their size before them,
+// `deleter` is called once no IOBuf refers to them. They are copied if the IOBuf can not
+// refer to so many bytes.
+inline Status append_user_data_to_attachment(const char* data, size_t size,
+                                             std::function<void(void*)> deleter,
+                                             butil::IOBuf* attachment) {
+    int64_t data_size = size;
+    attachment->append(&data_size, sizeof(data_size));
+    if (size == 0) {
+        deleter(const_cast<char*>(data));
+        return Status::OK();
+    }
+    if (attachment->append_user_data(const_cast<char*>(data), size, deleter) == 0) {
+        return Status::OK();
+    }
+    try {
+        attachment->append(data, size);
+    } catch (...) {
+        LOG(WARNING) << "Try to alloc " << data_size
+                     << " bytes for append data to attachment failed. ";
+        deleter(const_cast<char*>(data));
+        return Status::MemoryAllocFailed("request embed attachment failed to memcpy {} bytes",
+                                         data_size);
+    }
+    deleter(const_cast<char*>(data));
+    return Status::OK();
+}
+
 // Embed column_values and brpc request serialization string in controller attachment.
+// The column values are moved out of the request and handed to the attachment without a copy.
+// If the block is shared by several requests, like a broadcasted block, pass its `owner`, the
+// column values are left in the block and referred by the attachment, which keeps the owner
+// alive until the rpc is done.
 template <typename Params, typename Closure>
 Status request_embed_attachment_contain_blockv2(Params* brpc_request,
-                                                std::unique_ptr<Closure>& closure) {
-    std::string column_values = std::move(*brpc_request->mutable_block()->mutable_column_values());
-    brpc_request->mutable_block()->mutable_column_values()->clear();
-    return request_embed_attachmentv2(brpc_request, column_values, closure);
+                                                std::unique_ptr<Closure>& closure,
+                                                std::shared_ptr<void> owner = nullptr) {
+    butil::IOBuf attachment;
+    if (owner == nullptr) {
+        auto* column_values =
+                new std::string(std::move(*brpc_request->mutable_block()->mutable_column_values()));
+        brpc_request->mutable_block()->mutable_column_values()->clear();
+        Status st = serialize_request_to_attachment(brpc_request, &attachment);
+        if (!st.ok()) {
+            delete column_values;
+            return st;
+        }
+        RETURN_IF_ERROR(append_user_data_to_attachment(
+                column_values->data(), column_values->size(),
+                [column_values](void*) { delete column_values; }, &attachment));
+    } else {
+        // serialize the request with a copy of the block except its column values, the
+        // request itself is not shared
+        PBlock* block = brpc_request->release_block();
+        PBlock block_meta;
+        if (block->has_be_exec_version()) {
+            block_meta.set_be_exec_version(block->be_exec_version());
+        }
+        block_meta.mutable_column_metas()->CopyFrom(block->column_metas());
+        block_meta.set_compressed(block->compressed());
+        if (block->has_compression_type()) {
+            block_meta.set_compression_type(block->compression_type());
+        }
+        if (block->has_uncompressed_size()) {
+            block_meta.set_uncompressed_size(block->uncompressed_size());
+        }
+        brpc_request->set_allocated_block(&block_meta);
+        Status st = serialize_request_to_attachment(brpc_request, &attachment);
+        static_cast<void>(brpc_request->release_block());
+        brpc_request->set_allocated_block(block);
+        RETURN_IF_ERROR(st);
+        const std::string& column_values = block->column_values();
+        RETURN_IF_ERROR(append_user_data_to_attachment(
+                column_values.data(), column_values.size(), [owner](void*) {}, &attachment));
+    }
+    closure->cntl_->request_attachment().swap(attachment);
+    return Status::OK();
 }
 
 inline bool enable_http_send_block(const PTransmitDataParams& request) {
@@ -66,10 +155,14 @@ void transmit_blockv2(PBackendService_Stub& stub, std::unique_ptr<Closure> closu
     closure.release();
 }
 
+// `owner` is the owner of a block shared by several requests, see
+// request_embed_attachment_contain_blockv2.
 template <typename Closure>
 Status transmit_block_httpv2(ExecEnv* exec_env, std::unique_ptr<Closure> closure,
-                             TNetworkAddress brpc_dest_addr) {
-    RETURN_IF_ERROR(request_embed_attachment_contain_blockv2(closure->request_.get(), closure));
+                             TNetworkAddress brpc_dest_addr,
+                             std::shared_ptr<void> owner = nullptr) {
+    RETURN_IF_ERROR(request_embed_attachment_contain_blockv2(closure->request_.get(), closure,
+                                                             std::move(owner)));
 
     //format an ipv6 address
     std::string brpc_url = get_brpc_http_url(brpc_dest_addr.hostname, brpc_dest_addr.port);
@@ -93,13 +186,7 @@ Status request_embed_attachmentv2(Params* brpc_request, const std::string& data,
     butil::IOBuf attachment;
 
     // step1: serialize brpc_request to string, and append to attachment.
-    std::string req_str;
-    if (!brpc_request->SerializeToString(&req_str)) {
-        return Status::InternalError("failed to serialize the request");
-    }
-    int64_t req_str_size = req_str.size();
-    attachment.append(&req_str_size, sizeof(req_str_size));
-    attachment.append(req_str);
+    RETURN_IF_ERROR(serialize_request_to_attachment(brpc_request, &attachment));
 
     // step2: append data to attachment and put it in the closure.
     int64_t data_size = data.size();
@@ -154,4 +241,47 @@ Status attachment_extract_request(const Params* brpc_request, brpc::Controller*
     return Status::OK();
 }
 
+// Append `msg` to `buf` as a length prefixed record, a buf may hold several records, which
+// are read back by `parse_length_prefixed_messages`.
+template <typename Message>
+Status append_length_prefixed_message(const Message& msg, butil::IOBuf* buf) {
+    butil::IOBuf body;
+    {
+        butil::IOBufAsZeroCopyOutputStream stream(&body);
+        if (!msg.SerializeToZeroCopyStream(&stream)) {
+            return Status::InternalError("failed to serialize the message");
+        }
+    }
+    int64_t body_size = body.size();
+    buf->append(&body_size, sizeof(body_size));
+    buf->append(std::move(body));
+    return Status::OK();
+}
+
+// Parse all the records appended by `append_length_prefixed_message`, the records are
+// parsed from the blocks of `buf` directly without being copied out.
+template <typename Message>
+Status parse_length_prefixed_messages(const butil::IOBuf& buf,
+                                      std::vector<std::unique_ptr<Message>>* msgs) {
+    // copy of IOBuf only increases the reference of the blocks
+    butil::IOBuf remaining = buf;
+    while (!remaining.empty()) {
+        int64_t body_size = 0;
+        if (remaining.cutn(&body_size, sizeof(body_size)) != sizeof(body_size) || body_size < 0 ||
+            remaining.size() < static_cast<size_t>(body_size)) {
+            return Status::InternalError("corrupted length prefixed message, remaining bytes {}",
+                                         remaining.size());
+        }
+        butil::IOBuf body;
+        remaining.cutn(&body, body_size);
+        butil::IOBufAsZeroCopyInputStream stream(body);
+        auto msg = std::make_unique<Message>();
+        if (!msg->ParseFromZeroCopyStream(&stream)) {
+            return Status::InternalError("failed to parse the length prefixed message");
+        }
+        msgs->emplace_back(std::move(msg));
+    }
+    return Status::OK();
+}
+
 } // namespace doris
@@ -0,0 +1,214 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/query_cpu_profiler.h"
+
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "common/logging.h"
+#include "common/stack_trace.h"
+#include "common/symbol_index.h"
+#include "util/uid_util.h"
+#include "vec/common/demangle.h"
+
+namespace doris {
+
+std::atomic<bool> QueryCpuProfiler::_s_sampling = false;
+
+namespace {
+
+// The samples beyond are dropped, about 12MB.
+constexpr size_t MAX_SAMPLES = 1 << 15;
+
+struct Sample {
+    StackTrace::FramePointers frame_pointers;
+    size_t offset;
+    size_t size;
+    std::atomic<bool> ready = false;
+};
+
+// Only one query is sampled at a time, under the lock. The query id is atomic as a thread may
+// see a stale sampling flag and compare it with the id of the next sampling.
+std::mutex g_profile_lock;
+std::atomic<int64_t> g_query_id_hi = 0;
+std::atomic<int64_t> g_query_id_lo = 0;
+std::atomic<int64_t> g_interval_ns = 0;
+std::unique_ptr<Sample[]> g_samples;
+std::atomic<size_t> g_num_samples = 0;
+// The signal handlers running, waited for before reading the samples.
+std::atomic<int> g_handlers_in_flight = 0;
+
+int profile_signal() {
+    return SIGRTMIN + 5;
+}
+
+// The timer on the cpu clock of the thread, created on first arming and deleted on thread exit.
+struct ThreadTimer {
+    ~ThreadTimer() {
+        if (created) {
+            timer_delete(timer_id);
+        }
+    }
+
+    bool created = false;
+    timer_t timer_id;
+};
+thread_local ThreadTimer t_timer;
+
+} // namespace
+
+void QueryCpuProfiler::_arm(const TUniqueId& task_id) {
+    if (task_id.hi != g_query_id_hi.load(std::memory_order_relaxed) ||
+        task_id.lo != g_query_id_lo.load(std::memory_order_relaxed)) {
+        return;
+    }
+    if (!t_timer.created) {
+        sigevent sev {};
+        sev.sigev_notify = SIGEV_THREAD_ID;
+        sev.sigev_signo = profile_signal();
+        sev._sigev_un._tid = static_cast<pid_t>(syscall(SYS_gettid));
+        if (timer_create(CLOCK_THREAD_CPUTIME_ID, &sev, &t_timer.timer_id) != 0) {
+            return;
+        }
+        t_timer.created = true;
+    }
+    int64_t interval_ns = g_interval_ns.load(std::memory_order_relaxed);
+    itimerspec spec {};
+    spec.it_interval.tv_sec = interval_ns / 1000000000;
+    spec.it_interval.tv_nsec = interval_ns % 1000000000;
+    spec.it_value = spec.it_interval;
+    if (timer_settime(t_timer.timer_id, 0, &spec, nullptr) == 0) {
+        _t_armed = true;
+    }
+}
+
+void QueryCpuProfiler::_disarm() {
+    itimerspec spec {};
+    timer_settime(t_timer.timer_id, 0, &spec, nullptr);
+    _t_armed = false;
+}
+
+void QueryCpuProfiler::_signal_handler(int sig, siginfo_t* info, void* context) {
+    int saved_errno = errno;
+    g_handlers_in_flight.fetch_add(1);
+    // The timer may still fire between the end of the sampling and the detach of the task.
+    if (_t_armed && _s_sampling.load()) {
+        size_t index = g_num_samples.fetch_add(1, std::memory_order_relaxed);
+        if (index < MAX_SAMPLES) {
+            StackTrace stack_trace(*reinterpret_cast<ucontext_t*>(context));
+            Sample& sample = g_samples[index];
+            sample.frame_pointers = stack_trace.getFramePointers();
+            sample.offset = stack_trace.getOffset();
+            sample.size = stack_trace.getSize();
+            sample.ready.store(true, std::memory_order_release);
+        }
+    }
+    g_handlers_in_flight.fetch_sub(1);
+    errno = saved_errno;
+}
+
+Status QueryCpuProfiler::profile(const TUniqueId& query_id, int seconds, int frequency,
+                                 std::string* collapsed_stacks) {
+#if defined(__ELF__) && !defined(__FreeBSD__)
+    if (seconds <= 0 || frequency <= 0 || frequency > 1000) {
+        return Status::InvalidArgument(
+                "seconds should be positive and frequency in [1, 1000], got {} and {}", seconds,
+                frequency);
+    }
+    std::unique_lock<std::mutex> lock(g_profile_lock, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        return Status::AlreadyExist("Another query is being profiled");
+    }
+
+    static Status install_status = [] {
+        struct sigaction sa {};
+        sa.sa_sigaction = _signal_handler;
+        sa.sa_flags = SA_SIGINFO | SA_RESTART;
+        sigemptyset(&sa.sa_mask);
+        if (sigaction(profile_signal(), &sa, nullptr) != 0) {
+            return Status::InternalError("Failed to install the signal handler: {}",
+                                         std::strerror(errno));
+        }
+        return Status::OK();
+    }();
+    RETURN_IF_ERROR(install_status);
+
+    g_samples.reset(new Sample[MAX_SAMPLES]);
+    g_num_samples = 0;
+    g_query_id_hi = query_id.hi;
+    g_query_id_lo = query_id.lo;
+    g_interval_ns = 1000000000L / frequency;
+    _s_sampling = true;
+    std::this_thread::sleep_for(std::chrono::seconds(seconds));
+    _s_sampling = false;
+    while (g_handlers_in_flight.load() > 0) {
+        std::this_thread::yield();
+    }
+
+    size_t num_samples = g_num_samples.load();
+    std::map<std::vector<void*>, int64_t> stacks;
+    for (size_t i = 0; i < std::min(num_samples, MAX_SAMPLES); ++i) {
+        const Sample& sample = g_samples[i];
+        if (sample.ready.load(std::memory_order_acquire)) {
+            ++stacks[std::vector<void*>(sample.frame_pointers.begin() + sample.offset,
+                                        sample.frame_pointers.begin() + sample.size)];
+        }
+    }
+    g_samples.reset();
+    LOG(INFO) << "Sampled " << num_samples << " cpu stacks of query " << print_id(query_id)
+              << ", dropped " << (num_samples > MAX_SAMPLES ? num_samples - MAX_SAMPLES : 0);
+
+    auto symbol_index = SymbolIndex::instance();
+    std::unordered_map<void*, std::string> symbols;
+    collapsed_stacks->clear();
+    for (const auto& [frames, count] : stacks) {
+        // From the root to the leaf.
+        for (auto it = frames.rbegin(); it != frames.rend(); ++it) {
+            auto [symbol_it, inserted] = symbols.try_emplace(*it);
+            if (inserted) {
+                const auto* symbol = symbol_index->findSymbol(*it);
+                symbol_it->second = symbol ? demangle(symbol->name) : "?";
+                // ';' separates the frames of collapsed stacks.
+                std::replace(symbol_it->second.begin(), symbol_it->second.end(), ';', ':');
+            }
+            if (it != frames.rbegin()) {
+                collapsed_stacks->push_back(';');
+            }
+            collapsed_stacks->append(symbol_it->second);
+        }
+        collapsed_stacks->append(" " + std::to_string(count) + "\n");
+    }
+    return Status::OK();
+#else
+    return Status::NotSupported("Query cpu profiling is only supported on ELF platforms");
+#endif
+}
+
+} // namespace doris
@@ -0,0 +1,66 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <gen_cpp/Types_types.h>
+#include <signal.h>
+
+#include <atomic>
+#include <string>
+
+#include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/status.h"
+
+namespace doris {
+
+// Samples the cpu stacks of the threads running one query. While the query is sampled, a thread
+// attaching a task of the query in its ThreadContext arms a timer on its own cpu clock, whose
+// signal captures the stack of the thread, and disarms it when it detaches the task. So only
+// the pipeline tasks and the scanners of the query are sampled, whatever else runs in the
+// process. The stacks are symbolized after the sampling, out of the signal handler.
+class QueryCpuProfiler {
+public:
+    // Samples the threads of the query `frequency` times per cpu second during `seconds`, and
+    // returns the collapsed stacks, one "root;...;leaf count" line per distinct stack, which
+    // is the input of flamegraph.pl. Only one query is sampled at a time.
+    static Status profile(const TUniqueId& query_id, int seconds, int frequency,
+                          std::string* collapsed_stacks);
+
+    // Hooks of ThreadContext::attach_task() and detach_task().
+    static void on_attach_task(const TUniqueId& task_id) {
+        if (UNLIKELY(_s_sampling.load(std::memory_order_relaxed))) {
+            _arm(task_id);
+        }
+    }
+    static void on_detach_task() {
+        if (UNLIKELY(_t_armed)) {
+            _disarm();
+        }
+    }
+
+private:
+    static void _arm(const TUniqueId& task_id);
+    static void _disarm();
+    static void _signal_handler(int sig, siginfo_t* info, void* context);
+
+    static std::atomic<bool> _s_sampling;
+    // Whether the timer of the thread is armed.
+    static inline thread_local bool _t_armed = false;
+};
+
+} // namespace doris
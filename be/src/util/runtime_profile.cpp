@@ -28,6 +28,7 @@
 #include <algorithm>
 #include <iomanip>
 #include <iostream>
+#include <tuple>
 
 #include "common/object_pool.h"
 #include "util/container_util.hpp"
@@ -69,10 +70,11 @@ void RuntimeProfile::merge(RuntimeProfile* other) {
 
         for (src_iter = other->_counter_map.begin(); src_iter != other->_counter_map.end();
              ++src_iter) {
-            dst_iter = _counter_map.find(src_iter->first);
+            bool inserted = false;
+            std::tie(dst_iter, inserted) = _counter_map.try_emplace(src_iter->first, nullptr);
 
-            if (dst_iter == _counter_map.end()) {
-                _counter_map[src_iter->first] = _pool->add(
+            if (inserted) {
+                dst_iter->second = _pool->add(
                         new Counter(src_iter->second->type(), src_iter->second->value()));
             } else {
                 DCHECK(dst_iter->second->type() == src_iter->second->type());
@@ -91,10 +93,8 @@ void RuntimeProfile::merge(RuntimeProfile* other) {
 
         for (child_counter_src_itr = other->_child_counter_map.begin();
              child_counter_src_itr != other->_child_counter_map.end(); ++child_counter_src_itr) {
-            std::set<std::string>* child_counters = find_or_insert(
-                    &_child_counter_map, child_counter_src_itr->first, std::set<std::string>());
-            child_counters->insert(child_counter_src_itr->second.begin(),
-                                   child_counter_src_itr->second.end());
+            _child_counter_map[child_counter_src_itr->first].insert(
+                    child_counter_src_itr->second.begin(), child_counter_src_itr->second.end());
         }
     }
 
@@ -141,11 +141,10 @@ void RuntimeProfile::update(const std::vector<TRuntimeProfileNode>& nodes, int*
 
         for (int i = 0; i < node.counters.size(); ++i) {
             const TCounter& tcounter = node.counters[i];
-            CounterMap::iterator j = _counter_map.find(tcounter.name);
+            auto [j, inserted] = _counter_map.try_emplace(tcounter.name, nullptr);
 
-            if (j == _counter_map.end()) {
-                _counter_map[tcounter.name] =
-                        _pool->add(new Counter(tcounter.type, tcounter.value));
+            if (inserted) {
+                j->second = _pool->add(new Counter(tcounter.type, tcounter.value));
             } else {
                 if (j->second->type() != tcounter.type) {
                     LOG(ERROR) << "Cannot update counters with the same name (" << j->first
@@ -160,10 +159,8 @@ void RuntimeProfile::update(const std::vector<TRuntimeProfileNode>& nodes, int*
 
         for (child_counter_src_itr = node.child_counters_map.begin();
              child_counter_src_itr != node.child_counters_map.end(); ++child_counter_src_itr) {
-            std::set<std::string>* child_counters = find_or_insert(
-                    &_child_counter_map, child_counter_src_itr->first, std::set<std::string>());
-            child_counters->insert(child_counter_src_itr->second.begin(),
-                                   child_counter_src_itr->second.end());
+            _child_counter_map[child_counter_src_itr->first].insert(
+                    child_counter_src_itr->second.begin(), child_counter_src_itr->second.end());
         }
     }
 
@@ -363,23 +360,29 @@ const std::string* RuntimeProfile::get_info_string(const std::string& key) {
     return &it->second;
 }
 
-#define ADD_COUNTER_IMPL(NAME, T)                                                                  \
-    RuntimeProfile::T* RuntimeProfile::NAME(const std::string& name, TUnit::type unit,             \
-                                            const std::string& parent_counter_name,                \
-                                            int64_t level) {                                       \
-        DCHECK_EQ(_is_averaged_profile, false);                                                    \
-        std::lock_guard<std::mutex> l(_counter_map_lock);                                          \
-        if (_counter_map.find(name) != _counter_map.end()) {                                       \
-            return reinterpret_cast<T*>(_counter_map[name]);                                       \
-        }                                                                                          \
-        DCHECK(parent_counter_name == ROOT_COUNTER ||                                              \
-               _counter_map.find(parent_counter_name) != _counter_map.end());                      \
-        T* counter = _pool->add(new T(unit, level));                                               \
-        _counter_map[name] = counter;                                                              \
-        std::set<std::string>* child_counters =                                                    \
-                find_or_insert(&_child_counter_map, parent_counter_name, std::set<std::string>()); \
-        child_counters->insert(name);                                                              \
-        return counter;                                                                            \
+template <typename CreateCounter>
+RuntimeProfile::Counter* RuntimeProfile::_add_counter_unlocked(
+        const std::string& name, const std::string& parent_counter_name, CreateCounter&& create) {
+    // One lookup of each map, the counters of all the instances of all the operators are added
+    // through here.
+    auto [it, inserted] = _counter_map.try_emplace(name, nullptr);
+    if (!inserted) {
+        return it->second;
+    }
+    DCHECK(parent_counter_name == ROOT_COUNTER || _counter_map.contains(parent_counter_name));
+    it->second = create();
+    _child_counter_map[parent_counter_name].insert(name);
+    return it->second;
+}
+
+#define ADD_COUNTER_IMPL(NAME, T)                                                                 \
+    RuntimeProfile::T* RuntimeProfile::NAME(const std::string& name, TUnit::type unit,            \
+                                            const std::string& parent_counter_name,               \
+                                            int64_t level) {                                      \
+        DCHECK_EQ(_is_averaged_profile, false);                                                   \
+        std::lock_guard<std::mutex> l(_counter_map_lock);                                         \
+        return reinterpret_cast<T*>(_add_counter_unlocked(                                        \
+                name, parent_counter_name, [&]() { return _pool->add(new T(unit, level)); }));    \
     }
 
 //ADD_COUNTER_IMPL(AddCounter, Counter);
@@ -403,9 +406,7 @@ std::shared_ptr<RuntimeProfile::HighWaterMarkCounter> RuntimeProfile::AddSharedH
 
     // it's OK to insert shared counter to _counter_map, cuz _counter_map is not the owner of counters
     _counter_map[name] = counter.get();
-    std::set<std::string>* child_counters =
-            find_or_insert(&_child_counter_map, parent_counter_name, std::set<std::string>());
-    child_counters->insert(name);
+    _child_counter_map[parent_counter_name].insert(name);
     return counter;
 }
 
@@ -413,40 +414,20 @@ RuntimeProfile::Counter* RuntimeProfile::add_counter(const std::string& name, TU
                                                      const std::string& parent_counter_name,
                                                      int64_t level) {
     std::lock_guard<std::mutex> l(_counter_map_lock);
-
-    // TODO(yingchun): Can we ensure that 'name' is not exist in '_counter_map'? Use CHECK instead?
-    if (_counter_map.find(name) != _counter_map.end()) {
-        // TODO: should we make sure that we don't return existing derived counters?
-        return _counter_map[name];
-    }
-
-    DCHECK(parent_counter_name == ROOT_COUNTER ||
-           _counter_map.find(parent_counter_name) != _counter_map.end());
-    Counter* counter = _pool->add(new Counter(type, 0, level));
-    _counter_map[name] = counter;
-    std::set<std::string>* child_counters =
-            find_or_insert(&_child_counter_map, parent_counter_name, std::set<std::string>());
-    child_counters->insert(name);
-    return counter;
+    // TODO: should we make sure that we don't return existing derived counters?
+    return _add_counter_unlocked(name, parent_counter_name,
+                                 [&]() { return _pool->add(new Counter(type, 0, level)); });
 }
 
 RuntimeProfile::NonZeroCounter* RuntimeProfile::add_nonzero_counter(
         const std::string& name, TUnit::type type, const std::string& parent_counter_name,
         int64_t level) {
     std::lock_guard<std::mutex> l(_counter_map_lock);
-    if (_counter_map.find(name) != _counter_map.end()) {
-        DCHECK(dynamic_cast<NonZeroCounter*>(_counter_map[name]));
-        return static_cast<NonZeroCounter*>(_counter_map[name]);
-    }
-
-    DCHECK(parent_counter_name == ROOT_COUNTER ||
-           _counter_map.find(parent_counter_name) != _counter_map.end());
-    NonZeroCounter* counter = _pool->add(new NonZeroCounter(type, level, parent_counter_name));
-    _counter_map[name] = counter;
-    std::set<std::string>* child_counters =
-            find_or_insert(&_child_counter_map, parent_counter_name, std::set<std::string>());
-    child_counters->insert(name);
-    return counter;
+    Counter* counter = _add_counter_unlocked(name, parent_counter_name, [&]() {
+        return _pool->add(new NonZeroCounter(type, level, parent_counter_name));
+    });
+    DCHECK(dynamic_cast<NonZeroCounter*>(counter));
+    return static_cast<NonZeroCounter*>(counter);
 }
 
 RuntimeProfile::DerivedCounter* RuntimeProfile::add_derived_counter(
@@ -454,26 +435,18 @@ RuntimeProfile::DerivedCounter* RuntimeProfile::add_derived_counter(
         const std::string& parent_counter_name) {
     std::lock_guard<std::mutex> l(_counter_map_lock);
 
-    if (_counter_map.find(name) != _counter_map.end()) {
+    if (_counter_map.contains(name)) {
         return nullptr;
     }
-
-    DerivedCounter* counter = _pool->add(new DerivedCounter(type, counter_fn));
-    _counter_map[name] = counter;
-    std::set<std::string>* child_counters =
-            find_or_insert(&_child_counter_map, parent_counter_name, std::set<std::string>());
-    child_counters->insert(name);
-    return counter;
+    return static_cast<DerivedCounter*>(_add_counter_unlocked(name, parent_counter_name, [&]() {
+        return _pool->add(new DerivedCounter(type, counter_fn));
+    }));
 }
 
 RuntimeProfile::Counter* RuntimeProfile::get_counter(const std::string& name) {
     std::lock_guard<std::mutex> l(_counter_map_lock);
-
-    if (_counter_map.find(name) != _counter_map.end()) {
-        return _counter_map[name];
-    }
-
-    return nullptr;
+    auto it = _counter_map.find(name);
+    return it != _counter_map.end() ? it->second : nullptr;
 }
 
 void RuntimeProfile::get_counters(const std::string& name, std::vector<Counter*>* counters) {
@@ -571,14 +544,24 @@ void RuntimeProfile::pretty_print(std::ostream* s, const std::string& prefix) co
     }
 }
 
+size_t RuntimeProfile::_num_nodes() const {
+    std::lock_guard<std::mutex> l(_children_lock);
+    size_t num_nodes = 1;
+    for (const auto& [child, indent] : _children) {
+        num_nodes += child->_num_nodes();
+    }
+    return num_nodes;
+}
+
 void RuntimeProfile::to_thrift(TRuntimeProfileTree* tree) {
     tree->nodes.clear();
+    // Reserve the nodes of the whole tree at once, the profiles of the instances are large and
+    // every reallocation moves all the nodes converted so far.
+    tree->nodes.reserve(_num_nodes());
     to_thrift(&tree->nodes);
 }
 
 void RuntimeProfile::to_thrift(std::vector<TRuntimeProfileNode>* nodes) {
-    nodes->reserve(nodes->size() + _children.size());
-
     int index = nodes->size();
     nodes->push_back(TRuntimeProfileNode());
     TRuntimeProfileNode& node = (*nodes)[index];
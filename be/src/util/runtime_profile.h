@@ -552,6 +552,15 @@ private:
     // On return, *idx points to the node immediately following this subtree.
     void update(const std::vector<TRuntimeProfileNode>& nodes, int* idx);
 
+    // Returns the counter of the name, or registers the one made by create() as a child of
+    // the parent counter. _counter_map_lock must be held.
+    template <typename CreateCounter>
+    Counter* _add_counter_unlocked(const std::string& name, const std::string& parent_counter_name,
+                                   CreateCounter&& create);
+
+    // The number of profiles of the tree rooted at this profile.
+    size_t _num_nodes() const;
+
     // Helper function to compute compute the fraction of the total time spent in
     // this profile and its children.
     // Called recursively.
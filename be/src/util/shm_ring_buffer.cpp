@@ -0,0 +1,216 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/shm_ring_buffer.h"
+
+#include <fcntl.h>
+#include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/message_lite.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#include "common/logging.h"
+#include "util/errno.h"
+
+namespace doris {
+
+struct ShmRingBuffer::Header {
+    static constexpr uint64_t MAGIC = 0x444f524953484d52; // "DORISHMR"
+
+    uint64_t magic;
+    uint64_t capacity;
+    // written by the producer only
+    alignas(64) std::atomic<uint64_t> head;
+    // written by the consumer only
+    alignas(64) std::atomic<uint64_t> tail;
+};
+
+ShmRingBuffer::~ShmRingBuffer() {
+    if (_header != nullptr) {
+        munmap(_header, _mapped_size);
+    }
+    if (_owner) {
+        shm_unlink(_name.c_str());
+    }
+}
+
+Status ShmRingBuffer::_map(int fd, size_t size) {
+    void* addr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        return Status::InternalError("failed to mmap shm ring {}: {}", _name,
+                                     errno_to_string(errno));
+    }
+    _mapped_size = size;
+    _header = static_cast<Header*>(addr);
+    _data = static_cast<char*>(addr) + sizeof(Header);
+    return Status::OK();
+}
+
+Status ShmRingBuffer::create(const std::string& name, int64_t capacity,
+                             std::unique_ptr<ShmRingBuffer>* ring) {
+    if (capacity <= 0) {
+        return Status::InvalidArgument("invalid shm ring capacity {}", capacity);
+    }
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        return Status::InternalError("failed to create shm ring {}: {}", name,
+                                     errno_to_string(errno));
+    }
+    std::unique_ptr<ShmRingBuffer> res(new ShmRingBuffer(name, true));
+    size_t size = sizeof(Header) + capacity;
+    if (ftruncate(fd, size) != 0) {
+        close(fd);
+        return Status::InternalError("failed to resize shm ring {} to {}: {}", name, size,
+                                     errno_to_string(errno));
+    }
+    RETURN_IF_ERROR(res->_map(fd, size));
+    res->_capacity = capacity;
+    res->_header->capacity = capacity;
+    res->_header->head.store(0, std::memory_order_relaxed);
+    res->_header->tail.store(0, std::memory_order_relaxed);
+    // publish the ring after it is initialized
+    std::atomic_thread_fence(std::memory_order_release);
+    res->_header->magic = Header::MAGIC;
+    *ring = std::move(res);
+    return Status::OK();
+}
+
+Status ShmRingBuffer::open(const std::string& name, std::unique_ptr<ShmRingBuffer>* ring) {
+    int fd = shm_open(name.c_str(), O_RDWR, 0600);
+    if (fd < 0) {
+        return Status::InternalError("failed to open shm ring {}: {}", name,
+                                     errno_to_string(errno));
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= static_cast<off_t>(sizeof(Header))) {
+        close(fd);
+        return Status::InternalError("invalid shm ring {}", name);
+    }
+    std::unique_ptr<ShmRingBuffer> res(new ShmRingBuffer(name, false));
+    RETURN_IF_ERROR(res->_map(fd, st.st_size));
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (res->_header->magic != Header::MAGIC ||
+        res->_header->capacity + sizeof(Header) != static_cast<uint64_t>(st.st_size)) {
+        return Status::InternalError("corrupted shm ring {}", name);
+    }
+    res->_capacity = res->_header->capacity;
+    *ring = std::move(res);
+    return Status::OK();
+}
+
+int64_t ShmRingBuffer::free_bytes() const {
+    return _capacity - (_header->head.load(std::memory_order_relaxed) -
+                        _header->tail.load(std::memory_order_acquire));
+}
+
+bool ShmRingBuffer::try_write(const butil::IOBuf& data) {
+    if (static_cast<int64_t>(data.size()) > free_bytes()) {
+        return false;
+    }
+    uint64_t head = _header->head.load(std::memory_order_relaxed);
+    size_t num_blocks = data.backing_block_num();
+    for (size_t i = 0; i < num_blocks; ++i) {
+        auto piece = data.backing_block(i);
+        size_t copied = 0;
+        while (copied < piece.size()) {
+            auto offset = head % _capacity;
+            auto len = std::min<size_t>(piece.size() - copied, _capacity - offset);
+            memcpy(_data + offset, piece.data() + copied, len);
+            copied += len;
+            head += len;
+        }
+    }
+    _header->head.store(head, std::memory_order_release);
+    return true;
+}
+
+void ShmRingBuffer::_copy_out(uint64_t pos, void* dst, size_t len) const {
+    auto offset = pos % _capacity;
+    auto first = std::min<size_t>(len, _capacity - offset);
+    memcpy(dst, _data + offset, first);
+    memcpy(static_cast<char*>(dst) + first, _data, len - first);
+}
+
+Status ShmRingBuffer::read_message(google::protobuf::MessageLite* msg) {
+    uint64_t tail = _header->tail.load(std::memory_order_relaxed);
+    uint64_t head = _header->head.load(std::memory_order_acquire);
+    int64_t msg_size = 0;
+    if (head - tail < sizeof(msg_size)) {
+        return Status::InternalError("shm ring {} is empty", _name);
+    }
+    _copy_out(tail, &msg_size, sizeof(msg_size));
+    if (msg_size < 0 || head - tail - sizeof(msg_size) < static_cast<uint64_t>(msg_size)) {
+        return Status::InternalError("corrupted message in shm ring {}, size {}", _name,
+                                     msg_size);
+    }
+    auto begin = tail + sizeof(msg_size);
+    auto offset = begin % _capacity;
+    bool parsed = false;
+    if (offset + msg_size <= _capacity) {
+        parsed = msg->ParseFromArray(_data + offset, msg_size);
+    } else {
+        // the message wraps around the end of the ring
+        auto first = _capacity - offset;
+        google::protobuf::io::ArrayInputStream first_stream(_data + offset, first);
+        google::protobuf::io::ArrayInputStream second_stream(_data, msg_size - first);
+        google::protobuf::io::ZeroCopyInputStream* streams[] = {&first_stream, &second_stream};
+        google::protobuf::io::ConcatenatingInputStream stream(streams, 2);
+        parsed = msg->ParseFromZeroCopyStream(&stream);
+    }
+    _header->tail.store(begin + msg_size, std::memory_order_release);
+    if (!parsed) {
+        return Status::InternalError("failed to parse message in shm ring {}", _name);
+    }
+    return Status::OK();
+}
+
+void ShmRingBuffer::append_doorbell(const std::string& name, int64_t num_messages,
+                                    butil::IOBuf* buf) {
+    int64_t magic = DOORBELL_MAGIC;
+    int64_t name_size = name.size();
+    buf->append(&magic, sizeof(magic));
+    buf->append(&num_messages, sizeof(num_messages));
+    buf->append(&name_size, sizeof(name_size));
+    buf->append(name);
+}
+
+bool ShmRingBuffer::is_doorbell(const butil::IOBuf& buf) {
+    int64_t magic = 0;
+    return buf.copy_to(&magic, sizeof(magic)) == sizeof(magic) && magic == DOORBELL_MAGIC;
+}
+
+Status ShmRingBuffer::parse_doorbell(const butil::IOBuf& buf, std::string* name,
+                                     int64_t* num_messages) {
+    int64_t header[3];
+    if (buf.copy_to(header, sizeof(header)) != sizeof(header) || header[0] != DOORBELL_MAGIC ||
+        header[1] < 0 || header[2] < 0 ||
+        buf.size() != sizeof(header) + static_cast<size_t>(header[2])) {
+        return Status::InternalError("corrupted shm ring doorbell");
+    }
+    *num_messages = header[1];
+    buf.copy_to(name, header[2], sizeof(header));
+    return Status::OK();
+}
+
+} // namespace doris
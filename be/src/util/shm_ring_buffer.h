@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <butil/iobuf.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+#include <string>
+
+#include "common/status.h"
+
+namespace google::protobuf {
+class MessageLite;
+} // namespace google::protobuf
+
+namespace doris {
+
+// A single producer single consumer byte ring in POSIX shared memory, which lets two
+// processes on the same host pass data without going through sockets.
+// The producer creates the ring and removes its name on destruction, the consumer opens
+// the ring by name. The records are length prefixed messages, the same as the ones written
+// by `append_length_prefixed_message`, so the consumer parses them from the mapping directly.
+class ShmRingBuffer {
+public:
+    ~ShmRingBuffer();
+
+    ShmRingBuffer(const ShmRingBuffer&) = delete;
+    ShmRingBuffer& operator=(const ShmRingBuffer&) = delete;
+
+    static Status create(const std::string& name, int64_t capacity,
+                         std::unique_ptr<ShmRingBuffer>* ring);
+
+    static Status open(const std::string& name, std::unique_ptr<ShmRingBuffer>* ring);
+
+    // Producer side, append `data` to the ring as is. Return false if there is no room.
+    bool try_write(const butil::IOBuf& data);
+
+    // Consumer side, parse the next length prefixed message and release its room.
+    Status read_message(google::protobuf::MessageLite* msg);
+
+    int64_t free_bytes() const;
+
+    const std::string& name() const { return _name; }
+
+    // The doorbell tells the consumer how many messages are written into which ring, it takes
+    // the place of a batch of length prefixed messages in the request attachment. It starts
+    // with a negative length, which never appears in a batch.
+    static constexpr int64_t DOORBELL_MAGIC = -0x53484d52; // "SHMR"
+
+    static void append_doorbell(const std::string& name, int64_t num_messages, butil::IOBuf* buf);
+
+    static bool is_doorbell(const butil::IOBuf& buf);
+
+    static Status parse_doorbell(const butil::IOBuf& buf, std::string* name,
+                                 int64_t* num_messages);
+
+private:
+    struct Header;
+
+    ShmRingBuffer(std::string name, bool is_owner) : _name(std::move(name)), _owner(is_owner) {}
+
+    Status _map(int fd, size_t size);
+
+    void _copy_out(uint64_t pos, void* dst, size_t len) const;
+
+    const std::string _name;
+    const bool _owner;
+    size_t _mapped_size = 0;
+    Header* _header = nullptr;
+    char* _data = nullptr;
+    uint64_t _capacity = 0;
+};
+
+} // namespace doris
@@ -141,6 +141,70 @@ bool contain_byte(const T* __restrict data, const size_t length, const signed ch
     return nullptr != std::memchr(reinterpret_cast<const void*>(data), byte, length);
 }
 
+/// Return the mask of the bytes equal to `c1` or `c2` in the 32 bytes at `data`, bit i for data[i]
+inline uint32_t bytes32_eq_mask(const uint8_t* data, uint8_t c1, uint8_t c2) {
+#ifdef __AVX2__
+    auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data));
+    return static_cast<uint32_t>(_mm256_movemask_epi8(
+            _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(static_cast<char>(c1))),
+                            _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(static_cast<char>(c2))))));
+#elif defined(__SSE2__) || defined(__aarch64__)
+    auto v1 = _mm_set1_epi8(static_cast<char>(c1));
+    auto v2 = _mm_set1_epi8(static_cast<char>(c2));
+    auto low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    auto high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16));
+    return static_cast<uint32_t>(_mm_movemask_epi8(
+                   _mm_or_si128(_mm_cmpeq_epi8(low, v1), _mm_cmpeq_epi8(low, v2)))) |
+           (static_cast<uint32_t>(_mm_movemask_epi8(
+                    _mm_or_si128(_mm_cmpeq_epi8(high, v1), _mm_cmpeq_epi8(high, v2))))
+            << 16);
+#else
+    uint32_t mask = 0;
+    for (std::size_t i = 0; i < 32; ++i) {
+        mask |= static_cast<uint32_t>(data[i] == c1 || data[i] == c2) << i;
+    }
+    return mask;
+#endif
+}
+
+/// Call `func(offset)` for the offset of every byte equal to `c` in [data, data + size), in order.
+/// The bytes are compared 32 at a time and the matches are taken from the mask, so that no
+/// byte is branched on.
+template <typename Func>
+inline void for_each_byte(const uint8_t* data, size_t size, uint8_t c, Func&& func) {
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        uint32_t mask = bytes32_eq_mask(data + i, c, c);
+        while (mask != 0) {
+            func(i + __builtin_ctz(mask));
+            mask &= mask - 1;
+        }
+    }
+    for (; i < size; ++i) {
+        if (data[i] == c) {
+            func(i);
+        }
+    }
+}
+
+/// Return the first byte equal to `c1` or `c2` in [data, data + size), nullptr if there is none.
+/// Unlike memchr it is inlined, which matters for the short fields of text lines.
+inline const uint8_t* find_first_of(const uint8_t* data, size_t size, uint8_t c1, uint8_t c2) {
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32) {
+        uint32_t mask = bytes32_eq_mask(data + i, c1, c2);
+        if (mask != 0) {
+            return data + i + __builtin_ctz(mask);
+        }
+    }
+    for (; i < size; ++i) {
+        if (data[i] == c1 || data[i] == c2) {
+            return data + i;
+        }
+    }
+    return nullptr;
+}
+
 inline size_t find_one(const std::vector<uint8_t>& vec, size_t start) {
     return find_byte<uint8_t>(vec, start, 1);
 }
@@ -28,6 +28,7 @@
 // IWYU pragma: no_include <bits/std_abs.h>
 #include <cmath> // IWYU pragma: keep
 #include <cstdint>
+#include <cstring>
 #include <limits>
 #include <map>
 #include <string>
@@ -68,7 +69,6 @@ struct Decimal;
 //  - lookup table for converting character to digit
 // Improvements (TODO):
 //  - Validate input using _sidd_compare_ranges
-//  - Since we know the length, we can parallelize this: i.e. result = 100*s[0] + 10*s[1] + s[2]
 class StringParser {
 public:
     enum ParseResult { PARSE_SUCCESS = 0, PARSE_FAILURE, PARSE_OVERFLOW, PARSE_UNDERFLOW };
@@ -126,6 +126,32 @@ public:
         return string_to_unsigned_int_internal<T>(s + i, len - i, result);
     }
 
+    // Returns true if the bytes of the little endian 8 bytes word selected by digit_mask are
+    // all digits, and the other bytes are equal to those of separators.
+    static inline bool is_digits_word(uint64_t word, uint64_t digit_mask = ~0ULL,
+                                      uint64_t separators = 0) {
+        constexpr uint64_t high_nibbles = 0xF0F0F0F0F0F0F0F0ULL;
+        constexpr uint64_t zeros = 0x3030303030303030ULL;
+        // adding 6 to '0'-'9' does not change the high nibble, and no carry crosses the bytes
+        // once the high nibbles are checked
+        return (word & ~digit_mask) == separators &&
+               (word & high_nibbles & digit_mask) == (zeros & digit_mask) &&
+               ((word + (0x0606060606060606ULL & digit_mask)) & high_nibbles & digit_mask) ==
+                       (zeros & digit_mask);
+    }
+
+    // The value of the 8 digits of a little endian word, the first digit is the most
+    // significant one.
+    static inline uint32_t parse_eight_digits(uint64_t word) {
+        constexpr uint64_t mask = 0x000000FF000000FFULL;
+        constexpr uint64_t mul1 = 100 + (1000000ULL << 32);
+        constexpr uint64_t mul2 = 1 + (10000ULL << 32);
+        word -= 0x3030303030303030ULL;
+        word = (word * 10) + (word >> 8);
+        return static_cast<uint32_t>(((word & mask) * mul1 + ((word >> 16) & mask) * mul2) >>
+                                     32);
+    }
+
     // Convert a string s representing a number in given base into a decimal number.
     template <typename T>
     static inline T string_to_int(const char* __restrict s, int len, int base,
@@ -438,7 +464,19 @@ T StringParser::string_to_int_no_overflow(const char* __restrict s, int len, Par
         *result = PARSE_FAILURE;
         return 0;
     }
-    for (int i = 1; i < len; ++i) {
+    int i = 1;
+    // Since we know the length, convert 8 digits at a time.
+    if constexpr (sizeof(T) >= sizeof(uint32_t)) {
+        for (; i + 8 <= len; i += 8) {
+            uint64_t word;
+            memcpy(&word, s + i, sizeof(word));
+            if (!is_digits_word(word)) {
+                break;
+            }
+            val = val * 100000000 + parse_eight_digits(word);
+        }
+    }
+    for (; i < len; ++i) {
         if (LIKELY(s[i] >= '0' && s[i] <= '9')) {
             T digit = s[i] - '0';
             val = val * 10 + digit;
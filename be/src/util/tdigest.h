@@ -95,26 +95,6 @@ private:
     Weight _weight = 0;
 };
 
-struct CentroidList {
-    CentroidList(const std::vector<Centroid>& s) : iter(s.cbegin()), end(s.cend()) {}
-    std::vector<Centroid>::const_iterator iter;
-    std::vector<Centroid>::const_iterator end;
-
-    bool advance() { return ++iter != end; }
-};
-
-class CentroidListComparator {
-public:
-    CentroidListComparator() {}
-
-    bool operator()(const CentroidList& left, const CentroidList& right) const {
-        return left.iter->mean() > right.iter->mean();
-    }
-};
-
-using CentroidListQueue =
-        std::priority_queue<CentroidList, std::vector<CentroidList>, CentroidListComparator>;
-
 struct CentroidComparator {
     bool operator()(const Centroid& a, const Centroid& b) const { return a.mean() < b.mean(); }
 };
@@ -157,8 +137,9 @@ public:
             : _compression(compression),
               _max_processed(processedSize(mergedSize, compression)),
               _max_unprocessed(unprocessedSize(unmergedSize, compression)) {
-        _processed.reserve(_max_processed);
-        _unprocessed.reserve(_max_unprocessed + 1);
+        // The centroids are not reserved up to their limits, which take over 1MB with the
+        // default compression, so that the digests of the many small groups of an aggregation
+        // only hold the centroids they have.
     }
 
     TDigest(std::vector<Centroid>&& processed, std::vector<Centroid>&& unprocessed,
@@ -430,6 +411,26 @@ public:
         return true;
     }
 
+    // add the values with a weight of 1, processing the unprocessed centroids whenever they
+    // exceed their limit as add(x) does, without checking the limits after each value
+    template <typename T>
+    void add(const T* values, size_t num_values) {
+        while (num_values > 0) {
+            const size_t room = _max_unprocessed + 1 - _unprocessed.size();
+            const size_t num_batch = std::min(num_values, room);
+            for (size_t i = 0; i < num_batch; ++i) {
+                auto x = static_cast<Value>(values[i]);
+                if (!std::isnan(x)) {
+                    _unprocessed.emplace_back(x, 1);
+                    _unprocessed_weight += 1;
+                }
+            }
+            values += num_batch;
+            num_values -= num_batch;
+            processIfNecessary();
+        }
+    }
+
     void add(std::vector<Centroid>::const_iterator iter,
              std::vector<Centroid>::const_iterator end) {
         while (iter != end) {
@@ -589,34 +590,24 @@ private:
         if (tdigests.size() == 0) return;
 
         size_t total = 0;
-        CentroidListQueue pq(CentroidListComparator {});
         for (auto& td : tdigests) {
-            auto& sorted = td->_processed;
-            auto size = sorted.size();
-            if (size > 0) {
-                pq.push(CentroidList(sorted));
-                total += size;
-                _processed_weight += td->_processed_weight;
-            }
+            total += td->_processed.size();
         }
         if (total == 0) return;
 
-        if (_processed.size() > 0) {
-            pq.push(CentroidList(_processed));
-            total += _processed.size();
-        }
-
-        std::vector<Centroid> sorted;
+        total += _processed.size();
         VLOG_CRITICAL << "total " << total;
-        sorted.reserve(total);
-
-        while (!pq.empty()) {
-            auto best = pq.top();
-            pq.pop();
-            sorted.push_back(*(best.iter));
-            if (best.advance()) pq.push(best);
+        _processed.reserve(total);
+        for (auto& td : tdigests) {
+            if (td->_processed.size() > 0) {
+                _processed.insert(_processed.end(), td->_processed.cbegin(),
+                                  td->_processed.cend());
+                _processed_weight += td->_processed_weight;
+            }
         }
-        _processed = std::move(sorted);
+        // The centroids are sorted by a radix sort of all the lists appended in place, which
+        // takes linear time whatever the number of lists, instead of a heap merge of them.
+        RadixSort<TDigestRadixSortTraits>::executeLSD(_processed.data(), _processed.size());
         if (_processed.size() > 0) {
             _min = std::min(_min, _processed[0].mean());
             _max = std::max(_max, (_processed.cend() - 1)->mean());
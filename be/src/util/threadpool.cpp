@@ -21,6 +21,7 @@
 #include "util/threadpool.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <limits>
 #include <ostream>
@@ -31,6 +32,7 @@
 #include "gutil/map-util.h"
 #include "gutil/port.h"
 #include "gutil/strings/substitute.h"
+#include "runtime/thread_context.h"
 #include "util/debug/sanitizer_scopes.h"
 #include "util/scoped_cleanup.h"
 #include "util/thread.h"
@@ -674,4 +676,53 @@ std::ostream& operator<<(std::ostream& o, ThreadPoolToken::State s) {
     return o << ThreadPoolToken::state_to_string(s);
 }
 
+namespace {
+
+// state shared by run_tasks_with_caller and the pool threads helping it, a pool thread may
+// only start after all tasks are done
+struct CallerTasks {
+    CallerTasks(size_t num_tasks, std::function<void(size_t)> task)
+            : num_tasks(num_tasks), task(std::move(task)) {}
+
+    void run() {
+        for (size_t i = next++; i < num_tasks; i = next++) {
+            task(i);
+            std::lock_guard l(lock);
+            if (++finished == num_tasks) {
+                all_finished.notify_all();
+            }
+        }
+    }
+
+    const size_t num_tasks;
+    const std::function<void(size_t)> task;
+    std::atomic<size_t> next = 0;
+    std::mutex lock;
+    std::condition_variable all_finished;
+    size_t finished = 0;
+};
+
+} // namespace
+
+void run_tasks_with_caller(ThreadPool* pool, size_t num_tasks, std::function<void(size_t)> task) {
+    auto tasks = std::make_shared<CallerTasks>(num_tasks, std::move(task));
+    if (pool != nullptr && num_tasks > 1) {
+        QueryThreadContext query_thread_context;
+        query_thread_context.init_unlocked();
+        for (size_t i = 1; i < num_tasks; i++) {
+            auto st = pool->submit_func([tasks, query_thread_context]() {
+                SCOPED_ATTACH_TASK(query_thread_context);
+                tasks->run();
+            });
+            if (!st.ok()) {
+                // the calling thread runs the rest
+                break;
+            }
+        }
+    }
+    tasks->run();
+    std::unique_lock l(tasks->lock);
+    tasks->all_finished.wait(l, [&tasks]() { return tasks->finished == tasks->num_tasks; });
+}
+
 } // namespace doris
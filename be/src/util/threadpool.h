@@ -514,4 +514,10 @@ private:
     void operator=(const ThreadPoolToken&) = delete;
 };
 
+// Runs task(0), ..., task(num_tasks - 1) on the calling thread and on the threads of pool, and
+// returns when all of them are done. The calling thread keeps taking the tasks no other thread
+// has started, so it only waits for tasks that are running, even when it is a thread of pool
+// itself. The tasks run by pool are attached to the query thread context of the calling thread.
+void run_tasks_with_caller(ThreadPool* pool, size_t num_tasks, std::function<void(size_t)> task);
+
 } // namespace doris
@@ -30,6 +30,16 @@ constexpr uint32_t LUT_END_YEAR = 2030;
 constexpr uint32_t NUM_MONTHS = 12;
 constexpr uint32_t NUM_DAYS = 31;
 
+// The days in the months of the common and the leap years, indexed by the 4 bits month field of
+// the packed dates, so the invalid months 0 and 13 to 15 have no day.
+inline constexpr uint8_t DAYS_IN_MONTH_TABLE[2][16] = {
+        {0, 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31, 0, 0, 0},
+        {0, 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31, 0, 0, 0}};
+
+// The first month of the quarter of a month, indexed like DAYS_IN_MONTH_TABLE.
+inline constexpr uint8_t QUARTER_FIRST_MONTH_TABLE[16] = {0, 1, 1, 1, 4, 4,  4,  7,
+                                                          7, 7, 10, 10, 10, 0, 0, 0};
+
 uint32_t year_week(uint16_t yy, uint8_t month, uint8_t day);
 
 uint32_t calc_daynr(uint16_t year, uint8_t month, uint8_t day);
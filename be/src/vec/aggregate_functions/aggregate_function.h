@@ -203,6 +203,16 @@ public:
     virtual void add_batch_range(size_t batch_begin, size_t batch_end, AggregateDataPtr place,
                                  const IColumn** columns, Arena* arena, bool has_null = false) = 0;
 
+    /** Adds the rows in [batch_begin, batch_end) whose byte in null_map is 0 to a single place.
+      *  The nullable wrappers call it with the null map of the argument, so that a function can
+      *  reduce the batch with the null map as a mask instead of adding the rows one by one.
+      */
+    virtual void add_batch_single_place_with_null_map(size_t batch_begin, size_t batch_end,
+                                                      AggregateDataPtr place,
+                                                      const IColumn** columns,
+                                                      const UInt8* null_map,
+                                                      Arena* arena) const = 0;
+
     // only used at window function
     virtual void add_range_single_place(int64_t partition_start, int64_t partition_end,
                                         int64_t frame_start, int64_t frame_end,
@@ -310,6 +320,16 @@ public:
         }
     }
 
+    void add_batch_single_place_with_null_map(size_t batch_begin, size_t batch_end,
+                                              AggregateDataPtr place, const IColumn** columns,
+                                              const UInt8* null_map, Arena* arena) const override {
+        for (size_t i = batch_begin; i < batch_end; ++i) {
+            if (!null_map[i]) {
+                assert_cast<const Derived*>(this)->add(place, columns, i, arena);
+            }
+        }
+    }
+
     void insert_result_into_vec(const std::vector<AggregateDataPtr>& places, const size_t offset,
                                 IColumn& to, const size_t num_rows) const override {
         for (size_t i = 0; i != num_rows; ++i) {
@@ -30,6 +30,7 @@
 #include <vector>
 
 #include "runtime/decimalv2_value.h"
+#include "util/simd/bits.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
 #include "vec/columns/column_fixed_length_object.h"
@@ -154,6 +155,28 @@ public:
         ++this->data(place).count;
     }
 
+    void add_batch_single_place_with_null_map(size_t batch_begin, size_t batch_end,
+                                              AggregateDataPtr place, const IColumn** columns,
+                                              const UInt8* null_map, Arena*) const override {
+#ifdef __clang__
+#pragma clang fp reassociate(on)
+#endif
+        const auto* __restrict values =
+                assert_cast<const ColVecType&>(*columns[0]).get_data().data();
+        // a select in place of a branch on the null map, which the compiler vectorizes
+        decltype(this->data(place).sum) batch_sum {};
+        for (size_t i = batch_begin; i < batch_end; ++i) {
+            if constexpr (IsDecimalNumber<T>) {
+                batch_sum += null_map[i] ? typename T::NativeType {} : values[i].value;
+            } else {
+                batch_sum += null_map[i] ? T {} : values[i];
+            }
+        }
+        this->data(place).sum += batch_sum;
+        this->data(place).count += simd::count_zero_num(
+                reinterpret_cast<const int8_t*>(null_map + batch_begin), batch_end - batch_begin);
+    }
+
     void reset(AggregateDataPtr place) const override {
         this->data(place).sum = {};
         this->data(place).count = 0;
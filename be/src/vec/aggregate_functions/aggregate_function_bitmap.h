@@ -67,6 +67,8 @@ struct AggregateFunctionBitmapUnionOp {
 
     static void add_batch(BitmapValue& res, std::vector<const BitmapValue*>& data, bool& is_first) {
         res.fastunion(data);
+        // the later bitmaps are unioned into res instead of replacing it
+        is_first = false;
     }
 
     static void merge(BitmapValue& res, const BitmapValue& data, bool& is_first) {
@@ -196,10 +198,7 @@ public:
             auto& col = assert_cast<const ColumnBitmap&>(column);
             const size_t num_rows = column.size();
             auto* data = col.get_data().data();
-
-            for (size_t i = 0; i != num_rows; ++i) {
-                this->data(place).merge(data[i]);
-            }
+            _merge_range(place, data, 0, num_rows);
         } else {
             BaseHelper::deserialize_and_merge_from_column(place, column, arena);
         }
@@ -213,9 +212,7 @@ public:
         if (version >= BITMAP_SERDE) {
             auto& col = assert_cast<const ColumnBitmap&>(column);
             auto* data = col.get_data().data();
-            for (size_t i = begin; i <= end; ++i) {
-                this->data(place).merge(data[i]);
-            }
+            _merge_range(place, data, begin, end + 1);
         } else {
             BaseHelper::deserialize_and_merge_from_column_range(place, column, begin, end, arena);
         }
@@ -282,6 +279,25 @@ public:
 
 protected:
     using IAggregateFunction::version;
+
+private:
+    // The unions merge the bitmaps of the rows at once, the other ops one by one.
+    void _merge_range(AggregateDataPtr __restrict place, const BitmapValue* data, size_t begin,
+                      size_t end) const {
+        if constexpr (std::is_same_v<Data, AggregateFunctionBitmapData<
+                                                   AggregateFunctionBitmapUnionOp>>) {
+            std::vector<const BitmapValue*> values;
+            values.reserve(end - begin);
+            for (size_t i = begin; i < end; ++i) {
+                values.push_back(&data[i]);
+            }
+            this->data(place).add_batch(values);
+        } else {
+            for (size_t i = begin; i < end; ++i) {
+                this->data(place).merge(data[i]);
+            }
+        }
+    }
 };
 
 template <typename Op>
@@ -50,6 +50,15 @@ struct AggregateFunctionBitmapAggData {
 
     void merge(const AggregateFunctionBitmapAggData& other) { value |= other.value; }
 
+    // Unions the bitmaps at once, which is faster than merging them one by one.
+    void merge_batch(const BitmapValue* values, size_t num_values) {
+        std::vector<const BitmapValue*> bitmaps(num_values);
+        for (size_t i = 0; i < num_values; ++i) {
+            bitmaps[i] = &values[i];
+        }
+        value.fastunion(bitmaps);
+    }
+
     void write(BufferWritable& buf) const { DataTypeBitMap::serialize_as_stream(value, buf); }
 
     void read(BufferReadable& buf) { DataTypeBitMap::deserialize_as_stream(value, buf); }
@@ -167,9 +176,7 @@ public:
         const size_t num_rows = column.size();
         auto* data = col.get_data().data();
 
-        for (size_t i = 0; i != num_rows; ++i) {
-            this->data(place).value |= data[i];
-        }
+        this->data(place).merge_batch(data, num_rows);
     }
 
     void deserialize_and_merge_from_column_range(AggregateDataPtr __restrict place,
@@ -179,9 +186,7 @@ public:
                 << ", begin:" << begin << ", end:" << end << ", column.size():" << column.size();
         auto& col = assert_cast<const ColumnBitmap&>(column);
         auto* data = col.get_data().data();
-        for (size_t i = begin; i <= end; ++i) {
-            this->data(place).value |= data[i];
-        }
+        this->data(place).merge_batch(data + begin, end - begin + 1);
     }
 
     void deserialize_and_merge_vec(const AggregateDataPtr* places, size_t offset,
@@ -23,6 +23,8 @@
 #include <fmt/format.h>
 #include <string.h>
 
+#include <algorithm>
+#include <limits>
 #include <memory>
 #include <vector>
 
@@ -68,6 +70,9 @@ public:
     bool has() const { return has_value; }
 
     constexpr static bool IsFixedLength = true;
+    /// Whether a batch reduces to its least or greatest value with a select in place of a branch,
+    /// which the compiler vectorizes. The NaNs keep the floats out, which compare false.
+    constexpr static bool IsBatchReducible = std::is_integral_v<T>;
 
     void insert_result_into(IColumn& to) const {
         if (has()) {
@@ -162,6 +167,25 @@ public:
         }
     }
 
+    /// Assuming IsBatchReducible and a row in [begin, end) whose byte in null_map is 0
+    template <bool less>
+    void change_if_better_with_null_map(const IColumn& column, const UInt8* __restrict null_map,
+                                        size_t begin, size_t end) {
+        const auto* __restrict values =
+                assert_cast<const ColumnVector<T>&>(column).get_data().data();
+        constexpr T identity =
+                less ? std::numeric_limits<T>::max() : std::numeric_limits<T>::min();
+        T result = identity;
+        for (size_t i = begin; i < end; ++i) {
+            T current = null_map[i] ? identity : values[i];
+            result = less ? std::min(result, current) : std::max(result, current);
+        }
+        if (!has() || (less ? result < value : result > value)) {
+            has_value = true;
+            value = result;
+        }
+    }
+
     bool is_equal_to(const Self& to) const { return has() && to.value == value; }
 
     bool is_equal_to(const IColumn& column, size_t row_num) const {
@@ -185,6 +209,7 @@ public:
     bool has() const { return has_value; }
 
     constexpr static bool IsFixedLength = true;
+    constexpr static bool IsBatchReducible = false;
 
     void insert_result_into(IColumn& to) const {
         if (has()) {
@@ -309,6 +334,7 @@ public:
     ~SingleValueDataString() = default;
 
     constexpr static bool IsFixedLength = false;
+    constexpr static bool IsBatchReducible = false;
 
     bool has() const { return size >= 0; }
 
@@ -470,6 +496,9 @@ struct AggregateFunctionMaxData : public Data {
         this->change_if_greater(column, row_num, arena);
     }
     void change_if_better(const Self& to, Arena* arena) { this->change_if_greater(to, arena); }
+    void change_if_better(const IColumn& column, const UInt8* null_map, size_t begin, size_t end) {
+        this->template change_if_better_with_null_map<false>(column, null_map, begin, end);
+    }
 
     static const char* name() { return "max"; }
 };
@@ -483,6 +512,9 @@ struct AggregateFunctionMinData : Data {
         this->change_if_less(column, row_num, arena);
     }
     void change_if_better(const Self& to, Arena* arena) { this->change_if_less(to, arena); }
+    void change_if_better(const IColumn& column, const UInt8* null_map, size_t begin, size_t end) {
+        this->template change_if_better_with_null_map<true>(column, null_map, begin, end);
+    }
 
     static const char* name() { return "min"; }
 };
@@ -531,6 +563,20 @@ public:
         this->data(place).change_if_better(*columns[0], row_num, arena);
     }
 
+    void add_batch_single_place_with_null_map(size_t batch_begin, size_t batch_end,
+                                              AggregateDataPtr place, const IColumn** columns,
+                                              const UInt8* null_map, Arena* arena) const override {
+        // min and max, but not any, reduce a batch
+        if constexpr (Data::IsBatchReducible && requires(Data& data) {
+                          data.change_if_better(*columns[0], null_map, batch_begin, batch_end);
+                      }) {
+            this->data(place).change_if_better(*columns[0], null_map, batch_begin, batch_end);
+        } else {
+            Base::add_batch_single_place_with_null_map(batch_begin, batch_end, place, columns,
+                                                       null_map, arena);
+        }
+    }
+
     void reset(AggregateDataPtr place) const override { this->data(place).reset(); }
 
     void merge(AggregateDataPtr __restrict place, ConstAggregateDataPtr rhs,
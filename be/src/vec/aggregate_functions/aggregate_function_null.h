@@ -24,6 +24,7 @@
 
 #include "common/logging.h"
 #include "common/status.h"
+#include "util/simd/bits.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/common/assert_cast.h"
@@ -243,9 +244,7 @@ public:
         bool has_null = column->has_null();
 
         if (has_null) {
-            for (size_t i = 0; i < batch_size; ++i) {
-                this->add(place, columns, i, arena);
-            }
+            _add_batch_with_null_map(0, batch_size, place, column, arena);
         } else {
             this->set_flag(place);
             const IColumn* nested_column = &column->get_nested_column();
@@ -259,9 +258,7 @@ public:
         const ColumnNullable* column = assert_cast<const ColumnNullable*>(columns[0]);
 
         if (has_null) {
-            for (size_t i = batch_begin; i <= batch_end; ++i) {
-                this->add(place, columns, i, arena);
-            }
+            _add_batch_with_null_map(batch_begin, batch_end + 1, place, column, arena);
         } else {
             this->set_flag(place);
             const IColumn* nested_column = &column->get_nested_column();
@@ -270,6 +267,20 @@ public:
                                                    false);
         }
     }
+
+private:
+    void _add_batch_with_null_map(size_t batch_begin, size_t batch_end, AggregateDataPtr place,
+                                  const ColumnNullable* column, Arena* arena) const {
+        const auto* null_map = column->get_null_map_data().data();
+        if (!simd::contain_byte(null_map + batch_begin, batch_end - batch_begin, 0)) {
+            return;
+        }
+        this->set_flag(place);
+        const IColumn* nested_column = &column->get_nested_column();
+        this->nested_function->add_batch_single_place_with_null_map(
+                batch_begin, batch_end, this->nested_place(place), &nested_column, null_map,
+                arena);
+    }
 };
 
 template <typename NestFuction, bool result_is_nullable>
@@ -130,6 +130,11 @@ struct PercentileApproxState {
         target_quantile = quantile;
     }
 
+    void add_batch(const double* sources, size_t num_sources, double quantile) {
+        digest->add(sources, num_sources);
+        target_quantile = quantile;
+    }
+
     void add_with_weight(double source, double weight, double quantile) {
         digest->add(source, weight);
         target_quantile = quantile;
@@ -232,6 +237,26 @@ public:
             this->data(place).add(sources.get_element(row_num), quantile.get_element(row_num));
         }
     }
+
+    void add_batch_single_place(size_t batch_size, AggregateDataPtr place, const IColumn** columns,
+                                Arena* arena) const override {
+        if constexpr (is_nullable) {
+            AggregateFunctionPercentileApprox::add_batch_single_place(batch_size, place, columns,
+                                                                      arena);
+        } else {
+            if (batch_size == 0) {
+                return;
+            }
+            // the values of the column are added to the digest at once, and the quantile of
+            // the last row is kept as add() does row by row
+            const auto& sources = assert_cast<const ColumnFloat64&>(*columns[0]);
+            const auto& quantile = assert_cast<const ColumnFloat64&>(*columns[1]);
+
+            this->data(place).init();
+            this->data(place).add_batch(sources.get_data().data(), batch_size,
+                                        quantile.get_element(batch_size - 1));
+        }
+    }
 };
 
 template <bool is_nullable>
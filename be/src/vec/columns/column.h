@@ -48,12 +48,12 @@ class SipHash;
 #define DO_CRC_HASHES_FUNCTION_COLUMN_IMPL()                                         \
     if (null_data == nullptr) {                                                      \
         for (size_t i = 0; i < s; i++) {                                             \
-            hashes[i] = HashUtil::zlib_crc_hash(&data[i], sizeof(T), hashes[i]);     \
+            hashes[i] = HashUtil::zlib_crc_hash_fixed(data[i], hashes[i]);           \
         }                                                                            \
     } else {                                                                         \
         for (size_t i = 0; i < s; i++) {                                             \
             if (null_data[i] == 0)                                                   \
-                hashes[i] = HashUtil::zlib_crc_hash(&data[i], sizeof(T), hashes[i]); \
+                hashes[i] = HashUtil::zlib_crc_hash_fixed(data[i], hashes[i]);       \
         }                                                                            \
     }
 
@@ -233,6 +233,15 @@ public:
         LOG(FATAL) << "Method insert_many_fix_len_data is not supported for " << get_name();
     }
 
+    /// Append `num` uninitialized values of `size_of_value` bytes and return the address of the
+    /// first one, so that a page decoder writes the values straight into the column instead of
+    /// a temporary buffer. The values are stored as they are in the page, so nullptr is returned
+    /// if the column stores them in another layout, and the caller falls back to
+    /// insert_many_fix_len_data.
+    virtual char* insert_many_fix_len_data_in_place(size_t num, size_t size_of_value) {
+        return nullptr;
+    }
+
     // todo(zeno) Use dict_args temp object to cover all arguments
     virtual void insert_many_dict_data(const int32_t* data_array, size_t start_index,
                                        const StringRef* dict, size_t data_num,
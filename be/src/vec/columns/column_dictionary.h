@@ -278,6 +278,22 @@ public:
         return _dict.find_codes(values, selected);
     }
 
+    // Evaluate `pred(code)` on each code of the dictionary into `selected`, so that a predicate
+    // on the words is evaluated once per word instead of once per row.
+    template <typename Pred>
+    void find_codes_if(Pred&& pred, std::vector<vectorized::UInt8>& selected) const {
+        selected.resize(dict_size());
+        for (size_t code = 0; code < selected.size(); ++code) {
+            selected[code] = pred(value_type(code));
+        }
+    }
+
+    // The hash value of the word of `code`, must call initialize_hash_values_for_runtime_filter
+    // before.
+    uint32_t get_hash_value_by_code(value_type code) const {
+        return _dict.get_hash_value(code, _type);
+    }
+
     void set_rowset_segment_id(std::pair<RowsetId, uint32_t> rowset_segment_id) override {
         _rowset_segment_id = rowset_segment_id;
     }
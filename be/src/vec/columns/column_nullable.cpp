@@ -157,7 +157,11 @@ MutableColumnPtr ColumnNullable::clone_resized(size_t new_size) const {
         }
     }
 
-    return ColumnNullable::create(std::move(new_nested_col), std::move(new_null_map));
+    auto res = ColumnNullable::create(std::move(new_nested_col), std::move(new_null_map));
+    if (_is_known_no_null() && new_size <= size()) {
+        res->_set_known_no_null();
+    }
+    return res;
 }
 
 Field ColumnNullable::operator[](size_t n) const {
@@ -290,18 +294,24 @@ void ColumnNullable::insert_range_from_ignore_overflow(const doris::vectorized::
     _get_null_map_column().insert_range_from(*nullable_col.null_map, start, length);
     get_nested_column().insert_range_from_ignore_overflow(*nullable_col.nested_column, start,
                                                           length);
-    const auto& src_null_map_data = nullable_col.get_null_map_data();
-    _has_null = has_null();
-    _has_null |= simd::contain_byte(src_null_map_data.data() + start, length, 1);
+    // the null map is scanned only if it is known to have no null before, a column to be
+    // updated stays so, and no nulls are inserted from a column known to have none
+    if (_is_known_no_null() && !nullable_col._is_known_no_null()) {
+        const auto& src_null_map_data = nullable_col.get_null_map_data();
+        _has_null = simd::contain_byte(src_null_map_data.data() + start, length, 1);
+    }
 }
 
 void ColumnNullable::insert_range_from(const IColumn& src, size_t start, size_t length) {
     const auto& nullable_col = assert_cast<const ColumnNullable&>(src);
     _get_null_map_column().insert_range_from(*nullable_col.null_map, start, length);
     get_nested_column().insert_range_from(*nullable_col.nested_column, start, length);
-    const auto& src_null_map_data = nullable_col.get_null_map_data();
-    _has_null = has_null();
-    _has_null |= simd::contain_byte(src_null_map_data.data() + start, length, 1);
+    // the null map is scanned only if it is known to have no null before, a column to be
+    // updated stays so, and no nulls are inserted from a column known to have none
+    if (_is_known_no_null() && !nullable_col._is_known_no_null()) {
+        const auto& src_null_map_data = nullable_col.get_null_map_data();
+        _has_null = simd::contain_byte(src_null_map_data.data() + start, length, 1);
+    }
 }
 
 void ColumnNullable::insert_indices_from(const IColumn& src, const uint32_t* indices_begin,
@@ -368,13 +378,21 @@ void ColumnNullable::pop_back(size_t n) {
 ColumnPtr ColumnNullable::filter(const Filter& filt, ssize_t result_size_hint) const {
     ColumnPtr filtered_data = get_nested_column().filter(filt, result_size_hint);
     ColumnPtr filtered_null_map = get_null_map_column().filter(filt, result_size_hint);
-    return ColumnNullable::create(filtered_data, filtered_null_map);
+    auto res = ColumnNullable::create(filtered_data, filtered_null_map);
+    if (_is_known_no_null()) {
+        res->_set_known_no_null();
+    }
+    return res;
 }
 
 size_t ColumnNullable::filter(const Filter& filter) {
     const auto data_result_size = get_nested_column().filter(filter);
-    const auto map_result_size = get_null_map_column().filter(filter);
+    const auto map_result_size = _get_null_map_column().filter(filter);
     CHECK_EQ(data_result_size, map_result_size);
+    // the filtered rows of a column with nulls may have no null
+    if (_has_null) {
+        _need_update_has_null = true;
+    }
     return data_result_size;
 }
 
@@ -400,7 +418,11 @@ Status ColumnNullable::filter_by_selector(const uint16_t* sel, size_t sel_size,
 ColumnPtr ColumnNullable::permute(const Permutation& perm, size_t limit) const {
     ColumnPtr permuted_data = get_nested_column().permute(perm, limit);
     ColumnPtr permuted_null_map = get_null_map_column().permute(perm, limit);
-    return ColumnNullable::create(permuted_data, permuted_null_map);
+    auto res = ColumnNullable::create(permuted_data, permuted_null_map);
+    if (_is_known_no_null()) {
+        res->_set_known_no_null();
+    }
+    return res;
 }
 
 int ColumnNullable::compare_at(size_t n, size_t m, const IColumn& rhs_,
@@ -155,6 +155,14 @@ public:
         get_nested_column().insert_many_raw_data(pos, num);
     }
 
+    char* insert_many_fix_len_data_in_place(size_t num, size_t size_of_value) override {
+        auto* data = get_nested_column().insert_many_fix_len_data_in_place(num, size_of_value);
+        if (data != nullptr) {
+            _get_null_map_column().insert_many_vals(0, num);
+        }
+        return data;
+    }
+
     void insert_many_dict_data(const int32_t* data_array, size_t start_index, const StringRef* dict,
                                size_t data_num, uint32_t dict_num) override {
         _get_null_map_column().insert_many_vals(0, data_num);
@@ -192,7 +200,6 @@ public:
     void insert_not_null_elements(size_t num) {
         get_nested_column().insert_many_defaults(num);
         _get_null_map_column().insert_many_vals(0, num);
-        _has_null = false;
     }
 
     void insert_null_elements(int num) {
@@ -315,7 +322,9 @@ public:
     void clear() override {
         null_map->clear();
         nested_column->clear();
+        // an empty null map is known to have no null, the rows inserted afterwards update it
         _has_null = false;
+        _need_update_has_null = false;
     }
 
     NullMap& get_null_map_data() { return get_null_map_column().get_data(); }
@@ -418,6 +427,13 @@ private:
     bool _has_null = true;
 
     void _update_has_null();
+    // The null map is known to have no null without a scan, the filtered, permuted and copied
+    // rows of this column have no null either.
+    bool _is_known_no_null() const { return !_need_update_has_null && !_has_null; }
+    void _set_known_no_null() {
+        _has_null = false;
+        _need_update_has_null = false;
+    }
     template <bool negative>
     void apply_null_map_impl(const ColumnUInt8& map);
 };
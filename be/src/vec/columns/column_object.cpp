@@ -517,13 +517,16 @@ bool ColumnObject::Subcolumn::check_if_sparse_column(size_t num_rows) {
     if (num_rows < config::variant_threshold_rows_to_estimate_sparse_column) {
         return false;
     }
+    return get_ratio_of_default_rows() >= config::variant_ratio_of_defaults_as_sparse_column;
+}
+
+double ColumnObject::Subcolumn::get_ratio_of_default_rows() const {
     std::vector<double> defaults_ratio;
     for (size_t i = 0; i < data.size(); ++i) {
         defaults_ratio.push_back(data[i]->get_ratio_of_default_rows());
     }
-    double default_ratio = std::accumulate(defaults_ratio.begin(), defaults_ratio.end(), 0.0) /
-                           defaults_ratio.size();
-    return default_ratio >= config::variant_ratio_of_defaults_as_sparse_column;
+    return std::accumulate(defaults_ratio.begin(), defaults_ratio.end(), 0.0) /
+           defaults_ratio.size();
 }
 
 void ColumnObject::Subcolumn::finalize() {
@@ -1305,6 +1308,7 @@ void ColumnObject::finalize(bool ignore_sparse) {
         new_subcolumns.create_root(subcolumns.get_root()->data);
         new_subcolumns.get_mutable_root()->data.finalize();
     }
+    std::vector<Subcolumns::NodePtr> materialized;
     for (auto&& entry : subcolumns) {
         const auto& least_common_type = entry->data.get_least_common_type();
         /// Do not add subcolumns, which consists only from NULLs
@@ -1325,7 +1329,36 @@ void ColumnObject::finalize(bool ignore_sparse) {
             continue;
         }
 
-        new_subcolumns.add(entry->path, entry->data);
+        materialized.push_back(entry);
+    }
+
+    // Keep the memory and the schema bounded for the documents of many distinct keys, the long
+    // tail keys with the most default values are stored as sparse columns.
+    size_t max_subcolumns_count = config::variant_max_subcolumns_count;
+    if (!ignore_sparse && max_subcolumns_count > 0 &&
+        materialized.size() > max_subcolumns_count) {
+        std::vector<std::pair<double, size_t>> default_ratios;
+        default_ratios.reserve(materialized.size());
+        for (size_t i = 0; i < materialized.size(); ++i) {
+            default_ratios.emplace_back(materialized[i]->data.get_ratio_of_default_rows(), i);
+        }
+        std::stable_sort(default_ratios.begin(), default_ratios.end(),
+                         [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+        std::vector<bool> is_sparse(materialized.size(), false);
+        for (size_t i = max_subcolumns_count; i < default_ratios.size(); ++i) {
+            is_sparse[default_ratios[i].second] = true;
+        }
+        for (size_t i = 0; i < materialized.size(); ++i) {
+            if (is_sparse[i]) {
+                sparse_columns.add(materialized[i]->path, materialized[i]->data);
+            } else {
+                new_subcolumns.add(materialized[i]->path, materialized[i]->data);
+            }
+        }
+    } else {
+        for (const auto& entry : materialized) {
+            new_subcolumns.add(entry->path, entry->data);
+        }
     }
     std::swap(subcolumns, new_subcolumns);
     doc_structure = nullptr;
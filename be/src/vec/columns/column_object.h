@@ -147,6 +147,8 @@ public:
 
         bool check_if_sparse_column(size_t num_rows);
 
+        double get_ratio_of_default_rows() const;
+
         /// Returns last inserted field.
         Field get_last_field() const;
 
@@ -233,6 +233,15 @@ public:
         memcpy(data.data() + old_size, data_ptr, num * sizeof(T));
     }
 
+    char* insert_many_fix_len_data_in_place(size_t num, size_t size_of_value) override {
+        if (IColumn::is_date || IColumn::is_date_time || size_of_value != sizeof(T)) {
+            return nullptr;
+        }
+        auto old_size = data.size();
+        data.resize(old_size + num);
+        return reinterpret_cast<char*>(data.data() + old_size);
+    }
+
     void insert_default() override { data.push_back(T()); }
 
     void insert_many_defaults(size_t length) override {
@@ -228,6 +228,21 @@ public:
         }
     }
 
+    char* insert_many_fix_len_data_in_place(size_t num, size_t size_of_value) override {
+        // the same types as insert_many_default_type
+        if constexpr (Type == TYPE_DECIMALV2 || std::is_same_v<T, StringRef> ||
+                      Type == TYPE_DATE || Type == TYPE_DATETIME) {
+            return nullptr;
+        } else {
+            if (size_of_value != sizeof(T)) {
+                return nullptr;
+            }
+            auto old_size = data.size();
+            data.resize(old_size + num);
+            return reinterpret_cast<char*>(data.data() + old_size);
+        }
+    }
+
     void insert_many_dict_data(const int32_t* data_array, size_t start_index, const StringRef* dict,
                                size_t num, uint32_t /*dict_num*/) override {
         if constexpr (std::is_same_v<T, StringRef>) {
@@ -60,8 +60,13 @@
 #define MAP_ANONYMOUS MAP_ANON
 #endif
 
+#ifndef MAP_POPULATE
+#define MAP_POPULATE 0
+#endif
+
 static constexpr size_t MMAP_MIN_ALIGNMENT = 4096;
 static constexpr size_t MALLOC_MIN_ALIGNMENT = 8;
+static constexpr size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
 
 // The memory for __int128 should be aligned to 16 bytes.
 // By the way, in 64-bit system, the address of a block returned by malloc or realloc in GNU systems
@@ -112,7 +117,9 @@ public:
                         "Too large alignment {}: more than page size when allocating {}.",
                         alignment, size);
 
-            buf = mmap(nullptr, size, PROT_READ | PROT_WRITE, mmap_flags, -1, 0);
+            // the pages are faulted in as huge pages on the first write instead of populated
+            buf = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                       use_huge_page(size) ? mmap_flags & ~MAP_POPULATE : mmap_flags, -1, 0);
             if (MAP_FAILED == buf) {
                 release_memory(size);
                 throw_bad_alloc(fmt::format("Allocator: Cannot mmap {}.", size));
@@ -149,6 +156,7 @@ public:
                 if constexpr (clear_memory) memset(buf, 0, size);
             }
         }
+        madvise_huge_page(buf, size);
         return buf;
     }
 
@@ -234,12 +242,38 @@ public:
             buf = new_buf;
         }
 
+        madvise_huge_page(buf, new_size);
         return buf;
     }
 
 protected:
     static constexpr size_t get_stack_threshold() { return 0; }
 
+    static bool use_huge_page(size_t size) {
+#if defined(OS_LINUX) && defined(MADV_HUGEPAGE)
+        return size >= HUGE_PAGE_SIZE && doris::config::enable_huge_page_for_large_allocation;
+#else
+        return false;
+#endif
+    }
+
+    // Back the huge page aligned part of a large buffer by transparent huge pages, which
+    // reduces the TLB misses of the random accesses to large hash tables and arrays.
+    // It is only a hint, nothing changes if THP is disabled in the system.
+    static void madvise_huge_page(void* buf, size_t size) {
+#if defined(OS_LINUX) && defined(MADV_HUGEPAGE)
+        if (!use_huge_page(size)) {
+            return;
+        }
+        auto addr = reinterpret_cast<uintptr_t>(buf);
+        auto begin = (addr + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+        auto end = (addr + size) & ~(HUGE_PAGE_SIZE - 1);
+        if (begin < end) {
+            static_cast<void>(madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE));
+        }
+#endif
+    }
+
     static constexpr bool clear_memory = clear_memory_;
 
     // Freshly mmapped pages are copy-on-write references to a global zero page.
@@ -0,0 +1,162 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+// This file is copied from
+// https://github.com/ClickHouse/ClickHouse/blob/master/src/Common/ArenaWithFreeLists.h
+// and modified by Doris
+
+#pragma once
+
+#include <glog/logging.h>
+#include <string.h>
+
+#include <algorithm>
+#include <boost/noncopyable.hpp>
+#if __has_include(<sanitizer/asan_interface.h>)
+#include <sanitizer/asan_interface.h>
+#endif
+#include "vec/common/allocator.h"
+#include "vec/common/allocator_fwd.h"
+#include "vec/common/arena.h"
+
+namespace doris::vectorized {
+
+/** Unlike Arena, allows you to release (for later re-use)
+  *  previously allocated (not necessarily just recently) chunks of memory.
+  * For this, the requested size is rounded up to the power of two (or up to 8, if less,
+  *  or using memory allocation outside Arena if the size is greater than 65536).
+  * When freed from memory, for each size (a total of 14 options: 8, 16 ... 65536),
+  *  a single-linked list of free blocks is kept track.
+  * When allocating, we take the head of the list of free blocks,
+  *  or, if the list is empty - allocate a new block using Arena.
+  * The memory of the chunks and of the large blocks is allocated by Allocator, so it is
+  *  accounted into the MemTracker of the thread, like Arena.
+  */
+class ArenaWithFreeLists : private Allocator<false>, private boost::noncopyable {
+private:
+    /// If the block is free, then the pointer to the next free block is stored at its beginning,
+    /// or nullptr, if there are no more free blocks. If the block is used, then some data is
+    /// stored in it.
+    union Block {
+        Block* next;
+        char data[0];
+    };
+
+    /// The maximum size of a piece of memory that is allocated with Arena.
+    /// Otherwise, we use Allocator directly.
+    static constexpr size_t max_fixed_block_size = 65536;
+
+    /// Get the index in the freelist array for the specified size.
+    static size_t find_free_list_index(const size_t size) {
+        return size <= 8 ? 2 : 63 - __builtin_clzll(size - 1);
+    }
+
+    /// Arena is used to allocate blocks that are not too large.
+    Arena pool;
+
+    /// Lists of free blocks. Each element points to the head of the corresponding list,
+    /// or is nullptr. The first two elements are not used, but are intended to simplify
+    /// arithmetic.
+    Block* free_lists[16] {};
+
+    /// The bytes of the blocks larger than max_fixed_block_size in use.
+    size_t large_allocated_bytes = 0;
+
+public:
+    explicit ArenaWithFreeLists(const size_t initial_size = 4096, const size_t growth_factor = 2,
+                                const size_t linear_growth_threshold = 128 * 1024 * 1024)
+            : pool {initial_size, growth_factor, linear_growth_threshold} {}
+
+    char* alloc(const size_t size) {
+        if (size > max_fixed_block_size) {
+            large_allocated_bytes += size;
+            return static_cast<char*>(Allocator<false>::alloc(size));
+        }
+
+        /// find list of required size
+        const auto list_idx = find_free_list_index(size);
+
+        /// If there is a free block.
+        if (auto& free_block_ptr = free_lists[list_idx]) {
+            /// Let's take it. And change the head of the list to the next
+            /// item in the list. We poisoned the free block before putting
+            /// it into the free list, so we have to unpoison it before
+            /// reading anything.
+            ASAN_UNPOISON_MEMORY_REGION(free_block_ptr, std::max(size, sizeof(Block)));
+
+            auto* const res = free_block_ptr->data;
+            free_block_ptr = free_block_ptr->next;
+            return res;
+        }
+
+        /// no block of corresponding size, allocate a new one
+        return pool.alloc(1ULL << (list_idx + 1));
+    }
+
+    void free(char* ptr, const size_t size) {
+        if (size > max_fixed_block_size) {
+            large_allocated_bytes -= size;
+            Allocator<false>::free(ptr, size);
+            return;
+        }
+
+        /// find list of required size
+        const auto list_idx = find_free_list_index(size);
+
+        /// Insert the released block into the head of the list.
+        auto& free_block_ptr = free_lists[list_idx];
+        auto* const old_head = free_block_ptr;
+        free_block_ptr = reinterpret_cast<Block*>(ptr);
+        free_block_ptr->next = old_head;
+
+        /// The requested size may be less than the size of the block, but
+        /// we still want to poison the entire block.
+        /// Strictly speaking, the free blocks must be unpoisoned in
+        /// destructor, to support an underlying allocator that doesn't
+        /// integrate with asan. We don't do that, and rely on the fact that
+        /// our underlying allocator is Arena, which does have asan integration.
+        ASAN_POISON_MEMORY_REGION(ptr, 1ULL << (list_idx + 1));
+    }
+
+    /// Keep the data in place if the new size is in the same size class, for the states
+    /// growing by small steps.
+    char* realloc(char* old_data, const size_t old_size, const size_t new_size) {
+        if (old_data != nullptr && old_size <= max_fixed_block_size &&
+            new_size <= max_fixed_block_size &&
+            find_free_list_index(old_size) == find_free_list_index(new_size)) {
+            return old_data;
+        }
+        char* res = alloc(new_size);
+        if (old_data != nullptr) {
+            memcpy(res, old_data, std::min(old_size, new_size));
+            free(old_data, old_size);
+        }
+        return res;
+    }
+
+    /// Forget all the blocks and reuse the chunks of the arena, see Arena::clear().
+    /// The blocks larger than max_fixed_block_size must be freed before.
+    void clear() {
+        DCHECK_EQ(large_allocated_bytes, 0);
+        std::fill(std::begin(free_lists), std::end(free_lists), nullptr);
+        pool.clear();
+    }
+
+    /// Size of the allocated pool in bytes
+    size_t allocated_bytes() const { return pool.size() + large_allocated_bytes; }
+};
+
+} // namespace doris::vectorized
@@ -0,0 +1,299 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <boost/noncopyable.hpp>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "common/config.h"
+#include "vec/common/hash_table/ph_hash_map.h"
+
+/// A hash map of integer keys, whose keys in a small range are put in an array indexed by
+/// `key - min`, and the other keys in a PHHashMap.
+/// The range is chosen by the keys of the first batch passed to `init_dense_range`: if they
+/// are in a range of at most agg_dense_hash_map_max_range keys, which is not too sparse for
+/// the batch, the range is widened a little for the keys to come and the array is allocated.
+/// Keys out of the range always fall back to the PHHashMap.
+template <typename Key, typename Mapped, typename HashMethod = DefaultHash<Key>>
+class ArrayHashMap : private boost::noncopyable {
+    static_assert(std::is_integral_v<Key>);
+
+public:
+    using Self = ArrayHashMap;
+    using Hash = HashMethod;
+    using HashMapImpl = PHHashMap<Key, Mapped, HashMethod>;
+
+    using key_type = Key;
+    using mapped_type = Mapped;
+    using value_type = std::pair<const Key, Mapped>;
+
+    using LookupResult = std::pair<const Key, Mapped>*;
+    using ConstLookupResult = const std::pair<const Key, Mapped>*;
+
+    ArrayHashMap() = default;
+
+    ArrayHashMap(size_t reserve_for_num_elements) : _hash_map(reserve_for_num_elements) {}
+
+    template <typename Derived, bool is_const>
+    class iterator_base {
+        using Map = std::conditional_t<is_const, const ArrayHashMap, ArrayHashMap>;
+        using BaseIterator = std::conditional_t<is_const, typename HashMapImpl::const_iterator,
+                                                typename HashMapImpl::iterator>;
+
+        Map* map = nullptr;
+        // index of the array, or `map->_cells.size()` if `base_iterator` is valid
+        size_t index = 0;
+        BaseIterator base_iterator;
+        friend class ArrayHashMap;
+
+        void skip_empty_cells() {
+            while (index < map->_cells.size() && !map->_occupied[index]) {
+                ++index;
+            }
+        }
+
+    public:
+        iterator_base() = default;
+        iterator_base(Map* map_, size_t index_, BaseIterator it)
+                : map(map_), index(index_), base_iterator(it) {
+            skip_empty_cells();
+        }
+
+        bool operator==(const iterator_base& rhs) const {
+            return index == rhs.index && base_iterator == rhs.base_iterator;
+        }
+        bool operator!=(const iterator_base& rhs) const { return !(*this == rhs); }
+
+        Derived& operator++() {
+            if (index < map->_cells.size()) {
+                ++index;
+                skip_empty_cells();
+            } else {
+                ++base_iterator;
+            }
+            return static_cast<Derived&>(*this);
+        }
+
+        auto& operator*() const { return *this; }
+        auto* operator->() const { return this; }
+
+        auto& operator*() { return *this; }
+        auto* operator->() { return this; }
+
+        const auto& get_first() const {
+            return index < map->_cells.size() ? map->_cells[index].first
+                                              : base_iterator->get_first();
+        }
+
+        const auto& get_second() const {
+            return index < map->_cells.size() ? map->_cells[index].second
+                                              : base_iterator->get_second();
+        }
+
+        auto& get_second() {
+            return index < map->_cells.size() ? map->_cells[index].second
+                                              : base_iterator->get_second();
+        }
+
+        auto get_ptr() const { return this; }
+    };
+
+    class iterator : public iterator_base<iterator, false> {
+    public:
+        using iterator_base<iterator, false>::iterator_base;
+    };
+
+    class const_iterator : public iterator_base<const_iterator, true> {
+    public:
+        using iterator_base<const_iterator, true>::iterator_base;
+    };
+
+    const_iterator begin() const { return const_iterator(this, 0, _hash_map.begin()); }
+    const_iterator cbegin() const { return begin(); }
+    iterator begin() { return iterator(this, 0, _hash_map.begin()); }
+
+    const_iterator end() const { return const_iterator(this, _cells.size(), _hash_map.end()); }
+    const_iterator cend() const { return end(); }
+    iterator end() { return iterator(this, _cells.size(), _hash_map.end()); }
+
+    /// Choose the dense range by the first batch of keys, the null rows are skipped.
+    void init_dense_range(const Key* keys, size_t num_rows, const uint8_t* null_map) {
+        if (_range_inited || num_rows == 0) {
+            return;
+        }
+        _range_inited = true;
+        // the keys already in the hash map must stay there
+        if (!_hash_map.empty()) {
+            return;
+        }
+        SignedKey min_key = std::numeric_limits<SignedKey>::max();
+        SignedKey max_key = std::numeric_limits<SignedKey>::min();
+        for (size_t i = 0; i < num_rows; ++i) {
+            if (null_map && null_map[i]) {
+                continue;
+            }
+            min_key = std::min(min_key, SignedKey(keys[i]));
+            max_key = std::max(max_key, SignedKey(keys[i]));
+        }
+        if (min_key > max_key) {
+            return;
+        }
+        const auto max_range = __int128(config::agg_dense_hash_map_max_range);
+        __int128 range = __int128(max_key) - min_key + 1;
+        // a batch of few keys in a wide range would make a sparse array
+        if (range > max_range || range > std::max<__int128>(num_rows * MAX_SPARSITY, 1024)) {
+            return;
+        }
+        // leave room for the keys of the following batches, within the range of the type
+        __int128 headroom = std::min<__int128>(range / 4, (max_range - range) / 2);
+        __int128 low =
+                std::max<__int128>(min_key - headroom, std::numeric_limits<SignedKey>::min());
+        __int128 high =
+                std::min<__int128>(max_key + headroom, std::numeric_limits<SignedKey>::max());
+        _min = Key(SignedKey(low));
+        _cells.reserve(size_t(high - low + 1));
+        for (__int128 key = low; key <= high; ++key) {
+            _cells.emplace_back(Key(SignedKey(key)), Mapped());
+        }
+        _occupied.assign(_cells.size(), 0);
+    }
+
+    bool is_dense() const { return !_cells.empty(); }
+
+    template <typename KeyHolder, typename Func>
+    void ALWAYS_INLINE lazy_emplace(KeyHolder&& key, LookupResult& it, size_t hash_value,
+                                    Func&& f) {
+        size_t index = Key(key - _min);
+        if (index < _cells.size()) {
+            auto& cell = _cells[index];
+            it = &cell;
+            if (!_occupied[index]) {
+                _occupied[index] = 1;
+                ++_dense_size;
+                f([&](const auto&, const auto& mapped) { cell.second = mapped; }, key, key);
+            }
+            return;
+        }
+        _hash_map.lazy_emplace(key, it, hash_value, std::forward<Func>(f));
+    }
+
+    template <typename KeyHolder>
+    void ALWAYS_INLINE emplace(KeyHolder&& key, LookupResult& it, bool& inserted,
+                               size_t hash_value) {
+        size_t index = Key(key - _min);
+        if (index < _cells.size()) {
+            it = &_cells[index];
+            inserted = !_occupied[index];
+            if (inserted) {
+                _occupied[index] = 1;
+                ++_dense_size;
+            }
+            return;
+        }
+        _hash_map.emplace(key, it, inserted, hash_value);
+    }
+
+    template <typename KeyHolder>
+    LookupResult ALWAYS_INLINE find(KeyHolder&& key, size_t hash_value) {
+        size_t index = Key(key - _min);
+        if (index < _cells.size()) {
+            return _occupied[index] ? &_cells[index] : nullptr;
+        }
+        return _hash_map.find(key, hash_value);
+    }
+
+    template <typename KeyHolder>
+    LookupResult ALWAYS_INLINE find(KeyHolder&& key) {
+        return find(key, hash(key));
+    }
+
+    size_t hash(const Key& x) const { return _hash_map.hash(x); }
+
+    template <bool read>
+    void ALWAYS_INLINE prefetch(const Key& key, size_t hash_value) {
+        size_t index = Key(key - _min);
+        if (index < _cells.size()) {
+            __builtin_prefetch(&_cells[index], !read);
+        } else {
+            _hash_map.template prefetch<read>(key, hash_value);
+        }
+    }
+
+    /// Call func(Mapped &) for each hash map element.
+    template <typename Func>
+    void for_each_mapped(Func&& func) {
+        for (size_t i = 0; i < _cells.size(); ++i) {
+            if (_occupied[i]) {
+                func(_cells[i].second);
+            }
+        }
+        _hash_map.for_each_mapped(func);
+    }
+
+    size_t get_buffer_size_in_bytes() const {
+        return _cells.capacity() * sizeof(value_type) + _occupied.capacity() +
+               _hash_map.get_buffer_size_in_bytes();
+    }
+
+    size_t get_buffer_size_in_cells() const {
+        return _cells.size() + _hash_map.get_buffer_size_in_cells();
+    }
+
+    bool add_elem_size_overflow(size_t row) const {
+        // the rows of the dense range never grow the array
+        return !_hash_map.empty() && _hash_map.add_elem_size_overflow(row);
+    }
+
+    size_t size() const { return _dense_size + _hash_map.size(); }
+    template <typename MappedType>
+    char* get_null_key_data() {
+        return nullptr;
+    }
+    bool has_null_key_data() const { return false; }
+
+    bool empty() const { return size() == 0; }
+
+    void clear_and_shrink() {
+        _hash_map.clear_and_shrink();
+        _cells.clear();
+        _cells.shrink_to_fit();
+        _occupied.clear();
+        _occupied.shrink_to_fit();
+        _dense_size = 0;
+        _range_inited = false;
+    }
+
+    void expanse_for_add_elem(size_t num_elem) { _hash_map.expanse_for_add_elem(num_elem); }
+
+private:
+    using SignedKey = std::make_signed_t<Key>;
+    // the array holds at most MAX_SPARSITY keys per row of the first batch
+    static constexpr size_t MAX_SPARSITY = 8;
+
+    HashMapImpl _hash_map;
+    bool _range_inited = false;
+    Key _min = 0;
+    // the cell of `_min + i` is `_cells[i]`, valid if `_occupied[i]`
+    std::vector<value_type> _cells;
+    std::vector<uint8_t> _occupied;
+    size_t _dense_size = 0;
+};
@@ -56,6 +56,8 @@ struct MethodBaseInner {
 
     // use in join case
     std::vector<uint32_t> bucket_nums;
+    // the bucket tags of the rows, only if the join hash table uses them
+    std::vector<uint8_t> bucket_tags;
 
     MethodBaseInner() { hash_table.reset(new HashMap()); }
     virtual ~MethodBaseInner() = default;
@@ -73,6 +75,12 @@ struct MethodBaseInner {
 
     void init_join_bucket_num(uint32_t num_rows, uint32_t bucket_size, const uint8_t* null_map) {
         bucket_nums.resize(num_rows);
+        if constexpr (requires(const HashMap& map) { map.use_bucket_tags(); }) {
+            if (hash_table->use_bucket_tags()) {
+                init_join_bucket_num_and_tag(num_rows, bucket_size, null_map);
+                return;
+            }
+        }
 
         if (null_map == nullptr) {
             init_join_bucket_num(num_rows, bucket_size);
@@ -90,7 +98,25 @@ struct MethodBaseInner {
         }
     }
 
+    void init_join_bucket_num_and_tag(uint32_t num_rows, uint32_t bucket_size,
+                                      const uint8_t* null_map) {
+        bucket_tags.resize(num_rows);
+        for (uint32_t k = 0; k < num_rows; ++k) {
+            if (null_map && null_map[k]) {
+                bucket_nums[k] = bucket_size;
+                bucket_tags[k] = 0xFF;
+                continue;
+            }
+            auto hash_value = hash_table->hash(keys[k]);
+            bucket_nums[k] = hash_value & (bucket_size - 1);
+            bucket_tags[k] = HashMap::bucket_tag(hash_value);
+        }
+    }
+
     void init_hash_values(size_t num_rows, const uint8_t* null_map) {
+        if constexpr (requires(HashMap& map) { map.init_dense_range(keys, num_rows, null_map); }) {
+            hash_table->init_dense_range(keys, num_rows, null_map);
+        }
         if (null_map == nullptr) {
             init_hash_values(num_rows);
             return;
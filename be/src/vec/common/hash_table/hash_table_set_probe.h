@@ -17,6 +17,7 @@
 
 #include "pipeline/exec/set_probe_sink_operator.h"
 #include "runtime/runtime_state.h"
+#include "util/bitmap.h"
 #include "vec/columns/column.h"
 
 namespace doris::vectorized {
@@ -26,6 +27,8 @@ struct HashTableProbe {
     template <typename Parent>
     HashTableProbe(Parent* parent, int probe_rows)
             : _valid_element_in_hash_tbl(parent->valid_element_in_hash_tbl()),
+              _alive_rows(parent->alive_rows()),
+              _matched_rows(parent->matched_rows()),
               _probe_rows(probe_rows),
               _probe_raw_ptrs(parent->_probe_columns) {}
 
@@ -35,28 +38,42 @@ struct HashTableProbe {
         KeyGetter key_getter(_probe_raw_ptrs);
         hash_table_ctx.init_serialized_keys(_probe_raw_ptrs, _probe_rows);
 
+        // find the build rows of all the probe rows first, then mark them in a tight loop
+        // over the bitmaps of the shared state
+        _build_rows.clear();
+        _build_rows.reserve(_probe_rows);
         for (int probe_index = 0; probe_index < _probe_rows; probe_index++) {
             auto find_result = hash_table_ctx.find(key_getter, probe_index);
-            if (find_result.is_found()) { //if found, marked visited
-                auto it = find_result.get_mapped().begin();
-                if (!(it->visited)) {
-                    it->visited = true;
-                    if constexpr (is_intersected) { //intersected
-                        (*_valid_element_in_hash_tbl)++;
-                    } else {
-                        (*_valid_element_in_hash_tbl)--; //except
-                    }
+            if (find_result.is_found()) {
+                _build_rows.push_back(find_result.get_mapped().row_num);
+            }
+        }
+
+        int64_t marked = 0;
+        for (auto row : _build_rows) {
+            if constexpr (is_intersected) { //intersected: matched by every child so far
+                if (BitmapTest(_alive_rows, row) && !BitmapTest(_matched_rows, row)) {
+                    BitmapSet(_matched_rows, row);
+                    ++marked;
+                }
+            } else { //except: removed by its first match
+                if (BitmapTest(_alive_rows, row)) {
+                    BitmapClear(_alive_rows, row);
+                    ++marked;
                 }
             }
         }
+        *_valid_element_in_hash_tbl += is_intersected ? marked : -marked;
         return Status::OK();
     }
 
 private:
     int64_t* _valid_element_in_hash_tbl = nullptr;
+    uint8_t* _alive_rows = nullptr;
+    uint8_t* _matched_rows = nullptr;
     const size_t _probe_rows;
     ColumnRawPtrs& _probe_raw_ptrs;
-    std::vector<StringRef> _probe_keys;
+    std::vector<uint32_t> _build_rows;
 };
 
 } // namespace doris::vectorized
@@ -19,6 +19,8 @@
 
 #include <gen_cpp/PlanNodes_types.h>
 
+#include "common/compiler_util.h"
+#include "common/config.h"
 #include "vec/columns/column_filter_helper.h"
 #include "vec/common/hash_table/hash.h"
 #include "vec/common/hash_table/hash_table.h"
@@ -33,6 +35,10 @@ public:
     using value_type = void*;
     size_t hash(const Key& x) const { return Hash()(x); }
 
+    // One of 8 bits chosen by hash bits above the bucket bits of most hash tables. A bucket
+    // keeps the OR of the tags of its rows, a probe row whose tag is not in it matches no row.
+    static uint8_t bucket_tag(size_t hash_value) { return 1 << ((hash_value >> 29) & 7); }
+
     static uint32_t calc_bucket_size(size_t num_elem) {
         size_t expect_bucket_size = num_elem + (num_elem - 1) / 7;
         return phmap::priv::NormalizeCapacity(expect_bucket_size) + 1;
@@ -40,7 +46,8 @@ public:
 
     size_t get_byte_size() const {
         auto cal_vector_mem = [](const auto& vec) { return vec.capacity() * sizeof(vec[0]); };
-        return cal_vector_mem(visited) + cal_vector_mem(first) + cal_vector_mem(next);
+        return cal_vector_mem(visited) + cal_vector_mem(first) + cal_vector_mem(next) +
+               cal_vector_mem(_bucket_tags) + cal_vector_mem(_partitioned_keys) + cal_vector_mem(_partitioned_rows);
     }
 
     template <int JoinOpType>
@@ -60,8 +67,46 @@ public:
                       JoinOpType == TJoinOp::RIGHT_SEMI_JOIN) {
             visited.resize(num_elem);
         }
+        // a small hash table stays in the cache, where prefetching only costs instructions
+        _probe_prefetch = config::enable_hash_join_probe_prefetch &&
+                          num_elem >= PROBE_PREFETCH_MIN_BUILD_ROWS;
+        // the tags of a small hash table do not save much more than a lookup of `first`
+        _use_bucket_tags =
+                config::enable_hash_join_bucket_tags && num_elem >= BUCKET_TAGS_MIN_BUILD_ROWS;
+        if (_use_bucket_tags) {
+            _bucket_tags.assign(bucket_size + 1, 0);
+        } else {
+            _bucket_tags.clear();
+        }
     }
 
+    // If true, `bucket_tags` of the rows should be passed to `build` and `pre_build_idxs`.
+    bool use_bucket_tags() const { return _use_bucket_tags; }
+
+    // Radix partition the hash table if enable_hash_join_radix_partition and the build side is
+    // big. The rows whose bucket numbers share the highest bits are put together, so that the
+    // bucket heads, chain links and keys of a partition make a sub-table of about
+    // hash_join_radix_sub_table_bytes. Called between prepare_build and build, only by the
+    // joins which probe by `find_batch_radix_partitioned`.
+    void init_radix_partition(size_t num_elem) {
+        _partition_bits = 0;
+        if (!config::enable_hash_join_radix_partition ||
+            num_elem < config::hash_join_radix_partition_min_build_rows) {
+            return;
+        }
+        size_t bytes_per_row = sizeof(Key) + sizeof(uint32_t) * 3; // key, first, next, row
+        size_t sub_table_bytes = std::max<int64_t>(config::hash_join_radix_sub_table_bytes, 1);
+        int bucket_bits = __builtin_ctz(bucket_size);
+        while (_partition_bits < std::min(bucket_bits, MAX_RADIX_PARTITION_BITS) &&
+               (num_elem * bytes_per_row >> _partition_bits) > sub_table_bytes) {
+            ++_partition_bits;
+        }
+        _partition_shift = bucket_bits - _partition_bits;
+    }
+
+    bool is_radix_partitioned() const { return _partition_bits > 0; }
+    int get_radix_partition_bits() const { return _partition_bits; }
+
     uint32_t get_bucket_size() const { return bucket_size; }
 
     size_t size() const { return next.size(); }
@@ -70,12 +115,61 @@ public:
 
     template <int JoinOpType, bool with_other_conjuncts>
     void build(const Key* __restrict keys, const uint32_t* __restrict bucket_nums,
-               size_t num_elem) {
+               size_t num_elem, const uint8_t* __restrict bucket_tags = nullptr) {
+        begin_build(keys, bucket_tags);
+        if (_partition_bits > 0) {
+            _build_radix_partitioned(keys, bucket_nums, num_elem);
+            if (_use_bucket_tags) {
+                for (size_t i = 1; i < num_elem; i++) {
+                    _bucket_tags[bucket_nums[i]] |= bucket_tags[i];
+                }
+            }
+        } else {
+            build_part(bucket_nums, num_elem, bucket_tags, 0, 1);
+        }
+        finish_build<JoinOpType, with_other_conjuncts>();
+    }
+
+    /// `build` of a hash table that is not radix partitioned may also be split into
+    /// `begin_build`, a `build_part` of every part, which can run in different threads, and
+    /// `finish_build`.
+    void begin_build(const Key* __restrict keys, const uint8_t* __restrict bucket_tags) {
         build_keys = keys;
+        if (_use_bucket_tags && bucket_tags == nullptr) {
+            _use_bucket_tags = false;
+            _bucket_tags.clear();
+        }
+    }
+
+    /// Insert the rows whose buckets are in the `part`th of `num_parts` ranges of the buckets.
+    /// The parts write disjoint bucket heads, chain links and tags, and the chains are the same
+    /// as those inserted by a single part.
+    void build_part(const uint32_t* __restrict bucket_nums, size_t num_elem,
+                    const uint8_t* __restrict bucket_tags, int part, int num_parts) {
+        DCHECK(!is_radix_partitioned());
+        const uint32_t begin = uint64_t(bucket_size) * part / num_parts;
+        // the last part also takes the null bucket
+        const uint32_t end = part + 1 == num_parts
+                                     ? bucket_size + 1
+                                     : uint64_t(bucket_size) * (part + 1) / num_parts;
         for (size_t i = 1; i < num_elem; i++) {
             uint32_t bucket_num = bucket_nums[i];
+            if (bucket_num < begin || bucket_num >= end) {
+                continue;
+            }
             next[i] = first[bucket_num];
             first[bucket_num] = i;
+            if (_use_bucket_tags) {
+                _bucket_tags[bucket_num] |= bucket_tags[i];
+            }
+        }
+    }
+
+    template <int JoinOpType, bool with_other_conjuncts>
+    void finish_build() {
+        if (_use_bucket_tags) {
+            // the null bucket is never filtered
+            _bucket_tags[bucket_size] = 0xFF;
         }
         if constexpr ((JoinOpType != TJoinOp::NULL_AWARE_LEFT_ANTI_JOIN &&
                        JoinOpType != TJoinOp::NULL_AWARE_LEFT_SEMI_JOIN) ||
@@ -250,9 +344,57 @@ public:
         return iter_idx >= elem_num;
     }
 
+    /// Same as `_find_batch_inner_outer_join` of INNER_JOIN on a radix partitioned hash table,
+    /// the probe rows are visited in `probe_order` made by `pre_build_idxs_radix_partitioned`,
+    /// so `probe_pos` and the returned position are indexes of `probe_order`.
+    auto find_batch_radix_partitioned(const Key* __restrict keys,
+                                      const uint32_t* __restrict build_idx_map,
+                                      const uint32_t* __restrict probe_order, int probe_pos,
+                                      uint32_t build_idx, int probe_rows,
+                                      uint32_t* __restrict probe_idxs,
+                                      uint32_t* __restrict build_idxs) {
+        DCHECK(is_radix_partitioned());
+        auto matched_cnt = 0;
+        const auto batch_size = max_batch_size;
+
+        auto do_the_probe = [&]() {
+            auto probe_idx = probe_order[probe_pos];
+            while (build_idx && matched_cnt < batch_size) {
+                if (keys[probe_idx] == build_keys[build_idx]) {
+                    probe_idxs[matched_cnt] = probe_idx;
+                    build_idxs[matched_cnt] = _partitioned_rows[build_idx];
+                    matched_cnt++;
+                }
+                build_idx = next[build_idx];
+            }
+            probe_pos++;
+        };
+
+        if (build_idx) {
+            do_the_probe();
+        }
+
+        while (probe_pos < probe_rows && matched_cnt < batch_size) {
+            build_idx = build_idx_map[probe_order[probe_pos]];
+            do_the_probe();
+        }
+
+        probe_pos -= (build_idx != 0);
+        return std::tuple {probe_pos, build_idx, matched_cnt};
+    }
+
     bool has_null_key() { return _has_null_key; }
 
-    void pre_build_idxs(std::vector<uint32>& buckets, const uint8_t* null_map) const {
+    void pre_build_idxs(std::vector<uint32>& buckets, const uint8_t* null_map,
+                        const uint8_t* bucket_tags = nullptr) const {
+        if (_use_bucket_tags && bucket_tags) {
+            _pre_build_idxs_tagged(buckets, null_map, bucket_tags);
+            return;
+        }
+        if (_probe_prefetch) {
+            _pre_build_idxs_prefetch(buckets, null_map);
+            return;
+        }
         if (null_map) {
             for (unsigned int& bucket : buckets) {
                 bucket = bucket == bucket_size ? bucket_size : first[bucket];
@@ -264,7 +406,118 @@ public:
         }
     }
 
+    /// Same as `pre_build_idxs` on a radix partitioned hash table. The probe rows are sorted
+    /// by partition into `probe_order`, and the bucket heads are looked up in that order.
+    void pre_build_idxs_radix_partitioned(std::vector<uint32>& buckets,
+                                          std::vector<uint32_t>& probe_order,
+                                          const uint8_t* bucket_tags = nullptr) const {
+        DCHECK(is_radix_partitioned());
+        // the last partition is of the null bucket
+        const size_t num_partitions = (1 << _partition_bits) + 1;
+        std::vector<uint32_t> offsets(num_partitions + 1, 0);
+        for (auto bucket : buckets) {
+            ++offsets[(bucket >> _partition_shift) + 1];
+        }
+        for (size_t i = 1; i < num_partitions; ++i) {
+            offsets[i] += offsets[i - 1];
+        }
+        probe_order.resize(buckets.size());
+        for (uint32_t i = 0; i < buckets.size(); ++i) {
+            probe_order[offsets[buckets[i] >> _partition_shift]++] = i;
+        }
+        if (_use_bucket_tags && bucket_tags) {
+            for (auto probe_idx : probe_order) {
+                auto bucket = buckets[probe_idx];
+                buckets[probe_idx] =
+                        _bucket_tags[bucket] & bucket_tags[probe_idx] ? first[bucket] : 0;
+            }
+        } else {
+            for (auto probe_idx : probe_order) {
+                buckets[probe_idx] = first[buckets[probe_idx]];
+            }
+        }
+    }
+
 private:
+    // The bucket heads are looked up for the whole probe block, with the head of the bucket
+    // HASH_MAP_PREFETCH_DIST rows ahead prefetched.
+    void _pre_build_idxs_prefetch(std::vector<uint32>& buckets, const uint8_t* null_map) const {
+        const size_t num_rows = buckets.size();
+        for (size_t i = 0; i < num_rows; ++i) {
+            if (LIKELY(i + HASH_MAP_PREFETCH_DIST < num_rows)) {
+                __builtin_prefetch(&first[buckets[i + HASH_MAP_PREFETCH_DIST]]);
+            }
+            auto& bucket = buckets[i];
+            bucket = null_map && bucket == bucket_size ? bucket_size : first[bucket];
+        }
+    }
+
+    // Same as `pre_build_idxs`, but the bucket head of a probe row is looked up only if its tag
+    // is in the tags of the bucket. The tags are a quarter of the size of the bucket heads, so
+    // they are more likely to stay in the cache when most probe rows match nothing.
+    void _pre_build_idxs_tagged(std::vector<uint32>& buckets, const uint8_t* null_map,
+                                const uint8_t* __restrict bucket_tags) const {
+        const size_t num_rows = buckets.size();
+        for (size_t i = 0; i < num_rows; ++i) {
+            if (_probe_prefetch && i + HASH_MAP_PREFETCH_DIST < num_rows) {
+                __builtin_prefetch(&_bucket_tags[buckets[i + HASH_MAP_PREFETCH_DIST]]);
+            }
+            auto& bucket = buckets[i];
+            if (null_map && bucket == bucket_size) {
+                continue;
+            }
+            bucket = _bucket_tags[bucket] & bucket_tags[i] ? first[bucket] : 0;
+        }
+    }
+
+    // Prefetch the key and the chain link of the first build row of the probe row
+    // HASH_MAP_PREFETCH_DIST rows ahead. Its bucket head is resolved by `pre_build_idxs`, so
+    // the chains are walked while the following ones are being loaded.
+    void _prefetch_chain(const uint32_t* __restrict build_idx_map, int probe_idx,
+                         int probe_rows) const {
+        if (_probe_prefetch && probe_idx + HASH_MAP_PREFETCH_DIST < probe_rows) {
+            auto build_idx = build_idx_map[probe_idx + HASH_MAP_PREFETCH_DIST];
+            // it may be the null bucket
+            if (build_idx < next.size()) {
+                __builtin_prefetch(&build_keys[build_idx]);
+                __builtin_prefetch(&next[build_idx]);
+            }
+        }
+    }
+
+    void _build_radix_partitioned(const Key* __restrict keys,
+                                  const uint32_t* __restrict bucket_nums, size_t num_elem) {
+        // the last partition is of the null bucket, and row 0 is the mocked row
+        const size_t num_partitions = (1 << _partition_bits) + 1;
+        std::vector<uint32_t> offsets(num_partitions + 1, 0);
+        for (size_t i = 1; i < num_elem; i++) {
+            ++offsets[(bucket_nums[i] >> _partition_shift) + 1];
+        }
+        offsets[0] = 1;
+        for (size_t i = 1; i < num_partitions; ++i) {
+            offsets[i] += offsets[i - 1];
+        }
+
+        std::vector<uint32_t> partitioned_buckets(num_elem, 0);
+        _partitioned_keys.resize(num_elem);
+        _partitioned_rows.resize(num_elem);
+        _partitioned_keys[0] = keys[0];
+        _partitioned_rows[0] = 0;
+        for (size_t i = 1; i < num_elem; i++) {
+            auto pos = offsets[bucket_nums[i] >> _partition_shift]++;
+            _partitioned_keys[pos] = keys[i];
+            _partitioned_rows[pos] = i;
+            partitioned_buckets[pos] = bucket_nums[i];
+        }
+
+        for (size_t i = 1; i < num_elem; i++) {
+            uint32_t bucket_num = partitioned_buckets[i];
+            next[i] = first[bucket_num];
+            first[bucket_num] = i;
+        }
+        build_keys = _partitioned_keys.data();
+    }
+
     template <int JoinOpType>
     auto _process_null_aware_left_half_join_for_empty_build_side(int probe_idx, int probe_rows,
                                                                  uint32_t* __restrict probe_idxs,
@@ -287,6 +540,7 @@ private:
                                      const uint32_t* __restrict build_idx_map, int probe_idx,
                                      int probe_rows) {
         while (probe_idx < probe_rows) {
+            _prefetch_chain(build_idx_map, probe_idx, probe_rows);
             auto build_idx = build_idx_map[probe_idx];
 
             while (build_idx) {
@@ -315,6 +569,7 @@ private:
                 }
             }
 
+            _prefetch_chain(build_idx_map, probe_idx, probe_rows);
             auto build_idx = build_idx_map[probe_idx];
 
             while (build_idx && keys[probe_idx] != build_keys[build_idx]) {
@@ -388,6 +643,7 @@ private:
         }
 
         while (probe_idx < probe_rows && matched_cnt < batch_size) {
+            _prefetch_chain(build_idx_map, probe_idx, probe_rows);
             build_idx = build_idx_map[probe_idx];
             do_the_probe();
         }
@@ -442,6 +698,7 @@ private:
         }
 
         while (probe_idx < probe_rows && matched_cnt < batch_size) {
+            _prefetch_chain(build_idx_map, probe_idx, probe_rows);
             build_idx = build_idx_map[probe_idx];
             do_the_probe();
         }
@@ -464,5 +721,24 @@ private:
     vectorized::Arena* pool;
     bool _has_null_key = false;
     bool _empty_build_side = true;
+
+    static constexpr size_t PROBE_PREFETCH_MIN_BUILD_ROWS = 1 << 16;
+    bool _probe_prefetch = false;
+
+    static constexpr size_t BUCKET_TAGS_MIN_BUILD_ROWS = 1 << 16;
+    bool _use_bucket_tags = false;
+    // bucket -> OR of `bucket_tag` of the rows in it, empty if not `_use_bucket_tags`
+    std::vector<uint8_t> _bucket_tags;
+
+    // more partitions make the scatter of rows miss the TLB
+    static constexpr int MAX_RADIX_PARTITION_BITS = 10;
+    // 0 if the hash table is not radix partitioned, otherwise the rows of a partition have
+    // the same `bucket_num >> _partition_shift`, and `first`, `next` and `build_keys` are
+    // indexed by the position of the row in the partitioned order
+    int _partition_bits = 0;
+    int _partition_shift = 0;
+    std::vector<Key> _partitioned_keys;
+    // position in the partitioned order -> row of the build block
+    std::vector<uint32_t> _partitioned_rows;
 };
 } // namespace doris
\ No newline at end of file
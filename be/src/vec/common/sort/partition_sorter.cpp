@@ -65,13 +65,10 @@ Status PartitionSorter::append_block(Block* input_block) {
 Status PartitionSorter::prepare_for_read() {
     auto& cursors = _state->get_cursors();
     auto& blocks = _state->get_sorted_block();
-    auto& priority_queue = _state->get_priority_queue();
     for (auto& block : blocks) {
         cursors.emplace_back(block, _sort_description);
     }
-    for (auto& cursor : cursors) {
-        priority_queue.push(MergeSortCursor(&cursor));
-    }
+    _state->get_loser_tree().init(std::vector<MergeSortCursor>(cursors.begin(), cursors.end()));
     return Status::OK();
 }
 
@@ -81,6 +78,9 @@ void PartitionSorter::reset_sorter_state(RuntimeState* runtime_state) {
     std::swap(_block_priority_queue, empty_queue);
     _state = MergeSorterState::create_unique(_row_desc, _offset, _limit, runtime_state, nullptr);
     _previous_row->reset();
+    // the rows output by the last sort are sorted again with the new rows
+    _output_total_rows = 0;
+    _output_distinct_rows = 0;
 }
 
 Status PartitionSorter::get_next(RuntimeState* state, Block* block, bool* eos) {
@@ -106,12 +106,11 @@ Status PartitionSorter::partition_sort_read(Block* output_block, bool* eos, int
             VectorizedUtils::build_mutable_mem_reuse_block(output_block, sorted_block);
     MutableColumns& merged_columns = m_block.mutable_columns();
     size_t current_output_rows = 0;
-    auto& priority_queue = _state->get_priority_queue();
+    auto& loser_tree = _state->get_loser_tree();
 
     bool get_enough_data = false;
-    while (!priority_queue.empty()) {
-        auto current = priority_queue.top();
-        priority_queue.pop();
+    while (!loser_tree.empty()) {
+        auto current = loser_tree.top();
         if (UNLIKELY(_previous_row->impl == nullptr)) {
             *_previous_row = current;
         }
@@ -191,7 +190,9 @@ Status PartitionSorter::partition_sort_read(Block* output_block, bool* eos, int
 
         if (!current->is_last()) {
             current->next();
-            priority_queue.push(current);
+            loser_tree.update_top();
+        } else {
+            loser_tree.remove_top();
         }
 
         if (current_output_rows == batch_size || get_enough_data == true) {
@@ -57,8 +57,7 @@ namespace doris::vectorized {
 //
 
 void MergeSorterState::reset() {
-    auto empty_queue = std::priority_queue<MergeSortCursor>();
-    priority_queue_.swap(empty_queue);
+    loser_tree_.clear();
     std::vector<MergeSortCursorImpl> empty_cursors(0);
     cursors_.swap(empty_cursors);
     std::vector<Block> empty_blocks(0);
@@ -83,9 +82,7 @@ Status MergeSorterState::build_merge_tree(const SortDescription& sort_descriptio
     }
 
     if (sorted_blocks_.size() > 1) {
-        for (auto& cursor : cursors_) {
-            priority_queue_.emplace(&cursor);
-        }
+        loser_tree_.init(std::vector<MergeSortCursor>(cursors_.begin(), cursors_.end()));
     }
 
     return Status::OK();
@@ -114,23 +111,33 @@ Status MergeSorterState::_merge_sort_read_impl(int batch_size, doris::vectorized
     MutableBlock m_block = VectorizedUtils::build_mutable_mem_reuse_block(block, sorted_blocks_[0]);
     MutableColumns& merged_columns = m_block.mutable_columns();
 
-    /// Take rows from queue in right order and push to 'merged'.
+    /// Take rows from the loser tree in right order and push to 'merged'.
     size_t merged_rows = 0;
-    while (!priority_queue_.empty()) {
-        auto current = priority_queue_.top();
-        priority_queue_.pop();
+    while (!loser_tree_.empty()) {
+        auto current = loser_tree_.top();
+        size_t rows = loser_tree_.next_batch_rows(offset_ > 0 ? size_t(offset_)
+                                                             : size_t(batch_size) - merged_rows);
 
         if (offset_ == 0) {
-            for (size_t i = 0; i < num_columns; ++i)
-                merged_columns[i]->insert_from(*current->all_columns[i], current->pos);
-            ++merged_rows;
+            for (size_t i = 0; i < num_columns; ++i) {
+                if (rows == 1) {
+                    merged_columns[i]->insert_from(*current->all_columns[i], current->pos);
+                } else {
+                    merged_columns[i]->insert_range_from(*current->all_columns[i], current->pos,
+                                                         rows);
+                }
+            }
+            merged_rows += rows;
         } else {
-            offset_--;
+            offset_ -= rows;
         }
 
+        current->pos += rows - 1;
         if (!current->is_last()) {
             current->next();
-            priority_queue_.push(current);
+            loser_tree_.update_top();
+        } else {
+            loser_tree_.remove_top();
         }
 
         if (merged_rows == batch_size) break;
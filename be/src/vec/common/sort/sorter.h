@@ -33,6 +33,7 @@
 #include "vec/core/field.h"
 #include "vec/core/sort_cursor.h"
 #include "vec/core/sort_description.h"
+#include "vec/core/sort_loser_tree.h"
 #include "vec/runtime/vsorted_run_merger.h"
 #include "vec/utils/util.hpp"
 
@@ -75,7 +76,7 @@ public:
     Block& last_sorted_block() { return sorted_blocks_.back(); }
 
     std::vector<Block>& get_sorted_block() { return sorted_blocks_; }
-    std::priority_queue<MergeSortCursor>& get_priority_queue() { return priority_queue_; }
+    MergeSortLoserTree& get_loser_tree() { return loser_tree_; }
     std::vector<MergeSortCursorImpl>& get_cursors() { return cursors_; }
     void reset();
 
@@ -86,7 +87,7 @@ private:
 
     Status _merge_sort_read_impl(int batch_size, doris::vectorized::Block* block, bool* eos);
 
-    std::priority_queue<MergeSortCursor> priority_queue_;
+    MergeSortLoserTree loser_tree_;
     std::vector<MergeSortCursorImpl> cursors_;
     std::vector<Block> sorted_blocks_;
     size_t in_mem_sorted_bocks_size_ = 0;
@@ -0,0 +1,129 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+#include "vec/common/string_ref.h"
+
+namespace doris {
+
+// A 16 bytes view of a string, which keeps the size and the first 4 bytes of the string, and
+// the string itself if it is at most 12 bytes, or else a pointer to it. Two strings differing
+// in the first 4 bytes are compared without touching their chars, and two short strings are
+// compared entirely inside the views. The view does not own the chars of a long string, like
+// StringRef, and the inlined chars are zero padded.
+class StringView {
+public:
+    static constexpr size_t PREFIX_SIZE = 4;
+    static constexpr size_t INLINE_SIZE = 12;
+
+    StringView() = default;
+
+    explicit StringView(const char* data, size_t size) : _size(static_cast<uint32_t>(size)) {
+        DCHECK_LE(size, std::numeric_limits<uint32_t>::max());
+        if (is_inline()) {
+            memcpy(_inlined_chars(), data, size);
+        } else {
+            memcpy(_prefix, data, PREFIX_SIZE);
+            _value.data = data;
+        }
+    }
+
+    explicit StringView(const StringRef& ref) : StringView(ref.data, ref.size) {}
+
+    uint32_t size() const { return _size; }
+    bool is_inline() const { return _size <= INLINE_SIZE; }
+
+    const char* data() const { return is_inline() ? _inlined_chars() : _value.data; }
+
+    StringRef to_string_ref() const { return {data(), _size}; }
+
+    bool operator==(const StringView& rhs) const {
+        // the size and the prefix
+        if (_size_and_prefix() != rhs._size_and_prefix()) {
+            return false;
+        }
+        if (is_inline()) {
+            return _value.inlined == rhs._value.inlined;
+        }
+        return memcmp(_value.data + PREFIX_SIZE, rhs._value.data + PREFIX_SIZE,
+                      _size - PREFIX_SIZE) == 0;
+    }
+
+    bool operator!=(const StringView& rhs) const { return !(*this == rhs); }
+
+    // Same as the memcmp of the chars, the shorter string is less if it is a prefix of the
+    // longer one.
+    int compare(const StringView& rhs) const {
+        // the zero padding is not greater than any byte, so different prefixes in big endian
+        // order compare like their strings
+        uint32_t lhs_prefix = _prefix_as_big_endian();
+        uint32_t rhs_prefix = rhs._prefix_as_big_endian();
+        if (lhs_prefix != rhs_prefix) {
+            return lhs_prefix < rhs_prefix ? -1 : 1;
+        }
+        uint32_t min_size = std::min(_size, rhs._size);
+        if (min_size > PREFIX_SIZE) {
+            int res = memcmp(data() + PREFIX_SIZE, rhs.data() + PREFIX_SIZE,
+                             min_size - PREFIX_SIZE);
+            if (res != 0) {
+                return res;
+            }
+        }
+        return _size < rhs._size ? -1 : (_size > rhs._size ? 1 : 0);
+    }
+
+    bool operator<(const StringView& rhs) const { return compare(rhs) < 0; }
+    bool operator>(const StringView& rhs) const { return compare(rhs) > 0; }
+
+private:
+    // The inlined chars are the prefix followed by the value.
+    char* _inlined_chars() { return reinterpret_cast<char*>(this) + sizeof(_size); }
+    const char* _inlined_chars() const {
+        return reinterpret_cast<const char*>(this) + sizeof(_size);
+    }
+
+    uint64_t _size_and_prefix() const {
+        uint64_t res;
+        memcpy(&res, this, sizeof(res));
+        return res;
+    }
+
+    uint32_t _prefix_as_big_endian() const {
+        uint32_t res;
+        memcpy(&res, _prefix, sizeof(res));
+        return __builtin_bswap32(res);
+    }
+
+    uint32_t _size = 0;
+    char _prefix[PREFIX_SIZE] = {};
+    union {
+        uint64_t inlined;
+        const char* data;
+    } _value {0};
+};
+
+static_assert(sizeof(StringView) == 16);
+
+} // namespace doris
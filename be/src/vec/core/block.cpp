@@ -83,8 +83,31 @@ Block::Block(const std::vector<SlotDescriptor*>& slots, size_t block_size,
     }
 }
 
+namespace {
+// Reuse the column at `position` of `old_block` to deserialize data of `type`, so that the
+// memory of the column is not allocated again. Return nullptr if it can not be reused.
+MutableColumnPtr try_reuse_column(Block& old_block, size_t position, const DataTypePtr& type,
+                                  int be_exec_version) {
+    // The old serde may append to the column, only the new serde resizes the column.
+    if (be_exec_version < USE_NEW_SERDE || position >= old_block.columns()) {
+        return nullptr;
+    }
+    auto& old = old_block.get_by_position(position);
+    if (old.column == nullptr || old.type == nullptr || old.column->use_count() != 1 ||
+        is_column_const(*old.column) || !old.type->equals(*type) ||
+        type->get_type_id() == TypeIndex::VARIANT) {
+        return nullptr;
+    }
+    auto column = (*std::move(old.column)).mutate();
+    column->clear();
+    return column;
+}
+} // namespace
+
 Status Block::deserialize(const PBlock& pblock) {
-    swap(Block());
+    // The columns of current data are reused if they match the types in `pblock`.
+    Block old_block;
+    old_block.swap(*this);
     int be_exec_version = pblock.has_be_exec_version() ? pblock.be_exec_version() : 0;
     CHECK(BeExecVersionManager::check_be_exec_version(be_exec_version));
 
@@ -121,9 +144,14 @@ Status Block::deserialize(const PBlock& pblock) {
         buf = pblock.column_values().data();
     }
 
+    size_t position = 0;
     for (const auto& pcol_meta : pblock.column_metas()) {
         DataTypePtr type = DataTypeFactory::instance().create_data_type(pcol_meta);
-        MutableColumnPtr data_column = type->create_column();
+        MutableColumnPtr data_column =
+                try_reuse_column(old_block, position++, type, be_exec_version);
+        if (data_column == nullptr) {
+            data_column = type->create_column();
+        }
         // Here will try to allocate large memory, should return error if failed.
         RETURN_IF_CATCH_EXCEPTION(
                 buf = type->deserialize(buf, data_column.get(), pblock.be_exec_version()));
@@ -0,0 +1,64 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <concurrentqueue.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "vec/core/block.h"
+
+namespace doris::vectorized {
+
+// A bounded pool of blocks whose column data is cleared but whose memory is kept.
+// It is shared by the producers and the consumers of a data stream: a producer takes a
+// block from the pool to fill, and a consumer gives it back after the data is consumed,
+// so that the columns are not allocated again for every batch.
+class BlockPool {
+public:
+    // `limit` <= 0 means the pool is unbounded.
+    explicit BlockPool(int64_t limit = 0) : _limit(limit) {}
+
+    // Return true and swap a free block into `block` if the pool is not empty.
+    bool try_get(Block* block) { return _blocks.try_dequeue(*block); }
+
+    // Clear the column data of `block` and keep it for reuse. The block is dropped if the
+    // pool is full or any of its columns is still shared.
+    bool give_back(Block&& block) {
+        if (block.columns() == 0 || (_limit > 0 && _blocks.size_approx() >= _limit)) {
+            return false;
+        }
+        for (size_t i = 0; i < block.columns(); ++i) {
+            const auto& column = block.get_by_position(i).column;
+            if (column == nullptr || column->use_count() != 1) {
+                return false;
+            }
+        }
+        block.clear_column_data();
+        _blocks.enqueue(std::move(block));
+        return true;
+    }
+
+    size_t size_approx() const { return _blocks.size_approx(); }
+
+private:
+    const int64_t _limit;
+    moodycamel::ConcurrentQueue<Block> _blocks;
+};
+
+} // namespace doris::vectorized
@@ -20,7 +20,11 @@
 
 #include "vec/core/sort_block.h"
 
+#include <limits>
+
+#include "vec/common/radix_sort.h"
 #include "vec/core/column_with_type_and_name.h"
+#include "vec/core/sort_normalized_key.h"
 
 namespace doris::vectorized {
 
@@ -42,12 +46,98 @@ ColumnsWithSortDescriptions get_columns_with_sort_description(const Block& block
     return res;
 }
 
+namespace {
+
+template <typename T>
+struct ValueWithIndex {
+    T value;
+    UInt32 index;
+};
+
+template <typename T>
+struct RadixSortTraits : RadixSortUIntTraits<T> {
+    using Element = ValueWithIndex<T>;
+    static T& extract_key(Element& elem) { return elem.value; }
+};
+
+// Stable LSD radix sort of the permutation by the bits [shift, shift + sizeof(Key) * 8).
+template <typename Key>
+void radix_sort_by(const NormalizedSortKey* keys, size_t shift, IColumn::Permutation& perm) {
+    size_t rows = perm.size();
+    PaddedPODArray<ValueWithIndex<Key>> pairs(rows);
+    for (size_t i = 0; i < rows; ++i) {
+        pairs[i] = {Key(keys[perm[i]] >> shift), UInt32(perm[i])};
+    }
+    RadixSort<RadixSortTraits<Key>>::execute_lsd(pairs.data(), rows);
+    for (size_t i = 0; i < rows; ++i) {
+        perm[i] = pairs[i].index;
+    }
+}
+
+void radix_sort_by_bits(const NormalizedSortKey* keys, size_t shift, size_t bits,
+                        IColumn::Permutation& perm) {
+    if (bits <= 32) {
+        radix_sort_by<UInt32>(keys, shift, perm);
+    } else {
+        radix_sort_by<UInt64>(keys, shift, perm);
+    }
+}
+
+// Sort the rows by the normalized keys, if all the sort columns can be encoded in them.
+bool radix_sort_permutation(const Block& block, const SortDescription& description,
+                            IColumn::Permutation& perm) {
+    // sorting a few rows by comparison is cheaper than building the keys
+    static constexpr size_t MIN_RADIX_SORT_ROWS = 256;
+    size_t rows = block.rows();
+    if (rows < MIN_RADIX_SORT_ROWS || rows > std::numeric_limits<UInt32>::max()) {
+        return false;
+    }
+    ColumnRawPtrs columns;
+    for (const auto& [column, desc] : get_columns_with_sort_description(block, description)) {
+        columns.push_back(column);
+    }
+    auto layout = plan_normalized_sort_keys(columns, description, false);
+    if (layout.empty() || layout.full_columns != description.size()) {
+        return false;
+    }
+    NormalizedSortKeys keys;
+    encode_normalized_sort_keys(columns, description, layout, keys);
+
+    perm.resize(rows);
+    for (size_t i = 0; i < rows; ++i) {
+        perm[i] = i;
+    }
+    // the low 64 bits first, then the high bits, the result is ordered by both as the radix
+    // sort is stable
+    if (layout.bits > 64) {
+        radix_sort_by<UInt64>(keys.data(), 0, perm);
+        radix_sort_by_bits(keys.data(), 64, layout.bits - 64, perm);
+    } else {
+        radix_sort_by_bits(keys.data(), 0, layout.bits, perm);
+    }
+    return true;
+}
+
+} // namespace
+
 void sort_block(Block& src_block, Block& dest_block, const SortDescription& description,
                 UInt64 limit) {
     if (!src_block.columns()) {
         return;
     }
 
+    if (limit == 0 || limit >= src_block.rows()) {
+        IColumn::Permutation perm;
+        if (radix_sort_permutation(src_block, description, perm)) {
+            size_t columns = src_block.columns();
+            for (size_t i = 0; i < columns; ++i) {
+                dest_block.replace_by_position(
+                        i, src_block.get_by_position(i).column->permute(perm, 0));
+            }
+            return;
+        }
+    }
+
     /// If only one column to sort by
     if (description.size() == 1) {
         bool reverse = description[0].direction == -1;
@@ -34,8 +34,8 @@
 #include "vec/columns/column.h"
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/column_string.h"
-#include "vec/common/memcmp_small.h"
 #include "vec/common/string_ref.h"
+#include "vec/common/string_view.h"
 #include "vec/core/block.h"
 #include "vec/core/sort_description.h"
 #include "vec/core/types.h"
@@ -219,7 +219,7 @@ public:
         if (!_should_inline_value(perms)) {
             _sort_by_default(column, flags, perms, range, last_column);
         } else {
-            _sort_by_inlined_permutation<StringRef>(column, flags, perms, range, last_column);
+            _sort_by_inlined_permutation<StringView>(column, flags, perms, range, last_column);
         }
     }
 
@@ -333,6 +333,8 @@ private:
             if constexpr (std::is_same_v<ColumnType, ColumnVector<T>> ||
                           std::is_same_v<ColumnType, ColumnDecimal<T>>) {
                 permutation_for_column[i].inline_value = column.get_data()[row_id];
+            } else if constexpr (std::is_same_v<T, StringView>) {
+                permutation_for_column[i].inline_value = StringView(column.get_data_at(row_id));
             } else if constexpr (std::is_same_v<ColumnType, ColumnString> ||
                                  std::is_same_v<ColumnType, ColumnString64>) {
                 permutation_for_column[i].inline_value = column.get_data_at(row_id);
@@ -414,13 +416,12 @@ private:
         _create_permutation(column, permutation_for_column.data(), perms);
         auto comparator = [&](const PermutationWithInlineValue<InlineType>& a,
                               const PermutationWithInlineValue<InlineType>& b) {
-            if constexpr (!std::is_same_v<ColumnType, ColumnString>) {
+            if constexpr (std::is_same_v<InlineType, StringView>) {
+                // strings of different prefixes are compared without touching the chars
+                return a.inline_value.compare(b.inline_value);
+            } else {
                 return a.inline_value > b.inline_value ? 1
                                                        : (a.inline_value < b.inline_value ? -1 : 0);
-            } else {
-                return memcmp_small_allow_overflow15(
-                        reinterpret_cast<const UInt8*>(a.inline_value.data), a.inline_value.size,
-                        reinterpret_cast<const UInt8*>(b.inline_value.data), b.inline_value.size);
             }
         };
 
@@ -20,9 +20,11 @@
 
 #pragma once
 
+#include "common/config.h"
 #include "vec/columns/column.h"
 #include "vec/core/block.h"
 #include "vec/core/sort_description.h"
+#include "vec/core/sort_normalized_key.h"
 #include "vec/exprs/vexpr_context.h"
 
 namespace doris::vectorized {
@@ -126,6 +128,10 @@ struct MergeSortCursorImpl {
     size_t sort_columns_size = 0;
     size_t pos = 0;
     size_t rows = 0;
+    // the leading sort columns of the rows encoded once per block, the rows are compared by
+    // them before the columns
+    NormalizedSortKeyLayout key_layout;
+    NormalizedSortKeys normalized_keys;
 
     MergeSortCursorImpl() = default;
     virtual ~MergeSortCursorImpl() = default;
@@ -161,6 +167,31 @@ struct MergeSortCursorImpl {
 
         pos = 0;
         rows = all_columns[0]->size();
+
+        key_layout = {};
+        if (config::enable_merge_sort_normalized_key && rows > 0) {
+            key_layout = plan_normalized_sort_keys(sort_columns, desc, true);
+            if (!key_layout.empty()) {
+                encode_normalized_sort_keys(sort_columns, desc, key_layout, normalized_keys);
+            }
+        }
+    }
+
+    /// Compare the rows by the normalized keys. If they are equal or not comparable, return 0
+    /// and set `next_column` to the first sort column left to compare.
+    int compare_normalized_keys(size_t lhs_pos, const MergeSortCursorImpl& rhs, size_t rhs_pos,
+                                size_t* next_column) const {
+        *next_column = 0;
+        if (!key_layout.comparable(rhs.key_layout)) {
+            return 0;
+        }
+        auto lhs_key = normalized_keys[lhs_pos];
+        auto rhs_key = rhs.normalized_keys[rhs_pos];
+        if (lhs_key != rhs_key) {
+            return lhs_key < rhs_key ? -1 : 1;
+        }
+        *next_column = key_layout.full_columns;
+        return 0;
     }
 
     bool is_first() const { return pos == 0; }
@@ -250,7 +281,11 @@ struct MergeSortCursor {
 
     /// The specified row of this cursor is greater than the specified row of another cursor.
     int8_t greater_at(const MergeSortCursor& rhs, size_t lhs_pos, size_t rhs_pos) const {
-        for (size_t i = 0; i < impl->sort_columns_size; ++i) {
+        size_t i = 0;
+        if (int res = impl->compare_normalized_keys(lhs_pos, *rhs.impl, rhs_pos, &i); res != 0) {
+            return res > 0 ? 1 : -1;
+        }
+        for (; i < impl->sort_columns_size; ++i) {
             int direction = impl->desc[i].direction;
             int nulls_direction = impl->desc[i].nulls_direction;
             int res = direction * impl->sort_columns[i]->compare_at(lhs_pos, rhs_pos,
@@ -293,7 +328,12 @@ struct MergeSortBlockCursor {
 
     /// The specified row of this cursor is greater than the specified row of another cursor.
     int8_t less_at(const MergeSortBlockCursor& rhs, int rows) const {
-        for (size_t i = 0; i < impl->sort_columns_size; ++i) {
+        size_t i = 0;
+        if (int res = impl->compare_normalized_keys(rows, *rhs.impl, rhs->rows - 1, &i);
+            res != 0) {
+            return res < 0 ? 1 : -1;
+        }
+        for (; i < impl->sort_columns_size; ++i) {
             int direction = impl->desc[i].direction;
             int nulls_direction = impl->desc[i].nulls_direction;
             int res = direction * impl->sort_columns[i]->compare_at(rows, rhs->rows - 1,
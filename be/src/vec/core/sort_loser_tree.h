@@ -0,0 +1,172 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "common/logging.h"
+#include "vec/core/sort_cursor.h"
+
+namespace doris::vectorized {
+
+/// A loser tree of merge sort cursors, whose top is the cursor of the smallest current row.
+/// Each inner node keeps the loser of the match between its children, so a change of the top
+/// cursor is replayed by one comparison per level, half of a binary heap.
+///
+/// The caller moves the position of the top cursor, then calls `update_top()`, or
+/// `remove_top()` if the cursor has no rows left. The tree is not touched in between, so the
+/// top cursor may fetch its next block before it is replayed.
+class MergeSortLoserTree {
+public:
+    void init(std::vector<MergeSortCursor> cursors) {
+        _cursors = std::move(cursors);
+        _exhausted.assign(_cursors.size(), false);
+        _nodes.assign(std::max<size_t>(_cursors.size(), 1), 0);
+        _size = _cursors.size();
+        _streak = false;
+        if (_size > 0) {
+            _nodes[0] = _build(1);
+        }
+    }
+
+    void clear() { init({}); }
+
+    bool empty() const { return _size == 0; }
+    size_t size() const { return _size; }
+
+    MergeSortCursor& top() {
+        DCHECK(!empty());
+        return _cursors[_nodes[0]];
+    }
+
+    /// The top cursor has moved to its next rows.
+    void update_top() {
+        size_t previous = _nodes[0];
+        _replay();
+        _streak = _nodes[0] == previous;
+    }
+
+    /// The top cursor has no rows left.
+    void remove_top() {
+        _exhausted[_nodes[0]] = true;
+        --_size;
+        _replay();
+        _streak = false;
+    }
+
+    /// The number of the rows of the top cursor from its position, at most `max_rows`, which
+    /// go before the rows of all the other cursors and could be output at once.
+    /// The rows are only looked for if the top cursor won again after its last row, otherwise
+    /// the cursors are likely to interleave row by row and 1 is returned.
+    size_t next_batch_rows(size_t max_rows) {
+        auto& current = top();
+        size_t rows = std::min(max_rows, current->rows - current->pos);
+        if (!_streak || rows <= 1) {
+            return std::min<size_t>(rows, 1);
+        }
+        // the next cursor is the best of the losers on the path of the top cursor
+        size_t winner = _nodes[0];
+        size_t challenger = _cursors.size();
+        for (size_t node = _parent(winner); node > 0; node /= 2) {
+            size_t loser = _nodes[node];
+            if (!_exhausted[loser] && (challenger == _cursors.size() || _less(loser, challenger))) {
+                challenger = loser;
+            }
+        }
+        if (challenger == _cursors.size()) {
+            return rows;
+        }
+        auto before_challenger = [&](size_t count) {
+            int res = current.greater_at(_cursors[challenger], current->pos + count - 1,
+                                         _cursors[challenger]->pos);
+            return res < 0 || (res == 0 && winner < challenger);
+        };
+        // gallop for a block which does not overlap the other cursors, then binary search in
+        // the last step, `good` rows go first and the `bad`th row does not
+        size_t good = 1;
+        size_t bad = rows + 1;
+        for (size_t step = 1; good < rows; step *= 2) {
+            size_t probe = std::min(rows, good + step);
+            if (!before_challenger(probe)) {
+                bad = probe;
+                break;
+            }
+            good = probe;
+        }
+        while (bad - good > 1) {
+            size_t mid = (good + bad) / 2;
+            if (before_challenger(mid)) {
+                good = mid;
+            } else {
+                bad = mid;
+            }
+        }
+        return good;
+    }
+
+private:
+    size_t _parent(size_t leaf) const { return (leaf + _cursors.size()) / 2; }
+
+    // the exhausted cursors lose every match, the ties are won by the first cursor
+    bool _less(size_t lhs, size_t rhs) const {
+        if (_exhausted[lhs] || _exhausted[rhs]) {
+            return !_exhausted[lhs];
+        }
+        int res = _cursors[lhs].greater_at(_cursors[rhs], _cursors[lhs]->pos,
+                                           _cursors[rhs]->pos);
+        return res < 0 || (res == 0 && lhs < rhs);
+    }
+
+    // the leaves are the nodes from `_cursors.size()`, return the winner of the subtree
+    size_t _build(size_t node) {
+        if (node >= _cursors.size()) {
+            return node - _cursors.size();
+        }
+        size_t lhs = _build(node * 2);
+        size_t rhs = _build(node * 2 + 1);
+        if (_less(lhs, rhs)) {
+            _nodes[node] = rhs;
+            return lhs;
+        }
+        _nodes[node] = lhs;
+        return rhs;
+    }
+
+    void _replay() {
+        size_t winner = _nodes[0];
+        for (size_t node = _parent(winner); node > 0; node /= 2) {
+            if (_less(_nodes[node], winner)) {
+                std::swap(_nodes[node], winner);
+            }
+        }
+        _nodes[0] = winner;
+    }
+
+    std::vector<MergeSortCursor> _cursors;
+    std::vector<bool> _exhausted;
+    // the winner at 0 and the losers of the inner nodes
+    std::vector<size_t> _nodes;
+    size_t _size = 0;
+    // the top cursor won again after its last row
+    bool _streak = false;
+};
+
+} // namespace doris::vectorized
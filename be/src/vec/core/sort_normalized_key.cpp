@@ -0,0 +1,184 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/core/sort_normalized_key.h"
+
+#include <algorithm>
+#include <type_traits>
+
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/columns_number.h"
+
+namespace doris::vectorized {
+
+namespace {
+
+constexpr size_t KEY_BITS = sizeof(NormalizedSortKey) * 8;
+constexpr size_t MAX_PREFIX_BYTES = 8;
+
+// Call `func` with the data of the column if it is a fixed width integer column, including the
+// dates and the small decimals, and return false otherwise.
+template <typename Func>
+bool with_fixed_key_data(const IColumn* column, Func&& func) {
+    if (const auto* col = check_and_get_column<ColumnInt8>(column)) {
+        func(col->get_data().data());
+    } else if (const auto* col = check_and_get_column<ColumnInt16>(column)) {
+        func(col->get_data().data());
+    } else if (const auto* col = check_and_get_column<ColumnInt32>(column)) {
+        func(col->get_data().data());
+    } else if (const auto* col = check_and_get_column<ColumnInt64>(column)) {
+        func(col->get_data().data());
+    } else if (const auto* col = check_and_get_column<ColumnUInt8>(column)) {
+        func(col->get_data().data());
+    } else if (const auto* col = check_and_get_column<ColumnUInt16>(column)) {
+        func(col->get_data().data());
+    } else if (const auto* col = check_and_get_column<ColumnUInt32>(column)) {
+        func(col->get_data().data());
+    } else if (const auto* col = check_and_get_column<ColumnUInt64>(column)) {
+        func(col->get_data().data());
+    } else if (const auto* col = check_and_get_column<ColumnDecimal32>(column)) {
+        func(reinterpret_cast<const Int32*>(col->get_data().data()));
+    } else if (const auto* col = check_and_get_column<ColumnDecimal64>(column)) {
+        func(reinterpret_cast<const Int64*>(col->get_data().data()));
+    } else {
+        return false;
+    }
+    return true;
+}
+
+const IColumn* remove_nullable(const IColumn* column, const UInt8** null_map) {
+    if (const auto* nullable = check_and_get_column<ColumnNullable>(column)) {
+        if (null_map) {
+            *null_map = nullable->get_null_map_data().data();
+        }
+        return &nullable->get_nested_column();
+    }
+    return column;
+}
+
+void append_null_flag(const SortColumnDescription& desc, bool is_null, NormalizedSortKey& key) {
+    const bool nulls_last = desc.direction * desc.nulls_direction > 0;
+    key = (key << 1) | NormalizedSortKey(is_null == nulls_last);
+}
+
+template <typename T>
+void append_fixed_keys(const T* data, const UInt8* null_map, const SortColumnDescription& desc,
+                       NormalizedSortKeys& keys) {
+    using Bits = std::make_unsigned_t<T>;
+    constexpr size_t VALUE_BITS = sizeof(T) * 8;
+    const bool descending = desc.direction < 0;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        auto bits = Bits(data[i]);
+        if constexpr (std::is_signed_v<T>) {
+            bits ^= Bits(1) << (VALUE_BITS - 1);
+        }
+        if (descending) {
+            bits = ~bits;
+        }
+        if (null_map) {
+            append_null_flag(desc, null_map[i], keys[i]);
+            if (null_map[i]) {
+                bits = 0;
+            }
+        }
+        keys[i] = (keys[i] << VALUE_BITS) | bits;
+    }
+}
+
+// The first bytes of the string, padded by zeros, compare as the whole strings unless they are
+// equal, because the strings compare by their unsigned bytes and then by their lengths.
+void append_prefix_keys(const ColumnString& column, const UInt8* null_map, size_t prefix_bytes,
+                        const SortColumnDescription& desc, NormalizedSortKeys& keys) {
+    const size_t value_bits = prefix_bytes * 8;
+    const UInt64 mask = value_bits == 64 ? ~UInt64(0) : (UInt64(1) << value_bits) - 1;
+    const bool descending = desc.direction < 0;
+    for (size_t i = 0; i < keys.size(); ++i) {
+        UInt64 bits = 0;
+        auto value = column.get_data_at(i);
+        for (size_t j = 0; j < prefix_bytes; ++j) {
+            bits = (bits << 8) | (j < value.size ? UInt8(value.data[j]) : 0);
+        }
+        if (descending) {
+            bits = ~bits & mask;
+        }
+        if (null_map) {
+            append_null_flag(desc, null_map[i], keys[i]);
+            if (null_map[i]) {
+                bits = 0;
+            }
+        }
+        keys[i] = (keys[i] << value_bits) | bits;
+    }
+}
+
+} // namespace
+
+NormalizedSortKeyLayout plan_normalized_sort_keys(const ColumnRawPtrs& columns,
+                                                  const SortDescription& description,
+                                                  bool allow_prefix) {
+    NormalizedSortKeyLayout layout;
+    for (size_t i = 0; i < columns.size() && i < description.size(); ++i) {
+        const auto* column = columns[i];
+        size_t null_bits = column->is_nullable() ? 1 : 0;
+        column = remove_nullable(column, nullptr);
+        size_t value_bits = 0;
+        with_fixed_key_data(column, [&](const auto* data) { value_bits = sizeof(*data) * 8; });
+        if (value_bits > 0) {
+            if (layout.bits + null_bits + value_bits > KEY_BITS) {
+                break;
+            }
+            layout.bits += null_bits + value_bits;
+            layout.signature = layout.signature * 131 + null_bits + value_bits;
+            ++layout.full_columns;
+            continue;
+        }
+        if (allow_prefix && check_and_get_column<ColumnString>(column)) {
+            size_t prefix_bytes =
+                    std::min(MAX_PREFIX_BYTES, (KEY_BITS - layout.bits - null_bits) / 8);
+            if (prefix_bytes > 0) {
+                layout.prefix_bytes = prefix_bytes;
+                layout.bits += null_bits + prefix_bytes * 8;
+                layout.signature = (layout.signature * 131 + null_bits + prefix_bytes * 8) * 2;
+            }
+        }
+        break;
+    }
+    return layout;
+}
+
+void encode_normalized_sort_keys(const ColumnRawPtrs& columns, const SortDescription& description,
+                                 const NormalizedSortKeyLayout& layout, NormalizedSortKeys& keys) {
+    DCHECK(!layout.empty());
+    keys.assign(columns[0]->size(), NormalizedSortKey(0));
+    for (size_t i = 0; i < layout.full_columns; ++i) {
+        const UInt8* null_map = nullptr;
+        const auto* column = remove_nullable(columns[i], &null_map);
+        with_fixed_key_data(column, [&](const auto* data) {
+            append_fixed_keys(data, null_map, description[i], keys);
+        });
+    }
+    if (layout.prefix_bytes > 0) {
+        size_t i = layout.full_columns;
+        const UInt8* null_map = nullptr;
+        const auto* column = remove_nullable(columns[i], &null_map);
+        append_prefix_keys(assert_cast<const ColumnString&>(*column), null_map,
+                           layout.prefix_bytes, description[i], keys);
+    }
+}
+
+} // namespace doris::vectorized
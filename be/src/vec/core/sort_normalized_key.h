@@ -0,0 +1,63 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "vec/columns/column.h"
+#include "vec/common/pod_array.h"
+#include "vec/core/sort_description.h"
+
+namespace doris::vectorized {
+
+/// The leading sort columns of a row encoded into an unsigned integer, which compares in the
+/// order of the sort description. Each column is encoded by a null flag if it is nullable,
+/// placed by NULLS FIRST/LAST, then the order-preserving bits of its value, inverted if the
+/// order is descending.
+using NormalizedSortKey = unsigned __int128;
+using NormalizedSortKeys = PaddedPODArray<NormalizedSortKey>;
+
+struct NormalizedSortKeyLayout {
+    // the number of the leading sort columns encoded fully, rows with the same keys are
+    // ordered by the columns after them
+    size_t full_columns = 0;
+    // the column after the full columns is a string encoded by its first `prefix_bytes` bytes
+    size_t prefix_bytes = 0;
+    size_t bits = 0;
+    // the bits of each column encoded, only the keys of the same signature are comparable
+    uint64_t signature = 0;
+
+    bool empty() const { return bits == 0; }
+    bool comparable(const NormalizedSortKeyLayout& rhs) const {
+        return !empty() && bits == rhs.bits && signature == rhs.signature;
+    }
+};
+
+/// Choose the leading sort columns to encode into the keys. Integer columns, including the dates
+/// and the 32/64 bits decimals, are encoded fully. If `allow_prefix`, a string column ends the
+/// keys by its first bytes.
+NormalizedSortKeyLayout plan_normalized_sort_keys(const ColumnRawPtrs& columns,
+                                                  const SortDescription& description,
+                                                  bool allow_prefix);
+
+/// Encode the rows of the columns into `keys` by the layout, `keys` is resized to the rows.
+void encode_normalized_sort_keys(const ColumnRawPtrs& columns, const SortDescription& description,
+                                 const NormalizedSortKeyLayout& layout, NormalizedSortKeys& keys);
+
+} // namespace doris::vectorized
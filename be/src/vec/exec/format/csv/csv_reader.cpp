@@ -43,6 +43,7 @@
 #include "runtime/descriptors.h"
 #include "runtime/runtime_state.h"
 #include "runtime/types.h"
+#include "util/simd/bits.h"
 #include "util/string_util.h"
 #include "util/utf8_check.h"
 #include "vec/common/typeid_cast.h"
@@ -90,12 +91,12 @@ void PlainCsvTextFieldSplitter::_split_field_single_char(const Slice& line,
     const char* data = line.data;
     const size_t size = line.size;
     size_t value_start = 0;
-    for (size_t i = 0; i < size; ++i) {
-        if (data[i] == _value_sep[0]) {
-            process_value_func(data, value_start, i - value_start, _trimming_char, splitted_values);
-            value_start = i + _value_sep_len;
-        }
-    }
+    simd::for_each_byte(reinterpret_cast<const uint8_t*>(data), size, _value_sep[0],
+                        [&](size_t i) {
+                            process_value_func(data, value_start, i - value_start, _trimming_char,
+                                               splitted_values);
+                            value_start = i + _value_sep_len;
+                        });
     process_value_func(data, value_start, size - value_start, _trimming_char, splitted_values);
 }
 
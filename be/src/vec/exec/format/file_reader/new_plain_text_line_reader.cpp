@@ -29,6 +29,7 @@
 
 #include "exec/decompressor.h"
 #include "io/fs/file_reader.h"
+#include "util/simd/bits.h"
 #include "util/slice.h"
 
 // INPUT_CHUNK must
@@ -82,8 +83,7 @@ void EncloseCsvLineReaderContext::on_col_sep_found(const uint8_t* start,
 }
 
 size_t EncloseCsvLineReaderContext::update_reading_bound(const uint8_t* start) {
-    _result = (uint8_t*)memmem(start + _idx, _total_len - _idx, line_delimiter.c_str(),
-                               line_delimiter_len);
+    _result = find_line_delimiter(start + _idx, _total_len - _idx);
     if (_result == nullptr) {
         return _total_len;
     }
@@ -98,13 +98,10 @@ const uint8_t* EncloseCsvLineReaderContext::look_for_column_sep_pos(const uint8_
     const uint8_t* col_sep_pos = nullptr;
 
     if constexpr (SingleChar) {
-        char sep = column_sep[0];
+        uint8_t sep = column_sep[0];
         // note(tsy): tests show that simple `for + if` performs better than native memchr or memmem under normal `short feilds` case.
-        for (size_t i = 0; i < curr_len; ++i) {
-            if (curr_start[i] == sep) {
-                return curr_start + i;
-            }
-        }
+        // the inlined simd search keeps that advantage and compares 32 bytes at a time
+        return simd::find_first_of(curr_start, curr_len, sep, sep);
     } else {
         // note(tsy): can be optimized, memmem has relatively large overhaed when used multiple times in short pattern.
         col_sep_pos = (uint8_t*)memmem(curr_start, curr_len, column_sep, column_sep_len);
@@ -145,6 +142,17 @@ void EncloseCsvLineReaderContext::_on_normal(const uint8_t* start, size_t& len)
 void EncloseCsvLineReaderContext::_on_pre_match_enclose(const uint8_t* start, size_t& len) {
     do {
         do {
+            if (!_should_escape) {
+                // only the escape and the enclose char change the state inside an enclose, skip
+                // to the next of them
+                const uint8_t* next = simd::find_first_of(start + _idx, len - _idx, _escape,
+                                                          _enclose);
+                if (next == nullptr) {
+                    _idx = len;
+                    break;
+                }
+                _idx = next - start;
+            }
             if (start[_idx] == _escape) [[unlikely]] {
                 _should_escape = !_should_escape;
             } else if (_should_escape) [[unlikely]] {
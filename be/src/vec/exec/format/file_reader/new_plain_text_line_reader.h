@@ -74,6 +74,14 @@ public:
     inline void refresh() final { return static_cast<Ctx*>(this)->refresh_impl(); };
 
 protected:
+    inline const uint8_t* find_line_delimiter(const uint8_t* start, size_t length) const {
+        if (line_delimiter_len == 1) {
+            // memchr is vectorized and much faster than memmem for a single char
+            return (const uint8_t*)memchr(start, line_delimiter[0], length);
+        }
+        return (const uint8_t*)memmem(start, length, line_delimiter.c_str(), line_delimiter_len);
+    }
+
     const std::string line_delimiter;
     const size_t line_delimiter_len;
 };
@@ -85,7 +93,7 @@ public:
             : BaseTextLineReaderContext(line_delimiter_, line_delimiter_len_) {}
 
     inline const uint8_t* read_line_impl(const uint8_t* start, const size_t length) {
-        return (uint8_t*)memmem(start, length, line_delimiter.c_str(), line_delimiter_len);
+        return find_line_delimiter(start, length);
     }
 
     inline void refresh_impl() {}
@@ -1024,6 +1024,7 @@ Status NewJsonReader::_simdjson_init_reader() {
     for (int i = 0; i < _file_slot_descs.size(); ++i) {
         _slot_desc_index[StringRef {_file_slot_descs[i]->col_name()}] = i;
     }
+    _init_flat_jsonpath_index();
     _simdjson_ondemand_padding_buffer.resize(_padded_size);
     _simdjson_ondemand_unscape_padding_buffer.resize(_padded_size);
     return Status::OK();
@@ -1357,12 +1358,14 @@ Status NewJsonReader::_simdjson_set_column_value(simdjson::ondemand::object* val
     bool has_valid_value = false;
     // iterate through object, simdjson::ondemond will parsing on the fly
     size_t key_index = 0;
+    size_t seen_count = 0;
     for (auto field : *value) {
         std::string_view key = field.unescaped_key();
         StringRef name_ref(key.data(), key.size());
         const size_t column_index = _column_index(name_ref, key_index++);
-        if (UNLIKELY(ssize_t(column_index) < 0)) {
-            // This key is not exist in slot desc, just ignore
+        if (UNLIKELY(ssize_t(column_index) < 0) || _seen_columns[column_index]) {
+            // This key is not exist in slot desc or is duplicated, just ignore, on demand parsing
+            // skips its value without parsing it
             continue;
         }
         simdjson::ondemand::value val = field.value();
@@ -1374,6 +1377,10 @@ Status NewJsonReader::_simdjson_set_column_value(simdjson::ondemand::object* val
         }
         _seen_columns[column_index] = true;
         has_valid_value = true;
+        if (++seen_count == slot_descs.size()) {
+            // the rest of the object is skipped by the document stream
+            break;
+        }
     }
     if (!has_valid_value) {
         string col_names;
@@ -1466,6 +1473,16 @@ Status NewJsonReader::_simdjson_write_data_to_column(simdjson::ondemand::value&
     }
     default: {
         if (value.type() == simdjson::ondemand::json_type::string) {
+            // the token is the quoted string and the spaces up to the next token, a string without
+            // escapes is copied from the input buffer straight into the column
+            std::string_view token = value.raw_json_token();
+            size_t end = token.rfind('"');
+            if (end != std::string_view::npos && end > 0 &&
+                memchr(token.data() + 1, '\\', end - 1) == nullptr) {
+                nullable_column->get_null_map_data().push_back(0);
+                column_string->insert_data(token.data() + 1, end - 1);
+                break;
+            }
             auto* unescape_buffer =
                     reinterpret_cast<uint8_t*>(_simdjson_ondemand_unscape_padding_buffer.data());
             std::string_view unescaped_value =
@@ -1656,6 +1673,9 @@ Status NewJsonReader::_get_json_value(size_t* size, bool* eof, simdjson::error_c
 Status NewJsonReader::_simdjson_write_columns_by_jsonpath(
         simdjson::ondemand::object* value, const std::vector<SlotDescriptor*>& slot_descs,
         Block& block, bool* valid) {
+    if (_is_flat_jsonpaths) {
+        return _simdjson_write_columns_by_flat_jsonpath(value, slot_descs, block, valid);
+    }
     // write by jsonpath
     bool has_valid_value = false;
     for (size_t i = 0; i < slot_descs.size(); i++) {
@@ -1710,6 +1730,102 @@ Status NewJsonReader::_simdjson_write_columns_by_jsonpath(
     return Status::OK();
 }
 
+void NewJsonReader::_init_flat_jsonpath_index() {
+    _is_flat_jsonpaths = false;
+    _flat_jsonpath_index.clear();
+    // a jsonpath beyond the slots is never used
+    size_t num_paths = std::min(_parsed_jsonpaths.size(), _file_slot_descs.size());
+    if (num_paths == 0) {
+        return;
+    }
+    for (size_t i = 0; i < num_paths; ++i) {
+        const auto& path = _parsed_jsonpaths[i];
+        if (path.size() != 2 || !path[0].is_valid || !path[1].is_valid || path[0].idx != -1 ||
+            path[1].idx != -1 || path[1].key.empty()) {
+            _flat_jsonpath_index.clear();
+            return;
+        }
+        NameMap::LookupResult it;
+        bool inserted;
+        _flat_jsonpath_index.emplace(StringRef {path[1].key}, it, inserted);
+        if (!inserted) {
+            // two slots from one key, let find_field visit it for each of them
+            _flat_jsonpath_index.clear();
+            return;
+        }
+        it->get_second() = i;
+    }
+    _is_flat_jsonpaths = true;
+}
+
+Status NewJsonReader::_simdjson_write_columns_by_flat_jsonpath(
+        simdjson::ondemand::object* value, const std::vector<SlotDescriptor*>& slot_descs,
+        Block& block, bool* valid) {
+    _seen_columns.assign(block.columns(), false);
+    size_t num_keys = _flat_jsonpath_index.size();
+    size_t seen_count = 0;
+    bool has_valid_value = false;
+    for (auto field : *value) {
+        std::string_view key = field.unescaped_key();
+        auto* it = _flat_jsonpath_index.find(StringRef(key.data(), key.size()));
+        if (it == nullptr || _seen_columns[it->get_second()]) {
+            // not a projected key, on demand parsing skips its value without parsing it
+            continue;
+        }
+        size_t i = it->get_second();
+        _seen_columns[i] = true;
+        ++seen_count;
+        auto* slot_desc = slot_descs[i];
+        if (!slot_desc->is_materialized()) {
+            continue;
+        }
+        simdjson::ondemand::value json_value = field.value();
+        auto* column_ptr = block.get_by_position(i).column->assume_mutable().get();
+        RETURN_IF_ERROR(_simdjson_write_data_to_column(json_value, slot_desc, column_ptr, valid));
+        if (!(*valid)) {
+            return Status::OK();
+        }
+        has_valid_value = true;
+        if (seen_count == num_keys) {
+            // the rest of the object is skipped by the document stream
+            break;
+        }
+    }
+    for (size_t i = 0; i < slot_descs.size(); ++i) {
+        auto* slot_desc = slot_descs[i];
+        if (_seen_columns[i] || !slot_desc->is_materialized()) {
+            continue;
+        }
+        // not match in jsondata, filling with default value
+        auto* column_ptr = block.get_by_position(i).column->assume_mutable().get();
+        RETURN_IF_ERROR(_fill_missing_column(slot_desc, column_ptr, valid));
+        if (!(*valid)) {
+            return Status::OK();
+        }
+    }
+    if (!has_valid_value) {
+        // there is no valid value in json line but has filled with default value before
+        // so remove this line in block
+        string col_names;
+        for (int i = 0; i < block.columns(); ++i) {
+            auto column = block.get_by_position(i).column->assume_mutable();
+            column->pop_back(1);
+        }
+        for (auto* slot_desc : slot_descs) {
+            col_names.append(slot_desc->col_name() + ", ");
+        }
+        RETURN_IF_ERROR(_append_error_msg(value,
+                                          "There is no column matching jsonpaths in the json file, "
+                                          "columns:[{}], please check columns "
+                                          "and jsonpaths:" +
+                                                  _jsonpaths,
+                                          col_names, valid));
+        return Status::OK();
+    }
+    *valid = true;
+    return Status::OK();
+}
+
 Status NewJsonReader::_get_column_default_value(
         const std::vector<SlotDescriptor*>& slot_descs,
         const std::unordered_map<std::string, VExprContextSPtr>& col_default_value_ctx) {
@@ -186,6 +186,12 @@ private:
     Status _simdjson_write_columns_by_jsonpath(simdjson::ondemand::object* value,
                                                const std::vector<SlotDescriptor*>& slot_descs,
                                                Block& block, bool* valid);
+    // same as _simdjson_write_columns_by_jsonpath when all jsonpaths are top level keys, but
+    // visits the fields of the object in one pass and stops once all of the keys are found
+    Status _simdjson_write_columns_by_flat_jsonpath(simdjson::ondemand::object* value,
+                                                    const std::vector<SlotDescriptor*>& slot_descs,
+                                                    Block& block, bool* valid);
+    void _init_flat_jsonpath_index();
     Status _append_error_msg(simdjson::ondemand::object* obj, std::string error_msg,
                              std::string col_name, bool* valid);
 
@@ -266,6 +272,9 @@ private:
     std::vector<NameMap::LookupResult> _prev_positions;
     /// Set of columns which already met in row. Exception is thrown if there are more than one column with the same name.
     std::vector<UInt8> _seen_columns;
+    /// `key -> position in the block` if every jsonpath is `$.key` of a distinct key
+    NameMap _flat_jsonpath_index;
+    bool _is_flat_jsonpaths = false;
     // simdjson
     std::unique_ptr<uint8_t[]> _json_str_ptr;
     const uint8_t* _json_str = nullptr;
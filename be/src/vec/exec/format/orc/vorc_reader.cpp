@@ -795,17 +795,6 @@ Status OrcReader::set_fill_columns(
         }
     }
 
-    if (_tuple_descriptor != nullptr) {
-        for (auto& each : _tuple_descriptor->slots()) {
-            PrimitiveType column_type = each->col_type();
-            if (column_type == TYPE_ARRAY || column_type == TYPE_MAP ||
-                column_type == TYPE_STRUCT) {
-                _has_complex_type = true;
-                break;
-            }
-        }
-    }
-
     for (auto& kv : partition_columns) {
         auto iter = predicate_columns.find(kv.first);
         if (iter == predicate_columns.end()) {
@@ -835,8 +824,7 @@ Status OrcReader::set_fill_columns(
         }
     }
 
-    if (!_has_complex_type && _enable_lazy_mat &&
-        _lazy_read_ctx.predicate_columns.first.size() > 0 &&
+    if (_enable_lazy_mat && _lazy_read_ctx.predicate_columns.first.size() > 0 &&
         _lazy_read_ctx.lazy_read_columns.size() > 0) {
         _lazy_read_ctx.can_lazy_read = true;
     }
@@ -993,12 +981,6 @@ Status OrcReader::_fill_missing_columns(
     return Status::OK();
 }
 
-void OrcReader::_init_bloom_filter(
-        std::unordered_map<std::string, ColumnValueRangeType>* colname_to_value_range) {
-    // generate bloom filter
-    // _reader->getBloomFilters()
-}
-
 void OrcReader::_init_system_properties() {
     if (_scan_range.__isset.file_type) {
         // for compatibility
@@ -1376,7 +1358,8 @@ Status OrcReader::_fill_doris_data_column(const std::string& col_name,
                         ->get_nested_type());
         const orc::Type* nested_orc_type = orc_column_type->getSubtype(0);
         std::string element_name = col_name + ".element";
-        return _orc_column_to_doris_column<is_filter>(
+        // the filter is on the rows, not on the elements, so the elements are fully decoded
+        return _orc_column_to_doris_column<false>(
                 element_name, static_cast<ColumnArray&>(*data_column).get_data_ptr(), nested_type,
                 nested_orc_type, orc_list->elements.get(), element_size);
     }
@@ -1402,12 +1385,13 @@ Status OrcReader::_fill_doris_data_column(const std::string& col_name,
         ColumnPtr& doris_value_column = doris_map.get_values_ptr();
         std::string key_col_name = col_name + ".key";
         std::string value_col_name = col_name + ".value";
-        RETURN_IF_ERROR(_orc_column_to_doris_column<is_filter>(key_col_name, doris_key_column,
-                                                               doris_key_type, orc_key_type,
-                                                               orc_map->keys.get(), element_size));
-        return _orc_column_to_doris_column<is_filter>(value_col_name, doris_value_column,
-                                                      doris_value_type, orc_value_type,
-                                                      orc_map->elements.get(), element_size);
+        // the filter is on the rows, not on the entries, so the entries are fully decoded
+        RETURN_IF_ERROR(_orc_column_to_doris_column<false>(key_col_name, doris_key_column,
+                                                           doris_key_type, orc_key_type,
+                                                           orc_map->keys.get(), element_size));
+        return _orc_column_to_doris_column<false>(value_col_name, doris_value_column,
+                                                  doris_value_type, orc_value_type,
+                                                  orc_map->elements.get(), element_size);
     }
     case TypeIndex::Struct: {
         if (orc_column_type->getKind() != orc::TypeKind::STRUCT) {
@@ -291,8 +291,6 @@ private:
     static const orc::Type& _remove_acid(const orc::Type& type);
     bool _init_search_argument(
             std::unordered_map<std::string, ColumnValueRangeType>* colname_to_value_range);
-    void _init_bloom_filter(
-            std::unordered_map<std::string, ColumnValueRangeType>* colname_to_value_range);
     void _init_system_properties();
     void _init_file_description();
 
@@ -612,7 +610,6 @@ private:
     std::shared_ptr<ObjectPool> _obj_pool;
     std::unique_ptr<StringDictFilterImpl> _string_dict_filter;
     bool _dict_cols_has_converted = false;
-    bool _has_complex_type = false;
     std::vector<orc::TypeKind>* _unsupported_pushdown_types;
 
     // resolve schema change
@@ -75,11 +75,22 @@ protected:
         while (size_t run_length = select_vector.get_next_run<has_filter>(&read_type)) {
             switch (read_type) {
             case ColumnSelectVector::CONTENT: {
-                for (size_t i = 0; i < run_length; ++i) {
-                    memcpy(column_data.data() + data_index, _dict_items[_indexes[dict_index++]],
-                           _type_length);
-                    data_index += _type_length;
+                char* dst = reinterpret_cast<char*>(column_data.data() + data_index);
+                const uint32_t* indexes = _indexes.data() + dict_index;
+                switch (_type_length) {
+                case 4:
+                    _gather_dict_items<uint32_t>(dst, indexes, run_length);
+                    break;
+                case 8:
+                    _gather_dict_items<uint64_t>(dst, indexes, run_length);
+                    break;
+                default:
+                    for (size_t i = 0; i < run_length; ++i) {
+                        memcpy(dst + i * _type_length, _dict_items[indexes[i]], _type_length);
+                    }
                 }
+                dict_index += run_length;
+                data_index += run_length * _type_length;
                 break;
             }
             case ColumnSelectVector::NULL_DATA: {
@@ -99,6 +110,17 @@ protected:
         return Status::OK();
     }
 
+    // Copy the dictionary items of int32/int64/float/double by their fixed width, so that the
+    // loop can be compiled into vector gathers.
+    template <typename T>
+    void _gather_dict_items(char* dst, const uint32_t* __restrict indexes, size_t num_values) {
+        const T* __restrict dict = reinterpret_cast<const T*>(_dict.get());
+        T* __restrict out = reinterpret_cast<T*>(dst);
+        for (size_t i = 0; i < num_values; ++i) {
+            out[i] = dict[indexes[i]];
+        }
+    }
+
     Status set_dict(std::unique_ptr<uint8_t[]>& dict, int32_t length, size_t num_values) override {
         if (num_values * _type_length != length) {
             return Status::Corruption("Wrong dictionary data for fixed length type");
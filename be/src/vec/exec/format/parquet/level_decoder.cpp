@@ -19,6 +19,8 @@
 
 #include <gen_cpp/parquet_types.h>
 
+#include <string.h>
+
 #include <algorithm>
 
 #include "util/bit_stream_utils.inline.h"
@@ -47,7 +49,7 @@ doris::Status doris::vectorized::LevelDecoder::init(doris::Slice* slice,
         if (num_bytes > slice->size - V1_LEVEL_SIZE) {
             return Status::Corruption("Wrong parquet level format");
         }
-        _rle_decoder = RleDecoder<level_t>(data + V1_LEVEL_SIZE, num_bytes, _bit_width);
+        _reset_rle_decoder(data + V1_LEVEL_SIZE, num_bytes);
 
         slice->data += V1_LEVEL_SIZE + num_bytes;
         slice->size -= V1_LEVEL_SIZE + num_bytes;
@@ -79,14 +81,21 @@ doris::Status doris::vectorized::LevelDecoder::init_v2(const doris::Slice& level
     _max_level = max_level;
     _num_levels = num_levels;
     size_t byte_length = levels.size;
-    _rle_decoder = RleDecoder<level_t>((uint8_t*)levels.data, byte_length, _bit_width);
+    _reset_rle_decoder((uint8_t*)levels.data, byte_length);
     return Status::OK();
 }
 
 size_t doris::vectorized::LevelDecoder::get_levels(doris::vectorized::level_t* levels, size_t n) {
     if (_encoding == tparquet::Encoding::RLE) {
         n = std::min((size_t)_num_levels, n);
-        auto num_decoded = _rle_decoder.get_values(levels, n);
+        size_t num_buffered = std::min(n, _buffer_size - _buffer_pos);
+        memcpy(levels, _level_buffer + _buffer_pos, num_buffered * sizeof(level_t));
+        _buffer_pos += num_buffered;
+        size_t num_decoded = num_buffered;
+        if (num_decoded < n) {
+            num_decoded += _rle_decoder.GetBatch(reinterpret_cast<uint16_t*>(levels + num_decoded),
+                                                 n - num_decoded);
+        }
         _num_levels -= num_decoded;
         return num_decoded;
     } else if (_encoding == tparquet::Encoding::BIT_PACKED) {
@@ -94,3 +103,75 @@ size_t doris::vectorized::LevelDecoder::get_levels(doris::vectorized::level_t* l
     }
     return 0;
 }
+
+size_t doris::vectorized::LevelDecoder::get_next_run(doris::vectorized::level_t* val,
+                                                     size_t max_run) {
+    size_t num_read = 0;
+    while (num_read < max_run) {
+        if (_buffer_pos < _buffer_size) {
+            level_t value = _level_buffer[_buffer_pos];
+            if (num_read > 0 && value != *val) {
+                break;
+            }
+            *val = value;
+            size_t end = std::min(_buffer_size, _buffer_pos + max_run - num_read);
+            size_t pos = _buffer_pos + 1;
+            while (pos < end && _level_buffer[pos] == value) {
+                ++pos;
+            }
+            num_read += pos - _buffer_pos;
+            _buffer_pos = pos;
+            if (_buffer_pos < _buffer_size) {
+                // a different level or max_run is reached
+                break;
+            }
+            continue;
+        }
+        // consume the repeated run without buffering it
+        int32_t num_repeats = _rle_decoder.NextNumRepeats();
+        if (num_repeats > 0) {
+            level_t value = _rle_decoder.GetRepeatedValue(0);
+            if (num_read > 0 && value != *val) {
+                break;
+            }
+            *val = value;
+            size_t num_to_consume = std::min((size_t)num_repeats, max_run - num_read);
+            _rle_decoder.GetRepeatedValue(num_to_consume);
+            num_read += num_to_consume;
+            continue;
+        }
+        if (!_fill_buffer()) {
+            break;
+        }
+    }
+    return num_read;
+}
+
+void doris::vectorized::LevelDecoder::_reset_rle_decoder(uint8_t* data, int num_bytes) {
+    _rle_decoder.Reset(data, num_bytes, _bit_width);
+    _buffer_pos = 0;
+    _buffer_size = 0;
+}
+
+bool doris::vectorized::LevelDecoder::_fill_buffer() {
+    int32_t num_repeats = _rle_decoder.NextNumRepeats();
+    size_t num_values = 0;
+    if (num_repeats > 0) {
+        num_values = std::min((size_t)num_repeats, LEVEL_BUFFER_SIZE);
+        std::fill(_level_buffer, _level_buffer + num_values,
+                  _rle_decoder.GetRepeatedValue(num_values));
+    } else {
+        int32_t num_literals = _rle_decoder.NextNumLiterals();
+        if (num_literals == 0) {
+            return false;
+        }
+        num_values = std::min((size_t)num_literals, LEVEL_BUFFER_SIZE);
+        if (!_rle_decoder.GetLiteralValues(num_values,
+                                           reinterpret_cast<uint16_t*>(_level_buffer))) {
+            return false;
+        }
+    }
+    _buffer_pos = 0;
+    _buffer_size = num_values;
+    return true;
+}
@@ -22,6 +22,7 @@
 
 #include <cstdint>
 
+#include "common/logging.h"
 #include "common/status.h"
 #include "parquet_common.h"
 #include "util/bit_stream_utils.h"
@@ -30,6 +31,9 @@
 
 namespace doris::vectorized {
 
+// Decode the RLE/bit-packed hybrid levels in batch by RleBatchDecoder, which unpacks 32
+// values at a time. The literal runs are unpacked into a buffer, so that the levels can still
+// be read run by run or one by one.
 class LevelDecoder {
 public:
     LevelDecoder() = default;
@@ -44,25 +48,38 @@ public:
 
     size_t get_levels(level_t* levels, size_t n);
 
-    inline size_t get_next_run(level_t* val, size_t max_run) {
-        return _rle_decoder.GetNextRun(val, max_run);
-    }
+    size_t get_next_run(level_t* val, size_t max_run);
 
     inline level_t get_next() {
-        level_t next = -1;
-        _rle_decoder.Get(&next);
-        return next;
+        if (_buffer_pos == _buffer_size && !_fill_buffer()) {
+            return -1;
+        }
+        return _level_buffer[_buffer_pos++];
     }
 
-    inline void rewind_one() { _rle_decoder.RewindOne(); }
+    // only valid after get_next()
+    inline void rewind_one() {
+        DCHECK_GT(_buffer_pos, 0);
+        --_buffer_pos;
+    }
 
 private:
+    void _reset_rle_decoder(uint8_t* data, int num_bytes);
+    // Buffer the next run, or a part of it. Returns false if there are no more levels.
+    bool _fill_buffer();
+
+    static constexpr size_t LEVEL_BUFFER_SIZE = 1024;
+
     tparquet::Encoding::type _encoding;
     level_t _bit_width = 0;
     level_t _max_level = 0;
     uint32_t _num_levels = 0;
-    RleDecoder<level_t> _rle_decoder;
+    // BitPacking only unpacks unsigned values, the levels are never negative
+    RleBatchDecoder<uint16_t> _rle_decoder;
     BitReader _bit_packed_decoder;
+    level_t _level_buffer[LEVEL_BUFFER_SIZE];
+    size_t _buffer_pos = 0;
+    size_t _buffer_size = 0;
 };
 
 } // namespace doris::vectorized
\ No newline at end of file
@@ -19,6 +19,8 @@
 
 #include <gen_cpp/parquet_types.h>
 
+#include <chrono>
+
 #include "vec/core/types.h"
 #include "vec/data_types/data_type_factory.hpp"
 #include "vec/exec/format/column_type_convert.h"
@@ -39,6 +41,10 @@ struct ConvertParams {
     int64_t scale_to_nano_factor = 1;
     DecimalScaleParams decimal_scale;
     FieldSchema* field_schema = nullptr;
+    // Whether ctz is UTC or a fixed offset time zone, whose timestamps are converted by the
+    // offset, instead of looking up the time zone for each value.
+    bool is_fixed_offset_zone = false;
+    int64_t fixed_offset_seconds = 0;
 
     /**
      * Some frameworks like paimon maybe writes non-standard parquet files. Timestamp field doesn't have
@@ -60,6 +66,7 @@ struct ConvertParams {
             // so we default to UTC here.
             if (ctz == nullptr) {
                 ctz = const_cast<cctz::time_zone*>(&utc0);
+                _init_fixed_offset();
             }
         }
     }
@@ -107,6 +114,40 @@ struct ConvertParams {
             VecDateTimeValue t;
             t.from_unixtime(0, *ctz);
             offset_days = t.day() == 31 ? -1 : 0;
+            _init_fixed_offset();
+        }
+    }
+
+    // Same as value.from_unixtime(seconds, *ctz) and value.set_microsecond(microsecond)
+    void from_unixtime(int64_t seconds, uint32_t microsecond,
+                       DateV2Value<DateTimeV2ValueType>& value) const {
+        static constexpr int64_t SECONDS_PER_DAY = 86400;
+        static constexpr int64_t MAX_DICT_SECONDS = 25566 * SECONDS_PER_DAY; // 2039-12-31
+        static constexpr int64_t MIN_DICT_SECONDS = -25567 * SECONDS_PER_DAY; // 1900-01-01
+        int64_t local_seconds = seconds + fixed_offset_seconds;
+        if (is_fixed_offset_zone && local_seconds >= MIN_DICT_SECONDS &&
+            local_seconds < MAX_DICT_SECONDS) {
+            int64_t days = local_seconds / SECONDS_PER_DAY;
+            int64_t day_seconds = local_seconds % SECONDS_PER_DAY;
+            if (day_seconds < 0) {
+                day_seconds += SECONDS_PER_DAY;
+                days--;
+            }
+            DateV2Value<DateV2ValueType> date = date_day_offset_dict::get()[days];
+            value.set_time(date.year(), date.month(), date.day(), day_seconds / 3600,
+                           day_seconds / 60 % 60, day_seconds % 60, 0);
+        } else {
+            value.from_unixtime(seconds, *ctz);
+        }
+        value.set_microsecond(microsecond);
+    }
+
+    void _init_fixed_offset() {
+        // the names of cctz::utc_time_zone() and cctz::fixed_time_zone()
+        const std::string& name = ctz->name();
+        is_fixed_offset_zone = name == "UTC" || name.starts_with("Fixed/");
+        if (is_fixed_offset_zone) {
+            fixed_offset_seconds = ctz->lookup(std::chrono::system_clock::from_time_t(0)).offset;
         }
     }
 
@@ -496,9 +537,10 @@ struct Int64ToTimestamp : public PhysicalToLogicalConverter {
             int64_t x = src_data[i];
             auto& num = data[start_idx + i];
             auto& value = reinterpret_cast<DateV2Value<DateTimeV2ValueType>&>(num);
-            value.from_unixtime(x / _convert_params->second_mask, *_convert_params->ctz);
-            value.set_microsecond((x % _convert_params->second_mask) *
-                                  (_convert_params->scale_to_nano_factor / 1000));
+            _convert_params->from_unixtime(x / _convert_params->second_mask,
+                                           (x % _convert_params->second_mask) *
+                                                   (_convert_params->scale_to_nano_factor / 1000),
+                                           value);
         }
         return Status::OK();
     }
@@ -522,8 +564,8 @@ struct Int96toTimestamp : public PhysicalToLogicalConverter {
                     reinterpret_cast<DateV2Value<DateTimeV2ValueType>&>(data[start_idx + i]);
 
             int64_t timestamp_with_micros = src_cell_data.to_timestamp_micros();
-            dst_value.from_unixtime(timestamp_with_micros / 1000000, *_convert_params->ctz);
-            dst_value.set_microsecond(timestamp_with_micros % 1000000);
+            _convert_params->from_unixtime(timestamp_with_micros / 1000000,
+                                           timestamp_with_micros % 1000000, dst_value);
         }
         return Status::OK();
     }
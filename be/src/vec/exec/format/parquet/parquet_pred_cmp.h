@@ -29,6 +29,7 @@
 #include "vec/data_types/data_type_decimal.h"
 #include "vec/exec/format/format_common.h"
 #include "vec/exec/format/parquet/schema_desc.h"
+#include "vec/exec/format/parquet/vparquet_bloom_filter.h"
 
 namespace doris::vectorized {
 
@@ -397,7 +398,68 @@ private:
         return predicates;
     }
 
+    template <PrimitiveType primitive_type>
+    static bool _filter_by_bloom_filter(const ColumnValueRange<primitive_type>& col_val_range,
+                                        const FieldSchema* col_schema,
+                                        const ParquetBloomFilter& bloom_filter) {
+        // bloom filter has no null values, and can only check the values of "=" and "in"
+        if (!col_val_range.is_fixed_value_range() || col_val_range.contain_null() ||
+            col_val_range.get_fixed_value_set().empty()) {
+            return false;
+        }
+        PrimitiveType src_type = col_schema->type.type;
+        tparquet::Type::type physical_type = col_schema->physical_type;
+        for (const auto& value : col_val_range.get_fixed_value_set()) {
+            // hash the value as its plain encoding in parquet file
+            bool may_contain = true;
+            if constexpr (primitive_type == TYPE_TINYINT || primitive_type == TYPE_SMALLINT ||
+                          primitive_type == TYPE_INT) {
+                if (src_type != primitive_type || physical_type != tparquet::Type::INT32) {
+                    return false;
+                }
+                int32_t plain_value = value;
+                may_contain = bloom_filter.test_plain(&plain_value, sizeof(plain_value));
+            } else if constexpr (primitive_type == TYPE_BIGINT || primitive_type == TYPE_FLOAT ||
+                                 primitive_type == TYPE_DOUBLE) {
+                if (src_type != primitive_type ||
+                    (primitive_type == TYPE_BIGINT && physical_type != tparquet::Type::INT64) ||
+                    (primitive_type == TYPE_FLOAT && physical_type != tparquet::Type::FLOAT) ||
+                    (primitive_type == TYPE_DOUBLE && physical_type != tparquet::Type::DOUBLE)) {
+                    return false;
+                }
+                may_contain = bloom_filter.test_plain(&value, sizeof(value));
+            } else if constexpr (primitive_type == TYPE_VARCHAR ||
+                                 primitive_type == TYPE_STRING) {
+                // CHAR values are padded, not the same as the values in file
+                if (!is_string_type(src_type) || src_type == TYPE_CHAR ||
+                    physical_type != tparquet::Type::BYTE_ARRAY) {
+                    return false;
+                }
+                may_contain = bloom_filter.test_plain(value.data, value.size);
+            } else {
+                return false;
+            }
+            if (may_contain) {
+                return false;
+            }
+        }
+        return true;
+    }
+
 public:
+    // Whether all the values of "=" and "in" predicates are ruled out by the bloom filter.
+    static bool filter_by_bloom_filter(const ColumnValueRangeType& col_val_range,
+                                       const FieldSchema* col_schema,
+                                       const ParquetBloomFilter& bloom_filter) {
+        bool need_filter = false;
+        std::visit(
+                [&](auto&& range) {
+                    need_filter = _filter_by_bloom_filter(range, col_schema, bloom_filter);
+                },
+                col_val_range);
+        return need_filter;
+    }
+
     static bool filter_by_stats(const ColumnValueRangeType& col_val_range,
                                 const FieldSchema* col_schema, bool is_set_min_max,
                                 const std::string& encoded_min, const std::string& encoded_max,
@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vparquet_bloom_filter.h"
+
+#include <gen_cpp/parquet_types.h>
+#include <string.h>
+#include <xxhash.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "io/fs/file_reader.h"
+#include "util/slice.h"
+#include "util/thrift_util.h"
+
+namespace doris::vectorized {
+
+// The header is a small thrift struct, read it together with the beginning of the bitset
+static constexpr size_t BLOOM_FILTER_HEADER_SIZE_GUESS = 256;
+
+Status ParquetBloomFilter::read(io::FileReaderSPtr file_reader, io::IOContext* io_ctx,
+                                int64_t offset, std::unique_ptr<ParquetBloomFilter>* bloom_filter) {
+    size_t file_size = file_reader->size();
+    if (offset < 0 || static_cast<size_t>(offset) >= file_size) {
+        return Status::Corruption("Invalid bloom filter offset {} of file {}, file size {}",
+                                  offset, file_reader->path().native(), file_size);
+    }
+    size_t read_size = std::min(BLOOM_FILTER_HEADER_SIZE_GUESS, file_size - offset);
+    std::vector<uint8_t> header_buf(read_size);
+    size_t bytes_read = 0;
+    RETURN_IF_ERROR(file_reader->read_at(offset, Slice(header_buf.data(), read_size), &bytes_read,
+                                         io_ctx));
+    DCHECK_EQ(bytes_read, read_size);
+
+    tparquet::BloomFilterHeader header;
+    uint32_t header_size = read_size;
+    RETURN_IF_ERROR(deserialize_thrift_msg(header_buf.data(), &header_size, true, &header));
+    if (!header.algorithm.__isset.BLOCK || !header.hash.__isset.XXHASH ||
+        !header.compression.__isset.UNCOMPRESSED) {
+        return Status::NotSupported("Unsupported bloom filter of file {}",
+                                    file_reader->path().native());
+    }
+    size_t num_bytes = header.numBytes;
+    if (num_bytes < BYTES_PER_BLOCK || num_bytes > MAXIMUM_BYTES ||
+        (num_bytes & (num_bytes - 1)) != 0 ||
+        static_cast<size_t>(offset) + header_size + num_bytes > file_size) {
+        return Status::Corruption("Invalid bloom filter size {} of file {}", header.numBytes,
+                                  file_reader->path().native());
+    }
+
+    // the last byte is the null flag of BloomFilter, which is not used by parquet
+    std::vector<char> bitset(num_bytes + 1, 0);
+    size_t buffered = std::min<size_t>(read_size - header_size, num_bytes);
+    memcpy(bitset.data(), header_buf.data() + header_size, buffered);
+    if (buffered < num_bytes) {
+        RETURN_IF_ERROR(file_reader->read_at(offset + header_size + buffered,
+                                             Slice(bitset.data() + buffered, num_bytes - buffered),
+                                             &bytes_read, io_ctx));
+        DCHECK_EQ(bytes_read, num_bytes - buffered);
+    }
+    auto bf = std::make_unique<ParquetBloomFilter>();
+    RETURN_IF_ERROR(bf->init(bitset.data(), num_bytes + 1, HASH_MURMUR3_X64_64));
+    *bloom_filter = std::move(bf);
+    return Status::OK();
+}
+
+uint32_t ParquetBloomFilter::_block_index(uint64_t hash) const {
+    uint64_t num_blocks = num_bytes() / BYTES_PER_BLOCK;
+    return static_cast<uint32_t>(((hash >> 32) * num_blocks) >> 32);
+}
+
+void ParquetBloomFilter::add_hash(uint64_t hash) {
+    const uint32_t bucket_index = _block_index(hash);
+    uint32_t* bitset32 = reinterpret_cast<uint32_t*>(data());
+    BlockMask block_mask;
+    _set_masks(static_cast<uint32_t>(hash), block_mask);
+    for (int i = 0; i < BITS_SET_PER_BLOCK; ++i) {
+        bitset32[bucket_index * BITS_SET_PER_BLOCK + i] |= block_mask.item[i];
+    }
+}
+
+bool ParquetBloomFilter::test_hash(uint64_t hash) const {
+    const uint32_t bucket_index = _block_index(hash);
+    const uint32_t* bitset32 = reinterpret_cast<const uint32_t*>(data());
+    BlockMask block_mask;
+    _set_masks(static_cast<uint32_t>(hash), block_mask);
+    for (int i = 0; i < BITS_SET_PER_BLOCK; ++i) {
+        if (0 == (bitset32[bucket_index * BITS_SET_PER_BLOCK + i] & block_mask.item[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ParquetBloomFilter::test_plain(const void* buf, size_t size) const {
+    return test_hash(XXH64(buf, size, 0));
+}
+
+void ParquetBloomFilter::add_plain(const void* buf, size_t size) {
+    add_hash(XXH64(buf, size, 0));
+}
+
+} // namespace doris::vectorized
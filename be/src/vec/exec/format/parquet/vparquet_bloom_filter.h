@@ -0,0 +1,61 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <memory>
+
+#include "common/status.h"
+#include "io/fs/file_reader_writer_fwd.h"
+#include "olap/rowset/segment_v2/block_split_bloom_filter.h"
+
+namespace doris {
+namespace io {
+struct IOContext;
+} // namespace io
+} // namespace doris
+
+namespace doris::vectorized {
+
+// The split block bloom filter of a parquet column chunk, pointed by bloom_filter_offset of
+// ColumnMetaData. The blocks and masks are the same as segment_v2::BlockSplitBloomFilter,
+// except that a block is selected by the multiply-shift of the high 32 bits of the hash, and
+// the values are hashed by xxHash64 with seed 0 of their plain encoding.
+class ParquetBloomFilter : public segment_v2::BlockSplitBloomFilter {
+public:
+    // Read the header and the bitset of the bloom filter at `offset` of the file.
+    // Returns NotSupported if the algorithm, hash or compression is unknown.
+    static Status read(io::FileReaderSPtr file_reader, io::IOContext* io_ctx, int64_t offset,
+                       std::unique_ptr<ParquetBloomFilter>* bloom_filter);
+
+    void add_hash(uint64_t hash) override;
+    bool test_hash(uint64_t hash) const override;
+
+    // `buf` is the plain encoded value, without the length prefix of BYTE_ARRAY
+    bool test_plain(const void* buf, size_t size) const;
+    void add_plain(const void* buf, size_t size);
+
+    size_t get_mem_size() const { return sizeof(ParquetBloomFilter) + size(); }
+
+private:
+    uint32_t _block_index(uint64_t hash) const;
+};
+
+} // namespace doris::vectorized
@@ -39,6 +39,62 @@ const tparquet::FileMetaData& FileMetaData::to_thrift() {
     return _metadata;
 }
 
+void FileMetaData::compact() {
+    std::vector<tparquet::KeyValue> key_values;
+    for (auto& kv : _metadata.key_value_metadata) {
+        // see IcebergParquetReader::_gen_col_name_maps
+        if (kv.key == "iceberg.schema") {
+            key_values.emplace_back(std::move(kv));
+        }
+    }
+    _metadata.key_value_metadata.swap(key_values);
+    _metadata.__isset.key_value_metadata = !_metadata.key_value_metadata.empty();
+    for (auto& row_group : _metadata.row_groups) {
+        for (auto& chunk : row_group.columns) {
+            chunk.meta_data.path_in_schema.clear();
+            chunk.meta_data.key_value_metadata.clear();
+            chunk.meta_data.__isset.key_value_metadata = false;
+            chunk.encrypted_column_metadata.clear();
+            chunk.__isset.encrypted_column_metadata = false;
+        }
+    }
+}
+
+static size_t statistics_mem_size(const tparquet::Statistics& stats) {
+    return stats.max.capacity() + stats.min.capacity() + stats.max_value.capacity() +
+           stats.min_value.capacity();
+}
+
+size_t FileMetaData::get_mem_size() const {
+    size_t size = sizeof(FileMetaData) + _metadata.created_by.capacity();
+    for (const auto& kv : _metadata.key_value_metadata) {
+        size += sizeof(tparquet::KeyValue) + kv.key.capacity() + kv.value.capacity();
+    }
+    for (const auto& element : _metadata.schema) {
+        // the thrift schema element and the parsed field schema
+        size += sizeof(tparquet::SchemaElement) + sizeof(FieldSchema) + element.name.capacity() * 2;
+    }
+    for (const auto& row_group : _metadata.row_groups) {
+        size += sizeof(tparquet::RowGroup) +
+                row_group.sorting_columns.capacity() * sizeof(tparquet::SortingColumn);
+        for (const auto& chunk : row_group.columns) {
+            const auto& meta = chunk.meta_data;
+            size += sizeof(tparquet::ColumnChunk) + chunk.file_path.capacity() +
+                    chunk.encrypted_column_metadata.capacity() +
+                    meta.encodings.capacity() * sizeof(tparquet::Encoding::type) +
+                    meta.encoding_stats.capacity() * sizeof(tparquet::PageEncodingStats) +
+                    statistics_mem_size(meta.statistics);
+            for (const auto& path : meta.path_in_schema) {
+                size += sizeof(std::string) + path.capacity();
+            }
+            for (const auto& kv : meta.key_value_metadata) {
+                size += sizeof(tparquet::KeyValue) + kv.key.capacity() + kv.value.capacity();
+            }
+        }
+    }
+    return size;
+}
+
 std::string FileMetaData::debug_string() const {
     std::stringstream out;
     out << "Parquet Metadata(";
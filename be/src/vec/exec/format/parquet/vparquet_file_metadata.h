@@ -37,6 +37,13 @@ public:
     }
     std::string debug_string() const;
 
+    // Drop the parts of the footer that are never used by the reader, such as the key-value
+    // metadata written by the engines (except the iceberg schema) and the path of each column
+    // chunk, so that a cached footer only keeps what is needed for pruning and reading.
+    void compact();
+    // Estimated memory size of this footer, including the parsed schema.
+    size_t get_mem_size() const;
+
 private:
     tparquet::FileMetaData _metadata;
     FieldDescriptor _schema;
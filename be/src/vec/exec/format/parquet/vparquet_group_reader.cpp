@@ -178,6 +178,50 @@ Status RowGroupReader::init(
     return Status::OK();
 }
 
+Status RowGroupReader::probe_dict_filter(
+        const FieldDescriptor& schema, const TupleDescriptor* tuple_descriptor,
+        const std::unordered_map<int, VExprContextSPtrs>* slot_id_to_filter_conjuncts,
+        bool* filter_group) {
+    *filter_group = false;
+    _tuple_descriptor = tuple_descriptor;
+    _slot_id_to_filter_conjuncts = slot_id_to_filter_conjuncts;
+    if (_slot_id_to_filter_conjuncts == nullptr || _lazy_read_ctx.has_complex_type) {
+        return Status::OK();
+    }
+    const std::vector<string>& predicate_col_names = _lazy_read_ctx.predicate_columns.first;
+    const std::vector<int>& predicate_col_slot_ids = _lazy_read_ctx.predicate_columns.second;
+    for (size_t i = 0; i < predicate_col_names.size(); ++i) {
+        const string& predicate_col_name = predicate_col_names[i];
+        int slot_id = predicate_col_slot_ids[i];
+        auto field = const_cast<FieldSchema*>(schema.get_column(predicate_col_name));
+        const auto& column_metadata =
+                _row_group_meta.columns[field->physical_column_index].meta_data;
+        if (!_can_filter_by_dict(slot_id, column_metadata) ||
+            !column_metadata.__isset.dictionary_page_offset ||
+            column_metadata.data_page_offset <= column_metadata.dictionary_page_offset) {
+            continue;
+        }
+        // limit the prefetch buffer to the dictionary page, the data pages are not read
+        size_t dict_page_size =
+                column_metadata.data_page_offset - column_metadata.dictionary_page_offset;
+        std::unique_ptr<ParquetColumnReader> reader;
+        RETURN_IF_ERROR(ParquetColumnReader::create(_file_reader, field, _row_group_meta,
+                                                    _read_ranges, _ctz, _io_ctx, reader,
+                                                    dict_page_size));
+        if (reader == nullptr) {
+            return Status::Corruption("Init row group reader failed");
+        }
+        _column_readers[predicate_col_name] = std::move(reader);
+        _dict_filter_cols.emplace_back(std::make_pair(predicate_col_name, slot_id));
+    }
+    if (_dict_filter_cols.empty()) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_rewrite_dict_predicates());
+    *filter_group = _is_row_group_filtered;
+    return Status::OK();
+}
+
 bool RowGroupReader::_can_filter_by_dict(int slot_id,
                                          const tparquet::ColumnMetaData& column_metadata) {
     SlotDescriptor* slot = nullptr;
@@ -154,6 +154,13 @@ public:
                 const std::unordered_map<std::string, int>* colname_to_slot_id,
                 const VExprContextSPtrs* not_single_slot_filter_conjuncts,
                 const std::unordered_map<int, VExprContextSPtrs>* slot_id_to_filter_conjuncts);
+    // Evaluate the single slot conjuncts of the dictionary encoded predicate columns on their
+    // dictionary pages, `*filter_group` is true if no value of a dictionary matches. Only the
+    // dictionary pages are read, so a row group can be pruned before any data page is fetched.
+    Status probe_dict_filter(
+            const FieldDescriptor& schema, const TupleDescriptor* tuple_descriptor,
+            const std::unordered_map<int, VExprContextSPtrs>* slot_id_to_filter_conjuncts,
+            bool* filter_group);
     Status next_batch(Block* block, size_t batch_size, size_t* read_rows, bool* batch_eof);
     int64_t lazy_read_filtered_rows() const { return _lazy_read_filtered_rows; }
 
@@ -25,6 +25,7 @@
 #include <functional>
 #include <utility>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "exec/schema_scanner.h"
 #include "io/file_factory.h"
@@ -45,6 +46,7 @@
 #include "vec/core/types.h"
 #include "vec/exec/format/parquet/parquet_common.h"
 #include "vec/exec/format/parquet/schema_desc.h"
+#include "vec/exec/format/parquet/vparquet_bloom_filter.h"
 #include "vec/exec/format/parquet/vparquet_file_metadata.h"
 #include "vec/exec/format/parquet/vparquet_group_reader.h"
 #include "vec/exec/format/parquet/vparquet_page_index.h"
@@ -122,6 +124,10 @@ void ParquetReader::_init_profile() {
 
         _parquet_profile.filtered_row_groups = ADD_CHILD_COUNTER_WITH_LEVEL(
                 _profile, "FilteredGroups", TUnit::UNIT, parquet_profile, 1);
+        _parquet_profile.filtered_row_groups_by_dict = ADD_CHILD_COUNTER_WITH_LEVEL(
+                _profile, "FilteredGroupsByDict", TUnit::UNIT, parquet_profile, 1);
+        _parquet_profile.filtered_row_groups_by_bloom_filter = ADD_CHILD_COUNTER_WITH_LEVEL(
+                _profile, "FilteredGroupsByBloomFilter", TUnit::UNIT, parquet_profile, 1);
         _parquet_profile.to_read_row_groups = ADD_CHILD_COUNTER_WITH_LEVEL(
                 _profile, "ReadGroups", TUnit::UNIT, parquet_profile, 1);
         _parquet_profile.filtered_group_rows = ADD_CHILD_COUNTER_WITH_LEVEL(
@@ -562,11 +568,18 @@ Status ParquetReader::_next_row_group_reader() {
     if (_current_group_reader != nullptr) {
         _current_group_reader->collect_profile_before_close();
     }
-    if (_read_row_groups.empty()) {
-        _row_group_eof = true;
-        _current_group_reader.reset(nullptr);
-        return Status::EndOfFile("No next RowGroupReader");
-    }
+    bool filter_group = false;
+    do {
+        if (_read_row_groups.empty()) {
+            _row_group_eof = true;
+            _current_group_reader.reset(nullptr);
+            return Status::EndOfFile("No next RowGroupReader");
+        }
+        RETURN_IF_ERROR(_probe_dict_filter(_read_row_groups.front(), &filter_group));
+        if (filter_group) {
+            _read_row_groups.pop_front();
+        }
+    } while (filter_group);
     RowGroupReader::RowGroupIndex row_group_index = _read_row_groups.front();
     _read_row_groups.pop_front();
 
@@ -602,6 +615,31 @@ Status ParquetReader::_next_row_group_reader() {
                                        _slot_id_to_filter_conjuncts);
 }
 
+Status ParquetReader::_probe_dict_filter(const RowGroupReader::RowGroupIndex& row_group_index,
+                                         bool* filter_group) {
+    *filter_group = false;
+    if (!config::enable_parquet_dict_filter_row_group || _slot_id_to_filter_conjuncts == nullptr ||
+        _slot_id_to_filter_conjuncts->empty() ||
+        typeid_cast<io::InMemoryFileReader*>(_file_reader.get())) {
+        // the dictionaries of InMemoryFileReader are filtered in RowGroupReader::init without IO
+        return Status::OK();
+    }
+    auto& row_group = _t_metadata->row_groups[row_group_index.row_group_id];
+    RowGroupReader probe_reader(
+            _file_reader, _read_columns, row_group_index.row_group_id, row_group, _ctz, _io_ctx,
+            RowGroupReader::PositionDeleteContext(row_group.num_rows, row_group_index.first_row),
+            _lazy_read_ctx, _state);
+    RETURN_IF_ERROR(probe_reader.probe_dict_filter(_file_metadata->schema(), _tuple_descriptor,
+                                                   _slot_id_to_filter_conjuncts, filter_group));
+    if (*filter_group) {
+        _statistics.read_row_groups--;
+        _statistics.filtered_row_groups++;
+        _statistics.filtered_row_groups_by_dict++;
+        _statistics.filtered_group_rows += row_group.num_rows;
+    }
+    return Status::OK();
+}
+
 Status ParquetReader::_init_row_groups(const bool& is_filter_groups) {
     SCOPED_RAW_TIMER(&_statistics.row_group_filter_time);
     if (is_filter_groups && (_total_groups == 0 || _t_metadata->num_rows == 0 || _range_size < 0)) {
@@ -836,8 +874,10 @@ Status ParquetReader::_process_row_group_filter(const tparquet::RowGroup& row_gr
     RETURN_IF_ERROR(_process_column_stat_filter(row_group.columns, filter_group));
     _init_chunk_dicts();
     RETURN_IF_ERROR(_process_dict_filter(filter_group));
-    _init_bloom_filter();
-    RETURN_IF_ERROR(_process_bloom_filter(filter_group));
+    if (*filter_group) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_process_bloom_filter(row_group, filter_group));
     return Status::OK();
 }
 
@@ -891,9 +931,56 @@ Status ParquetReader::_process_dict_filter(bool* filter_group) {
     return Status::OK();
 }
 
-void ParquetReader::_init_bloom_filter() {}
-
-Status ParquetReader::_process_bloom_filter(bool* filter_group) {
+Status ParquetReader::_process_bloom_filter(const tparquet::RowGroup& row_group,
+                                            bool* filter_group) {
+    if (!config::enable_parquet_bloom_filter || _colname_to_value_range == nullptr ||
+        _colname_to_value_range->empty()) {
+        return Status::OK();
+    }
+    auto& schema_desc = _file_metadata->schema();
+    for (auto& col_name : _read_columns) {
+        auto slot_iter = _colname_to_value_range->find(col_name);
+        if (slot_iter == _colname_to_value_range->end()) {
+            continue;
+        }
+        const FieldSchema* col_schema = schema_desc.get_column(col_name);
+        int parquet_col_id = col_schema->physical_column_index;
+        if (parquet_col_id < 0) {
+            // complex type, not support filter yet.
+            continue;
+        }
+        auto& meta_data = row_group.columns[parquet_col_id].meta_data;
+        if (!meta_data.__isset.bloom_filter_offset) {
+            continue;
+        }
+        std::unique_ptr<ParquetBloomFilter> bloom_filter;
+        ObjLRUCache::CacheHandle bloom_filter_handle;
+        Status st;
+        if (_meta_cache == nullptr) {
+            st = ParquetBloomFilter::read(_file_reader, _io_ctx, meta_data.bloom_filter_offset,
+                                          &bloom_filter);
+        } else {
+            st = _meta_cache->get_parquet_bloom_filter(_file_reader, _io_ctx,
+                                                       _file_description.mtime,
+                                                       meta_data.bloom_filter_offset,
+                                                       &bloom_filter, &bloom_filter_handle);
+        }
+        if (!st.ok()) {
+            // the bloom filter is only an optimization, ignore the unknown or broken ones
+            LOG(WARNING) << "Failed to read parquet bloom filter of column " << col_name
+                         << " in file " << _scan_range.path << ": " << st;
+            continue;
+        }
+        const ParquetBloomFilter* bf =
+                bloom_filter != nullptr
+                        ? bloom_filter.get()
+                        : (const ParquetBloomFilter*)bloom_filter_handle.data<ParquetBloomFilter>();
+        if (ParquetPredicate::filter_by_bloom_filter(slot_iter->second, col_schema, *bf)) {
+            *filter_group = true;
+            _statistics.filtered_row_groups_by_bloom_filter++;
+            break;
+        }
+    }
     return Status::OK();
 }
 
@@ -914,6 +1001,10 @@ void ParquetReader::_collect_profile() {
         _current_group_reader->collect_profile_before_close();
     }
     COUNTER_UPDATE(_parquet_profile.filtered_row_groups, _statistics.filtered_row_groups);
+    COUNTER_UPDATE(_parquet_profile.filtered_row_groups_by_dict,
+                   _statistics.filtered_row_groups_by_dict);
+    COUNTER_UPDATE(_parquet_profile.filtered_row_groups_by_bloom_filter,
+                   _statistics.filtered_row_groups_by_bloom_filter);
     COUNTER_UPDATE(_parquet_profile.to_read_row_groups, _statistics.read_row_groups);
     COUNTER_UPDATE(_parquet_profile.filtered_group_rows, _statistics.filtered_group_rows);
     COUNTER_UPDATE(_parquet_profile.filtered_page_rows, _statistics.filtered_page_rows);
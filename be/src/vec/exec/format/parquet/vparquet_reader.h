@@ -75,6 +75,8 @@ class ParquetReader : public GenericReader {
 public:
     struct Statistics {
         int32_t filtered_row_groups = 0;
+        int32_t filtered_row_groups_by_dict = 0;
+        int32_t filtered_row_groups_by_bloom_filter = 0;
         int32_t read_row_groups = 0;
         int64_t filtered_group_rows = 0;
         int64_t filtered_page_rows = 0;
@@ -156,6 +158,8 @@ protected:
 private:
     struct ParquetProfile {
         RuntimeProfile::Counter* filtered_row_groups = nullptr;
+        RuntimeProfile::Counter* filtered_row_groups_by_dict = nullptr;
+        RuntimeProfile::Counter* filtered_row_groups_by_bloom_filter = nullptr;
         RuntimeProfile::Counter* to_read_row_groups = nullptr;
         RuntimeProfile::Counter* filtered_group_rows = nullptr;
         RuntimeProfile::Counter* filtered_page_rows = nullptr;
@@ -208,12 +212,13 @@ private:
     Status _process_row_group_filter(const tparquet::RowGroup& row_group, bool* filter_group);
     void _init_chunk_dicts();
     Status _process_dict_filter(bool* filter_group);
-    void _init_bloom_filter();
-    Status _process_bloom_filter(bool* filter_group);
+    Status _process_bloom_filter(const tparquet::RowGroup& row_group, bool* filter_group);
     int64_t _get_column_start_offset(const tparquet::ColumnMetaData& column_init_column_readers);
     std::string _meta_cache_key(const std::string& path) { return "meta_" + path; }
     std::vector<io::PrefetchRange> _generate_random_access_ranges(
             const RowGroupReader::RowGroupIndex& group, size_t* avg_io_size);
+    Status _probe_dict_filter(const RowGroupReader::RowGroupIndex& row_group_index,
+                              bool* filter_group);
     void _collect_profile();
 
 private:
@@ -28,6 +28,7 @@ namespace doris::vectorized {
  * If there are more delete columns in delete file, use `MultiEqualityDelete`,
  * which generates a hash column from all delete columns, and only compare the values
  * when the hash values are the same.
+ * The built delete is not changed by `filter_data_block`, so it can be shared by the scanners.
  */
 class EqualityDeleteBase {
 protected:
@@ -55,7 +56,7 @@ public:
         return _build_set();
     }
 
-    virtual Status filter_data_block(Block* data_block) = 0;
+    virtual Status filter_data_block(Block* data_block) const = 0;
 
     static std::unique_ptr<EqualityDeleteBase> get_delete_impl(Block* delete_block);
 };
@@ -65,14 +66,13 @@ protected:
     std::shared_ptr<HybridSetBase> _hybrid_set;
     std::string _delete_column_name;
     PrimitiveType _delete_column_type;
-    std::unique_ptr<IColumn::Filter> _filter;
 
     Status _build_set() override;
 
 public:
     SimpleEqualityDelete(Block* delete_block) : EqualityDeleteBase(delete_block) {}
 
-    Status filter_data_block(Block* data_block) override;
+    Status filter_data_block(Block* data_block) const override;
 };
 
 /**
@@ -82,24 +82,21 @@ class MultiEqualityDelete : public EqualityDeleteBase {
 protected:
     // hash column for delete block
     std::vector<uint64_t> _delete_hashes;
-    // hash column for data block
-    std::vector<uint64_t> _data_hashes;
     // hash code => row index
     // if hash values are equal, then compare the real values
     // the row index records the row number of the delete row in delete block
     std::multimap<uint64_t, size_t> _delete_hash_map;
-    // the delete column indexes in data block
-    std::vector<size_t> _data_column_index;
-    std::unique_ptr<IColumn::Filter> _filter;
 
     Status _build_set() override;
 
-    bool _equal(Block* data_block, size_t data_row_index, size_t delete_row_index);
+    // `data_column_index` is the delete column indexes in data block
+    bool _equal(Block* data_block, const std::vector<size_t>& data_column_index,
+                size_t data_row_index, size_t delete_row_index) const;
 
 public:
     MultiEqualityDelete(Block* delete_block) : EqualityDeleteBase(delete_block) {}
 
-    Status filter_data_block(Block* data_block) override;
+    Status filter_data_block(Block* data_block) const override;
 };
 
 } // namespace doris::vectorized
@@ -144,8 +144,8 @@ Status IcebergTableReader::get_next_block(Block* block, size_t* read_rows, bool*
         block->initialize_index_by_name();
     }
 
-    if (_equality_delete_impl != nullptr) {
-        RETURN_IF_ERROR(_equality_delete_impl->filter_data_block(block));
+    if (_equality_delete != nullptr) {
+        RETURN_IF_ERROR(_equality_delete->impl->filter_data_block(block));
         *read_rows = block->rows();
     }
     return _shrink_block_if_need(block);
@@ -192,9 +192,52 @@ Status IcebergTableReader::init_row_filters(const TFileRangeDesc& range) {
 
 Status IcebergTableReader::_equality_delete_base(
         const std::vector<TIcebergDeleteFileDesc>& delete_files) {
+    // the splits of a data file, and the data files of a commit, share the same delete files
+    std::vector<std::string> delete_paths;
+    for (auto& delete_file : delete_files) {
+        delete_paths.emplace_back(delete_file.path);
+    }
+    std::sort(delete_paths.begin(), delete_paths.end());
+    std::string cache_key = "equality_delete";
+    for (auto& path : delete_paths) {
+        cache_key += "_" + path;
+    }
+    Status create_status = Status::OK();
+    _equality_delete = _kv_cache->get<EqualityDelete>(cache_key, [&]() -> EqualityDelete* {
+        auto equality_delete = std::make_unique<EqualityDelete>();
+        create_status = _read_equality_delete_files(delete_files, equality_delete.get());
+        if (!create_status) {
+            return nullptr;
+        }
+        return equality_delete.release();
+    });
+    RETURN_IF_ERROR(create_status);
+
+    const std::vector<std::string>& equality_delete_col_names = _equality_delete->col_names;
+    for (int i = 0; i < equality_delete_col_names.size(); ++i) {
+        const std::string& delete_col = equality_delete_col_names[i];
+        if (std::find(_all_required_col_names.begin(), _all_required_col_names.end(), delete_col) ==
+            _all_required_col_names.end()) {
+            _expand_col_names.emplace_back(delete_col);
+            DataTypePtr data_type = DataTypeFactory::instance().create_data_type(
+                    _equality_delete->col_types[i], true);
+            MutableColumnPtr data_column = data_type->create_column();
+            _expand_columns.emplace_back(
+                    ColumnWithTypeAndName(std::move(data_column), data_type, delete_col));
+        }
+    }
+    for (const std::string& delete_col : _expand_col_names) {
+        _all_required_col_names.emplace_back(delete_col);
+    }
+    return Status::OK();
+}
+
+Status IcebergTableReader::_read_equality_delete_files(
+        const std::vector<TIcebergDeleteFileDesc>& delete_files, EqualityDelete* equality_delete) {
+    SCOPED_TIMER(_iceberg_profile.delete_files_read_time);
     bool init_schema = false;
-    std::vector<std::string> equality_delete_col_names;
-    std::vector<TypeDescriptor> equality_delete_col_types;
+    std::vector<std::string>& equality_delete_col_names = equality_delete->col_names;
+    std::vector<TypeDescriptor>& equality_delete_col_types = equality_delete->col_types;
     std::unordered_map<std::string, std::tuple<std::string, const SlotDescriptor*>>
             partition_columns;
     std::unordered_map<std::string, VExprContextSPtr> missing_columns;
@@ -212,8 +255,8 @@ Status IcebergTableReader::_equality_delete_base(
         if (!init_schema) {
             RETURN_IF_ERROR(delete_reader->get_parsed_schema(&equality_delete_col_names,
                                                              &equality_delete_col_types));
-            _generate_equality_delete_block(&_equality_delete_block, equality_delete_col_names,
-                                            equality_delete_col_types);
+            _generate_equality_delete_block(&equality_delete->delete_block,
+                                            equality_delete_col_names, equality_delete_col_types);
             init_schema = true;
         }
         if (auto* parquet_reader = typeid_cast<ParquetReader*>(delete_reader.get())) {
@@ -238,28 +281,13 @@ Status IcebergTableReader::_equality_delete_base(
             size_t read_rows = 0;
             RETURN_IF_ERROR(delete_reader->get_next_block(&block, &read_rows, &eof));
             if (read_rows > 0) {
-                MutableBlock mutable_block(&_equality_delete_block);
+                MutableBlock mutable_block(&equality_delete->delete_block);
                 RETURN_IF_ERROR(mutable_block.merge(block));
             }
         }
     }
-    for (int i = 0; i < equality_delete_col_names.size(); ++i) {
-        const std::string& delete_col = equality_delete_col_names[i];
-        if (std::find(_all_required_col_names.begin(), _all_required_col_names.end(), delete_col) ==
-            _all_required_col_names.end()) {
-            _expand_col_names.emplace_back(delete_col);
-            DataTypePtr data_type = DataTypeFactory::instance().create_data_type(
-                    equality_delete_col_types[i], true);
-            MutableColumnPtr data_column = data_type->create_column();
-            _expand_columns.emplace_back(
-                    ColumnWithTypeAndName(std::move(data_column), data_type, delete_col));
-        }
-    }
-    for (const std::string& delete_col : _expand_col_names) {
-        _all_required_col_names.emplace_back(delete_col);
-    }
-    _equality_delete_impl = EqualityDeleteBase::get_delete_impl(&_equality_delete_block);
-    return _equality_delete_impl->init(_profile);
+    equality_delete->impl = EqualityDeleteBase::get_delete_impl(&equality_delete->delete_block);
+    return equality_delete->impl->init(_profile);
 }
 
 void IcebergTableReader::_generate_equality_delete_block(
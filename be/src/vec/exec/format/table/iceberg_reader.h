@@ -99,6 +99,14 @@ protected:
         RuntimeProfile::Counter* delete_files_read_time;
         RuntimeProfile::Counter* delete_rows_sort_time;
     };
+    // The equality deletes built from a set of delete files. They are read and hashed once, and
+    // shared by the scanners of the scan node through the kv cache.
+    struct EqualityDelete {
+        std::vector<std::string> col_names;
+        std::vector<TypeDescriptor> col_types;
+        Block delete_block;
+        std::unique_ptr<EqualityDeleteBase> impl;
+    };
     using DeleteRows = std::vector<int64_t>;
     using DeleteFile = phmap::parallel_flat_hash_map<
             std::string, std::unique_ptr<DeleteRows>, std::hash<std::string>,
@@ -125,6 +133,8 @@ protected:
 
     Status _position_delete_base(const std::vector<TIcebergDeleteFileDesc>& delete_files);
     Status _equality_delete_base(const std::vector<TIcebergDeleteFileDesc>& delete_files);
+    Status _read_equality_delete_files(const std::vector<TIcebergDeleteFileDesc>& delete_files,
+                                       EqualityDelete* equality_delete);
     virtual std::unique_ptr<GenericReader> _create_equality_reader(
             const TFileRangeDesc& delete_desc) = 0;
     void _generate_equality_delete_block(
@@ -184,9 +194,8 @@ protected:
     void _gen_position_delete_file_range(Block& block, DeleteFile* const position_delete,
                                          size_t read_rows, bool file_path_column_dictionary_coded);
 
-    // equality delete
-    Block _equality_delete_block;
-    std::unique_ptr<EqualityDeleteBase> _equality_delete_impl;
+    // equality delete, owned by _kv_cache
+    EqualityDelete* _equality_delete = nullptr;
 };
 
 class IcebergParquetReader final : public IcebergTableReader {
@@ -37,6 +37,7 @@
 #include "util/runtime_profile.h"
 #include "util/string_util.h"
 #include "vec/aggregate_functions/aggregate_function.h"
+#include "vec/common/pod_array.h"
 #include "vec/common/string_ref.h"
 #include "vec/data_types/data_type.h"
 
@@ -349,6 +350,24 @@ private:
         return Status::OK();
     }
 
+    // The offsets of java side are the end offsets of the rows starting from 0, so they are
+    // copied as they are if the doris column is empty, which is the case of a new block.
+    template <typename DORIS_OFFSET, typename JAVA_OFFSET>
+    static void _fill_offsets(PaddedPODArray<DORIS_OFFSET>& doris_offsets,
+                              const JAVA_OFFSET* offsets, size_t num_rows) {
+        static_assert(sizeof(DORIS_OFFSET) == sizeof(JAVA_OFFSET));
+        size_t origin_size = doris_offsets.size();
+        size_t start_offset = doris_offsets[origin_size - 1];
+        doris_offsets.resize(origin_size + num_rows);
+        if (start_offset == 0) {
+            memcpy(doris_offsets.data() + origin_size, offsets, sizeof(JAVA_OFFSET) * num_rows);
+        } else {
+            for (size_t i = 0; i < num_rows; ++i) {
+                doris_offsets[origin_size + i] = offsets[i] + start_offset;
+            }
+        }
+    }
+
     template <typename COLUMN_TYPE>
     static long _get_fixed_length_column_address(MutableColumnPtr& doris_column) {
         return (long)static_cast<COLUMN_TYPE&>(*doris_column).get_data().data();
@@ -97,6 +97,8 @@ struct ProcessHashTableProbe {
     std::unique_ptr<Arena> _arena;
     std::vector<StringRef> _probe_keys;
 
+    // the order to visit the probe rows if the hash table is radix partitioned
+    std::vector<uint32_t> _probe_order;
     std::vector<uint32_t> _probe_indexs;
     bool _probe_visited = false;
     bool _picking_null_keys = false;
@@ -176,8 +176,17 @@ typename HashTableType::State ProcessHashTableProbe<JoinOpType>::_init_probe_sid
         hash_table_ctx.reset();
         hash_table_ctx.init_serialized_keys(_parent->_probe_columns, probe_rows, null_map, true,
                                             false, hash_table_ctx.hash_table->get_bucket_size());
-        hash_table_ctx.hash_table->pre_build_idxs(hash_table_ctx.bucket_nums,
-                                                  need_judge_null ? null_map : nullptr);
+        const uint8_t* bucket_tags = hash_table_ctx.hash_table->use_bucket_tags()
+                                             ? hash_table_ctx.bucket_tags.data()
+                                             : nullptr;
+        if (hash_table_ctx.hash_table->is_radix_partitioned()) {
+            DCHECK(!need_judge_null);
+            hash_table_ctx.hash_table->pre_build_idxs_radix_partitioned(
+                    hash_table_ctx.bucket_nums, _probe_order, bucket_tags);
+        } else {
+            hash_table_ctx.hash_table->pre_build_idxs(
+                    hash_table_ctx.bucket_nums, need_judge_null ? null_map : nullptr, bucket_tags);
+        }
         COUNTER_SET(_parent->_probe_arena_memory_usage,
                     (int64_t)hash_table_ctx.serialized_keys_size(false));
     }
@@ -251,6 +260,23 @@ Status ProcessHashTableProbe<JoinOpType>::do_process(HashTableType& hash_table_c
                 }
             }
         }
+    } else if (hash_table_ctx.hash_table->is_radix_partitioned()) {
+        // only inner join without other conjuncts builds a radix partitioned hash table
+        SCOPED_TIMER(_search_hashtable_timer);
+        if constexpr (JoinOpType == TJoinOp::INNER_JOIN && !with_other_conjuncts &&
+                      !is_mark_join) {
+            auto [new_probe_pos, new_build_idx, new_current_offset] =
+                    hash_table_ctx.hash_table->find_batch_radix_partitioned(
+                            hash_table_ctx.keys, hash_table_ctx.bucket_nums.data(),
+                            _probe_order.data(), probe_index, build_index, probe_rows,
+                            _probe_indexs.data(), _build_indexs.data());
+            probe_index = new_probe_pos;
+            build_index = new_build_idx;
+            current_offset = new_current_offset;
+        } else {
+            return Status::InternalError("join type {} probes a radix partitioned hash table",
+                                         JoinOpType);
+        }
     } else {
         SCOPED_TIMER(_search_hashtable_timer);
         auto [new_probe_idx, new_build_idx,
@@ -285,7 +311,9 @@ Status ProcessHashTableProbe<JoinOpType>::do_process(HashTableType& hash_table_c
 
         RETURN_IF_CATCH_EXCEPTION(probe_side_output_column(
                 mcol, *_left_output_slot_flags, current_offset, last_probe_index,
-                check_all_match_one(_probe_indexs, last_probe_index, current_offset),
+                // the probe rows of a radix partitioned hash table are not in order
+                !hash_table_ctx.hash_table->is_radix_partitioned() &&
+                        check_all_match_one(_probe_indexs, last_probe_index, current_offset),
                 with_other_conjuncts));
     }
 
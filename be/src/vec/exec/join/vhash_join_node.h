@@ -124,17 +124,36 @@ struct ProcessHashTableBuild {
         SCOPED_TIMER(_parent->_build_table_insert_timer);
         hash_table_ctx.hash_table->template prepare_build<JoinOpType>(_rows, _batch_size,
                                                                       *has_null_key);
+        if (_parent->_can_radix_partition) {
+            hash_table_ctx.hash_table->init_radix_partition(_rows);
+        }
 
         hash_table_ctx.init_serialized_keys(_build_raw_ptrs, _rows,
                                             null_map ? null_map->data() : nullptr, true, true,
                                             hash_table_ctx.hash_table->get_bucket_size());
-        hash_table_ctx.hash_table->template build<JoinOpType, with_other_conjuncts>(
-                hash_table_ctx.keys, hash_table_ctx.bucket_nums.data(), _rows);
+        auto* hash_table = hash_table_ctx.hash_table.get();
+        const uint8_t* bucket_tags =
+                hash_table->use_bucket_tags() ? hash_table_ctx.bucket_tags.data() : nullptr;
+        if (!hash_table->is_radix_partitioned() && _parent->_can_build_cooperatively(_rows)) {
+            hash_table->begin_build(hash_table_ctx.keys, bucket_tags);
+            const uint32_t* bucket_nums = hash_table_ctx.bucket_nums.data();
+            _parent->_build_cooperatively([&](int part, int num_parts) {
+                hash_table->build_part(bucket_nums, _rows, bucket_tags, part, num_parts);
+            });
+            hash_table->template finish_build<JoinOpType, with_other_conjuncts>();
+        } else {
+            hash_table->template build<JoinOpType, with_other_conjuncts>(
+                    hash_table_ctx.keys, hash_table_ctx.bucket_nums.data(), _rows, bucket_tags);
+        }
         hash_table_ctx.bucket_nums.resize(_batch_size);
         hash_table_ctx.bucket_nums.shrink_to_fit();
+        hash_table_ctx.bucket_tags.clear();
+        hash_table_ctx.bucket_tags.shrink_to_fit();
 
         COUNTER_SET(_parent->_hash_table_memory_usage,
                     (int64_t)hash_table_ctx.hash_table->get_byte_size());
+        COUNTER_SET(_parent->_radix_partition_bits,
+                    (int64_t)hash_table_ctx.hash_table->get_radix_partition_bits());
         COUNTER_SET(_parent->_build_arena_memory_usage,
                     (int64_t)hash_table_ctx.serialized_keys_size(true));
         return Status::OK();
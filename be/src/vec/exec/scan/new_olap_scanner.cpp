@@ -54,6 +54,7 @@
 #include "pipeline/exec/olap_scan_operator.h"
 #include "runtime/descriptors.h"
 #include "runtime/exec_env.h"
+#include "runtime/query_context.h"
 #include "runtime/runtime_state.h"
 #include "service/backend_options.h"
 #include "util/doris_metrics.h"
@@ -367,6 +368,7 @@ Status NewOlapScanner::_init_tablet_reader_params(
                 ((pipeline::OlapScanLocalState*)_local_state)->olap_scan_node();
         // order by table keys optimization for topn
         // will only read head/tail of data file since it's already sorted by keys
+        // without a limit, all the rows are read in the order of the keys by merging the rowsets
         if (olap_scan_node.__isset.sort_info && !olap_scan_node.sort_info.is_asc_order.empty()) {
             _limit = _local_state->limit_per_scanner();
             _tablet_reader_params.read_orderby_key = true;
@@ -375,14 +377,19 @@ Status NewOlapScanner::_init_tablet_reader_params(
             }
             _tablet_reader_params.read_orderby_key_num_prefix_columns =
                     olap_scan_node.sort_info.is_asc_order.size();
-            _tablet_reader_params.read_orderby_key_limit = _limit;
-            _tablet_reader_params.filter_block_conjuncts = _conjuncts;
+            if (_limit > 0) {
+                _tablet_reader_params.read_orderby_key_limit = _limit;
+                _tablet_reader_params.filter_block_conjuncts = _conjuncts;
+            }
         }
 
         // set push down topn filter
+        auto* olap_local_state = (pipeline::OlapScanLocalState*)_local_state;
         _tablet_reader_params.topn_filter_source_node_ids =
-                ((pipeline::OlapScanLocalState*)_local_state)
-                        ->get_topn_filter_source_node_ids(_state, true);
+                olap_local_state->get_topn_filter_source_node_ids(_state, true);
+        for (int id : olap_local_state->_get_topn_filter_bound_source_node_ids(_state)) {
+            _tablet_reader_params.topn_filter_source_node_ids.push_back(id);
+        }
         if (!_tablet_reader_params.topn_filter_source_node_ids.empty()) {
             _tablet_reader_params.topn_filter_target_node_id =
                     ((pipeline::OlapScanLocalState*)_local_state)->parent()->node_id();
@@ -595,6 +602,8 @@ void NewOlapScanner::_collect_profile_before_close() {
     COUNTER_UPDATE(Parent->_rows_vec_cond_input_counter, stats.vec_cond_input_rows);              \
     COUNTER_UPDATE(Parent->_rows_short_circuit_cond_input_counter,                                \
                    stats.short_circuit_cond_input_rows);                                          \
+    COUNTER_UPDATE(Parent->_short_circuit_predicates_reordered_counter,                           \
+                   stats.short_circuit_predicates_reordered);                                     \
     for (auto& [id, info] : stats.filter_info) {                                                  \
         Parent->add_filter_info(id, info);                                                        \
     }                                                                                             \
@@ -651,11 +660,31 @@ void NewOlapScanner::_collect_profile_before_close() {
     tablet->query_scan_bytes->increment(_compressed_bytes_read);
     tablet->query_scan_rows->increment(_raw_rows_read);
     tablet->query_scan_count->increment(1);
+    if (auto* query_ctx = _state->get_query_ctx(); query_ctx && query_ctx->workload_group()) {
+        query_ctx->workload_group()->update_inverted_index_query_cache_stats(
+                stats.inverted_index_query_cache_hit, stats.inverted_index_query_cache_miss);
+    }
     if (_query_statistics) {
         _query_statistics->add_scan_bytes_from_local_storage(
                 stats.file_cache_stats.bytes_read_from_local);
         _query_statistics->add_scan_bytes_from_remote_storage(
                 stats.file_cache_stats.bytes_read_from_remote);
+
+        auto& storage_read = _query_statistics->storage_read();
+        storage_read.requested_page_bytes += stats.requested_page_bytes;
+        storage_read.page_cache_bytes += stats.cached_page_bytes;
+        storage_read.file_cache_bytes += stats.file_cache_stats.bytes_read_from_local;
+        storage_read.remote_bytes += stats.file_cache_stats.bytes_read_from_remote;
+        // The pages which went through neither of the caches were read from the local disks.
+        storage_read.local_disk_bytes += std::max<int64_t>(
+                0, stats.compressed_bytes_read - stats.file_cache_stats.bytes_read_from_local -
+                           stats.file_cache_stats.bytes_read_from_remote);
+        storage_read.decompressed_bytes += stats.uncompressed_bytes_read;
+        storage_read.rows_zone_map_filtered += stats.rows_stats_filtered;
+        storage_read.rows_bloom_filter_filtered += stats.rows_bf_filtered;
+        storage_read.rows_inverted_index_filtered += stats.rows_inverted_index_filtered;
+        storage_read.rows_predicate_filtered +=
+                stats.rows_vec_cond_filtered + stats.rows_short_circuit_cond_filtered;
     }
 }
 
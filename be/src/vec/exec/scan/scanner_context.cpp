@@ -32,6 +32,7 @@
 #include "runtime/runtime_state.h"
 #include "util/uid_util.h"
 #include "vec/core/block.h"
+#include "vec/exec/scan/scanner_scheduler.h"
 #include "vec/exec/scan/vscan_node.h"
 
 namespace doris::vectorized {
@@ -115,6 +116,7 @@ Status ScannerContext::init() {
     _free_blocks_memory_usage_mark = _local_state->_free_blocks_memory_usage;
     _scanner_ctx_sched_time = _local_state->_scanner_ctx_sched_time;
     _scale_up_scanners_counter = _local_state->_scale_up_scanners_counter;
+    _scale_down_scanners_counter = _local_state->_scale_down_scanners_counter;
 
 #ifndef BE_TEST
     // 3. get thread token
@@ -264,7 +266,7 @@ Status ScannerContext::get_block_from_queue(RuntimeState* state, vectorized::Blo
                         }
                     }
                 }
-            } else {
+            } else if (!_try_to_scale_down(scan_task)) {
                 // resubmit current running scanner to read the next block
                 submit_scan_task(scan_task);
             }
@@ -291,8 +293,10 @@ void ScannerContext::_try_to_scale_up() {
     // 2. Half(`WAIT_BLOCK_DURATION_RATIO`) of the duration is waiting to get blocks
     // 3. `_free_blocks_memory_usage` < `_max_bytes_in_queue`, remains enough memory to scale up
     // 4. At most scale up `MAX_SCALE_UP_RATIO` times to `_max_thread_num`
+    float max_running_scanners =
+            std::min(_max_thread_num * MAX_SCALE_UP_RATIO, (float)_max_scan_threads());
     if (MAX_SCALE_UP_RATIO > 0 && _scanners.size_approx() > 0 &&
-        (_num_running_scanners < _max_thread_num * MAX_SCALE_UP_RATIO) &&
+        (_num_running_scanners < max_running_scanners) &&
         (_last_fetch_time - _last_scale_up_time > SCALE_UP_DURATION) && // duration > 5000ms
         (_total_wait_block_time > (_last_fetch_time - _last_scale_up_time) *
                                           WAIT_BLOCK_DURATION_RATIO)) { // too large lock time
@@ -308,7 +312,7 @@ void ScannerContext::_try_to_scale_up() {
         bool is_scale_up = false;
         // calculate the number of scanners that can be scheduled
         int num_add = int(std::min(_num_running_scanners * SCALE_UP_RATIO,
-                                   _max_thread_num * MAX_SCALE_UP_RATIO - _num_running_scanners));
+                                   max_running_scanners - _num_running_scanners));
         if (_estimated_block_size > 0) {
             int most_add =
                     (_max_bytes_in_queue - _free_blocks_memory_usage) / _estimated_block_size;
@@ -335,6 +339,42 @@ void ScannerContext::_try_to_scale_up() {
     }
 }
 
+bool ScannerContext::_try_to_scale_down(const std::shared_ptr<ScanTask>& scan_task) {
+    if (!config::enable_scanner_scale_down || _num_running_scanners <= 1) {
+        return false;
+    }
+    int64_t now = UnixMillis();
+    if (_last_scale_down_time == 0) {
+        _last_scale_down_time = now;
+        _last_scale_down_wait_time = _total_wait_block_time;
+        return false;
+    }
+    if (now - _last_scale_down_time < SCALE_DOWN_DURATION) {
+        return false;
+    }
+    // start the next duration whatever the decision is
+    bool consumer_waited = _total_wait_block_time != _last_scale_down_wait_time;
+    _last_scale_down_time = now;
+    _last_scale_down_wait_time = _total_wait_block_time;
+    if (consumer_waited ||
+        _free_blocks_memory_usage < _max_bytes_in_queue * SCALE_DOWN_MEMORY_RATIO) {
+        return false;
+    }
+    _scanners.enqueue(scan_task->scanner);
+    _num_running_scanners--;
+    _scale_down_scanners_counter->update(1);
+    // the running scanners changed, so measure the effect of scaling up from scratch
+    _last_wait_duration_ratio = 0;
+    return true;
+}
+
+int32_t ScannerContext::_max_scan_threads() const {
+    if (_simple_scan_scheduler) {
+        return _simple_scan_scheduler->get_max_threads();
+    }
+    return config::doris_scanner_thread_pool_thread_num;
+}
+
 Status ScannerContext::validate_block_schema(Block* block) {
     size_t index = 0;
     for (auto& slot : _output_tuple_desc->slots()) {
@@ -183,9 +183,19 @@ protected:
     /// 1. It ran for at least `SCALE_UP_DURATION` ms after last scale up
     /// 2. Half(`WAIT_BLOCK_DURATION_RATIO`) of the duration is waiting to get blocks
     /// 3. `_free_blocks_memory_usage` < `_max_bytes_in_queue`, remains enough memory to scale up
-    /// 4. At most scale up `MAX_SCALE_UP_RATIO` times to `_max_thread_num`
+    /// 4. At most scale up `MAX_SCALE_UP_RATIO` times to `_max_thread_num`, and not more than
+    ///    the scan threads of the workload group
     void _set_scanner_done();
     void _try_to_scale_up();
+    /// Park the scanner of a consumed scan task instead of resubmitting it if the consumer
+    /// is slower than the running scanners: it did not wait for blocks during the last
+    /// `SCALE_DOWN_DURATION` ms, and the blocks take more than `SCALE_DOWN_MEMORY_RATIO` of
+    /// `_max_bytes_in_queue`. At most one scanner is parked in a duration, and the parked
+    /// scanner is resumed like the unscheduled scanners.
+    /// Return true if the scanner is parked.
+    bool _try_to_scale_down(const std::shared_ptr<ScanTask>& scan_task);
+    /// The scan threads available to this query, bounded by the workload group
+    int32_t _max_scan_threads() const;
 
     RuntimeState* _state = nullptr;
     VScanNode* _parent = nullptr;
@@ -228,6 +238,7 @@ protected:
     RuntimeProfile::HighWaterMarkCounter* _free_blocks_memory_usage_mark = nullptr;
     RuntimeProfile::Counter* _scanner_ctx_sched_time = nullptr;
     RuntimeProfile::Counter* _scale_up_scanners_counter = nullptr;
+    RuntimeProfile::Counter* _scale_down_scanners_counter = nullptr;
     QueryThreadContext _query_thread_context;
     std::shared_ptr<pipeline::Dependency> _dependency = nullptr;
 
@@ -242,6 +253,11 @@ protected:
     const float WAIT_BLOCK_DURATION_RATIO = 0.5;
     const float SCALE_UP_RATIO = 0.5;
     float MAX_SCALE_UP_RATIO;
+    // for scaling down the running scanners
+    int64_t _last_scale_down_time = 0;
+    int64_t _last_scale_down_wait_time = 0;
+    const int64_t SCALE_DOWN_DURATION = 1000; // 1000ms
+    const float SCALE_DOWN_MEMORY_RATIO = 0.8;
 };
 } // namespace vectorized
 } // namespace doris
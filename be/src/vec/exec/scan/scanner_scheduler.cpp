@@ -17,6 +17,8 @@
 
 #include "scanner_scheduler.h"
 
+#include <bvar/latency_recorder.h>
+
 #include <algorithm>
 #include <cstdint>
 #include <functional>
@@ -31,10 +33,13 @@
 #include "common/compiler_util.h" // IWYU pragma: keep
 #include "common/config.h"
 #include "common/logging.h"
+#include "io/fs/local_io_scheduler.h"
 #include "olap/tablet.h"
 #include "runtime/exec_env.h"
+#include "runtime/query_context.h"
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
+#include "runtime/workload_group/workload_group.h"
 #include "util/async_io.h" // IWYU pragma: keep
 #include "util/blocking_queue.hpp"
 #include "util/cpu_info.h"
@@ -57,6 +62,8 @@ DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(local_scan_thread_pool_queue_size, MetricUnit
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(local_scan_thread_pool_thread_num, MetricUnit::NOUNIT);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(remote_scan_thread_pool_queue_size, MetricUnit::NOUNIT);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(remote_scan_thread_pool_thread_num, MetricUnit::NOUNIT);
+// From the submit of scanners to the scan threads to their run.
+bvar::LatencyRecorder g_scanner_queue_wait_latency("scanner", "queue_wait");
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(limited_scan_thread_pool_queue_size, MetricUnit::NOUNIT);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(limited_scan_thread_pool_thread_num, MetricUnit::NOUNIT);
 DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(group_local_scan_thread_pool_queue_size, MetricUnit::NOUNIT);
@@ -205,6 +212,9 @@ void ScannerScheduler::_scanner_scan(std::shared_ptr<ScannerContext> ctx,
 
     VScannerSPtr& scanner = scanner_delegate->_scanner;
     SCOPED_ATTACH_TASK(scanner->runtime_state());
+    auto* query_ctx = scanner->runtime_state()->get_query_ctx();
+    WorkloadGroupPtr wg = query_ctx != nullptr ? query_ctx->workload_group() : nullptr;
+    SCOPED_IO_TAG(io::IOClass::QUERY, wg ? wg->id() : 0, wg ? wg->cpu_share() : 0);
     // for cpu hard limit, thread name should not be reset
     if (ctx->_should_reset_thread_name) {
         Thread::set_self_name("_scanner_scan");
@@ -217,7 +227,7 @@ void ScannerScheduler::_scanner_scan(std::shared_ptr<ScannerContext> ctx,
         Thread::set_thread_nice_value();
     }
 #endif
-    scanner->update_wait_worker_timer();
+    g_scanner_queue_wait_latency << scanner->update_wait_worker_timer() / 1000;
     scanner->start_scan_cpu_timer();
     Status status = Status::OK();
     bool eos = false;
@@ -171,6 +171,8 @@ public:
         }
     }
 
+    int get_max_threads() const { return _scan_thread_pool->max_threads(); }
+
     void reset_max_thread_num(int thread_num) {
         int max_thread_num = _scan_thread_pool->max_threads();
 
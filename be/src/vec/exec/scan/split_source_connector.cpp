@@ -27,16 +27,11 @@ using apache::thrift::transport::TTransportException;
 Status LocalSplitSourceConnector::get_next(bool* has_next, TFileRangeDesc* range) {
     std::lock_guard<std::mutex> l(_range_lock);
     *has_next = false;
-    if (_scan_index < _scan_ranges.size()) {
-        auto& ranges = _scan_ranges[_scan_index].scan_range.ext_scan_range.file_scan_range.ranges;
-        if (_range_index < ranges.size()) {
-            *has_next = true;
-            *range = ranges[_range_index++];
-            if (_range_index == ranges.size()) {
-                _scan_index++;
-                _range_index = 0;
-            }
-        }
+    if (_order_index < _range_order.size()) {
+        auto [scan_index, range_index] = _range_order[_order_index++];
+        *has_next = true;
+        auto& ranges = _scan_ranges[scan_index].scan_range.ext_scan_range.file_scan_range.ranges;
+        *range = ranges[range_index];
     }
     return Status::OK();
 }
@@ -44,7 +39,7 @@ Status LocalSplitSourceConnector::get_next(bool* has_next, TFileRangeDesc* range
 Status RemoteSplitSourceConnector::get_next(bool* has_next, TFileRangeDesc* range) {
     std::lock_guard<std::mutex> l(_range_lock);
     *has_next = false;
-    if (_scan_index == _scan_ranges.size() && !_last_batch) {
+    if (_order_index == _range_order.size() && !_last_batch) {
         Status coord_status;
         FrontendServiceConnection coord(_state->exec_env()->frontend_client_cache(),
                                         _state->get_query_ctx()->coord_addr, &coord_status);
@@ -66,19 +61,14 @@ Status RemoteSplitSourceConnector::get_next(bool* has_next, TFileRangeDesc* rang
         }
         _last_batch = result.splits.empty();
         _scan_ranges = result.splits;
-        _scan_index = 0;
-        _range_index = 0;
+        _order_ranges(_scan_ranges, &_range_order);
+        _order_index = 0;
     }
-    if (_scan_index < _scan_ranges.size()) {
-        auto& ranges = _scan_ranges[_scan_index].scan_range.ext_scan_range.file_scan_range.ranges;
-        if (_range_index < ranges.size()) {
-            *has_next = true;
-            *range = ranges[_range_index++];
-            if (_range_index == ranges.size()) {
-                _scan_index++;
-                _range_index = 0;
-            }
-        }
+    if (_order_index < _range_order.size()) {
+        auto [scan_index, range_index] = _range_order[_order_index++];
+        *has_next = true;
+        auto& ranges = _scan_ranges[scan_index].scan_range.ext_scan_range.file_scan_range.ranges;
+        *range = ranges[range_index];
     }
     return Status::OK();
 }
@@ -17,6 +17,10 @@
 
 #pragma once
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include "common/config.h"
 #include "runtime/client_cache.h"
 #include "runtime/runtime_state.h"
@@ -27,6 +31,8 @@ namespace doris::vectorized {
  * Multiple scanners within a scan node share a split source.
  * Each scanner call `get_next` to get the next scan range. A fast scanner will immediately obtain
  * the next scan range, so there is no situation of data skewing.
+ * The scan ranges are handed out from the largest to the smallest, so that a large split taken
+ * at the end does not keep one scanner busy after the others finish.
  */
 class SplitSourceConnector {
 public:
@@ -43,6 +49,34 @@ public:
     virtual int num_scan_ranges() = 0;
 
     virtual TFileScanRangeParams* get_params() = 0;
+
+protected:
+    // Get the order of the ranges in `scan_ranges` as pairs of (scan index, range index).
+    template <typename ScanRanges>
+    static void _order_ranges(const ScanRanges& scan_ranges,
+                              std::vector<std::pair<int, int>>* range_order) {
+        range_order->clear();
+        for (int i = 0; i < scan_ranges.size(); ++i) {
+            auto& ranges = scan_ranges[i].scan_range.ext_scan_range.file_scan_range.ranges;
+            for (int j = 0; j < ranges.size(); ++j) {
+                range_order->emplace_back(i, j);
+            }
+        }
+        if (!config::enable_split_source_order_by_size) {
+            return;
+        }
+        auto range_size = [&](const std::pair<int, int>& index) {
+            auto& range = scan_ranges[index.first]
+                                  .scan_range.ext_scan_range.file_scan_range.ranges[index.second];
+            // size is -1 if the whole file is read
+            return range.size >= 0 ? range.size : range.file_size;
+        };
+        // the ranges of unknown size keep their order at the end
+        std::stable_sort(range_order->begin(), range_order->end(),
+                         [&](const std::pair<int, int>& a, const std::pair<int, int>& b) {
+                             return range_size(a) > range_size(b);
+                         });
+    }
 };
 
 /**
@@ -55,12 +89,14 @@ class LocalSplitSourceConnector : public SplitSourceConnector {
 private:
     std::mutex _range_lock;
     std::vector<TScanRangeParams> _scan_ranges;
-    int _scan_index = 0;
-    int _range_index = 0;
+    std::vector<std::pair<int, int>> _range_order;
+    size_t _order_index = 0;
 
 public:
     LocalSplitSourceConnector(const std::vector<TScanRangeParams>& scan_ranges)
-            : _scan_ranges(scan_ranges) {}
+            : _scan_ranges(scan_ranges) {
+        _order_ranges(_scan_ranges, &_range_order);
+    }
 
     Status get_next(bool* has_next, TFileRangeDesc* range) override;
 
@@ -92,8 +128,9 @@ private:
 
     std::vector<TScanRangeLocations> _scan_ranges;
     bool _last_batch = false;
-    int _scan_index = 0;
-    int _range_index = 0;
+    // the order of the ranges in the current batch
+    std::vector<std::pair<int, int>> _range_order;
+    size_t _order_index = 0;
 
 public:
     RemoteSplitSourceConnector(RuntimeState* state, int64 split_source_id, int num_splits)
@@ -35,8 +35,11 @@
 #include "common/config.h"
 #include "common/logging.h"
 #include "common/object_pool.h"
+#include "exec/olap_utils.h"
+#include "exprs/hybrid_set.h"
 #include "io/cache/block_file_cache_profile.h"
 #include "runtime/descriptors.h"
+#include "runtime/query_context.h"
 #include "runtime/runtime_state.h"
 #include "runtime/types.h"
 #include "vec/aggregate_functions/aggregate_function.h"
@@ -71,6 +74,7 @@
 #include "vec/exec/scan/vscan_node.h"
 #include "vec/exprs/vexpr.h"
 #include "vec/exprs/vexpr_context.h"
+#include "vec/exprs/vliteral.h"
 #include "vec/exprs/vslot_ref.h"
 #include "vec/functions/function.h"
 #include "vec/functions/function_string.h"
@@ -138,11 +142,17 @@ Status VFileScanner::prepare(
     _file_counter = ADD_COUNTER(_local_state->scanner_profile(), "FileNumber", TUnit::UNIT);
     _has_fully_rf_file_counter =
             ADD_COUNTER(_local_state->scanner_profile(), "HasFullyRfFileNumber", TUnit::UNIT);
+    _runtime_filter_value_range_counter = ADD_COUNTER(_local_state->scanner_profile(),
+                                                      "RuntimeFilterValueRangeNum", TUnit::UNIT);
 
     _file_cache_statistics.reset(new io::FileCacheStatistics());
     _io_ctx.reset(new io::IOContext());
     _io_ctx->file_cache_stats = _file_cache_statistics.get();
     _io_ctx->query_id = &_state->query_id();
+    if (auto* query_ctx = _state->get_query_ctx();
+        query_ctx != nullptr && query_ctx->workload_group() != nullptr) {
+        _io_ctx->remote_read_throttle = query_ctx->workload_group()->remote_read_throttle();
+    }
 
     if (_is_load) {
         _src_row_desc.reset(new RowDescriptor(_state->desc_tbl(),
@@ -215,6 +225,7 @@ Status VFileScanner::_process_late_arrival_conjuncts() {
             RETURN_IF_ERROR(_conjuncts[i]->clone(_state, _push_down_conjuncts[i]));
         }
         RETURN_IF_ERROR(_process_conjuncts_for_dict_filter());
+        RETURN_IF_ERROR(_process_runtime_filter_value_ranges());
         _discard_conjuncts();
     }
     if (_applied_rf_num == _total_rf_num) {
@@ -223,6 +234,95 @@ Status VFileScanner::_process_late_arrival_conjuncts() {
     return Status::OK();
 }
 
+// The runtime filters arrived after the scan node is opened are only conjuncts evaluated on the
+// decoded rows. Narrow the value ranges of the columns by the in and min/max filters among them,
+// so the readers opened later can skip row groups, pages and stripes by their statistics.
+Status VFileScanner::_process_runtime_filter_value_ranges() {
+    if (_colname_to_value_range == nullptr) {
+        return Status::OK();
+    }
+    for (; _rf_value_range_conjunct_num < _push_down_conjuncts.size();
+         ++_rf_value_range_conjunct_num) {
+        const auto& root = _push_down_conjuncts[_rf_value_range_conjunct_num]->root();
+        // only the runtime filter wrapper has an impl
+        auto impl = root->get_impl();
+        if (impl == nullptr || impl->children().empty() ||
+            (impl->node_type() != TExprNodeType::IN_PRED &&
+             impl->node_type() != TExprNodeType::BINARY_PRED)) {
+            continue;
+        }
+        // the statistics of the column can not be used if the probe expr casts the slot
+        auto* slot_ref = dynamic_cast<VSlotRef*>(impl->children()[0].get());
+        if (slot_ref == nullptr) {
+            continue;
+        }
+        if (_colname_to_value_range != &_rf_colname_to_value_range) {
+            _rf_colname_to_value_range = *_colname_to_value_range;
+            _colname_to_value_range = &_rf_colname_to_value_range;
+        }
+        auto it = _rf_colname_to_value_range.find(slot_ref->expr_name());
+        if (it == _rf_colname_to_value_range.end()) {
+            continue;
+        }
+        Status status;
+        std::visit(
+                [&](auto& range) {
+                    status = _narrow_value_range_by_runtime_filter(impl.get(), range);
+                },
+                it->second);
+        RETURN_IF_ERROR(status);
+        COUNTER_UPDATE(_runtime_filter_value_range_counter, 1);
+    }
+    return Status::OK();
+}
+
+template <PrimitiveType T>
+Status VFileScanner::_narrow_value_range_by_runtime_filter(VExpr* expr,
+                                                           ColumnValueRange<T>& range) {
+    using CppType = typename PrimitiveTypeTraits<T>::CppType;
+    // the DATE values may lose accuracy in the range, and HLL has no statistics
+    if constexpr (T == TYPE_DATE || T == TYPE_HLL) {
+        return Status::OK();
+    } else if (expr->node_type() == TExprNodeType::IN_PRED) {
+        auto hybrid_set = expr->get_set_func();
+        if (hybrid_set == nullptr ||
+            hybrid_set->size() > config::max_pushdown_conditions_per_column) {
+            return Status::OK();
+        }
+        auto temp_range = ColumnValueRange<T>::create_empty_column_value_range(
+                range.is_nullable_col(), range.precision(), range.scale());
+        for (auto* iter = hybrid_set->begin(); iter->has_next(); iter->next()) {
+            // column in (nullptr) is always false
+            if (iter->get_value() != nullptr) {
+                RETURN_IF_ERROR(temp_range.add_fixed_value(
+                        *reinterpret_cast<const CppType*>(iter->get_value())));
+            }
+        }
+        range.intersection(temp_range);
+    } else {
+        // the min/max filter is `slot >= min` or `slot <= max`
+        if (expr->children().size() != 2 || !expr->children()[1]->is_literal()) {
+            return Status::OK();
+        }
+        auto value = std::static_pointer_cast<VLiteral>(expr->children()[1])
+                             ->get_column_ptr()
+                             ->get_data_at(0);
+        if (value.data == nullptr) {
+            return Status::OK();
+        }
+        auto op = to_olap_filter_type(expr->op(), false);
+        if constexpr (T == TYPE_CHAR || T == TYPE_VARCHAR || T == TYPE_STRING) {
+            RETURN_IF_ERROR(range.add_range(op, StringRef(value.data, value.size)));
+        } else {
+            if (value.size != sizeof(CppType)) {
+                return Status::OK();
+            }
+            RETURN_IF_ERROR(range.add_range(op, *reinterpret_cast<const CppType*>(value.data)));
+        }
+    }
+    return Status::OK();
+}
+
 void VFileScanner::_get_slot_ids(VExpr* expr, std::vector<int>* slot_ids) {
     for (auto& child_expr : expr->children()) {
         if (child_expr->is_slot_ref()) {
@@ -102,6 +102,11 @@ protected:
     std::unique_ptr<GenericReader> _cur_reader;
     bool _cur_reader_eof;
     std::unordered_map<std::string, ColumnValueRangeType>* _colname_to_value_range = nullptr;
+    // The copy of the value ranges of the scan node narrowed by the late arrival runtime filters,
+    // `_colname_to_value_range` points to it once a runtime filter is converted.
+    std::unordered_map<std::string, ColumnValueRangeType> _rf_colname_to_value_range;
+    // the number of `_push_down_conjuncts` converted into the value ranges
+    size_t _rf_value_range_conjunct_num = 0;
     // File source slot descriptors
     std::vector<SlotDescriptor*> _file_slot_descs;
     // col names from _file_slot_descs
@@ -180,6 +185,7 @@ private:
     RuntimeProfile::Counter* _empty_file_counter = nullptr;
     RuntimeProfile::Counter* _file_counter = nullptr;
     RuntimeProfile::Counter* _has_fully_rf_file_counter = nullptr;
+    RuntimeProfile::Counter* _runtime_filter_value_range_counter = nullptr;
 
     const std::unordered_map<std::string, int>* _col_name_to_slot_id = nullptr;
     // single slot filter conjuncts
@@ -211,6 +217,9 @@ private:
     Status _handle_dynamic_block(Block* block);
     Status _process_conjuncts_for_dict_filter();
     Status _process_late_arrival_conjuncts();
+    Status _process_runtime_filter_value_ranges();
+    template <PrimitiveType T>
+    Status _narrow_value_range_by_runtime_filter(VExpr* expr, ColumnValueRange<T>& range);
     void _get_slot_ids(VExpr* expr, std::vector<int>* slot_ids);
 
     void _reset_counter() {
@@ -223,10 +232,14 @@ private:
     int64_t _get_push_down_count() { return _local_state->get_push_down_count(); }
 
     // enable the file meta cache only when
-    // 1. max_external_file_meta_cache_num is > 0
-    // 2. the file number is less than 1/3 of cache's capacibility
+    // 1. max_external_file_meta_cache_bytes is > 0, the cache is evicted by memory size, or
+    // 2. max_external_file_meta_cache_num is > 0 and
+    //    the file number is less than 1/3 of cache's capacibility
     // Otherwise, the cache miss rate will be high
     bool _shoudl_enable_file_meta_cache() {
+        if (config::max_external_file_meta_cache_bytes > 0) {
+            return true;
+        }
         return config::max_external_file_meta_cache_num > 0 &&
                _split_source->num_scan_ranges() < config::max_external_file_meta_cache_num / 3;
     }
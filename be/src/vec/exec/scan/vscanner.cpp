@@ -69,6 +69,18 @@ Status VScanner::prepare(RuntimeState* state, const VExprContextSPtrs& conjuncts
         }
     }
 
+    if (!_local_state->_common_expr_results.empty()) {
+        _common_expr_results.resize(_local_state->_common_expr_results.size(), -1);
+        for (auto& projection : _projections) {
+            projection->set_common_expr_results(&_common_expr_results);
+        }
+        for (auto& projections : _intermediate_projections) {
+            for (auto& projection : projections) {
+                projection->set_common_expr_results(&_common_expr_results);
+            }
+        }
+    }
+
     return Status::OK();
 }
 
@@ -182,6 +194,7 @@ Status VScanner::_do_projections(vectorized::Block* origin_block, vectorized::Bl
 
     std::vector<int> result_column_ids;
     for (auto& projections : _intermediate_projections) {
+        std::fill(_common_expr_results.begin(), _common_expr_results.end(), -1);
         result_column_ids.resize(projections.size());
         for (int i = 0; i < projections.size(); i++) {
             RETURN_IF_ERROR(projections[i]->execute(&input_block, &result_column_ids[i]));
@@ -197,6 +210,8 @@ Status VScanner::_do_projections(vectorized::Block* origin_block, vectorized::Bl
 
     DCHECK_EQ(mutable_columns.size(), _projections.size());
 
+    std::fill(_common_expr_results.begin(), _common_expr_results.end(), -1);
+
     for (int i = 0; i < mutable_columns.size(); ++i) {
         auto result_column_id = -1;
         RETURN_IF_ERROR(_projections[i]->execute(&input_block, &result_column_id));
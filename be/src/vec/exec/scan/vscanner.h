@@ -123,7 +123,12 @@ public:
         _cpu_watch.start();
     }
 
-    void update_wait_worker_timer() { _scanner_wait_worker_timer += _watch.elapsed_time(); }
+    // Returns the time waited since start_wait_worker_timer().
+    int64_t update_wait_worker_timer() {
+        int64_t wait_time = _watch.elapsed_time();
+        _scanner_wait_worker_timer += wait_time;
+        return wait_time;
+    }
 
     int64_t get_scanner_wait_worker_timer() const { return _scanner_wait_worker_timer; }
 
@@ -200,6 +205,8 @@ protected:
     VExprContextSPtrs _projections;
     // Used in common subexpression elimination to compute intermediate results.
     std::vector<vectorized::VExprContextSPtrs> _intermediate_projections;
+    // The results of the VCommonExprs of the projections in the block being projected
+    std::vector<int> _common_expr_results;
     vectorized::Block _origin_block;
 
     VExprContextSPtrs _common_expr_ctxs_push_down;
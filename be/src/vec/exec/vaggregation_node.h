@@ -45,6 +45,7 @@
 #include "vec/common/arena.h"
 #include "vec/common/assert_cast.h"
 #include "vec/common/columns_hashing.h"
+#include "vec/common/hash_table/array_hash_map.h"
 #include "vec/common/hash_table/hash.h"
 #include "vec/common/hash_table/hash_map_context.h"
 #include "vec/common/hash_table/hash_map_context_creator.h"
@@ -84,16 +85,17 @@ namespace vectorized {
 using AggregatedDataWithoutKey = AggregateDataPtr;
 using AggregatedDataWithStringKey = PHHashMap<StringRef, AggregateDataPtr>;
 using AggregatedDataWithShortStringKey = StringHashMap<AggregateDataPtr>;
-using AggregatedDataWithUInt8Key = PHHashMap<UInt8, AggregateDataPtr>;
-using AggregatedDataWithUInt16Key = PHHashMap<UInt16, AggregateDataPtr>;
-using AggregatedDataWithUInt32Key = PHHashMap<UInt32, AggregateDataPtr, HashCRC32<UInt32>>;
+// the single key columns of a small range of values are aggregated in an array
+using AggregatedDataWithUInt8Key = ArrayHashMap<UInt8, AggregateDataPtr>;
+using AggregatedDataWithUInt16Key = ArrayHashMap<UInt16, AggregateDataPtr>;
+using AggregatedDataWithUInt32Key = ArrayHashMap<UInt32, AggregateDataPtr, HashCRC32<UInt32>>;
 using AggregatedDataWithUInt64Key = PHHashMap<UInt64, AggregateDataPtr, HashCRC32<UInt64>>;
 using AggregatedDataWithUInt128Key = PHHashMap<UInt128, AggregateDataPtr, HashCRC32<UInt128>>;
 using AggregatedDataWithUInt256Key = PHHashMap<UInt256, AggregateDataPtr, HashCRC32<UInt256>>;
 using AggregatedDataWithUInt136Key = PHHashMap<UInt136, AggregateDataPtr, HashCRC32<UInt136>>;
 
 using AggregatedDataWithUInt32KeyPhase2 =
-        PHHashMap<UInt32, AggregateDataPtr, HashMixWrapper<UInt32>>;
+        ArrayHashMap<UInt32, AggregateDataPtr, HashMixWrapper<UInt32>>;
 using AggregatedDataWithUInt64KeyPhase2 =
         PHHashMap<UInt64, AggregateDataPtr, HashMixWrapper<UInt64>>;
 using AggregatedDataWithUInt128KeyPhase2 =
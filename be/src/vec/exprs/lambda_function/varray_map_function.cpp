@@ -74,16 +74,13 @@ public:
 
         // used for save column array outside null map
         auto outside_null_map =
-                ColumnUInt8::create(block->get_by_position(arguments[0])
-                                            .column->convert_to_full_column_if_const()
-                                            ->size(),
-                                    0);
-        // offset column
-        MutableColumnPtr array_column_offset;
+                ColumnUInt8::create(block->get_by_position(arguments[0]).column->size(), 0);
         int nested_array_column_rows = 0;
         ColumnPtr first_array_offsets = nullptr;
 
-        //2. get the result column from executed expr, and the needed is nested column of array
+        //2. get the result column from executed expr, and the needed is nested column of array.
+        // The lambda is evaluated once over the nested columns of all the rows, and its result
+        // is nested again with the offsets of the first array, which are shared, not copied.
         Block lambda_block;
         for (int i = 0; i < arguments.size(); ++i) {
             const auto& array_column_type_name = block->get_by_position(arguments[i]);
@@ -115,9 +112,6 @@ public:
             if (i == 0) {
                 nested_array_column_rows = col_array.get_data_ptr()->size();
                 first_array_offsets = col_array.get_offsets_ptr();
-                auto& off_data = assert_cast<const ColumnArray::ColumnOffsets&>(
-                        col_array.get_offsets_column());
-                array_column_offset = off_data.clone_resized(col_array.get_offsets_column().size());
             } else {
                 // select array_map((x,y)->x+y,c_array1,[0,1,2,3]) from array_test2;
                 // c_array1: [0,1,2,3,4,5,6,7,8,9]
@@ -156,7 +150,7 @@ public:
         if (result_type->is_nullable()) {
             if (res_type->is_nullable()) {
                 result_arr = {ColumnNullable::create(
-                                      ColumnArray::create(res_col, std::move(array_column_offset)),
+                                      ColumnArray::create(res_col, first_array_offsets),
                                       std::move(outside_null_map)),
                               result_type, res_name};
             } else {
@@ -167,19 +161,19 @@ public:
                         ColumnNullable::create(
                                 ColumnArray::create(
                                         ColumnNullable::create(res_col, std::move(nested_null_map)),
-                                        std::move(array_column_offset)),
+                                        first_array_offsets),
                                 std::move(outside_null_map)),
                         result_type, res_name};
             }
         } else {
             if (res_type->is_nullable()) {
-                result_arr = {ColumnArray::create(res_col, std::move(array_column_offset)),
-                              result_type, res_name};
+                result_arr = {ColumnArray::create(res_col, first_array_offsets), result_type,
+                              res_name};
             } else {
                 auto nested_null_map = ColumnUInt8::create(res_col->size(), 0);
                 result_arr = {ColumnArray::create(
                                       ColumnNullable::create(res_col, std::move(nested_null_map)),
-                                      std::move(array_column_offset)),
+                                      first_array_offsets),
                               result_type, res_name};
             }
         }
@@ -23,17 +23,23 @@
 
 #include <algorithm>
 #include <memory>
+#include <numeric>
 #include <ostream>
 #include <vector>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "vec/aggregate_functions/aggregate_function.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_const.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/columns_number.h"
 #include "vec/core/block.h"
 #include "vec/core/column_numbers.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/core/columns_with_type_and_name.h"
 #include "vec/exprs/vexpr_context.h"
+#include "vec/exprs/vslot_ref.h"
 #include "vec/functions/simple_function_factory.h"
 
 namespace doris {
@@ -43,6 +49,51 @@ class RuntimeState;
 
 namespace doris::vectorized {
 
+namespace {
+
+// The exprs which cost about as much as selecting their results row by row
+bool is_cheap(const VExprSPtr& expr) {
+    switch (expr->node_type()) {
+    case TExprNodeType::SLOT_REF:
+    case TExprNodeType::CAST_EXPR:
+    case TExprNodeType::ARITHMETIC_EXPR:
+    case TExprNodeType::BINARY_PRED:
+    case TExprNodeType::COMPOUND_PRED:
+        break;
+    default:
+        if (!expr->is_literal()) {
+            return false;
+        }
+    }
+    return std::all_of(expr->children().begin(), expr->children().end(), is_cheap);
+}
+
+// Collects the block columns read by the slots of `expr`, returns false if it may read others
+bool collect_column_ids(const VExprSPtr& expr, std::vector<int>* column_ids) {
+    switch (expr->node_type()) {
+    case TExprNodeType::SLOT_REF:
+        column_ids->push_back(static_cast<const VSlotRef&>(*expr).column_id());
+        return true;
+    case TExprNodeType::COLUMN_REF:
+    case TExprNodeType::LAMBDA_FUNCTION_EXPR:
+    case TExprNodeType::LAMBDA_FUNCTION_CALL_EXPR:
+        return false;
+    default:
+        break;
+    }
+    if (expr->get_impl() != nullptr) {
+        return false;
+    }
+    for (const auto& child : expr->children()) {
+        if (!collect_column_ids(child, column_ids)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
 VCaseExpr::VCaseExpr(const TExprNode& node)
         : VExpr(node),
           _has_case_expr(node.case_expr.has_case_expr),
@@ -74,6 +125,22 @@ Status VCaseExpr::prepare(RuntimeState* state, const RowDescriptor& desc, VExprC
     }
 
     VExpr::register_function_context(state, context);
+
+    if (config::enable_case_when_short_circuit && !_has_case_expr) {
+        // the first WHEN is executed on all the rows anyway
+        _short_circuit = std::any_of(_children.begin() + 1, _children.end(),
+                                     [](const VExprSPtr& child) { return !is_cheap(child); });
+    }
+    if (_short_circuit) {
+        for (const auto& child : _children) {
+            std::vector<int> column_ids;
+            if (collect_column_ids(child, &column_ids)) {
+                _child_column_ids.emplace_back(std::move(column_ids));
+            } else {
+                _child_column_ids.emplace_back(std::nullopt);
+            }
+        }
+    }
     _prepare_finished = true;
     return Status::OK();
 }
@@ -103,6 +170,9 @@ Status VCaseExpr::execute(VExprContext* context, Block* block, int* result_colum
         return get_result_from_const(block, _expr_name, result_column_id);
     }
     DCHECK(_open_finished || _getting_const_col);
+    if (_short_circuit) {
+        return _execute_short_circuit(context, block, result_column_id);
+    }
     ColumnNumbers arguments(_children.size());
     for (int i = 0; i < _children.size(); i++) {
         int column_id = -1;
@@ -121,6 +191,108 @@ Status VCaseExpr::execute(VExprContext* context, Block* block, int* result_colum
     return Status::OK();
 }
 
+Status VCaseExpr::_execute_short_circuit(VExprContext* context, Block* block,
+                                         int* result_column_id) {
+    const size_t rows = block->rows();
+    const size_t num_whens = (_children.size() - _has_else_expr) / 2;
+    // the branch selected by each row, num_whens for the ELSE
+    std::vector<uint32_t> branches(rows, num_whens);
+    std::vector<ColumnPtr> branch_columns(num_whens + 1);
+
+    std::vector<uint32_t> unmatched_rows(rows);
+    std::iota(unmatched_rows.begin(), unmatched_rows.end(), 0);
+    std::vector<uint32_t> matched_rows;
+    std::vector<uint32_t> still_unmatched_rows;
+    for (size_t i = 0; i < num_whens && !unmatched_rows.empty(); ++i) {
+        ColumnPtr when_column;
+        RETURN_IF_ERROR(_execute_on_rows(context, block, 2 * i, unmatched_rows, &when_column));
+        const NullMap* null_map = nullptr;
+        const IColumn* when_data_column = when_column.get();
+        if (const auto* nullable = check_and_get_column<ColumnNullable>(*when_column)) {
+            null_map = &nullable->get_null_map_data();
+            when_data_column = &nullable->get_nested_column();
+        }
+        const auto& when_data = assert_cast<const ColumnUInt8&>(*when_data_column).get_data();
+
+        matched_rows.clear();
+        still_unmatched_rows.clear();
+        for (size_t j = 0; j < unmatched_rows.size(); ++j) {
+            if (when_data[j] && (null_map == nullptr || !(*null_map)[j])) {
+                matched_rows.push_back(unmatched_rows[j]);
+                branches[unmatched_rows[j]] = i;
+            } else {
+                still_unmatched_rows.push_back(unmatched_rows[j]);
+            }
+        }
+        if (!matched_rows.empty()) {
+            RETURN_IF_ERROR(
+                    _execute_on_rows(context, block, 2 * i + 1, matched_rows, &branch_columns[i]));
+        }
+        unmatched_rows.swap(still_unmatched_rows);
+    }
+    if (_has_else_expr && !unmatched_rows.empty()) {
+        RETURN_IF_ERROR(_execute_on_rows(context, block, _children.size() - 1, unmatched_rows,
+                                         &branch_columns[num_whens]));
+    }
+
+    for (auto& column : branch_columns) {
+        if (column != nullptr && _data_type->is_nullable()) {
+            column = make_nullable(column);
+        }
+    }
+    auto result_column = _data_type->create_column();
+    result_column->reserve(rows);
+    std::vector<size_t> branch_rows(num_whens + 1, 0);
+    for (size_t row = 0; row < rows; ++row) {
+        uint32_t branch = branches[row];
+        if (branch_columns[branch] != nullptr) {
+            result_column->insert_from(*branch_columns[branch], branch_rows[branch]++);
+        } else {
+            // no ELSE, the result is nullable
+            result_column->insert_default();
+        }
+    }
+    *result_column_id = block->columns();
+    block->insert({std::move(result_column), _data_type, _expr_name});
+    return Status::OK();
+}
+
+Status VCaseExpr::_execute_on_rows(VExprContext* context, Block* block, int child_idx,
+                                   const std::vector<uint32_t>& selected, ColumnPtr* result) {
+    int column_id = -1;
+    if (selected.size() == block->rows()) {
+        RETURN_IF_ERROR(_children[child_idx]->execute(context, block, &column_id));
+        *result = block->get_by_position(column_id).column->convert_to_full_column_if_const();
+        return Status::OK();
+    }
+
+    IColumn::Filter filter(block->rows(), 0);
+    for (uint32_t row : selected) {
+        filter[row] = 1;
+    }
+    const auto& column_ids = _child_column_ids[child_idx];
+    Block sub_block;
+    for (int i = 0; i < block->columns(); ++i) {
+        const auto& column = block->get_by_position(i);
+        ColumnPtr sub_column;
+        if (column.column == nullptr) {
+            sub_column = nullptr;
+        } else if (!column_ids.has_value() ||
+                   std::find(column_ids->begin(), column_ids->end(), i) != column_ids->end()) {
+            sub_column = column.column->filter(filter, selected.size());
+        } else if (is_column_const(*column.column)) {
+            sub_column = column.column->clone_resized(selected.size());
+        } else {
+            // the columns not read only keep the positions and the rows of the block
+            sub_column = ColumnConst::create(column.column->clone_resized(1), selected.size());
+        }
+        sub_block.insert({std::move(sub_column), column.type, column.name});
+    }
+    RETURN_IF_ERROR(_children[child_idx]->execute(context, &sub_block, &column_id));
+    *result = sub_block.get_by_position(column_id).column->convert_to_full_column_if_const();
+    return Status::OK();
+}
+
 const std::string& VCaseExpr::expr_name() const {
     return _expr_name;
 }
@@ -17,11 +17,14 @@
 
 #pragma once
 
+#include <optional>
 #include <string>
+#include <vector>
 
 #include "common/object_pool.h"
 #include "common/status.h"
 #include "udf/udf.h"
+#include "vec/columns/column.h"
 #include "vec/exprs/vexpr.h"
 #include "vec/functions/function.h"
 
@@ -52,8 +55,21 @@ public:
     std::string debug_string() const override;
 
 private:
+    // Executes each WHEN on the rows not matched by the previous ones, and each THEN and the
+    // ELSE on the rows which select it, instead of executing all the children on the whole
+    // block, for the expensive branches.
+    Status _execute_short_circuit(VExprContext* context, Block* block, int* result_column_id);
+
+    // Executes the child `child_idx` on the rows of `block` in `selected`, which are all the
+    // rows if the size of `selected` is the rows of the block.
+    Status _execute_on_rows(VExprContext* context, Block* block, int child_idx,
+                            const std::vector<uint32_t>& selected, ColumnPtr* result);
+
     bool _has_case_expr;
     bool _has_else_expr;
+    bool _short_circuit = false;
+    // The block columns read by each child, nullopt if it may read other columns than slots.
+    std::vector<std::optional<std::vector<int>>> _child_column_ids;
 
     FunctionBasePtr _function;
     std::string _function_name = "case";
@@ -0,0 +1,247 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exprs/vcommon_expr.h"
+
+#include <gen_cpp/Exprs_types.h>
+#include <gen_cpp/Types_types.h>
+#include <glog/logging.h>
+
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "util/hash_util.hpp"
+#include "vec/exprs/vexpr_context.h"
+#include "vec/exprs/vliteral.h"
+#include "vec/exprs/vslot_ref.h"
+
+namespace doris::vectorized {
+
+namespace {
+
+bool is_deterministic_builtin(const TFunction& fn) {
+    static const std::unordered_set<std::string> NON_DETERMINISTIC_FUNCTIONS {
+            "rand", "random", "random_bytes", "uuid", "uuid_numeric", "sleep"};
+    return fn.binary_type == TFunctionBinaryType::BUILTIN &&
+           !NON_DETERMINISTIC_FUNCTIONS.contains(fn.name.function_name);
+}
+
+// The kinds of exprs which may be shared, a literal or slot is cheaper to execute again
+bool can_share(const VExpr& expr) {
+    switch (expr.node_type()) {
+    case TExprNodeType::ARITHMETIC_EXPR:
+    case TExprNodeType::BINARY_PRED:
+    case TExprNodeType::FUNCTION_CALL:
+    case TExprNodeType::COMPUTE_FUNCTION_CALL:
+        return is_deterministic_builtin(expr.fn());
+    case TExprNodeType::CAST_EXPR:
+        return true;
+    default:
+        return false;
+    }
+}
+
+const VLiteral* as_literal(const VExpr& expr) {
+    return expr.is_literal() ? dynamic_cast<const VLiteral*>(&expr) : nullptr;
+}
+
+bool structurally_equal(VExpr& lhs, VExpr& rhs) {
+    if (lhs.node_type() != rhs.node_type() || lhs.op() != rhs.op() || !(lhs.fn() == rhs.fn()) ||
+        !(lhs.type() == rhs.type()) || lhs.is_nullable() != rhs.is_nullable() ||
+        lhs.get_num_children() != rhs.get_num_children()) {
+        return false;
+    }
+    if (lhs.is_slot_ref()) {
+        return static_cast<const VSlotRef&>(lhs).slot_id() ==
+               static_cast<const VSlotRef&>(rhs).slot_id();
+    }
+    if (const auto* lhs_literal = as_literal(lhs)) {
+        const auto* rhs_literal = as_literal(rhs);
+        return rhs_literal != nullptr &&
+               lhs_literal->get_column_ptr()->compare_at(0, 0, *rhs_literal->get_column_ptr(),
+                                                         1) == 0;
+    }
+    for (int i = 0; i < lhs.get_num_children(); ++i) {
+        if (!structurally_equal(*lhs.get_child(i), *rhs.get_child(i))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// The exprs whose children may be executed on other blocks than the one of the expr, e.g. the
+// lambda of array_map on the elements, or the branches of CASE on the rows selecting them,
+// can not share results with the others
+bool is_executed_on_own_block(const VExpr& expr) {
+    return expr.node_type() == TExprNodeType::LAMBDA_FUNCTION_CALL_EXPR ||
+           expr.node_type() == TExprNodeType::LAMBDA_FUNCTION_EXPR ||
+           expr.node_type() == TExprNodeType::CASE_EXPR;
+}
+
+class CommonExprFinder {
+public:
+    // Returns whether the subtree of `expr` is made of the shared kinds, slots and literals,
+    // and contains a slot, and sets its structural hash.
+    bool visit(const VExprSPtr& expr, size_t* hash) {
+        *hash = 0;
+        HashUtil::hash_combine(*hash, static_cast<int>(expr->node_type()));
+        HashUtil::hash_combine(*hash, static_cast<int>(expr->type().type));
+        if (expr->is_slot_ref()) {
+            HashUtil::hash_combine(*hash, static_cast<const VSlotRef&>(*expr).slot_id());
+            _has_slot = true;
+            return true;
+        }
+        if (as_literal(*expr) != nullptr) {
+            return true;
+        }
+        if (expr->get_impl() != nullptr || is_executed_on_own_block(*expr)) {
+            return false;
+        }
+        HashUtil::hash_combine(*hash, expr->fn().name.function_name);
+        bool res = can_share(*expr);
+        bool had_slot = _has_slot;
+        _has_slot = false;
+        for (const auto& child : expr->children()) {
+            size_t child_hash = 0;
+            res &= visit(child, &child_hash);
+            HashUtil::hash_combine(*hash, child_hash);
+        }
+        // a subtree without slot is constant, which is executed only once anyway
+        if (res && _has_slot) {
+            _add_candidate(expr.get(), *hash);
+        }
+        _has_slot |= had_slot;
+        return res;
+    }
+
+    // Numbers the classes of identical subtrees with several occurrences
+    std::unordered_map<const VExpr*, int> common_expr_ids(int* num_common_exprs) const {
+        std::unordered_map<const VExpr*, int> ids;
+        for (const auto& [_, classes] : _classes) {
+            for (const auto& exprs : classes) {
+                if (exprs.size() < 2) {
+                    continue;
+                }
+                int id = (*num_common_exprs)++;
+                for (const auto* expr : exprs) {
+                    ids[expr] = id;
+                }
+            }
+        }
+        return ids;
+    }
+
+private:
+    void _add_candidate(VExpr* expr, size_t hash) {
+        auto& classes = _classes[hash];
+        for (auto& exprs : classes) {
+            if (structurally_equal(*exprs.front(), *expr)) {
+                exprs.push_back(expr);
+                return;
+            }
+        }
+        classes.push_back({expr});
+    }
+
+    bool _has_slot = false;
+    std::unordered_map<size_t, std::vector<std::vector<VExpr*>>> _classes;
+};
+
+} // namespace
+
+VCommonExpr::VCommonExpr(const VExprSPtr& impl, int common_expr_id)
+        : VExpr(*impl), _impl(impl), _common_expr_id(common_expr_id) {}
+
+Status VCommonExpr::prepare(RuntimeState* state, const RowDescriptor& desc,
+                            VExprContext* context) {
+    RETURN_IF_ERROR_OR_PREPARED(_impl->prepare(state, desc, context));
+    _data_type = _impl->data_type();
+    _expr_name = "VCommonExpr(" + _impl->expr_name() + ")";
+    _prepare_finished = true;
+    return Status::OK();
+}
+
+Status VCommonExpr::open(RuntimeState* state, VExprContext* context,
+                         FunctionContext::FunctionStateScope scope) {
+    DCHECK(_prepare_finished);
+    RETURN_IF_ERROR(_impl->open(state, context, scope));
+    _open_finished = true;
+    return Status::OK();
+}
+
+void VCommonExpr::close(VExprContext* context, FunctionContext::FunctionStateScope scope) {
+    _impl->close(context, scope);
+}
+
+Status VCommonExpr::execute(VExprContext* context, Block* block, int* result_column_id) {
+    std::vector<int>* results = context->common_expr_results();
+    if (results == nullptr) {
+        return _impl->execute(context, block, result_column_id);
+    }
+    DCHECK_LT(_common_expr_id, results->size());
+    int& result = (*results)[_common_expr_id];
+    if (result < 0) {
+        RETURN_IF_ERROR(_impl->execute(context, block, result_column_id));
+        result = *result_column_id;
+    } else {
+        DCHECK_LT(result, block->columns());
+        *result_column_id = result;
+    }
+    return Status::OK();
+}
+
+void VCommonExpr::rewrite(const VExprContextSPtrs& ctxs, int* num_common_exprs) {
+    CommonExprFinder finder;
+    for (const auto& ctx : ctxs) {
+        size_t hash = 0;
+        static_cast<void>(finder.visit(ctx->root(), &hash));
+    }
+    auto ids = finder.common_expr_ids(num_common_exprs);
+    if (ids.empty()) {
+        return;
+    }
+    std::function<void(const VExprSPtr&)> wrap_children = [&](const VExprSPtr& expr) {
+        if (expr->get_impl() != nullptr || is_executed_on_own_block(*expr)) {
+            return;
+        }
+        VExprSPtrs children = expr->children();
+        bool wrapped = false;
+        for (auto& child : children) {
+            wrap_children(child);
+            if (auto it = ids.find(child.get()); it != ids.end()) {
+                child = VCommonExpr::create_shared(child, it->second);
+                wrapped = true;
+            }
+        }
+        if (wrapped) {
+            expr->set_children(std::move(children));
+        }
+    };
+    for (const auto& ctx : ctxs) {
+        VExprSPtr root = ctx->root();
+        wrap_children(root);
+        if (auto it = ids.find(root.get()); it != ids.end()) {
+            ctx->set_root(VCommonExpr::create_shared(root, it->second));
+        }
+    }
+}
+
+} // namespace doris::vectorized
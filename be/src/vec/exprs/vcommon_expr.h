@@ -0,0 +1,75 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <string>
+
+#include "common/status.h"
+#include "udf/udf.h"
+#include "vec/exprs/vexpr.h"
+#include "vec/exprs/vexpr_fwd.h"
+
+namespace doris {
+class RowDescriptor;
+class RuntimeState;
+
+namespace vectorized {
+class Block;
+class VExprContext;
+} // namespace vectorized
+} // namespace doris
+
+namespace doris::vectorized {
+
+// Wraps each occurrence of a subtree which appears several times in the exprs evaluated
+// together on one block, e.g. the projections of an operator. The first occurrence executed
+// on the block executes the subtree and records its result column in the common expr results
+// of the context, the others reuse the column. Without the results, e.g. in the contexts which
+// are not executed per block, the subtree is executed as is.
+class VCommonExpr final : public VExpr {
+    ENABLE_FACTORY_CREATOR(VCommonExpr);
+
+public:
+    VCommonExpr(const VExprSPtr& impl, int common_expr_id);
+    ~VCommonExpr() override = default;
+
+    Status execute(VExprContext* context, Block* block, int* result_column_id) override;
+    Status prepare(RuntimeState* state, const RowDescriptor& desc, VExprContext* context) override;
+    Status open(RuntimeState* state, VExprContext* context,
+                FunctionContext::FunctionStateScope scope) override;
+    void close(VExprContext* context, FunctionContext::FunctionStateScope scope) override;
+    const std::string& expr_name() const override { return _expr_name; }
+    std::string debug_string() const override { return _impl->debug_string(); }
+    const VExprSPtrs& children() const override { return _impl->children(); }
+    bool is_constant() const override { return _impl->is_constant(); }
+
+    int common_expr_id() const { return _common_expr_id; }
+
+    // Wraps the identical subtrees of the exprs of `ctxs`, which must not be prepared yet.
+    // Only the subtrees of builtin deterministic function calls and casts over slots and
+    // literals are considered. The wrappers are numbered from `*num_common_exprs`, which is
+    // increased by the number of distinct subtrees wrapped.
+    static void rewrite(const VExprContextSPtrs& ctxs, int* num_common_exprs);
+
+private:
+    VExprSPtr _impl;
+    const int _common_expr_id;
+    std::string _expr_name;
+};
+
+} // namespace doris::vectorized
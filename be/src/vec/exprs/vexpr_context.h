@@ -132,6 +132,12 @@ public:
 
     void set_force_materialize_slot() { _force_materialize_slot = true; }
 
+    // The result columns of the VCommonExprs in the block being executed, indexed by their
+    // common expr ids, or -1 if not executed yet. Shared by the contexts executed together on
+    // one block, which reset the results before each block.
+    std::vector<int>* common_expr_results() const { return _common_expr_results; }
+    void set_common_expr_results(std::vector<int>* results) { _common_expr_results = results; }
+
     VExprContext& operator=(const VExprContext& other) {
         if (this == &other) {
             return *this;
@@ -191,5 +197,7 @@ private:
     // This flag only works on VSlotRef.
     // Force to materialize even if the slot need_materialize is false, we just ignore need_materialize flag
     bool _force_materialize_slot = false;
+
+    std::vector<int>* _common_expr_results = nullptr;
 };
 } // namespace doris::vectorized
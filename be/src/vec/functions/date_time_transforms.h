@@ -317,10 +317,25 @@ struct Transformer {
         vec_to.resize(size);
         null_map.resize(size);
 
-        for (size_t i = 0; i < size; ++i) {
-            vec_to[i] = Transform::execute(vec_from[i]);
-            null_map[i] = !((typename DateTraits<typename Transform::OpArgType>::T&)(vec_from[i]))
-                                   .is_valid_date();
+        using OpArgType = typename Transform::OpArgType;
+        if constexpr (std::is_same_v<OpArgType, UInt32> || std::is_same_v<OpArgType, UInt64>) {
+            // check the packed DateV2 and DateTimeV2 values in a separated loop without branch
+            auto* __restrict to_ptr = vec_to.data();
+            auto* __restrict from_ptr = vec_from.data();
+            auto* __restrict null_map_ptr = null_map.data();
+
+            for (size_t i = 0; i < size; ++i) {
+                to_ptr[i] = Transform::execute(from_ptr[i]);
+            }
+
+            for (size_t i = 0; i < size; ++i) {
+                null_map_ptr[i] = !PackedDateV2<OpArgType>::is_valid(from_ptr[i]);
+            }
+        } else {
+            for (size_t i = 0; i < size; ++i) {
+                vec_to[i] = Transform::execute(vec_from[i]);
+                null_map[i] = !((typename DateTraits<OpArgType>::T&)(vec_from[i])).is_valid_date();
+            }
         }
     }
 
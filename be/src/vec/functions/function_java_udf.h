@@ -26,6 +26,8 @@
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <string>
+#include <utility>
 
 #include "common/logging.h"
 #include "common/status.h"
@@ -121,6 +123,11 @@ private:
         jmethodID executor_evaluate_id;
         jmethodID executor_close_id;
         jobject executor = nullptr;
+        // the schemas of the blocks of the columns at arguments and result
+        ColumnNumbers arguments;
+        size_t result = 0;
+        std::pair<std::string, std::string> input_table_schema;
+        jobject output_map = nullptr;
         bool is_closed = false;
         bool open_successes = false;
 
@@ -144,6 +151,9 @@ private:
             env->CallNonvirtualVoidMethodA(executor, executor_cl, executor_close_id, nullptr);
             env->DeleteGlobalRef(executor);
             env->DeleteGlobalRef(executor_cl);
+            if (output_map != nullptr) {
+                env->DeleteGlobalRef(output_map);
+            }
             RETURN_IF_ERROR(JniUtil::GetJniExceptionMsg(env));
             is_closed = true;
             return Status::OK();
@@ -224,16 +224,13 @@ rapidjson::Value* match_value(const std::vector<JsonPath>& parsed_paths, rapidjs
     return root;
 }
 
-template <JsonFunctionType fntype>
-rapidjson::Value* get_json_object(std::string_view json_string, std::string_view path_string,
-                                  rapidjson::Document* document) {
-    std::vector<JsonPath>* parsed_paths;
-    std::vector<JsonPath> tmp_parsed_paths;
-
+// Parse the path of get_json_xxx, a path ending with '\' has an invalid first path and matches
+// nothing.
+void parse_json_path(std::string_view path_string, std::vector<JsonPath>* parsed_paths) {
     //Cannot use '\' as the last character, return NULL
-    if (path_string.back() == '\\') {
-        document->SetNull();
-        return document;
+    if (!path_string.empty() && path_string.back() == '\\') {
+        parsed_paths->emplace_back("", -1, false);
+        return;
     }
 
 #ifdef USE_LIBCPP
@@ -244,18 +241,19 @@ rapidjson::Value* get_json_object(std::string_view json_string, std::string_view
 #endif
 
     std::vector<std::string> paths(tok.begin(), tok.end());
-    get_parsed_paths(paths, &tmp_parsed_paths);
-    if (tmp_parsed_paths.empty()) {
-        return document;
-    }
-
-    parsed_paths = &tmp_parsed_paths;
+    get_parsed_paths(paths, parsed_paths);
+}
 
-    if (!(*parsed_paths)[0].is_valid) {
+template <JsonFunctionType fntype>
+rapidjson::Value* get_json_object(std::string_view json_string,
+                                  const std::vector<JsonPath>& parsed_paths,
+                                  rapidjson::Document* document) {
+    if (parsed_paths.empty() || !parsed_paths[0].is_valid) {
+        document->SetNull();
         return document;
     }
 
-    if (UNLIKELY((*parsed_paths).size() == 1)) {
+    if (UNLIKELY(parsed_paths.size() == 1)) {
         if (fntype == JSON_FUN_STRING) {
             document->SetString(json_string.data(), json_string.size(), document->GetAllocator());
         } else {
@@ -271,7 +269,15 @@ rapidjson::Value* get_json_object(std::string_view json_string, std::string_view
         return document;
     }
 
-    return match_value(*parsed_paths, document, document->GetAllocator());
+    return match_value(parsed_paths, document, document->GetAllocator());
+}
+
+template <JsonFunctionType fntype>
+rapidjson::Value* get_json_object(std::string_view json_string, std::string_view path_string,
+                                  rapidjson::Document* document) {
+    std::vector<JsonPath> parsed_paths;
+    parse_json_path(path_string, &parsed_paths);
+    return get_json_object<fntype>(json_string, parsed_paths, document);
 }
 
 template <typename NumberType>
@@ -285,16 +291,17 @@ struct GetJsonNumberType {
     }
 
     static void get_json_impl(rapidjson::Value*& root, const std::string_view& json_string,
-                              const std::string_view& path_string, rapidjson::Document& document,
-                              typename NumberType::T& res, UInt8& null_map) {
+                              const std::vector<JsonPath>& parsed_paths,
+                              rapidjson::Document& document, typename NumberType::T& res,
+                              UInt8& null_map) {
         if constexpr (std::is_same_v<double, typename NumberType::T>) {
-            root = get_json_object<JSON_FUN_DOUBLE>(json_string, path_string, &document);
+            root = get_json_object<JSON_FUN_DOUBLE>(json_string, parsed_paths, &document);
             handle_result<double>(root, res, null_map);
         } else if constexpr (std::is_same_v<int32_t, typename NumberType::T>) {
-            root = get_json_object<JSON_FUN_DOUBLE>(json_string, path_string, &document);
+            root = get_json_object<JSON_FUN_DOUBLE>(json_string, parsed_paths, &document);
             handle_result<int32_t>(root, res, null_map);
         } else if constexpr (std::is_same_v<int64_t, typename NumberType::T>) {
-            root = get_json_object<JSON_FUN_DOUBLE>(json_string, path_string, &document);
+            root = get_json_object<JSON_FUN_DOUBLE>(json_string, parsed_paths, &document);
             handle_result<int64_t>(root, res, null_map);
         }
     }
@@ -316,11 +323,12 @@ struct GetJsonNumberType {
             }
 
             std::string_view json_string(l_raw_str, l_str_size);
-            std::string_view path_string(r_raw_str, r_str_size);
+            std::vector<JsonPath> parsed_paths;
+            parse_json_path(std::string_view(r_raw_str, r_str_size), &parsed_paths);
             rapidjson::Document document;
             rapidjson::Value* root = nullptr;
 
-            get_json_impl(root, json_string, path_string, document, res[i], null_map[i]);
+            get_json_impl(root, json_string, parsed_paths, document, res[i], null_map[i]);
         }
     }
     static void vector_scalar(FunctionContext* context, const ColumnString::Chars& ldata,
@@ -328,7 +336,9 @@ struct GetJsonNumberType {
                               Container& res, NullMap& null_map) {
         size_t size = loffsets.size();
         res.resize(size);
-        std::string_view path_string(rdata.data, rdata.size);
+        // the constant path is parsed once for all the rows
+        std::vector<JsonPath> parsed_paths;
+        parse_json_path(std::string_view(rdata.data, rdata.size), &parsed_paths);
         for (size_t i = 0; i < size; ++i) {
             const char* l_raw_str = reinterpret_cast<const char*>(&ldata[loffsets[i - 1]]);
             int l_str_size = loffsets[i] - loffsets[i - 1];
@@ -341,7 +351,7 @@ struct GetJsonNumberType {
             rapidjson::Document document;
             rapidjson::Value* root = nullptr;
 
-            get_json_impl(root, json_string, path_string, document, res[i], null_map[i]);
+            get_json_impl(root, json_string, parsed_paths, document, res[i], null_map[i]);
         }
     }
     static void scalar_vector(FunctionContext* context, const StringRef& ldata,
@@ -358,11 +368,12 @@ struct GetJsonNumberType {
                 res[i] = 0;
                 continue;
             }
-            std::string_view path_string(r_raw_str, r_str_size);
+            std::vector<JsonPath> parsed_paths;
+            parse_json_path(std::string_view(r_raw_str, r_str_size), &parsed_paths);
             rapidjson::Document document;
             rapidjson::Value* root = nullptr;
 
-            get_json_impl(root, json_string, path_string, document, res[i], null_map[i]);
+            get_json_impl(root, json_string, parsed_paths, document, res[i], null_map[i]);
         }
     }
 
@@ -464,9 +475,10 @@ struct GetJsonString {
             const auto r_raw = reinterpret_cast<const char*>(&rdata[roffsets[i - 1]]);
 
             std::string_view json_string(l_raw, l_size);
-            std::string_view path_string(r_raw, r_size);
+            std::vector<JsonPath> parsed_paths;
+            parse_json_path(std::string_view(r_raw, r_size), &parsed_paths);
 
-            execute_impl(json_string, path_string, res_data, res_offsets, null_map, i);
+            execute_impl(json_string, parsed_paths, res_data, res_offsets, null_map, i);
         }
     }
     static void vector_scalar(FunctionContext* context, const Chars& ldata, const Offsets& loffsets,
@@ -475,6 +487,9 @@ struct GetJsonString {
         size_t input_rows_count = loffsets.size();
         res_offsets.resize(input_rows_count);
 
+        // the constant path is parsed once for all the rows
+        std::vector<JsonPath> parsed_paths;
+        parse_json_path(std::string_view(rdata.data, rdata.size), &parsed_paths);
         for (size_t i = 0; i < input_rows_count; ++i) {
             if (null_map[i]) {
                 StringOP::push_null_string(i, res_data, res_offsets, null_map);
@@ -484,9 +499,8 @@ struct GetJsonString {
             const auto l_raw = reinterpret_cast<const char*>(&ldata[loffsets[i - 1]]);
 
             std::string_view json_string(l_raw, l_size);
-            std::string_view path_string(rdata.data, rdata.size);
 
-            execute_impl(json_string, path_string, res_data, res_offsets, null_map, i);
+            execute_impl(json_string, parsed_paths, res_data, res_offsets, null_map, i);
         }
     }
     static void scalar_vector(FunctionContext* context, const StringRef& ldata, const Chars& rdata,
@@ -504,19 +518,20 @@ struct GetJsonString {
             const auto r_raw = reinterpret_cast<const char*>(&rdata[roffsets[i - 1]]);
 
             std::string_view json_string(ldata.data, ldata.size);
-            std::string_view path_string(r_raw, r_size);
+            std::vector<JsonPath> parsed_paths;
+            parse_json_path(std::string_view(r_raw, r_size), &parsed_paths);
 
-            execute_impl(json_string, path_string, res_data, res_offsets, null_map, i);
+            execute_impl(json_string, parsed_paths, res_data, res_offsets, null_map, i);
         }
     }
 
     static void execute_impl(const std::string_view& json_string,
-                             const std::string_view& path_string, Chars& res_data,
+                             const std::vector<JsonPath>& parsed_paths, Chars& res_data,
                              Offsets& res_offsets, NullMap& null_map, size_t index_now) {
         rapidjson::Document document;
         rapidjson::Value* root = nullptr;
 
-        root = get_json_object<JSON_FUN_STRING>(json_string, path_string, &document);
+        root = get_json_object<JSON_FUN_STRING>(json_string, parsed_paths, &document);
         const int max_string_len = DEFAULT_MAX_JSON_SIZE;
 
         if (root == nullptr || root->IsNull()) {
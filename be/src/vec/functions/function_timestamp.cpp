@@ -477,10 +477,21 @@ private:
                                          NullMap& null_map, size_t input_rows_count) {
         auto& data = static_cast<const ColumnType*>(datetime_column.get())->get_data();
         auto& res = static_cast<ColumnType*>(result_column->assume_mutable().get())->get_data();
-        for (size_t i = 0; i < input_rows_count; ++i) {
-            auto dt = binary_cast<ArgType, DateValueType>(data[i]);
-            null_map[i] = !dt.template datetime_trunc<Unit>();
-            res[i] = binary_cast<DateValueType, ArgType>(dt);
+        if constexpr (!date_cast::IsV1<DateType>() && Unit != TimeUnit::WEEK) {
+            // truncate the packed values of the whole column without branch, the invalid
+            // values are kept like datetime_trunc does
+            using PackedType = PackedDateV2<ArgType>;
+            for (size_t i = 0; i < input_rows_count; ++i) {
+                bool valid = PackedType::is_valid(data[i]);
+                null_map[i] = !valid;
+                res[i] = valid ? PackedType::template trunc<Unit>(data[i]) : data[i];
+            }
+        } else {
+            for (size_t i = 0; i < input_rows_count; ++i) {
+                auto dt = binary_cast<ArgType, DateValueType>(data[i]);
+                null_map[i] = !dt.template datetime_trunc<Unit>();
+                res[i] = binary_cast<DateValueType, ArgType>(dt);
+            }
         }
     }
 };
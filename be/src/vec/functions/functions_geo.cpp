@@ -586,12 +586,25 @@ struct StContains {
 
     static void const_vector(const ColumnPtr& left_column, const ColumnPtr& right_column,
                              MutableColumnPtr& res, const size_t size) {
-        int i;
+        // The constant shape is decoded once, and its cell covering rejects most of the points
+        // out of it before the exact check, e.g. of a geofence against a column of points.
         auto lhs_value = left_column->get_data_at(0);
-        std::vector<std::shared_ptr<GeoShape>> shapes = {nullptr, nullptr};
+        auto lhs_shape = GeoShape::from_encoded(lhs_value.data, lhs_value.size);
+        if (lhs_shape == nullptr) {
+            res->insert_many_defaults(size);
+            return;
+        }
+        lhs_shape->build_covering();
         for (int row = 0; row < size; ++row) {
             auto rhs_value = right_column->get_data_at(row);
-            loop_do(lhs_value, rhs_value, shapes, i, res);
+            auto rhs_shape = GeoShape::from_encoded(rhs_value.data, rhs_value.size);
+            if (rhs_shape == nullptr) {
+                res->insert_default();
+                continue;
+            }
+            auto contains_value = lhs_shape->may_contain(rhs_shape.get()) &&
+                                  lhs_shape->contains(rhs_shape.get());
+            res->insert_data(const_cast<const char*>((char*)&contains_value), 0);
         }
     }
 
@@ -59,6 +59,8 @@ static const re2::RE2 LIKE_ENDS_WITH_RE("(?:%+)(((\\\\_)|([^%_]))+)");
 static const re2::RE2 LIKE_STARTS_WITH_RE(R"((((\\%)|(\\_)|([^%_\\]))+)(?:%+))");
 static const re2::RE2 LIKE_EQUALS_RE("(((\\\\_)|([^%_]))+)");
 static const re2::RE2 LIKE_ALLPASS_RE("%+");
+// A like pattern of at least two constant strings separated by '%', e.g. '%a%b%'
+static const re2::RE2 LIKE_SUBSTRINGS_RE(R"((?:%+[^%_\\]+){2,}%+)");
 
 struct VectorAllpassSearchState : public VectorPatternSearchState {
     VectorAllpassSearchState() : VectorPatternSearchState(FunctionLikeBase::vector_allpass_fn) {}
@@ -187,6 +189,7 @@ struct VectorEndsWithSearchState : public VectorPatternSearchState {
 Status LikeSearchState::clone(LikeSearchState& cloned) {
     cloned.escape_char = escape_char;
     cloned.set_search_string(search_string);
+    cloned.set_search_substrings(search_substrings);
 
     std::string re_pattern;
     FunctionLike::convert_like_pattern(this, pattern_str, &re_pattern);
@@ -381,6 +384,65 @@ Status FunctionLikeBase::vector_substring_fn(const ColumnString& vals,
     return Status::OK();
 }
 
+// Whether the substrings from the index-th one are found in order and without overlapping in
+// [pos, end), the leftmost match of each leaves the most room for the others.
+static bool match_substrings(const LikeSearchState* state, size_t index, const char* pos,
+                             const char* end) {
+    for (size_t i = index; i < state->substring_searchers.size(); ++i) {
+        const char* found = state->substring_searchers[i]->search(pos, end);
+        size_t substring_size = state->search_substrings[i].size();
+        if (found == end || found + substring_size > end) {
+            return false;
+        }
+        pos = found + substring_size;
+    }
+    return true;
+}
+
+Status FunctionLikeBase::constant_substrings_fn(LikeSearchState* state, const ColumnString& val,
+                                                const StringRef& pattern,
+                                                ColumnUInt8::Container& result) {
+    size_t sz = val.size();
+    if (sz == 0) {
+        return Status::OK();
+    }
+    // search the first substring in all strings at once like execute_substring, and the others
+    // only in the string the first one is found in
+    const auto& offsets = val.get_offsets();
+    const char* begin = reinterpret_cast<const char*>(val.get_chars().data());
+    const char* end = begin + offsets[sz - 1];
+    const auto& first_searcher = state->substring_searchers[0];
+    size_t first_size = state->search_substrings[0].size();
+
+    const char* pos = begin;
+    size_t i = 0;
+    while (pos < end) {
+        pos = first_searcher->search(pos, end);
+        if (pos >= end) {
+            break;
+        }
+        while (begin + offsets[i] <= pos) {
+            ++i;
+        }
+        const char* str_end = begin + offsets[i];
+        // the match may pass through the boundary of the string
+        if (pos + first_size <= str_end) {
+            result[i] = match_substrings(state, 1, pos + first_size, str_end);
+        }
+        pos = str_end;
+        ++i;
+    }
+    return Status::OK();
+}
+
+Status FunctionLikeBase::constant_substrings_fn_scalar(LikeSearchState* state,
+                                                       const StringRef& val,
+                                                       const StringRef& pattern,
+                                                       unsigned char* result) {
+    *result = match_substrings(state, 0, val.data, val.data + val.size);
+    return Status::OK();
+}
+
 Status FunctionLikeBase::constant_regex_fn_scalar(LikeSearchState* state, const StringRef& val,
                                                   const StringRef& pattern, unsigned char* result) {
     if (state->hs_database) { // use hyperscan
@@ -784,6 +846,21 @@ void FunctionLike::remove_escape_character(std::string* search_string) {
     }
 }
 
+void FunctionLike::split_like_substrings(const std::string& pattern,
+                                         std::vector<std::string>* substrings) {
+    size_t pos = 0;
+    while (pos < pattern.size()) {
+        size_t next = pattern.find('%', pos);
+        if (next == std::string::npos) {
+            next = pattern.size();
+        }
+        if (next > pos) {
+            substrings->emplace_back(pattern, pos, next - pos);
+        }
+        pos = next + 1;
+    }
+}
+
 bool re2_full_match(const std::string& str, const RE2& re, std::vector<std::string>& results) {
     if (!re.ok()) {
         return false;
@@ -894,6 +971,16 @@ Status FunctionLike::open(FunctionContext* context, FunctionContext::FunctionSta
             state->search_state.set_search_string(search_string);
             state->function = constant_substring_fn;
             state->scalar_function = constant_substring_fn_scalar;
+        } else if (RE2::FullMatch(pattern_str, LIKE_SUBSTRINGS_RE)) {
+            std::vector<std::string> substrings;
+            split_like_substrings(pattern_str, &substrings);
+            if (VLOG_DEBUG_IS_ON) {
+                VLOG_DEBUG << "pattern str: " << pattern_str
+                           << ", substrings: " << fmt::format("{}", fmt::join(substrings, ", "));
+            }
+            state->search_state.set_search_substrings(substrings);
+            state->function = constant_substrings_fn;
+            state->scalar_function = constant_substrings_fn_scalar;
         } else {
             std::string re_pattern;
             convert_like_pattern(&state->search_state, pattern_str, &re_pattern);
@@ -28,6 +28,7 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "common/status.h"
 #include "runtime/define_primitive_type.h"
@@ -38,6 +39,7 @@
 #include "vec/columns/columns_number.h"
 #include "vec/columns/predicate_column.h"
 #include "vec/common/string_ref.h"
+#include "vec/common/string_searcher.h"
 #include "vec/core/column_numbers.h"
 #include "vec/core/types.h"
 #include "vec/data_types/data_type_number.h"
@@ -73,6 +75,11 @@ struct LikeSearchState {
     /// in the value.
     doris::StringSearch substring_pattern;
 
+    /// Used for LIKE predicates if the pattern is a constant argument and is a few constant
+    /// strings separated by '%', e.g. '%a%b%'. The strings are searched in the value in order.
+    std::vector<std::string> search_substrings;
+    std::vector<std::unique_ptr<ASCIICaseSensitiveStringSearcher>> substring_searchers;
+
     /// Used for RLIKE and REGEXP predicates if the pattern is a constant argument.
     std::unique_ptr<re2::RE2> regex;
 
@@ -110,6 +117,16 @@ struct LikeSearchState {
         search_string_sv = StringRef(search_string);
         substring_pattern.set_pattern(&search_string_sv);
     }
+
+    void set_search_substrings(const std::vector<std::string>& search_substrings_arg) {
+        // the searchers point to the chars of the strings, so build them after the copy
+        search_substrings = search_substrings_arg;
+        substring_searchers.clear();
+        for (const auto& substring : search_substrings) {
+            substring_searchers.push_back(std::make_unique<ASCIICaseSensitiveStringSearcher>(
+                    substring.data(), substring.size()));
+        }
+    }
 };
 
 using LikeFn = std::function<doris::Status(LikeSearchState*, const ColumnString&, const StringRef&,
@@ -229,6 +246,12 @@ protected:
     static Status vector_substring_fn(const ColumnString& vals, const ColumnString& search_strings,
                                       ColumnUInt8::Container& result);
 
+    static Status constant_substrings_fn(LikeSearchState* state, const ColumnString& val,
+                                         const StringRef& pattern, ColumnUInt8::Container& result);
+
+    static Status constant_substrings_fn_scalar(LikeSearchState* state, const StringRef& val,
+                                                const StringRef& pattern, unsigned char* result);
+
     static Status constant_regex_fn(LikeSearchState* state, const ColumnString& val,
                                     const StringRef& pattern, ColumnUInt8::Container& result);
 
@@ -274,6 +297,9 @@ private:
                                      std::string* re_pattern);
 
     static void remove_escape_character(std::string* search_string);
+
+    static void split_like_substrings(const std::string& pattern,
+                                      std::vector<std::string>* substrings);
 };
 
 class FunctionRegexp : public FunctionLikeBase {
@@ -78,6 +78,8 @@ public:
     Status set_source_content_with_specifid_columns(const vectorized::Block* block, size_t row_pos,
                                                     size_t num_rows, std::vector<uint32_t> cids);
     void clear_source_content();
+    // only clear the source of column cid, so the other columns can be converted meanwhile
+    void clear_source_content(size_t cid);
     std::pair<Status, IOlapColumnDataAccessor*> convert_column_data(size_t cid);
     void add_column_data_convertor(const TabletColumn& column);
 
@@ -425,7 +425,13 @@ Status VCollectIterator::_topn_next(Block* block) {
                 // update orderby_extrems in query global context
                 auto* query_ctx = _reader->_reader_context.runtime_state->get_query_ctx();
                 for (int id : _reader->_reader_context.topn_filter_source_node_ids) {
-                    RETURN_IF_ERROR(query_ctx->get_runtime_predicate(id).update(new_top));
+                    auto& runtime_predicate = query_ctx->get_runtime_predicate(id);
+                    // the value of the column is not the value of date_trunc(column)
+                    if (!runtime_predicate.target_is_slot(
+                                _reader->_reader_context.topn_filter_target_node_id)) {
+                        continue;
+                    }
+                    RETURN_IF_ERROR(runtime_predicate.update(new_top));
                 }
             }
         } // end of while (read_rows < _topn_limit && !eof)
@@ -89,13 +89,30 @@ Status RowSourcesBuffer::append(const std::vector<RowSource>& row_sources) {
 Status RowSourcesBuffer::seek_to_begin() {
     _buf_idx = 0;
     if (_fd > 0) {
-        auto offset = lseek(_fd, 0, SEEK_SET);
-        if (offset != 0) {
-            LOG(WARNING) << "failed to seek to 0";
-            return Status::InternalError("failed to seek to 0");
-        }
+        // the row sources are read by pread, the offset of the fd is kept for writing
+        _file_offset = 0;
+        _reset_buffer();
+    }
+    return Status::OK();
+}
+
+Status RowSourcesBuffer::create_reader(std::unique_ptr<RowSourcesBuffer>* reader) {
+    if (_fd > 0) {
+        RETURN_IF_ERROR(flush());
+    } else {
+        RETURN_IF_ERROR(_create_buffer_file());
+        RETURN_IF_ERROR(_serialize());
         _reset_buffer();
     }
+    auto new_reader = std::make_unique<RowSourcesBuffer>(_tablet_id, _tablet_path, _reader_type);
+    // the readers share the unlinked buffer file, each of them reads at its own offset
+    new_reader->_fd = ::dup(_fd);
+    if (new_reader->_fd < 0) {
+        LOG(WARNING) << "failed to dup row source buffer file, err: " << strerror(errno);
+        return Status::InternalError("failed to dup row source buffer file");
+    }
+    new_reader->_total_size = _total_size;
+    *reader = std::move(new_reader);
     return Status::OK();
 }
 
@@ -231,7 +248,7 @@ Status RowSourcesBuffer::_serialize() {
 
 Status RowSourcesBuffer::_deserialize() {
     size_t rows = 0;
-    ssize_t bytes_read = ::read(_fd, &rows, sizeof(rows));
+    ssize_t bytes_read = ::pread(_fd, &rows, sizeof(rows), _file_offset);
     if (bytes_read == 0) {
         LOG(WARNING) << "end of row source buffer file";
         return Status::EndOfFile("end of row source buffer file");
@@ -241,12 +258,14 @@ Status RowSourcesBuffer::_deserialize() {
     }
     _buffer->resize(rows);
     auto& internal_data = _buffer->get_data();
-    bytes_read = ::read(_fd, internal_data.data(), rows * sizeof(UInt16));
+    bytes_read = ::pread(_fd, internal_data.data(), rows * sizeof(UInt16),
+                         _file_offset + sizeof(rows));
     if (bytes_read != rows * sizeof(UInt16)) {
         LOG(WARNING) << "failed to read buffer data from file, bytes_read=" << bytes_read
                      << ", expect bytes=" << rows * sizeof(UInt16);
         return Status::InternalError("failed to read buffer data from file");
     }
+    _file_offset += sizeof(rows) + bytes_read;
     return Status::OK();
 }
 
@@ -119,6 +119,11 @@ public:
 
     Status seek_to_begin();
 
+    // Create a reader which reads the row sources from the beginning by itself, so that the
+    // value column groups can be compacted concurrently. The row sources still in memory are
+    // flushed to the buffer file first.
+    Status create_reader(std::unique_ptr<RowSourcesBuffer>* reader);
+
     size_t same_source_count(uint16_t source, size_t limit);
 
     // return continuous agg_flag=true count from index
@@ -138,6 +143,8 @@ private:
     ReaderType _reader_type = ReaderType::UNKNOWN;
     uint64_t _buf_idx = 0;
     int _fd = -1;
+    // the offset in the buffer file of the row sources to deserialize next
+    off_t _file_offset = 0;
     ColumnUInt16::MutablePtr _buffer;
     uint64_t _total_size = 0;
 };
@@ -58,6 +58,12 @@ Status VStatisticsIterator::init(const StorageReadOptions& opts) {
         }
 
         _target_rows = _push_down_agg_type_opt == TPushAggOp::MINMAX ? 2 : _segment->num_rows();
+        // only the count is answered for a segment with deleted rows
+        auto delete_bitmap = opts.delete_bitmap.find(_segment->id());
+        if (_push_down_agg_type_opt == TPushAggOp::COUNT &&
+            delete_bitmap != opts.delete_bitmap.end() && delete_bitmap->second != nullptr) {
+            _target_rows -= std::min<size_t>(_target_rows, delete_bitmap->second->cardinality());
+        }
         _init = true;
     }
 
@@ -27,6 +27,27 @@
 
 namespace doris::vectorized {
 
+int CooperativeBuildTask::run_parts() {
+    int num_run = 0;
+    for (int part = _next_part++; part < _num_parts; part = _next_part++) {
+        _build_part(part, _num_parts);
+        ++num_run;
+    }
+    if (num_run > 0) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _finished_parts += num_run;
+        if (_finished_parts == _num_parts) {
+            _cv.notify_all();
+        }
+    }
+    return num_run;
+}
+
+void CooperativeBuildTask::wait() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cv.wait(lock, [this] { return _finished_parts == _num_parts; });
+}
+
 void SharedHashTableController::set_builder_and_consumers(TUniqueId builder, int node_id) {
     // Only need to set builder and consumers with pipeline engine enabled.
     std::lock_guard<std::mutex> lock(_mutex);
@@ -63,6 +84,37 @@ void SharedHashTableController::signal_finish(int my_node_id) {
     _cv.notify_all();
 }
 
+size_t SharedHashTableController::num_consumers(int my_node_id) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _dependencies.find(my_node_id);
+    return it == _dependencies.cend() ? 0 : it->second.size();
+}
+
+void SharedHashTableController::start_cooperative_build(
+        int my_node_id, std::shared_ptr<CooperativeBuildTask> task) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto it = _shared_contexts.find(my_node_id);
+    if (it != _shared_contexts.cend()) {
+        it->second->cooperative_build = std::move(task);
+    }
+    for (auto& dep : _dependencies[my_node_id]) {
+        dep->set_ready();
+    }
+}
+
+Status SharedHashTableController::wait_for_signal(RuntimeState* state,
+                                                  const SharedHashTableContextPtr& context) {
+    std::unique_lock<std::mutex> lock(_mutex);
+    // the builder only runs the parts left and copies the results before it signals
+    while (!context->signaled) {
+        if (state->is_cancelled()) {
+            return state->cancel_reason();
+        }
+        _cv.wait_for(lock, std::chrono::milliseconds(100));
+    }
+    return Status::OK();
+}
+
 TUniqueId SharedHashTableController::get_builder_fragment_instance_id(int my_node_id) {
     std::lock_guard<std::mutex> lock(_mutex);
     auto it = _builder_fragment_ids.find(my_node_id);
@@ -19,7 +19,9 @@
 
 #include <gen_cpp/Types_types.h>
 
+#include <atomic>
 #include <condition_variable>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -54,6 +56,30 @@ namespace vectorized {
 
 class Arena;
 
+// The insertion of the rows into a shared hash table, split into parts which are run by the
+// builder together with the instances waiting for the hash table.
+class CooperativeBuildTask {
+public:
+    CooperativeBuildTask(int num_parts, std::function<void(int part, int num_parts)> build_part)
+            : _num_parts(num_parts), _build_part(std::move(build_part)) {}
+
+    // Run the parts not taken by others until no part is left, return the number of parts run.
+    int run_parts();
+
+    // Wait until all parts are finished.
+    void wait();
+
+    int num_parts() const { return _num_parts; }
+
+private:
+    const int _num_parts;
+    const std::function<void(int part, int num_parts)> _build_part;
+    std::atomic<int> _next_part = 0;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    int _finished_parts = 0;
+};
+
 struct SharedHashTableContext {
     SharedHashTableContext()
             : hash_table_variants(nullptr), block(std::make_shared<vectorized::Block>()) {}
@@ -66,6 +92,8 @@ struct SharedHashTableContext {
     std::map<int, SharedRuntimeFilterContext> runtime_filters;
     std::atomic<bool> signaled = false;
     bool short_circuit_for_null_in_probe_side = false;
+    // set if the consumers are woken up to build the hash table together with the builder
+    std::shared_ptr<CooperativeBuildTask> cooperative_build;
 };
 
 using SharedHashTableContextPtr = std::shared_ptr<SharedHashTableContext>;
@@ -78,6 +106,12 @@ public:
     SharedHashTableContextPtr get_context(int my_node_id);
     void signal(int my_node_id);
     void signal_finish(int my_node_id);
+    size_t num_consumers(int my_node_id);
+    /// publish `task` to the context and wake up the consumers to take its parts
+    void start_cooperative_build(int my_node_id, std::shared_ptr<CooperativeBuildTask> task);
+    /// wait for the builder to signal the context, after a consumer is woken up by
+    /// `start_cooperative_build`
+    Status wait_for_signal(RuntimeState* state, const SharedHashTableContextPtr& context);
     void append_dependency(int node_id, std::shared_ptr<pipeline::Dependency> dep,
                            std::shared_ptr<pipeline::Dependency> finish_dep) {
         std::lock_guard<std::mutex> lock(_mutex);
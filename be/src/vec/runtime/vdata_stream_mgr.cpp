@@ -17,22 +17,76 @@
 
 #include "vec/runtime/vdata_stream_mgr.h"
 
+#include <brpc/controller.h>
 #include <gen_cpp/Types_types.h>
 #include <gen_cpp/internal_service.pb.h>
 #include <gen_cpp/types.pb.h>
 #include <stddef.h>
 
+#include <atomic>
 #include <ostream>
 #include <string>
 #include <vector>
 
 #include "common/logging.h"
 #include "util/hash_util.hpp"
+#include "util/proto_util.h"
+#include "util/shm_ring_buffer.h"
+#include "util/time.h"
 #include "vec/runtime/vdata_stream_recvr.h"
 
 namespace doris {
 namespace vectorized {
 
+namespace {
+// The closure shared by all the packets of a batched transmit_block. A receiver may hold it
+// for each packet to apply back pressure, the rpc is responded after all of them run it.
+class BatchTransmitClosure : public google::protobuf::Closure {
+public:
+    BatchTransmitClosure(google::protobuf::Closure* done, brpc::Controller* cntl,
+                         PTransmitDataResult* response, size_t num_packets)
+            : _done(done),
+              _cntl(cntl),
+              _response(response),
+              _statuses(num_packets),
+              // one more reference for the demultiplexing thread
+              _pending(num_packets + 1) {}
+
+    void set_status(size_t index, const Status& st) { st.to_protobuf(&_statuses[index]); }
+
+    // The receivers may decode the blocks asynchronously, the requests live until all the
+    // packets run the closure.
+    void hold_requests(std::vector<std::unique_ptr<PTransmitDataParams>>&& requests) {
+        _requests = std::move(requests);
+    }
+
+    void Run() override {
+        if (_pending.fetch_sub(1) != 1) {
+            return;
+        }
+        Status st;
+        for (const auto& status : _statuses) {
+            st = append_length_prefixed_message(status, &_cntl->response_attachment());
+            if (!st.ok()) {
+                _cntl->response_attachment().clear();
+                break;
+            }
+        }
+        st.to_protobuf(_response->mutable_status());
+        _done->Run();
+        delete this;
+    }
+
+private:
+    google::protobuf::Closure* _done;
+    brpc::Controller* _cntl;
+    PTransmitDataResult* _response;
+    std::vector<PStatus> _statuses;
+    std::vector<std::unique_ptr<PTransmitDataParams>> _requests;
+    std::atomic<size_t> _pending;
+};
+} // namespace
+
 VDataStreamMgr::VDataStreamMgr() {
     // TODO: metric
 }
@@ -149,6 +203,70 @@ Status VDataStreamMgr::transmit_block(const PTransmitDataParams* request,
     return Status::OK();
 }
 
+Status VDataStreamMgr::transmit_block_batch(brpc::Controller* cntl, PTransmitDataResult* response,
+                                            ::google::protobuf::Closure** done) {
+    std::vector<std::unique_ptr<PTransmitDataParams>> requests;
+    if (ShmRingBuffer::is_doorbell(cntl->request_attachment())) {
+        std::string name;
+        int64_t num_packets = 0;
+        RETURN_IF_ERROR(
+                ShmRingBuffer::parse_doorbell(cntl->request_attachment(), &name, &num_packets));
+        RETURN_IF_ERROR(_read_shm_ring(name, num_packets, &requests));
+    } else {
+        RETURN_IF_ERROR(parse_length_prefixed_messages(cntl->request_attachment(), &requests));
+    }
+    auto* batch_done = new BatchTransmitClosure(*done, cntl, response, requests.size());
+    *done = nullptr;
+    size_t num_requests = requests.size();
+    std::vector<const PTransmitDataParams*> packets;
+    for (const auto& request : requests) {
+        packets.push_back(request.get());
+    }
+    batch_done->hold_requests(std::move(requests));
+    for (size_t i = 0; i < num_requests; ++i) {
+        google::protobuf::Closure* packet_done = batch_done;
+        batch_done->set_status(i, transmit_block(packets[i], &packet_done));
+        if (packet_done != nullptr) {
+            // the receiver does not hold the closure for this packet
+            packet_done->Run();
+        }
+    }
+    batch_done->Run();
+    return Status::OK();
+}
+
+Status VDataStreamMgr::_read_shm_ring(const std::string& name, int64_t num_packets,
+                                      std::vector<std::unique_ptr<PTransmitDataParams>>* requests) {
+    static constexpr int64_t SHM_RING_IDLE_MS = 60000;
+    std::shared_ptr<ShmRingEntry> entry;
+    {
+        std::lock_guard<std::mutex> l(_shm_rings_lock);
+        auto now = MonotonicMillis();
+        if (now - _last_shm_rings_sweep_ms > SHM_RING_IDLE_MS) {
+            _last_shm_rings_sweep_ms = now;
+            std::erase_if(_shm_rings, [&](const auto& item) {
+                return now - item.second->last_access_ms > SHM_RING_IDLE_MS;
+            });
+        }
+        auto& ring_entry = _shm_rings[name];
+        if (ring_entry == nullptr) {
+            ring_entry = std::make_shared<ShmRingEntry>();
+        }
+        ring_entry->last_access_ms = now;
+        entry = ring_entry;
+    }
+    std::lock_guard<std::mutex> l(entry->lock);
+    if (entry->ring == nullptr) {
+        RETURN_IF_ERROR(ShmRingBuffer::open(name, &entry->ring));
+    }
+    for (int64_t i = 0; i < num_packets; ++i) {
+        auto request = std::make_unique<PTransmitDataParams>();
+        RETURN_IF_ERROR(entry->ring->read_message(request.get()));
+        requests->emplace_back(std::move(request));
+    }
+    return Status::OK();
+}
+
 Status VDataStreamMgr::deregister_recvr(const TUniqueId& fragment_instance_id, PlanNodeId node_id) {
     std::shared_ptr<VDataStreamRecvr> targert_recvr;
     VLOG_QUERY << "deregister_recvr(): fragment_instance_id=" << print_id(fragment_instance_id)
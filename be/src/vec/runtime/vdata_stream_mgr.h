@@ -23,8 +23,10 @@
 #include <memory>
 #include <mutex>
 #include <set>
+#include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "common/global_types.h"
 #include "common/status.h"
@@ -35,11 +37,17 @@ class Closure;
 }
 } // namespace google
 
+namespace brpc {
+class Controller;
+}
+
 namespace doris {
 class RuntimeState;
 class RowDescriptor;
 class RuntimeProfile;
 class PTransmitDataParams;
+class PTransmitDataResult;
+class ShmRingBuffer;
 
 namespace vectorized {
 class VDataStreamRecvr;
@@ -62,6 +70,12 @@ public:
 
     Status transmit_block(const PTransmitDataParams* request, ::google::protobuf::Closure** done);
 
+    // Demultiplex the packets packed by ExchangeSinkBuffer into the request attachment of
+    // `cntl`, the status of each packet is returned in the same order in the response
+    // attachment. `done` is taken over and run after all the packets are consumed.
+    Status transmit_block_batch(brpc::Controller* cntl, PTransmitDataResult* response,
+                                ::google::protobuf::Closure** done);
+
     void cancel(const TUniqueId& fragment_instance_id, Status exec_status);
 
 private:
@@ -88,6 +102,21 @@ private:
     FragmentStreamSet _fragment_stream_set;
 
     uint32_t get_hash_value(const TUniqueId& fragment_instance_id, PlanNodeId node_id);
+
+    // Read the packets written by a sender process on this host into its shared memory ring.
+    Status _read_shm_ring(const std::string& name, int64_t num_packets,
+                          std::vector<std::unique_ptr<PTransmitDataParams>>* requests);
+
+    struct ShmRingEntry {
+        std::mutex lock;
+        std::unique_ptr<ShmRingBuffer> ring;
+        int64_t last_access_ms = 0;
+    };
+    std::mutex _shm_rings_lock;
+    // The rings are unmapped after they are idle for a while, the name of a ring is removed
+    // once its sender is closed, so it is never opened again after that.
+    std::unordered_map<std::string, std::shared_ptr<ShmRingEntry>> _shm_rings;
+    int64_t _last_shm_rings_sweep_ms = 0;
 };
 } // namespace vectorized
 } // namespace doris
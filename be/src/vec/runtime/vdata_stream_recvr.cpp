@@ -29,10 +29,12 @@
 #include "common/logging.h"
 #include "pipeline/exec/exchange_sink_operator.h"
 #include "pipeline/exec/exchange_source_operator.h"
+#include "runtime/exec_env.h"
 #include "runtime/memory/mem_tracker.h"
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
 #include "util/defer_op.h"
+#include "util/threadpool.h"
 #include "util/uid_util.h"
 #include "vec/core/block.h"
 #include "vec/core/materialize_block.h"
@@ -50,6 +52,10 @@ VDataStreamRecvr::SenderQueue::SenderQueue(VDataStreamRecvr* parent_recvr, int n
           _received_first_batch(false) {
     _cancel_status = Status::OK();
     _queue_mem_tracker = std::make_unique<MemTracker>("local data queue mem tracker");
+    if (auto* pool = ExecEnv::GetInstance()->exchange_deserialize_thread_pool()) {
+        // serial, so that the blocks of a queue keep the order they are received
+        _decode_token = pool->new_token(ThreadPool::ExecutionMode::SERIAL);
+    }
 }
 
 VDataStreamRecvr::SenderQueue::~SenderQueue() {
@@ -117,6 +123,8 @@ Status VDataStreamRecvr::SenderQueue::_inner_get_batch_without_lock(Block* block
         _recvr->_buffer_full_total_timer->update(closure_pair.second.elapsed_time());
     }
     block->swap(*next_block);
+    // `next_block` holds the consumed columns of the caller now, keep them for reuse.
+    _recvr->_free_blocks.give_back(std::move(*next_block));
     *eos = false;
     return Status::OK();
 }
@@ -159,11 +167,52 @@ Status VDataStreamRecvr::SenderQueue::add_block(const PBlock& pblock, int be_num
         }
     }
 
+    // The block is decoded off the brpc thread if there is a decode pool. The closure is held
+    // until the block is queued, which keeps the request alive and backpressures the sender.
+    // Packets without a closure, e.g. eos, are decoded inline since the request is released
+    // once this function returns.
+    if (_decode_token != nullptr && done != nullptr && *done != nullptr) {
+        google::protobuf::Closure* held_done = *done;
+        *done = nullptr;
+        auto st = _decode_token->submit_func([this, &pblock, held_done]() {
+            SCOPED_ATTACH_TASK_WITH_ID(_recvr->_query_mem_tracker, _recvr->_query_id);
+            google::protobuf::Closure* task_done = held_done;
+            auto st = _deserialize_and_queue(pblock, &task_done);
+            if (!st.ok()) {
+                cancel(st);
+            }
+            if (task_done != nullptr) {
+                task_done->Run();
+            }
+        });
+        if (st.ok()) {
+            COUNTER_UPDATE(_recvr->_async_deserialize_counter, 1);
+            return Status::OK();
+        }
+        *done = held_done;
+    }
+    return _deserialize_and_queue(pblock, done);
+}
+
+Status VDataStreamRecvr::SenderQueue::_deserialize_and_queue(const PBlock& pblock,
+                                                             ::google::protobuf::Closure** done) {
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        if (_is_cancelled) {
+            return Status::OK();
+        }
+    }
+
     BlockUPtr block = nullptr;
     int64_t deserialize_time = 0;
     {
         SCOPED_RAW_TIMER(&deserialize_time);
         block = Block::create_unique();
+        if (_recvr->_free_blocks.try_get(block.get())) {
+            COUNTER_UPDATE(_recvr->_free_block_hit_counter, 1);
+        } else {
+            COUNTER_UPDATE(_recvr->_free_block_miss_counter, 1);
+        }
         RETURN_IF_ERROR(block->deserialize(pblock));
     }
 
@@ -323,6 +372,11 @@ void VDataStreamRecvr::SenderQueue::close() {
         _pending_closures.clear();
     }
 
+    // The pending decode tasks see the cancellation and only run their closures.
+    if (_decode_token != nullptr) {
+        _decode_token->wait();
+    }
+
     // Delete any batches queued in _block_queue
     _block_queue.clear();
 }
@@ -343,6 +397,7 @@ VDataStreamRecvr::VDataStreamRecvr(VDataStreamMgr* stream_mgr, RuntimeState* sta
           _is_merging(is_merging),
           _is_closed(false),
           _profile(profile),
+          _free_blocks((is_merging ? num_senders : 1) * FREE_BLOCKS_PER_QUEUE),
           _enable_pipeline(state->enable_pipeline_x_exec()) {
     // DataStreamRecvr may be destructed after the instance execution thread ends.
     _mem_tracker =
@@ -378,6 +433,9 @@ VDataStreamRecvr::VDataStreamRecvr(VDataStreamMgr* stream_mgr, RuntimeState* sta
     _memory_usage_counter = ADD_LABEL_COUNTER(_profile, "MemoryUsage");
     _peak_memory_usage_counter =
             _profile->add_counter("PeakMemoryUsage", TUnit::BYTES, "MemoryUsage");
+    _free_block_hit_counter = ADD_COUNTER(_profile, "FreeBlockPoolHitCount", TUnit::UNIT);
+    _free_block_miss_counter = ADD_COUNTER(_profile, "FreeBlockPoolMissCount", TUnit::UNIT);
+    _async_deserialize_counter = ADD_COUNTER(_profile, "AsyncDeserializeBlocks", TUnit::UNIT);
     _remote_bytes_received_counter = ADD_COUNTER(_profile, "RemoteBytesReceived", TUnit::BYTES);
     _local_bytes_received_counter = ADD_COUNTER(_profile, "LocalBytesReceived", TUnit::BYTES);
 
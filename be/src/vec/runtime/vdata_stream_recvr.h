@@ -46,6 +46,7 @@
 #include "util/runtime_profile.h"
 #include "util/stopwatch.hpp"
 #include "vec/core/block.h"
+#include "vec/core/block_pool.h"
 #include "vec/exprs/vexpr_fwd.h"
 
 namespace doris {
@@ -53,6 +54,7 @@ class MemTracker;
 class PBlock;
 class MemTrackerLimiter;
 class RuntimeState;
+class ThreadPoolToken;
 
 namespace pipeline {
 class Dependency;
@@ -150,6 +152,9 @@ private:
 
     ObjectPool _sender_queue_pool;
     RuntimeProfile* _profile = nullptr;
+    // Blocks given back by the consumer, reused to deserialize the next received blocks.
+    static constexpr int FREE_BLOCKS_PER_QUEUE = 2;
+    BlockPool _free_blocks;
 
     RuntimeProfile::Counter* _remote_bytes_received_counter = nullptr;
     RuntimeProfile::Counter* _local_bytes_received_counter = nullptr;
@@ -161,6 +166,9 @@ private:
     RuntimeProfile::Counter* _decompress_bytes = nullptr;
     RuntimeProfile::Counter* _memory_usage_counter = nullptr;
     RuntimeProfile::Counter* _peak_memory_usage_counter = nullptr;
+    RuntimeProfile::Counter* _free_block_hit_counter = nullptr;
+    RuntimeProfile::Counter* _free_block_miss_counter = nullptr;
+    RuntimeProfile::Counter* _async_deserialize_counter = nullptr;
 
     // Number of rows received
     RuntimeProfile::Counter* _rows_produced_counter = nullptr;
@@ -231,6 +239,8 @@ protected:
 
     void try_set_dep_ready_without_lock();
 
+    Status _deserialize_and_queue(const PBlock& pblock, ::google::protobuf::Closure** done);
+
     // To record information about several variables in the event of a DCHECK failure.
     //  DCHECK(_is_cancelled || !_block_queue.empty() || _num_remaining_senders == 0)
 #ifndef NDEBUG
@@ -292,6 +302,8 @@ protected:
     // be_number => packet_seq
     std::unordered_map<int, int64_t> _packet_seq_map;
     std::deque<std::pair<google::protobuf::Closure*, MonotonicStopWatch>> _pending_closures;
+    // set if exchange_deserialize_thread_num > 0, see add_block(const PBlock&)
+    std::unique_ptr<ThreadPoolToken> _decode_token;
     std::unordered_map<std::thread::id, std::unique_ptr<ThreadClosure>> _local_closure;
 
     std::shared_ptr<pipeline::Dependency> _source_dependency;
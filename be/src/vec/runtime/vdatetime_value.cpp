@@ -37,6 +37,7 @@
 #include "common/config.h"
 #include "common/exception.h"
 #include "common/status.h"
+#include "util/string_parser.hpp"
 #include "util/timezone_utils.h"
 #include "vec/common/int_exp.h"
 
@@ -1985,9 +1986,53 @@ bool DateV2Value<T>::from_date_str(const char* date_str, int len,
                                    bool convert_zero) {
     return from_date_str_base(date_str, len, scale, &local_time_zone, convert_zero);
 }
+// Parses the canonical 'YYYY-MM-DD' and 'YYYY-MM-DD HH:MM:SS' (or 'T' separated) strings, the
+// digits and the separators of each 8 bytes are checked at once.
+static bool parse_canonical_date_str(const char* date_str, int len, uint32_t* date_val) {
+    constexpr uint64_t date_digits = 0x00FFFF00FFFFFFFFULL;    // "YYYY-MM-"
+    constexpr uint64_t date_separators = 0x2D00002D00000000ULL;
+    constexpr uint64_t time_digits = 0xFFFF00FFFF00FFFFULL;    // "HH:MM:SS"
+    constexpr uint64_t time_separators = 0x00003A00003A0000ULL;
+    auto digit = [date_str](int i) -> uint32_t { return date_str[i] - '0'; };
+
+    uint64_t word;
+    memcpy(&word, date_str, sizeof(word));
+    if (!StringParser::is_digits_word(word, date_digits, date_separators) ||
+        !isdigit(date_str[8]) || !isdigit(date_str[9])) {
+        return false;
+    }
+    date_val[0] = digit(0) * 1000 + digit(1) * 100 + digit(2) * 10 + digit(3);
+    date_val[1] = digit(5) * 10 + digit(6);
+    date_val[2] = digit(8) * 10 + digit(9);
+    if (len == 10) {
+        return true;
+    }
+
+    memcpy(&word, date_str + 11, sizeof(word));
+    if ((date_str[10] != ' ' && date_str[10] != 'T') ||
+        !StringParser::is_digits_word(word, time_digits, time_separators)) {
+        return false;
+    }
+    date_val[3] = digit(11) * 10 + digit(12);
+    date_val[4] = digit(14) * 10 + digit(15);
+    date_val[5] = digit(17) * 10 + digit(18);
+    return true;
+}
+
 template <typename T>
 bool DateV2Value<T>::from_date_str_base(const char* date_str, int len, int scale,
                                         const cctz::time_zone* local_time_zone, bool convert_zero) {
+    // Fast path of the most common formats, the invalid values go through the general parsing
+    // below for the zero date conversion and the errors.
+    if (len == 10 || len == 19) {
+        uint32_t date_val[MAX_DATE_PARTS] = {0};
+        if (parse_canonical_date_str(date_str, len, date_val) &&
+            !is_invalid(date_val[0], date_val[1], date_val[2], 0, 0, 0, 0)) {
+            return check_range_and_set_time(date_val[0], date_val[1], date_val[2], date_val[3],
+                                            date_val[4], date_val[5], 0);
+        }
+    }
+
     const char* ptr = date_str;
     const char* end = date_str + len;
     // ONLY 2, 6 can follow by a space
@@ -245,6 +245,83 @@ struct DateTimeV2ValueType {
               year_(year) {}
 };
 
+// Reads the fields of the DateV2 (uint32_t) and DateTimeV2 (uint64_t) values from the packed
+// integers by shifts, masks and lookup tables. Unlike the calls of DateV2Value there is no
+// branch, so the loops over whole columns are vectorized.
+template <typename NativeType>
+struct PackedDateV2 {
+    static constexpr bool is_datetime = std::is_same_v<NativeType, uint64_t>;
+    static constexpr uint32_t DAY_SHIFT = is_datetime ? TIME_PART_LENGTH : 0;
+    static constexpr uint32_t MONTH_SHIFT = DAY_SHIFT + 5;
+    static constexpr uint32_t YEAR_SHIFT = MONTH_SHIFT + 4;
+    static constexpr uint32_t SECOND_SHIFT = 20;
+    static constexpr uint32_t MINUTE_SHIFT = 26;
+    static constexpr uint32_t HOUR_SHIFT = 32;
+
+    static uint32_t year(NativeType t) { return t >> YEAR_SHIFT; }
+    static uint32_t month(NativeType t) { return (t >> MONTH_SHIFT) & 0xF; }
+    static uint32_t day(NativeType t) { return (t >> DAY_SHIFT) & 0x1F; }
+    static uint32_t hour(NativeType t) { return _time_field<HOUR_SHIFT, 0x1F>(t); }
+    static uint32_t minute(NativeType t) { return _time_field<MINUTE_SHIFT, 0x3F>(t); }
+    static uint32_t second(NativeType t) { return _time_field<SECOND_SHIFT, 0x3F>(t); }
+    static uint32_t microsecond(NativeType t) { return _time_field<0, 0xFFFFF>(t); }
+
+    // The same as DateV2Value::is_valid_date.
+    static bool is_valid(NativeType t) {
+        uint32_t y = year(t);
+        bool leap = ((y % 4) == 0) & (((y % 100) != 0) | (((y % 400) == 0) & (y != 0)));
+        // the day 0 wraps around to be greater than any days in month
+        bool valid = (y <= MAX_YEAR) & (day(t) - 1 < DAYS_IN_MONTH_TABLE[leap][month(t)]);
+        if constexpr (is_datetime) {
+            valid &= (hour(t) <= MAX_HOUR) & (minute(t) <= MAX_MINUTE) &
+                     (second(t) <= MAX_SECOND) & (microsecond(t) <= MAX_MICROSECOND);
+        }
+        return valid;
+    }
+
+    // The same as DateV2Value::datetime_trunc of a valid value, except for the unit WEEK.
+    template <TimeUnit unit>
+    static NativeType trunc(NativeType t) {
+        static_assert(unit == SECOND || unit == MINUTE || unit == HOUR || unit == DAY ||
+                      unit == MONTH || unit == QUARTER || unit == YEAR);
+        constexpr NativeType FIRST_DAY = NativeType(1) << DAY_SHIFT;
+        if constexpr (!is_datetime && unit <= DAY) {
+            return t;
+        } else if constexpr (unit == SECOND) {
+            return _clear_below<SECOND_SHIFT>(t);
+        } else if constexpr (unit == MINUTE) {
+            return _clear_below<MINUTE_SHIFT>(t);
+        } else if constexpr (unit == HOUR) {
+            return _clear_below<HOUR_SHIFT>(t);
+        } else if constexpr (unit == DAY) {
+            return _clear_below<DAY_SHIFT>(t);
+        } else if constexpr (unit == MONTH) {
+            return _clear_below<MONTH_SHIFT>(t) | FIRST_DAY;
+        } else if constexpr (unit == QUARTER) {
+            return _clear_below<YEAR_SHIFT>(t) |
+                   (NativeType(QUARTER_FIRST_MONTH_TABLE[month(t)]) << MONTH_SHIFT) | FIRST_DAY;
+        } else {
+            return _clear_below<YEAR_SHIFT>(t) | (NativeType(1) << MONTH_SHIFT) | FIRST_DAY;
+        }
+    }
+
+private:
+    // the time fields of DateV2 are all zero
+    template <uint32_t shift, uint32_t mask>
+    static uint32_t _time_field(NativeType t) {
+        if constexpr (is_datetime) {
+            return (t >> shift) & mask;
+        } else {
+            return 0;
+        }
+    }
+
+    template <uint32_t shift>
+    static NativeType _clear_below(NativeType t) {
+        return t & ~((NativeType(1) << shift) - 1);
+    }
+};
+
 template <typename T>
 class DateV2Value;
 
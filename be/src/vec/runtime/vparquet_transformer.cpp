@@ -18,7 +18,7 @@
 #include "vec/runtime/vparquet_transformer.h"
 
 #include <arrow/io/type_fwd.h>
-#include <arrow/table.h>
+#include <arrow/record_batch.h>
 #include <arrow/util/key_value_metadata.h>
 #include <glog/logging.h>
 #include <math.h>
@@ -35,6 +35,7 @@
 #include <ostream>
 #include <string>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "gutil/endian.h"
 #include "io/fs/file_writer.h"
@@ -246,9 +247,12 @@ Status VParquetTransformer::_parse_properties() {
         builder.created_by(
                 fmt::format("{}({})", doris::get_short_version(), parquet::DEFAULT_CREATED_BY));
         _parquet_writer_properties = builder.build();
+        // the columns are encoded on the cpu thread pool of arrow, the callers of the
+        // transformer are never threads of that pool, so they can wait for it
         _arrow_properties = parquet::ArrowWriterProperties::Builder()
                                     .enable_deprecated_int96_timestamps()
                                     ->store_schema()
+                                    ->set_use_threads(config::enable_parquet_writer_parallel_encode)
                                     ->build();
     } catch (const parquet::ParquetException& e) {
         return Status::InternalError("parquet writer parse properties error: {}", e.what());
@@ -292,12 +296,14 @@ Status VParquetTransformer::write(const Block& block) {
     RETURN_IF_ERROR(convert_to_arrow_batch(block, _arrow_schema, arrow::default_memory_pool(),
                                            &result, _state->timezone_obj()));
 
-    auto get_table_res = arrow::Table::FromRecordBatches(result->schema(), {result});
-    if (!get_table_res.ok()) {
-        return Status::InternalError("Error when get arrow table from record batchs");
+    // The blocks are appended to a buffered row group, whose columns are encoded in parallel,
+    // instead of writing every block as a small row group column by column.
+    if (_row_group_bytes >= config::parquet_writer_row_group_bytes) {
+        RETURN_DORIS_STATUS_IF_ERROR(_writer->NewBufferedRowGroup());
+        _row_group_bytes = 0;
     }
-    auto& table = get_table_res.ValueOrDie();
-    RETURN_DORIS_STATUS_IF_ERROR(_writer->WriteTable(*table, block.rows()));
+    RETURN_DORIS_STATUS_IF_ERROR(_writer->WriteRecordBatch(*result));
+    _row_group_bytes += block.bytes();
     return Status::OK();
 }
 
@@ -130,6 +130,8 @@ private:
     const bool _parquet_disable_dictionary;
     const TParquetVersion::type _parquet_version;
     const std::string* _iceberg_schema_json;
+    // the data size of the blocks written to the current row group
+    int64_t _row_group_bytes = 0;
 };
 
 } // namespace doris::vectorized
@@ -81,11 +81,13 @@ Status VSortedRunMerger::prepare(const vector<BlockSupplier>& input_runs) {
         return Status::Cancelled(e.what());
     }
 
+    std::vector<MergeSortCursor> cursors;
     for (auto& _cursor : _cursors) {
         if (!_cursor._is_eof) {
-            _priority_queue.push(MergeSortCursor(&_cursor));
+            cursors.emplace_back(&_cursor);
         }
     }
+    _loser_tree.init(std::move(cursors));
 
     for (const auto& cursor : _cursors) {
         if (!cursor._is_eof) {
@@ -104,24 +106,26 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
     // return the data in receive data directly
 
     if (_pending_cursor != nullptr) {
+        DCHECK(_loser_tree.top().impl == _pending_cursor);
         MergeSortCursor cursor(_pending_cursor);
         if (has_next_block(cursor)) {
-            _priority_queue.push(cursor);
+            _loser_tree.update_top();
+        } else {
+            _loser_tree.remove_top();
         }
         _pending_cursor = nullptr;
     }
 
-    if (_priority_queue.empty()) {
+    if (_loser_tree.empty()) {
         *eos = true;
         return Status::OK();
-    } else if (_priority_queue.size() == 1) {
-        auto current = _priority_queue.top();
+    } else if (_loser_tree.size() == 1) {
+        auto current = _loser_tree.top();
         while (_offset != 0 && current->block_ptr() != nullptr) {
             if (_offset >= current->rows - current->pos) {
                 _offset -= (current->rows - current->pos);
                 if (_pipeline_engine_enabled) {
                     _pending_cursor = current.impl;
-                    _priority_queue.pop();
                     return Status::OK();
                 }
                 has_next_block(current);
@@ -136,7 +140,6 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
                 current->block_ptr()->swap(*output_block);
                 if (_pipeline_engine_enabled) {
                     _pending_cursor = current.impl;
-                    _priority_queue.pop();
                     return Status::OK();
                 }
                 *eos = !has_next_block(current);
@@ -153,7 +156,6 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
                 current->block_ptr()->swap(*output_block);
                 if (_pipeline_engine_enabled) {
                     _pending_cursor = current.impl;
-                    _priority_queue.pop();
                     return Status::OK();
                 }
                 *eos = !has_next_block(current);
@@ -190,21 +192,32 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
             _column_addrs.clear();
         };
 
-        /// Take rows from queue in right order and push to 'merged'.
+        /// Take rows from the loser tree in right order and push to 'merged'.
         size_t merged_rows = 0;
-        while (merged_rows != _batch_size && !_priority_queue.empty()) {
-            auto current = _priority_queue.top();
-            _priority_queue.pop();
+        while (merged_rows != _batch_size && !_loser_tree.empty()) {
+            auto current = _loser_tree.top();
+            size_t rows = _loser_tree.next_batch_rows(_offset > 0 ? _offset
+                                                                  : _batch_size - merged_rows);
 
             if (_offset > 0) {
-                _offset--;
+                _offset -= rows;
+            } else if (rows >= MIN_RANGE_COPY_ROWS) {
+                do_insert();
+                for (size_t i = 0; i < num_columns; ++i) {
+                    merged_columns[i]->insert_range_from(*current->all_columns[i], current->pos,
+                                                         rows);
+                }
+                merged_rows += rows;
             } else {
-                _indexs.emplace_back(current->pos);
-                _block_addrs.emplace_back(current->block_ptr());
-                ++merged_rows;
+                for (size_t i = 0; i < rows; ++i) {
+                    _indexs.emplace_back(current->pos + i);
+                    _block_addrs.emplace_back(current->block_ptr());
+                }
+                merged_rows += rows;
             }
 
-            if (!next_heap(current)) {
+            current->pos += rows - 1;
+            if (!next_cursor(current)) {
                 do_insert();
                 return Status::OK();
             }
@@ -226,10 +239,10 @@ Status VSortedRunMerger::get_next(Block* output_block, bool* eos) {
     return Status::OK();
 }
 
-bool VSortedRunMerger::next_heap(MergeSortCursor& current) {
+bool VSortedRunMerger::next_cursor(MergeSortCursor& current) {
     if (!current->is_last()) {
         current->next();
-        _priority_queue.push(current);
+        _loser_tree.update_top();
         return true;
     }
 
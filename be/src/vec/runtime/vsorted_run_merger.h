@@ -20,7 +20,6 @@
 #include <stddef.h>
 #include <stdint.h>
 
-#include <queue>
 #include <vector>
 
 #include "common/status.h"
@@ -28,6 +27,7 @@
 #include "vec/core/block.h"
 #include "vec/core/sort_cursor.h"
 #include "vec/core/sort_description.h"
+#include "vec/core/sort_loser_tree.h"
 #include "vec/exprs/vexpr_fwd.h"
 
 namespace doris {
@@ -36,8 +36,9 @@ namespace vectorized {
 
 // VSortedRunMerger is used to merge multiple sorted runs of blocks. A run is a sorted
 // sequence of blocks, which are fetched from a BlockSupplier function object.
-// Merging is implemented using a binary min-heap that maintains the run with the next
-// rows in sorted order at the top of the heap.
+// Merging is implemented using a loser tree that maintains the run with the next
+// rows in sorted order at the top of the tree, the rows of a run which go before all
+// the other runs are output at once.
 //
 // Merged block of rows are retrieved from VSortedRunMerger via calls to get_next().
 class VSortedRunMerger {
@@ -55,8 +56,7 @@ public:
     virtual ~VSortedRunMerger() = default;
 
     // Prepare this merger to merge and return rows from the sorted runs in 'input_runs'.
-    // Retrieves the first batch from each run and sets up the binary heap implementing
-    // the priority queue.
+    // Retrieves the first batch from each run and sets up the loser tree.
     Status prepare(const std::vector<BlockSupplier>& input_runs);
 
     // Return the next block of sorted rows from this merger.
@@ -79,10 +79,11 @@ protected:
     bool _pipeline_engine_enabled = false;
 
     std::vector<BlockSupplierSortCursorImpl> _cursors;
-    std::priority_queue<MergeSortCursor> _priority_queue;
+    MergeSortLoserTree _loser_tree;
 
     /// In pipeline engine, if a cursor needs to read one more block from supplier,
-    /// we make it as a pending cursor until the supplier is readable.
+    /// we make it as a pending cursor until the supplier is readable. The pending cursor
+    /// stays at the top of the loser tree until it is replayed.
     MergeSortCursorImpl* _pending_cursor = nullptr;
 
     Block _empty_block;
@@ -98,10 +99,13 @@ protected:
     std::vector<const IColumn*> _column_addrs;
 
 private:
+    // the rows of a cursor output at once are copied by a range, instead of row by row
+    static constexpr size_t MIN_RANGE_COPY_ROWS = 32;
+
     void init_timers(RuntimeProfile* profile);
 
     /// In pipeline engine, return false if need to read one more block from sender.
-    bool next_heap(MergeSortCursor& current);
+    bool next_cursor(MergeSortCursor& current);
     bool has_next_block(MergeSortCursor& current);
 };
 
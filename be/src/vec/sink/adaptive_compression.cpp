@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/sink/adaptive_compression.h"
+
+#include <algorithm>
+
+#include "common/config.h"
+
+namespace doris::vectorized {
+
+AdaptiveCompression::AdaptiveCompression() {
+    // the first blocks try LZ4, which is the safe choice of most networks
+    _best = _index_of(segment_v2::LZ4);
+}
+
+size_t AdaptiveCompression::_index_of(segment_v2::CompressionTypePB codec) {
+    for (size_t i = 0; i < NUM_CODECS; ++i) {
+        if (CODECS[i] == codec) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+double AdaptiveCompression::_cost(const CodecStats& stats) const {
+    // MB/s -> ns/byte
+    double network_ns_per_byte =
+            1000.0 / std::max<int64_t>(1, config::exchange_adaptive_compression_network_mbps);
+    return stats.compress_ns_per_byte + stats.ratio * network_ns_per_byte;
+}
+
+segment_v2::CompressionTypePB AdaptiveCompression::next_codec() {
+    ++_num_blocks;
+    // sample every codec once at first
+    for (size_t i = 0; i < NUM_CODECS; ++i) {
+        if (!_stats[i].sampled) {
+            return CODECS[i];
+        }
+    }
+    if (_num_blocks % EXPLORE_INTERVAL == 0) {
+        _next_explore = (_next_explore + 1) % NUM_CODECS;
+        if (_next_explore == _best) {
+            _next_explore = (_next_explore + 1) % NUM_CODECS;
+        }
+        return CODECS[_next_explore];
+    }
+    return CODECS[_best];
+}
+
+void AdaptiveCompression::update(segment_v2::CompressionTypePB codec, size_t uncompressed_bytes,
+                                 size_t compressed_bytes, int64_t compress_ns) {
+    if (uncompressed_bytes < MIN_SAMPLE_BYTES) {
+        return;
+    }
+    auto& stats = _stats[_index_of(codec)];
+    double ratio = std::min(1.0, double(compressed_bytes) / uncompressed_bytes);
+    double ns_per_byte = double(compress_ns) / uncompressed_bytes;
+    if (stats.sampled) {
+        stats.ratio = stats.ratio * (1 - SMOOTH_FACTOR) + ratio * SMOOTH_FACTOR;
+        stats.compress_ns_per_byte =
+                stats.compress_ns_per_byte * (1 - SMOOTH_FACTOR) + ns_per_byte * SMOOTH_FACTOR;
+    } else {
+        stats.sampled = true;
+        stats.ratio = ratio;
+        stats.compress_ns_per_byte = ns_per_byte;
+    }
+
+    size_t best = _best;
+    for (size_t i = 0; i < NUM_CODECS; ++i) {
+        if (_stats[i].sampled &&
+            (!_stats[best].sampled || _cost(_stats[i]) < _cost(_stats[best]))) {
+            best = i;
+        }
+    }
+    _best = best;
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,71 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <gen_cpp/segment_v2.pb.h>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace doris::vectorized {
+
+// Choose the compression codec of every block sent by one channel.
+// The cost of sending a byte with a codec is the cpu time to compress it plus the time to
+// send its compressed bytes through the network, whose bandwidth is given by
+// exchange_adaptive_compression_network_mbps. The compression ratio and speed of each codec
+// are measured from the blocks sent by the channel, so that the channel stops compressing
+// data that is already compact, e.g. hashed ids or bitmap blobs, and uses ZSTD only if the
+// network is slow enough to pay for it. Every EXPLORE_INTERVAL blocks another codec is tried
+// to follow the change of the data.
+class AdaptiveCompression {
+public:
+    AdaptiveCompression();
+
+    segment_v2::CompressionTypePB next_codec();
+
+    // Feed back the result of a block compressed by `codec`.
+    void update(segment_v2::CompressionTypePB codec, size_t uncompressed_bytes,
+                size_t compressed_bytes, int64_t compress_ns);
+
+private:
+    static constexpr size_t NUM_CODECS = 3;
+    static constexpr segment_v2::CompressionTypePB CODECS[NUM_CODECS] = {
+            segment_v2::NO_COMPRESSION, segment_v2::LZ4, segment_v2::ZSTD};
+    static constexpr int64_t EXPLORE_INTERVAL = 32;
+    // the weight of the latest sample
+    static constexpr double SMOOTH_FACTOR = 0.25;
+    // too small blocks do not give a stable measure
+    static constexpr size_t MIN_SAMPLE_BYTES = 4096;
+
+    struct CodecStats {
+        bool sampled = false;
+        // compressed bytes / uncompressed bytes
+        double ratio = 1;
+        double compress_ns_per_byte = 0;
+    };
+
+    static size_t _index_of(segment_v2::CompressionTypePB codec);
+
+    double _cost(const CodecStats& stats) const;
+
+    CodecStats _stats[NUM_CODECS];
+    size_t _best = 0;
+    int64_t _num_blocks = 0;
+    size_t _next_explore = 0;
+};
+
+} // namespace doris::vectorized
@@ -411,9 +411,26 @@ Status BlockSerializer<Parent>::serialize_block(const Block* src, PBlock* dest,
         SCOPED_TIMER(_parent->_serialize_batch_timer);
         dest->Clear();
         size_t uncompressed_bytes = 0, compressed_bytes = 0;
-        RETURN_IF_ERROR(src->serialize(
-                _parent->_state->be_exec_version(), dest, &uncompressed_bytes, &compressed_bytes,
-                _parent->compression_type(), _parent->transfer_large_data_by_brpc()));
+        auto compression_type = _parent->compression_type();
+        bool adaptive = _parent->adaptive_compression();
+        if (adaptive) {
+            compression_type = _adaptive_compression.next_codec();
+        }
+        int64_t compress_time = src->get_compress_time();
+        RETURN_IF_ERROR(src->serialize(_parent->_state->be_exec_version(), dest,
+                                       &uncompressed_bytes, &compressed_bytes, compression_type,
+                                       _parent->transfer_large_data_by_brpc()));
+        if (adaptive) {
+            _adaptive_compression.update(compression_type, uncompressed_bytes, compressed_bytes,
+                                         src->get_compress_time() - compress_time);
+            if (compression_type == segment_v2::LZ4) {
+                COUNTER_UPDATE(_parent->_lz4_blocks_counter, 1);
+            } else if (compression_type == segment_v2::ZSTD) {
+                COUNTER_UPDATE(_parent->_zstd_blocks_counter, 1);
+            } else {
+                COUNTER_UPDATE(_parent->_no_compression_blocks_counter, 1);
+            }
+        }
         COUNTER_UPDATE(_parent->_bytes_sent_counter, compressed_bytes * num_receivers);
         COUNTER_UPDATE(_parent->_uncompressed_bytes_counter, uncompressed_bytes * num_receivers);
         COUNTER_UPDATE(_parent->_compress_timer, src->get_compress_time());
@@ -49,6 +49,7 @@
 #include "vec/exprs/vexpr_context.h"
 #include "vec/runtime/partitioner.h"
 #include "vec/runtime/vdata_stream_recvr.h"
+#include "vec/sink/adaptive_compression.h"
 #include "vec/sink/vrow_distribution.h"
 #include "vec/sink/vtablet_finder.h"
 
@@ -96,6 +97,7 @@ private:
 
     bool _is_local;
     const int _batch_size;
+    AdaptiveCompression _adaptive_compression;
 };
 
 struct ShuffleChannelIds {
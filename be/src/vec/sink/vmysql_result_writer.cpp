@@ -25,21 +25,26 @@
 #include <string.h>
 #include <sys/types.h>
 
+#include <algorithm>
 #include <ostream>
 #include <string>
 #include <utility>
 
 #include "common/compiler_util.h" // IWYU pragma: keep
+#include "common/config.h"
 #include "gutil/integral_types.h"
 #include "olap/hll.h"
 #include "runtime/buffer_control_block.h"
 #include "runtime/decimalv2_value.h"
 #include "runtime/define_primitive_type.h"
+#include "runtime/exec_env.h"
 #include "runtime/large_int_value.h"
 #include "runtime/primitive_type.h"
 #include "runtime/runtime_state.h"
+#include "runtime/thread_context.h"
 #include "runtime/types.h"
 #include "util/binary_cast.hpp"
+#include "util/countdown_latch.h"
 #include "util/jsonb_utils.h"
 #include "util/quantile_state.h"
 #include "vec/aggregate_functions/aggregate_function.h"
@@ -88,6 +93,8 @@ Status VMysqlResultWriter<is_binary_format>::init(RuntimeState* state) {
     }
     set_output_object_data(state->return_object_data_as_binary());
     _is_dry_run = state->query_options().dry_run_query;
+    _query_mem_tracker = state->query_mem_tracker();
+    _query_id = state->query_id();
     return Status::OK();
 }
 
@@ -99,6 +106,9 @@ void VMysqlResultWriter<is_binary_format>::_init_profile() {
     _copy_buffer_timer = ADD_CHILD_TIMER(_parent_profile, "CopyBufferTime", "AppendBatchTime");
     _sent_rows_counter = ADD_COUNTER(_parent_profile, "NumSentRows", TUnit::UNIT);
     _bytes_sent_counter = ADD_COUNTER(_parent_profile, "BytesSent", TUnit::BYTES);
+    _parallel_serialize_ranges_counter =
+            ADD_CHILD_COUNTER(_parent_profile, "ParallelSerializeRanges", TUnit::UNIT,
+                              "AppendBatchTime");
 }
 
 template <bool is_binary_format>
@@ -123,11 +133,6 @@ Status VMysqlResultWriter<is_binary_format>::write(Block& input_block) {
     uint64_t bytes_sent = 0;
     {
         SCOPED_TIMER(_convert_tuple_timer);
-        MysqlRowBuffer<is_binary_format> row_buffer;
-        if constexpr (is_binary_format) {
-            row_buffer.start_binary_row(_output_vexpr_ctxs.size());
-        }
-
         struct Arguments {
             const IColumn* column;
             bool is_const;
@@ -173,19 +178,63 @@ Status VMysqlResultWriter<is_binary_format>::write(Block& input_block) {
             }
         }
 
-        for (size_t row_idx = 0; row_idx < num_rows; ++row_idx) {
-            for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
-                RETURN_IF_ERROR(arguments[col_idx].serde->write_column_to_mysql(
-                        *(arguments[col_idx].column), row_buffer, row_idx,
-                        arguments[col_idx].is_const));
+        // Serializes the rows in [begin, end) into the result with a row buffer of its own.
+        auto serialize_rows = [&](size_t begin, size_t end, uint64_t* bytes) -> Status {
+            MysqlRowBuffer<is_binary_format> row_buffer;
+            if constexpr (is_binary_format) {
+                row_buffer.start_binary_row(num_cols);
             }
+            for (size_t row_idx = begin; row_idx < end; ++row_idx) {
+                for (size_t col_idx = 0; col_idx < num_cols; ++col_idx) {
+                    RETURN_IF_ERROR(arguments[col_idx].serde->write_column_to_mysql(
+                            *(arguments[col_idx].column), row_buffer, row_idx,
+                            arguments[col_idx].is_const));
+                }
 
-            // copy MysqlRowBuffer to Thrift
-            result->result_batch.rows[row_idx].append(row_buffer.buf(), row_buffer.length());
-            bytes_sent += row_buffer.length();
-            row_buffer.reset();
-            if constexpr (is_binary_format) {
-                row_buffer.start_binary_row(_output_vexpr_ctxs.size());
+                // copy MysqlRowBuffer to Thrift
+                result->result_batch.rows[row_idx].append(row_buffer.buf(), row_buffer.length());
+                *bytes += row_buffer.length();
+                row_buffer.reset();
+                if constexpr (is_binary_format) {
+                    row_buffer.start_binary_row(num_cols);
+                }
+            }
+            return Status::OK();
+        };
+
+        auto* pool = ExecEnv::GetInstance()->mysql_result_serialize_thread_pool();
+        const size_t batch_rows = std::max(config::mysql_result_serialize_batch_rows, 1);
+        if (pool == nullptr || num_rows <= batch_rows) {
+            RETURN_IF_ERROR(serialize_rows(0, num_rows, &bytes_sent));
+        } else {
+            // Split a big block into ranges of rows, the first one is serialized by this thread
+            // and the others by the pool, each into its own rows of the result.
+            const size_t num_ranges = (num_rows + batch_rows - 1) / batch_rows;
+            std::vector<Status> statuses(num_ranges);
+            std::vector<uint64_t> range_bytes(num_ranges, 0);
+            auto serialize_range = [&](size_t i) {
+                statuses[i] = serialize_rows(i * batch_rows,
+                                             std::min(num_rows, (i + 1) * batch_rows),
+                                             &range_bytes[i]);
+            };
+            CountDownLatch latch(static_cast<int>(num_ranges - 1));
+            for (size_t i = 1; i < num_ranges; ++i) {
+                auto st = pool->submit_func([&, i]() {
+                    SCOPED_ATTACH_TASK_WITH_ID(_query_mem_tracker, _query_id);
+                    serialize_range(i);
+                    latch.count_down();
+                });
+                if (!st.ok()) {
+                    serialize_range(i);
+                    latch.count_down();
+                }
+            }
+            serialize_range(0);
+            latch.wait();
+            COUNTER_UPDATE(_parallel_serialize_ranges_counter, num_ranges);
+            for (size_t i = 0; i < num_ranges; ++i) {
+                RETURN_IF_ERROR(statuses[i]);
+                bytes_sent += range_bytes[i];
             }
         }
     }
@@ -32,6 +32,7 @@
 
 namespace doris {
 class BufferControlBlock;
+class MemTrackerLimiter;
 class RuntimeState;
 
 namespace vectorized {
@@ -81,12 +82,18 @@ private:
     RuntimeProfile::Counter* _sent_rows_counter = nullptr;
     // size of sent data
     RuntimeProfile::Counter* _bytes_sent_counter = nullptr;
+    // number of row ranges serialized in parallel
+    RuntimeProfile::Counter* _parallel_serialize_ranges_counter = nullptr;
     // for synchronized results
     ResultList _results;
     // If true, no block will be sent
     bool _is_dry_run = false;
 
     uint64_t _bytes_sent = 0;
+
+    // to attach the serialize tasks of the pool to the query
+    std::shared_ptr<MemTrackerLimiter> _query_mem_tracker;
+    TUniqueId _query_id;
 };
 } // namespace vectorized
 } // namespace doris
@@ -19,6 +19,8 @@
 
 #include <gen_cpp/DataSinks_types.h>
 
+#include <array>
+#include <deque>
 #include <optional>
 
 #include "util/runtime_profile.h"
@@ -31,6 +33,7 @@
 #include "vec/sink/writer/async_result_writer.h"
 #include "vec/sink/writer/iceberg/partition_data.h"
 #include "vec/sink/writer/iceberg/partition_transformers.h"
+#include "vec/spill/spill_stream.h"
 
 namespace doris {
 
@@ -92,6 +95,24 @@ private:
 
     std::vector<IcebergPartitionColumn> _to_iceberg_partition_columns();
 
+    // The rows of the partitions beyond the open writers limit are spilled to the buckets
+    // hashed by the partition path with `spill_seed`, see enable_table_sink_partition_spill.
+    Status _write_partitioned_block(vectorized::Block& output_block, int spill_seed);
+
+    // Write the spilled rows bucket by bucket at close, the writers of a bucket are closed
+    // before the next one, so every partition is written sequentially by one writer.
+    Status _write_spilled_partitions();
+
+    Status _spill_block(size_t bucket, vectorized::Block& output_block,
+                        const vectorized::IColumn::Filter& filter);
+
+    // Finish the spilling buckets, they are read by the next passes of the spilled rows.
+    Status _finish_spilling_streams(int spill_seed);
+
+    void _delete_spill_streams();
+
+    void _close_writers(Status status);
+
     std::string _partition_to_path(const doris::iceberg::StructLike& data);
     std::string _escape(const std::string& path);
     std::vector<std::string> _partition_values(const doris::iceberg::StructLike& data);
@@ -125,6 +146,12 @@ private:
     std::unordered_map<std::string, std::shared_ptr<VIcebergPartitionWriter>>
             _partitions_to_writers;
 
+    static constexpr size_t SPILL_PARTITION_BUCKETS = 16;
+    bool _enable_partition_spill = false;
+    std::array<SpillStreamSPtr, SPILL_PARTITION_BUCKETS> _spilling_streams;
+    // the finished buckets and the hash seed of their partitions
+    std::deque<std::pair<SpillStreamSPtr, int>> _spilled_streams;
+
     VExprContextSPtrs _write_output_vexpr_ctxs;
 
     Block _transformed_block;
@@ -137,6 +164,7 @@ private:
     int64_t _partition_writers_write_ns = 0;
     int64_t _close_ns = 0;
     int64_t _write_file_count = 0;
+    int64_t _written_partitions_count = 0;
 
     RuntimeProfile::Counter* _written_rows_counter = nullptr;
     RuntimeProfile::Counter* _send_data_timer = nullptr;
@@ -146,6 +174,17 @@ private:
     RuntimeProfile::Counter* _open_timer = nullptr;
     RuntimeProfile::Counter* _close_timer = nullptr;
     RuntimeProfile::Counter* _write_file_counter = nullptr;
+
+    RuntimeProfile::Counter* _spill_rows_counter = nullptr;
+    RuntimeProfile::Counter* _spill_serialize_block_timer = nullptr;
+    RuntimeProfile::Counter* _spill_write_disk_timer = nullptr;
+    RuntimeProfile::Counter* _spill_data_size = nullptr;
+    RuntimeProfile::Counter* _spill_block_count = nullptr;
+    RuntimeProfile::Counter* _spill_write_wait_io_timer = nullptr;
+    RuntimeProfile::Counter* _spill_read_data_time = nullptr;
+    RuntimeProfile::Counter* _spill_deserialize_time = nullptr;
+    RuntimeProfile::Counter* _spill_read_bytes = nullptr;
+    RuntimeProfile::Counter* _spill_read_wait_io_timer = nullptr;
 };
 } // namespace vectorized
 } // namespace doris
@@ -17,7 +17,13 @@
 
 #include "vhive_table_writer.h"
 
+#include <limits>
+
+#include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
+#include "util/defer_op.h"
+#include "util/hash_util.hpp"
+#include "util/uid_util.h"
 #include "vec/core/block.h"
 #include "vec/core/column_with_type_and_name.h"
 #include "vec/core/materialize_block.h"
@@ -25,6 +31,7 @@
 #include "vec/exprs/vexpr_context.h"
 #include "vec/sink/writer/vhive_partition_writer.h"
 #include "vec/sink/writer/vhive_utils.h"
+#include "vec/spill/spill_stream_manager.h"
 
 namespace doris {
 namespace vectorized {
@@ -54,6 +61,19 @@ Status VHiveTableWriter::open(RuntimeState* state, RuntimeProfile* profile) {
     _open_timer = ADD_TIMER(_profile, "OpenTime");
     _close_timer = ADD_TIMER(_profile, "CloseTime");
     _write_file_counter = ADD_COUNTER(_profile, "WriteFileCount", TUnit::UNIT);
+    _enable_partition_spill = config::enable_table_sink_partition_spill;
+    if (_enable_partition_spill) {
+        _spill_rows_counter = ADD_COUNTER(_profile, "SpillRows", TUnit::UNIT);
+        _spill_serialize_block_timer = ADD_TIMER(_profile, "SpillSerializeBlockTime");
+        _spill_write_disk_timer = ADD_TIMER(_profile, "SpillWriteDiskTime");
+        _spill_data_size = ADD_COUNTER(_profile, "SpillWriteDataSize", TUnit::BYTES);
+        _spill_block_count = ADD_COUNTER(_profile, "SpillWriteBlockCount", TUnit::UNIT);
+        _spill_write_wait_io_timer = ADD_TIMER(_profile, "SpillWriteWaitIOTime");
+        _spill_read_data_time = ADD_TIMER(_profile, "SpillReadDataTime");
+        _spill_deserialize_time = ADD_TIMER(_profile, "SpillDeserializeTime");
+        _spill_read_bytes = ADD_COUNTER(_profile, "SpillReadDataSize", TUnit::BYTES);
+        _spill_read_wait_io_timer = ADD_TIMER(_profile, "SpillReadWaitIOTime");
+    }
 
     SCOPED_TIMER(_open_timer);
     for (int i = 0; i < _t_sink.hive_table_sink.columns.size(); ++i) {
@@ -92,9 +112,7 @@ Status VHiveTableWriter::write(vectorized::Block& block) {
             _vec_output_expr_ctxs, block, &output_block, false));
     materialize_block_inplace(output_block);
 
-    std::unordered_map<std::shared_ptr<VHivePartitionWriter>, IColumn::Filter> writer_positions;
     _row_count += output_block.rows();
-    auto& hive_table_sink = _t_sink.hive_table_sink;
 
     if (_partition_columns_input_index.empty()) {
         std::shared_ptr<VHivePartitionWriter> writer;
@@ -136,7 +154,14 @@ Status VHiveTableWriter::write(vectorized::Block& block) {
         RETURN_IF_ERROR(writer->write(output_block));
         return Status::OK();
     }
+    return _write_partitioned_block(output_block, 0);
+}
 
+Status VHiveTableWriter::_write_partitioned_block(vectorized::Block& output_block,
+                                                  int spill_seed) {
+    std::unordered_map<std::shared_ptr<VHivePartitionWriter>, IColumn::Filter> writer_positions;
+    std::unordered_map<size_t, IColumn::Filter> spill_positions;
+    auto& hive_table_sink = _t_sink.hive_table_sink;
     {
         SCOPED_RAW_TIMER(&_partition_writers_dispatch_ns);
         for (int i = 0; i < output_block.rows(); ++i) {
@@ -173,6 +198,21 @@ Status VHiveTableWriter::write(vectorized::Block& block) {
                 std::shared_ptr<VHivePartitionWriter> writer;
                 if (_partitions_to_writers.size() + 1 >
                     config::table_sink_partition_write_max_partition_nums_per_writer) {
+                    if (_enable_partition_spill && !_partitions_to_writers.empty()) {
+                        size_t bucket = HashUtil::xxHash64WithSeed(partition_name.data(),
+                                                                   partition_name.size(),
+                                                                   spill_seed) %
+                                        SPILL_PARTITION_BUCKETS;
+                        auto spill_pos_iter = spill_positions.find(bucket);
+                        if (spill_pos_iter == spill_positions.end()) {
+                            IColumn::Filter filter(output_block.rows(), 0);
+                            filter[i] = 1;
+                            spill_positions.insert({bucket, std::move(filter)});
+                        } else {
+                            spill_pos_iter->second[i] = 1;
+                        }
+                        continue;
+                    }
                     return Status::InternalError(
                             "Too many open partitions {}",
                             config::table_sink_partition_write_max_partition_nums_per_writer);
@@ -205,6 +245,10 @@ Status VHiveTableWriter::write(vectorized::Block& block) {
             }
         }
     }
+    // the spilled rows keep the partition columns to be dispatched again
+    for (const auto& [bucket, filter] : spill_positions) {
+        RETURN_IF_ERROR(_spill_block(bucket, output_block, filter));
+    }
     SCOPED_RAW_TIMER(&_partition_writers_write_ns);
     output_block.erase(_non_write_columns_indices);
     for (auto it = writer_positions.begin(); it != writer_positions.end(); ++it) {
@@ -239,20 +283,99 @@ Status VHiveTableWriter::_filter_block(doris::vectorized::Block& block,
     return Status::OK();
 }
 
-Status VHiveTableWriter::close(Status status) {
-    int64_t partitions_to_writers_size = _partitions_to_writers.size();
-    {
-        SCOPED_RAW_TIMER(&_close_ns);
-        for (const auto& pair : _partitions_to_writers) {
-            Status st = pair.second->close(status);
-            if (st != Status::OK()) {
-                LOG(WARNING) << fmt::format("partition writer close failed for partition {}",
-                                            st.to_string());
-                continue;
+Status VHiveTableWriter::_spill_block(size_t bucket, vectorized::Block& output_block,
+                                      const vectorized::IColumn::Filter& filter) {
+    auto& stream = _spilling_streams[bucket];
+    if (stream == nullptr) {
+        RETURN_IF_ERROR(ExecEnv::GetInstance()->spill_stream_mgr()->register_spill_stream(
+                _state, stream, print_id(_state->query_id()), "hive_table_sink", 0,
+                std::numeric_limits<int32_t>::max(), std::numeric_limits<size_t>::max(),
+                _profile));
+        RETURN_IF_ERROR(stream->prepare_spill());
+        stream->set_write_counters(_spill_serialize_block_timer, _spill_block_count,
+                                   _spill_data_size, _spill_write_disk_timer,
+                                   _spill_write_wait_io_timer);
+    }
+    Block spill_block;
+    RETURN_IF_ERROR(_filter_block(output_block, &filter, &spill_block));
+    COUNTER_UPDATE(_spill_rows_counter, spill_block.rows());
+    return stream->spill_block(_state, spill_block, false);
+}
+
+Status VHiveTableWriter::_finish_spilling_streams(int spill_seed) {
+    for (auto& stream : _spilling_streams) {
+        if (stream == nullptr) {
+            continue;
+        }
+        RETURN_IF_ERROR(stream->spill_eof());
+        stream->set_read_counters(_spill_read_data_time, _spill_deserialize_time,
+                                  _spill_read_bytes, _spill_read_wait_io_timer);
+        _spilled_streams.emplace_back(std::move(stream), spill_seed);
+        stream.reset();
+    }
+    return Status::OK();
+}
+
+Status VHiveTableWriter::_write_spilled_partitions() {
+    RETURN_IF_ERROR(_finish_spilling_streams(0));
+    while (!_spilled_streams.empty()) {
+        SpillStreamSPtr stream = std::move(_spilled_streams.front().first);
+        int spill_seed = _spilled_streams.front().second;
+        _spilled_streams.pop_front();
+        Defer defer {[&]() {
+            ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(std::move(stream));
+        }};
+
+        // the partitions of a bucket never have rows in the other buckets or the open writers
+        _close_writers(Status::OK());
+        bool eos = false;
+        while (!eos) {
+            Block block;
+            RETURN_IF_ERROR(stream->read_next_block_sync(&block, &eos));
+            if (block.rows() > 0) {
+                // rehash with another seed, or the overflowed partitions stay in one bucket
+                RETURN_IF_ERROR(_write_partitioned_block(block, spill_seed + 1));
             }
         }
-        _partitions_to_writers.clear();
+        RETURN_IF_ERROR(_finish_spilling_streams(spill_seed + 1));
     }
+    return Status::OK();
+}
+
+void VHiveTableWriter::_delete_spill_streams() {
+    for (auto& stream : _spilling_streams) {
+        if (stream != nullptr) {
+            ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(std::move(stream));
+            stream.reset();
+        }
+    }
+    for (auto& [stream, spill_seed] : _spilled_streams) {
+        ExecEnv::GetInstance()->spill_stream_mgr()->delete_spill_stream(std::move(stream));
+    }
+    _spilled_streams.clear();
+}
+
+void VHiveTableWriter::_close_writers(Status status) {
+    SCOPED_RAW_TIMER(&_close_ns);
+    _written_partitions_count += _partitions_to_writers.size();
+    for (const auto& pair : _partitions_to_writers) {
+        Status st = pair.second->close(status);
+        if (st != Status::OK()) {
+            LOG(WARNING) << fmt::format("partition writer close failed for partition {}",
+                                        st.to_string());
+            continue;
+        }
+    }
+    _partitions_to_writers.clear();
+}
+
+Status VHiveTableWriter::close(Status status) {
+    Status spill_status = Status::OK();
+    if (status.ok()) {
+        spill_status = _write_spilled_partitions();
+    }
+    _close_writers(spill_status.ok() ? status : spill_status);
+    _delete_spill_streams();
     if (status.ok()) {
         SCOPED_TIMER(_profile->total_time_counter());
 
@@ -260,11 +383,11 @@ Status VHiveTableWriter::close(Status status) {
         COUNTER_SET(_send_data_timer, _send_data_ns);
         COUNTER_SET(_partition_writers_dispatch_timer, _partition_writers_dispatch_ns);
         COUNTER_SET(_partition_writers_write_timer, _partition_writers_write_ns);
-        COUNTER_SET(_partition_writers_count, partitions_to_writers_size);
+        COUNTER_SET(_partition_writers_count, _written_partitions_count);
         COUNTER_SET(_close_timer, _close_ns);
         COUNTER_SET(_write_file_counter, _write_file_count);
     }
-    return Status::OK();
+    return spill_status;
 }
 
 std::shared_ptr<VHivePartitionWriter> VHiveTableWriter::_create_partition_writer(
@@ -19,10 +19,14 @@
 
 #include <gen_cpp/DataSinks_types.h>
 
+#include <array>
+#include <deque>
+
 #include "util/runtime_profile.h"
 #include "vec/columns/column.h"
 #include "vec/exprs/vexpr_fwd.h"
 #include "vec/sink/writer/async_result_writer.h"
+#include "vec/spill/spill_stream.h"
 
 namespace doris {
 
@@ -52,6 +56,24 @@ public:
     Status close(Status) override;
 
 private:
+    // The rows of the partitions beyond the open writers limit are spilled to the buckets
+    // hashed by the partition name with `spill_seed`, see enable_table_sink_partition_spill.
+    Status _write_partitioned_block(vectorized::Block& output_block, int spill_seed);
+
+    // Write the spilled rows bucket by bucket at close, the writers of a bucket are closed
+    // before the next one, so every partition is written sequentially by one writer.
+    Status _write_spilled_partitions();
+
+    Status _spill_block(size_t bucket, vectorized::Block& output_block,
+                        const vectorized::IColumn::Filter& filter);
+
+    // Finish the spilling buckets, they are read by the next passes of the spilled rows.
+    Status _finish_spilling_streams(int spill_seed);
+
+    void _delete_spill_streams();
+
+    void _close_writers(Status status);
+
     std::shared_ptr<VHivePartitionWriter> _create_partition_writer(
             vectorized::Block& block, int position, const std::string* file_name = nullptr,
             int file_name_index = 0);
@@ -74,6 +96,12 @@ private:
     std::set<size_t> _non_write_columns_indices;
     std::unordered_map<std::string, std::shared_ptr<VHivePartitionWriter>> _partitions_to_writers;
 
+    static constexpr size_t SPILL_PARTITION_BUCKETS = 16;
+    bool _enable_partition_spill = false;
+    std::array<SpillStreamSPtr, SPILL_PARTITION_BUCKETS> _spilling_streams;
+    // the finished buckets and the hash seed of their partitions
+    std::deque<std::pair<SpillStreamSPtr, int>> _spilled_streams;
+
     VExprContextSPtrs _write_output_vexpr_ctxs;
 
     size_t _row_count = 0;
@@ -84,6 +112,7 @@ private:
     int64_t _partition_writers_write_ns = 0;
     int64_t _close_ns = 0;
     int64_t _write_file_count = 0;
+    int64_t _written_partitions_count = 0;
 
     RuntimeProfile::Counter* _written_rows_counter = nullptr;
     RuntimeProfile::Counter* _send_data_timer = nullptr;
@@ -93,6 +122,17 @@ private:
     RuntimeProfile::Counter* _open_timer = nullptr;
     RuntimeProfile::Counter* _close_timer = nullptr;
     RuntimeProfile::Counter* _write_file_counter = nullptr;
+
+    RuntimeProfile::Counter* _spill_rows_counter = nullptr;
+    RuntimeProfile::Counter* _spill_serialize_block_timer = nullptr;
+    RuntimeProfile::Counter* _spill_write_disk_timer = nullptr;
+    RuntimeProfile::Counter* _spill_data_size = nullptr;
+    RuntimeProfile::Counter* _spill_block_count = nullptr;
+    RuntimeProfile::Counter* _spill_write_wait_io_timer = nullptr;
+    RuntimeProfile::Counter* _spill_read_data_time = nullptr;
+    RuntimeProfile::Counter* _spill_deserialize_time = nullptr;
+    RuntimeProfile::Counter* _spill_read_bytes = nullptr;
+    RuntimeProfile::Counter* _spill_read_wait_io_timer = nullptr;
 };
 } // namespace vectorized
 } // namespace doris
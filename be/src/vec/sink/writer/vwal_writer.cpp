@@ -94,6 +94,7 @@ Status VWalWriter::_create_wal_writer(int64_t wal_id, std::shared_ptr<WalWriter>
     std::string wal_path;
     RETURN_IF_ERROR(_wal_manager->get_wal_path(wal_id, wal_path));
     wal_writer = std::make_shared<WalWriter>(wal_path);
+    wal_writer->set_group_syncer(_wal_manager->get_wal_group_syncer(wal_path));
     RETURN_IF_ERROR(wal_writer->init());
     return Status::OK();
 }
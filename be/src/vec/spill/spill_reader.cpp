@@ -23,15 +23,20 @@
 #include "io/file_factory.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/local_file_system.h"
+#include "io/fs/local_io_scheduler.h"
 #include "runtime/exec_env.h"
+#include "util/bvar_helper.h"
 #include "util/slice.h"
 #include "vec/core/block.h"
+#include "vec/spill/spill_stream_manager.h"
 namespace doris {
 namespace io {
 class FileSystem;
 } // namespace io
 
 namespace vectorized {
+bvar::LatencyRecorder g_spill_read_latency("spill", "read");
+
 Status SpillReader::open() {
     if (file_reader_) {
         return Status::OK();
@@ -102,25 +107,37 @@ Status SpillReader::read(Block* block, bool* eos) {
 
     Slice result(read_buff_.get(), bytes_to_read);
     size_t bytes_read = 0;
+    int64_t read_ns = 0;
     {
         SCOPED_TIMER(read_timer_);
+        SCOPED_RAW_TIMER(&read_ns);
+        SCOPED_BVAR_LATENCY(g_spill_read_latency);
+        SCOPED_IO_TAG(io::IOClass::SPILL, io::current_io_tag.workload_group_id,
+                      io::current_io_tag.workload_group_weight);
         RETURN_IF_ERROR(file_reader_->read_at(block_start_offsets_[read_block_index_], result,
                                               &bytes_read));
     }
     DCHECK(bytes_read == bytes_to_read);
     COUNTER_UPDATE(read_bytes_, bytes_read);
 
+    int64_t deserialize_ns = 0;
     if (bytes_read > 0) {
         {
             SCOPED_TIMER(deserialize_timer_);
+            SCOPED_RAW_TIMER(&deserialize_ns);
             if (!pb_block_.ParseFromArray(result.data, result.size)) {
                 return Status::InternalError("Failed to read spilled block");
             }
+            int64_t decompress_ns = block->get_decompress_time();
             RETURN_IF_ERROR(block->deserialize(pb_block_));
+            if (decompress_timer_ != nullptr) {
+                COUNTER_UPDATE(decompress_timer_, block->get_decompress_time() - decompress_ns);
+            }
         }
     } else {
         block->clear_column_data();
     }
+    data_dir_->update_read_metrics(bytes_read, read_ns / 1000, deserialize_ns);
 
     ++read_block_index_;
 
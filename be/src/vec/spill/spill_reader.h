@@ -29,10 +29,11 @@
 
 namespace doris::vectorized {
 class Block;
+class SpillDataDir;
 class SpillReader {
 public:
-    SpillReader(int64_t stream_id, std::string file_path)
-            : stream_id_(stream_id), file_path_(std::move(file_path)) {}
+    SpillReader(int64_t stream_id, SpillDataDir* data_dir, std::string file_path)
+            : stream_id_(stream_id), data_dir_(data_dir), file_path_(std::move(file_path)) {}
 
     ~SpillReader() { (void)close(); }
 
@@ -58,8 +59,14 @@ public:
         read_bytes_ = read_bytes;
     }
 
+    void set_decompress_timer(RuntimeProfile::Counter* decompress_timer) {
+        decompress_timer_ = decompress_timer;
+    }
+
 private:
     int64_t stream_id_;
+    // not owned, the io is accounted in the metrics of the dir
+    SpillDataDir* data_dir_ = nullptr;
     std::string file_path_;
     io::FileReaderSPtr file_reader_;
 
@@ -74,6 +81,7 @@ private:
     RuntimeProfile::Counter* read_timer_;
     RuntimeProfile::Counter* deserialize_timer_;
     RuntimeProfile::Counter* read_bytes_;
+    RuntimeProfile::Counter* decompress_timer_ = nullptr;
 };
 
 using SpillReaderUPtr = std::unique_ptr<SpillReader>;
@@ -23,8 +23,10 @@
 #include <mutex>
 #include <utility>
 
+#include "common/exception.h"
 #include "io/fs/local_file_system.h"
 #include "runtime/exec_env.h"
+#include "runtime/query_context.h"
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
 #include "vec/core/block.h"
@@ -43,9 +45,17 @@ SpillStream::SpillStream(RuntimeState* state, int64_t stream_id, SpillDataDir* d
           batch_rows_(batch_rows),
           batch_bytes_(batch_bytes),
           query_id_(state->query_id()),
-          profile_(profile) {}
+          profile_(profile) {
+    data_dir_->update_active_streams(1);
+}
 
 SpillStream::~SpillStream() {
+    data_dir_->update_active_streams(-1);
+    // the reader must outlive the read ahead which has started
+    if (_prefetch && _prefetch->claimed.exchange(true)) {
+        std::unique_lock lock(_prefetch->mutex);
+        _prefetch->cv.wait(lock, [this] { return _prefetch->done; });
+    }
     bool exists = false;
     auto status = io::global_local_filesystem()->exists(spill_dir_, &exists);
     if (status.ok() && exists) {
@@ -61,7 +71,18 @@ SpillStream::~SpillStream() {
 Status SpillStream::prepare() {
     writer_ = std::make_unique<SpillWriter>(stream_id_, batch_rows_, data_dir_, spill_dir_);
 
-    reader_ = std::make_unique<SpillReader>(stream_id_, writer_->get_file_path());
+    reader_ = std::make_unique<SpillReader>(stream_id_, data_dir_, writer_->get_file_path());
+
+    // The breakdown of the serialization, shared by the streams of the operator.
+    if (profile_ != nullptr) {
+        std::string parent = profile_->get_counter("Spill") != nullptr ? "Spill" : "";
+        writer_->set_compression_counters(
+                ADD_CHILD_TIMER_WITH_LEVEL(profile_, "SpillCompressTime", parent, 1),
+                ADD_CHILD_COUNTER_WITH_LEVEL(profile_, "SpillWriteUncompressedDataSize",
+                                             TUnit::BYTES, parent, 1));
+        reader_->set_decompress_timer(
+                ADD_CHILD_TIMER_WITH_LEVEL(profile_, "SpillDecompressTime", parent, 1));
+    }
     return Status::OK();
 }
 
@@ -103,7 +124,59 @@ Status SpillStream::read_next_block_sync(Block* block, bool* eos) {
     Defer defer([this] { _is_reading = false; });
 
     RETURN_IF_ERROR(reader_->open());
-    return reader_->read(block, eos);
+    if (!_prefetch) {
+        return reader_->read(block, eos);
+    }
+
+    auto context = std::move(_prefetch);
+    if (!context->claimed.exchange(true)) {
+        _read_prefetch(reader_.get(), *context);
+    } else {
+        SCOPED_TIMER(read_wait_io_timer_);
+        std::unique_lock lock(context->mutex);
+        context->cv.wait(lock, [&] { return context->done; });
+    }
+    RETURN_IF_ERROR(context->status);
+    block->swap(context->block);
+    *eos = context->eos;
+    if (!*eos) {
+        _submit_prefetch();
+    }
+    return Status::OK();
+}
+
+Status SpillStream::enable_prefetch() {
+    DCHECK(reader_ != nullptr);
+    if (!_prefetch) {
+        RETURN_IF_ERROR(reader_->open());
+        _submit_prefetch();
+    }
+    return Status::OK();
+}
+
+void SpillStream::_submit_prefetch() {
+    _prefetch = std::make_shared<PrefetchContext>();
+    auto* pool = ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool();
+    auto mem_tracker = state_->get_query_ctx()->query_mem_tracker;
+    // the read is claimed by the reader of the stream if the pool is too busy to start it
+    (void)pool->submit_func([context = _prefetch, reader = reader_.get(), mem_tracker,
+                             query_id = query_id_]() {
+        SCOPED_ATTACH_TASK_WITH_ID(mem_tracker, query_id);
+        if (!context->claimed.exchange(true)) {
+            _read_prefetch(reader, *context);
+        }
+    });
+}
+
+void SpillStream::_read_prefetch(SpillReader* reader, PrefetchContext& context) {
+    context.status = [&]() {
+        RETURN_IF_CATCH_EXCEPTION({ return reader->read(&context.block, &context.eos); });
+    }();
+    {
+        std::lock_guard lock(context.mutex);
+        context.done = true;
+    }
+    context.cv.notify_all();
 }
 
 void SpillStream::decrease_spill_data_usage() {
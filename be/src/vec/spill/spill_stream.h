@@ -17,9 +17,12 @@
 
 #pragma once
 #include <atomic>
+#include <condition_variable>
 #include <future>
 #include <memory>
+#include <mutex>
 
+#include "vec/core/block.h"
 #include "vec/spill/spill_reader.h"
 #include "vec/spill/spill_writer.h"
 
@@ -29,7 +32,6 @@ class ThreadPool;
 
 namespace vectorized {
 
-class Block;
 class SpillDataDir;
 
 class SpillStream {
@@ -61,6 +63,11 @@ public:
 
     Status read_next_block_sync(Block* block, bool* eos);
 
+    // Read the blocks ahead in the spill io thread pool, each read_next_block_sync returns the
+    // block read ahead and starts to read the next one. If the block is not read yet, it waits
+    // for the read, or reads it itself if the read has not started.
+    Status enable_prefetch();
+
     void set_write_counters(RuntimeProfile::Counter* serialize_timer,
                             RuntimeProfile::Counter* write_block_counter,
                             RuntimeProfile::Counter* write_bytes_counter,
@@ -68,6 +75,7 @@ public:
                             RuntimeProfile::Counter* wait_io_timer) {
         writer_->set_counters(serialize_timer, write_block_counter, write_bytes_counter,
                               write_timer);
+        writer_->set_wait_io_timer(wait_io_timer);
         write_wait_io_timer_ = wait_io_timer;
     }
 
@@ -86,8 +94,22 @@ public:
 private:
     friend class SpillStreamManager;
 
+    // a block read ahead, by whoever claims it first
+    struct PrefetchContext {
+        std::atomic_bool claimed = false;
+        std::mutex mutex;
+        std::condition_variable cv;
+        bool done = false;
+        Block block;
+        bool eos = false;
+        Status status;
+    };
+
     Status prepare();
 
+    void _submit_prefetch();
+    static void _read_prefetch(SpillReader* reader, PrefetchContext& context);
+
     RuntimeState* state_ = nullptr;
     int64_t stream_id_;
     SpillDataDir* data_dir_ = nullptr;
@@ -97,6 +119,7 @@ private:
     int64_t total_written_bytes_ = 0;
 
     std::atomic_bool _is_reading = false;
+    std::shared_ptr<PrefetchContext> _prefetch;
 
     SpillWriterUPtr writer_;
     SpillReaderUPtr reader_;
@@ -32,6 +32,7 @@
 #include "io/fs/local_file_system.h"
 #include "olap/olap_define.h"
 #include "runtime/runtime_state.h"
+#include "util/doris_metrics.h"
 #include "util/parse_util.h"
 #include "util/pretty_printer.h"
 #include "util/runtime_profile.h"
@@ -41,6 +42,15 @@
 
 namespace doris::vectorized {
 
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(spill_disk_write_bytes, MetricUnit::BYTES);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(spill_disk_read_bytes, MetricUnit::BYTES);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(spill_disk_serialize_time_ns, MetricUnit::NANOSECONDS);
+DEFINE_COUNTER_METRIC_PROTOTYPE_2ARG(spill_disk_deserialize_time_ns, MetricUnit::NANOSECONDS);
+DEFINE_HISTOGRAM_METRIC_PROTOTYPE_2ARG(spill_disk_write_latency_us, MetricUnit::MICROSECONDS);
+DEFINE_HISTOGRAM_METRIC_PROTOTYPE_2ARG(spill_disk_read_latency_us, MetricUnit::MICROSECONDS);
+DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(spill_disk_active_streams, MetricUnit::NOUNIT);
+DEFINE_GAUGE_METRIC_PROTOTYPE_2ARG(spill_disk_data_bytes, MetricUnit::BYTES);
+
 SpillStreamManager::SpillStreamManager(
         std::unordered_map<std::string, std::unique_ptr<vectorized::SpillDataDir>>&&
                 spill_store_map)
@@ -294,7 +304,34 @@ SpillDataDir::SpillDataDir(std::string path, int64_t capacity_bytes,
                            TStorageMedium::type storage_medium)
         : _path(std::move(path)),
           _disk_capacity_bytes(capacity_bytes),
-          _storage_medium(storage_medium) {}
+          _storage_medium(storage_medium) {
+    _spill_data_dir_metric_entity = DorisMetrics::instance()->metric_registry()->register_entity(
+            std::string("spill_data_dir.") + _path, {{"path", _path}});
+    INT_COUNTER_METRIC_REGISTER(_spill_data_dir_metric_entity, spill_disk_write_bytes);
+    INT_COUNTER_METRIC_REGISTER(_spill_data_dir_metric_entity, spill_disk_read_bytes);
+    INT_COUNTER_METRIC_REGISTER(_spill_data_dir_metric_entity, spill_disk_serialize_time_ns);
+    INT_COUNTER_METRIC_REGISTER(_spill_data_dir_metric_entity, spill_disk_deserialize_time_ns);
+    HISTOGRAM_METRIC_REGISTER(_spill_data_dir_metric_entity, spill_disk_write_latency_us);
+    HISTOGRAM_METRIC_REGISTER(_spill_data_dir_metric_entity, spill_disk_read_latency_us);
+    INT_GAUGE_METRIC_REGISTER(_spill_data_dir_metric_entity, spill_disk_active_streams);
+    INT_GAUGE_METRIC_REGISTER(_spill_data_dir_metric_entity, spill_disk_data_bytes);
+}
+
+SpillDataDir::~SpillDataDir() {
+    DorisMetrics::instance()->metric_registry()->deregister_entity(_spill_data_dir_metric_entity);
+}
+
+void SpillDataDir::update_write_metrics(int64_t bytes, int64_t latency_us, int64_t serialize_ns) {
+    spill_disk_write_bytes->increment(bytes);
+    spill_disk_write_latency_us->add(latency_us);
+    spill_disk_serialize_time_ns->increment(serialize_ns);
+}
+
+void SpillDataDir::update_read_metrics(int64_t bytes, int64_t latency_us, int64_t deserialize_ns) {
+    spill_disk_read_bytes->increment(bytes);
+    spill_disk_read_latency_us->add(latency_us);
+    spill_disk_deserialize_time_ns->increment(deserialize_ns);
+}
 
 Status SpillDataDir::init() {
     bool exists = false;
@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "olap/options.h"
+#include "util/metrics.h"
 #include "util/threadpool.h"
 #include "vec/spill/spill_stream.h"
 namespace doris {
@@ -37,6 +38,8 @@ public:
     SpillDataDir(std::string path, int64_t capacity_bytes,
                  TStorageMedium::type storage_medium = TStorageMedium::HDD);
 
+    ~SpillDataDir();
+
     Status init();
 
     const std::string& path() const { return _path; }
@@ -52,6 +55,7 @@ public:
     void update_spill_data_usage(int64_t incoming_data_size) {
         std::lock_guard<std::mutex> l(_mutex);
         _spill_data_bytes += incoming_data_size;
+        spill_disk_data_bytes->set_value(_spill_data_bytes);
     }
 
     int64_t get_spill_data_bytes() {
@@ -66,6 +70,12 @@ public:
 
     std::string debug_string();
 
+    // The io of the spill streams of this dir, exported as the metrics of the dir, whose rates
+    // are its throughput.
+    void update_write_metrics(int64_t bytes, int64_t latency_us, int64_t serialize_ns);
+    void update_read_metrics(int64_t bytes, int64_t latency_us, int64_t deserialize_ns);
+    void update_active_streams(int64_t delta) { spill_disk_active_streams->increment(delta); }
+
 private:
     bool _reach_disk_capacity_limit(int64_t incoming_data_size);
     double _get_disk_usage(int64_t incoming_data_size) const {
@@ -87,6 +97,16 @@ private:
     size_t _available_bytes = 0;
     int64_t _spill_data_bytes = 0;
     TStorageMedium::type _storage_medium;
+
+    std::shared_ptr<MetricEntity> _spill_data_dir_metric_entity;
+    IntCounter* spill_disk_write_bytes = nullptr;
+    IntCounter* spill_disk_read_bytes = nullptr;
+    IntCounter* spill_disk_serialize_time_ns = nullptr;
+    IntCounter* spill_disk_deserialize_time_ns = nullptr;
+    HistogramMetric* spill_disk_write_latency_us = nullptr;
+    HistogramMetric* spill_disk_read_latency_us = nullptr;
+    IntGauge* spill_disk_active_streams = nullptr;
+    IntGauge* spill_disk_data_bytes = nullptr;
 };
 class SpillStreamManager {
 public:
@@ -18,15 +18,29 @@
 #include "vec/spill/spill_writer.h"
 
 #include "agent/be_exec_version_manager.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "io/fs/local_file_system.h"
+#include "io/fs/local_io_scheduler.h"
 #include "io/fs/local_file_writer.h"
 #include "runtime/exec_env.h"
+#include "runtime/query_context.h"
 #include "runtime/runtime_state.h"
 #include "runtime/thread_context.h"
+#include "util/bvar_helper.h"
 #include "vec/spill/spill_stream_manager.h"
 
 namespace doris::vectorized {
+bvar::LatencyRecorder g_spill_write_latency("spill", "write");
+
+SpillWriter::~SpillWriter() {
+    // the buffers in flight are dropped, but the append in progress must finish before the
+    // file writer is destroyed
+    std::unique_lock lock(flush_mutex_);
+    flush_queue_.clear();
+    flush_cv_.wait(lock, [this] { return !appending_ && !flush_task_pending_; });
+}
+
 Status SpillWriter::open() {
     if (file_writer_) {
         return Status::OK();
@@ -39,15 +53,19 @@ Status SpillWriter::close() {
         return Status::OK();
     }
     closed_ = true;
+    RETURN_IF_ERROR(_wait_for_flush(0));
 
     meta_.append((const char*)&max_sub_block_size_, sizeof(max_sub_block_size_));
     meta_.append((const char*)&written_blocks_, sizeof(written_blocks_));
 
     // meta: block1 offset, block2 offset, ..., blockn offset, max_sub_block_size, n
+    int64_t write_ns = 0;
     {
         SCOPED_TIMER(write_timer_);
+        SCOPED_RAW_TIMER(&write_ns);
         RETURN_IF_ERROR(file_writer_->append(meta_));
     }
+    data_dir_->update_write_metrics(meta_.size(), write_ns / 1000, 0);
 
     total_written_bytes_ += meta_.size();
     COUNTER_UPDATE(write_bytes_counter_, meta_.size());
@@ -66,7 +84,7 @@ Status SpillWriter::write(RuntimeState* state, const Block& block, size_t& writt
     auto rows = block.rows();
     // file format: block1, block2, ..., blockn, meta
     if (rows <= batch_size_) {
-        return _write_internal(block, written_bytes);
+        return _write_internal(state, block, written_bytes);
     } else {
         auto tmp_block = block.clone_empty();
         const auto& src_data = block.get_columns_with_type_and_name();
@@ -84,7 +102,7 @@ Status SpillWriter::write(RuntimeState* state, const Block& block, size_t& writt
                 }
             });
 
-            RETURN_IF_ERROR(_write_internal(tmp_block, written_bytes));
+            RETURN_IF_ERROR(_write_internal(state, tmp_block, written_bytes));
 
             row_idx += block_rows;
         }
@@ -92,21 +110,29 @@ Status SpillWriter::write(RuntimeState* state, const Block& block, size_t& writt
     }
 }
 
-Status SpillWriter::_write_internal(const Block& block, size_t& written_bytes) {
+Status SpillWriter::_write_internal(RuntimeState* state, const Block& block,
+                                    size_t& written_bytes) {
     size_t uncompressed_bytes = 0, compressed_bytes = 0;
 
     Status status;
-    std::string buff;
+    Buffer buffer;
+    std::string& buff = buffer.data;
 
     if (block.rows() > 0) {
         {
             PBlock pblock;
             SCOPED_TIMER(serialize_timer_);
+            SCOPED_RAW_TIMER(&buffer.serialize_ns);
+            int64_t compress_ns = block.get_compress_time();
             status = block.serialize(
                     BeExecVersionManager::get_newest_version(), &pblock, &uncompressed_bytes,
                     &compressed_bytes,
                     segment_v2::CompressionTypePB::ZSTD); // ZSTD for better compression ratio
             RETURN_IF_ERROR(status);
+            if (compress_timer_ != nullptr) {
+                COUNTER_UPDATE(compress_timer_, block.get_compress_time() - compress_ns);
+                COUNTER_UPDATE(uncompressed_bytes_counter_, uncompressed_bytes);
+            }
             if (!pblock.SerializeToString(&buff)) {
                 return Status::Error<ErrorCode::SERIALIZE_PROTOBUF_ERROR>(
                         "serialize spill data error. [path={}]", file_path_);
@@ -121,21 +147,16 @@ Status SpillWriter::_write_internal(const Block& block, size_t& written_bytes) {
                     PrettyPrinter::print_bytes(data_dir_->get_spill_data_bytes()));
         }
 
-        {
-            Defer defer {[&]() {
-                if (status.ok()) {
-                    data_dir_->update_spill_data_usage(buff.size());
-                }
-            }};
-            {
-                SCOPED_TIMER(write_timer_);
-                status = file_writer_->append(buff);
-                RETURN_IF_ERROR(status);
-            }
-        }
+        buffer.io_tag = {io::IOClass::SPILL, io::current_io_tag.workload_group_id,
+                         io::current_io_tag.workload_group_weight};
     }
 
     auto buff_size = buff.size();
+    if (buff_size > 0) {
+        // the usage counts the buffers in flight, so that their bytes are in the capacity check
+        RETURN_IF_ERROR(_write_buffer(state, std::move(buffer)));
+        data_dir_->update_spill_data_usage(buff_size);
+    }
     written_bytes += buff_size;
     max_sub_block_size_ = std::max(max_sub_block_size_, buff_size);
 
@@ -148,4 +169,96 @@ Status SpillWriter::_write_internal(const Block& block, size_t& written_bytes) {
     return Status::OK();
 }
 
+Status SpillWriter::_write_buffer(RuntimeState* state, Buffer buffer) {
+    auto max_in_flight_bytes = config::spill_write_max_in_flight_bytes;
+    if (max_in_flight_bytes <= 0 || state->get_query_ctx() == nullptr) {
+        return _append(buffer);
+    }
+    // a buffer larger than the window is appended alone
+    size_t size = buffer.data.size();
+    auto max_bytes = std::max<int64_t>(max_in_flight_bytes - static_cast<int64_t>(size), 0);
+    RETURN_IF_ERROR(_wait_for_flush(max_bytes));
+    {
+        std::lock_guard lock(flush_mutex_);
+        in_flight_bytes_ += size;
+        flush_queue_.push_back(std::move(buffer));
+        if (appending_ || flush_task_pending_) {
+            return Status::OK();
+        }
+        flush_task_pending_ = true;
+    }
+
+    auto* pool = ExecEnv::GetInstance()->spill_stream_mgr()->get_spill_io_thread_pool();
+    auto status = pool->submit_func([this, mem_tracker = state->get_query_ctx()->query_mem_tracker,
+                                     query_id = state->query_id()]() {
+        SCOPED_ATTACH_TASK_WITH_ID(mem_tracker, query_id);
+        std::unique_lock lock(flush_mutex_);
+        flush_task_pending_ = false;
+        _flush_buffers(lock);
+    });
+    std::unique_lock lock(flush_mutex_);
+    if (!status.ok()) {
+        // the pool is too busy, so the buffers are appended here
+        flush_task_pending_ = false;
+        _flush_buffers(lock);
+    }
+    return flush_status_;
+}
+
+Status SpillWriter::_append(const Buffer& buffer) {
+    const auto& buff = buffer.data;
+    int64_t write_ns = 0;
+    {
+        SCOPED_TIMER(write_timer_);
+        SCOPED_RAW_TIMER(&write_ns);
+        SCOPED_BVAR_LATENCY(g_spill_write_latency);
+        SCOPED_IO_TAG(buffer.io_tag.io_class, buffer.io_tag.workload_group_id,
+                      buffer.io_tag.workload_group_weight);
+        RETURN_IF_ERROR(file_writer_->append(buff));
+    }
+    data_dir_->update_write_metrics(buff.size(), write_ns / 1000, buffer.serialize_ns);
+    return Status::OK();
+}
+
+void SpillWriter::_flush_buffers(std::unique_lock<std::mutex>& lock) {
+    if (appending_) {
+        flush_cv_.notify_all();
+        return;
+    }
+    appending_ = true;
+    while (!flush_queue_.empty()) {
+        auto buffer = std::move(flush_queue_.front());
+        flush_queue_.pop_front();
+        // the buffers after a failed append are dropped
+        bool failed = !flush_status_.ok();
+        lock.unlock();
+        Status status = failed ? Status::OK() : _append(buffer);
+        lock.lock();
+        if (!status.ok()) {
+            flush_status_ = status;
+        }
+        in_flight_bytes_ -= buffer.data.size();
+        flush_cv_.notify_all();
+    }
+    appending_ = false;
+    flush_cv_.notify_all();
+}
+
+Status SpillWriter::_wait_for_flush(size_t max_bytes) {
+    std::unique_lock lock(flush_mutex_);
+    if (in_flight_bytes_ > max_bytes) {
+        SCOPED_TIMER(wait_io_timer_);
+        while (in_flight_bytes_ > max_bytes) {
+            // The buffers are appended here if no one appends them, e.g. the flush task waits in
+            // the queue of the spill io thread pool behind the spill tasks which wait for it.
+            if (!appending_) {
+                _flush_buffers(lock);
+            } else {
+                flush_cv_.wait(lock);
+            }
+        }
+    }
+    return flush_status_;
+}
+
 } // namespace doris::vectorized
\ No newline at end of file
@@ -18,10 +18,14 @@
 #pragma once
 
 #include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
 
 #include "io/fs/file_writer.h"
+#include "io/fs/local_io_scheduler.h"
 #include "util/runtime_profile.h"
 #include "vec/core/block.h"
 namespace doris {
@@ -36,10 +40,16 @@ public:
         file_path_ = dir + "/" + std::to_string(file_index_);
     }
 
+    ~SpillWriter();
+
     Status open();
 
+    // Waits for the blocks written in the background before it writes the meta.
     Status close();
 
+    // Serializes the block, whose buffer is appended to the file in the spill io thread pool
+    // while the next blocks are serialized, up to config::spill_write_max_in_flight_bytes of
+    // buffers. The errors of the appends are returned by the next write or close.
     Status write(RuntimeState* state, const Block& block, size_t& written_bytes);
 
     int64_t get_id() const { return stream_id_; }
@@ -58,10 +68,42 @@ public:
         write_timer_ = write_timer;
     }
 
+    // The time of the compression in the serialization, and the bytes before the compression.
+    void set_compression_counters(RuntimeProfile::Counter* compress_timer,
+                                  RuntimeProfile::Counter* uncompressed_bytes_counter) {
+        compress_timer_ = compress_timer;
+        uncompressed_bytes_counter_ = uncompressed_bytes_counter;
+    }
+
+    // The time the writes wait for the buffers in flight to be appended.
+    void set_wait_io_timer(RuntimeProfile::Counter* wait_io_timer) {
+        wait_io_timer_ = wait_io_timer;
+    }
+
 private:
+    // A serialized block with the IO tag of the thread which serialized it.
+    struct Buffer {
+        std::string data;
+        int64_t serialize_ns = 0;
+        io::IOTag io_tag;
+    };
+
     void _init_profile();
 
-    Status _write_internal(const Block& block, size_t& written_bytes);
+    Status _write_internal(RuntimeState* state, const Block& block, size_t& written_bytes);
+
+    // Appends the buffer in the background, or here if there is no window of buffers in flight.
+    Status _write_buffer(RuntimeState* state, Buffer buffer);
+
+    Status _append(const Buffer& buffer);
+
+    // Appends the buffers in flight, in order, until there is none, unless another thread is
+    // appending them. Called with flush_mutex_ locked by the lock.
+    void _flush_buffers(std::unique_lock<std::mutex>& lock);
+
+    // Waits until the buffers in flight take at most max_bytes, and returns the first error of
+    // their appends.
+    Status _wait_for_flush(size_t max_bytes);
 
     // not owned, point to the data dir of this rowset
     // for checking disk capacity when write data to disk.
@@ -82,6 +124,19 @@ private:
     RuntimeProfile::Counter* serialize_timer_;
     RuntimeProfile::Counter* write_timer_;
     RuntimeProfile::Counter* write_block_counter_;
+    RuntimeProfile::Counter* compress_timer_ = nullptr;
+    RuntimeProfile::Counter* uncompressed_bytes_counter_ = nullptr;
+    RuntimeProfile::Counter* wait_io_timer_ = nullptr;
+
+    // The buffers in flight, appended by a task of the spill io thread pool, or by a write which
+    // waits for them, one thread at a time.
+    std::mutex flush_mutex_;
+    std::condition_variable flush_cv_;
+    std::deque<Buffer> flush_queue_;
+    size_t in_flight_bytes_ = 0;
+    bool appending_ = false;
+    bool flush_task_pending_ = false;
+    Status flush_status_;
 };
 using SpillWriterUPtr = std::unique_ptr<SpillWriter>;
 } // namespace vectorized
@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "exprs/block_bloom_filter.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "util/cpu_info.h"
+
+namespace doris {
+
+class BlockBloomFilterTest : public testing::Test {
+public:
+    void SetUp() override {
+        ASSERT_TRUE(_bf.init(12, 0).ok());
+        std::mt19937 rng(42);
+        for (int i = 0; i < 1000; ++i) {
+            _bf.insert(rng());
+        }
+        // the inserted hashes followed by other ones, some of which are false positives
+        rng.seed(42);
+        for (int i = 0; i < 2001; ++i) {
+            _hashes.push_back(rng());
+        }
+    }
+
+protected:
+    void _check_find_batch() {
+        std::vector<uint8_t> results(_hashes.size());
+        _bf.find_batch(_hashes.data(), _hashes.size(), results.data());
+        for (size_t i = 0; i < _hashes.size(); ++i) {
+            ASSERT_EQ(_bf.find(_hashes[i]), results[i]) << i;
+            if (i < 1000) {
+                ASSERT_TRUE(results[i]);
+            }
+        }
+    }
+
+    BlockBloomFilter _bf;
+    std::vector<uint32_t> _hashes;
+};
+
+TEST_F(BlockBloomFilterTest, find_batch) {
+    _check_find_batch();
+    if (CpuInfo::is_supported(CpuInfo::AVX512F)) {
+        CpuInfo::TempDisable disable_avx512(CpuInfo::AVX512F);
+        _check_find_batch();
+    }
+}
+
+TEST_F(BlockBloomFilterTest, find_batch_always_false) {
+    BlockBloomFilter bf;
+    ASSERT_TRUE(bf.init(12, 0).ok());
+    std::vector<uint8_t> results(_hashes.size(), 1);
+    bf.find_batch(_hashes.data(), _hashes.size(), results.data());
+    for (uint8_t result : results) {
+        ASSERT_FALSE(result);
+    }
+}
+
+} // namespace doris
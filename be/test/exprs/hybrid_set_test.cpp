@@ -19,7 +19,10 @@
 
 #include <gtest/gtest.h>
 
+#include <limits>
+#include <set>
 #include <string>
+#include <vector>
 
 #include "common/config.h"
 #include "exprs/create_predicate_function.h"
@@ -327,4 +330,46 @@ TEST_F(HybridSetTest, string) {
     EXPECT_FALSE(set->find(&b));
 }
 
+template <typename T>
+void check_dense_container(const std::vector<T>& values, bool dense) {
+    DynamicContainer<T> container;
+    std::set<T> expected;
+    for (T value : values) {
+        container.insert(value);
+        expected.insert(value);
+    }
+    EXPECT_EQ(dense, container.is_dense());
+    EXPECT_EQ(expected.size(), container.size());
+    for (T value : expected) {
+        for (T probe : {T(value - 1), value, T(value + 1)}) {
+            EXPECT_EQ(expected.count(probe) > 0, container.find(probe)) << probe;
+        }
+    }
+    for (T probe : {std::numeric_limits<T>::min(), std::numeric_limits<T>::max(), T(0)}) {
+        EXPECT_EQ(expected.count(probe) > 0, container.find(probe)) << probe;
+    }
+}
+
+TEST_F(HybridSetTest, dense_container) {
+    std::vector<int32_t> ascending;
+    std::vector<int32_t> descending;
+    for (int32_t i = 0; i < 5000; i += 3) {
+        ascending.push_back(i - 1000);
+        descending.push_back(1000 - i);
+    }
+    check_dense_container(ascending, true);
+    check_dense_container(descending, true);
+
+    // the range close to the limits of the type
+    check_dense_container<int32_t>({std::numeric_limits<int32_t>::max(), 2147483000}, true);
+    check_dense_container<int64_t>({std::numeric_limits<int64_t>::min(), -9223372036854775000},
+                                   true);
+    check_dense_container<int8_t>({-128, 127, 0, 1}, true);
+    check_dense_container<uint32_t>({0, 65535, 7}, true);
+
+    // too wide to be a bitmap
+    check_dense_container<int32_t>({-1, 100000, 3}, false);
+    check_dense_container<int64_t>({std::numeric_limits<int64_t>::min(), 0}, false);
+}
+
 } // namespace doris
@@ -130,6 +130,28 @@ TEST_F(GeoTypesTest, polygon_contains) {
     }
 }
 
+TEST_F(GeoTypesTest, polygon_covering) {
+    const char* wkt = "POLYGON ((10 10, 50 10, 50 50, 10 50, 10 10))";
+    GeoParseStatus status;
+    std::unique_ptr<GeoShape> polygon(GeoShape::from_wkt(wkt, strlen(wkt), &status));
+    ASSERT_NE(nullptr, polygon.get());
+    polygon->build_covering();
+
+    GeoPoint inside;
+    inside.from_coord(20, 20);
+    EXPECT_TRUE(polygon->may_contain(&inside));
+    EXPECT_TRUE(polygon->contains(&inside));
+
+    GeoPoint edge;
+    edge.from_coord(50, 30);
+    EXPECT_TRUE(polygon->may_contain(&edge));
+
+    GeoPoint far;
+    far.from_coord(-120, -60);
+    EXPECT_FALSE(polygon->may_contain(&far));
+    EXPECT_FALSE(polygon->contains(&far));
+}
+
 TEST_F(GeoTypesTest, polygon_parse_fail) {
     {
         const char* wkt = "POLYGON ((10 10, 50 10, 50 50, 10 50), (10 10 01))";
@@ -25,6 +25,9 @@
 #include <unistd.h>
 
 #include <boost/algorithm/string/predicate.hpp>
+#include <fstream>
+#include <iterator>
+#include <string>
 
 #include "gtest/gtest_pred_impl.h"
 #include "http/ev_http_server.h"
@@ -119,6 +122,7 @@ public:
         s_server->register_handler(POST, "/simple_post", &s_simple_post_handler);
         s_server->register_handler(GET, "/not_found", &s_not_found_handler);
         s_server->register_handler(HEAD, "/download_file", &s_download_file_handler);
+        s_server->register_handler(GET, "/download_file", &s_download_file_handler);
         static_cast<void>(s_server->start());
         real_port = s_server->get_real_port();
         EXPECT_NE(0, real_port);
@@ -299,4 +303,27 @@ TEST_F(HttpClientTest, download_file_md5) {
     close(fd);
 }
 
+TEST_F(HttpClientTest, resume_download) {
+    std::ifstream exe("/proc/self/exe", std::ios::binary);
+    std::string content((std::istreambuf_iterator<char>(exe)), std::istreambuf_iterator<char>());
+    ASSERT_GT(content.size(), 1024);
+
+    // the partial file left by a failed download
+    std::string local_file = ".http_client_resume_test.dat";
+    {
+        std::ofstream out(local_file, std::ios::binary);
+        out.write(content.data(), 1024);
+    }
+    HttpClient client;
+    ASSERT_TRUE(client.init(hostname + "/download_file").ok());
+    auto st = client.download(local_file, 1024);
+    EXPECT_TRUE(st.ok()) << st;
+    EXPECT_EQ(206, client.get_http_status());
+
+    std::ifstream in(local_file, std::ios::binary);
+    std::string downloaded((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(content, downloaded);
+    unlink(local_file.c_str());
+}
+
 } // namespace doris
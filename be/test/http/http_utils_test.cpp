@@ -15,10 +15,12 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <event2/buffer.h>
 #include <event2/http.h>
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 
+#include <memory>
 #include <string>
 
 #include "gtest/gtest_pred_impl.h"
@@ -96,4 +98,48 @@ TEST_F(HttpUtilsTest, parse_basic_auth) {
     }
 }
 
+TEST_F(HttpUtilsTest, parse_range_header) {
+    int64_t offset = -1;
+    int64_t length = -1;
+    EXPECT_TRUE(parse_range_header("bytes=0-", 100, &offset, &length));
+    EXPECT_EQ(0, offset);
+    EXPECT_EQ(100, length);
+    EXPECT_TRUE(parse_range_header("bytes=10-19", 100, &offset, &length));
+    EXPECT_EQ(10, offset);
+    EXPECT_EQ(10, length);
+    // the last byte is past the end of the file
+    EXPECT_TRUE(parse_range_header("bytes=90-200", 100, &offset, &length));
+    EXPECT_EQ(90, offset);
+    EXPECT_EQ(10, length);
+
+    EXPECT_FALSE(parse_range_header("bytes=100-", 100, &offset, &length));
+    EXPECT_FALSE(parse_range_header("bytes=20-10", 100, &offset, &length));
+    EXPECT_FALSE(parse_range_header("bytes=-10", 100, &offset, &length));
+    EXPECT_FALSE(parse_range_header("bytes=0-10,20-30", 100, &offset, &length));
+    EXPECT_FALSE(parse_range_header("bytes=a-", 100, &offset, &length));
+    EXPECT_FALSE(parse_range_header("items=0-", 100, &offset, &length));
+}
+
+TEST_F(HttpUtilsTest, remove_evbuffer_front) {
+    std::unique_ptr<evbuffer, decltype(&evbuffer_free)> buf(evbuffer_new(), evbuffer_free);
+    std::string large(16 * 1024, 'a');
+    std::string small(100, 'b');
+    evbuffer_add(buf.get(), large.data(), large.size());
+    evbuffer_add(buf.get(), small.data(), small.size());
+
+    std::string body;
+    while (evbuffer_get_length(buf.get()) > 0) {
+        auto bb = remove_evbuffer_front(buf.get(), 64);
+        ASSERT_TRUE(bb->has_remaining());
+        body.append(bb->ptr + bb->pos, bb->remaining());
+    }
+    EXPECT_EQ(large + small, body);
+
+    // a small chain is copied
+    evbuffer_add(buf.get(), small.data(), small.size());
+    auto bb = remove_evbuffer_front(buf.get(), 64);
+    EXPECT_EQ(64, bb->remaining());
+    EXPECT_EQ(small.size() - 64, evbuffer_get_length(buf.get()));
+}
+
 } // namespace doris
@@ -4096,4 +4096,151 @@ TEST_F(BlockFileCacheTest, recyle_unvalid_ttl_async) {
     }
 }
 
+TEST_F(BlockFileCacheTest, shard_settings) {
+    io::FileCacheSettings settings = get_file_cache_settings(100 * 1024 * 1024, 40 * 1024 * 1024);
+    auto shard_settings = FileCacheFactory::get_shard_settings(settings, 4);
+    EXPECT_EQ(shard_settings.capacity, settings.capacity / 4);
+    EXPECT_EQ(shard_settings.max_query_cache_size, settings.max_query_cache_size / 4);
+    EXPECT_EQ(shard_settings.query_queue_size, settings.query_queue_size / 4);
+    EXPECT_EQ(shard_settings.index_queue_size, settings.index_queue_size / 4);
+    EXPECT_EQ(shard_settings.disposable_queue_size, settings.disposable_queue_size / 4);
+    EXPECT_EQ(shard_settings.max_file_block_size, settings.max_file_block_size);
+    EXPECT_GE(shard_settings.query_queue_elements, REMOTE_FS_OBJECTS_CACHE_DEFAULT_ELEMENTS);
+
+    EXPECT_EQ(FileCacheFactory::get_shard_path("/path/to/file_cache", 1, 4),
+              "/path/to/file_cache/shard_1_of_4");
+    EXPECT_EQ(FileCacheFactory::get_shard_path("/path/to/file_cache/", 0, 2),
+              "/path/to/file_cache/shard_0_of_2");
+}
+
+
+TEST_F(BlockFileCacheTest, evict_second_chance) {
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+    doris::config::enable_file_cache_query_limit = false;
+    config::file_cache_max_evict_second_chances = 1;
+    fs::create_directories(cache_base_path);
+    io::FileCacheSettings settings;
+    settings.index_queue_elements = 0;
+    settings.index_queue_size = 0;
+    settings.disposable_queue_size = 0;
+    settings.disposable_queue_elements = 0;
+    settings.query_queue_size = 30;
+    settings.query_queue_elements = 5;
+    settings.max_file_block_size = 10;
+    settings.max_query_cache_size = 30;
+    settings.capacity = 30;
+    io::BlockFileCache cache(cache_base_path, settings);
+    ASSERT_TRUE(cache.initialize());
+    for (int i = 0; i < 100; i++) {
+        if (cache.get_lazy_open_success()) {
+            break;
+        };
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    io::CacheContext context;
+    context.cache_type = io::FileCacheType::NORMAL;
+    auto key = io::BlockFileCache::hash("key1");
+    auto add_block = [&](size_t offset) {
+        auto holder = cache.get_or_set(key, offset, 10, context);
+        auto blocks = fromHolder(holder);
+        ASSERT_EQ(blocks.size(), 1);
+        assert_range(1, blocks[0], io::FileBlock::Range(offset, offset + 9),
+                     io::FileBlock::State::EMPTY);
+        ASSERT_TRUE(blocks[0]->get_or_set_downloader() == io::FileBlock::get_caller_id());
+        download(blocks[0]);
+    };
+    auto check_block = [&](size_t offset, io::FileBlock::State state) {
+        auto holder = cache.get_or_set(key, offset, 10, context);
+        auto blocks = fromHolder(holder);
+        ASSERT_EQ(blocks.size(), 1);
+        assert_range(2, blocks[0], io::FileBlock::Range(offset, offset + 9), state);
+    };
+    add_block(0);
+    /// [0, 9] is read again, it is the head of the lru queue after [10, 29] are added
+    check_block(0, io::FileBlock::State::DOWNLOADED);
+    add_block(10);
+    add_block(20);
+    /// [10, 19] is evicted instead of [0, 9]
+    add_block(30);
+    check_block(0, io::FileBlock::State::DOWNLOADED);
+    check_block(10, io::FileBlock::State::EMPTY);
+    config::file_cache_max_evict_second_chances = 0;
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+}
+
+
+TEST_F(BlockFileCacheTest, meta_snapshot) {
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+    fs::create_directories(cache_base_path);
+    config::file_cache_meta_snapshot_interval_sec = 3600;
+    io::FileCacheSettings settings;
+    settings.index_queue_elements = 0;
+    settings.index_queue_size = 0;
+    settings.disposable_queue_size = 0;
+    settings.disposable_queue_elements = 0;
+    settings.query_queue_size = 30;
+    settings.query_queue_elements = 5;
+    settings.max_file_block_size = 10;
+    settings.max_query_cache_size = 30;
+    settings.capacity = 30;
+    io::CacheContext context;
+    context.cache_type = io::FileCacheType::NORMAL;
+    auto key = io::BlockFileCache::hash("key1");
+    auto wait_lazy_open = [](io::BlockFileCache& cache) {
+        for (int i = 0; i < 100; i++) {
+            if (cache.get_lazy_open_success()) {
+                break;
+            };
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    };
+    {
+        io::BlockFileCache cache(cache_base_path, settings);
+        ASSERT_TRUE(cache.initialize());
+        wait_lazy_open(cache);
+        for (size_t offset : {0, 10}) {
+            auto holder = cache.get_or_set(key, offset, 10, context);
+            auto blocks = fromHolder(holder);
+            ASSERT_EQ(blocks.size(), 1);
+            ASSERT_TRUE(blocks[0]->get_or_set_downloader() == io::FileBlock::get_caller_id());
+            download(blocks[0]);
+        }
+        ASSERT_TRUE(cache._storage->write_meta_snapshot(&cache).ok());
+    }
+    ASSERT_TRUE(fs::exists(fs::path(cache_base_path) / "meta_snapshot"));
+    /// the file of [10, 19] is lost after the snapshot was written
+    {
+        FSFileCacheStorage storage;
+        storage._cache_base_path = cache_base_path;
+        fs::remove(FSFileCacheStorage::get_path_in_local_cache(
+                storage.get_path_in_local_cache(key, 0), 10, io::FileCacheType::NORMAL));
+    }
+    {
+        io::BlockFileCache cache(cache_base_path, settings);
+        ASSERT_TRUE(cache.initialize());
+        wait_lazy_open(cache);
+        /// wait for the scan verifying the snapshot
+        if (auto storage = dynamic_cast<FSFileCacheStorage*>(cache._storage.get());
+            storage != nullptr) {
+            storage->_cache_background_load_thread.join();
+        }
+        EXPECT_EQ(cache._cur_cache_size, 10);
+        auto holder = cache.get_or_set(key, 0, 20, context);
+        auto blocks = fromHolder(holder);
+        ASSERT_EQ(blocks.size(), 2);
+        assert_range(1, blocks[0], io::FileBlock::Range(0, 9), io::FileBlock::State::DOWNLOADED);
+        assert_range(2, blocks[1], io::FileBlock::Range(10, 19), io::FileBlock::State::EMPTY);
+    }
+    config::file_cache_meta_snapshot_interval_sec = 0;
+    if (fs::exists(cache_base_path)) {
+        fs::remove_all(cache_base_path);
+    }
+}
+
 } // namespace doris::io
@@ -0,0 +1,57 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/cache/file_block_mem_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <memory>
+
+#include "io/cache/block_file_cache.h"
+
+namespace doris::io {
+
+TEST(FileBlockMemCacheTest, read) {
+    FileBlockMemCache cache(1024 * 1024);
+    auto hash = BlockFileCache::hash("file_block_mem_cache_test");
+    auto other_hash = BlockFileCache::hash("file_block_mem_cache_test_other");
+    EXPECT_NE(FileBlockMemCache::encode_key(hash, 0), FileBlockMemCache::encode_key(hash, 1024));
+    EXPECT_NE(FileBlockMemCache::encode_key(hash, 0),
+              FileBlockMemCache::encode_key(other_hash, 0));
+
+    char buf[16];
+    EXPECT_FALSE(cache.read(hash, 1024, 0, Slice(buf, sizeof(buf))));
+
+    std::unique_ptr<char[]> data(new char[64]);
+    for (int i = 0; i < 64; ++i) {
+        data[i] = static_cast<char>(i);
+    }
+    cache.insert(hash, 1024, std::move(data), 64);
+
+    EXPECT_TRUE(cache.read(hash, 1024, 8, Slice(buf, sizeof(buf))));
+    for (int i = 0; i < sizeof(buf); ++i) {
+        EXPECT_EQ(buf[i], static_cast<char>(8 + i));
+    }
+    // out of the cached block
+    EXPECT_FALSE(cache.read(hash, 1024, 56, Slice(buf, sizeof(buf))));
+    // another block of the key or another key
+    EXPECT_FALSE(cache.read(hash, 0, 0, Slice(buf, sizeof(buf))));
+    EXPECT_FALSE(cache.read(other_hash, 1024, 0, Slice(buf, sizeof(buf))));
+}
+
+} // namespace doris::io
@@ -25,10 +25,12 @@
 #include <memory>
 #include <ostream>
 
+#include "common/config.h"
 #include "gtest/gtest_pred_impl.h"
 #include "io/fs/file_reader_writer_fwd.h"
 #include "io/fs/local_file_system.h"
 #include "runtime/exec_env.h"
+#include "util/defer_op.h"
 #include "util/stopwatch.hpp"
 #include "util/threadpool.h"
 
@@ -398,4 +400,47 @@ TEST_F(BufferedReaderTest, test_merged_io) {
     }
 }
 
+
+TEST_F(BufferedReaderTest, test_io_cost_estimator) {
+    io::IOCostEstimator estimator(20000, 100L * 1024 * 1024);
+    EXPECT_EQ(estimator.break_even_bytes(), 20000L * 100 * 1024 * 1024 / 1000000);
+    // small reads converge the latency
+    for (int i = 0; i < 100; ++i) {
+        estimator.update(4 * 1024, 100 * 1000);
+    }
+    EXPECT_NEAR(estimator.latency_us(), 100, 10);
+    // large reads converge the bandwidth, 8MB in 100us + 8ms is 1GB/s
+    for (int i = 0; i < 100; ++i) {
+        estimator.update(8 * 1024 * 1024, (100 + 8 * 1000) * 1000);
+    }
+    EXPECT_NEAR(estimator.bytes_per_second(), 1000L * 1024 * 1024, 10L * 1024 * 1024);
+    auto mock_reader = std::make_shared<MockOffsetFileReader>(1);
+    EXPECT_EQ(io::IOCostEstimator::storage_kind(mock_reader.get()), io::IOCostEstimator::OTHER);
+}
+
+TEST_F(BufferedReaderTest, test_merged_io_cost_model) {
+    size_t kb = 1024;
+    io::FileReaderSPtr offset_reader = std::make_shared<MockOffsetFileReader>(2048 * kb); // 2MB
+    std::vector<io::PrefetchRange> random_access_ranges;
+    random_access_ranges.emplace_back(0, 1 * kb);
+    random_access_ranges.emplace_back(3 * kb, 4 * kb);
+    random_access_ranges.emplace_back(304 * kb, 305 * kb);
+    bool enable_cost_model = config::enable_merged_io_cost_model;
+    config::enable_merged_io_cost_model = true;
+    Defer defer {[&]() { config::enable_merged_io_cost_model = enable_cost_model; }};
+
+    io::MergeRangeFileReader merge_reader(nullptr, offset_reader, random_access_ranges);
+    // 1ms and 100MB/s, reading about 100KB takes as long as one IO
+    io::IOCostEstimator estimator(1000, 100L * 1024 * 1024);
+    merge_reader._cost_estimator = &estimator;
+    std::vector<char> data(1 * kb);
+    size_t bytes_read = 0;
+    // the 2KB gap is merged, while the 300KB gap costs more than the IO saved
+    static_cast<void>(merge_reader.read_at(0, Slice(data.data(), 1 * kb), &bytes_read, nullptr));
+    EXPECT_EQ(bytes_read, 1 * kb);
+    EXPECT_EQ(merge_reader.statistics().merged_bytes, 4 * kb);
+    EXPECT_EQ(merge_reader.statistics().hollow_bytes, 2 * kb);
+    EXPECT_EQ(merge_reader.statistics().merged_gaps, 1);
+}
+
 } // end namespace doris
@@ -29,11 +29,14 @@
 #include <filesystem>
 #include <vector>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "common/sync_point.h"
 #include "gtest/gtest_pred_impl.h"
 #include "io/fs/file_reader.h"
 #include "io/fs/file_writer.h"
+#include "io/io_common.h"
+#include "util/defer_op.h"
 #include "util/slice.h"
 
 namespace doris {
@@ -135,6 +138,44 @@ TEST_F(LocalFileSystemTest, WriteRead) {
     }
 }
 
+TEST_F(LocalFileSystemTest, DirectIORead) {
+    auto fname = fmt::format("{}/direct_io", test_dir);
+    std::string content;
+    for (int i = 0; i < 100000; ++i) {
+        content.push_back((char)(i % 251));
+    }
+    ASSERT_TRUE(save_string_file(fname, content).ok());
+
+    bool enable_direct_io = config::enable_local_direct_io_read;
+    config::enable_local_direct_io_read = true;
+    Defer defer {[&]() { config::enable_local_direct_io_read = enable_direct_io; }};
+    io::FileReaderSPtr file_reader;
+    auto st = io::global_local_filesystem()->open_file(fname, &file_reader);
+    ASSERT_TRUE(st.ok()) << st;
+    io::IOContext io_ctx;
+    io_ctx.direct_io = true;
+    // unaligned and sequential reads, falls back to buffered read if O_DIRECT is not supported
+    std::vector<std::pair<size_t, size_t>> ranges {
+            {0, 100}, {100, 5000}, {5100, 4096}, {9196, 30000}, {70000, 30000}, {4000, 200}};
+    for (auto [offset, size] : ranges) {
+        std::string buf(size, '\0');
+        size_t bytes_read = 0;
+        st = file_reader->read_at(offset, Slice(buf.data(), size), &bytes_read, &io_ctx);
+        ASSERT_TRUE(st.ok()) << st;
+        ASSERT_EQ(size, bytes_read);
+        EXPECT_EQ(content.substr(offset, size), buf);
+    }
+    // read to the end of the file
+    std::string buf(1000, '\0');
+    size_t bytes_read = 0;
+    st = file_reader->read_at(content.size() - 10, Slice(buf.data(), buf.size()), &bytes_read,
+                              &io_ctx);
+    ASSERT_TRUE(st.ok()) << st;
+    ASSERT_EQ(10, bytes_read);
+    EXPECT_EQ(content.substr(content.size() - 10), buf.substr(0, 10));
+    ASSERT_TRUE(file_reader->close().ok());
+}
+
 TEST_F(LocalFileSystemTest, Exist) {
     auto fname = fmt::format("{}/abc", test_dir);
     ASSERT_FALSE(check_exist(fname));
@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/fs/local_io_scheduler.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/config.h"
+
+namespace doris::io {
+
+class LocalIOSchedulerTest : public testing::Test {
+public:
+    void SetUp() override {
+        _enable = config::enable_local_io_scheduler;
+        _concurrency = config::local_io_scheduler_disk_concurrency;
+        config::enable_local_io_scheduler = true;
+        config::local_io_scheduler_disk_concurrency = 1;
+    }
+
+    void TearDown() override {
+        config::enable_local_io_scheduler = _enable;
+        config::local_io_scheduler_disk_concurrency = _concurrency;
+    }
+
+    static void wait_for_waiting(dev_t dev, size_t num) {
+        int running = 0;
+        size_t waiting = 0;
+        for (int i = 0; i < 1000; ++i) {
+            LocalIOScheduler::instance()->get_queue_size(dev, &running, &waiting);
+            if (waiting == num) {
+                return;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        FAIL() << "waiting " << waiting << " != " << num;
+    }
+
+private:
+    bool _enable;
+    int32_t _concurrency;
+};
+
+TEST_F(LocalIOSchedulerTest, disabled) {
+    config::enable_local_io_scheduler = false;
+    auto slot = LocalIOScheduler::instance()->acquire(100, 4096);
+    int running = 0;
+    size_t waiting = 0;
+    LocalIOScheduler::instance()->get_queue_size(100, &running, &waiting);
+    EXPECT_EQ(0, running);
+    EXPECT_EQ(0, waiting);
+}
+
+TEST_F(LocalIOSchedulerTest, weighted_fair_queuing) {
+    constexpr dev_t dev = 101;
+    std::mutex mutex;
+    std::vector<std::string> order;
+    auto issue = [&](IOClass io_class, const std::string& name) {
+        SCOPED_IO_TAG(io_class);
+        auto slot = LocalIOScheduler::instance()->acquire(dev, 4096);
+        std::lock_guard lock(mutex);
+        order.push_back(name);
+    };
+
+    std::vector<std::thread> threads;
+    {
+        // occupy the disk, so that all the following IOs wait
+        auto slot = LocalIOScheduler::instance()->acquire(dev, 0);
+        for (int i = 0; i < 3; ++i) {
+            threads.emplace_back(issue, IOClass::COMPACTION, "compaction" + std::to_string(i));
+            wait_for_waiting(dev, i + 1);
+        }
+        threads.emplace_back(issue, IOClass::QUERY, "query");
+        wait_for_waiting(dev, 4);
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    // the query arrives last, but is not queued behind all the IOs of compaction
+    std::vector<std::string> expected {"compaction0", "query", "compaction1", "compaction2"};
+    EXPECT_EQ(expected, order);
+
+    int running = 0;
+    size_t waiting = 0;
+    LocalIOScheduler::instance()->get_queue_size(dev, &running, &waiting);
+    EXPECT_EQ(0, running);
+    EXPECT_EQ(0, waiting);
+}
+
+TEST_F(LocalIOSchedulerTest, workload_group_weight) {
+    IOTag tag {IOClass::QUERY, 1, 2048};
+    IOTag default_tag {IOClass::QUERY, 2, 0};
+    EXPECT_DOUBLE_EQ(LocalIOScheduler::weight(tag), 2 * LocalIOScheduler::weight(default_tag));
+    EXPECT_DOUBLE_EQ(config::local_io_scheduler_query_weight,
+                     LocalIOScheduler::weight(default_tag));
+}
+
+} // namespace doris::io
@@ -0,0 +1,53 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "io/fs/remote_read_throttle.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+
+namespace doris::io {
+
+TEST(RemoteReadThrottleTest, share_and_borrow) {
+    auto origin_bytes_per_second = config::remote_read_bytes_per_second;
+    config::remote_read_bytes_per_second = 1000;
+    {
+        // the groups get 250 and 750 bytes per second
+        RemoteReadThrottle group1(1, 1);
+        RemoteReadThrottle group2(2, 3);
+        int64_t now = 1000000000;
+        EXPECT_EQ(0, group1.reserve(250, now));
+        // group 1 is out of its share and borrows from the idle budget of group 2
+        EXPECT_EQ(0, group1.reserve(500, now));
+        // the budget of the BE is used up, group 1 waits for its own bucket
+        EXPECT_EQ(2000000000, group1.reserve(500, now));
+        // group 2 still gets its share
+        EXPECT_EQ(0, group2.reserve(750, now));
+        // a second later the budget of the BE has only refilled what group 2 used, so group 1
+        // still pays its debt at its share
+        EXPECT_EQ(2000000000, group1.reserve(250, now + 1000000000));
+    }
+    config::remote_read_bytes_per_second = origin_bytes_per_second;
+}
+
+TEST(RemoteReadThrottleTest, not_limited) {
+    RemoteReadThrottle group(1, 1024);
+    EXPECT_EQ(0, group.reserve(1L << 40, 0));
+}
+
+} // namespace doris::io
@@ -1077,4 +1077,35 @@ TEST_F(S3FileWriterTest, multi_part_complete_error_3) {
     ASSERT_FALSE(st.ok()) << st;
 }
 
+
+TEST_F(S3FileWriterTest, part_size_grow) {
+    mock_client = std::make_shared<MockS3Client>();
+    doris::io::FileWriterOptions state;
+    io::FileWriterPtr s3_file_writer;
+    auto st = s3_fs->create_file("part_size_grow", &s3_file_writer, &state);
+    ASSERT_TRUE(st.ok()) << st;
+    auto* writer = dynamic_cast<io::S3FileWriter*>(s3_file_writer.get());
+    auto grow_interval = config::s3_write_part_size_grow_interval;
+    auto max_part_size = config::s3_write_max_part_size;
+    Defer defer {[&]() {
+        config::s3_write_part_size_grow_interval = grow_interval;
+        config::s3_write_max_part_size = max_part_size;
+        writer->_cur_part_num = 1;
+    }};
+    size_t part_size = config::s3_write_buffer_size;
+    config::s3_write_part_size_grow_interval = 10;
+    config::s3_write_max_part_size = part_size * 4;
+    writer->_cur_part_num = 10;
+    EXPECT_EQ(writer->_next_part_size(), part_size);
+    writer->_cur_part_num = 11;
+    EXPECT_EQ(writer->_next_part_size(), part_size * 2);
+    writer->_cur_part_num = 21;
+    EXPECT_EQ(writer->_next_part_size(), part_size * 4);
+    // capped by s3_write_max_part_size
+    writer->_cur_part_num = 1000;
+    EXPECT_EQ(writer->_next_part_size(), part_size * 4);
+    config::s3_write_part_size_grow_interval = 0;
+    EXPECT_EQ(writer->_next_part_size(), part_size);
+}
+
 } // namespace doris
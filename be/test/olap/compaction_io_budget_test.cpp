@@ -0,0 +1,102 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "olap/compaction_io_budget.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+
+namespace doris {
+
+class CompactionIOBudgetTest : public testing::Test {
+public:
+    void SetUp() override {
+        _origin_window_sec = config::compaction_io_budget_window_sec;
+        _origin_latency_ratio = config::compaction_io_throttle_latency_ratio;
+        config::compaction_io_budget_window_sec = 1;
+        config::compaction_io_throttle_latency_ratio = 2.0;
+    }
+
+    void TearDown() override {
+        config::compaction_io_budget_window_sec = _origin_window_sec;
+        config::compaction_io_throttle_latency_ratio = _origin_latency_ratio;
+    }
+
+private:
+    int32_t _origin_window_sec;
+    double _origin_latency_ratio;
+};
+
+TEST_F(CompactionIOBudgetTest, MeasuredBandwidth) {
+    CompactionIOBudget budget;
+    // admit all tasks before the bandwidth is measured
+    EXPECT_TRUE(budget.try_acquire(100 << 20));
+    EXPECT_TRUE(budget.try_acquire(100 << 20));
+    EXPECT_EQ(0, budget.budget());
+    EXPECT_FALSE(budget.exhausted());
+
+    // two tasks shared the disk, so it served twice the throughput of one
+    budget.release(100 << 20, 2000000);
+    EXPECT_EQ(100 << 20, budget.bandwidth());
+    budget.release(100 << 20, 0);
+    EXPECT_EQ(100 << 20, budget.bandwidth());
+    EXPECT_EQ(0, budget.used());
+
+    // one task is always admitted
+    EXPECT_TRUE(budget.try_acquire(200 << 20));
+    EXPECT_TRUE(budget.exhausted());
+    EXPECT_FALSE(budget.try_acquire(1));
+    budget.release(200 << 20, 0);
+
+    EXPECT_TRUE(budget.try_acquire(60 << 20));
+    EXPECT_FALSE(budget.try_acquire(60 << 20));
+    EXPECT_FALSE(budget.exhausted());
+    EXPECT_TRUE(budget.try_acquire(40 << 20));
+    EXPECT_TRUE(budget.exhausted());
+    EXPECT_EQ(100 << 20, budget.used());
+}
+
+TEST_F(CompactionIOBudgetTest, ThrottleByForegroundLatency) {
+    CompactionIOBudget budget;
+    EXPECT_TRUE(budget.try_acquire(100 << 20));
+    budget.release(100 << 20, 1000000);
+    EXPECT_EQ(100 << 20, budget.budget());
+
+    budget.update_foreground_latency(0);
+    budget.update_foreground_latency(100);
+    EXPECT_DOUBLE_EQ(1.0, budget.throttle_ratio());
+
+    budget.update_foreground_latency(300);
+    EXPECT_DOUBLE_EQ(0.5, budget.throttle_ratio());
+    EXPECT_EQ(50 << 20, budget.budget());
+    budget.update_foreground_latency(300);
+    EXPECT_DOUBLE_EQ(0.25, budget.throttle_ratio());
+    for (int i = 0; i < 10; ++i) {
+        budget.update_foreground_latency(500);
+    }
+    EXPECT_DOUBLE_EQ(0.1, budget.throttle_ratio());
+
+    // recover additively once the latency is back to normal
+    budget.update_foreground_latency(100);
+    EXPECT_NEAR(0.2, budget.throttle_ratio(), 1e-9);
+    for (int i = 0; i < 10; ++i) {
+        budget.update_foreground_latency(100);
+    }
+    EXPECT_DOUBLE_EQ(1.0, budget.throttle_ratio());
+}
+
+} // namespace doris
@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "olap/compaction_stats.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+
+namespace doris {
+
+class TabletCompactionStatsTest : public testing::Test {
+public:
+    void SetUp() override {
+        _origin_history_num = config::compaction_stats_history_num;
+        config::compaction_stats_history_num = 2;
+    }
+
+    void TearDown() override { config::compaction_stats_history_num = _origin_history_num; }
+
+private:
+    int32_t _origin_history_num;
+};
+
+TEST_F(TabletCompactionStatsTest, Totals) {
+    TabletCompactionStats stats;
+    stats.add_ingested_bytes(100);
+    stats.add_ingested_bytes(100);
+
+    TabletCompactionStats::Record record;
+    record.type = "cumulative compaction";
+    record.success = true;
+    record.input_bytes = 200;
+    record.output_bytes = 150;
+    record.elapsed_us = 3000;
+    record.queue_delay_us = 1000;
+    stats.add_record(record);
+    record.success = false;
+    record.queue_delay_us = 3000;
+    stats.add_record(record);
+
+    auto totals = stats.totals();
+    EXPECT_EQ(200, totals.ingested_bytes);
+    EXPECT_EQ(1, totals.num_compactions);
+    EXPECT_EQ(1, totals.num_failures);
+    EXPECT_EQ(200, totals.input_bytes);
+    EXPECT_EQ(150, totals.output_bytes);
+    EXPECT_EQ(6000, totals.elapsed_us);
+    EXPECT_EQ(4000, totals.queue_delay_us);
+
+    rapidjson::Document root;
+    root.SetObject();
+    totals.to_json(&root, root.GetAllocator());
+    EXPECT_DOUBLE_EQ(1.0, root["merged_bytes_per_ingested_byte"].GetDouble());
+    EXPECT_DOUBLE_EQ(1.75, root["write_amplification"].GetDouble());
+    EXPECT_EQ(2, root["avg_queue_delay_ms"].GetInt64());
+
+    TabletCompactionStats::Totals partition;
+    partition.merge(totals);
+    partition.merge(totals);
+    EXPECT_EQ(400, partition.ingested_bytes);
+    EXPECT_EQ(2, partition.num_compactions);
+}
+
+TEST_F(TabletCompactionStatsTest, LastCompactions) {
+    TabletCompactionStats stats;
+    TabletCompactionStats::Record record;
+    for (int i = 0; i < 3; ++i) {
+        record.score_before = i;
+        stats.add_record(record);
+    }
+
+    rapidjson::Document root;
+    root.SetObject();
+    stats.to_json(&root, root.GetAllocator());
+    // only the last two are kept, the latest first
+    const auto& records = root["last_compactions"];
+    ASSERT_EQ(2, records.Size());
+    EXPECT_EQ(2, records[0]["score_before"].GetInt64());
+    EXPECT_EQ(1, records[1]["score_before"].GetInt64());
+    EXPECT_EQ(3, root["num_failures"].GetInt64());
+    EXPECT_DOUBLE_EQ(0, root["write_amplification"].GetDouble());
+}
+
+} // namespace doris
@@ -194,6 +194,18 @@ TEST_F(TestHll, Normal) {
     }
 }
 
+TEST_F(TestHll, EstimateFull) {
+    for (uint64_t num_values : {1000, 100000, 10000000}) {
+        HyperLogLog hll;
+        for (uint64_t i = 0; i < num_values; ++i) {
+            hll.update(hash(i));
+        }
+        // the standard error of 2^14 registers is about 0.8%
+        auto cardinality = hll.estimate_cardinality();
+        EXPECT_NEAR(num_values, cardinality, num_values * 0.03) << num_values;
+    }
+}
+
 TEST_F(TestHll, InvalidPtr) {
     {
         HyperLogLog hll(Slice((char*)nullptr, 0));
@@ -22,6 +22,7 @@
 #include <gtest/gtest-test-part.h>
 
 #include <iosfwd>
+#include <thread>
 #include <vector>
 
 #include "gtest/gtest_pred_impl.h"
@@ -464,6 +465,200 @@ TEST_F(CacheTest, Number) {
     EXPECT_EQ(0, cache.get_usage());
 }
 
+TEST_F(CacheTest, ProtectedSegment) {
+    LRUCache cache(LRUCacheType::NUMBER);
+    cache.set_capacity(10);
+    cache.set_protected_capacity_ratio(0.5);
+
+    auto lookup = [&](int key) {
+        std::string result;
+        CacheKey cache_key = EncodeKey(&result, key);
+        auto* handle = cache.lookup(cache_key, cache_key.hash(cache_key.data(), 4, 0));
+        cache.release(handle);
+        return handle != nullptr;
+    };
+    auto insert = [&](int key) {
+        std::string result;
+        insert_number_LRUCache(cache, EncodeKey(&result, key), key, 1, CachePriority::NORMAL);
+    };
+
+    for (int key = 0; key < 4; ++key) {
+        insert(key);
+    }
+    // promote 0, 1, 2 to the protected segment
+    for (int key = 0; key < 3; ++key) {
+        EXPECT_TRUE(lookup(key));
+    }
+    EXPECT_EQ(3, cache.get_protected_usage());
+    EXPECT_EQ(3, cache.get_probation_hit_count());
+
+    // a scan only evicts the probation entries
+    for (int key = 100; key < 120; ++key) {
+        insert(key);
+    }
+    EXPECT_EQ(10, cache.get_usage());
+    for (int key = 0; key < 3; ++key) {
+        EXPECT_TRUE(lookup(key));
+    }
+    EXPECT_FALSE(lookup(3));
+    EXPECT_EQ(3, cache.get_protected_hit_count());
+
+    // the oldest protected entries are demoted to the probation segment
+    for (int key = 113; key < 120; ++key) {
+        EXPECT_TRUE(lookup(key));
+    }
+    EXPECT_EQ(5, cache.get_protected_usage());
+    for (int key = 200; key < 205; ++key) {
+        insert(key);
+    }
+    EXPECT_FALSE(lookup(0));
+    EXPECT_TRUE(lookup(119));
+
+    cache.prune();
+    EXPECT_EQ(0, cache.get_usage());
+    EXPECT_EQ(0, cache.get_protected_usage());
+}
+
+TEST_F(CacheTest, AdjustCapacity) {
+    LRUCache cache(LRUCacheType::NUMBER);
+    cache.set_capacity(10);
+    cache.set_protected_capacity_ratio(0.5);
+
+    auto lookup = [&](int key) {
+        std::string result;
+        CacheKey cache_key = EncodeKey(&result, key);
+        auto* handle = cache.lookup(cache_key, cache_key.hash(cache_key.data(), 4, 0));
+        cache.release(handle);
+        return handle != nullptr;
+    };
+    for (int key = 0; key < 10; ++key) {
+        std::string result;
+        insert_number_LRUCache(cache, EncodeKey(&result, key), key, 1, CachePriority::NORMAL);
+    }
+    for (int key = 0; key < 4; ++key) {
+        EXPECT_TRUE(lookup(key));
+    }
+    EXPECT_EQ(10, cache.get_element_count());
+    EXPECT_EQ(4, cache.get_protected_usage());
+
+    // the probation entries are evicted first, the protected segment shrinks with the capacity
+    PrunedInfo pruned_info = cache.adjust_capacity(4);
+    EXPECT_EQ(6, pruned_info.pruned_count);
+    EXPECT_EQ(6, pruned_info.pruned_size);
+    EXPECT_EQ(4, cache.get_capacity());
+    EXPECT_EQ(4, cache.get_usage());
+    EXPECT_EQ(2, cache.get_protected_usage());
+    for (int key = 0; key < 4; ++key) {
+        EXPECT_TRUE(lookup(key));
+    }
+
+    pruned_info = cache.adjust_capacity(20);
+    EXPECT_EQ(0, pruned_info.pruned_count);
+    for (int key = 100; key < 116; ++key) {
+        std::string result;
+        insert_number_LRUCache(cache, EncodeKey(&result, key), key, 1, CachePriority::NORMAL);
+    }
+    EXPECT_EQ(20, cache.get_usage());
+    EXPECT_EQ(20, cache.get_element_count());
+}
+
+TEST_F(CacheTest, ClockLookup) {
+    LRUCache cache(LRUCacheType::NUMBER);
+    cache.set_capacity(4);
+    cache.set_clock_lookup(true);
+
+    auto lookup_handle = [&](int key) {
+        std::string result;
+        CacheKey cache_key = EncodeKey(&result, key);
+        return cache.lookup(cache_key, cache_key.hash(cache_key.data(), 4, 0));
+    };
+    auto lookup = [&](int key) {
+        auto* handle = lookup_handle(key);
+        cache.release(handle);
+        return handle != nullptr;
+    };
+    auto insert = [&](int key) {
+        std::string result;
+        insert_number_LRUCache(cache, EncodeKey(&result, key), key, 1, CachePriority::NORMAL);
+    };
+
+    for (int key = 0; key < 4; ++key) {
+        insert(key);
+    }
+    // 0 and 1 are visited and get a second chance, 2 is the oldest one which is not
+    EXPECT_TRUE(lookup(0));
+    auto* handle1 = lookup_handle(1);
+    ASSERT_NE(nullptr, handle1);
+    insert(4);
+    EXPECT_EQ(4, cache.get_usage());
+    EXPECT_EQ(2, cache.get_hit_count());
+
+    // 1 is in use and is passed over
+    for (int key = 5; key < 8; ++key) {
+        insert(key);
+    }
+    cache.release(handle1);
+    for (int key : {0, 2, 3, 4}) {
+        EXPECT_FALSE(lookup(key)) << key;
+    }
+    for (int key : {1, 5, 6, 7}) {
+        EXPECT_TRUE(lookup(key)) << key;
+    }
+
+    // an entry erased in use is freed by its last release
+    auto* handle5 = lookup_handle(5);
+    std::string result;
+    CacheKey key5 = EncodeKey(&result, 5);
+    cache.erase(key5, key5.hash(key5.data(), 4, 0));
+    EXPECT_FALSE(lookup(5));
+    EXPECT_EQ(4, cache.get_usage());
+    cache.release(handle5);
+    EXPECT_EQ(3, cache.get_usage());
+
+    // a prune leaves the entries in use
+    auto* handle6 = lookup_handle(6);
+    PrunedInfo pruned_info = cache.prune();
+    EXPECT_EQ(2, pruned_info.pruned_count);
+    EXPECT_EQ(1, cache.get_usage());
+    cache.release(handle6);
+    EXPECT_TRUE(lookup(6));
+    cache.prune();
+    EXPECT_EQ(0, cache.get_usage());
+}
+
+TEST_F(CacheTest, ClockLookupConcurrently) {
+    LRUCache cache(LRUCacheType::NUMBER);
+    cache.set_capacity(50);
+    cache.set_clock_lookup(true);
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&cache, i]() {
+            for (int j = 0; j < 10000; ++j) {
+                int key = (i * 7 + j) % 100;
+                std::string result;
+                CacheKey cache_key = EncodeKey(&result, key);
+                uint32_t hash = cache_key.hash(cache_key.data(), 4, 0);
+                auto* handle = cache.lookup(cache_key, hash);
+                if (handle == nullptr) {
+                    auto* value = new CacheTest::CacheValue(EncodeValue(key));
+                    handle = cache.insert(cache_key, hash, value, 1, CachePriority::NORMAL);
+                }
+                auto* value = reinterpret_cast<LRUHandle*>(handle)->value;
+                EXPECT_EQ(key, DecodeValue(static_cast<CacheTest::CacheValue*>(value)->value));
+                cache.release(handle);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(40000, cache.get_lookup_count());
+    EXPECT_LE(cache.get_usage(), 50);
+    cache.prune();
+    EXPECT_EQ(0, cache.get_usage());
+}
+
 TEST_F(CacheTest, HeavyEntries) {
     // Add a bunch of light and heavy entries and then count the combined
     // size of items still in the cache, which must be approximately the
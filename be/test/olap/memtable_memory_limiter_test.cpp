@@ -182,4 +182,31 @@ TEST_F(MemTableMemoryLimiterTest, handle_memtable_flush_test) {
     res = _engine_ref->tablet_manager()->drop_tablet(request.tablet_id, request.replica_id, false);
     EXPECT_EQ(Status::OK(), res);
 }
+TEST_F(MemTableMemoryLimiterTest, select_writers_to_flush) {
+    auto saved_age_weight = config::memtable_flush_age_weight_sec;
+    config::memtable_flush_age_weight_sec = 0;
+    UniqueId load1(1, 1);
+    UniqueId load2(2, 2);
+    std::vector<WriterMemItem> items {
+            {{}, 100, 0, load1}, {{}, 300, 0, load1}, {{}, 200, 0, load1},
+            {{}, 50, 0, load2},  {{}, 150, 0, load2}, {{}, 10, 0, load2},
+    };
+
+    // the memtables smaller than 50 bytes are never flushed
+    auto victims = MemTableMemoryLimiter::select_writers_to_flush(items, 10000, 50);
+    EXPECT_EQ((std::vector<size_t> {1, 2, 4, 0, 3}), victims);
+
+    // load1 has 75% of the memory, so it flushes about 300 of 400 bytes and load2 the rest,
+    // although all memtables of load1 are larger than the second one of load2
+    victims = MemTableMemoryLimiter::select_writers_to_flush(items, 400, 50);
+    EXPECT_EQ((std::vector<size_t> {1, 4}), victims);
+
+    // an old memtable goes before a larger new one
+    config::memtable_flush_age_weight_sec = 60;
+    items[0].age_ms = 600 * 1000;
+    victims = MemTableMemoryLimiter::select_writers_to_flush(items, 100, 50);
+    EXPECT_EQ((std::vector<size_t> {0}), victims);
+    config::memtable_flush_age_weight_sec = saved_age_weight;
+}
+
 } // namespace doris
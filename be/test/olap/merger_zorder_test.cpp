@@ -0,0 +1,96 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "olap/merger.h"
+#include "vec/columns/column_vector.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris {
+
+// a grid of 8 x 8 points in the lexical order, with a value column following the points
+static vectorized::Block make_grid() {
+    auto x = vectorized::ColumnVector<Int32>::create();
+    auto y = vectorized::ColumnVector<Int32>::create();
+    auto v = vectorized::ColumnVector<Int32>::create();
+    for (int32_t i = 0; i < 8; ++i) {
+        for (int32_t j = 0; j < 8; ++j) {
+            x->get_data().push_back(i * 10);
+            y->get_data().push_back(j);
+            v->get_data().push_back(i * 8 + j);
+        }
+    }
+    vectorized::DataTypePtr type(std::make_shared<vectorized::DataTypeInt32>());
+    return vectorized::Block({vectorized::ColumnWithTypeAndName(x->get_ptr(), type, "x"),
+                              vectorized::ColumnWithTypeAndName(y->get_ptr(), type, "y"),
+                              vectorized::ColumnWithTypeAndName(v->get_ptr(), type, "v")});
+}
+
+TEST(MergerZOrderTest, zorder_sort) {
+    auto block = make_grid();
+    Merger::zorder_sort(&block, 2);
+    ASSERT_EQ(64, block.rows());
+    const auto& x = block.get_by_position(0).column;
+    const auto& y = block.get_by_position(1).column;
+    const auto& v = block.get_by_position(2).column;
+
+    // the first points are the ones closest to the origin in both of the columns
+    std::vector<std::pair<int64_t, int64_t>> first;
+    for (size_t i = 0; i < 4; ++i) {
+        first.emplace_back(x->get_int(i), y->get_int(i));
+    }
+    std::vector<std::pair<int64_t, int64_t>> expected {{0, 0}, {0, 1}, {10, 0}, {10, 1}};
+    EXPECT_EQ(expected, first);
+
+    // each quarter of the rows is a quadrant of the grid
+    for (size_t quarter = 0; quarter < 4; ++quarter) {
+        int64_t min_x = INT64_MAX, max_x = INT64_MIN, min_y = INT64_MAX, max_y = INT64_MIN;
+        for (size_t i = quarter * 16; i < (quarter + 1) * 16; ++i) {
+            min_x = std::min(min_x, x->get_int(i));
+            max_x = std::max(max_x, x->get_int(i));
+            min_y = std::min(min_y, y->get_int(i));
+            max_y = std::max(max_y, y->get_int(i));
+        }
+        EXPECT_EQ(30, max_x - min_x);
+        EXPECT_EQ(3, max_y - min_y);
+    }
+
+    // the other columns move along with the rows
+    for (size_t i = 0; i < 64; ++i) {
+        EXPECT_EQ(x->get_int(i) / 10 * 8 + y->get_int(i), v->get_int(i));
+    }
+}
+
+TEST(MergerZOrderTest, zorder_sort_duplicates) {
+    auto block = make_grid();
+    // only by the first column, whose values repeat, the rows keep their order among equals
+    Merger::zorder_sort(&block, 1);
+    const auto& v = block.get_by_position(2).column;
+    for (size_t i = 0; i < 64; ++i) {
+        EXPECT_EQ(static_cast<int64_t>(i), v->get_int(i));
+    }
+}
+
+} // namespace doris
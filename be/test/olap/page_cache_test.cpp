@@ -37,6 +37,16 @@ public:
     std::shared_ptr<MemTrackerLimiter> mem_tracker;
 };
 
+TEST_F(StoragePageCacheTest, fixed_size_key) {
+    std::string long_path = "s3://bucket/data/" + std::string(200, 'x') + "/0.dat";
+    StoragePageCache::CacheKey key(long_path, 100, 4096);
+    EXPECT_EQ(32, key.encode().size());
+    StoragePageCache::CacheKey same_key(std::string(long_path), 100, 4096);
+    EXPECT_EQ(key.encode().to_string(), same_key.encode().to_string());
+    StoragePageCache::CacheKey other_key(long_path.substr(0, long_path.size() - 1), 100, 4096);
+    EXPECT_NE(key.encode().to_string(), other_key.encode().to_string());
+}
+
 // All cache space is allocated to data pages
 TEST_F(StoragePageCacheTest, data_page_only) {
     std::cout << "44444" << std::endl;
@@ -323,4 +323,65 @@ TEST_F(PrimaryKeyIndexTest, single_page) {
         EXPECT_TRUE(status.is<ErrorCode::ENTRY_NOT_FOUND>());
     }
 }
+TEST_F(PrimaryKeyIndexTest, sorted_seek_with_one_iterator) {
+    std::string filename = kTestDir + "/sorted_seek_with_one_iterator";
+    io::FileWriterPtr file_writer;
+    auto fs = io::global_local_filesystem();
+    EXPECT_TRUE(fs->create_file(filename, &file_writer).ok());
+    config::primary_key_data_page_size = 5 * 5;
+
+    PrimaryKeyIndexBuilder builder(file_writer.get(), 0, 0);
+    static_cast<void>(builder.init());
+    std::vector<std::string> keys;
+    for (int i = 0; i < 100; i += 2) {
+        keys.push_back(StringPrintf("%05d", i));
+        static_cast<void>(builder.add_item(keys.back()));
+    }
+    EXPECT_GT(builder.data_page_num(), 1);
+    segment_v2::PrimaryKeyIndexMetaPB index_meta;
+    EXPECT_TRUE(builder.finalize(&index_meta));
+    EXPECT_TRUE(file_writer->close().ok());
+
+    PrimaryKeyIndexReader index_reader;
+    io::FileReaderSPtr file_reader;
+    EXPECT_TRUE(fs->open_file(filename, &file_reader).ok());
+    EXPECT_TRUE(index_reader.parse_index(file_reader, index_meta).ok());
+    auto index_type = vectorized::DataTypeFactory::instance().create_data_type(
+            index_reader.type_info()->type(), 1, 0);
+
+    // seek every key and the keys between them in ascending order, reading one row after each
+    // seek like Segment::lookup_row_key does
+    std::unique_ptr<segment_v2::IndexedColumnIterator> index_iterator;
+    EXPECT_TRUE(index_reader.new_iterator(&index_iterator).ok());
+    bool exact_match = false;
+    for (int i = 0; i < 99; ++i) {
+        std::string key = StringPrintf("%05d", i);
+        Slice slice(key);
+        auto status = index_iterator->seek_at_or_after(&slice, &exact_match);
+        ASSERT_TRUE(status.ok()) << key;
+        EXPECT_EQ(i % 2 == 0, exact_match);
+        size_t expected_ordinal = (i + 1) / 2;
+        EXPECT_EQ(expected_ordinal, index_iterator->get_current_ordinal());
+
+        auto index_column = index_type->create_column();
+        size_t num_read = 1;
+        EXPECT_TRUE(index_iterator->next_batch(&num_read, index_column).ok());
+        EXPECT_EQ(1, num_read);
+        EXPECT_EQ(keys[expected_ordinal], index_column->get_data_at(0).to_string());
+    }
+    {
+        string key("00099");
+        Slice slice(key);
+        auto status = index_iterator->seek_at_or_after(&slice, &exact_match);
+        EXPECT_TRUE(status.is<ErrorCode::ENTRY_NOT_FOUND>());
+    }
+    // seeking backwards still works
+    {
+        Slice slice(keys[5]);
+        EXPECT_TRUE(index_iterator->seek_at_or_after(&slice, &exact_match).ok());
+        EXPECT_TRUE(exact_match);
+        EXPECT_EQ(5, index_iterator->get_current_ordinal());
+    }
+}
+
 } // namespace doris
@@ -29,6 +29,7 @@
 #include <fstream>
 #include <new>
 #include <string>
+#include <vector>
 
 #include "common/config.h"
 #include "gtest/gtest_pred_impl.h"
@@ -122,4 +123,24 @@ TEST_F(RowsetMetaManagerTest, TestLoad) {
     EXPECT_EQ(_json_rowset_meta, json_rowset_meta_read);
 }
 
+TEST_F(RowsetMetaManagerTest, TestSaveWithExtraEntries) {
+    RowsetId rowset_id;
+    rowset_id.init(10000);
+    RowsetMeta rowset_meta;
+    rowset_meta.init_from_json(_json_rowset_meta);
+    RowsetMetaPB rowset_meta_pb;
+    rowset_meta.to_rowset_pb(&rowset_meta_pb);
+    std::string key = "extra_key";
+    std::string value = "extra_value";
+    std::vector<OlapMeta::BatchEntry> extra_entries = {{key, value}};
+    Status status = RowsetMetaManager::save(_meta, _tablet_uid, rowset_id, rowset_meta_pb, false,
+                                            extra_entries);
+    EXPECT_TRUE(status.ok()) << status;
+    EXPECT_TRUE(RowsetMetaManager::check_rowset_meta(_meta, _tablet_uid, rowset_id));
+    std::string value_read;
+    status = _meta->get(META_COLUMN_FAMILY_INDEX, key, &value_read);
+    EXPECT_TRUE(status.ok()) << status;
+    EXPECT_EQ(value, value_read);
+}
+
 } // namespace doris
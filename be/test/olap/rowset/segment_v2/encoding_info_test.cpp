@@ -49,5 +49,18 @@ TEST_F(EncodingInfoTest, no_encoding) {
     EXPECT_FALSE(status.ok());
 }
 
+TEST_F(EncodingInfoTest, is_supported) {
+    const auto* int_type_info = get_scalar_type_info<FieldType::OLAP_FIELD_TYPE_INT>();
+    EXPECT_TRUE(EncodingInfo::is_supported(int_type_info, BIT_SHUFFLE));
+    EXPECT_TRUE(EncodingInfo::is_supported(int_type_info, FOR_ENCODING));
+    EXPECT_TRUE(EncodingInfo::is_supported(int_type_info, PLAIN_ENCODING));
+    EXPECT_FALSE(EncodingInfo::is_supported(int_type_info, DICT_ENCODING));
+    EXPECT_FALSE(EncodingInfo::is_supported(int_type_info, DEFAULT_ENCODING));
+
+    const auto* string_type_info = get_scalar_type_info<FieldType::OLAP_FIELD_TYPE_STRING>();
+    EXPECT_TRUE(EncodingInfo::is_supported(string_type_info, DICT_ENCODING));
+    EXPECT_FALSE(EncodingInfo::is_supported(string_type_info, FOR_ENCODING));
+}
+
 } // namespace segment_v2
 } // namespace doris
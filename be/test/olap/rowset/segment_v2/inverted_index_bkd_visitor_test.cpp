@@ -0,0 +1,67 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <roaring/roaring.hh>
+
+#include "olap/rowset/segment_v2/inverted_index_reader.h"
+
+namespace doris::segment_v2 {
+
+using LessThanVisitor = InvertedIndexVisitor<InvertedIndexQueryType::LESS_THAN_QUERY>;
+
+TEST(InvertedIndexBkdVisitorTest, collect_with_filter) {
+    roaring::Roaring filter;
+    filter.addRange(10, 20);
+    roaring::Roaring hits;
+    LessThanVisitor visitor(nullptr, &hits);
+    visitor.set_filter(&filter);
+
+    roaring::Roaring leaf;
+    leaf.addRange(0, 15);
+    visitor.visit(leaf);
+    visitor.visit(5);
+    visitor.visit(18);
+
+    roaring::Roaring expected;
+    expected.addRange(10, 15);
+    expected.add(18);
+    EXPECT_EQ(expected, hits);
+}
+
+TEST(InvertedIndexBkdVisitorTest, count_with_and_without_filter) {
+    roaring::Roaring leaf;
+    leaf.addRange(0, 100);
+
+    LessThanVisitor count_all(nullptr, nullptr, true);
+    count_all.visit(leaf);
+    count_all.visit(200);
+    EXPECT_EQ(101U, count_all.get_num_hits());
+
+    roaring::Roaring filter;
+    filter.addRange(50, 60);
+    filter.add(200);
+    LessThanVisitor count_filtered(nullptr, nullptr, true);
+    count_filtered.set_filter(&filter);
+    count_filtered.visit(leaf);
+    count_filtered.visit(200);
+    count_filtered.visit(300);
+    EXPECT_EQ(11U, count_filtered.get_num_hits());
+}
+
+} // namespace doris::segment_v2
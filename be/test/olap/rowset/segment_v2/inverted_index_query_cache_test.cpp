@@ -0,0 +1,61 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "common/config.h"
+#include "olap/rowset/segment_v2/inverted_index_cache.h"
+
+namespace doris::segment_v2 {
+
+TEST(InvertedIndexQueryCacheTest, admission_by_misses) {
+    auto saved_min_misses = config::inverted_index_query_cache_admission_min_misses;
+    config::inverted_index_query_cache_admission_min_misses = 2;
+    InvertedIndexQueryCache cache(1024 * 1024, 1);
+    auto bitmap = std::make_shared<roaring::Roaring>();
+    bitmap->addRange(0, 100);
+
+    InvertedIndexQueryCache::CacheKey key {"1_0.idx", "c1", InvertedIndexQueryType::EQUAL_QUERY,
+                                           "value"};
+    InvertedIndexQueryCacheHandle handle;
+    // the first miss doesn't admit the result
+    EXPECT_FALSE(cache.lookup(key, &handle));
+    cache.insert(key, bitmap, &handle);
+    EXPECT_EQ(nullptr, handle.get_bitmap());
+    EXPECT_FALSE(cache.lookup(key, &handle));
+
+    // the second one does
+    cache.insert(key, bitmap, &handle);
+    EXPECT_EQ(bitmap, handle.get_bitmap());
+    InvertedIndexQueryCacheHandle lookup_handle;
+    EXPECT_TRUE(cache.lookup(key, &lookup_handle));
+    EXPECT_EQ(100, lookup_handle.get_bitmap()->cardinality());
+
+    // null bitmaps are always cached
+    InvertedIndexQueryCache::CacheKey null_bitmap_key {
+            "1_0.idx", "", InvertedIndexQueryType::UNKNOWN_QUERY, "null_bitmap"};
+    InvertedIndexQueryCacheHandle null_bitmap_handle;
+    cache.insert(null_bitmap_key, bitmap, &null_bitmap_handle);
+    EXPECT_EQ(bitmap, null_bitmap_handle.get_bitmap());
+
+    config::inverted_index_query_cache_admission_min_misses = saved_min_misses;
+}
+
+} // namespace doris::segment_v2
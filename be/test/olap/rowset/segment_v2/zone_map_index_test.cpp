@@ -233,5 +233,63 @@ TEST_F(ColumnZoneMapTest, ZoneMapCut) {
     delete field;
 }
 
+// Test for zone maps of pages copied from other segments
+TEST_F(ColumnZoneMapTest, CopiedPages) {
+    std::string filename = kTestDir + "/CopiedPages";
+    auto fs = io::global_local_filesystem();
+
+    TabletColumnPtr int_column = create_int_key(0);
+    Field* field = FieldFactory::create(*int_column);
+
+    std::unique_ptr<ZoneMapIndexWriter> builder(nullptr);
+    static_cast<void>(ZoneMapIndexWriter::create(field, builder));
+    ZoneMapPB page_zone_map;
+    page_zone_map.set_min("5");
+    page_zone_map.set_max("15");
+    page_zone_map.set_has_null(false);
+    page_zone_map.set_has_not_null(true);
+    EXPECT_TRUE(builder->add_page_zone_map(page_zone_map).ok());
+    page_zone_map.set_min("-3");
+    page_zone_map.set_max("7");
+    page_zone_map.set_has_null(true);
+    EXPECT_TRUE(builder->add_page_zone_map(page_zone_map).ok());
+    ZoneMapPB segment_zone_map;
+    segment_zone_map.set_min("-3");
+    segment_zone_map.set_max("15");
+    segment_zone_map.set_has_null(true);
+    segment_zone_map.set_has_not_null(true);
+    EXPECT_TRUE(builder->merge_segment_zone_map(segment_zone_map).ok());
+    segment_zone_map.set_min("20");
+    segment_zone_map.set_max("40");
+    segment_zone_map.set_has_null(false);
+    EXPECT_TRUE(builder->merge_segment_zone_map(segment_zone_map).ok());
+
+    ColumnIndexMetaPB index_meta;
+    {
+        io::FileWriterPtr file_writer;
+        EXPECT_TRUE(fs->create_file(filename, &file_writer).ok());
+        EXPECT_TRUE(builder->finish(file_writer.get(), &index_meta).ok());
+        EXPECT_TRUE(file_writer->close().ok());
+    }
+    const auto& merged = index_meta.zone_map_index().segment_zone_map();
+    EXPECT_EQ("-3", merged.min());
+    EXPECT_EQ("40", merged.max());
+    EXPECT_EQ(true, merged.has_null());
+    EXPECT_EQ(true, merged.has_not_null());
+
+    io::FileReaderSPtr file_reader;
+    EXPECT_TRUE(fs->open_file(filename, &file_reader).ok());
+    ZoneMapIndexReader column_zone_map(file_reader, index_meta.zone_map_index().page_zone_maps());
+    EXPECT_TRUE(column_zone_map.load(true, false).ok());
+    const std::vector<ZoneMapPB>& zone_maps = column_zone_map.page_zone_maps();
+    EXPECT_EQ(2, zone_maps.size());
+    EXPECT_EQ("5", zone_maps[0].min());
+    EXPECT_EQ("15", zone_maps[0].max());
+    EXPECT_EQ(false, zone_maps[0].has_null());
+    EXPECT_EQ("-3", zone_maps[1].min());
+    EXPECT_EQ(true, zone_maps[1].has_null());
+    delete field;
+}
+
 } // namespace segment_v2
 } // namespace doris
@@ -20,7 +20,9 @@
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 
+#include <algorithm>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest_pred_impl.h"
 
@@ -94,4 +96,44 @@ TEST_F(ShortKeyIndexTest, builder) {
     }
 }
 
+TEST_F(ShortKeyIndexTest, keys_with_common_prefixes) {
+    ShortKeyIndexBuilder builder(0, 1024);
+
+    // groups of keys longer than the 8 bytes prefix, and keys which are prefixes of others
+    std::vector<std::string> keys;
+    for (int group = 0; group < 37; ++group) {
+        std::string prefix = "prefix" + std::to_string(100 + group);
+        keys.push_back(prefix);
+        for (int i = 10; i < 60; i += 3) {
+            keys.push_back(prefix + std::to_string(i));
+        }
+    }
+    ASSERT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+    for (const auto& key : keys) {
+        static_cast<void>(builder.add_item(key));
+    }
+    std::vector<Slice> slices;
+    segment_v2::PageFooterPB footer;
+    ASSERT_TRUE(builder.finalize(keys.size() * 1024, &slices, &footer).ok());
+    std::string buf;
+    for (auto& slice : slices) {
+        buf.append(slice.data, slice.size);
+    }
+    ShortKeyIndexDecoder decoder;
+    ASSERT_TRUE(decoder.parse(buf, footer.short_key_page_footer()).ok());
+
+    std::vector<std::string> probes = {"", "a", "prefix", "prefix1", "zzz"};
+    for (const auto& key : keys) {
+        probes.push_back(key);
+        probes.push_back(key + "0");
+        probes.push_back(key.substr(0, key.size() - 1));
+    }
+    for (const auto& probe : probes) {
+        auto expected_lower = std::lower_bound(keys.begin(), keys.end(), probe) - keys.begin();
+        auto expected_upper = std::upper_bound(keys.begin(), keys.end(), probe) - keys.begin();
+        EXPECT_EQ(expected_lower, decoder.lower_bound(probe).ordinal()) << probe;
+        EXPECT_EQ(expected_upper, decoder.upper_bound(probe).ordinal()) << probe;
+    }
+}
+
 } // namespace doris
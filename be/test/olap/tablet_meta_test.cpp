@@ -49,6 +49,22 @@ TEST(TabletMetaTest, SaveAndParse) {
     EXPECT_EQ(old_tablet_meta, new_tablet_meta);
 }
 
+TEST(TabletMetaTest, SharedSchema) {
+    TabletMeta tablet_meta(1, 2, 3, 3, 4, 5, TTabletSchema(), 6, {{7, 8}}, UniqueId(9, 10),
+                           TTabletType::TABLET_TYPE_DISK, TCompressionType::LZ4F);
+    TabletMeta other_tablet_meta(1, 2, 11, 3, 4, 5, TTabletSchema(), 6, {{7, 8}}, UniqueId(9, 11),
+                                 TTabletType::TABLET_TYPE_DISK, TCompressionType::LZ4F);
+    EXPECT_EQ(tablet_meta.tablet_schema().get(), other_tablet_meta.tablet_schema().get());
+
+    // a changed schema is a copy, which leaves the shared one as it is
+    auto schema = std::make_shared<TabletSchema>();
+    schema->copy_from(*tablet_meta.tablet_schema());
+    schema->set_disable_auto_compaction(true);
+    tablet_meta.set_tablet_schema(schema);
+    EXPECT_TRUE(tablet_meta.tablet_schema()->disable_auto_compaction());
+    EXPECT_FALSE(other_tablet_meta.tablet_schema()->disable_auto_compaction());
+}
+
 TEST(TabletMetaTest, TestReviseMeta) {
     TabletMeta tablet_meta;
     std::vector<RowsetSharedPtr> src_rowsets;
@@ -245,4 +261,20 @@ TEST(TabletMetaTest, TestDeleteBitmap) {
     }
 }
 
+TEST(TabletMetaTest, TestDeleteBitmapOptimize) {
+    DeleteBitmap dbmp(10086);
+    // the continuous rows deleted by an upsert
+    for (uint32_t i = 0; i < 60000; ++i) {
+        dbmp.add({RowsetId {2, 0, 1, 1}, 0, 1}, i);
+    }
+    dbmp.add({RowsetId {2, 0, 1, 1}, 0, 2}, 7);
+    auto size_before = dbmp.get({RowsetId {2, 0, 1, 1}, 0, 1})->getSizeInBytes();
+    ASSERT_GT(dbmp.optimize(), 0);
+    auto bm = dbmp.get({RowsetId {2, 0, 1, 1}, 0, 1});
+    EXPECT_LT(bm->getSizeInBytes(), size_before);
+    EXPECT_EQ(bm->cardinality(), 60000);
+    EXPECT_TRUE(bm->contains(59999));
+    EXPECT_EQ(dbmp.cardinality(), 60001);
+}
+
 } // namespace doris
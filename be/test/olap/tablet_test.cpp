@@ -431,4 +431,52 @@ TEST_F(TestTablet, get_local_versions) {
     ASSERT_EQ(local_versions.size(), 20);
 }
 
+TEST_F(TestTablet, auto_bloom_filter_columns) {
+    TabletSchemaPB schema_pb;
+    auto add_column = [&](int32_t uid, const std::string& type, bool is_bf_column) {
+        ColumnPB* column = schema_pb.add_column();
+        column->set_unique_id(uid);
+        column->set_name("c" + std::to_string(uid));
+        column->set_type(type);
+        column->set_is_nullable(true);
+        column->set_is_bf_column(is_bf_column);
+    };
+    add_column(1, "INT", false);
+    add_column(2, "VARCHAR", false);
+    add_column(3, "INT", true);
+    add_column(4, "BIGINT", false);
+    add_column(5, "DOUBLE", false);
+    TabletSchema schema;
+    schema.init_from_pb(schema_pb);
+
+    bool enable_auto_bloom_filter = config::enable_auto_bloom_filter;
+    int32_t min_scan_count = config::auto_bloom_filter_min_scan_count;
+    int32_t max_columns = config::auto_bloom_filter_max_columns;
+    config::enable_auto_bloom_filter = true;
+    config::auto_bloom_filter_min_scan_count = 3;
+    config::auto_bloom_filter_max_columns = 2;
+
+    TabletSharedPtr tablet(new Tablet(*k_engine, _tablet_meta, _data_dir.get()));
+    for (int i = 0; i < 5; ++i) {
+        // 6 is not in the schema, 3 is a bloom filter column, 5 is not supported
+        tablet->record_equal_predicate_columns({1, 2, 3, 5, 6});
+    }
+    tablet->record_equal_predicate_columns({1, 4});
+    tablet->record_equal_predicate_columns({4});
+    EXPECT_EQ((std::set<int32_t> {1, 2}), tablet->auto_bloom_filter_columns(schema));
+
+    config::auto_bloom_filter_max_columns = 3;
+    // 4 is in the predicates of 2 scans only
+    EXPECT_EQ((std::set<int32_t> {1, 2}), tablet->auto_bloom_filter_columns(schema));
+    tablet->record_equal_predicate_columns({4});
+    EXPECT_EQ((std::set<int32_t> {1, 2, 4}), tablet->auto_bloom_filter_columns(schema));
+
+    config::enable_auto_bloom_filter = false;
+    EXPECT_TRUE(tablet->auto_bloom_filter_columns(schema).empty());
+
+    config::enable_auto_bloom_filter = enable_auto_bloom_filter;
+    config::auto_bloom_filter_min_scan_count = min_scan_count;
+    config::auto_bloom_filter_max_columns = max_columns;
+}
+
 } // namespace doris
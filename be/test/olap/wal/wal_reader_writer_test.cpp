@@ -18,12 +18,15 @@
 
 #include <filesystem>
 #include <memory>
+#include <thread>
 
 #include "agent/be_exec_version_manager.h"
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "gen_cpp/internal_service.pb.h"
 #include "gmock/gmock.h"
 #include "io/fs/local_file_system.h"
+#include "olap/wal/wal_group_syncer.h"
 #include "olap/wal/wal_reader.h"
 #include "olap/wal/wal_writer.h"
 #include "runtime/exec_env.h"
@@ -139,4 +142,48 @@ TEST_F(WalReaderWriterTest, TestWriteAndRead1) {
     static_cast<void>(wal_reader.finalize());
     EXPECT_EQ(3, block_count);
 }
-} // namespace doris
\ No newline at end of file
+
+TEST_F(WalReaderWriterTest, TestGroupSync) {
+    bool origin_enable_wal_group_sync = config::enable_wal_group_sync;
+    config::enable_wal_group_sync = true;
+    WalGroupSyncer syncer(_s_test_data_path);
+    const int num_writers = 4;
+    const int num_appends = 5;
+    std::vector<std::thread> threads;
+    std::vector<Status> statuses(num_writers);
+    for (int i = 0; i < num_writers; ++i) {
+        threads.emplace_back([&, i]() {
+            auto wal_writer = WalWriter(_s_test_data_path + "/sync_" + std::to_string(i));
+            statuses[i] = wal_writer.init();
+            wal_writer.set_group_syncer(&syncer);
+            for (int j = 0; j < num_appends && statuses[i].ok(); ++j) {
+                PBlock pblock;
+                generate_block(pblock, j * block_rows);
+                statuses[i] = wal_writer.append_blocks(std::vector<PBlock*> {&pblock});
+            }
+            static_cast<void>(wal_writer.finalize());
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    config::enable_wal_group_sync = origin_enable_wal_group_sync;
+    for (int i = 0; i < num_writers; ++i) {
+        EXPECT_TRUE(statuses[i].ok()) << statuses[i];
+        auto wal_reader = WalReader(_s_test_data_path + "/sync_" + std::to_string(i));
+        EXPECT_TRUE(wal_reader.init().ok());
+        int block_count = 0;
+        while (true) {
+            doris::PBlock pblock;
+            Status st = wal_reader.read_block(pblock);
+            if (!st.ok()) {
+                EXPECT_TRUE(st.is<ErrorCode::END_OF_FILE>());
+                break;
+            }
+            ++block_count;
+        }
+        static_cast<void>(wal_reader.finalize());
+        EXPECT_EQ(num_appends, block_count);
+    }
+}
+} // namespace doris
@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/exec/analytic_segment_tree.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "vec/aggregate_functions/aggregate_function_simple_factory.h"
+#include "vec/columns/columns_number.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::vectorized {
+void register_aggregate_function_minmax(AggregateFunctionSimpleFactory& factory);
+} // namespace doris::vectorized
+
+namespace doris::pipeline {
+
+using namespace vectorized;
+
+class AnalyticSegmentTreeTest : public ::testing::TestWithParam<std::string> {};
+
+TEST_P(AnalyticSegmentTreeTest, sliding_frames) {
+    // two partitions of [0, 1000) and [1000, 1300)
+    auto column = ColumnInt32::create();
+    for (int i = 0; i < 1300; ++i) {
+        column->insert_value((i * 7919) % 1009);
+    }
+    const IColumn* columns[1] = {column.get()};
+
+    AggregateFunctionSimpleFactory factory;
+    register_aggregate_function_minmax(factory);
+    auto function = factory.get(GetParam(), {std::make_shared<DataTypeInt32>()});
+    ASSERT_TRUE(AnalyticSegmentTree::is_supported(function.get()));
+    AnalyticSegmentTree tree(function.get());
+
+    Arena arena;
+    std::unique_ptr<char[]> memory(new char[function->size_of_data()]);
+    std::unique_ptr<char[]> expected_memory(new char[function->size_of_data()]);
+    auto check = [&](int64_t partition_start, int64_t partition_end, int64_t frame_start,
+                     int64_t frame_end) {
+        AggregateDataPtr place = memory.get();
+        AggregateDataPtr expected_place = expected_memory.get();
+        function->create(place);
+        function->create(expected_place);
+        tree.add_range(columns, partition_start, partition_end, frame_start, frame_end, place,
+                       &arena);
+        function->add_range_single_place(partition_start, partition_end, frame_start, frame_end,
+                                         expected_place, columns, &arena);
+        ColumnInt32 result;
+        function->insert_result_into(place, result);
+        function->insert_result_into(expected_place, result);
+        EXPECT_EQ(result.get_element(1), result.get_element(0))
+                << frame_start << " " << frame_end;
+        function->destroy(place);
+        function->destroy(expected_place);
+    };
+
+    // [100 preceding, 50 following]
+    for (int64_t row = 0; row < 1000; ++row) {
+        check(0, 1000, row - 100, row + 51);
+    }
+    // [unbounded preceding, 3 following] of the next partition
+    for (int64_t row = 1000; row < 1300; ++row) {
+        check(1000, 1300, 1000, row + 4);
+    }
+    // back to the first partition, with frames crossing several levels
+    check(0, 1000, 15, 17);
+    check(0, 1000, 1, 999);
+    check(0, 1000, 256, 512);
+}
+
+INSTANTIATE_TEST_SUITE_P(Params, AnalyticSegmentTreeTest, ::testing::Values("min", "max"));
+
+} // namespace doris::pipeline
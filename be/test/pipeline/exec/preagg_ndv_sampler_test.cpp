@@ -0,0 +1,110 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/exec/preagg_ndv_sampler.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "vec/columns/columns_number.h"
+
+namespace doris::pipeline {
+
+using Mode = PreaggNdvSampler::Mode;
+
+class PreaggNdvSamplerTest : public testing::Test {
+public:
+    void SetUp() override {
+        _origin_sample_rows = config::preagg_ndv_sample_rows;
+        _origin_reevaluate_rows = config::preagg_ndv_reevaluate_rows;
+    }
+
+    void TearDown() override {
+        config::preagg_ndv_sample_rows = _origin_sample_rows;
+        config::preagg_ndv_reevaluate_rows = _origin_reevaluate_rows;
+    }
+
+    // a block of `rows` keys cycling through `ndv` values
+    static vectorized::MutableColumnPtr keys(int64_t rows, int64_t ndv) {
+        auto column = vectorized::ColumnInt64::create();
+        for (int64_t i = 0; i < rows; ++i) {
+            column->insert_value(i % ndv);
+        }
+        return column;
+    }
+
+private:
+    int64_t _origin_sample_rows;
+    int64_t _origin_reevaluate_rows;
+};
+
+TEST_F(PreaggNdvSamplerTest, Disabled) {
+    config::preagg_ndv_sample_rows = 0;
+    PreaggNdvSampler sampler;
+    auto column = keys(1000, 1000);
+    EXPECT_FALSE(sampler.add_block({column.get()}, 1000));
+    EXPECT_EQ(Mode::PARTIAL, sampler.mode());
+}
+
+TEST_F(PreaggNdvSamplerTest, Modes) {
+    config::preagg_ndv_sample_rows = 1000;
+    config::preagg_ndv_reevaluate_rows = 0;
+    {
+        PreaggNdvSampler sampler;
+        auto column = keys(600, 600);
+        EXPECT_FALSE(sampler.add_block({column.get()}, 600));
+        column = keys(600, 600);
+        // only the first 400 keys of the block are sampled, which repeat the first block
+        EXPECT_FALSE(sampler.add_block({column.get()}, 600));
+        EXPECT_EQ(Mode::PARTIAL, sampler.mode());
+    }
+    {
+        PreaggNdvSampler sampler;
+        auto column = keys(1000, 1000);
+        EXPECT_TRUE(sampler.add_block({column.get()}, 1000));
+        EXPECT_EQ(Mode::PASSTHROUGH, sampler.mode());
+        // decided once
+        column = keys(1000, 10);
+        EXPECT_FALSE(sampler.add_block({column.get()}, 1000));
+        EXPECT_EQ(Mode::PASSTHROUGH, sampler.mode());
+    }
+    {
+        PreaggNdvSampler sampler;
+        auto column = keys(1000, 10);
+        EXPECT_TRUE(sampler.add_block({column.get()}, 1000));
+        EXPECT_EQ(Mode::FULL, sampler.mode());
+    }
+}
+
+TEST_F(PreaggNdvSamplerTest, Reevaluate) {
+    config::preagg_ndv_sample_rows = 1000;
+    config::preagg_ndv_reevaluate_rows = 2000;
+    PreaggNdvSampler sampler;
+    auto column = keys(1000, 1000);
+    EXPECT_TRUE(sampler.add_block({column.get()}, 1000));
+    EXPECT_EQ(Mode::PASSTHROUGH, sampler.mode());
+    for (int i = 0; i < 2; ++i) {
+        column = keys(1000, 10);
+        EXPECT_FALSE(sampler.add_block({column.get()}, 1000));
+        EXPECT_EQ(Mode::PASSTHROUGH, sampler.mode());
+    }
+    column = keys(1000, 10);
+    EXPECT_TRUE(sampler.add_block({column.get()}, 1000));
+    EXPECT_EQ(Mode::FULL, sampler.mode());
+}
+
+} // namespace doris::pipeline
@@ -0,0 +1,95 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/pipeline_tracing.h"
+
+#include <gtest/gtest.h>
+#include <stdlib.h>
+
+#include <filesystem>
+
+namespace doris::pipeline {
+
+TEST(PipelineTracingTest, blocked_kind) {
+    EXPECT_EQ(OperatorLatencyStats::SCAN,
+              OperatorLatencyStats::blocked_kind("OLAP_SCAN_OPERATOR_DEPENDENCY"));
+    EXPECT_EQ(OperatorLatencyStats::RUNTIME_FILTER,
+              OperatorLatencyStats::blocked_kind("OLAP_SCAN_OPERATOR_FILTER_DEPENDENCY"));
+    EXPECT_EQ(OperatorLatencyStats::EXCHANGE,
+              OperatorLatencyStats::blocked_kind("SHUFFLE_DATA_DEPENDENCY"));
+    EXPECT_EQ(OperatorLatencyStats::EXCHANGE,
+              OperatorLatencyStats::blocked_kind("ExchangeSinkQueueDependency"));
+    EXPECT_EQ(OperatorLatencyStats::SPILL,
+              OperatorLatencyStats::blocked_kind("SORT_SINK_OPERATOR_SPILL_DEPENDENCY"));
+    EXPECT_EQ(OperatorLatencyStats::OTHER,
+              OperatorLatencyStats::blocked_kind("HASH_JOIN_SINK_OPERATOR_DEPENDENCY"));
+}
+
+TEST(PipelineTracingTest, latency_stats) {
+    PipelineTracerContext ctx;
+    auto* stats = ctx.latency_stats("EXCHANGE_SINK_OPERATOR");
+    EXPECT_EQ(stats, ctx.latency_stats("EXCHANGE_SINK_OPERATOR"));
+    for (int i = 1; i <= 100; ++i) {
+        stats->run_slice.add(i);
+    }
+    stats->blocked[OperatorLatencyStats::EXCHANGE].add(1000);
+
+    auto json = ctx.latency_stats_json(true);
+    EXPECT_NE(std::string::npos, json.find("EXCHANGE_SINK_OPERATOR"));
+    EXPECT_NE(std::string::npos, json.find("run_slice"));
+    EXPECT_NE(std::string::npos, json.find("blocked_by_exchange"));
+    // empty histograms are not shown
+    EXPECT_EQ(std::string::npos, json.find("queue_wait"));
+    EXPECT_TRUE(stats->run_slice.is_empty());
+    EXPECT_EQ(std::string::npos, ctx.latency_stats_json(false).find("run_slice"));
+}
+
+TEST(PipelineTracingTest, slow_query) {
+    std::string log_dir = "./ut_dir/pipeline_tracing_test";
+    std::filesystem::remove_all(log_dir);
+    ::setenv("LOG_DIR", log_dir.c_str(), 1);
+    PipelineTracerContext ctx;
+    ASSERT_TRUE(ctx.change_record_params({{"type", "slow_query"},
+                                          {"slow_query_threshold_ms", "100"}})
+                        .ok());
+
+    TUniqueId fast_query;
+    fast_query.__set_hi(1);
+    fast_query.__set_lo(1);
+    TUniqueId slow_query;
+    slow_query.__set_hi(1);
+    slow_query.__set_lo(2);
+    for (const auto& query_id : {fast_query, slow_query}) {
+        ctx.record({query_id, "task0", 0, 1, 100, 200});
+        ctx.record({query_id, "task0", 1, 1, 300, 400});
+    }
+    ctx.end_query(fast_query, 0, 10);
+    ctx.end_query(slow_query, 0, 1000);
+
+    auto slow_queries = ctx.slow_queries();
+    ASSERT_EQ(1, slow_queries.size());
+    EXPECT_EQ(slow_query, slow_queries[0]);
+    std::string trace;
+    EXPECT_FALSE(ctx.get_slow_query_trace(fast_query, &trace).ok());
+    ASSERT_TRUE(ctx.get_slow_query_trace(slow_query, &trace).ok());
+    EXPECT_NE(std::string::npos, trace.find("traceEvents"));
+    // the span between the two runs of the task
+    EXPECT_NE(std::string::npos, trace.find(R"("name":"wait","cat":"wait","ph":"X","ts":200)"));
+    std::filesystem::remove_all(log_dir);
+}
+
+} // namespace doris::pipeline
@@ -0,0 +1,80 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "pipeline/task_queue.h"
+
+#include <gtest/gtest.h>
+
+namespace doris::pipeline {
+
+// The sub queue only queues the tasks, it does not run them.
+static PipelineTask* fake_task(uintptr_t i) {
+    return reinterpret_cast<PipelineTask*>(i);
+}
+
+TEST(SubTaskQueueTest, fair_share) {
+    SubTaskQueue queue;
+    queue.set_fair_share(true);
+    EXPECT_TRUE(queue.empty());
+    // group 1 has twice the cpu share of group 2
+    for (uintptr_t i = 1; i <= 4; ++i) {
+        queue.push_back(fake_task(i), 1, 2);
+        queue.push_back(fake_task(i + 100), 2, 1);
+    }
+    EXPECT_FALSE(queue.empty());
+
+    int num_group1 = 0;
+    for (int i = 0; i < 6; ++i) {
+        auto* task = queue.try_take(false);
+        ASSERT_NE(nullptr, task);
+        bool is_group1 = reinterpret_cast<uintptr_t>(task) < 100;
+        num_group1 += is_group1;
+        // every task runs for 1ms
+        queue.inc_group_runtime(is_group1 ? 1 : 2, 1000000);
+    }
+    EXPECT_EQ(4, num_group1);
+
+    // group 1 is drained, group 2 gets the rest
+    EXPECT_EQ(fake_task(103), queue.try_take(false));
+    EXPECT_EQ(fake_task(104), queue.try_take(false));
+    EXPECT_EQ(nullptr, queue.try_take(false));
+    EXPECT_TRUE(queue.empty());
+}
+
+TEST(SubTaskQueueTest, idle_group_restarts_from_min_vruntime) {
+    SubTaskQueue queue;
+    queue.set_fair_share(true);
+    for (uintptr_t i = 1; i <= 3; ++i) {
+        queue.push_back(fake_task(i), 1, 1);
+    }
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_NE(nullptr, queue.try_take(false));
+        queue.inc_group_runtime(1, 1000000);
+    }
+    // group 1 ran for 3ms, group 2 was idle all the time and restarts from the 2ms group 1 had
+    // when last taken, instead of getting 3ms ahead
+    queue.push_back(fake_task(4), 1, 1);
+    queue.push_back(fake_task(101), 2, 1);
+    queue.push_back(fake_task(102), 2, 1);
+    EXPECT_EQ(fake_task(101), queue.try_take(false));
+    queue.inc_group_runtime(2, 500000);
+    EXPECT_EQ(fake_task(102), queue.try_take(false));
+    queue.inc_group_runtime(2, 500000);
+    EXPECT_EQ(fake_task(4), queue.try_take(false));
+}
+
+} // namespace doris::pipeline
@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/cache/fragment_cache.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "vec/columns/column_vector.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris {
+
+static vectorized::Block make_block(int32_t start, int32_t rows) {
+    auto column = vectorized::ColumnVector<Int32>::create();
+    for (int32_t i = 0; i < rows; ++i) {
+        column->get_data().push_back(start + i);
+    }
+    vectorized::DataTypePtr type(std::make_shared<vectorized::DataTypeInt32>());
+    return vectorized::Block({vectorized::ColumnWithTypeAndName(column->get_ptr(), type, "k1")});
+}
+
+TEST(FragmentCacheTest, lookup_by_version) {
+    FragmentCache cache(1024 * 1024);
+    std::string digest(16, 'd');
+    auto key = FragmentCache::encode_key(digest, 10001);
+    EXPECT_NE(key, FragmentCache::encode_key(digest, 10002));
+    EXPECT_NE(key, FragmentCache::encode_key(std::string(16, 'e'), 10001));
+
+    std::vector<vectorized::Block> blocks;
+    EXPECT_FALSE(cache.lookup(key, 5, &blocks));
+
+    std::vector<vectorized::Block> inserted;
+    inserted.push_back(make_block(0, 100));
+    inserted.push_back(make_block(100, 10));
+    cache.insert(key, 5, std::move(inserted));
+
+    ASSERT_TRUE(cache.lookup(key, 5, &blocks));
+    ASSERT_EQ(2, blocks.size());
+    EXPECT_EQ(100, blocks[0].rows());
+    EXPECT_EQ(10, blocks[1].rows());
+    EXPECT_EQ(105, blocks[1].get_by_position(0).column->get_int(5));
+
+    // a newer version of the tablet misses and replaces the entry
+    EXPECT_FALSE(cache.lookup(key, 6, &blocks));
+    inserted.clear();
+    inserted.push_back(make_block(7, 1));
+    cache.insert(key, 6, std::move(inserted));
+    EXPECT_FALSE(cache.lookup(key, 5, &blocks));
+    ASSERT_TRUE(cache.lookup(key, 6, &blocks));
+    ASSERT_EQ(1, blocks.size());
+    EXPECT_EQ(7, blocks[0].get_by_position(0).column->get_int(0));
+}
+
+TEST(FragmentCacheTest, deep_copy) {
+    auto block = make_block(0, 10);
+    auto copy = FragmentCache::deep_copy(block);
+    EXPECT_NE(block.get_by_position(0).column.get(), copy.get_by_position(0).column.get());
+    EXPECT_EQ(block.dump_data(), copy.dump_data());
+}
+
+} // namespace doris
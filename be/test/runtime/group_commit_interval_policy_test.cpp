@@ -0,0 +1,82 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "runtime/group_commit_mgr.h"
+
+namespace doris {
+
+class GroupCommitIntervalPolicyTest : public testing::Test {
+public:
+    void SetUp() override {
+        _origin_target_bytes = config::group_commit_adaptive_target_bytes;
+        _origin_min_interval_ms = config::group_commit_adaptive_min_interval_ms;
+        _origin_version_ratio = config::group_commit_adaptive_version_ratio;
+        config::group_commit_adaptive_target_bytes = 1000000;
+        config::group_commit_adaptive_min_interval_ms = 100;
+        config::group_commit_adaptive_version_ratio = 0.5;
+    }
+
+    void TearDown() override {
+        config::group_commit_adaptive_target_bytes = _origin_target_bytes;
+        config::group_commit_adaptive_min_interval_ms = _origin_min_interval_ms;
+        config::group_commit_adaptive_version_ratio = _origin_version_ratio;
+    }
+
+private:
+    int64_t _origin_target_bytes;
+    int32_t _origin_min_interval_ms;
+    double _origin_version_ratio;
+};
+
+TEST_F(GroupCommitIntervalPolicyTest, IntervalByArrivalRate) {
+    GroupCommitIntervalPolicy policy;
+    // the interval of the table is used before any commit
+    EXPECT_EQ(10000, policy.interval_ms(10000, 64 << 20));
+
+    // 1000 bytes per ms reaches the target in 1s
+    policy.update(10000000, 10000, 0.1);
+    EXPECT_EQ(1000, policy.interval_ms(10000, 64 << 20));
+    // the target never exceeds the data bytes of the table
+    EXPECT_EQ(500, policy.interval_ms(10000, 500000));
+    // nor the interval goes beyond the one of the table
+    EXPECT_EQ(800, policy.interval_ms(800, 64 << 20));
+
+    // a burst shortens the interval down to the min one
+    for (int i = 0; i < 20; ++i) {
+        policy.update(100000000, 1000, 0.1);
+    }
+    EXPECT_EQ(100, policy.interval_ms(10000, 64 << 20));
+    EXPECT_EQ(50, policy.interval_ms(50, 64 << 20));
+
+    // a trickle of data is committed at the interval of the table
+    for (int i = 0; i < 20; ++i) {
+        policy.update(1000, 10000, 0.1);
+    }
+    EXPECT_EQ(10000, policy.interval_ms(10000, 64 << 20));
+}
+
+TEST_F(GroupCommitIntervalPolicyTest, FullIntervalWhenCompactionLags) {
+    GroupCommitIntervalPolicy policy;
+    policy.update(10000000, 10000, 0.6);
+    EXPECT_EQ(10000, policy.interval_ms(10000, 64 << 20));
+    policy.update(10000000, 10000, 0.2);
+    EXPECT_EQ(1000, policy.interval_ms(10000, 64 << 20));
+}
+
+} // namespace doris
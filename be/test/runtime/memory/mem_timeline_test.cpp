@@ -0,0 +1,60 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "runtime/memory/mem_timeline.h"
+
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include "runtime/memory/mem_tracker.h"
+
+namespace doris {
+
+using Samples = std::vector<std::pair<int64_t, int64_t>>;
+
+TEST(MemTimelineTest, SampleAndHalve) {
+    MemTracker tracker("MemTimelineTest");
+    MemTimeline timeline(&tracker, 100, 4);
+    timeline.sample(1000);
+    timeline.sample(1050);
+    tracker.consume(10);
+    timeline.sample(1100);
+    tracker.consume(10);
+    timeline.sample(1150);
+    timeline.sample(1230);
+    timeline.sample(1300);
+    EXPECT_EQ(Samples({{0, 0}, {100, 10}, {230, 20}, {300, 20}}), timeline.samples());
+
+    // every other sample is dropped and the interval becomes 200ms
+    tracker.consume(10);
+    timeline.sample(1400);
+    EXPECT_EQ(Samples({{0, 0}, {230, 20}, {400, 30}}), timeline.samples());
+    timeline.sample(1500);
+    EXPECT_EQ(3, timeline.samples().size());
+
+    tracker.release(30);
+    timeline.finish(1550);
+    EXPECT_EQ(Samples({{0, 0}, {230, 20}, {400, 30}, {550, 0}}), timeline.samples());
+    // the last sample is updated if the timeline finishes right after it
+    timeline.finish(1550);
+    EXPECT_EQ(4, timeline.samples().size());
+    EXPECT_EQ("0ms: 0, 230ms: 20.00 B, 400ms: 30.00 B, 550ms: 0", timeline.to_string());
+}
+
+} // namespace doris
@@ -452,4 +452,43 @@ TEST(ThreadMemTrackerMgrTest, NestedSwitchMemTrackerReserveMemory) {
     EXPECT_EQ(doris::GlobalMemoryArbitrator::process_reserved_memory(), 0);
 }
 
+TEST(ThreadMemTrackerMgrTest, AdaptiveConsumeThreshold) {
+    int32_t old_max_size = config::mem_tracker_consume_max_size_bytes;
+    config::mem_tracker_consume_max_size_bytes = 16 * 1024 * 1024;
+    std::unique_ptr<ThreadContext> thread_context = std::make_unique<ThreadContext>();
+    // near the limit, the threshold stays at config::mem_tracker_consume_min_size_bytes.
+    std::shared_ptr<MemTrackerLimiter> t1 = MemTrackerLimiter::create_shared(
+            MemTrackerLimiter::Type::OTHER, "UT-AdaptiveConsumeThreshold1", 64 * 1024 * 1024);
+
+    int64_t size1 = 4 * 1024;
+    int64_t size2 = 4 * 1024 * 1024;
+
+    thread_context->attach_task(TUniqueId(), t1);
+    thread_context->consume_memory(size2);
+    EXPECT_EQ(t1->consumption(), size2);
+    thread_context->consume_memory(size2);
+    EXPECT_EQ(t1->consumption(), size2 * 2);
+    thread_context->consume_memory(size1);
+    EXPECT_EQ(t1->consumption(), size2 * 2);
+    thread_context->consume_memory(-size2 * 2 - size1);
+    EXPECT_EQ(t1->consumption(), 0);
+    thread_context->detach_task();
+
+    // far from the limit, the untracked mem never exceeds the max size.
+    std::shared_ptr<MemTrackerLimiter> t2 = MemTrackerLimiter::create_shared(
+            MemTrackerLimiter::Type::OTHER, "UT-AdaptiveConsumeThreshold2");
+    thread_context->attach_task(TUniqueId(), t2);
+    for (int i = 0; i < 100; ++i) {
+        thread_context->consume_memory(size2);
+        EXPECT_LT(thread_context->thread_mem_tracker_mgr->untracked_mem(),
+                  config::mem_tracker_consume_max_size_bytes);
+        EXPECT_EQ(t2->consumption() + thread_context->thread_mem_tracker_mgr->untracked_mem(),
+                  size2 * (i + 1));
+    }
+    thread_context->consume_memory(-size2 * 100);
+    thread_context->detach_task();
+    EXPECT_EQ(t2->consumption(), 0);
+    config::mem_tracker_consume_max_size_bytes = old_max_size;
+}
+
 } // end namespace doris
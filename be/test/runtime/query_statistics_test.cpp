@@ -0,0 +1,49 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "runtime/query_statistics.h"
+
+#include <gtest/gtest.h>
+
+namespace doris {
+
+TEST(QueryStatisticsTest, storage_read) {
+    QueryStatistics scan_a;
+    scan_a.storage_read().requested_page_bytes += 100;
+    scan_a.storage_read().page_cache_bytes += 60;
+    scan_a.storage_read().rows_zone_map_filtered += 10;
+    QueryStatistics scan_b;
+    scan_b.storage_read().requested_page_bytes += 50;
+    scan_b.storage_read().local_disk_bytes += 50;
+    scan_b.storage_read().rows_predicate_filtered += 5;
+
+    QueryStatistics query;
+    query.merge(scan_a);
+    query.merge(scan_b);
+    auto& storage_read = query.storage_read();
+    EXPECT_EQ(150, storage_read.requested_page_bytes);
+    EXPECT_EQ(60, storage_read.page_cache_bytes);
+    EXPECT_EQ(50, storage_read.local_disk_bytes);
+    EXPECT_EQ(10, storage_read.rows_zone_map_filtered);
+    EXPECT_EQ(5, storage_read.rows_predicate_filtered);
+    EXPECT_NE(std::string::npos, storage_read.to_string().find("RowsZoneMapFiltered=10"));
+
+    query.clear();
+    EXPECT_EQ(0, query.storage_read().requested_page_bytes);
+    EXPECT_EQ(0, query.storage_read().rows_predicate_filtered);
+}
+
+} // namespace doris
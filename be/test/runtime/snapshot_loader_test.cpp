@@ -21,6 +21,7 @@
 #include <gtest/gtest-test-part.h>
 
 #include <filesystem>
+#include <vector>
 
 #include "gtest/gtest_pred_impl.h"
 #include "olap/storage_engine.h"
@@ -87,4 +88,26 @@ TEST(SnapshotLoaderTest, NormalCase) {
     EXPECT_EQ(10005, tablet_id);
 }
 
+TEST(SnapshotLoaderTest, RunConcurrently) {
+    StorageEngine engine({});
+    SnapshotLoader loader(engine, ExecEnv::GetInstance(), 1L, 2L);
+
+    std::vector<int> done(100, 0);
+    Status st = loader._run_concurrently(done.size(), [&](size_t i) {
+        done[i]++;
+        return Status::OK();
+    });
+    EXPECT_TRUE(st.ok());
+    EXPECT_EQ(std::vector<int>(100, 1), done);
+
+    // the first failure is returned
+    st = loader._run_concurrently(done.size(), [](size_t i) {
+        return i == 10 ? Status::Cancelled("Cancelled") : Status::OK();
+    });
+    EXPECT_TRUE(st.is<ErrorCode::CANCELLED>());
+
+    st = loader._run_concurrently(0, [](size_t) { return Status::InternalError("error"); });
+    EXPECT_TRUE(st.ok());
+}
+
 } // namespace doris
@@ -39,6 +39,7 @@
 #include "olap/comparison_predicate.h"
 #include "olap/data_dir.h"
 #include "olap/in_list_predicate.h"
+#include "olap/page_cache.h"
 #include "olap/olap_common.h"
 #include "olap/row_cursor.h"
 #include "olap/rowset/segment_v2/binary_dict_page.h"
@@ -47,18 +48,28 @@
 #include "olap/rowset/segment_v2/page_decoder.h"
 #include "olap/rowset/segment_v2/segment_iterator.h"
 #include "olap/rowset/segment_v2/segment_writer.h"
+#include "olap/short_key_index.h"
 #include "olap/tablet_schema.h"
 #include "olap/tablet_schema_helper.h"
 #include "olap/types.h"
 #include "testutil/test_util.h"
 #include "util/debug_util.h"
+#include "util/key_util.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/column_vector.h"
+#include "vec/columns/columns_number.h"
+#include "vec/common/hash_table/hash.h"
+#include "vec/common/hash_table/join_hash_table.h"
+#include "vec/runtime/vdatetime_value.h"
 
 DEFINE_string(operation, "Custom",
               "valid operation: Custom, BinaryDictPageEncode, BinaryDictPageDecode, SegmentScan, "
               "SegmentWrite, "
-              "SegmentScanByFile, SegmentWriteByFile");
+              "SegmentScanByFile, SegmentWriteByFile, JoinHashTableProbe, PageCacheLookup, "
+              "ShortKeyIndexSeek, DateTimeV2FieldExtract, PartitionHash");
 DEFINE_string(input_file, "./sample.dat", "input file directory");
-DEFINE_string(column_type, "int,varchar", "valid type: int, char, varchar, string");
+DEFINE_string(column_type, "int,varchar",
+              "valid type: int, char, varchar, string, and bigint for PartitionHash");
 DEFINE_string(rows_number, "10000", "rows number");
 DEFINE_string(iterations, "10",
               "run times, this is set to 0 means the number of iterations is automatically set ");
@@ -84,6 +95,15 @@ std::string get_usage(const std::string& progname) {
           "--iterations=10\n";
     ss << "./benchmark_tool --operation=SegmentWriteByFile --input_file=./sample.dat "
           "--iterations=10\n";
+    ss << "./benchmark_tool --operation=JoinHashTableProbe --rows_number=1000000,10000000 "
+          "--iterations=10\n";
+    ss << "./benchmark_tool --operation=PageCacheLookup --rows_number=100000 --iterations=10\n";
+    ss << "./benchmark_tool --operation=ShortKeyIndexSeek --rows_number=10000,1000000 "
+          "--iterations=10\n";
+    ss << "./benchmark_tool --operation=DateTimeV2FieldExtract --rows_number=1000000 "
+          "--iterations=10\n";
+    ss << "./benchmark_tool --operation=PartitionHash --column_type=int,bigint,string "
+          "--rows_number=4096 --iterations=1000\n";
 
     ss << "Sampe data file format: \n"
        << "The first line defines Shcema\n"
@@ -229,6 +249,360 @@ private:
     int _rows_number;
 }; // namespace doris
 
+// Probe an inner join hash table of `rows_number` build rows by blocks of 4096 random keys,
+// half of which match, with and without prefetching.
+class JoinHashTableProbeBenchmark : public BaseBenchmark {
+public:
+    JoinHashTableProbeBenchmark(const std::string& name, int iterations, int rows_number,
+                                bool prefetch)
+            : BaseBenchmark(name + "/rows_number:" + std::to_string(rows_number) +
+                                    (prefetch ? "/prefetch" : "/no_prefetch"),
+                            iterations),
+              _rows_number(rows_number),
+              _prefetch(prefetch) {}
+    ~JoinHashTableProbeBenchmark() override = default;
+
+    void init() override {
+        if (_built) {
+            return;
+        }
+        _built = true;
+        config::enable_hash_join_probe_prefetch = _prefetch;
+        // row 0 is the mocked row
+        size_t build_rows = _rows_number + 1;
+        std::mt19937_64 rng(0);
+        _build_keys.resize(build_rows);
+        for (size_t i = 1; i < build_rows; ++i) {
+            _build_keys[i] = rng() & ~1ULL;
+        }
+        _hash_table.prepare_build<TJoinOp::INNER_JOIN>(build_rows, BATCH_SIZE, false);
+        std::vector<uint32_t> buckets(build_rows);
+        for (size_t i = 0; i < build_rows; ++i) {
+            buckets[i] = _bucket_of(_build_keys[i]);
+        }
+        _hash_table.build<TJoinOp::INNER_JOIN, false>(_build_keys.data(), buckets.data(),
+                                                       build_rows);
+
+        _probe_keys.resize(NUM_PROBE_ROWS);
+        for (auto& key : _probe_keys) {
+            key = _build_keys[1 + rng() % _rows_number] | (rng() & 1);
+        }
+        _probe_idxs.resize(BATCH_SIZE + 1);
+        _build_idxs.resize(BATCH_SIZE + 1);
+    }
+
+    void run() override {
+        size_t matched = 0;
+        std::vector<uint32_t> buckets(BATCH_SIZE);
+        for (size_t begin = 0; begin < NUM_PROBE_ROWS; begin += BATCH_SIZE) {
+            const auto* keys = _probe_keys.data() + begin;
+            for (int i = 0; i < BATCH_SIZE; ++i) {
+                buckets[i] = _bucket_of(keys[i]);
+            }
+            _hash_table.pre_build_idxs(buckets, nullptr);
+            int probe_idx = 0;
+            uint32_t build_idx = 0;
+            bool probe_visited = false;
+            while (probe_idx < BATCH_SIZE) {
+                auto [new_probe_idx, new_build_idx, matched_cnt] =
+                        _hash_table.find_batch<TJoinOp::INNER_JOIN, false, false, false>(
+                                keys, buckets.data(), probe_idx, build_idx, BATCH_SIZE,
+                                _probe_idxs.data(), probe_visited, _build_idxs.data());
+                probe_idx = new_probe_idx;
+                build_idx = new_build_idx;
+                matched += matched_cnt;
+            }
+        }
+        benchmark::DoNotOptimize(matched);
+    }
+
+private:
+    static constexpr int BATCH_SIZE = 4096;
+    static constexpr size_t NUM_PROBE_ROWS = 1 << 22;
+
+    uint32_t _bucket_of(uint64_t key) const {
+        return _hash_table.hash(key) & (_hash_table.get_bucket_size() - 1);
+    }
+
+    int _rows_number;
+    bool _prefetch;
+    bool _built = false;
+    JoinHashTable<uint64_t, HashCRC32<uint64_t>> _hash_table;
+    std::vector<uint64_t> _build_keys;
+    std::vector<uint64_t> _probe_keys;
+    std::vector<uint32_t> _probe_idxs;
+    std::vector<uint32_t> _build_idxs;
+};
+
+// Look up `rows_number` pages of a storage page cache by the file name of a remote segment and
+// the offset of the page, the key of each lookup is built from the file name as the readers do.
+class PageCacheLookupBenchmark : public BaseBenchmark {
+public:
+    PageCacheLookupBenchmark(const std::string& name, int iterations, int rows_number)
+            : BaseBenchmark(name + "/rows_number:" + std::to_string(rows_number), iterations),
+              _rows_number(rows_number) {}
+    ~PageCacheLookupBenchmark() override = default;
+
+    void init() override {
+        if (_cache != nullptr) {
+            return;
+        }
+        _cache = std::make_unique<StoragePageCache>(size_t(_rows_number) * PAGE_SIZE * 2, 0, 0,
+                                                    16);
+        auto mem_tracker = _cache->mem_tracker(segment_v2::DATA_PAGE);
+        for (int i = 0; i < NUM_FILES; ++i) {
+            _file_names.push_back("s3://bucket/data/020000000000000" + std::to_string(i) +
+                                  "4a1b2c3d4e5f60718293a4b5c6d7e8f9/" + std::to_string(i) +
+                                  "_0.dat");
+        }
+        for (int i = 0; i < _rows_number; ++i) {
+            StoragePageCache::CacheKey key(_file_names[i % NUM_FILES], FILE_SIZE,
+                                           int64_t(i) * PAGE_SIZE);
+            PageCacheHandle handle;
+            _cache->insert(key, new DataPage(PAGE_SIZE, mem_tracker), &handle,
+                           segment_v2::DATA_PAGE);
+        }
+        std::mt19937 rng(0);
+        _lookups.resize(NUM_LOOKUPS);
+        for (auto& page : _lookups) {
+            page = rng() % _rows_number;
+        }
+    }
+
+    void run() override {
+        size_t found = 0;
+        for (auto page : _lookups) {
+            StoragePageCache::CacheKey key(_file_names[page % NUM_FILES], FILE_SIZE,
+                                           int64_t(page) * PAGE_SIZE);
+            PageCacheHandle handle;
+            found += _cache->lookup(key, &handle, segment_v2::DATA_PAGE);
+        }
+        benchmark::DoNotOptimize(found);
+    }
+
+private:
+    static constexpr int NUM_FILES = 64;
+    static constexpr size_t PAGE_SIZE = 64;
+    static constexpr size_t FILE_SIZE = size_t(1) << 30;
+    static constexpr size_t NUM_LOOKUPS = 1 << 20;
+
+    int _rows_number;
+    std::unique_ptr<StoragePageCache> _cache;
+    std::vector<std::string> _file_names;
+    std::vector<int> _lookups;
+};
+
+// Seek `rows_number` short keys of a segment, with the search of ShortKeyIndexDecoder or with
+// the plain binary search over the encoded keys it replaced.
+class ShortKeyIndexSeekBenchmark : public BaseBenchmark {
+public:
+    ShortKeyIndexSeekBenchmark(const std::string& name, int iterations, int rows_number,
+                               bool eytzinger)
+            : BaseBenchmark(name + "/rows_number:" + std::to_string(rows_number) +
+                                    (eytzinger ? "/eytzinger" : "/binary_search"),
+                            iterations),
+              _rows_number(rows_number),
+              _eytzinger(eytzinger) {}
+    ~ShortKeyIndexSeekBenchmark() override = default;
+
+    void init() override {
+        if (!_buf.empty()) {
+            return;
+        }
+        // keys of a BIGINT and a VARCHAR column, encoded like the short keys of a segment
+        ShortKeyIndexBuilder builder(0, 1024);
+        std::vector<std::string> keys;
+        for (int i = 0; i < _rows_number; ++i) {
+            std::string key;
+            key.push_back(KEY_NORMAL_MARKER);
+            int64_t value = BigEndian::FromHost64(uint64_t(i / 16) ^ (1ULL << 63));
+            key.append((const char*)&value, sizeof(value));
+            key.push_back(KEY_NORMAL_MARKER);
+            key.append("user_" + std::to_string(100000 + i % 16));
+            keys.push_back(key);
+            static_cast<void>(builder.add_item(key));
+        }
+        std::vector<Slice> slices;
+        segment_v2::PageFooterPB footer;
+        static_cast<void>(builder.finalize(size_t(_rows_number) * 1024, &slices, &footer));
+        for (auto& slice : slices) {
+            _buf.append(slice.data, slice.size);
+        }
+        static_cast<void>(_decoder.parse(_buf, footer.short_key_page_footer()));
+
+        std::mt19937 rng(0);
+        _lookups.resize(NUM_LOOKUPS);
+        for (auto& lookup : _lookups) {
+            lookup = keys[rng() % _rows_number];
+        }
+    }
+
+    void run() override {
+        auto comparator = [](const Slice& lhs, const Slice& rhs) { return lhs.compare(rhs) < 0; };
+        ssize_t sum = 0;
+        for (const auto& key : _lookups) {
+            if (_eytzinger) {
+                sum += _decoder.lower_bound(key).ordinal();
+            } else {
+                sum += std::lower_bound(_decoder.begin(), _decoder.end(), Slice(key), comparator)
+                               .ordinal();
+            }
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+
+private:
+    static constexpr size_t NUM_LOOKUPS = 1 << 20;
+
+    int _rows_number;
+    bool _eytzinger;
+    std::string _buf;
+    ShortKeyIndexDecoder _decoder;
+    std::vector<std::string> _lookups;
+};
+
+// month() and hour() of DateTimeV2 values with the check of the values for the null map, either
+// per row by DateV2Value or in the loops over the packed values.
+class DateTimeV2FieldExtractBenchmark : public BaseBenchmark {
+public:
+    DateTimeV2FieldExtractBenchmark(const std::string& name, int iterations, int rows_number,
+                                    bool packed)
+            : BaseBenchmark(name + "/rows_number:" + std::to_string(rows_number) +
+                                    (packed ? "/packed" : "/date_v2_value"),
+                            iterations),
+              _rows_number(rows_number),
+              _packed(packed) {}
+    ~DateTimeV2FieldExtractBenchmark() override = default;
+
+    void init() override {
+        if (!_values.empty()) {
+            return;
+        }
+        std::mt19937 rng(0);
+        _values.resize(_rows_number);
+        for (auto& value : _values) {
+            DateV2Value<DateTimeV2ValueType> datetime;
+            datetime.set_time(2000 + rng() % 30, 1 + rng() % 12, 1 + rng() % 28, rng() % 24,
+                              rng() % 60, rng() % 60, rng() % 1000000);
+            value = datetime.to_date_int_val();
+        }
+        _fields.resize(_rows_number);
+        _null_map.resize(_rows_number);
+    }
+
+    void run() override {
+        if (_packed) {
+            _run_packed();
+        } else {
+            _run_date_v2_value();
+        }
+        benchmark::DoNotOptimize(_fields.data());
+        benchmark::DoNotOptimize(_null_map.data());
+    }
+
+private:
+    void _run_date_v2_value() {
+        for (int i = 0; i < _rows_number; ++i) {
+            const auto& value = (const DateV2Value<DateTimeV2ValueType>&)_values[i];
+            _fields[i] = value.month() + value.hour();
+            _null_map[i] = !value.is_valid_date();
+        }
+    }
+
+    void _run_packed() {
+        using PackedType = PackedDateV2<uint64_t>;
+        const uint64_t* __restrict values = _values.data();
+        uint8_t* __restrict fields = _fields.data();
+        uint8_t* __restrict null_map = _null_map.data();
+        for (int i = 0; i < _rows_number; ++i) {
+            fields[i] = PackedType::month(values[i]) + PackedType::hour(values[i]);
+        }
+        for (int i = 0; i < _rows_number; ++i) {
+            null_map[i] = !PackedType::is_valid(values[i]);
+        }
+    }
+
+    int _rows_number;
+    bool _packed;
+    std::vector<uint64_t> _values;
+    std::vector<uint8_t> _fields;
+    std::vector<uint8_t> _null_map;
+};
+
+// The shuffle hashes of the key columns of a type all at once, by the crc32 of the hash
+// partitioning of the tables or by the xxhash of the other exchanges.
+class PartitionHashBenchmark : public BaseBenchmark {
+public:
+    PartitionHashBenchmark(const std::string& name, int iterations, int rows_number,
+                           const std::string& key_type, bool crc)
+            : BaseBenchmark(name + "/rows_number:" + std::to_string(rows_number) + "/" +
+                                    key_type + (crc ? "/crc32" : "/xxhash"),
+                            iterations),
+              _rows_number(rows_number),
+              _key_type(key_type),
+              _crc(crc) {}
+    ~PartitionHashBenchmark() override = default;
+
+    void init() override {
+        if (!_columns.empty()) {
+            return;
+        }
+        std::mt19937_64 rng(0);
+        for (int i = 0; i < 3; ++i) {
+            if (_key_type == "int") {
+                auto column = vectorized::ColumnInt32::create();
+                for (int j = 0; j < _rows_number; ++j) {
+                    column->insert_value(rng());
+                }
+                _columns.push_back(std::move(column));
+            } else if (_key_type == "bigint") {
+                auto column = vectorized::ColumnInt64::create();
+                for (int j = 0; j < _rows_number; ++j) {
+                    column->insert_value(rng());
+                }
+                _columns.push_back(std::move(column));
+            } else {
+                auto column = vectorized::ColumnString::create();
+                for (int j = 0; j < _rows_number; ++j) {
+                    std::string str = std::to_string(rng());
+                    column->insert_data(str.data(), str.size());
+                }
+                _columns.push_back(std::move(column));
+            }
+        }
+        _crc_hashes.resize(_rows_number);
+        _hashes.resize(_rows_number);
+    }
+
+    void run() override {
+        if (_crc) {
+            std::fill(_crc_hashes.begin(), _crc_hashes.end(), 0);
+            for (const auto& column : _columns) {
+                column->update_crcs_with_value(_crc_hashes.data(),
+                                               _key_type == "int"      ? TYPE_INT
+                                               : _key_type == "bigint" ? TYPE_BIGINT
+                                                                       : TYPE_STRING,
+                                               _rows_number);
+            }
+            benchmark::DoNotOptimize(_crc_hashes.data());
+        } else {
+            std::fill(_hashes.begin(), _hashes.end(), 0);
+            for (const auto& column : _columns) {
+                column->update_hashes_with_value(_hashes.data());
+            }
+            benchmark::DoNotOptimize(_hashes.data());
+        }
+    }
+
+private:
+    int _rows_number;
+    std::string _key_type;
+    bool _crc;
+    vectorized::Columns _columns;
+    std::vector<uint32_t> _crc_hashes;
+    std::vector<uint64_t> _hashes;
+};
+
 // This is sample custom test. User can write custom test code at custom_init()&custom_run().
 // Call method: ./benchmark_tool --operation=Custom
 class CustomBenchmark : public BaseBenchmark {
@@ -286,6 +660,41 @@ public:
         } else if (equal_ignore_case(FLAGS_operation, "BinaryDictPageDecode")) {
             benchmarks.emplace_back(new doris::BinaryDictPageDecodeBenchmark(
                     FLAGS_operation, std::stoi(FLAGS_iterations), std::stoi(FLAGS_rows_number)));
+        } else if (equal_ignore_case(FLAGS_operation, "JoinHashTableProbe")) {
+            std::vector<std::string> rows_list = strings::Split(FLAGS_rows_number, ",");
+            for (const auto& rows : rows_list) {
+                for (bool prefetch : {false, true}) {
+                    benchmarks.emplace_back(new doris::JoinHashTableProbeBenchmark(
+                            FLAGS_operation, std::stoi(FLAGS_iterations), std::stoi(rows),
+                            prefetch));
+                }
+            }
+        } else if (equal_ignore_case(FLAGS_operation, "ShortKeyIndexSeek")) {
+            std::vector<std::string> rows_list = strings::Split(FLAGS_rows_number, ",");
+            for (const auto& rows : rows_list) {
+                for (bool eytzinger : {false, true}) {
+                    benchmarks.emplace_back(new doris::ShortKeyIndexSeekBenchmark(
+                            FLAGS_operation, std::stoi(FLAGS_iterations), std::stoi(rows),
+                            eytzinger));
+                }
+            }
+        } else if (equal_ignore_case(FLAGS_operation, "DateTimeV2FieldExtract")) {
+            for (bool packed : {false, true}) {
+                benchmarks.emplace_back(new doris::DateTimeV2FieldExtractBenchmark(
+                        FLAGS_operation, std::stoi(FLAGS_iterations), std::stoi(FLAGS_rows_number),
+                        packed));
+            }
+        } else if (equal_ignore_case(FLAGS_operation, "PartitionHash")) {
+            for (const auto& key_type : strings::Split(FLAGS_column_type, ",")) {
+                for (bool crc : {false, true}) {
+                    benchmarks.emplace_back(new doris::PartitionHashBenchmark(
+                            FLAGS_operation, std::stoi(FLAGS_iterations),
+                            std::stoi(FLAGS_rows_number), key_type, crc));
+                }
+            }
+        } else if (equal_ignore_case(FLAGS_operation, "PageCacheLookup")) {
+            benchmarks.emplace_back(new doris::PageCacheLookupBenchmark(
+                    FLAGS_operation, std::stoi(FLAGS_iterations), std::stoi(FLAGS_rows_number)));
         } else {
             std::cout << "operation invalid!" << std::endl;
         }
@@ -1076,6 +1076,29 @@ TEST(BitmapValueTest, Roaring64Map) {
     EXPECT_EQ(r1_sum, sum);
 }
 
+TEST(BitmapValueTest, Roaring64Map_fastunion_partitions) {
+    using doris::detail::Roaring64Map;
+    // the bitmaps share some of the high 32 bits of their values and not the others
+    std::vector<Roaring64Map> bitmaps(8);
+    Roaring64Map expected;
+    for (uint64_t i = 0; i < bitmaps.size(); ++i) {
+        for (uint64_t j = 0; j < 100; ++j) {
+            uint64_t value = ((i % 3) << 32) + i * 100 + j;
+            bitmaps[i].add(value);
+            expected.add(value);
+        }
+        bitmaps[i].add((i + 10) << 32);
+        expected.add((i + 10) << 32);
+    }
+    std::vector<const Roaring64Map*> inputs;
+    for (const auto& bitmap : bitmaps) {
+        inputs.push_back(&bitmap);
+    }
+    Roaring64Map result = Roaring64Map::fastunion(inputs.size(), inputs.data());
+    EXPECT_TRUE(expected == result);
+    EXPECT_EQ(808, result.cardinality());
+}
+
 TEST(BitmapValueTest, bitmap_to_string) {
     BitmapValue empty;
     EXPECT_STREQ("", empty.to_string().c_str());
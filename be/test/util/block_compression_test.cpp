@@ -22,7 +22,9 @@
 #include <gtest/gtest-test-part.h>
 #include <stdlib.h>
 
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest_pred_impl.h"
 #include "util/faststring.h"
@@ -148,4 +150,55 @@ TEST_F(BlockCompressionTest, multi) {
     test_multi_slices(segment_v2::CompressionTypePB::ZSTD);
 }
 
+static std::string generate_url(size_t i) {
+    return "https://www.example.com/catalog/item?category=" + std::to_string(i % 17) +
+           "&id=" + std::to_string(i * 7919) + "&session=" + generate_str(8) + "&lang=en\n";
+}
+
+TEST_F(BlockCompressionTest, zstd_dictionary) {
+    // small pages of urls
+    std::vector<std::string> pages;
+    for (size_t i = 0; i < 1000; ++i) {
+        std::string page;
+        for (size_t j = 0; j < 4; ++j) {
+            page.append(generate_url(i * 4 + j));
+        }
+        pages.emplace_back(std::move(page));
+    }
+    std::vector<Slice> samples(pages.begin(), pages.end());
+    std::string dict;
+    auto st = train_zstd_dictionary(samples, 16 * 1024, &dict);
+    ASSERT_TRUE(st.ok()) << st;
+    ASSERT_FALSE(dict.empty());
+    ASSERT_LE(dict.size(), 16 * 1024);
+
+    std::unique_ptr<BlockCompressionCodec> dict_codec;
+    st = create_zstd_dict_compression_codec(dict, &dict_codec);
+    ASSERT_TRUE(st.ok()) << st;
+    BlockCompressionCodec* codec = nullptr;
+    ASSERT_TRUE(get_block_compression_codec(segment_v2::CompressionTypePB::ZSTD, &codec).ok());
+
+    std::string orig = generate_url(100000) + generate_url(100001) + generate_url(100002);
+    faststring with_dict;
+    ASSERT_TRUE(dict_codec->compress(orig, &with_dict).ok());
+    faststring without_dict;
+    ASSERT_TRUE(codec->compress(orig, &without_dict).ok());
+    EXPECT_LT(with_dict.size(), without_dict.size());
+
+    std::string uncompressed;
+    uncompressed.resize(orig.size());
+    Slice uncompressed_slice(uncompressed);
+    st = dict_codec->decompress(Slice(with_dict), &uncompressed_slice);
+    ASSERT_TRUE(st.ok()) << st;
+    EXPECT_EQ(orig, uncompressed_slice.to_string());
+
+    // the dictionary is required to decompress
+    uncompressed_slice = Slice(uncompressed);
+    EXPECT_FALSE(codec->decompress(Slice(with_dict), &uncompressed_slice).ok());
+
+    // too few samples
+    std::vector<Slice> few_samples(samples.begin(), samples.begin() + 2);
+    EXPECT_FALSE(train_zstd_dictionary(few_samples, 16 * 1024, &dict).ok());
+}
+
 } // namespace doris
@@ -23,6 +23,7 @@
 
 #include <mutex>
 #include <thread>
+#include <vector>
 
 namespace doris {
 
@@ -40,6 +41,23 @@ TEST(BlockingQueueTest, TestBasic) {
     EXPECT_EQ(3, i);
 }
 
+TEST(BlockingQueueTest, TestGetBatch) {
+    BlockingQueue<int32_t> test_queue(5);
+    for (int32_t i = 0; i < 5; ++i) {
+        EXPECT_TRUE(test_queue.blocking_put(i));
+    }
+    std::vector<int32_t> values;
+    EXPECT_TRUE(test_queue.blocking_get_batch(&values, 3));
+    EXPECT_EQ((std::vector<int32_t> {0, 1, 2}), values);
+    EXPECT_TRUE(test_queue.blocking_get_batch(&values, 3));
+    EXPECT_EQ((std::vector<int32_t> {0, 1, 2, 3, 4}), values);
+
+    test_queue.shutdown();
+    values.clear();
+    EXPECT_FALSE(test_queue.blocking_get_batch(&values, 3));
+    EXPECT_TRUE(values.empty());
+}
+
 TEST(BlockingQueueTest, TestGetFromShutdownQueue) {
     int64_t i;
     BlockingQueue<int64_t> test_queue(2);
@@ -0,0 +1,60 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/hash_util.hpp"
+
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <zlib.h>
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+
+#include "gtest/gtest_pred_impl.h"
+#include "vec/core/types.h"
+
+namespace doris {
+
+template <typename T>
+void check_zlib_crc_hash_fixed(std::mt19937_64& rng) {
+    for (int i = 0; i < 1000; ++i) {
+        uint8_t bytes[sizeof(T)];
+        for (auto& byte : bytes) {
+            byte = rng();
+        }
+        T value;
+        memcpy(&value, bytes, sizeof(T));
+        uint32_t seed = i == 0 ? 0 : rng();
+        EXPECT_EQ(HashUtil::zlib_crc_hash(bytes, sizeof(T), seed),
+                  HashUtil::zlib_crc_hash_fixed(value, seed));
+    }
+}
+
+TEST(HashUtilTest, zlib_crc_hash_fixed) {
+    std::mt19937_64 rng(0);
+    check_zlib_crc_hash_fixed<int8_t>(rng);
+    check_zlib_crc_hash_fixed<int16_t>(rng);
+    check_zlib_crc_hash_fixed<int32_t>(rng);
+    check_zlib_crc_hash_fixed<int64_t>(rng);
+    check_zlib_crc_hash_fixed<double>(rng);
+    check_zlib_crc_hash_fixed<vectorized::Int128>(rng);
+    check_zlib_crc_hash_fixed<vectorized::Decimal32>(rng);
+    check_zlib_crc_hash_fixed<vectorized::Decimal256>(rng);
+}
+
+} // namespace doris
@@ -0,0 +1,114 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/proto_util.h"
+
+#include <brpc/controller.h>
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+
+#include "gtest/gtest_pred_impl.h"
+
+namespace doris {
+
+class ProtoUtilTest : public testing::Test {};
+
+TEST_F(ProtoUtilTest, length_prefixed_messages) {
+    butil::IOBuf buf;
+    for (int i = 0; i < 3; ++i) {
+        PTransmitDataParams params;
+        params.mutable_finst_id()->set_hi(i);
+        params.mutable_finst_id()->set_lo(i + 1);
+        params.set_node_id(i);
+        params.set_sender_id(i);
+        params.set_be_number(i);
+        params.set_eos(i == 2);
+        params.set_packet_seq(i * 10);
+        params.mutable_block()->set_column_values(std::string(i * 100, 'a'));
+        EXPECT_TRUE(append_length_prefixed_message(params, &buf).ok());
+    }
+
+    std::vector<std::unique_ptr<PTransmitDataParams>> msgs;
+    EXPECT_TRUE(parse_length_prefixed_messages(buf, &msgs).ok());
+    ASSERT_EQ(3, msgs.size());
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(i + 1, msgs[i]->finst_id().lo());
+        EXPECT_EQ(i * 10, msgs[i]->packet_seq());
+        EXPECT_EQ(i == 2, msgs[i]->eos());
+        EXPECT_EQ(i * 100, msgs[i]->block().column_values().size());
+    }
+    // parsing does not consume the buf
+    EXPECT_FALSE(buf.empty());
+}
+
+TEST_F(ProtoUtilTest, corrupted_length_prefixed_messages) {
+    butil::IOBuf buf;
+    PStatus status;
+    status.set_status_code(0);
+    EXPECT_TRUE(append_length_prefixed_message(status, &buf).ok());
+    buf.pop_back(1);
+
+    std::vector<std::unique_ptr<PStatus>> msgs;
+    EXPECT_FALSE(parse_length_prefixed_messages(buf, &msgs).ok());
+}
+
+TEST_F(ProtoUtilTest, embed_shared_block_in_attachment) {
+    struct Closure {
+        std::unique_ptr<brpc::Controller> cntl_ = std::make_unique<brpc::Controller>();
+    };
+    auto block = std::make_shared<PBlock>();
+    block->set_be_exec_version(3);
+    block->add_column_metas()->set_name("a");
+    block->set_column_values(std::string(1000, 'x'));
+
+    for (bool shared : {true, false}) {
+        auto closure = std::make_unique<Closure>();
+        PTransmitDataParams params;
+        params.set_packet_seq(7);
+        std::shared_ptr<PBlock> own_block;
+        if (shared) {
+            params.set_allocated_block(block.get());
+        } else {
+            own_block = std::make_shared<PBlock>(*block);
+            params.set_allocated_block(own_block.get());
+        }
+        EXPECT_TRUE(request_embed_attachment_contain_blockv2(&params, closure,
+                                                             shared ? block : nullptr)
+                            .ok());
+        static_cast<void>(params.release_block());
+        if (shared) {
+            // the column values are left in the shared block, the attachment keeps it
+            EXPECT_EQ(1000, block->column_values().size());
+            EXPECT_EQ(2, block.use_count());
+        } else {
+            EXPECT_TRUE(own_block->column_values().empty());
+        }
+
+        PTransmitDataParams received;
+        EXPECT_TRUE(attachment_extract_request_contain_block(&received, closure->cntl_.get())
+                            .ok());
+        EXPECT_EQ(7, received.packet_seq());
+        EXPECT_EQ(3, received.block().be_exec_version());
+        ASSERT_EQ(1, received.block().column_metas_size());
+        EXPECT_EQ("a", received.block().column_metas(0).name());
+        EXPECT_EQ(block->column_values(), received.block().column_values());
+        closure.reset();
+        EXPECT_EQ(1, block.use_count());
+    }
+}
+
+} // namespace doris
@@ -0,0 +1,63 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "util/query_cpu_profiler.h"
+
+#include <gen_cpp/Types_types.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+namespace doris {
+
+TEST(QueryCpuProfilerTest, profile) {
+    TUniqueId query_id;
+    query_id.__set_hi(1);
+    query_id.__set_lo(2);
+    TUniqueId other_query_id;
+    other_query_id.__set_hi(3);
+    other_query_id.__set_lo(4);
+
+    std::atomic<bool> stop = false;
+    auto run_task = [&stop](const TUniqueId& task_id) {
+        while (!stop) {
+            QueryCpuProfiler::on_attach_task(task_id);
+            volatile int64_t sum = 0;
+            for (int i = 0; i < 1000000; ++i) {
+                sum += i;
+            }
+            QueryCpuProfiler::on_detach_task();
+        }
+    };
+    std::thread task(run_task, query_id);
+    std::thread other_task(run_task, other_query_id);
+
+    std::string collapsed_stacks;
+    Status st = QueryCpuProfiler::profile(query_id, 1, 100, &collapsed_stacks);
+    stop = true;
+    task.join();
+    other_task.join();
+    ASSERT_TRUE(st.ok()) << st;
+    // about 100 samples of the task of the query, each line ends with the count of a stack
+    ASSERT_FALSE(collapsed_stacks.empty());
+    EXPECT_EQ('\n', collapsed_stacks.back());
+
+    EXPECT_FALSE(QueryCpuProfiler::profile(query_id, 0, 100, &collapsed_stacks).ok());
+    EXPECT_FALSE(QueryCpuProfiler::profile(query_id, 1, 0, &collapsed_stacks).ok());
+}
+
+} // namespace doris
@@ -0,0 +1,103 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "util/shm_ring_buffer.h"
+
+#include <fmt/format.h>
+#include <gen_cpp/internal_service.pb.h>
+#include <gtest/gtest-message.h>
+#include <gtest/gtest-test-part.h>
+#include <unistd.h>
+
+#include "gtest/gtest_pred_impl.h"
+#include "util/proto_util.h"
+
+namespace doris {
+
+class ShmRingBufferTest : public testing::Test {
+protected:
+    std::string ring_name() { return fmt::format("/doris_ut_ring_{}", getpid()); }
+};
+
+TEST_F(ShmRingBufferTest, write_and_read) {
+    std::unique_ptr<ShmRingBuffer> producer;
+    ASSERT_TRUE(ShmRingBuffer::create(ring_name(), 256, &producer).ok());
+    std::unique_ptr<ShmRingBuffer> consumer;
+    ASSERT_TRUE(ShmRingBuffer::open(ring_name(), &consumer).ok());
+
+    // the messages wrap around the end of the ring several times
+    for (int i = 0; i < 20; ++i) {
+        PTransmitDataParams params;
+        params.mutable_finst_id()->set_hi(0);
+        params.mutable_finst_id()->set_lo(i);
+        params.set_node_id(1);
+        params.set_sender_id(2);
+        params.set_be_number(3);
+        params.set_eos(false);
+        params.mutable_block()->set_column_values(std::string(50 + i, 'a' + i));
+        butil::IOBuf buf;
+        ASSERT_TRUE(append_length_prefixed_message(params, &buf).ok());
+        ASSERT_TRUE(producer->try_write(buf));
+
+        PTransmitDataParams res;
+        ASSERT_TRUE(consumer->read_message(&res).ok());
+        EXPECT_EQ(i, res.finst_id().lo());
+        EXPECT_EQ(params.block().column_values(), res.block().column_values());
+    }
+    EXPECT_EQ(256, producer->free_bytes());
+    EXPECT_FALSE(consumer->read_message(nullptr).ok());
+}
+
+TEST_F(ShmRingBufferTest, full) {
+    std::unique_ptr<ShmRingBuffer> producer;
+    ASSERT_TRUE(ShmRingBuffer::create(ring_name(), 64, &producer).ok());
+    PStatus status;
+    status.set_status_code(0);
+    status.add_error_msgs(std::string(40, 'x'));
+    butil::IOBuf buf;
+    ASSERT_TRUE(append_length_prefixed_message(status, &buf).ok());
+    EXPECT_TRUE(producer->try_write(buf));
+    EXPECT_FALSE(producer->try_write(buf));
+}
+
+TEST_F(ShmRingBufferTest, owner_removes_name) {
+    {
+        std::unique_ptr<ShmRingBuffer> producer;
+        ASSERT_TRUE(ShmRingBuffer::create(ring_name(), 64, &producer).ok());
+    }
+    std::unique_ptr<ShmRingBuffer> consumer;
+    EXPECT_FALSE(ShmRingBuffer::open(ring_name(), &consumer).ok());
+}
+
+TEST_F(ShmRingBufferTest, doorbell) {
+    butil::IOBuf buf;
+    ShmRingBuffer::append_doorbell("/doris_exchange_1_2", 7, &buf);
+    EXPECT_TRUE(ShmRingBuffer::is_doorbell(buf));
+    std::string name;
+    int64_t num = 0;
+    EXPECT_TRUE(ShmRingBuffer::parse_doorbell(buf, &name, &num).ok());
+    EXPECT_EQ("/doris_exchange_1_2", name);
+    EXPECT_EQ(7, num);
+
+    butil::IOBuf batch;
+    PStatus status;
+    status.set_status_code(0);
+    ASSERT_TRUE(append_length_prefixed_message(status, &batch).ok());
+    EXPECT_FALSE(ShmRingBuffer::is_doorbell(batch));
+}
+
+} // namespace doris
@@ -0,0 +1,64 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+#include "util/simd/bits.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace doris {
+
+TEST(SimdBitsTest, ForEachByte) {
+    // cover both the 32 bytes blocks and the tail
+    std::string data;
+    std::vector<size_t> expected;
+    for (size_t i = 0; i < 100; ++i) {
+        if (i % 7 == 0 || i == 31 || i == 32) {
+            data.push_back(',');
+            expected.push_back(i);
+        } else {
+            data.push_back('a' + i % 26);
+        }
+    }
+    std::vector<size_t> offsets;
+    simd::for_each_byte(reinterpret_cast<const uint8_t*>(data.data()), data.size(), ',',
+                        [&](size_t i) { offsets.push_back(i); });
+    EXPECT_EQ(expected, offsets);
+
+    offsets.clear();
+    simd::for_each_byte(reinterpret_cast<const uint8_t*>(data.data()), data.size(), '|',
+                        [&](size_t i) { offsets.push_back(i); });
+    EXPECT_TRUE(offsets.empty());
+}
+
+TEST(SimdBitsTest, FindFirstOf) {
+    std::string data(100, 'x');
+    const auto* begin = reinterpret_cast<const uint8_t*>(data.data());
+    EXPECT_EQ(nullptr, simd::find_first_of(begin, data.size(), '"', '\\'));
+    data[70] = '"';
+    EXPECT_EQ(begin + 70, simd::find_first_of(begin, data.size(), '"', '\\'));
+    data[40] = '\\';
+    EXPECT_EQ(begin + 40, simd::find_first_of(begin, data.size(), '"', '\\'));
+    data[3] = '"';
+    EXPECT_EQ(begin + 3, simd::find_first_of(begin, data.size(), '"', '\\'));
+    EXPECT_EQ(nullptr, simd::find_first_of(begin, 3, '"', '\\'));
+    // only the tail is searched
+    EXPECT_EQ(begin + 90, simd::find_first_of(begin + 90, 10, 'x', 'x'));
+}
+
+} // namespace doris
@@ -299,6 +299,32 @@ TEST(StringToInt, Int8_Exhaustive) {
     }
 }
 
+TEST(StringToInt, EightDigitsAtATime) {
+    // the digits converted 8 at a time followed by the digits converted one by one
+    test_int_value<int32_t>("123456789", 123456789, StringParser::PARSE_SUCCESS);
+    test_int_value<int32_t>("-000000001", -1, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("123456789012345678", 123456789012345678LL,
+                            StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("-12345678901234567", -12345678901234567LL,
+                            StringParser::PARSE_SUCCESS);
+    test_unsigned_int_value<uint64_t>("98765432109876543", 98765432109876543ULL,
+                                      StringParser::PARSE_SUCCESS);
+
+    // a non digit in any position of the 8 bytes words
+    std::string digits = "12345678901234567";
+    for (size_t i = 1; i < digits.size(); ++i) {
+        for (char c : {'a', '/', ':', '.', '\x80'}) {
+            std::string str = digits;
+            str[i] = c;
+            StringParser::ParseResult result;
+            StringParser::string_to_int<int64_t>(str.data(), str.length(), &result);
+            EXPECT_EQ(StringParser::PARSE_FAILURE, result) << str;
+        }
+    }
+    test_int_value<int64_t>("12345678", 12345678, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("123456789", 123456789, StringParser::PARSE_SUCCESS);
+}
+
 TEST(StringToIntWithBase, Basic) {
     test_int_value<int8_t>("123", 10, 123, StringParser::PARSE_SUCCESS);
     test_int_value<int16_t>("123", 10, 123, StringParser::PARSE_SUCCESS);
@@ -20,6 +20,7 @@
 #include <gtest/gtest-message.h>
 #include <gtest/gtest-test-part.h>
 
+#include <algorithm>
 #include <memory>
 #include <random>
 
@@ -177,6 +178,57 @@ TEST_F(TDigestTest, MergeTest) {
     digest2.add(std::vector<const TDigest*> {&digest1});
 }
 
+TEST_F(TDigestTest, AddBatch) {
+    TDigest digest(100);
+    TDigest batch_digest(100);
+    std::vector<double> values;
+    for (int i = 0; i < 10000; ++i) {
+        values.push_back(i % 997);
+    }
+    values.push_back(NAN);
+    for (auto value : values) {
+        digest.add(value);
+    }
+    batch_digest.add(values.data(), values.size());
+    digest.compress();
+    batch_digest.compress();
+    EXPECT_EQ(digest.totalWeight(), batch_digest.totalWeight());
+    for (double q : {0.01, 0.5, 0.99}) {
+        EXPECT_FLOAT_EQ(digest.quantile(q), batch_digest.quantile(q)) << "q = " << q;
+    }
+}
+
+TEST_F(TDigestTest, MergeMany) {
+    // the digests hold disjoint, interleaved ranges of values
+    std::vector<std::unique_ptr<TDigest>> digests;
+    std::vector<double> values;
+    for (int i = 0; i < 16; ++i) {
+        digests.push_back(std::make_unique<TDigest>(100));
+        for (int j = 0; j < 1000; ++j) {
+            double value = j * 16 + i;
+            digests.back()->add(value);
+            values.push_back(value);
+        }
+        digests.back()->compress();
+    }
+    std::sort(values.begin(), values.end());
+
+    TDigest digest(100);
+    for (const auto& other : digests) {
+        digest.merge(other.get());
+    }
+    digest.compress();
+    Centroid previous(0, 0);
+    for (auto centroid : digest.processed()) {
+        EXPECT_LE(previous.mean(), centroid.mean());
+        previous = centroid;
+    }
+    EXPECT_EQ(static_cast<long>(values.size()), digest.totalWeight());
+    for (double q : {0.1, 0.5, 0.9}) {
+        EXPECT_NEAR(quantile(q, values), digest.quantile(q), values.size() * 0.01) << "q = " << q;
+    }
+}
+
 TEST_F(TDigestTest, TestSorted) {
     TDigest digest(1000);
     std::uniform_real_distribution<> reals(0.0, 1.0);
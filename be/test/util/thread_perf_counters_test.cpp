@@ -0,0 +1,53 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "util/perf_counters.h"
+
+namespace doris {
+
+TEST(ThreadPerfCountersTest, read) {
+    auto* counters = ThreadPerfCounters::current();
+    EXPECT_EQ(counters, ThreadPerfCounters::current());
+
+    ThreadPerfCounters::Values begin;
+    if (!counters->valid()) {
+        // no PMU or not permitted here
+        EXPECT_FALSE(counters->read(&begin));
+        return;
+    }
+    ASSERT_TRUE(counters->read(&begin));
+    volatile int64_t sum = 0;
+    for (int i = 0; i < 1000000; ++i) {
+        sum += i;
+    }
+    ThreadPerfCounters::Values end;
+    ASSERT_TRUE(counters->read(&end));
+    EXPECT_GT(end[ThreadPerfCounters::INSTRUCTIONS], begin[ThreadPerfCounters::INSTRUCTIONS]);
+    EXPECT_GT(end[ThreadPerfCounters::CPU_CYCLES], begin[ThreadPerfCounters::CPU_CYCLES]);
+    for (int i = 0; i < ThreadPerfCounters::NUM_COUNTERS; ++i) {
+        EXPECT_GE(end[i], begin[i]);
+    }
+
+    // the counters of another thread are its own
+    std::thread([counters]() { EXPECT_NE(counters, ThreadPerfCounters::current()); }).join();
+}
+
+} // namespace doris
@@ -942,4 +942,29 @@ TEST_F(ThreadPoolTest, TestThreadTokenConcurrent) {
     ASSERT_EQ(0, token1->num_tasks());
 }
 
+TEST_F(ThreadPoolTest, TestRunTasksWithCaller) {
+    std::unique_ptr<ThreadPool> thread_pool;
+    static_cast<void>(ThreadPoolBuilder("my_pool")
+                              .set_min_threads(0)
+                              .set_max_threads(1)
+                              .build(&thread_pool));
+
+    std::vector<int> done(16, 0);
+    run_tasks_with_caller(thread_pool.get(), done.size(), [&](size_t i) { done[i]++; });
+    ASSERT_EQ(std::vector<int>(16, 1), done);
+
+    // called from the only thread of the pool, the caller has to run all tasks itself
+    std::fill(done.begin(), done.end(), 0);
+    CountDownLatch latch(1);
+    ASSERT_TRUE(thread_pool
+                        ->submit_func([&]() {
+                            run_tasks_with_caller(thread_pool.get(), done.size(),
+                                                  [&](size_t i) { done[i]++; });
+                            latch.count_down();
+                        })
+                        .ok());
+    latch.wait();
+    ASSERT_EQ(std::vector<int>(16, 1), done);
+}
+
 } // namespace doris
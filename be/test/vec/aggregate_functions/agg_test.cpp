@@ -27,11 +27,13 @@
 #include "vec/aggregate_functions/aggregate_function_simple_factory.h"
 #include "vec/aggregate_functions/aggregate_function_topn.h"
 #include "vec/columns/column.h"
+#include "vec/columns/column_nullable.h"
 #include "vec/columns/column_string.h"
 #include "vec/columns/column_vector.h"
 #include "vec/columns/columns_number.h"
 #include "vec/core/field.h"
 #include "vec/core/types.h"
+#include "vec/data_types/data_type_nullable.h"
 #include "vec/data_types/data_type_number.h"
 #include "vec/data_types/data_type_string.h"
 
@@ -102,4 +104,54 @@ TEST(AggTest, topn_test) {
     EXPECT_EQ(result, expect_result);
     agg_function->destroy(place);
 }
+
+TEST(AggTest, nullable_batch_test) {
+    auto nested = ColumnInt64::create();
+    auto null_map = ColumnUInt8::create();
+    for (int i = 0; i < agg_test_batch_size; i++) {
+        nested->insert_value((i * 7919) % 1000 - 500);
+        null_map->insert_value(i % 3 == 0);
+    }
+    auto column = ColumnNullable::create(std::move(nested), std::move(null_map));
+    const IColumn* columns[1] = {column.get()};
+    DataTypes data_types = {make_nullable(std::make_shared<DataTypeInt64>())};
+
+    for (const std::string name : {"sum", "min", "max", "avg"}) {
+        auto agg_function = AggregateFunctionSimpleFactory::instance().get(name, data_types, true);
+        std::unique_ptr<char[]> memory(new char[agg_function->size_of_data() * 3]);
+        AggregateDataPtr batch_place = memory.get();
+        AggregateDataPtr range_place = batch_place + agg_function->size_of_data();
+        AggregateDataPtr row_place = range_place + agg_function->size_of_data();
+        agg_function->create(batch_place);
+        agg_function->create(range_place);
+        agg_function->create(row_place);
+
+        // the batches skip the nulls, as the rows added one by one
+        agg_function->add_batch_single_place(agg_test_batch_size, batch_place, columns, nullptr);
+        agg_function->add_batch_range(1, 10, range_place, columns, nullptr, true);
+        agg_function->add_batch_range(11, agg_test_batch_size - 1, range_place, columns, nullptr,
+                                      true);
+        for (int i = 0; i < agg_test_batch_size; i++) {
+            agg_function->add(row_place, columns, i, nullptr);
+        }
+        auto result = agg_function->get_return_type()->create_column();
+        agg_function->insert_result_into(batch_place, *result);
+        agg_function->insert_result_into(range_place, *result);
+        agg_function->insert_result_into(row_place, *result);
+        EXPECT_FALSE(result->is_null_at(0)) << name;
+        EXPECT_EQ((*result)[2], (*result)[0]) << name;
+        EXPECT_EQ((*result)[2], (*result)[1]) << name;
+
+        // a batch of nulls only leaves the result null
+        agg_function->reset(batch_place);
+        agg_function->add_batch_range(0, 0, batch_place, columns, nullptr, true);
+        result = agg_function->get_return_type()->create_column();
+        agg_function->insert_result_into(batch_place, *result);
+        EXPECT_TRUE(result->is_null_at(0)) << name;
+
+        agg_function->destroy(batch_place);
+        agg_function->destroy(range_place);
+        agg_function->destroy(row_place);
+    }
+}
 } // namespace doris::vectorized
@@ -0,0 +1,58 @@
+
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/columns_number.h"
+#include "vec/common/assert_cast.h"
+
+namespace doris::vectorized {
+
+TEST(ColumnInsertInPlaceTest, nullable_int32) {
+    auto column = ColumnNullable::create(ColumnInt32::create(), ColumnUInt8::create());
+    column->insert_data(nullptr, 0);
+
+    int32_t values[] = {1, 2, 3};
+    auto* data = column->insert_many_fix_len_data_in_place(3, sizeof(int32_t));
+    ASSERT_NE(nullptr, data);
+    memcpy(data, values, sizeof(values));
+
+    ASSERT_EQ(4, column->size());
+    EXPECT_TRUE(column->is_null_at(0));
+    for (size_t i = 1; i < 4; ++i) {
+        EXPECT_FALSE(column->is_null_at(i));
+        EXPECT_EQ(values[i - 1], assert_cast<const ColumnInt32&>(column->get_nested_column())
+                                         .get_element(i));
+    }
+}
+
+TEST(ColumnInsertInPlaceTest, converted_values) {
+    // the values of a date column are converted from the storage format
+    auto date_column = ColumnInt64::create();
+    date_column->set_date_type();
+    EXPECT_EQ(nullptr, date_column->insert_many_fix_len_data_in_place(3, sizeof(int64_t)));
+    EXPECT_EQ(0, date_column->size());
+
+    auto column = ColumnNullable::create(ColumnInt64::create(), ColumnUInt8::create());
+    EXPECT_EQ(nullptr, column->insert_many_fix_len_data_in_place(3, sizeof(int32_t)));
+    EXPECT_EQ(0, column->size());
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,61 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/allocator.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+#include "vec/common/allocator_fwd.h"
+
+namespace doris {
+
+template <typename A>
+void test_large_allocation() {
+    A allocator;
+    size_t size = 3 * HUGE_PAGE_SIZE + 100;
+    auto* buf = reinterpret_cast<char*>(allocator.alloc(size));
+    for (size_t i = 0; i < size; i += 4096) {
+        EXPECT_EQ(buf[i], 0);
+        buf[i] = static_cast<char>(i / 4096);
+    }
+    size_t new_size = 5 * HUGE_PAGE_SIZE;
+    buf = reinterpret_cast<char*>(allocator.realloc(buf, size, new_size));
+    for (size_t i = 0; i < size; i += 4096) {
+        EXPECT_EQ(buf[i], static_cast<char>(i / 4096));
+    }
+    for (size_t i = size; i < new_size; ++i) {
+        EXPECT_EQ(buf[i], 0);
+    }
+    allocator.free(buf, new_size);
+}
+
+TEST(AllocatorTest, HugePage) {
+    bool enable_huge_page = config::enable_huge_page_for_large_allocation;
+    int64_t mmap_threshold = config::mmap_threshold;
+    for (bool enable : {false, true}) {
+        config::enable_huge_page_for_large_allocation = enable;
+        test_large_allocation<Allocator<true>>();
+        // both of the buffers are mmapped
+        config::mmap_threshold = HUGE_PAGE_SIZE;
+        test_large_allocation<Allocator<true, true, true>>();
+        config::mmap_threshold = mmap_threshold;
+    }
+    config::enable_huge_page_for_large_allocation = enable_huge_page;
+}
+
+} // namespace doris
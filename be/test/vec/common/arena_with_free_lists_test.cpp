@@ -0,0 +1,91 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/arena_with_free_lists.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace doris::vectorized {
+
+TEST(ArenaWithFreeListsTest, ReuseFreedBlocks) {
+    ArenaWithFreeLists arena;
+    char* block = arena.alloc(100);
+    memset(block, 'a', 100);
+    size_t allocated = arena.allocated_bytes();
+
+    // the blocks of the same size class are reused
+    arena.free(block, 100);
+    EXPECT_EQ(block, arena.alloc(120));
+    arena.free(block, 120);
+    for (int i = 0; i < 1000; ++i) {
+        char* data = arena.alloc(128);
+        arena.free(data, 128);
+    }
+    EXPECT_EQ(allocated, arena.allocated_bytes());
+
+    // another size class
+    char* small = arena.alloc(8);
+    EXPECT_NE(block, small);
+    arena.free(small, 8);
+}
+
+TEST(ArenaWithFreeListsTest, Realloc) {
+    ArenaWithFreeLists arena;
+    char* data = arena.realloc(nullptr, 0, 20);
+    memcpy(data, "01234567890123456789", 20);
+    // the data stays in place in the same size class
+    EXPECT_EQ(data, arena.realloc(data, 20, 30));
+    char* new_data = arena.realloc(data, 30, 40);
+    EXPECT_NE(data, new_data);
+    EXPECT_EQ("01234567890123456789", std::string(new_data, 20));
+    // the old block is freed to be reused
+    EXPECT_EQ(data, arena.alloc(32));
+    arena.free(data, 32);
+    data = new_data;
+    size_t size = 40;
+
+    // the large blocks are allocated out of the arena
+    size_t allocated = arena.allocated_bytes();
+    char* large = arena.alloc(100000);
+    EXPECT_EQ(allocated + 100000, arena.allocated_bytes());
+    arena.free(large, 100000);
+    EXPECT_EQ(allocated, arena.allocated_bytes());
+    arena.free(data, size);
+}
+
+TEST(ArenaWithFreeListsTest, Clear) {
+    ArenaWithFreeLists arena;
+    for (int round = 0; round < 3; ++round) {
+        std::vector<char*> blocks;
+        for (int i = 0; i < 1000; ++i) {
+            blocks.push_back(arena.alloc(64));
+            memset(blocks.back(), round, 64);
+        }
+        arena.clear();
+    }
+    // the largest chunk is kept and reused after clear
+    size_t allocated = arena.allocated_bytes();
+    for (int i = 0; i < 1000; ++i) {
+        static_cast<void>(arena.alloc(64));
+    }
+    EXPECT_EQ(allocated, arena.allocated_bytes());
+}
+
+} // namespace doris::vectorized
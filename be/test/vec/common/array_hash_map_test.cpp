@@ -0,0 +1,92 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/hash_table/array_hash_map.h"
+
+#include <gtest/gtest.h>
+
+#include <set>
+#include <vector>
+
+#include "vec/common/hash_table/hash.h"
+
+namespace doris::vectorized {
+
+using Map = ArrayHashMap<UInt32, int64_t, HashCRC32<UInt32>>;
+
+static void insert(Map& map, UInt32 key) {
+    Map::LookupResult it;
+    map.lazy_emplace(key, it, map.hash(key),
+                     [](const auto& ctor, auto& key, auto& origin) { ctor(key, 0); });
+    ++it->second;
+}
+
+TEST(ArrayHashMapTest, dense_and_fallback_keys) {
+    Map map;
+    // signed keys around 0
+    std::vector<UInt32> keys;
+    for (int i = -50; i < 50; ++i) {
+        keys.push_back(UInt32(i));
+    }
+    map.init_dense_range(keys.data(), keys.size(), nullptr);
+    ASSERT_TRUE(map.is_dense());
+
+    for (auto key : keys) {
+        insert(map, key);
+        insert(map, key);
+    }
+    // out of the range of the array
+    insert(map, 100000);
+    insert(map, UInt32(-100000));
+    EXPECT_EQ(102, map.size());
+
+    EXPECT_EQ(2, map.find(UInt32(-50))->second);
+    EXPECT_EQ(1, map.find(100000)->second);
+    EXPECT_EQ(nullptr, map.find(60));
+
+    std::set<UInt32> visited;
+    for (auto it = map.begin(); it != map.end(); ++it) {
+        visited.insert(it->get_first());
+    }
+    EXPECT_EQ(102, visited.size());
+
+    int64_t total = 0;
+    map.for_each_mapped([&](auto& mapped) { total += mapped; });
+    EXPECT_EQ(202, total);
+}
+
+TEST(ArrayHashMapTest, sparse_keys_are_hashed) {
+    Map map;
+    std::vector<UInt32> keys = {1, 20000, 40000};
+    map.init_dense_range(keys.data(), keys.size(), nullptr);
+    EXPECT_FALSE(map.is_dense());
+    for (auto key : keys) {
+        insert(map, key);
+    }
+    EXPECT_EQ(3, map.size());
+    EXPECT_EQ(1, map.find(20000)->second);
+}
+
+TEST(ArrayHashMapTest, null_rows_are_skipped) {
+    Map map;
+    std::vector<UInt32> keys = {1, 2, 1u << 30};
+    std::vector<uint8_t> null_map = {0, 0, 1};
+    map.init_dense_range(keys.data(), keys.size(), null_map.data());
+    EXPECT_TRUE(map.is_dense());
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,243 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/hash_table/join_hash_table.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "common/config.h"
+#include "vec/common/hash_table/hash.h"
+#include "vec/runtime/shared_hash_table_controller.h"
+
+namespace doris::vectorized {
+
+class JoinHashTableTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        _enable = config::enable_hash_join_radix_partition;
+        _min_rows = config::hash_join_radix_partition_min_build_rows;
+        _sub_table_bytes = config::hash_join_radix_sub_table_bytes;
+    }
+    void TearDown() override {
+        config::enable_hash_join_radix_partition = _enable;
+        config::hash_join_radix_partition_min_build_rows = _min_rows;
+        config::hash_join_radix_sub_table_bytes = _sub_table_bytes;
+    }
+
+    bool _enable = false;
+    int64_t _min_rows = 0;
+    int64_t _sub_table_bytes = 0;
+};
+
+TEST_F(JoinHashTableTest, radix_partitioned_inner_join) {
+    config::enable_hash_join_radix_partition = true;
+    config::hash_join_radix_partition_min_build_rows = 0;
+    config::hash_join_radix_sub_table_bytes = 1024;
+
+    using HashTable = JoinHashTable<UInt64, HashCRC32<UInt64>>;
+    HashTable hash_table;
+    // row 0 is the mocked row
+    constexpr size_t build_rows = 2000;
+    std::vector<UInt64> build_keys(build_rows);
+    for (size_t i = 1; i < build_rows; ++i) {
+        build_keys[i] = i % 500;
+    }
+    hash_table.prepare_build<TJoinOp::INNER_JOIN>(build_rows, 4096, false);
+    hash_table.init_radix_partition(build_rows);
+    ASSERT_TRUE(hash_table.is_radix_partitioned());
+
+    auto bucket_size = hash_table.get_bucket_size();
+    std::vector<uint32_t> build_buckets(build_rows);
+    for (size_t i = 0; i < build_rows; ++i) {
+        build_buckets[i] = hash_table.hash(build_keys[i]) & (bucket_size - 1);
+    }
+    hash_table.build<TJoinOp::INNER_JOIN, false>(build_keys.data(), build_buckets.data(),
+                                                  build_rows);
+
+    constexpr int probe_rows = 1000;
+    std::vector<UInt64> probe_keys(probe_rows);
+    std::vector<uint32_t> probe_buckets(probe_rows);
+    for (int i = 0; i < probe_rows; ++i) {
+        probe_keys[i] = i;
+        probe_buckets[i] = hash_table.hash(probe_keys[i]) & (bucket_size - 1);
+    }
+    std::vector<uint32_t> probe_order;
+    hash_table.pre_build_idxs_radix_partitioned(probe_buckets, probe_order);
+
+    // a small batch so that the chains are resumed across batches
+    std::vector<uint32_t> probe_idxs(4097);
+    std::vector<uint32_t> build_idxs(4097);
+    std::vector<std::pair<uint32_t, uint32_t>> matched;
+    int probe_pos = 0;
+    uint32_t build_idx = 0;
+    while (probe_pos < probe_rows) {
+        auto [new_probe_pos, new_build_idx, matched_cnt] = hash_table.find_batch_radix_partitioned(
+                probe_keys.data(), probe_buckets.data(), probe_order.data(), probe_pos, build_idx,
+                probe_rows, probe_idxs.data(), build_idxs.data());
+        probe_pos = new_probe_pos;
+        build_idx = new_build_idx;
+        for (int i = 0; i < matched_cnt; ++i) {
+            matched.emplace_back(probe_idxs[i], build_idxs[i]);
+        }
+    }
+
+    std::vector<std::pair<uint32_t, uint32_t>> expected;
+    for (uint32_t i = 0; i < probe_rows; ++i) {
+        for (uint32_t j = 1; j < build_rows; ++j) {
+            if (probe_keys[i] == build_keys[j]) {
+                expected.emplace_back(i, j);
+            }
+        }
+    }
+    std::sort(matched.begin(), matched.end());
+    EXPECT_EQ(expected, matched);
+}
+
+TEST_F(JoinHashTableTest, small_build_is_not_partitioned) {
+    config::enable_hash_join_radix_partition = true;
+    config::hash_join_radix_partition_min_build_rows = 1 << 20;
+    JoinHashTable<UInt64, HashCRC32<UInt64>> hash_table;
+    hash_table.prepare_build<TJoinOp::INNER_JOIN>(1000, 4096, false);
+    hash_table.init_radix_partition(1000);
+    EXPECT_FALSE(hash_table.is_radix_partitioned());
+}
+
+TEST_F(JoinHashTableTest, bucket_tags_reject_misses) {
+    bool enable_tags = config::enable_hash_join_bucket_tags;
+    config::enable_hash_join_bucket_tags = true;
+    using HashTable = JoinHashTable<UInt64, HashCRC32<UInt64>>;
+    HashTable hash_table;
+    // row 0 is the mocked row, the build keys are the even numbers
+    constexpr size_t build_rows = (1 << 16) + 1;
+    std::vector<UInt64> build_keys(build_rows);
+    for (size_t i = 1; i < build_rows; ++i) {
+        build_keys[i] = i * 2;
+    }
+    hash_table.prepare_build<TJoinOp::INNER_JOIN>(build_rows, 4096, false);
+    ASSERT_TRUE(hash_table.use_bucket_tags());
+
+    auto bucket_size = hash_table.get_bucket_size();
+    std::vector<uint32_t> build_buckets(build_rows);
+    std::vector<uint8_t> build_tags(build_rows);
+    for (size_t i = 0; i < build_rows; ++i) {
+        auto hash_value = hash_table.hash(build_keys[i]);
+        build_buckets[i] = hash_value & (bucket_size - 1);
+        build_tags[i] = HashTable::bucket_tag(hash_value);
+    }
+    hash_table.build<TJoinOp::INNER_JOIN, false>(build_keys.data(), build_buckets.data(),
+                                                  build_rows, build_tags.data());
+
+    constexpr size_t probe_rows = 1 << 16;
+    std::vector<uint32_t> probe_buckets(probe_rows);
+    std::vector<uint8_t> probe_tags(probe_rows);
+    for (size_t i = 0; i < probe_rows; ++i) {
+        auto hash_value = hash_table.hash(UInt64(i + 1));
+        probe_buckets[i] = hash_value & (bucket_size - 1);
+        probe_tags[i] = HashTable::bucket_tag(hash_value);
+    }
+    auto untagged = probe_buckets;
+    hash_table.pre_build_idxs(untagged, nullptr);
+    hash_table.pre_build_idxs(probe_buckets, nullptr, probe_tags.data());
+
+    size_t rejected = 0;
+    for (size_t i = 0; i < probe_rows; ++i) {
+        if ((i + 1) % 2 == 0) {
+            // a row that has a match is never rejected
+            EXPECT_EQ(untagged[i], probe_buckets[i]);
+        } else if (probe_buckets[i] == 0) {
+            rejected += untagged[i] != 0;
+        } else {
+            EXPECT_EQ(untagged[i], probe_buckets[i]);
+        }
+    }
+    EXPECT_GT(rejected, 0);
+    config::enable_hash_join_bucket_tags = enable_tags;
+}
+
+TEST_F(JoinHashTableTest, build_in_parts) {
+    using HashTable = JoinHashTable<UInt64, HashCRC32<UInt64>>;
+    constexpr size_t build_rows = 10000;
+    std::vector<UInt64> build_keys(build_rows);
+    for (size_t i = 1; i < build_rows; ++i) {
+        build_keys[i] = i % 3000;
+    }
+    HashTable serial;
+    HashTable parallel;
+    serial.prepare_build<TJoinOp::INNER_JOIN>(build_rows, 4096, false);
+    parallel.prepare_build<TJoinOp::INNER_JOIN>(build_rows, 4096, false);
+    auto bucket_size = serial.get_bucket_size();
+    std::vector<uint32_t> build_buckets(build_rows);
+    for (size_t i = 0; i < build_rows; ++i) {
+        build_buckets[i] = serial.hash(build_keys[i]) & (bucket_size - 1);
+    }
+    serial.build<TJoinOp::INNER_JOIN, false>(build_keys.data(), build_buckets.data(), build_rows);
+
+    parallel.begin_build(build_keys.data(), nullptr);
+    CooperativeBuildTask task(7, [&](int part, int num_parts) {
+        parallel.build_part(build_buckets.data(), build_rows, nullptr, part, num_parts);
+    });
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 3; ++i) {
+        threads.emplace_back([&]() { task.run_parts(); });
+    }
+    task.run_parts();
+    task.wait();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    parallel.finish_build<TJoinOp::INNER_JOIN, false>();
+
+    auto probe = [&](HashTable& hash_table) {
+        constexpr int probe_rows = 4000;
+        std::vector<UInt64> probe_keys(probe_rows);
+        std::vector<uint32_t> probe_buckets(probe_rows);
+        for (int i = 0; i < probe_rows; ++i) {
+            probe_keys[i] = i;
+            probe_buckets[i] = hash_table.hash(probe_keys[i]) & (bucket_size - 1);
+        }
+        hash_table.pre_build_idxs(probe_buckets, nullptr);
+        std::vector<uint32_t> probe_idxs(4097);
+        std::vector<uint32_t> build_idxs(4097);
+        std::vector<std::pair<uint32_t, uint32_t>> matched;
+        int probe_idx = 0;
+        uint32_t build_idx = 0;
+        bool probe_visited = false;
+        while (probe_idx < probe_rows) {
+            auto [new_probe_idx, new_build_idx, matched_cnt] =
+                    hash_table.find_batch<TJoinOp::INNER_JOIN, false, false, false>(
+                            probe_keys.data(), probe_buckets.data(), probe_idx, build_idx,
+                            probe_rows, probe_idxs.data(), probe_visited, build_idxs.data());
+            probe_idx = new_probe_idx;
+            build_idx = new_build_idx;
+            for (int i = 0; i < matched_cnt; ++i) {
+                matched.emplace_back(probe_idxs[i], build_idxs[i]);
+            }
+        }
+        return matched;
+    };
+    // the chains are in the same order
+    auto expected = probe(serial);
+    EXPECT_EQ(build_rows - 1, expected.size());
+    EXPECT_EQ(expected, probe(parallel));
+}
+
+} // namespace doris::vectorized
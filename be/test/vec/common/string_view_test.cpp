@@ -0,0 +1,75 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/common/string_view.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+namespace doris {
+
+TEST(StringViewTest, inline_and_pointer) {
+    std::string short_str = "hello";
+    std::string long_str = "hello, doris string view";
+    StringView short_view(short_str.data(), short_str.size());
+    StringView long_view(long_str.data(), long_str.size());
+
+    EXPECT_TRUE(short_view.is_inline());
+    EXPECT_NE(short_str.data(), short_view.data());
+    EXPECT_EQ(short_str, short_view.to_string_ref().to_string());
+    EXPECT_FALSE(long_view.is_inline());
+    EXPECT_EQ(long_str.data(), long_view.data());
+    EXPECT_EQ(long_str, long_view.to_string_ref().to_string());
+
+    EXPECT_EQ(0, StringView().size());
+    EXPECT_EQ(StringView(), StringView(StringRef("", 0)));
+}
+
+TEST(StringViewTest, compare_like_memcmp) {
+    std::vector<std::string> values {"",
+                                     "a",
+                                     std::string("a\0", 2),
+                                     "ab",
+                                     "abc",
+                                     "abcd",
+                                     "abcde",
+                                     "abd",
+                                     "b",
+                                     "abcdefghijk",
+                                     "abcdefghijkl",
+                                     "abcdefghijkla",
+                                     "abcdefghijklm",
+                                     "abcdefghijklmn",
+                                     "\xff",
+                                     "\xff\xfe",
+                                     std::string(20, '\xff')};
+    for (const auto& lhs : values) {
+        for (const auto& rhs : values) {
+            StringView lhs_view(lhs.data(), lhs.size());
+            StringView rhs_view(rhs.data(), rhs.size());
+            int expected = StringRef(lhs).compare(StringRef(rhs));
+            int res = lhs_view.compare(rhs_view);
+            EXPECT_EQ(expected < 0, res < 0) << lhs << " " << rhs;
+            EXPECT_EQ(expected > 0, res > 0) << lhs << " " << rhs;
+            EXPECT_EQ(lhs == rhs, lhs_view == rhs_view) << lhs << " " << rhs;
+        }
+    }
+}
+
+} // namespace doris
@@ -36,6 +36,8 @@
 #include "vec/columns/column_nullable.h"
 #include "vec/columns/column_string.h"
 #include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
+#include "vec/core/block_pool.h"
 #include "vec/core/field.h"
 #include "vec/data_types/data_type.h"
 #include "vec/data_types/data_type_array.h"
@@ -443,4 +445,48 @@ TEST(BlockTest, merge_with_shared_columns) {
     EXPECT_EQ(1034, src_block.rows());
 }
 
+TEST(BlockTest, deserialize_into_pooled_block) {
+    auto vec = vectorized::ColumnVector<Int32>::create();
+    auto& int32_data = vec->get_data();
+    for (int i = 0; i < 1024; ++i) {
+        int32_data.push_back(i);
+    }
+    vectorized::DataTypePtr int32_type(std::make_shared<vectorized::DataTypeInt32>());
+    vectorized::Block block({vectorized::ColumnWithTypeAndName(vec->get_ptr(), int32_type, "k1")});
+    PBlock pblock;
+    block_to_pb(block, &pblock);
+
+    vectorized::Block received;
+    ASSERT_TRUE(received.deserialize(pblock).ok());
+    const auto* received_data =
+            assert_cast<const vectorized::ColumnVector<Int32>&>(*received.get_by_position(0).column)
+                    .get_data()
+                    .data();
+
+    vectorized::BlockPool pool(1);
+    EXPECT_TRUE(pool.give_back(std::move(received)));
+    // The pool is full.
+    vectorized::Block another;
+    ASSERT_TRUE(another.deserialize(pblock).ok());
+    EXPECT_FALSE(pool.give_back(std::move(another)));
+
+    vectorized::Block reused;
+    ASSERT_TRUE(pool.try_get(&reused));
+    EXPECT_EQ(0, reused.rows());
+    EXPECT_FALSE(pool.try_get(&reused));
+    ASSERT_TRUE(reused.deserialize(pblock).ok());
+    EXPECT_EQ(1024, reused.rows());
+    const auto& reused_column =
+            assert_cast<const vectorized::ColumnVector<Int32>&>(*reused.get_by_position(0).column);
+    // The memory of the pooled column is reused.
+    EXPECT_EQ(received_data, reused_column.get_data().data());
+    for (int i = 0; i < 1024; ++i) {
+        EXPECT_EQ(i, reused_column.get_data()[i]);
+    }
+
+    // A block with shared columns is not pooled.
+    auto shared_column = reused.get_by_position(0).column;
+    EXPECT_FALSE(pool.give_back(std::move(reused)));
+}
+
 } // namespace doris
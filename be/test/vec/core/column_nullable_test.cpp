@@ -25,6 +25,7 @@
 
 #include "gtest/gtest_pred_impl.h"
 #include "vec/columns/column_vector.h"
+#include "vec/common/assert_cast.h"
 #include "vec/common/sip_hash.h"
 
 namespace doris::vectorized {
@@ -51,4 +52,46 @@ TEST(ColumnNullableTest, HashTest) {
     EXPECT_NE(hashes[0].get64(), hashes[1].get64());
 }
 
+TEST(ColumnNullableTest, HasNullPropagation) {
+    auto column = ColumnNullable::create(ColumnVector<int>::create(), ColumnUInt8::create());
+    column->clear();
+    int value = 1;
+    for (int i = 0; i < 10; ++i) {
+        column->insert_data((const char*)&value, sizeof(value));
+    }
+    column->insert_not_null_elements(5);
+    EXPECT_FALSE(column->has_null());
+
+    IColumn::Filter filter(15, 1);
+    filter[3] = 0;
+    EXPECT_FALSE(assert_cast<const ColumnNullable&>(*column->filter(filter, 0)).has_null());
+    IColumn::Permutation perm {3, 2, 1};
+    EXPECT_FALSE(assert_cast<const ColumnNullable&>(*column->permute(perm, 3)).has_null());
+    EXPECT_FALSE(assert_cast<const ColumnNullable&>(*column->clone_resized(5)).has_null());
+    // resized to be bigger, the new rows are nulls
+    EXPECT_TRUE(assert_cast<const ColumnNullable&>(*column->clone_resized(20)).has_null());
+
+    auto with_null = column->clone_resized(20);
+    column->insert_range_from(*with_null, 0, 10);
+    EXPECT_FALSE(column->has_null());
+    column->insert_range_from(*with_null, 10, 10);
+    EXPECT_TRUE(column->has_null());
+    // the rows inserted after nulls do not hide them
+    column->insert_not_null_elements(5);
+    EXPECT_TRUE(column->has_null());
+
+    // the nulls are filtered out
+    IColumn::Filter only_not_null(column->size(), 1);
+    for (size_t i = 30; i < 35; ++i) {
+        only_not_null[i] = 0;
+    }
+    EXPECT_EQ(35, column->filter(only_not_null));
+    EXPECT_FALSE(column->has_null());
+
+    column->insert_null_elements(1);
+    EXPECT_TRUE(column->has_null());
+    column->clear();
+    EXPECT_FALSE(column->has_null());
+}
+
 } // namespace doris::vectorized
@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/core/sort_block.h"
+
+#include <gtest/gtest.h>
+
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/columns_number.h"
+#include "vec/core/block.h"
+#include "vec/data_types/data_type_nullable.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+// Rows of a nullable int column and a bigint column, with enough rows for the radix sort.
+static Block create_block(size_t rows) {
+    auto ints = ColumnInt32::create();
+    auto nulls = ColumnUInt8::create();
+    auto bigints = ColumnInt64::create();
+    for (size_t i = 0; i < rows; ++i) {
+        ints->insert_value(int32_t(i * 7 % 11) - 5);
+        nulls->insert_value(i % 13 == 0);
+        bigints->insert_value(int64_t(i * 31 % 17) - 8);
+    }
+    Block block;
+    block.insert({ColumnNullable::create(std::move(ints), std::move(nulls)),
+                  make_nullable(std::make_shared<DataTypeInt32>()), "a"});
+    block.insert({std::move(bigints), std::make_shared<DataTypeInt64>(), "b"});
+    return block;
+}
+
+static void check_sorted(const Block& block, const SortDescription& description) {
+    for (size_t row = 1; row < block.rows(); ++row) {
+        for (const auto& desc : description) {
+            const auto& column = block.get_by_position(desc.column_number).column;
+            int res = desc.direction *
+                      column->compare_at(row - 1, row, *column, desc.nulls_direction);
+            ASSERT_LE(res, 0) << "row " << row;
+            if (res < 0) {
+                break;
+            }
+        }
+    }
+}
+
+TEST(SortBlockTest, radix_sort_composite_keys) {
+    for (int direction : {1, -1}) {
+        for (bool nulls_first : {true, false}) {
+            Block block = create_block(1000);
+            SortDescription description;
+            description.emplace_back(0, direction, nulls_first ? -direction : direction);
+            description.emplace_back(1, -direction, -direction);
+            sort_block(block, block, description);
+            EXPECT_EQ(1000, block.rows());
+            check_sorted(block, description);
+
+            const auto& first = assert_cast<const ColumnNullable&>(
+                    *block.get_by_position(0).column);
+            EXPECT_EQ(nulls_first, first.is_null_at(0));
+        }
+    }
+}
+
+TEST(SortBlockTest, limit_uses_partial_sort) {
+    Block block = create_block(1000);
+    SortDescription description;
+    description.emplace_back(1, 1, 1);
+    sort_block(block, block, description, 10);
+    EXPECT_EQ(10, block.rows());
+    check_sorted(block, description);
+}
+
+TEST(SortBlockTest, string_keys_with_common_prefixes) {
+    // short and long strings sharing the first 4 bytes, and strings shorter than the prefix
+    auto strings = ColumnString::create();
+    auto ints = ColumnInt32::create();
+    for (size_t i = 0; i < 1000; ++i) {
+        std::string value = std::string("key") + std::string(i % 5, 'a' + i % 3);
+        value += std::to_string(i * 37 % 101);
+        strings->insert_data(value.data(), i % 17 == 0 ? i % 3 : value.size());
+        ints->insert_value(int32_t(i % 7));
+    }
+    for (int direction : {1, -1}) {
+        Block block;
+        block.insert({strings->clone(), std::make_shared<DataTypeString>(), "s"});
+        block.insert({ints->clone(), std::make_shared<DataTypeInt32>(), "i"});
+        SortDescription description;
+        description.emplace_back(0, direction, direction);
+        description.emplace_back(1, direction, direction);
+        sort_block(block, block, description);
+        EXPECT_EQ(1000, block.rows());
+        check_sorted(block, description);
+    }
+}
+
+} // namespace doris::vectorized
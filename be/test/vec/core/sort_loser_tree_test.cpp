@@ -0,0 +1,106 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/core/sort_loser_tree.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <deque>
+#include <vector>
+
+#include "vec/columns/columns_number.h"
+#include "vec/data_types/data_type_number.h"
+
+namespace doris::vectorized {
+
+static Block create_block(const std::vector<int64_t>& values) {
+    auto column = ColumnInt64::create();
+    for (auto value : values) {
+        column->insert_value(value);
+    }
+    Block block;
+    block.insert({std::move(column), std::make_shared<DataTypeInt64>(), "k"});
+    return block;
+}
+
+// Merge the sorted runs by the loser tree, and return the rows and the number of the batches.
+static std::vector<int64_t> merge(std::vector<std::vector<int64_t>> runs, size_t* batches) {
+    SortDescription description;
+    description.emplace_back(0, 1, 1);
+    std::deque<Block> blocks;
+    std::deque<MergeSortCursorImpl> impls;
+    std::vector<MergeSortCursor> cursors;
+    for (const auto& run : runs) {
+        blocks.push_back(create_block(run));
+        impls.emplace_back(blocks.back(), description);
+        cursors.emplace_back(&impls.back());
+    }
+    MergeSortLoserTree tree;
+    tree.init(std::move(cursors));
+
+    std::vector<int64_t> result;
+    *batches = 0;
+    while (!tree.empty()) {
+        auto current = tree.top();
+        size_t rows = tree.next_batch_rows(1024);
+        const auto& column = assert_cast<const ColumnInt64&>(*current->all_columns[0]);
+        for (size_t i = 0; i < rows; ++i) {
+            result.push_back(column.get_element(current->pos + i));
+        }
+        ++*batches;
+        current->pos += rows - 1;
+        if (current->is_last()) {
+            tree.remove_top();
+        } else {
+            current->next();
+            tree.update_top();
+        }
+    }
+    return result;
+}
+
+TEST(SortLoserTreeTest, interleaved_runs) {
+    std::vector<std::vector<int64_t>> runs(5);
+    std::vector<int64_t> expected;
+    for (int64_t i = 0; i < 500; ++i) {
+        runs[i * 7 % 5].push_back(i / 3);
+        expected.push_back(i / 3);
+    }
+    size_t batches = 0;
+    EXPECT_EQ(expected, merge(runs, &batches));
+}
+
+TEST(SortLoserTreeTest, disjoint_runs_are_output_at_once) {
+    std::vector<std::vector<int64_t>> runs(3);
+    std::vector<int64_t> expected;
+    for (int64_t i = 0; i < 300; ++i) {
+        runs[2 - i / 100].push_back(i);
+        expected.push_back(i);
+    }
+    size_t batches = 0;
+    EXPECT_EQ(expected, merge(runs, &batches));
+    // the first row of each run is a single batch before the winner is known to stay
+    EXPECT_LE(batches, 6);
+}
+
+TEST(SortLoserTreeTest, single_run) {
+    size_t batches = 0;
+    EXPECT_EQ(std::vector<int64_t>({1, 2, 3}), merge({{1, 2, 3}}, &batches));
+}
+
+} // namespace doris::vectorized
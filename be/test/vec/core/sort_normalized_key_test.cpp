@@ -0,0 +1,100 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/core/sort_normalized_key.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/columns_number.h"
+
+namespace doris::vectorized {
+
+// The order of the keys must never contradict the order of the columns, and equal rows must
+// have equal keys.
+static void check_keys(const ColumnRawPtrs& columns, const SortDescription& description,
+                       const NormalizedSortKeyLayout& layout) {
+    NormalizedSortKeys keys;
+    encode_normalized_sort_keys(columns, description, layout, keys);
+    size_t rows = columns[0]->size();
+    ASSERT_EQ(rows, keys.size());
+    size_t compared = layout.full_columns + (layout.prefix_bytes > 0);
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < rows; ++j) {
+            int res = 0;
+            for (size_t k = 0; k < compared && res == 0; ++k) {
+                res = description[k].direction *
+                      columns[k]->compare_at(i, j, *columns[k], description[k].nulls_direction);
+            }
+            if (res < 0) {
+                ASSERT_LE(keys[i], keys[j]) << i << " " << j;
+            } else if (res > 0) {
+                ASSERT_GE(keys[i], keys[j]) << i << " " << j;
+            } else {
+                ASSERT_EQ(keys[i], keys[j]) << i << " " << j;
+            }
+        }
+    }
+}
+
+TEST(SortNormalizedKeyTest, int_and_string_prefix) {
+    auto ints = ColumnInt64::create();
+    auto nulls = ColumnUInt8::create();
+    auto strings = ColumnString::create();
+    const std::string values[] = {"", "a", "ab", "abcdefgh", "abcdefghij", "b", "\xff", "B"};
+    for (size_t i = 0; i < 64; ++i) {
+        ints->insert_value(int64_t(i % 5) - 2);
+        nulls->insert_value(i % 7 == 0);
+        const auto& value = values[i % 8];
+        strings->insert_data(value.data(), value.size());
+    }
+    auto nullable = ColumnNullable::create(std::move(ints), std::move(nulls));
+    ColumnRawPtrs columns = {nullable.get(), strings.get()};
+
+    for (int direction : {1, -1}) {
+        for (int nulls_direction : {1, -1}) {
+            SortDescription description;
+            description.emplace_back(0, direction, nulls_direction);
+            description.emplace_back(1, -direction, nulls_direction);
+
+            auto layout = plan_normalized_sort_keys(columns, description, true);
+            EXPECT_EQ(1, layout.full_columns);
+            EXPECT_GT(layout.prefix_bytes, 0);
+            check_keys(columns, description, layout);
+
+            auto full_layout = plan_normalized_sort_keys(columns, description, false);
+            EXPECT_EQ(1, full_layout.full_columns);
+            EXPECT_EQ(0, full_layout.prefix_bytes);
+            EXPECT_FALSE(layout.comparable(full_layout));
+            check_keys(columns, description, full_layout);
+        }
+    }
+}
+
+TEST(SortNormalizedKeyTest, unsupported_leading_column) {
+    auto strings = ColumnString::create();
+    strings->insert_data("a", 1);
+    ColumnRawPtrs columns = {strings.get()};
+    SortDescription description;
+    description.emplace_back(0, 1, 1);
+    EXPECT_TRUE(plan_normalized_sort_keys(columns, description, false).empty());
+}
+
+} // namespace doris::vectorized
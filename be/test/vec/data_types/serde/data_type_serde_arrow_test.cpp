@@ -651,4 +651,51 @@ TEST(DataTypeSerDeArrowTest, DataTypeMapNullKeySerDeTest) {
     EXPECT_EQ(block.dump_data(1, 1), new_block.dump_data(1, 1));
 }
 
+TEST(DataTypeSerDeArrowTest, ShareColumnMemoryTest) {
+    const int row_num = 100;
+    auto int_column = ColumnInt32::create();
+    auto str_column = ColumnString::create();
+    auto null_map = ColumnUInt8::create();
+    for (int i = 0; i < row_num; ++i) {
+        int_column->insert_value(i);
+        std::string str = std::to_string(i);
+        str_column->insert_data(str.data(), str.size());
+        null_map->insert_value(i % 3 == 0);
+    }
+    const auto* int_data = int_column->get_data().data();
+    const auto* chars_data = str_column->get_chars().data();
+    ColumnPtr nullable_int = ColumnNullable::create(std::move(int_column), null_map->clone());
+    ColumnPtr nullable_str = ColumnNullable::create(std::move(str_column), std::move(null_map));
+
+    std::shared_ptr<arrow::RecordBatch> result;
+    {
+        Block block;
+        block.insert({nullable_int, make_nullable(std::make_shared<DataTypeInt32>()), "i"});
+        block.insert({nullable_str, make_nullable(std::make_shared<DataTypeString>()), "s"});
+        nullable_int = nullptr;
+        nullable_str = nullptr;
+        auto arrow_schema = arrow::schema(
+                {arrow::field("i", arrow::int32(), true), arrow::field("s", arrow::utf8(), true)});
+        cctz::time_zone timezone_obj;
+        TimezoneUtils::find_cctz_time_zone(TimezoneUtils::default_time_zone, timezone_obj);
+        ASSERT_TRUE(convert_to_arrow_batch(block, arrow_schema, arrow::default_memory_pool(),
+                                           &result, timezone_obj)
+                            .ok());
+    }
+    // the arrays share the memory of the columns, which live until the arrays are released
+    const auto& int_array = assert_cast<const arrow::Int32Array&>(*result->column(0));
+    const auto& str_array = assert_cast<const arrow::StringArray&>(*result->column(1));
+    EXPECT_EQ(reinterpret_cast<const uint8_t*>(int_data), int_array.values()->data());
+    EXPECT_EQ(chars_data, str_array.value_data()->data());
+    EXPECT_EQ(int_array.null_count(), (row_num + 2) / 3);
+    EXPECT_EQ(str_array.null_count(), (row_num + 2) / 3);
+    for (int i = 0; i < row_num; ++i) {
+        EXPECT_EQ(int_array.IsNull(i), i % 3 == 0);
+        EXPECT_EQ(str_array.IsNull(i), i % 3 == 0);
+        EXPECT_EQ(int_array.Value(i), i);
+        EXPECT_EQ(str_array.GetString(i), std::to_string(i));
+    }
+    EXPECT_TRUE(result->ValidateFull().ok());
+}
+
 } // namespace doris::vectorized
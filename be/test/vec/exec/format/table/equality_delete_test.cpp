@@ -0,0 +1,109 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/format/table/equality_delete.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "util/runtime_profile.h"
+#include "vec/columns/column_string.h"
+#include "vec/columns/columns_number.h"
+#include "vec/common/assert_cast.h"
+#include "vec/data_types/data_type_number.h"
+#include "vec/data_types/data_type_string.h"
+
+namespace doris::vectorized {
+
+class EqualityDeleteTest : public testing::Test {
+protected:
+    static ColumnWithTypeAndName _int_column(const std::vector<int32_t>& values,
+                                             const std::string& name) {
+        auto column = ColumnInt32::create();
+        for (int32_t value : values) {
+            column->insert_value(value);
+        }
+        return {std::move(column), std::make_shared<DataTypeInt32>(), name};
+    }
+
+    static ColumnWithTypeAndName _string_column(const std::vector<std::string>& values,
+                                                const std::string& name) {
+        auto column = ColumnString::create();
+        for (const auto& value : values) {
+            column->insert_data(value.data(), value.size());
+        }
+        return {std::move(column), std::make_shared<DataTypeString>(), name};
+    }
+
+    RuntimeProfile _profile {"test"};
+};
+
+TEST_F(EqualityDeleteTest, simple_equality_delete) {
+    Block delete_block;
+    delete_block.insert(_int_column({1, 3, 5}, "id"));
+    auto delete_impl = EqualityDeleteBase::get_delete_impl(&delete_block);
+    ASSERT_TRUE(delete_impl->init(&_profile).ok());
+
+    // the built delete is shared by the scanners
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < 100; ++j) {
+                Block data_block;
+                data_block.insert(_int_column({1, 2, 3, 4, 5, 6}, "id"));
+                ASSERT_TRUE(delete_impl->filter_data_block(&data_block).ok());
+                ASSERT_EQ(3, data_block.rows());
+                auto& ids = assert_cast<const ColumnInt32&>(*data_block.get_by_position(0).column);
+                EXPECT_EQ(2, ids.get_element(0));
+                EXPECT_EQ(4, ids.get_element(1));
+                EXPECT_EQ(6, ids.get_element(2));
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+TEST_F(EqualityDeleteTest, multi_equality_delete) {
+    Block delete_block;
+    delete_block.insert(_int_column({1, 2}, "id"));
+    delete_block.insert(_string_column({"a", "b"}, "name"));
+    auto delete_impl = EqualityDeleteBase::get_delete_impl(&delete_block);
+    ASSERT_TRUE(delete_impl->init(&_profile).ok());
+
+    for (int i = 0; i < 2; ++i) {
+        Block data_block;
+        data_block.insert(_string_column({"a", "a", "b", "c"}, "name"));
+        data_block.insert(_int_column({1, 2, 2, 2}, "id"));
+        ASSERT_TRUE(delete_impl->filter_data_block(&data_block).ok());
+        ASSERT_EQ(2, data_block.rows());
+        auto& names = assert_cast<const ColumnString&>(*data_block.get_by_name("name").column);
+        EXPECT_EQ("a", names.get_data_at(0).to_string());
+        EXPECT_EQ("c", names.get_data_at(1).to_string());
+    }
+
+    Block missing_block;
+    missing_block.insert(_int_column({1}, "id"));
+    EXPECT_FALSE(delete_impl->filter_data_block(&missing_block).ok());
+}
+
+} // namespace doris::vectorized
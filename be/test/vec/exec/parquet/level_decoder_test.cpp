@@ -0,0 +1,113 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/format/parquet/level_decoder.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "util/faststring.h"
+#include "util/rle_encoding.h"
+
+namespace doris::vectorized {
+
+class LevelDecoderTest : public testing::Test {
+public:
+    void SetUp() override {
+        // literal runs mixed with long repeated runs
+        for (int i = 0; i < 3000; ++i) {
+            _levels.push_back(i % 3);
+        }
+        _levels.insert(_levels.end(), 5000, 2);
+        for (int i = 0; i < 77; ++i) {
+            _levels.push_back(i % 2);
+        }
+        _levels.insert(_levels.end(), 100, 0);
+
+        RleEncoder<level_t> encoder(&_buffer, 2);
+        for (level_t level : _levels) {
+            encoder.Put(level);
+        }
+        encoder.Flush();
+    }
+
+protected:
+    Status _init(LevelDecoder* decoder) {
+        return decoder->init_v2(Slice(_buffer.data(), _buffer.size()), 2, _levels.size());
+    }
+
+    std::vector<level_t> _levels;
+    faststring _buffer;
+};
+
+TEST_F(LevelDecoderTest, get_levels) {
+    LevelDecoder decoder;
+    ASSERT_TRUE(_init(&decoder).ok());
+    std::vector<level_t> levels(_levels.size());
+    size_t num_decoded = 0;
+    // odd batch sizes to cut the runs of 32 values
+    while (num_decoded < levels.size()) {
+        size_t n = decoder.get_levels(levels.data() + num_decoded, 333);
+        ASSERT_GT(n, 0);
+        num_decoded += n;
+    }
+    EXPECT_EQ(_levels, levels);
+    EXPECT_FALSE(decoder.has_levels());
+}
+
+TEST_F(LevelDecoderTest, get_next_run) {
+    LevelDecoder decoder;
+    ASSERT_TRUE(_init(&decoder).ok());
+    std::vector<level_t> levels;
+    while (levels.size() < _levels.size()) {
+        level_t level = -1;
+        size_t n = decoder.get_next_run(&level, 1000);
+        ASSERT_GT(n, 0);
+        ASSERT_LE(n, 1000);
+        levels.insert(levels.end(), n, level);
+    }
+    EXPECT_EQ(_levels, levels);
+}
+
+TEST_F(LevelDecoderTest, get_next_and_rewind) {
+    LevelDecoder decoder;
+    ASSERT_TRUE(_init(&decoder).ok());
+    std::vector<level_t> levels;
+    for (size_t i = 0; i < _levels.size(); ++i) {
+        level_t level = decoder.get_next();
+        if (i % 7 == 0) {
+            decoder.rewind_one();
+            ASSERT_EQ(level, decoder.get_next());
+        }
+        levels.push_back(level);
+    }
+    EXPECT_EQ(_levels, levels);
+
+    // mix the reading run by run and one by one
+    ASSERT_TRUE(_init(&decoder).ok());
+    levels.clear();
+    while (levels.size() < _levels.size()) {
+        levels.push_back(decoder.get_next());
+        level_t level = -1;
+        size_t n = decoder.get_next_run(&level, _levels.size() - levels.size());
+        levels.insert(levels.end(), n, level);
+    }
+    EXPECT_EQ(_levels, levels);
+}
+
+} // namespace doris::vectorized
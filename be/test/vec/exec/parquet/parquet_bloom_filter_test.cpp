@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gen_cpp/parquet_types.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "exec/olap_common.h"
+#include "vec/exec/format/parquet/parquet_pred_cmp.h"
+#include "vec/exec/format/parquet/schema_desc.h"
+#include "vec/exec/format/parquet/vparquet_bloom_filter.h"
+
+namespace doris::vectorized {
+
+class ParquetBloomFilterTest : public testing::Test {};
+
+TEST_F(ParquetBloomFilterTest, test_plain) {
+    ParquetBloomFilter bf;
+    ASSERT_TRUE(bf.init(1024).ok());
+    for (int32_t i = 0; i < 100; ++i) {
+        bf.add_plain(&i, sizeof(i));
+    }
+    for (int32_t i = 0; i < 100; ++i) {
+        EXPECT_TRUE(bf.test_plain(&i, sizeof(i)));
+    }
+    int false_positive = 0;
+    for (int32_t i = 100; i < 1100; ++i) {
+        false_positive += bf.test_plain(&i, sizeof(i));
+    }
+    EXPECT_LT(false_positive, 100);
+}
+
+TEST_F(ParquetBloomFilterTest, filter_by_bloom_filter) {
+    ParquetBloomFilter bf;
+    ASSERT_TRUE(bf.init(1024).ok());
+    std::vector<std::string> values {"beijing", "shanghai", "shenzhen"};
+    for (auto& value : values) {
+        bf.add_plain(value.data(), value.size());
+    }
+
+    FieldSchema col_schema;
+    col_schema.type = TypeDescriptor(TYPE_STRING);
+    col_schema.physical_type = tparquet::Type::BYTE_ARRAY;
+
+    std::string hit = "shanghai";
+    std::string miss1 = "hangzhou";
+    std::string miss2 = "guangzhou";
+    ColumnValueRange<TYPE_STRING> hit_range("city");
+    ASSERT_TRUE(hit_range.add_fixed_value(StringRef(miss1)).ok());
+    ASSERT_TRUE(hit_range.add_fixed_value(StringRef(hit)).ok());
+    EXPECT_FALSE(ParquetPredicate::filter_by_bloom_filter(hit_range, &col_schema, bf));
+
+    ColumnValueRange<TYPE_STRING> miss_range("city");
+    ASSERT_TRUE(miss_range.add_fixed_value(StringRef(miss1)).ok());
+    ASSERT_TRUE(miss_range.add_fixed_value(StringRef(miss2)).ok());
+    EXPECT_TRUE(ParquetPredicate::filter_by_bloom_filter(miss_range, &col_schema, bf));
+
+    // the range predicates can not be checked by bloom filter
+    ColumnValueRange<TYPE_STRING> scope_range("city");
+    EXPECT_FALSE(ParquetPredicate::filter_by_bloom_filter(scope_range, &col_schema, bf));
+
+    // the type of value in file is different from the predicate
+    col_schema.physical_type = tparquet::Type::FIXED_LEN_BYTE_ARRAY;
+    EXPECT_FALSE(ParquetPredicate::filter_by_bloom_filter(miss_range, &col_schema, bf));
+}
+
+} // namespace doris::vectorized
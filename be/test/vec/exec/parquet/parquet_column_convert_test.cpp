@@ -0,0 +1,62 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/format/parquet/parquet_column_convert.h"
+
+#include <cctz/time_zone.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "vec/exec/format/parquet/schema_desc.h"
+#include "vec/runtime/vdatetime_value.h"
+
+namespace doris::vectorized {
+
+class ParquetColumnConvertTest : public testing::Test {};
+
+TEST_F(ParquetColumnConvertTest, from_unixtime) {
+    std::vector<int64_t> timestamps {0,          -1,          86399,        86400,
+                                     1700000000, -2208988800, -2208988801, 2208988800,
+                                     951782400,  4102444800,  -62135596800};
+    cctz::time_zone shanghai;
+    bool has_shanghai = cctz::load_time_zone("Asia/Shanghai", &shanghai);
+    std::vector<cctz::time_zone> time_zones {
+            cctz::utc_time_zone(), cctz::fixed_time_zone(std::chrono::hours(8)),
+            cctz::fixed_time_zone(-std::chrono::minutes(330)), shanghai};
+    for (auto& ctz : time_zones) {
+        std::string timezone = ctz.name();
+        FieldSchema field_schema;
+        ConvertParams params;
+        params.init(&field_schema, &ctz);
+        // shanghai is UTC if the tzdata is not installed
+        EXPECT_EQ(timezone != "Asia/Shanghai" || !has_shanghai, params.is_fixed_offset_zone);
+        for (int64_t timestamp : timestamps) {
+            DateV2Value<DateTimeV2ValueType> expected;
+            expected.from_unixtime(timestamp, ctz);
+            expected.set_microsecond(123456);
+            DateV2Value<DateTimeV2ValueType> value;
+            params.from_unixtime(timestamp, 123456, value);
+            EXPECT_EQ(expected.to_date_int_val(), value.to_date_int_val())
+                    << timezone << " " << timestamp;
+        }
+    }
+}
+
+} // namespace doris::vectorized
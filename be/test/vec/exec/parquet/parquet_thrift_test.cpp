@@ -101,6 +101,37 @@ TEST_F(ParquetThriftReaderTest, normal) {
     delete meta_data;
 }
 
+TEST_F(ParquetThriftReaderTest, compact_footer) {
+    auto local_fs = io::global_local_filesystem();
+    io::FileReaderSPtr reader;
+    auto st = local_fs->open_file("./be/test/exec/test_data/parquet_scanner/localfile.parquet",
+                                  &reader);
+    EXPECT_TRUE(st.ok());
+
+    FileMetaData* meta_data;
+    size_t meta_size;
+    ASSERT_TRUE(parse_thrift_footer(reader, &meta_data, &meta_size, nullptr).ok());
+    std::unique_ptr<FileMetaData> meta_guard(meta_data);
+    size_t num_row_groups = meta_data->to_thrift().row_groups.size();
+    int32_t num_fields = meta_data->schema().size();
+    size_t mem_size = meta_data->get_mem_size();
+    EXPECT_GT(mem_size, sizeof(FileMetaData));
+
+    meta_data->compact();
+    const auto& t_metadata = meta_data->to_thrift();
+    EXPECT_LE(meta_data->get_mem_size(), mem_size);
+    EXPECT_EQ(num_row_groups, t_metadata.row_groups.size());
+    EXPECT_EQ(num_fields, meta_data->schema().size());
+    for (const auto& kv : t_metadata.key_value_metadata) {
+        EXPECT_EQ("iceberg.schema", kv.key);
+    }
+    for (const auto& row_group : t_metadata.row_groups) {
+        for (const auto& chunk : row_group.columns) {
+            EXPECT_TRUE(chunk.meta_data.path_in_schema.empty());
+        }
+    }
+}
+
 TEST_F(ParquetThriftReaderTest, complex_nested_file) {
     // hive-complex.parquet is the part of following table:
     // complex_nested_table(
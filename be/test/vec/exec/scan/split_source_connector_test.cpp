@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exec/scan/split_source_connector.h"
+
+#include <gen_cpp/PaloInternalService_types.h>
+#include <gen_cpp/PlanNodes_types.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "common/config.h"
+
+namespace doris::vectorized {
+
+class SplitSourceConnectorTest : public testing::Test {
+public:
+    void SetUp() override { _order_by_size = config::enable_split_source_order_by_size; }
+
+    void TearDown() override { config::enable_split_source_order_by_size = _order_by_size; }
+
+protected:
+    static std::vector<TScanRangeParams> _scan_ranges(
+            const std::vector<std::vector<std::pair<int64_t, int64_t>>>& sizes) {
+        std::vector<TScanRangeParams> scan_ranges;
+        int file_id = 0;
+        for (auto& range_sizes : sizes) {
+            TScanRangeParams params;
+            auto& ranges = params.scan_range.ext_scan_range.file_scan_range.ranges;
+            for (auto [size, file_size] : range_sizes) {
+                TFileRangeDesc range;
+                range.path = "file" + std::to_string(file_id++);
+                range.size = size;
+                range.file_size = file_size;
+                ranges.push_back(range);
+            }
+            scan_ranges.push_back(params);
+        }
+        return scan_ranges;
+    }
+
+    static std::vector<std::string> _get_all(SplitSourceConnector* split_source) {
+        std::vector<std::string> paths;
+        bool has_next = true;
+        while (true) {
+            TFileRangeDesc range;
+            EXPECT_TRUE(split_source->get_next(&has_next, &range).ok());
+            if (!has_next) {
+                break;
+            }
+            paths.push_back(range.path);
+        }
+        return paths;
+    }
+
+private:
+    bool _order_by_size;
+};
+
+TEST_F(SplitSourceConnectorTest, order_by_size) {
+    config::enable_split_source_order_by_size = true;
+    // file3 reads the whole file, and the size of file4 is unknown
+    LocalSplitSourceConnector split_source(
+            _scan_ranges({{{10, 100}, {300, 300}}, {{20, 100}, {-1, 200}, {-1, -1}}}));
+    EXPECT_EQ(2, split_source.num_scan_ranges());
+    std::vector<std::string> expected {"file1", "file3", "file2", "file0", "file4"};
+    EXPECT_EQ(expected, _get_all(&split_source));
+}
+
+TEST_F(SplitSourceConnectorTest, original_order) {
+    config::enable_split_source_order_by_size = false;
+    LocalSplitSourceConnector split_source(
+            _scan_ranges({{{10, 100}, {300, 300}}, {}, {{20, 100}, {-1, 200}}}));
+    std::vector<std::string> expected {"file0", "file1", "file2", "file3"};
+    EXPECT_EQ(expected, _get_all(&split_source));
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,158 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exprs/vcase_expr.h"
+
+#include <gen_cpp/Exprs_types.h>
+#include <gen_cpp/Types_types.h>
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <vector>
+
+#include "common/config.h"
+#include "common/object_pool.h"
+#include "runtime/descriptors.h"
+#include "runtime/runtime_state.h"
+#include "runtime/types.h"
+#include "testutil/desc_tbl_builder.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/columns_number.h"
+#include "vec/core/block.h"
+#include "vec/exprs/vexpr.h"
+#include "vec/exprs/vexpr_context.h"
+
+namespace doris::vectorized {
+
+static TExprNode create_slot_ref_node(int slot_id, PrimitiveType type) {
+    TSlotRef slot_ref;
+    slot_ref.__set_slot_id(slot_id);
+    slot_ref.__set_tuple_id(0);
+    TExprNode node;
+    node.__set_node_type(TExprNodeType::SLOT_REF);
+    node.__set_type(TypeDescriptor(type).to_thrift());
+    node.__set_num_children(0);
+    node.__set_is_nullable(true);
+    node.__set_slot_ref(slot_ref);
+    return node;
+}
+
+static TExprNode create_abs_node() {
+    TFunctionName name;
+    name.__set_function_name("abs");
+    TFunction fn;
+    fn.__set_name(name);
+    fn.__set_binary_type(TFunctionBinaryType::BUILTIN);
+    fn.__set_arg_types({TypeDescriptor(TYPE_INT).to_thrift()});
+    fn.__set_ret_type(TypeDescriptor(TYPE_BIGINT).to_thrift());
+    fn.__set_has_var_args(false);
+    TExprNode node;
+    node.__set_node_type(TExprNodeType::FUNCTION_CALL);
+    node.__set_type(TypeDescriptor(TYPE_BIGINT).to_thrift());
+    node.__set_num_children(1);
+    node.__set_is_nullable(true);
+    node.__set_fn(fn);
+    return node;
+}
+
+// CASE WHEN c0 THEN abs(c1) WHEN c2 THEN abs(c1) END
+static TExpr create_case_expr() {
+    TCaseExpr case_expr;
+    case_expr.__set_has_case_expr(false);
+    case_expr.__set_has_else_expr(false);
+    TExprNode node;
+    node.__set_node_type(TExprNodeType::CASE_EXPR);
+    node.__set_type(TypeDescriptor(TYPE_BIGINT).to_thrift());
+    node.__set_num_children(4);
+    node.__set_is_nullable(true);
+    node.__set_case_expr(case_expr);
+
+    TExpr expr;
+    expr.nodes = {node,
+                  create_slot_ref_node(0, TYPE_BOOLEAN),
+                  create_abs_node(),
+                  create_slot_ref_node(1, TYPE_INT),
+                  create_slot_ref_node(2, TYPE_BOOLEAN),
+                  create_abs_node(),
+                  create_slot_ref_node(1, TYPE_INT)};
+    return expr;
+}
+
+TEST(VCaseExprTest, ShortCircuit) {
+    ObjectPool object_pool;
+    DescriptorTblBuilder builder(&object_pool);
+    builder.declare_tuple() << TYPE_BOOLEAN << TYPE_INT << TYPE_BOOLEAN;
+    DescriptorTbl* desc_tbl = builder.build();
+    auto* tuple_desc = const_cast<TupleDescriptor*>(desc_tbl->get_tuple_descriptor(0));
+    RowDescriptor row_desc(tuple_desc, false);
+    RuntimeState state;
+    state.set_desc_tbl(desc_tbl);
+
+    // the rows of c0, c1 and c2, -1 is null
+    const std::vector<int> c0 {1, 0, -1, 0, 1, 0, -1, 0};
+    const std::vector<int> c1 {-1, -2, -3, -4, 5, 6, -7, 8};
+    const std::vector<int> c2 {0, 1, 1, 0, 1, -1, 0, 1};
+    Block block;
+    for (const auto* values : {&c0, &c1, &c2}) {
+        auto null_map = ColumnUInt8::create();
+        IColumn::MutablePtr data;
+        if (values == &c1) {
+            auto int_data = ColumnInt32::create();
+            for (int value : *values) {
+                int_data->insert_value(value);
+                null_map->insert_value(0);
+            }
+            data = std::move(int_data);
+        } else {
+            auto bool_data = ColumnUInt8::create();
+            for (int value : *values) {
+                bool_data->insert_value(value > 0);
+                null_map->insert_value(value < 0);
+            }
+            data = std::move(bool_data);
+        }
+        auto* slot = tuple_desc->slots()[block.columns()];
+        block.insert({ColumnNullable::create(std::move(data), std::move(null_map)),
+                      slot->get_data_type_ptr(), slot->col_name()});
+    }
+
+    std::vector<ColumnPtr> results;
+    for (bool short_circuit : {false, true}) {
+        config::enable_case_when_short_circuit = short_circuit;
+        VExprContextSPtr ctx;
+        ASSERT_TRUE(VExpr::create_expr_tree(create_case_expr(), ctx).ok());
+        ASSERT_TRUE(ctx->prepare(&state, row_desc).ok());
+        ASSERT_TRUE(ctx->open(&state).ok());
+        Block input_block = block;
+        int result_column_id = -1;
+        ASSERT_TRUE(ctx->execute(&input_block, &result_column_id).ok());
+        results.push_back(input_block.get_by_position(result_column_id).column);
+    }
+    config::enable_case_when_short_circuit = true;
+
+    for (size_t row = 0; row < c0.size(); ++row) {
+        bool is_null = c0[row] != 1 && c2[row] != 1;
+        for (const auto& result : results) {
+            ASSERT_EQ(is_null, result->is_null_at(row)) << row;
+            if (!is_null) {
+                EXPECT_EQ(std::abs(c1[row]), (*result)[row].get<Int64>()) << row;
+            }
+        }
+    }
+}
+
+} // namespace doris::vectorized
@@ -0,0 +1,150 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/exprs/vcommon_expr.h"
+
+#include <gen_cpp/Exprs_types.h>
+#include <gen_cpp/Types_types.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "common/object_pool.h"
+#include "runtime/descriptors.h"
+#include "runtime/runtime_state.h"
+#include "runtime/types.h"
+#include "testutil/desc_tbl_builder.h"
+#include "vec/columns/column_nullable.h"
+#include "vec/columns/columns_number.h"
+#include "vec/core/block.h"
+#include "vec/exprs/vexpr.h"
+#include "vec/exprs/vexpr_context.h"
+
+namespace doris::vectorized {
+
+static TExprNode create_slot_ref_node(int slot_id) {
+    TSlotRef slot_ref;
+    slot_ref.__set_slot_id(slot_id);
+    slot_ref.__set_tuple_id(0);
+    TExprNode node;
+    node.__set_node_type(TExprNodeType::SLOT_REF);
+    node.__set_type(TypeDescriptor(TYPE_INT).to_thrift());
+    node.__set_num_children(0);
+    node.__set_is_nullable(true);
+    node.__set_slot_ref(slot_ref);
+    return node;
+}
+
+static TExpr create_abs_expr(int slot_id) {
+    TFunctionName name;
+    name.__set_function_name("abs");
+    TFunction fn;
+    fn.__set_name(name);
+    fn.__set_binary_type(TFunctionBinaryType::BUILTIN);
+    fn.__set_arg_types({TypeDescriptor(TYPE_INT).to_thrift()});
+    fn.__set_ret_type(TypeDescriptor(TYPE_BIGINT).to_thrift());
+    fn.__set_has_var_args(false);
+    TExprNode node;
+    node.__set_node_type(TExprNodeType::FUNCTION_CALL);
+    node.__set_type(TypeDescriptor(TYPE_BIGINT).to_thrift());
+    node.__set_num_children(1);
+    node.__set_is_nullable(true);
+    node.__set_fn(fn);
+
+    TExpr expr;
+    expr.nodes = {node, create_slot_ref_node(slot_id)};
+    return expr;
+}
+
+TEST(VCommonExprTest, ExecuteOncePerBlock) {
+    ObjectPool object_pool;
+    DescriptorTblBuilder builder(&object_pool);
+    builder.declare_tuple() << TYPE_INT << TYPE_INT;
+    DescriptorTbl* desc_tbl = builder.build();
+    auto* tuple_desc = const_cast<TupleDescriptor*>(desc_tbl->get_tuple_descriptor(0));
+    RowDescriptor row_desc(tuple_desc, false);
+    RuntimeState state;
+    state.set_desc_tbl(desc_tbl);
+
+    // abs(c0), abs(c0), abs(c1)
+    VExprContextSPtrs ctxs;
+    ASSERT_TRUE(VExpr::create_expr_trees({create_abs_expr(0), create_abs_expr(0),
+                                          create_abs_expr(1)},
+                                         ctxs)
+                        .ok());
+    int num_common_exprs = 0;
+    VCommonExpr::rewrite(ctxs, &num_common_exprs);
+    ASSERT_EQ(1, num_common_exprs);
+    auto* common_expr0 = dynamic_cast<VCommonExpr*>(ctxs[0]->root().get());
+    auto* common_expr1 = dynamic_cast<VCommonExpr*>(ctxs[1]->root().get());
+    ASSERT_NE(nullptr, common_expr0);
+    ASSERT_NE(nullptr, common_expr1);
+    EXPECT_EQ(0, common_expr0->common_expr_id());
+    EXPECT_EQ(0, common_expr1->common_expr_id());
+    EXPECT_EQ(nullptr, dynamic_cast<VCommonExpr*>(ctxs[2]->root().get()));
+
+    ASSERT_TRUE(VExpr::prepare(ctxs, &state, row_desc).ok());
+    ASSERT_TRUE(VExpr::open(ctxs, &state).ok());
+
+    auto create_block = [&]() {
+        Block block;
+        for (auto* slot : tuple_desc->slots()) {
+            auto data = ColumnInt32::create();
+            for (int i = 0; i < 4; ++i) {
+                data->insert_value(slot->id() == 0 ? -i : i * 10);
+            }
+            auto column = ColumnNullable::create(std::move(data), ColumnUInt8::create(4, 0));
+            block.insert({std::move(column), slot->get_data_type_ptr(), slot->col_name()});
+        }
+        return block;
+    };
+
+    auto execute = [&](Block* block) {
+        std::vector<int> result_column_ids(ctxs.size());
+        for (size_t i = 0; i < ctxs.size(); ++i) {
+            EXPECT_TRUE(ctxs[i]->execute(block, &result_column_ids[i]).ok());
+        }
+        return result_column_ids;
+    };
+
+    // without the results every expr is executed
+    Block block = create_block();
+    auto result_column_ids = execute(&block);
+    EXPECT_EQ(5, block.columns());
+    EXPECT_NE(result_column_ids[0], result_column_ids[1]);
+
+    std::vector<int> results(num_common_exprs, -1);
+    for (auto& ctx : ctxs) {
+        ctx->set_common_expr_results(&results);
+    }
+    for (int round = 0; round < 2; ++round) {
+        std::fill(results.begin(), results.end(), -1);
+        block = create_block();
+        result_column_ids = execute(&block);
+        EXPECT_EQ(4, block.columns());
+        EXPECT_EQ(result_column_ids[0], result_column_ids[1]);
+        EXPECT_EQ(result_column_ids[0], results[0]);
+        const auto& column = assert_cast<const ColumnNullable&>(
+                *block.get_by_position(result_column_ids[0]).column);
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_EQ(i, column.get_nested_column().get_int(i));
+        }
+    }
+}
+
+} // namespace doris::vectorized
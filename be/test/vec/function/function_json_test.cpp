@@ -85,4 +85,21 @@ TEST(FunctionJsonTEST, GetJsonStringTest) {
     static_cast<void>(check_function<DataTypeString, true>(func_name, input_types, data_set));
 }
 
+TEST(FunctionJsonTEST, GetJsonStringConstPathTest) {
+    std::string func_name = "get_json_string";
+    // the constant path is parsed once for the whole column
+    InputTypeSet input_types = {TypeIndex::String, Consted {TypeIndex::String}};
+    DataSet data_set = {
+            {{VARCHAR("{\"k1\":\"v1\", \"k2\":\"v2\"}"), VARCHAR("$.k2")}, VARCHAR("v2")},
+            {{VARCHAR("{\"k1\":{\"k2\":[1, 2]}}"), VARCHAR("$.k1.k2[1]")}, VARCHAR("2")},
+            {{VARCHAR("{\"k1\":\"v1\"}"), VARCHAR("$.k2")}, Null()},
+            {{VARCHAR("{\"k1\":\"v1\"}"), VARCHAR("$.k1\\")}, Null()}};
+
+    for (const auto& line : data_set) {
+        DataSet const_path_dataset = {line};
+        static_cast<void>(
+                check_function<DataTypeString, true>(func_name, input_types, const_path_dataset));
+    }
+}
+
 } // namespace doris::vectorized
@@ -80,6 +80,32 @@ TEST(FunctionLikeTest, like) {
             check_function<DataTypeUInt8, true>(func_name, const_pattern_input_types, data_set));
 }
 
+TEST(FunctionLikeTest, like_substrings) {
+    std::string func_name = "like";
+
+    DataSet data_set = {
+            {{std::string("abc"), std::string("%a%c%")}, uint8_t(1)},
+            {{std::string("abc"), std::string("%c%a%")}, uint8_t(0)},
+            {{std::string("aXbXc"), std::string("%%a%b%%c%")}, uint8_t(1)},
+            // the substrings can not overlap
+            {{std::string("aba"), std::string("%aba%ba%")}, uint8_t(0)},
+            {{std::string("ababa"), std::string("%aba%ba%")}, uint8_t(1)},
+            // the first match of a substring is not always followed by the others
+            {{std::string("xayxaz"), std::string("%xa%z%")}, uint8_t(1)},
+            {{std::string("facebook_10008_T1+T2"), std::string("%book%T1+T2%")}, uint8_t(1)},
+            {{std::string(""), std::string("%a%b%")}, uint8_t(0)},
+            {{std::string("abc"), Null()}, Null()},
+            {{Null(), std::string("%a%b%")}, Null()}};
+
+    // pattern is constant value
+    InputTypeSet const_pattern_input_types = {TypeIndex::String, Consted {TypeIndex::String}};
+    for (const auto& line : data_set) {
+        DataSet const_pattern_dataset = {line};
+        static_cast<void>(check_function<DataTypeUInt8, true>(func_name, const_pattern_input_types,
+                                                              const_pattern_dataset));
+    }
+}
+
 TEST(FunctionLikeTest, regexp) {
     std::string func_name = "regexp";
 
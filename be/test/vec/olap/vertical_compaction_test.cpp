@@ -437,6 +437,36 @@ TEST_F(VerticalCompactionTest, TestRowSourcesBuffer) {
     }
 }
 
+TEST_F(VerticalCompactionTest, TestRowSourcesBufferReaders) {
+    RowSourcesBuffer buffer(102, absolute_dir, ReaderType::READER_BASE_COMPACTION);
+    std::vector<RowSource> row_sources;
+    for (uint16_t i = 0; i < 100; ++i) {
+        row_sources.emplace_back(i % 3, false);
+    }
+    EXPECT_TRUE(buffer.append(row_sources).ok());
+    EXPECT_TRUE(buffer.flush().ok());
+
+    // each reader reads all the row sources by itself, interleaved with the others
+    std::unique_ptr<RowSourcesBuffer> reader1;
+    std::unique_ptr<RowSourcesBuffer> reader2;
+    ASSERT_TRUE(buffer.create_reader(&reader1).ok());
+    ASSERT_TRUE(buffer.create_reader(&reader2).ok());
+    EXPECT_EQ(reader1->total_size(), 100);
+    EXPECT_EQ(reader2->total_size(), 100);
+    ASSERT_TRUE(reader1->seek_to_begin().ok());
+    ASSERT_TRUE(reader2->seek_to_begin().ok());
+    for (uint16_t i = 0; i < 100; ++i) {
+        ASSERT_TRUE(reader1->has_remaining().ok());
+        EXPECT_EQ(reader1->current().get_source_num(), i % 3);
+        reader1->advance();
+        ASSERT_TRUE(reader2->has_remaining().ok());
+        EXPECT_EQ(reader2->current().get_source_num(), i % 3);
+        reader2->advance();
+    }
+    EXPECT_FALSE(reader1->has_remaining().ok());
+    EXPECT_FALSE(reader2->has_remaining().ok());
+}
+
 TEST_F(VerticalCompactionTest, TestDupKeyVerticalMerge) {
     auto num_input_rowset = 2;
     auto num_segments = 2;
@@ -21,8 +21,12 @@
 #include <gtest/gtest-test-part.h>
 
 #include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
 
 #include "gtest/gtest_pred_impl.h"
+#include "util/binary_cast.hpp"
 
 namespace doris::vectorized {
 
@@ -400,6 +404,41 @@ TEST(VDateTimeValueTest, date_diff_test) {
     }
 }
 
+TEST(VDateTimeValueTest, date_v2_from_canonical_date_str_test) {
+    // the canonical strings parsed by the fast path are the same as by the general parsing
+    for (std::string str :
+         {"2024-02-29", "2023-02-29", "0000-00-00", "9999-12-31", "2023-13-01", "2023-00-10",
+          "2023-1-012", "2023/01/01", "2023-01-01 12:34:56", "2023-01-01T23:59:59",
+          "2023-01-01 24:00:00", "2023-01-01 12:60:00", "2023-01-01_12:34:56",
+          "2023-01-01 12:34:5a", "2023-01-01 12-34-56", "2023-01-0a 12:34:56"}) {
+        for (bool convert_zero : {false, true}) {
+            DateV2Value<DateV2ValueType> date;
+            DateV2Value<DateTimeV2ValueType> date_time;
+            bool date_ok = date.from_date_str(str.data(), str.size(), -1, convert_zero);
+            bool date_time_ok = date_time.from_date_str(str.data(), str.size(), 6, convert_zero);
+
+            // the same string with a trailing space goes through the general parsing
+            std::string padded = str + " ";
+            DateV2Value<DateV2ValueType> expected_date;
+            DateV2Value<DateTimeV2ValueType> expected_date_time;
+            EXPECT_EQ(expected_date.from_date_str(padded.data(), padded.size(), -1, convert_zero),
+                      date_ok)
+                    << str;
+            EXPECT_EQ(expected_date_time.from_date_str(padded.data(), padded.size(), 6,
+                                                       convert_zero),
+                      date_time_ok)
+                    << str;
+            if (date_ok) {
+                EXPECT_EQ(expected_date.to_date_int_val(), date.to_date_int_val()) << str;
+            }
+            if (date_time_ok) {
+                EXPECT_EQ(expected_date_time.to_date_int_val(), date_time.to_date_int_val())
+                        << str;
+            }
+        }
+    }
+}
+
 TEST(VDateTimeValueTest, date_v2_to_string_test) {
     uint16_t year = 2022;
     uint8_t month = 5;
@@ -632,4 +671,65 @@ TEST(VDateTimeValueTest, date_v2_daynr_test) {
     }
 }
 
+template <typename NativeType, TimeUnit unit>
+void check_packed_date_v2_trunc(NativeType packed) {
+    using ValueType = std::conditional_t<std::is_same_v<NativeType, uint64_t>,
+                                         DateV2Value<DateTimeV2ValueType>,
+                                         DateV2Value<DateV2ValueType>>;
+    auto value = binary_cast<NativeType, ValueType>(packed);
+    ASSERT_TRUE(value.template datetime_trunc<unit>());
+    EXPECT_EQ(binary_cast<ValueType, NativeType>(value),
+              PackedDateV2<NativeType>::template trunc<unit>(packed));
+}
+
+template <typename NativeType>
+void check_packed_date_v2(NativeType packed) {
+    using ValueType = std::conditional_t<std::is_same_v<NativeType, uint64_t>,
+                                         DateV2Value<DateTimeV2ValueType>,
+                                         DateV2Value<DateV2ValueType>>;
+    using PackedType = PackedDateV2<NativeType>;
+    auto value = binary_cast<NativeType, ValueType>(packed);
+    EXPECT_EQ(value.year(), PackedType::year(packed));
+    EXPECT_EQ(value.month(), PackedType::month(packed));
+    EXPECT_EQ(value.day(), PackedType::day(packed));
+    EXPECT_EQ(value.hour(), PackedType::hour(packed));
+    EXPECT_EQ(value.minute(), PackedType::minute(packed));
+    EXPECT_EQ(value.second(), PackedType::second(packed));
+    EXPECT_EQ(value.microsecond(), PackedType::microsecond(packed));
+    ASSERT_EQ(value.is_valid_date(), PackedType::is_valid(packed)) << packed;
+    if (value.is_valid_date()) {
+        check_packed_date_v2_trunc<NativeType, SECOND>(packed);
+        check_packed_date_v2_trunc<NativeType, MINUTE>(packed);
+        check_packed_date_v2_trunc<NativeType, HOUR>(packed);
+        check_packed_date_v2_trunc<NativeType, DAY>(packed);
+        check_packed_date_v2_trunc<NativeType, MONTH>(packed);
+        check_packed_date_v2_trunc<NativeType, QUARTER>(packed);
+        check_packed_date_v2_trunc<NativeType, YEAR>(packed);
+    }
+}
+
+TEST(VDateTimeValueTest, packed_date_v2_test) {
+    // the leap years, the years out of range and all the values of the month and day fields
+    for (uint64_t year : {0, 1, 4, 100, 400, 1900, 2000, 2023, 2024, 9999, 10000}) {
+        for (uint64_t month = 0; month < 16; ++month) {
+            for (uint64_t day = 0; day < 32; ++day) {
+                check_packed_date_v2<uint32_t>((year << 9) | (month << 5) | day);
+                for (auto [hour, minute, second, microsecond] :
+                     std::vector<std::tuple<uint64_t, uint64_t, uint64_t, uint64_t>> {
+                             {0, 0, 0, 0},
+                             {23, 59, 59, 999999},
+                             {12, 30, 1, 123},
+                             {24, 0, 0, 0},
+                             {0, 60, 0, 0},
+                             {0, 0, 60, 0},
+                             {0, 0, 0, 1000000}}) {
+                    check_packed_date_v2<uint64_t>((year << 46) | (month << 42) | (day << 37) |
+                                                   (hour << 32) | (minute << 26) |
+                                                   (second << 20) | microsecond);
+                }
+            }
+        }
+    }
+}
+
 } // namespace doris::vectorized
@@ -0,0 +1,78 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "vec/sink/adaptive_compression.h"
+
+#include <gtest/gtest.h>
+
+#include "common/config.h"
+
+namespace doris::vectorized {
+
+class AdaptiveCompressionTest : public ::testing::Test {
+protected:
+    void SetUp() override { _network_mbps = config::exchange_adaptive_compression_network_mbps; }
+    void TearDown() override { config::exchange_adaptive_compression_network_mbps = _network_mbps; }
+
+    // Feed back blocks with the given ratio and speed(ns per byte) of each codec, and return
+    // the codec chosen after that.
+    static segment_v2::CompressionTypePB run(AdaptiveCompression& selector, double lz4_ratio,
+                                              double lz4_ns, double zstd_ratio, double zstd_ns) {
+        constexpr size_t bytes = 1 << 20;
+        for (int i = 0; i < 10; ++i) {
+            auto codec = selector.next_codec();
+            if (codec == segment_v2::LZ4) {
+                selector.update(codec, bytes, bytes * lz4_ratio, bytes * lz4_ns);
+            } else if (codec == segment_v2::ZSTD) {
+                selector.update(codec, bytes, bytes * zstd_ratio, bytes * zstd_ns);
+            } else {
+                selector.update(codec, bytes, bytes, 0);
+            }
+        }
+        return selector.next_codec();
+    }
+
+    int64_t _network_mbps = 0;
+};
+
+TEST_F(AdaptiveCompressionTest, fast_network_skips_compression) {
+    // 10GB/s, compression costs more than it saves
+    config::exchange_adaptive_compression_network_mbps = 10000;
+    AdaptiveCompression selector;
+    EXPECT_EQ(segment_v2::NO_COMPRESSION, run(selector, 0.5, 1, 0.3, 5));
+}
+
+TEST_F(AdaptiveCompressionTest, slow_network_prefers_ratio) {
+    // 50MB/s, every saved byte counts
+    config::exchange_adaptive_compression_network_mbps = 50;
+    AdaptiveCompression selector;
+    EXPECT_EQ(segment_v2::ZSTD, run(selector, 0.5, 1, 0.3, 3));
+}
+
+TEST_F(AdaptiveCompressionTest, medium_network_prefers_lz4) {
+    config::exchange_adaptive_compression_network_mbps = 500;
+    AdaptiveCompression selector;
+    EXPECT_EQ(segment_v2::LZ4, run(selector, 0.5, 0.2, 0.4, 5));
+}
+
+TEST_F(AdaptiveCompressionTest, incompressible_data) {
+    config::exchange_adaptive_compression_network_mbps = 50;
+    AdaptiveCompression selector;
+    EXPECT_EQ(segment_v2::NO_COMPRESSION, run(selector, 1, 1, 1, 5));
+}
+
+} // namespace doris::vectorized
@@ -90,6 +90,10 @@ bvar::LatencyRecorder g_bvar_txn_kv_range_remove("txn_kv", "range_remove");
 bvar::LatencyRecorder g_bvar_txn_kv_get_read_version("txn_kv", "get_read_version");
 bvar::LatencyRecorder g_bvar_txn_kv_get_committed_version("txn_kv", "get_committed_version");
 bvar::LatencyRecorder g_bvar_txn_kv_batch_get("txn_kv", "batch_get");
+bvar::LatencyRecorder g_bvar_txn_kv_batch_range_get("txn_kv", "batch_range_get");
+
+bvar::Adder<int64_t> g_bvar_tablet_stats_cache_hit("tablet_stats_cache", "hit");
+bvar::Adder<int64_t> g_bvar_tablet_stats_cache_miss("tablet_stats_cache", "miss");
 
 bvar::Adder<int64_t> g_bvar_txn_kv_commit_error_counter;
 bvar::Window<bvar::Adder<int64_t> > g_bvar_txn_kv_commit_error_counter_minute(
@@ -180,3 +184,8 @@ BvarStatusWithTag<long> g_bvar_checker_check_cost_s("checker", "check_cost_secon
 BvarStatusWithTag<long> g_bvar_checker_enqueue_cost_s("checker", "enqueue_cost_seconds");
 BvarStatusWithTag<long> g_bvar_checker_last_success_time_ms("checker", "last_success_time_ms");
 BvarStatusWithTag<long> g_bvar_checker_instance_volume("checker", "instance_volume");
+
+// recycler's bvars
+BvarStatusWithTag<long> g_bvar_recycler_num_recycled_tablets("recycler", "num_recycled_tablets");
+BvarStatusWithTag<long> g_bvar_recycler_recycle_tablet_concurrency("recycler",
+                                                                   "recycle_tablet_concurrency");
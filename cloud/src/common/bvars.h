@@ -186,6 +186,10 @@ extern bvar::LatencyRecorder g_bvar_txn_kv_range_remove;
 extern bvar::LatencyRecorder g_bvar_txn_kv_get_read_version;
 extern bvar::LatencyRecorder g_bvar_txn_kv_get_committed_version;
 extern bvar::LatencyRecorder g_bvar_txn_kv_batch_get;
+extern bvar::LatencyRecorder g_bvar_txn_kv_batch_range_get;
+
+extern bvar::Adder<int64_t> g_bvar_tablet_stats_cache_hit;
+extern bvar::Adder<int64_t> g_bvar_tablet_stats_cache_miss;
 
 extern bvar::Adder<int64_t> g_bvar_txn_kv_commit_error_counter;
 extern bvar::Adder<int64_t> g_bvar_txn_kv_commit_conflict_counter;
@@ -237,3 +241,7 @@ extern BvarStatusWithTag<long> g_bvar_checker_check_cost_s;
 extern BvarStatusWithTag<long> g_bvar_checker_enqueue_cost_s;
 extern BvarStatusWithTag<long> g_bvar_checker_last_success_time_ms;
 extern BvarStatusWithTag<long> g_bvar_checker_instance_volume;
+
+// recycler
+extern BvarStatusWithTag<long> g_bvar_recycler_num_recycled_tablets;
+extern BvarStatusWithTag<long> g_bvar_recycler_recycle_tablet_concurrency;
@@ -61,6 +61,10 @@ CONF_Strings(recycle_whitelist, ""); // Comma seprated list
 // These instances will not be recycled, only effective when whitelist is empty.
 CONF_Strings(recycle_blacklist, ""); // Comma seprated list
 CONF_mInt32(instance_recycler_worker_pool_size, "1");
+// The max number of dropped tablets of an index or a partition recycled in parallel, it is
+// halved on each failed tablet, e.g. the object store throttles the deletions, and grows back
+// on each recycled tablet.
+CONF_Int32(recycle_tablet_concurrency, "8");
 CONF_Bool(enable_checker, "false");
 // Currently only used for recycler test
 CONF_Bool(enable_inverted_check, "false");
@@ -122,6 +126,12 @@ CONF_mBool(write_schema_kv, "true");
 CONF_mBool(split_tablet_stats, "true");
 CONF_mBool(snapshot_get_tablet_stats, "true");
 
+// The time in milliseconds the tablet stats returned by `get_tablet_stats` may be served from the
+// in-process tablet stats cache, it bounds how stale the stats updated via other meta service
+// processes may be. 0 disables the cache.
+CONF_mInt64(tablet_stats_cache_ttl_ms, "0");
+CONF_Int64(tablet_stats_cache_capacity, "1000000");
+
 // Value codec version
 CONF_mInt16(meta_schema_value_version, "1");
 
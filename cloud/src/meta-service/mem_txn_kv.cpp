@@ -477,4 +477,21 @@ TxnErrorCode Transaction::batch_get(std::vector<std::optional<std::string>>* res
     return TxnErrorCode::TXN_OK;
 }
 
+TxnErrorCode Transaction::batch_range_get(
+        std::vector<std::unique_ptr<cloud::RangeGetIterator>>* res,
+        const std::vector<std::pair<std::string, std::string>>& ranges,
+        const BatchGetOptions& opts, int limit) {
+    res->clear();
+    res->reserve(ranges.size());
+    for (const auto& [begin, end] : ranges) {
+        std::unique_ptr<cloud::RangeGetIterator> it;
+        auto ret = get(begin, end, &it, opts.snapshot, limit);
+        if (ret != TxnErrorCode::TXN_OK) {
+            return ret;
+        }
+        res->push_back(std::move(it));
+    }
+    return TxnErrorCode::TXN_OK;
+}
+
 } // namespace doris::cloud::memkv
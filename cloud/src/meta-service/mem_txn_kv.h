@@ -184,6 +184,11 @@ public:
                            const std::vector<std::string>& keys,
                            const BatchGetOptions& opts = BatchGetOptions()) override;
 
+    TxnErrorCode batch_range_get(std::vector<std::unique_ptr<cloud::RangeGetIterator>>* res,
+                                 const std::vector<std::pair<std::string, std::string>>& ranges,
+                                 const BatchGetOptions& opts = BatchGetOptions(),
+                                 int limit = 10000) override;
+
     size_t approximate_bytes() const override { return approximate_bytes_; }
 
     size_t num_del_keys() const override { return num_del_keys_; }
@@ -1231,50 +1231,62 @@ void MetaServiceImpl::update_tmp_rowset(::google::protobuf::RpcController* contr
     }
 }
 
-void internal_get_rowset(Transaction* txn, int64_t start, int64_t end,
+// Get the rowset metas of the version ranges `versions`, the first range gets of all version
+// ranges are issued together.
+void internal_get_rowset(Transaction* txn, const std::vector<std::pair<int64_t, int64_t>>& versions,
                          const std::string& instance_id, int64_t tablet_id, MetaServiceCode& code,
                          std::string& msg, GetRowsetResponse* response) {
-    LOG(INFO) << "get_rowset start=" << start << ", end=" << end;
-    MetaRowsetKeyInfo key_info0 {instance_id, tablet_id, start};
-    MetaRowsetKeyInfo key_info1 {instance_id, tablet_id, end + 1};
-    std::string key0;
-    std::string key1;
-    meta_rowset_key(key_info0, &key0);
-    meta_rowset_key(key_info1, &key1);
-    std::unique_ptr<RangeGetIterator> it;
-
-    int num_rowsets = 0;
-    std::unique_ptr<int, std::function<void(int*)>> defer_log_range(
-            (int*)0x01, [key0, key1, &num_rowsets](int*) {
-                LOG(INFO) << "get rowset meta, num_rowsets=" << num_rowsets << " range=["
-                          << hex(key0) << "," << hex(key1) << "]";
-            });
+    std::vector<std::pair<std::string, std::string>> ranges;
+    ranges.reserve(versions.size());
+    for (auto [start, end] : versions) {
+        LOG(INFO) << "get_rowset start=" << start << ", end=" << end;
+        auto& [key0, key1] = ranges.emplace_back();
+        meta_rowset_key({instance_id, tablet_id, start}, &key0);
+        meta_rowset_key({instance_id, tablet_id, end + 1}, &key1);
+    }
+    std::vector<std::unique_ptr<RangeGetIterator>> iters;
+    TxnErrorCode err = txn->batch_range_get(&iters, ranges);
 
     std::stringstream ss;
-    do {
-        TxnErrorCode err = txn->get(key0, key1, &it);
-        if (err != TxnErrorCode::TXN_OK) {
-            code = cast_as<ErrCategory::READ>(err);
-            ss << "internal error, failed to get rowset, err=" << err;
-            msg = ss.str();
-            LOG(WARNING) << msg;
-            return;
-        }
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        auto& [key0, key1] = ranges[i];
+        // All of `iters` are valid if the batch range get succeeded
+        std::unique_ptr<RangeGetIterator> it;
+        if (err == TxnErrorCode::TXN_OK) it = std::move(iters[i]);
 
-        while (it->has_next()) {
-            auto [k, v] = it->next();
-            auto rs = response->add_rowset_meta();
-            if (!rs->ParseFromArray(v.data(), v.size())) {
-                code = MetaServiceCode::PROTOBUF_PARSE_ERR;
-                msg = "malformed rowset meta, unable to deserialize";
-                LOG(WARNING) << msg << " key=" << hex(k);
+        int num_rowsets = 0;
+        std::unique_ptr<int, std::function<void(int*)>> defer_log_range(
+                (int*)0x01, [begin = key0, end = key1, &num_rowsets](int*) {
+                    LOG(INFO) << "get rowset meta, num_rowsets=" << num_rowsets << " range=["
+                              << hex(begin) << "," << hex(end) << "]";
+                });
+
+        while (true) {
+            if (err != TxnErrorCode::TXN_OK) {
+                code = cast_as<ErrCategory::READ>(err);
+                ss << "internal error, failed to get rowset, err=" << err;
+                msg = ss.str();
+                LOG(WARNING) << msg;
                 return;
             }
-            ++num_rowsets;
-            if (!it->has_next()) key0 = k;
+
+            while (it->has_next()) {
+                auto [k, v] = it->next();
+                auto rs = response->add_rowset_meta();
+                if (!rs->ParseFromArray(v.data(), v.size())) {
+                    code = MetaServiceCode::PROTOBUF_PARSE_ERR;
+                    msg = "malformed rowset meta, unable to deserialize";
+                    LOG(WARNING) << msg << " key=" << hex(k);
+                    return;
+                }
+                ++num_rowsets;
+                if (!it->has_next()) key0 = k;
+            }
+            key0.push_back('\x00'); // Update to next smallest key for iteration
+            if (!it->more()) break;
+            err = txn->get(key0, key1, &it);
         }
-        key0.push_back('\x00'); // Update to next smallest key for iteration
-    } while (it->more());
+    }
 }
 
 std::vector<std::pair<int64_t, int64_t>> calc_sync_versions(int64_t req_bc_cnt, int64_t bc_cnt,
@@ -1444,11 +1456,9 @@ void MetaServiceImpl::get_rowset(::google::protobuf::RpcController* controller,
     }
     auto versions = calc_sync_versions(req_bc_cnt, bc_cnt, req_cc_cnt, cc_cnt, req_cp, cp,
                                        req_start, req_end);
-    for (auto [start, end] : versions) {
-        internal_get_rowset(txn.get(), start, end, instance_id, tablet_id, code, msg, response);
-        if (code != MetaServiceCode::OK) {
-            return;
-        }
+    internal_get_rowset(txn.get(), versions, instance_id, tablet_id, code, msg, response);
+    if (code != MetaServiceCode::OK) {
+        return;
     }
 
     // get referenced schema
@@ -1514,31 +1524,52 @@ void MetaServiceImpl::get_tablet_stats(::google::protobuf::RpcController* contro
     }
     RPC_RATE_LIMIT(get_tablet_stats)
 
+    // The stats of a batch of tablets are read together in one txn, the batch is bounded to keep
+    // the txn within the mvcc window of fdb.
+    constexpr int batch_size = 1000;
+    // FE polls the stats, which may be slightly stale
+    TabletStatsCache* cache =
+            config::tablet_stats_cache_ttl_ms > 0 ? &tablet_stats_cache_ : nullptr;
     std::unique_ptr<Transaction> txn;
-    for (auto& i : request->tablet_idx()) {
-        TabletIndexPB idx(i);
-        // FIXME(plat1ko): Get all tablet stats in one txn
+    std::vector<TabletIndexPB> idxes;
+    std::vector<TabletStatsPB> tablet_stats;
+    for (int begin = 0; begin < request->tablet_idx_size(); begin += batch_size) {
+        int end = std::min(begin + batch_size, request->tablet_idx_size());
+        uint64_t cache_version = tablet_stats_cache_.version();
         TxnErrorCode err = txn_kv_->create_txn(&txn);
         if (err != TxnErrorCode::TXN_OK) {
             code = cast_as<ErrCategory::CREATE>(err);
-            msg = fmt::format("failed to create txn, tablet_id={}", idx.tablet_id());
+            msg = fmt::format("failed to create txn, tablet_id={}",
+                              request->tablet_idx(begin).tablet_id());
+            response->clear_tablet_stats();
             return;
         }
-        if (!(/* idx.has_db_id() && */ idx.has_table_id() && idx.has_index_id() &&
-              idx.has_partition_id() && i.has_tablet_id())) {
-            get_tablet_idx(code, msg, txn.get(), instance_id, idx.tablet_id(), idx);
-            if (code != MetaServiceCode::OK) return;
+        idxes.clear();
+        for (int i = begin; i < end; ++i) {
+            const auto& req_idx = request->tablet_idx(i);
+            TabletIndexPB& idx = idxes.emplace_back(req_idx);
+            if (!(/* idx.has_db_id() && */ idx.has_table_id() && idx.has_index_id() &&
+                  idx.has_partition_id() && req_idx.has_tablet_id())) {
+                get_tablet_idx(code, msg, txn.get(), instance_id, idx.tablet_id(), idx);
+                if (code != MetaServiceCode::OK) {
+                    response->clear_tablet_stats();
+                    return;
+                }
+            }
         }
-        auto tablet_stats = response->add_tablet_stats();
-        internal_get_tablet_stats(code, msg, txn.get(), instance_id, idx, *tablet_stats, true);
+        internal_get_tablet_stats(code, msg, txn.get(), instance_id, idxes, tablet_stats, true,
+                                  cache, cache_version);
         if (code != MetaServiceCode::OK) {
             response->clear_tablet_stats();
-            break;
+            return;
         }
+        for (auto& stats : tablet_stats) {
 #ifdef NDEBUG
-        // Force data size >= 0 to reduce the losses caused by bugs
-        if (tablet_stats->data_size() < 0) tablet_stats->set_data_size(0);
+            // Force data size >= 0 to reduce the losses caused by bugs
+            if (stats.data_size() < 0) stats.set_data_size(0);
 #endif
+            response->add_tablet_stats()->Swap(&stats);
+        }
     }
 }
 
@@ -29,6 +29,7 @@
 
 #include "common/config.h"
 #include "common/sync_point.h"
+#include "meta-service/meta_service_tablet_stats.h"
 #include "meta-service/txn_kv.h"
 #include "rate-limiter/rate_limiter.h"
 #include "resource-manager/resource_manager.h"
@@ -271,6 +272,7 @@ private:
     std::shared_ptr<TxnKv> txn_kv_;
     std::shared_ptr<ResourceManager> resource_mgr_;
     std::shared_ptr<RateLimiter> rate_limiter_;
+    TabletStatsCache tablet_stats_cache_;
 };
 
 class MetaServiceProxy final : public MetaService {
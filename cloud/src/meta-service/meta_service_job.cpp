@@ -364,9 +364,16 @@ void MetaServiceImpl::start_tablet_job(::google::protobuf::RpcController* contro
 
     bool need_commit = false;
     std::unique_ptr<int, std::function<void(int*)>> defer_commit(
-            (int*)0x01, [&ss, &txn, &code, &msg, &need_commit](int*) {
+            (int*)0x01, [&ss, &txn, &code, &msg, &need_commit, &instance_id, tablet_id, request,
+                         this](int*) {
                 if (!need_commit) return;
                 TxnErrorCode err = txn->commit();
+                // The txn may be committed even if it failed
+                tablet_stats_cache_.invalidate(instance_id, tablet_id);
+                if (request->job().has_schema_change()) {
+                    const auto& new_tablet_idx = request->job().schema_change().new_tablet_idx();
+                    tablet_stats_cache_.invalidate(instance_id, new_tablet_idx.tablet_id());
+                }
                 if (err != TxnErrorCode::TXN_OK) {
                     code = cast_as<ErrCategory::COMMIT>(err);
                     ss << "failed to commit job kv, err=" << err;
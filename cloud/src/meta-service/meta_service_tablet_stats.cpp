@@ -19,6 +19,10 @@
 
 #include <fmt/format.h>
 
+#include <chrono>
+
+#include "common/bvars.h"
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/util.h"
 #include "meta-service/keys.h"
@@ -27,26 +31,25 @@
 
 namespace doris::cloud {
 
-void internal_get_tablet_stats(MetaServiceCode& code, std::string& msg, Transaction* txn,
-                               const std::string& instance_id, const TabletIndexPB& idx,
-                               TabletStatsPB& stats, TabletStats& detached_stats, bool snapshot) {
-    auto begin_key = stats_tablet_key(
-            {instance_id, idx.table_id(), idx.index_id(), idx.partition_id(), idx.tablet_id()});
-    auto end_key = stats_tablet_key(
-            {instance_id, idx.table_id(), idx.index_id(), idx.partition_id(), idx.tablet_id() + 1});
-    std::unique_ptr<RangeGetIterator> it;
-    TxnErrorCode err = txn->get(begin_key, end_key, &it, snapshot);
-    if (err != TxnErrorCode::TXN_OK) {
-        code = cast_as<ErrCategory::READ>(err);
-        msg = fmt::format("failed to get tablet stats, err={} tablet_id={}", err, idx.tablet_id());
-        return;
-    }
-    if (!it->has_next()) {
+static std::pair<std::string, std::string> tablet_stats_range(const std::string& instance_id,
+                                                              const TabletIndexPB& idx) {
+    return {stats_tablet_key({instance_id, idx.table_id(), idx.index_id(), idx.partition_id(),
+                              idx.tablet_id()}),
+            stats_tablet_key({instance_id, idx.table_id(), idx.index_id(), idx.partition_id(),
+                              idx.tablet_id() + 1})};
+}
+
+// Parse the tablet stats and detached tablet stats of `idx` from `it`, `it.next` SHOULD be the
+// first tablet stats KV.
+static void parse_tablet_stats(MetaServiceCode& code, std::string& msg, RangeGetIterator& it,
+                               const std::string& begin_key, const TabletIndexPB& idx,
+                               TabletStatsPB& stats, TabletStats& detached_stats) {
+    if (!it.has_next()) {
         code = MetaServiceCode::TABLET_NOT_FOUND;
         msg = fmt::format("tablet stats not found, tablet_id={}", idx.tablet_id());
         return;
     }
-    auto [k, v] = it->next();
+    auto [k, v] = it.next();
     // First key MUST be tablet stats key
     DCHECK(k == begin_key) << hex(k) << " vs " << hex(begin_key);
     if (!stats.ParseFromArray(v.data(), v.size())) {
@@ -55,7 +58,7 @@ void internal_get_tablet_stats(MetaServiceCode& code, std::string& msg, Transact
         return;
     }
     // Parse split tablet stats
-    int ret = get_detached_tablet_stats(*it, detached_stats);
+    int ret = get_detached_tablet_stats(it, detached_stats);
     if (ret != 0) {
         code = MetaServiceCode::PROTOBUF_PARSE_ERR;
         msg = fmt::format("marformed splitted tablet stats kv, key={}", hex(k));
@@ -63,6 +66,133 @@ void internal_get_tablet_stats(MetaServiceCode& code, std::string& msg, Transact
     }
 }
 
+void internal_get_tablet_stats(MetaServiceCode& code, std::string& msg, Transaction* txn,
+                               const std::string& instance_id, const TabletIndexPB& idx,
+                               TabletStatsPB& stats, TabletStats& detached_stats, bool snapshot) {
+    auto [begin_key, end_key] = tablet_stats_range(instance_id, idx);
+    std::unique_ptr<RangeGetIterator> it;
+    TxnErrorCode err = txn->get(begin_key, end_key, &it, snapshot);
+    if (err != TxnErrorCode::TXN_OK) {
+        code = cast_as<ErrCategory::READ>(err);
+        msg = fmt::format("failed to get tablet stats, err={} tablet_id={}", err, idx.tablet_id());
+        return;
+    }
+    parse_tablet_stats(code, msg, *it, begin_key, idx, stats, detached_stats);
+}
+
+void internal_get_tablet_stats(MetaServiceCode& code, std::string& msg, Transaction* txn,
+                               const std::string& instance_id,
+                               const std::vector<TabletIndexPB>& idxes,
+                               std::vector<TabletStatsPB>& stats, bool snapshot,
+                               TabletStatsCache* cache, uint64_t cache_version) {
+    stats.resize(idxes.size());
+    // The indexes of the tablets whose stats are not cached
+    std::vector<size_t> missed;
+    std::vector<std::pair<std::string, std::string>> ranges;
+    missed.reserve(idxes.size());
+    ranges.reserve(idxes.size());
+    for (size_t i = 0; i < idxes.size(); ++i) {
+        if (cache != nullptr && cache->get(instance_id, idxes[i].tablet_id(), &stats[i])) {
+            continue;
+        }
+        missed.push_back(i);
+        ranges.push_back(tablet_stats_range(instance_id, idxes[i]));
+    }
+    if (cache != nullptr) {
+        g_bvar_tablet_stats_cache_hit << idxes.size() - missed.size();
+        g_bvar_tablet_stats_cache_miss << missed.size();
+    }
+    if (missed.empty()) return;
+
+    std::vector<std::unique_ptr<RangeGetIterator>> iters;
+    TxnErrorCode err = txn->batch_range_get(&iters, ranges, Transaction::BatchGetOptions(snapshot));
+    if (err != TxnErrorCode::TXN_OK) {
+        code = cast_as<ErrCategory::READ>(err);
+        msg = fmt::format("failed to get tablet stats, err={} num_tablets={}", err, ranges.size());
+        return;
+    }
+    for (size_t j = 0; j < missed.size(); ++j) {
+        size_t i = missed[j];
+        TabletStats detached_stats;
+        parse_tablet_stats(code, msg, *iters[j], ranges[j].first, idxes[i], stats[i],
+                           detached_stats);
+        if (code != MetaServiceCode::OK) return;
+        merge_tablet_stats(stats[i], detached_stats);
+        if (cache != nullptr) {
+            cache->put(instance_id, idxes[i].tablet_id(), cache_version, stats[i]);
+        }
+    }
+}
+
+static int64_t steady_now_ms() {
+    using namespace std::chrono;
+    return duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+bool TabletStatsCache::get(const std::string& instance_id, int64_t tablet_id,
+                           TabletStatsPB* stats) {
+    auto& s = shard(tablet_id);
+    std::lock_guard l(s.mtx);
+    auto it = s.entries.find({instance_id, tablet_id});
+    if (it == s.entries.end() || !it->second.stats.has_value() ||
+        it->second.expiration_ms <= steady_now_ms()) {
+        return false;
+    }
+    *stats = *it->second.stats;
+    return true;
+}
+
+void TabletStatsCache::put(const std::string& instance_id, int64_t tablet_id, uint64_t version,
+                           const TabletStatsPB& stats) {
+    int64_t ttl_ms = config::tablet_stats_cache_ttl_ms;
+    if (ttl_ms <= 0) return;
+    auto& s = shard(tablet_id);
+    int64_t now_ms = steady_now_ms();
+    std::lock_guard l(s.mtx);
+    // An invalidation since `version` may be lost
+    if (version < s.dropped_invalidated_version) return;
+    auto key = std::make_pair(instance_id, tablet_id);
+    auto it = s.entries.find(key);
+    if (it == s.entries.end()) {
+        evict(s);
+        it = s.entries.emplace(std::move(key), Entry {}).first;
+    } else if (version < it->second.invalidated_version) {
+        // The stats may be read before the last update of them
+        return;
+    }
+    it->second.stats = stats;
+    it->second.expiration_ms = now_ms + ttl_ms;
+}
+
+void TabletStatsCache::invalidate(const std::string& instance_id, int64_t tablet_id) {
+    uint64_t version = clock_.fetch_add(1, std::memory_order_acq_rel) + 1;
+    auto& s = shard(tablet_id);
+    std::lock_guard l(s.mtx);
+    if (s.entries.empty()) {
+        // Nothing cached, e.g. the cache is disabled, skip recording the invalidation
+        s.dropped_invalidated_version = std::max(s.dropped_invalidated_version, version);
+        return;
+    }
+    auto key = std::make_pair(instance_id, tablet_id);
+    auto it = s.entries.find(key);
+    if (it == s.entries.end()) {
+        evict(s);
+        it = s.entries.emplace(std::move(key), Entry {}).first;
+    }
+    it->second.stats.reset();
+    it->second.invalidated_version = version;
+}
+
+void TabletStatsCache::evict(Shard& shard) {
+    size_t capacity = std::max<int64_t>(config::tablet_stats_cache_capacity / NUM_SHARDS, 1);
+    while (shard.entries.size() >= capacity) {
+        auto it = shard.entries.begin();
+        shard.dropped_invalidated_version =
+                std::max(shard.dropped_invalidated_version, it->second.invalidated_version);
+        shard.entries.erase(it);
+    }
+}
+
 int get_detached_tablet_stats(RangeGetIterator& iter, TabletStats& detached_stats) {
     while (iter.has_next()) {
         auto [k, v] = iter.next();
@@ -19,6 +19,14 @@
 
 #include <gen_cpp/cloud.pb.h>
 
+#include <array>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
 namespace doris::cloud {
 class Transaction;
 class RangeGetIterator;
@@ -31,6 +39,52 @@ struct TabletStats {
     int64_t num_segs = 0;
 };
 
+// A bounded in-process cache of the merged tablet stats, for the callers which may read
+// slightly stale stats, e.g. FE polling the stats of its tablets. The entries expire after
+// `config::tablet_stats_cache_ttl_ms`, which bounds the staleness of the stats updated via other
+// meta service processes, and the commit paths of this process invalidate the tablets they update.
+class TabletStatsCache {
+public:
+    // The version to fill the cache with, it MUST be taken before the txn reading the stats gets
+    // its read version, so the stats of a tablet invalidated since then are not filled.
+    uint64_t version() const { return clock_.load(std::memory_order_acquire); }
+
+    // Return true and set `stats` if the stats of the tablet are cached and not expired.
+    bool get(const std::string& instance_id, int64_t tablet_id, TabletStatsPB* stats);
+
+    void put(const std::string& instance_id, int64_t tablet_id, uint64_t version,
+             const TabletStatsPB& stats);
+
+    // Called after a txn updating the stats of the tablet, whatever the result of its commit.
+    void invalidate(const std::string& instance_id, int64_t tablet_id);
+
+private:
+    struct Entry {
+        std::optional<TabletStatsPB> stats; // empty if the entry records an invalidation
+        int64_t expiration_ms = 0;
+        uint64_t invalidated_version = 0;
+    };
+
+    struct Shard {
+        std::mutex mtx;
+        std::map<std::pair<std::string, int64_t>, Entry> entries;
+        // The max version of the invalidations not recorded in `entries`
+        uint64_t dropped_invalidated_version = 0;
+    };
+
+    static constexpr size_t NUM_SHARDS = 16;
+
+    Shard& shard(int64_t tablet_id) {
+        return shards_[static_cast<uint64_t>(tablet_id) % NUM_SHARDS];
+    }
+
+    // Make room for a new entry in `shard`, `shard.mtx` MUST be held.
+    void evict(Shard& shard);
+
+    std::atomic<uint64_t> clock_ {0};
+    std::array<Shard, NUM_SHARDS> shards_;
+};
+
 // Get tablet stats and detached tablet stats via `txn`. If an error occurs, `code` will be set to non OK.
 // NOTE: this function returns original `TabletStatsPB` and detached tablet stats val stored in kv store,
 //  MUST call `merge_tablet_stats(stats, detached_stats)` to get the real tablet stats.
@@ -47,6 +101,16 @@ void internal_get_tablet_stats(MetaServiceCode& code, std::string& msg, Transact
                                const std::string& instance_id, const TabletIndexPB& idx,
                                TabletStatsPB& stats, bool snapshot = false);
 
+// Get merged tablet stats of `idxes` via `txn`, the range gets of the tablets are issued
+// concurrently. If an error occurs, `code` will be set to non OK.
+// If `cache` is not null, the cached stats are returned and the stats read fill the cache with
+// `cache_version`, otherwise all stats are read via `txn`, for the callers needing strong reads.
+void internal_get_tablet_stats(MetaServiceCode& code, std::string& msg, Transaction* txn,
+                               const std::string& instance_id,
+                               const std::vector<TabletIndexPB>& idxes,
+                               std::vector<TabletStatsPB>& stats, bool snapshot = false,
+                               TabletStatsCache* cache = nullptr, uint64_t cache_version = 0);
+
 // Get detached tablet stats via `iter`, `iter.next` SHOULD be the first splitted tablet stats KV.
 // Return 0 if success, otherwise error.
 [[nodiscard]] int get_detached_tablet_stats(RangeGetIterator& iter, TabletStats& detached_stats);
@@ -1209,6 +1209,10 @@ void MetaServiceImpl::commit_txn(::google::protobuf::RpcController* controller,
 
     // Finally we are done...
     err = txn->commit();
+    // The txn may be committed even if it failed
+    for (auto& [tablet_id, _] : tablet_stats) {
+        tablet_stats_cache_.invalidate(instance_id, tablet_id);
+    }
     if (err != TxnErrorCode::TXN_OK) {
         code = cast_as<ErrCategory::COMMIT>(err);
         ss << "failed to commit kv txn, txn_id=" << txn_id << " err=" << err;
@@ -523,13 +523,15 @@ TxnErrorCode RangeGetIterator::init() {
     return TxnErrorCode::TXN_OK;
 }
 
+namespace {
+struct FDBFutureDelete {
+    void operator()(FDBFuture* future) { fdb_future_destroy(future); }
+};
+} // namespace
+
 TxnErrorCode Transaction::batch_get(std::vector<std::optional<std::string>>* res,
                                     const std::vector<std::string>& keys,
                                     const BatchGetOptions& opts) {
-    struct FDBFutureDelete {
-        void operator()(FDBFuture* future) { fdb_future_destroy(future); }
-    };
-
     res->clear();
     if (keys.empty()) {
         return TxnErrorCode::TXN_OK;
@@ -586,4 +588,54 @@ TxnErrorCode Transaction::batch_get(std::vector<std::optional<std::string>>* res
     return TxnErrorCode::TXN_OK;
 }
 
+TxnErrorCode Transaction::batch_range_get(
+        std::vector<std::unique_ptr<cloud::RangeGetIterator>>* res,
+        const std::vector<std::pair<std::string, std::string>>& ranges,
+        const BatchGetOptions& opts, int limit) {
+    res->clear();
+    if (ranges.empty()) {
+        return TxnErrorCode::TXN_OK;
+    }
+
+    StopWatch sw;
+    auto stop_watcher = [&sw](int*) { g_bvar_txn_kv_batch_range_get << sw.elapsed_us(); };
+    std::unique_ptr<int, decltype(stop_watcher)> defer((int*)0x01, std::move(stop_watcher));
+
+    size_t num_ranges = ranges.size();
+    res->reserve(num_ranges);
+    std::vector<std::unique_ptr<FDBFuture, FDBFutureDelete>> futures;
+    futures.reserve(opts.concurrency);
+    for (size_t i = 0; i < num_ranges; i += opts.concurrency) {
+        size_t size = std::min(i + opts.concurrency, num_ranges);
+        for (size_t j = i; j < size; j++) {
+            const auto& [begin, end] = ranges[j];
+            futures.emplace_back(fdb_transaction_get_range(
+                    txn_, FDB_KEYSEL_FIRST_GREATER_OR_EQUAL((uint8_t*)begin.data(), begin.size()),
+                    FDB_KEYSEL_FIRST_GREATER_OR_EQUAL((uint8_t*)end.data(), end.size()), limit,
+                    0 /*target_bytes, unlimited*/, FDBStreamingMode::FDB_STREAMING_MODE_WANT_ALL,
+                    0 /*iteration*/, opts.snapshot, false /*reverse*/));
+            approximate_bytes_ += begin.size() + end.size();
+        }
+
+        size_t num_futures = futures.size();
+        for (auto j = 0; j < num_futures; j++) {
+            FDBFuture* future = futures[j].get();
+            RETURN_IF_ERROR(await_future(future));
+            fdb_error_t err = fdb_future_get_error(future);
+            if (err) {
+                LOG(WARNING) << __PRETTY_FUNCTION__
+                             << " failed to fdb_future_get_error err=" << fdb_get_error(err)
+                             << " begin=" << hex(ranges[i + j].first);
+                return cast_as_txn_code(err);
+            }
+            std::unique_ptr<RangeGetIterator> it(new RangeGetIterator(futures[j].release()));
+            RETURN_IF_ERROR(it->init());
+            res->push_back(std::move(it));
+        }
+        futures.clear();
+    }
+    DCHECK_EQ(res->size(), num_ranges);
+    return TxnErrorCode::TXN_OK;
+}
+
 } // namespace doris::cloud::fdb
@@ -182,6 +182,22 @@ public:
                                    const std::vector<std::string>& keys,
                                    const BatchGetOptions& opts = BatchGetOptions()) = 0;
 
+    /**
+     * @brief batch get closed-open ranges, the range gets are issued concurrently and waited
+     *        together, like `batch_get`
+     *
+     * @param res the iterators of the ranges, in the order of `ranges`
+     * @param ranges the begin and end keys of the ranges
+     * @param opts
+     * @param limit if non-zero, indicates the maximum number of key-value pairs of each range
+     * @return If all ranges are successfully retrieved, return TXN_OK. Otherwise, return the code
+     *         of the first occurring error
+     */
+    virtual TxnErrorCode batch_range_get(
+            std::vector<std::unique_ptr<RangeGetIterator>>* res,
+            const std::vector<std::pair<std::string, std::string>>& ranges,
+            const BatchGetOptions& opts = BatchGetOptions(), int limit = 10000) = 0;
+
     /**
      * @brief return the approximate bytes consumed by the underlying transaction buffer.
      **/
@@ -497,6 +513,11 @@ public:
                            const std::vector<std::string>& keys,
                            const BatchGetOptions& opts = BatchGetOptions()) override;
 
+    TxnErrorCode batch_range_get(std::vector<std::unique_ptr<cloud::RangeGetIterator>>* res,
+                                 const std::vector<std::pair<std::string, std::string>>& ranges,
+                                 const BatchGetOptions& opts = BatchGetOptions(),
+                                 int limit = 10000) override;
+
     size_t approximate_bytes() const override { return approximate_bytes_; }
 
     size_t num_del_keys() const override { return num_del_keys_; }
@@ -25,7 +25,9 @@
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <deque>
+#include <mutex>
 #include <string>
 #include <string_view>
 
@@ -39,6 +41,7 @@
 #ifdef UNIT_TEST
 #include "../test/mock_accessor.h"
 #endif
+#include "common/bvars.h"
 #include "common/config.h"
 #include "common/encryption_util.h"
 #include "common/logging.h"
@@ -53,6 +56,47 @@ namespace doris::cloud {
 
 using namespace std::chrono;
 
+namespace {
+// Bounds the number of jobs in flight, the bound is halved on each failed job, e.g. the object
+// store throttles the deletions, and grows back by one on each succeeded job.
+class AdaptiveConcurrencyLimiter {
+public:
+    explicit AdaptiveConcurrencyLimiter(int max_concurrency)
+            : max_concurrency_(std::max(max_concurrency, 1)), concurrency_(max_concurrency_) {}
+
+    void acquire() {
+        std::unique_lock l(mtx_);
+        cv_.wait(l, [this] { return num_in_flight_ < concurrency_; });
+        ++num_in_flight_;
+    }
+
+    void release(bool success) {
+        std::lock_guard l(mtx_);
+        --num_in_flight_;
+        concurrency_ = success ? std::min(concurrency_ + 1, max_concurrency_)
+                               : std::max(concurrency_ / 2, 1);
+        cv_.notify_all();
+    }
+
+    void wait_all() {
+        std::unique_lock l(mtx_);
+        cv_.wait(l, [this] { return num_in_flight_ == 0; });
+    }
+
+    int concurrency() {
+        std::lock_guard l(mtx_);
+        return concurrency_;
+    }
+
+private:
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    const int max_concurrency_;
+    int concurrency_;
+    int num_in_flight_ = 0;
+};
+} // namespace
+
 // return 0 for success get a key, 1 for key not found, negative for error
 [[maybe_unused]] static int txn_get(TxnKv* txn_kv, std::string_view key, std::string& val) {
     std::unique_ptr<Transaction> txn;
@@ -1006,7 +1050,7 @@ int InstanceRecycler::recycle_versions() {
 int InstanceRecycler::recycle_tablets(int64_t table_id, int64_t index_id, int64_t partition_id,
                                       bool is_empty_tablet) {
     int num_scanned = 0;
-    int num_recycled = 0;
+    std::atomic_int num_recycled = 0;
 
     std::string tablet_key_begin, tablet_key_end;
     std::string stats_key_begin, stats_key_end;
@@ -1048,6 +1092,14 @@ int InstanceRecycler::recycle_tablets(int64_t table_id, int64_t index_id, int64_
                 .tag("num_recycled", num_recycled);
     });
 
+    // The non-empty tablets are recycled in parallel, `recycle_tablets_mtx` protects the states
+    // updated by the workers, `tablet_keys` and `use_range_remove`
+    AdaptiveConcurrencyLimiter limiter(config::recycle_tablet_concurrency);
+    std::mutex recycle_tablets_mtx;
+    auto worker_pool = std::make_unique<SimpleThreadPool>(
+            std::max(config::recycle_tablet_concurrency, 1));
+    worker_pool->start();
+
     // Elements in `tablet_keys` has the same lifetime as `it` in `scan_and_recycle`
     std::vector<std::string_view> tablet_keys;
     std::vector<std::string> tablet_idx_keys;
@@ -1064,13 +1116,31 @@ int InstanceRecycler::recycle_tablets(int64_t table_id, int64_t index_id, int64_
         int64_t tablet_id = tablet_meta_pb.tablet_id();
         tablet_idx_keys.push_back(meta_tablet_idx_key({instance_id_, tablet_id}));
         if (!is_empty_tablet) {
-            if (recycle_tablet(tablet_id) != 0) {
-                LOG_WARNING("failed to recycle tablet")
-                        .tag("instance_id", instance_id_)
-                        .tag("tablet_id", tablet_id);
-                use_range_remove = false;
-                return -1;
-            }
+            limiter.acquire();
+            worker_pool->submit([&, tablet_id, k]() {
+                bool success = recycle_tablet(tablet_id) == 0;
+                {
+                    std::lock_guard l(recycle_tablets_mtx);
+                    if (success) {
+                        tablet_keys.push_back(k);
+                    } else {
+                        use_range_remove = false;
+                    }
+                }
+                if (success) {
+                    ++num_recycled;
+                    g_bvar_recycler_num_recycled_tablets.put(
+                            instance_id_, num_recycled_tablets_.fetch_add(1) + 1);
+                } else {
+                    LOG_WARNING("failed to recycle tablet")
+                            .tag("instance_id", instance_id_)
+                            .tag("tablet_id", tablet_id);
+                }
+                limiter.release(success);
+                g_bvar_recycler_recycle_tablet_concurrency.put(instance_id_,
+                                                              limiter.concurrency());
+            });
+            return 0;
         } else {
             // Empty tablet only has a [0-1] init rowset
             init_rs_keys.push_back(meta_rowset_key({instance_id_, tablet_id, 1}));
@@ -1101,6 +1171,8 @@ int InstanceRecycler::recycle_tablets(int64_t table_id, int64_t index_id, int64_
     };
 
     auto loop_done = [&, this]() -> int {
+        // All recycled tablets of the batch are in `tablet_keys` once the workers are done
+        limiter.wait_all();
         if (tablet_keys.empty() && tablet_idx_keys.empty()) return 0;
         std::unique_ptr<int, std::function<void(int*)>> defer((int*)0x01, [&](int*) {
             tablet_keys.clear();
@@ -1108,6 +1180,9 @@ int InstanceRecycler::recycle_tablets(int64_t table_id, int64_t index_id, int64_
             init_rs_keys.clear();
             use_range_remove = true;
         });
+        // The workers finish in any order
+        std::sort(tablet_keys.begin(), tablet_keys.end());
+        int ret = use_range_remove ? 0 : -1;
         std::unique_ptr<Transaction> txn;
         if (txn_kv_->create_txn(&txn) != TxnErrorCode::TXN_OK) {
             LOG(WARNING) << "failed to delete tablet meta kv, instance_id=" << instance_id_;
@@ -1135,7 +1210,7 @@ int InstanceRecycler::recycle_tablets(int64_t table_id, int64_t index_id, int64_
                          << ", err=" << err;
             return -1;
         }
-        return 0;
+        return ret;
     };
 
     int ret = scan_and_recycle(tablet_key_begin, tablet_key_end, std::move(recycle_func),
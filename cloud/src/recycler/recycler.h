@@ -212,6 +212,8 @@ private:
     std::mutex recycled_tablets_mtx_;
     // Store recycled tablets, we can skip deleting rowset data of these tablets because these data has already been deleted.
     std::unordered_set<int64_t> recycled_tablets_;
+    // The number of the dropped tablets recycled by this recycler
+    std::atomic<int64_t> num_recycled_tablets_ {0};
 
     std::mutex recycle_tasks_mutex;
     // <task_name, start_time>>
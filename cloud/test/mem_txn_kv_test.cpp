@@ -163,6 +163,26 @@ static void range_get_test(std::shared_ptr<cloud::TxnKv> txn_kv) {
         ASSERT_EQ(txn->get("key1", "key1", &iter), TxnErrorCode::TXN_OK);
         ASSERT_EQ(iter->size(), 0) << txn_kv_class;
     }
+
+    // batch range get
+    {
+        ASSERT_EQ(txn_kv->create_txn(&txn), TxnErrorCode::TXN_OK);
+        std::vector<std::unique_ptr<RangeGetIterator>> iters;
+        std::vector<std::pair<std::string, std::string>> ranges = {
+                {"key1", "key3"}, {"key4", "key1"}, {"key2", "key6"}, {"key1", "key4"}};
+        Transaction::BatchGetOptions opts;
+        opts.concurrency = 3;
+        ASSERT_EQ(txn->batch_range_get(&iters, ranges, opts, 2), TxnErrorCode::TXN_OK);
+        ASSERT_EQ(iters.size(), ranges.size()) << txn_kv_class;
+        ASSERT_EQ(iters[0]->size(), 2) << txn_kv_class;
+        ASSERT_EQ(iters[0]->more(), false) << txn_kv_class;
+        ASSERT_EQ(iters[1]->size(), 0) << txn_kv_class;
+        ASSERT_EQ(iters[2]->size(), 2) << txn_kv_class;
+        ASSERT_EQ(iters[2]->more(), true) << txn_kv_class;
+        ASSERT_EQ(iters[2]->next().first, "key2") << txn_kv_class;
+        ASSERT_EQ(iters[3]->size(), 2) << txn_kv_class;
+        ASSERT_EQ(iters[3]->next().second, "val1") << txn_kv_class;
+    }
 }
 
 TEST(TxnMemKvTest, RangeGetTest) {
@@ -3391,6 +3391,78 @@ TEST(MetaServiceTest, GetTabletStatsTest) {
     EXPECT_EQ(res.tablet_stats(0).num_segments(), 4);
 }
 
+TEST(MetaServiceTest, GetTabletStatsCacheTest) {
+    auto meta_service = get_meta_service();
+    auto old_ttl_ms = config::tablet_stats_cache_ttl_ms;
+    config::tablet_stats_cache_ttl_ms = 3600000;
+    std::unique_ptr<int, std::function<void(int*)>> defer(
+            (int*)0x01, [old_ttl_ms](int*) { config::tablet_stats_cache_ttl_ms = old_ttl_ms; });
+
+    constexpr auto table_id = 10001, index_id = 10002, partition_id = 10003, tablet_id = 10004;
+    ASSERT_NO_FATAL_FAILURE(
+            create_tablet(meta_service.get(), table_id, index_id, partition_id, tablet_id));
+    GetTabletStatsResponse res;
+    get_tablet_stats(meta_service.get(), table_id, index_id, partition_id, tablet_id, res);
+    ASSERT_EQ(res.status().code(), MetaServiceCode::OK);
+    ASSERT_EQ(res.tablet_stats_size(), 1);
+    EXPECT_EQ(res.tablet_stats(0).num_rowsets(), 1);
+
+    // The commit of the load invalidates the cached stats
+    ASSERT_NO_FATAL_FAILURE(
+            insert_rowset(meta_service.get(), 10000, "label1", table_id, partition_id, tablet_id));
+    res.Clear();
+    get_tablet_stats(meta_service.get(), table_id, index_id, partition_id, tablet_id, res);
+    ASSERT_EQ(res.status().code(), MetaServiceCode::OK);
+    ASSERT_EQ(res.tablet_stats_size(), 1);
+    EXPECT_EQ(res.tablet_stats(0).num_rowsets(), 2);
+
+    // The stats updated by others are served from the cache till the entry expires
+    std::unique_ptr<Transaction> txn;
+    ASSERT_EQ(meta_service->txn_kv()->create_txn(&txn), TxnErrorCode::TXN_OK);
+    std::string num_rowsets_key;
+    stats_tablet_num_rowsets_key({mock_instance, table_id, index_id, partition_id, tablet_id},
+                                 &num_rowsets_key);
+    txn->atomic_add(num_rowsets_key, 1);
+    ASSERT_EQ(txn->commit(), TxnErrorCode::TXN_OK);
+    res.Clear();
+    get_tablet_stats(meta_service.get(), table_id, index_id, partition_id, tablet_id, res);
+    ASSERT_EQ(res.status().code(), MetaServiceCode::OK);
+    EXPECT_EQ(res.tablet_stats(0).num_rowsets(), 2);
+
+    config::tablet_stats_cache_ttl_ms = 0;
+    res.Clear();
+    get_tablet_stats(meta_service.get(), table_id, index_id, partition_id, tablet_id, res);
+    ASSERT_EQ(res.status().code(), MetaServiceCode::OK);
+    EXPECT_EQ(res.tablet_stats(0).num_rowsets(), 3);
+}
+
+TEST(MetaServiceTest, TabletStatsCacheVersionTest) {
+    auto old_ttl_ms = config::tablet_stats_cache_ttl_ms;
+    config::tablet_stats_cache_ttl_ms = 3600000;
+    std::unique_ptr<int, std::function<void(int*)>> defer(
+            (int*)0x01, [old_ttl_ms](int*) { config::tablet_stats_cache_ttl_ms = old_ttl_ms; });
+
+    TabletStatsCache cache;
+    TabletStatsPB stats;
+    stats.set_num_rows(10);
+    cache.put("instance", 1, cache.version(), stats);
+    cache.put("instance", 2, cache.version(), stats);
+    TabletStatsPB cached;
+    ASSERT_TRUE(cache.get("instance", 1, &cached));
+    EXPECT_EQ(cached.num_rows(), 10);
+    ASSERT_FALSE(cache.get("other_instance", 1, &cached));
+
+    // The stats read before an invalidation are not filled
+    auto version = cache.version();
+    cache.invalidate("instance", 1);
+    ASSERT_FALSE(cache.get("instance", 1, &cached));
+    cache.put("instance", 1, version, stats);
+    ASSERT_FALSE(cache.get("instance", 1, &cached));
+    cache.put("instance", 1, cache.version(), stats);
+    ASSERT_TRUE(cache.get("instance", 1, &cached));
+    ASSERT_TRUE(cache.get("instance", 2, &cached));
+}
+
 TEST(MetaServiceTest, GetDeleteBitmapUpdateLock) {
     auto meta_service = get_meta_service();
 